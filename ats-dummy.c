@@ -60,17 +60,8 @@ get_page_address(uint64_t address)
 int
 read_page(uint64_t address, uint32_t devfn, uint8_t* buffer)
 {
-	const int CHUNK_SIZE = 256;
-	int i, read_result = 0;
-	uint64_t page_address = get_page_address(address);
-	for (i = 0; i < 4096; i += CHUNK_SIZE) {
-		read_result = perform_dma_read((buffer + i), CHUNK_SIZE, devfn, 0,
-			(page_address + i));
-		if (read_result != 0) {
-			break;
-		}
-	}
-	return read_result;
+	return perform_dma_long_read(buffer, 4096, devfn, 0,
+		get_page_address(address));
 }
 
 int
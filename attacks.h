@@ -16,18 +16,108 @@ typedef const struct Descriptor * const ConstDescriptorP;
 typedef void (*OperateOnDescriptor)(E1000ECore *core,
 	ConstDescriptorP descriptor);
 
+/*
+ * Calls loop_body with every descriptor between the head and tail of the
+ * first ring of the given type.
+ */
 void
 for_each_descriptor_address(E1000ECore *core, enum DescriptorType which_ring,
 	OperateOnDescriptor loop_body, void (*done)());
 
+/*
+ * As for_each_descriptor_address, but only with descriptors posted since the
+ * previous call for that ring, so each descriptor is seen once.
+ */
+void
+for_each_new_descriptor_address(E1000ECore *core,
+	enum DescriptorType which_ring, OperateOnDescriptor loop_body,
+	void (*done)());
+
+/*
+ * Cumulative counts of descriptors handed to hooks, and of descriptors still
+ * in a ring that were skipped because a hook had already seen them.
+ */
+void
+get_descriptor_hook_counts(E1000ECore *core, uint64_t *inspected,
+	uint64_t *skipped);
+
+#define MAX_DESCRIPTOR_HOOKS 8
+
+enum DescriptorAlignment { DA_ANY, DA_CLUSTER_ALIGNED, DA_NOT_CLUSTER_ALIGNED };
+
+/*
+ * Cheap checks applied before a hook is called. Cluster alignment is 2K.
+ * RX descriptors report the posted buffer size as their length. With
+ * skip_seen_pages, descriptors whose buffer is in a page passed to the same
+ * hook during its last 64 passes over the ring are skipped.
+ */
+struct DescriptorFilter {
+	enum DescriptorAlignment alignment;
+	uint16_t min_length;
+	uint16_t max_length; /* 0 for no upper bound */
+	bool skip_seen_pages;
+};
+
+/*
+ * Subscribes loop_body to descriptors newly posted to rings of the given
+ * type: transmit descriptors when TDT is written, receive descriptors when
+ * RDT is written. All subscribers are served from one pass over the ring,
+ * and done is called after each pass. A NULL filter matches everything.
+ *
+ * Returns a hook id, or -1 if MAX_DESCRIPTOR_HOOKS are already registered.
+ */
+int
+register_descriptor_hook(enum DescriptorType ring,
+	const struct DescriptorFilter *filter, OperateOnDescriptor loop_body,
+	void (*done)());
+
+void
+unregister_descriptor_hook(int id);
+
 /*
  * Before the NIC begins processing its transmit ring, loop_body is called
- * with every transmit descriptor in the transmit ring.
+ * with every transmit descriptor posted since the previous doorbell write.
+ * Descriptors the hook has already seen are not passed to it again.
  *
- * Note that the register call will override the previously registered
- * handler.
+ * Note that the register call will override the handler previously
+ * registered with this function. Use register_descriptor_hook to add more.
  */
 void
 register_pre_xmit_hook(OperateOnDescriptor loop_body, void (*done)());
 
+/*
+ * The pages the mbuf attacks have already processed since reset_read_pages,
+ * which is cheap enough to use as a hook's done callback. Every hit in
+ * page_was_read is a 4K DMA read that was not repeated.
+ */
+void
+mark_page_read(hwaddr page_addr);
+
+bool
+page_was_read(hwaddr page_addr);
+
+void
+reset_read_pages();
+
+void
+get_read_page_counts(uint64_t *hits, uint64_t *misses);
+
+/*
+ * Sets up the map of which host pages are readable, as configured by the
+ * THUNDERCLAP_REACHABILITY and THUNDERCLAP_VICTIM environment variables.
+ * Returns false if the map can't be allocated.
+ */
+bool
+initialise_reachability();
+
+/*
+ * Reads through perform_dma_long_read of pages the reachability map knows
+ * give UR fail without a TLP. This maps unknown pages in
+ * [start, start + length), probing one page in every stride_pages before
+ * refining around the readable ones. Returns the number of probes made.
+ */
+uint64_t
+map_reachable_pages(E1000ECore *core, uint64_t start, uint64_t length,
+	uint64_t stride_pages, uint64_t max_probes);
+
 #endif
@@ -0,0 +1,139 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/*
+ * Measures how fast pcie-postgres-row.c decodes trace rows. The rows are
+ * fetched from the qemu_trace table once, in the binary format the postgres
+ * backend's cursors use, and the recorded result set is then decoded
+ * repeatedly, so the figure excludes the database and the network.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "libpq-fe.h"
+
+#include "pcie-postgres-row.h"
+
+#define DEFAULT_ROWS	100000
+#define DEFAULT_PASSES	20
+
+static double
+seconds_since(const struct timespec *start)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - start->tv_sec) +
+		(now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+int
+main(int argc, char **argv)
+{
+	PGconn *connection;
+	PGresult *result;
+	struct postgres_trace_columns columns;
+	struct trace_row row;
+	struct timespec start;
+	char query[128];
+	int rows = DEFAULT_ROWS, passes = DEFAULT_PASSES, tuple_count, pass;
+	int tuple;
+	uint64_t checksum = 0;
+	double elapsed;
+
+	if (argc < 2 || argc > 4) {
+		printf("Usage: %s CONNECTION_STRING [ROWS [PASSES]]\n", argv[0]);
+		return 1;
+	}
+	if (argc > 2) {
+		rows = atoi(argv[2]);
+	}
+	if (argc > 3) {
+		passes = atoi(argv[3]);
+	}
+	if (rows <= 0 || passes <= 0) {
+		printf("ROWS and PASSES must be positive.\n");
+		return 1;
+	}
+	if (!postgres_row_decoder_init()) {
+		return 2;
+	}
+
+	connection = PQconnectdb(argv[1]);
+	if (PQstatus(connection) != CONNECTION_OK) {
+		printf("Couldn't connect: %s", PQerrorMessage(connection));
+		PQfinish(connection);
+		return 2;
+	}
+	snprintf(query, sizeof(query),
+		"SELECT * FROM qemu_trace ORDER BY packet ASC LIMIT %d", rows);
+	result = PQexecParams(connection, query, 0, NULL, NULL, NULL, NULL, 1);
+	if (PQresultStatus(result) != PGRES_TUPLES_OK) {
+		printf("Couldn't record rows: %s", PQerrorMessage(connection));
+		PQclear(result);
+		PQfinish(connection);
+		return 3;
+	}
+	tuple_count = PQntuples(result);
+	if (tuple_count == 0) {
+		printf("qemu_trace is empty.\n");
+		PQclear(result);
+		PQfinish(connection);
+		return 3;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (pass = 0; pass < passes; ++pass) {
+		/* The backend resolves columns once for each FETCH. */
+		if (!postgres_trace_columns_resolve(result, &columns)) {
+			break;
+		}
+		for (tuple = 0; tuple < tuple_count; ++tuple) {
+			trace_row_from_postgres(result, &columns, tuple, &row);
+			checksum += row.packet ^ row.tlp_type ^ row.data;
+		}
+	}
+	elapsed = seconds_since(&start);
+
+	if (pass == passes) {
+		printf("Decoded %d rows %d times in %.3f s: %.0f rows/s, "
+			"%.1f ns/row (checksum %llx).\n", tuple_count, passes, elapsed,
+			(double)tuple_count * passes / elapsed,
+			elapsed * 1e9 / ((double)tuple_count * passes),
+			(unsigned long long)checksum);
+	}
+
+	PQclear(result);
+	PQfinish(connection);
+	return pass == passes ? 0 : 3;
+}
@@ -39,6 +39,7 @@
 #define CONFIG_CPUID_H 1
 //#define CONFIG_INT128 1
 #define CONFIG_TRACE_STDERR 1
+#define CONFIG_TRACE_RING 1
 #define CONFIG_TRACE_FILE trace
 #define CONFIG_IASL iasl
 #define HOST_DSOSUF ".so"
@@ -0,0 +1,238 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/*
+ * Prints a trace file written by the ring tracing backend (trace/ring.h),
+ * either as one line of text per event or, with --json, as a Chrome trace
+ * event timeline that chrome://tracing or Perfetto can load.
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "trace/ring.h"
+
+struct event_description {
+	char *name;
+	char *kinds;
+	char *arg_names[TRACE_RING_MAX_ARGS];
+};
+
+static struct event_description *events;
+static uint32_t event_count;
+
+/* Splits the event table into its lines, in place. */
+static bool
+parse_event_table(char *table, uint32_t length)
+{
+	char *line = table, *end = table + length, *newline, *name;
+
+	events = calloc(event_count, sizeof(*events));
+	if (events == NULL) {
+		return false;
+	}
+	for (uint32_t id = 0; id < event_count; ++id) {
+		newline = memchr(line, '\n', end - line);
+		if (newline == NULL) {
+			return false;
+		}
+		*newline = '\0';
+		events[id].name = strsep(&line, "\t");
+		events[id].kinds = strsep(&line, "\t");
+		if (events[id].kinds == NULL || line == NULL) {
+			return false;
+		}
+		for (int arg = 0; arg < TRACE_RING_MAX_ARGS &&
+				(name = strsep(&line, ",")) != NULL; ++arg) {
+			events[id].arg_names[arg] = name;
+		}
+		line = newline + 1;
+	}
+	return true;
+}
+
+static void
+print_json_string(const char *text)
+{
+	putchar('"');
+	for (; *text != '\0'; ++text) {
+		if (*text == '"' || *text == '\\') {
+			printf("\\%c", *text);
+		} else if ((unsigned char)*text < 0x20) {
+			printf("\\u%04x", *text);
+		} else {
+			putchar(*text);
+		}
+	}
+	putchar('"');
+}
+
+static void
+print_value(const TraceRingRecord *record, int arg, char kind, bool json,
+	bool *text_used)
+{
+	uint64_t value = record->args[arg];
+	double real;
+
+	switch (kind) {
+	case TRACE_RING_KIND_SIGNED:
+		printf("%"PRId64, (int64_t)value);
+		break;
+	case TRACE_RING_KIND_DOUBLE:
+		memcpy(&real, &value, sizeof(real));
+		printf("%g", real);
+		break;
+	case TRACE_RING_KIND_STRING:
+		/* Only the first string argument's text is recorded. */
+		if (!*text_used && value != 0) {
+			*text_used = true;
+			if (json) {
+				print_json_string(record->text);
+			} else {
+				printf("\"%s\"%s", record->text,
+					record->flags & TRACE_RING_TRUNCATED_TEXT ? "..." : "");
+			}
+			break;
+		}
+		/* Fall through */
+	case TRACE_RING_KIND_POINTER:
+		printf(json ? "\"0x%"PRIx64"\"" : "0x%"PRIx64, value);
+		break;
+	default:
+		printf("%"PRIu64, value);
+	}
+}
+
+static void
+print_record(const TraceRingRecord *record, bool json, bool first)
+{
+	const struct event_description *event = &events[record->event];
+	bool text_used = false;
+
+	if (json) {
+		printf("%s\n{\"name\":", first ? "" : ",");
+		print_json_string(event->name);
+		printf(",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%"PRIu32
+			",\"ts\":%"PRIu64".%03"PRIu64",\"args\":{", record->thread,
+			record->timestamp / 1000, record->timestamp % 1000);
+	} else {
+		printf("%"PRIu64".%09"PRIu64" %"PRIu32" %s", record->timestamp /
+			1000000000, record->timestamp % 1000000000, record->thread,
+			event->name);
+	}
+	for (int arg = 0; arg < record->arg_count; ++arg) {
+		const char *name = event->arg_names[arg];
+		char kind = event->kinds[arg];
+		if (name == NULL || kind == '\0') {
+			break;
+		}
+		if (json) {
+			printf("%s\"%s\":", arg == 0 ? "" : ",", name);
+		} else {
+			printf(" %s=", name);
+		}
+		print_value(record, arg, kind, json, &text_used);
+	}
+	if (json) {
+		printf("}}");
+	} else {
+		if (record->flags & TRACE_RING_TRUNCATED_ARGS) {
+			printf(" ...");
+		}
+		putchar('\n');
+	}
+}
+
+int
+main(int argc, char *argv[])
+{
+	TraceRingFileHeader header;
+	TraceRingRecord record;
+	FILE *trace_file;
+	char *table;
+	bool json = (argc == 3 && strcmp(argv[1], "--json") == 0);
+	uint64_t count = 0, unknown = 0;
+
+	if (argc != 2 && !json) {
+		fprintf(stderr, "Usage: %s [--json] <trace file>\n", argv[0]);
+		return 1;
+	}
+	trace_file = fopen(argv[argc - 1], "rb");
+	if (trace_file == NULL) {
+		perror("Couldn't open trace");
+		return 1;
+	}
+	if (fread(&header, sizeof(header), 1, trace_file) != 1 ||
+		header.magic != TRACE_RING_MAGIC ||
+		header.version != TRACE_RING_VERSION ||
+		header.record_size != sizeof(TraceRingRecord)) {
+		fprintf(stderr, "%s is not a version %d trace for this host.\n",
+			argv[argc - 1], TRACE_RING_VERSION);
+		return 1;
+	}
+	event_count = header.event_count;
+	table = malloc(header.event_table_length);
+	if (table == NULL ||
+		fread(table, header.event_table_length, 1, trace_file) != 1 ||
+		!parse_event_table(table, header.event_table_length)) {
+		fprintf(stderr, "%s has a damaged event table.\n", argv[argc - 1]);
+		return 1;
+	}
+
+	if (json) {
+		printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+	}
+	while (fread(&record, sizeof(record), 1, trace_file) == 1) {
+		if (record.event >= event_count) {
+			++unknown;
+			continue;
+		}
+		print_record(&record, json, count == 0);
+		++count;
+	}
+	if (json) {
+		printf("\n]}\n");
+	}
+
+	fprintf(stderr, "Printed %"PRIu64" events.\n", count);
+	if (unknown > 0) {
+		fprintf(stderr, "Skipped %"PRIu64" records with unknown events.\n",
+			unknown);
+	}
+	fclose(trace_file);
+	free(events);
+	free(table);
+	return 0;
+}
@@ -0,0 +1,553 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "exfiltration.h"
+
+/*
+ * Compression
+ * ---------------------------------------------------------------------------
+ */
+
+#define LZ_MIN_MATCH 4
+#define LZ_LAST_LITERALS 5 /* The block format ends with this many literals */
+#define LZ_MATCH_LIMIT 12 /* No match may start closer than this to the end */
+#define LZ_HASH_BITS 12
+#define LZ_MAX_OFFSET 65535
+
+static inline uint32_t
+read32(const uint8_t *bytes)
+{
+	uint32_t value;
+	memcpy(&value, bytes, sizeof(value));
+	return value;
+}
+
+static inline uint32_t
+lz_hash(uint32_t sequence)
+{
+	return (sequence * 2654435761U) >> (32 - LZ_HASH_BITS);
+}
+
+/* Writes a length continuation: 255s, then the remainder. */
+static inline uint8_t *
+lz_put_length(uint8_t *out, const uint8_t *out_end, int length)
+{
+	while (length >= 255) {
+		if (out >= out_end) {
+			return NULL;
+		}
+		*out++ = 255;
+		length -= 255;
+	}
+	if (out >= out_end) {
+		return NULL;
+	}
+	*out++ = length;
+	return out;
+}
+
+static uint8_t *
+lz_put_sequence(uint8_t *out, const uint8_t *out_end, const uint8_t *literals,
+	int literal_length, int offset, int match_length)
+{
+	uint8_t *token = out++;
+	int match_code = match_length - LZ_MIN_MATCH;
+
+	if (token >= out_end) {
+		return NULL;
+	}
+	*token = (literal_length >= 15 ? 15 : literal_length) << 4;
+	if (literal_length >= 15 &&
+		(out = lz_put_length(out, out_end, literal_length - 15)) == NULL) {
+		return NULL;
+	}
+	if (out + literal_length > out_end) {
+		return NULL;
+	}
+	memcpy(out, literals, literal_length);
+	out += literal_length;
+	if (match_length == 0) {
+		return out; /* Final literals */
+	}
+
+	if (out + 2 > out_end) {
+		return NULL;
+	}
+	*out++ = offset & 0xFF;
+	*out++ = offset >> 8;
+	*token |= match_code >= 15 ? 15 : match_code;
+	if (match_code >= 15) {
+		out = lz_put_length(out, out_end, match_code - 15);
+	}
+	return out;
+}
+
+int
+exfil_compress(const uint8_t *source, int length, uint8_t *destination,
+	int capacity)
+{
+	uint16_t table[1 << LZ_HASH_BITS];
+	const uint8_t *out_end = destination + capacity;
+	uint8_t *out = destination;
+	int position = 0, anchor = 0, candidate, match_length;
+	uint32_t sequence, hash;
+
+	memset(table, 0, sizeof(table));
+	while (position < length - LZ_MATCH_LIMIT) {
+		sequence = read32(source + position);
+		hash = lz_hash(sequence);
+		candidate = table[hash];
+		table[hash] = position;
+
+		if (candidate >= position || position - candidate > LZ_MAX_OFFSET ||
+			read32(source + candidate) != sequence) {
+			/* Skip faster through data that does not compress. */
+			position += 1 + ((position - anchor) >> 6);
+			continue;
+		}
+
+		match_length = LZ_MIN_MATCH;
+		while (position + match_length < length - LZ_LAST_LITERALS &&
+			source[candidate + match_length] ==
+			source[position + match_length]) {
+			++match_length;
+		}
+		out = lz_put_sequence(out, out_end, source + anchor,
+			position - anchor, position - candidate, match_length);
+		if (out == NULL) {
+			return 0;
+		}
+		position += match_length;
+		anchor = position;
+	}
+
+	out = lz_put_sequence(out, out_end, source + anchor, length - anchor, 0, 0);
+	return out == NULL ? 0 : out - destination;
+}
+
+int
+exfil_decompress(const uint8_t *source, int length, uint8_t *destination,
+	int capacity)
+{
+	const uint8_t *in = source, *in_end = source + length;
+	uint8_t *out = destination, *out_end = destination + capacity;
+	int literal_length, match_length, offset;
+	uint8_t token, extra;
+
+	while (in < in_end) {
+		token = *in++;
+		literal_length = token >> 4;
+		if (literal_length == 15) {
+			do {
+				if (in >= in_end) {
+					return -1;
+				}
+				extra = *in++;
+				literal_length += extra;
+			} while (extra == 255);
+		}
+		if (in + literal_length > in_end ||
+			out + literal_length > out_end) {
+			return -1;
+		}
+		memcpy(out, in, literal_length);
+		in += literal_length;
+		out += literal_length;
+		if (in == in_end) {
+			break; /* The last sequence has no match */
+		}
+
+		if (in + 2 > in_end) {
+			return -1;
+		}
+		offset = in[0] | in[1] << 8;
+		in += 2;
+		match_length = (token & 0xF) + LZ_MIN_MATCH;
+		if ((token & 0xF) == 15) {
+			do {
+				if (in >= in_end) {
+					return -1;
+				}
+				extra = *in++;
+				match_length += extra;
+			} while (extra == 255);
+		}
+		if (offset == 0 || offset > out - destination ||
+			out + match_length > out_end) {
+			return -1;
+		}
+		/* Byte by byte, as matches may overlap their own output. */
+		for (int i = 0; i < match_length; ++i, ++out) {
+			*out = *(out - offset);
+		}
+	}
+	return out - destination;
+}
+
+/*
+ * Writer
+ * ---------------------------------------------------------------------------
+ */
+
+static uint64_t
+now_ns(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static bool
+write_fully(int fd, const uint8_t *buffer, size_t length)
+{
+	ssize_t result;
+
+	while (length > 0) {
+		result = write(fd, buffer, length);
+		if (result < 0 && errno == EINTR) {
+			continue;
+		}
+		if (result <= 0) {
+			return false;
+		}
+		buffer += result;
+		length -= result;
+	}
+	return true;
+}
+
+/*
+ * Writes the part of the block not yet on disk, padded with zeros to the next
+ * EXFIL_ALIGNMENT, and starts a new block.
+ */
+static void
+flush_block(struct exfil_writer *writer)
+{
+	uint32_t padded = (writer->block_used + EXFIL_ALIGNMENT - 1) &
+		~(EXFIL_ALIGNMENT - 1);
+
+	if (writer->block_used == 0) {
+		return;
+	}
+	memset(writer->block + writer->block_used, 0,
+		padded - writer->block_used);
+	if (!write_fully(writer->fd, writer->block + writer->block_synced,
+			padded - writer->block_synced)) {
+		++writer->write_errors;
+	}
+	writer->file_offset += padded;
+	writer->block_used = 0;
+	writer->block_synced = 0;
+}
+
+/*
+ * Writes the records added to the block since it was last written, without
+ * padding, and keeps filling the same block. A sparse capture then costs
+ * its records' size on disk rather than an aligned block each.
+ */
+static void
+sync_block(struct exfil_writer *writer)
+{
+	if (writer->block_synced == writer->block_used) {
+		return;
+	}
+	if (!write_fully(writer->fd, writer->block + writer->block_synced,
+			writer->block_used - writer->block_synced)) {
+		++writer->write_errors;
+	}
+	writer->block_synced = writer->block_used;
+}
+
+/*
+ * Stores a page-sized record as a zero page or a reference to an earlier
+ * copy, if it is one, filling in the header and the stored bytes. Returns
+ * false if the record's contents need storing.
+ */
+static bool
+deduplicate_page(struct exfil_writer *writer, const struct exfil_slot *slot,
+	struct exfil_record_header *header, uint8_t *stored)
+{
+	uint64_t offset = writer->file_offset + writer->block_used, first;
+
+	if (page_is_zero(slot->data)) {
+		header->flags = EXFIL_ZERO_PAGE;
+		header->stored_length = 0;
+		++writer->zero_pages;
+		return true;
+	}
+	page_key_of(slot->data, &header->hash);
+	if (!page_store_find_or_add(&writer->pages, &header->hash, slot->data,
+			offset, &first)) {
+		return false;
+	}
+	header->flags = EXFIL_DUPLICATE;
+	header->stored_length = sizeof(first);
+	memcpy(stored, &first, sizeof(first));
+	++writer->duplicate_pages;
+	return true;
+}
+
+static void
+write_record(struct exfil_writer *writer, const struct exfil_slot *slot)
+{
+	struct exfil_record_header header;
+	struct exfil_index_entry entry;
+	uint32_t needed;
+	uint8_t *stored;
+	int compressed;
+
+	needed = sizeof(header) + EXFIL_MAX_RECORD_BYTES;
+	if (writer->block_used + needed > EXFIL_BLOCK_BYTES) {
+		flush_block(writer);
+	}
+	stored = writer->block + writer->block_used + sizeof(header);
+
+	memset(&header, 0, sizeof(header));
+	header.magic = EXFIL_RECORD_MAGIC;
+	header.type = slot->type;
+	header.sequence = writer->sequence++;
+	header.timestamp_ns = slot->timestamp_ns;
+	header.iova = slot->iova;
+	header.length = slot->length;
+	if (slot->length != PAGE_STORE_PAGE_BYTES ||
+		!deduplicate_page(writer, slot, &header, stored)) {
+		/* Compress straight into the block, after room for the header. */
+		compressed = exfil_compress(slot->data, slot->length, stored,
+			slot->length);
+		header.flags = compressed > 0 ? EXFIL_COMPRESSED : 0;
+		header.stored_length = compressed > 0 ? compressed : slot->length;
+		if (compressed == 0) {
+			memcpy(stored, slot->data, slot->length);
+		}
+	}
+	memcpy(writer->block + writer->block_used, &header, sizeof(header));
+
+	entry.sequence = header.sequence;
+	entry.timestamp_ns = header.timestamp_ns;
+	entry.iova = header.iova;
+	entry.hash = header.hash;
+	entry.offset = writer->file_offset + writer->block_used;
+	entry.length = header.length;
+	entry.type = header.type;
+	entry.flags = header.flags;
+	fwrite(&entry, sizeof(entry), 1, writer->index);
+
+	/* Keep every header 8-byte aligned. */
+	writer->block_used += (sizeof(header) + header.stored_length + 7) & ~7;
+	++writer->written;
+	writer->bytes_in += slot->length;
+	writer->bytes_out += sizeof(header) + header.stored_length;
+}
+
+static void *
+writer_thread(void *opaque)
+{
+	struct exfil_writer *writer = opaque;
+	uint32_t head;
+
+	while (true) {
+		sem_wait(&writer->records_ready);
+		head = __atomic_load_n(&writer->head, __ATOMIC_ACQUIRE);
+		if (writer->tail == head) {
+			if (__atomic_load_n(&writer->stopping, __ATOMIC_ACQUIRE)) {
+				break;
+			}
+			continue;
+		}
+		write_record(writer,
+			&writer->slots[writer->tail & (EXFIL_RING_SLOTS - 1)]);
+		__atomic_store_n(&writer->tail, writer->tail + 1, __ATOMIC_RELEASE);
+		/* Write out when idle, so a quiet capture is still on disk. */
+		if (writer->tail == __atomic_load_n(&writer->head, __ATOMIC_ACQUIRE)) {
+			sync_block(writer);
+			fflush(writer->index);
+		}
+	}
+	flush_block(writer);
+	return NULL;
+}
+
+bool
+exfil_writer_open(struct exfil_writer *writer, const char *path)
+{
+	size_t path_length = strlen(path);
+	char *index_path;
+
+	memset(writer, 0, sizeof(*writer));
+	writer->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (writer->fd < 0) {
+		return false;
+	}
+	index_path = malloc(path_length + sizeof(".idx"));
+	if (index_path == NULL) {
+		close(writer->fd);
+		return false;
+	}
+	memcpy(index_path, path, path_length);
+	memcpy(index_path + path_length, ".idx", sizeof(".idx"));
+	writer->index = fopen(index_path, "wb");
+	free(index_path);
+
+	writer->slots = malloc(EXFIL_RING_SLOTS * sizeof(*writer->slots));
+	if (!page_store_init(&writer->pages, EXFIL_DEDUP_PAGES)) {
+		writer->pages.entries = NULL;
+	}
+	if (posix_memalign((void **)&writer->block, EXFIL_ALIGNMENT,
+			EXFIL_BLOCK_BYTES) != 0) {
+		writer->block = NULL;
+	}
+	if (writer->index == NULL || writer->slots == NULL ||
+		writer->block == NULL || writer->pages.entries == NULL ||
+		sem_init(&writer->records_ready, 0, 0) != 0) {
+		goto fail;
+	}
+	if (pthread_create(&writer->thread, NULL, writer_thread, writer) != 0) {
+		sem_destroy(&writer->records_ready);
+		goto fail;
+	}
+	return true;
+
+fail:
+	if (writer->index != NULL) {
+		fclose(writer->index);
+	}
+	free(writer->slots);
+	free(writer->block);
+	page_store_destroy(&writer->pages);
+	close(writer->fd);
+	writer->fd = -1;
+	return false;
+}
+
+bool
+exfil_submit(struct exfil_writer *writer, enum exfil_record_type type,
+	uint64_t iova, const void *data, uint32_t length)
+{
+	struct exfil_slot *slot;
+	uint32_t head = writer->head;
+
+	++writer->submitted;
+	if (writer->slots == NULL || length > EXFIL_MAX_RECORD_BYTES ||
+		head - __atomic_load_n(&writer->tail, __ATOMIC_ACQUIRE) ==
+		EXFIL_RING_SLOTS) {
+		++writer->dropped;
+		return false;
+	}
+
+	slot = &writer->slots[head & (EXFIL_RING_SLOTS - 1)];
+	slot->type = type;
+	slot->iova = iova;
+	slot->length = length;
+	slot->timestamp_ns = now_ns();
+	memcpy(slot->data, data, length);
+	__atomic_store_n(&writer->head, head + 1, __ATOMIC_RELEASE);
+	sem_post(&writer->records_ready);
+	return true;
+}
+
+void
+exfil_writer_close(struct exfil_writer *writer)
+{
+	if (writer->slots == NULL) {
+		return;
+	}
+	__atomic_store_n(&writer->stopping, true, __ATOMIC_RELEASE);
+	sem_post(&writer->records_ready);
+	pthread_join(writer->thread, NULL);
+	sem_destroy(&writer->records_ready);
+
+	fclose(writer->index);
+	close(writer->fd);
+	free(writer->slots);
+	free(writer->block);
+	page_store_destroy(&writer->pages);
+	writer->slots = NULL;
+	writer->block = NULL;
+}
+
+/*
+ * Reader
+ * ---------------------------------------------------------------------------
+ */
+
+int
+exfil_read_record(FILE *capture, uint64_t offset,
+	struct exfil_record_header *header, uint8_t *data, int capacity)
+{
+	uint8_t stored[EXFIL_MAX_RECORD_BYTES];
+	struct exfil_record_header first;
+	uint64_t first_offset;
+	int length;
+
+	if (fseeko(capture, offset, SEEK_SET) != 0 ||
+		fread(header, sizeof(*header), 1, capture) != 1 ||
+		header->magic != EXFIL_RECORD_MAGIC ||
+		header->stored_length > EXFIL_MAX_RECORD_BYTES ||
+		header->length > capacity) {
+		return -1;
+	}
+	if (header->flags & EXFIL_ZERO_PAGE) {
+		memset(data, 0, header->length);
+		return header->length;
+	}
+	if (header->flags & EXFIL_DUPLICATE) {
+		/* The first copy is always earlier, and never a reference itself. */
+		if (fread(&first_offset, sizeof(first_offset), 1, capture) != 1 ||
+			first_offset >= offset) {
+			return -1;
+		}
+		length = exfil_read_record(capture, first_offset, &first, data,
+			capacity);
+		return length == header->length &&
+			!(first.flags & EXFIL_DUPLICATE) ? length : -1;
+	}
+	if (!(header->flags & EXFIL_COMPRESSED)) {
+		if (fread(data, 1, header->length, capture) != header->length) {
+			return -1;
+		}
+		return header->length;
+	}
+	if (fread(stored, 1, header->stored_length, capture) !=
+		header->stored_length) {
+		return -1;
+	}
+	return exfil_decompress(stored, header->stored_length, data, capacity) ==
+		header->length ? header->length : -1;
+}
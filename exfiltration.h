@@ -0,0 +1,186 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef EXFILTRATION_H
+#define EXFILTRATION_H
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "page_store.h"
+
+/*
+ * Writes captured pages to disk from a separate thread, so that the thread
+ * servicing TLPs never waits on storage. Records pass through a
+ * single-producer, single-consumer ring; when it is full they are dropped
+ * and counted. The writer compresses each record with an LZ4 block
+ * compatible compressor and writes the data file in aligned blocks of
+ * EXFIL_BLOCK_BYTES; when idle it writes out the block so far unpadded and
+ * carries on filling it. A companion index, the data file's path with ".idx"
+ * appended, holds a fixed-size entry per record so records can be found
+ * without reading the whole capture.
+ *
+ * Page-sized records are deduplicated by content. A zero page is stored as
+ * a header alone, and a page seen before as a header referring to the record
+ * holding the first copy, so analysis can skip repeats using the index. The
+ * writer remembers EXFIL_DEDUP_PAGES pages at a time, so a page that has not
+ * recurred for a while is stored again.
+ */
+
+#define EXFIL_MAX_RECORD_BYTES 8192
+#define EXFIL_RING_SLOTS 128 /* Power of two */
+#define EXFIL_BLOCK_BYTES (64 * 1024)
+#define EXFIL_ALIGNMENT 4096
+#define EXFIL_DEDUP_PAGES 4096 /* Pages remembered, 16 MB of copies */
+
+#define EXFIL_RECORD_MAGIC 0x58464C54 /* "TLFX" on disk */
+#define EXFIL_COMPRESSED 0x1
+#define EXFIL_ZERO_PAGE 0x2 /* Nothing stored */
+#define EXFIL_DUPLICATE 0x4 /* Stores the offset of the first copy */
+
+enum exfil_record_type {
+	ERT_MBUF_PAGE = 1,
+	ERT_WINDOW = 2,
+	ERT_PAGE = 3,
+	ERT_WINDOW_DELTA = 4 /* XBZRLE, against the previous ERT_WINDOW version */
+};
+
+/* Precedes every record in the data file, in host byte order. */
+struct exfil_record_header {
+	uint32_t magic;
+	uint16_t type;
+	uint16_t flags;
+	uint64_t sequence;
+	uint64_t timestamp_ns; /* CLOCK_MONOTONIC, at submission */
+	uint64_t iova;
+	struct page_key hash; /* Zero unless the record is page-sized */
+	uint32_t length; /* Uncompressed */
+	uint32_t stored_length; /* Bytes following this header */
+};
+
+struct exfil_index_entry {
+	uint64_t sequence;
+	uint64_t timestamp_ns;
+	uint64_t iova;
+	struct page_key hash;
+	uint64_t offset; /* Of the record header in the data file */
+	uint32_t length;
+	uint16_t type;
+	uint16_t flags;
+};
+
+struct exfil_slot {
+	uint16_t type;
+	uint32_t length;
+	uint64_t iova;
+	uint64_t timestamp_ns;
+	uint8_t data[EXFIL_MAX_RECORD_BYTES];
+};
+
+struct exfil_writer {
+	int fd;
+	FILE *index;
+	pthread_t thread;
+	sem_t records_ready;
+	bool stopping;
+
+	struct exfil_slot *slots;
+	uint32_t head; /* Next slot to fill; written by the producer only */
+	uint32_t tail; /* Next slot to drain; written by the writer only */
+
+	/* Owned by the writer thread */
+	uint8_t *block;
+	uint32_t block_used;
+	uint32_t block_synced; /* Bytes of the block already written */
+	uint64_t file_offset;
+	uint64_t sequence;
+	struct page_store pages;
+
+	/* Updated by the producer */
+	uint64_t submitted;
+	uint64_t dropped;
+	/* Updated by the writer thread */
+	uint64_t written;
+	uint64_t bytes_in;
+	uint64_t bytes_out;
+	uint64_t zero_pages;
+	uint64_t duplicate_pages;
+	uint64_t write_errors;
+};
+
+/*
+ * Creates the data file and its index and starts the writer thread. Returns
+ * false on failure.
+ */
+bool
+exfil_writer_open(struct exfil_writer *writer, const char *path);
+
+/*
+ * Queues a copy of data for writing without blocking. Returns false, and
+ * counts the record as dropped, if the ring is full or length exceeds
+ * EXFIL_MAX_RECORD_BYTES.
+ */
+bool
+exfil_submit(struct exfil_writer *writer, enum exfil_record_type type,
+	uint64_t iova, const void *data, uint32_t length);
+
+/* Writes everything queued, pads the data file to alignment and closes it. */
+void
+exfil_writer_close(struct exfil_writer *writer);
+
+/*
+ * LZ4 block format compression. Returns the compressed length, or 0 if the
+ * result would not fit in capacity. length must be at most 65536.
+ */
+int
+exfil_compress(const uint8_t *source, int length, uint8_t *destination,
+	int capacity);
+
+/* Returns the decompressed length, or -1 if the input is malformed. */
+int
+exfil_decompress(const uint8_t *source, int length, uint8_t *destination,
+	int capacity);
+
+/*
+ * Reads the record whose header is at offset in a capture, as given by its
+ * index entry. Zero pages and references to earlier copies are expanded.
+ * Returns the record's length, or -1 on error.
+ */
+int
+exfil_read_record(FILE *capture, uint64_t offset,
+	struct exfil_record_header *header, uint8_t *data, int capacity);
+
+#endif
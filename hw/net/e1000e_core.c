@@ -37,6 +37,7 @@
 #include "pcie-debug.h"
 #include "log.h"
 #include "mask.h"
+#include "page_set.h"
 
 #include "hw/hw.h"
 #include "hw/pci/pci.h"
@@ -60,14 +61,133 @@
  * Some support for the attack toolkit, by cr437@cam.ac.uk
  */
 
-static OperateOnDescriptor _PRE_XMIT_HOOK;
-static void (*_PRE_XMIT_HOOK_DONE)();
+#define DESCRIPTOR_HOOK_SEEN_PAGES 256
+#define DESCRIPTOR_HOOK_SEEN_PASSES 64
+#define DESCRIPTOR_CLUSTER_BYTES 2048
+
+struct DescriptorHook {
+	bool in_use;
+	enum DescriptorType ring;
+	struct DescriptorFilter filter;
+	OperateOnDescriptor loop_body;
+	void (*done)();
+	struct page_set seen_pages;
+};
+
+static struct DescriptorHook _DESCRIPTOR_HOOKS[MAX_DESCRIPTOR_HOOKS];
+static int _HOOK_COUNT[2]; /* Indexed by DescriptorType */
+static int _PRE_XMIT_HOOK_ID = -1;
+
+int
+register_descriptor_hook(enum DescriptorType ring,
+	const struct DescriptorFilter *filter, OperateOnDescriptor loop_body,
+	void (*done)())
+{
+	struct DescriptorHook *hook;
+	int id;
+
+	for (id = 0; id < MAX_DESCRIPTOR_HOOKS; ++id) {
+		if (!_DESCRIPTOR_HOOKS[id].in_use) {
+			break;
+		}
+	}
+	if (id == MAX_DESCRIPTOR_HOOKS) {
+		return -1;
+	}
+
+	hook = &_DESCRIPTOR_HOOKS[id];
+	memset(hook, 0, sizeof(*hook));
+	hook->ring = ring;
+	if (filter != NULL) {
+		hook->filter = *filter;
+	}
+	if (hook->filter.skip_seen_pages &&
+		!page_set_init(&hook->seen_pages, DESCRIPTOR_HOOK_SEEN_PAGES,
+			DESCRIPTOR_HOOK_SEEN_PASSES, 0)) {
+		return -1;
+	}
+	hook->loop_body = loop_body;
+	hook->done = done;
+	hook->in_use = true;
+	++_HOOK_COUNT[ring];
+
+	return id;
+}
+
+void
+unregister_descriptor_hook(int id)
+{
+	if (id < 0 || id >= MAX_DESCRIPTOR_HOOKS || !_DESCRIPTOR_HOOKS[id].in_use) {
+		return;
+	}
+	_DESCRIPTOR_HOOKS[id].in_use = false;
+	page_set_destroy(&_DESCRIPTOR_HOOKS[id].seen_pages);
+	--_HOOK_COUNT[_DESCRIPTOR_HOOKS[id].ring];
+}
 
 void
 register_pre_xmit_hook(OperateOnDescriptor loop_body, void (*done)())
 {
-	_PRE_XMIT_HOOK = loop_body;
-	_PRE_XMIT_HOOK_DONE = done;
+	unregister_descriptor_hook(_PRE_XMIT_HOOK_ID);
+	_PRE_XMIT_HOOK_ID = register_descriptor_hook(DT_TRANSMIT, NULL, loop_body,
+		done);
+}
+
+static bool
+_descriptor_hook_matches(struct DescriptorHook *hook,
+	ConstDescriptorP descriptor)
+{
+	const struct DescriptorFilter *filter = &hook->filter;
+	bool cluster_aligned =
+		(descriptor->buffer_addr % DESCRIPTOR_CLUSTER_BYTES) == 0;
+
+	if ((filter->alignment == DA_CLUSTER_ALIGNED && !cluster_aligned) ||
+		(filter->alignment == DA_NOT_CLUSTER_ALIGNED && cluster_aligned)) {
+		return false;
+	}
+	if (descriptor->length < filter->min_length ||
+		(filter->max_length != 0 && descriptor->length > filter->max_length)) {
+		return false;
+	}
+	if (filter->skip_seen_pages && page_set_test_and_add(&hook->seen_pages,
+			descriptor->buffer_addr & ~(uint64_t)0xFFF)) {
+		return false;
+	}
+	return true;
+}
+
+/* Passed to the ring walk, so every subscriber is served by one pass. */
+static void
+_dispatch_descriptor_hooks(E1000ECore *core, ConstDescriptorP descriptor)
+{
+	struct DescriptorHook *hook;
+
+	for (int id = 0; id < MAX_DESCRIPTOR_HOOKS; ++id) {
+		hook = &_DESCRIPTOR_HOOKS[id];
+		if (hook->in_use && hook->ring == descriptor->type &&
+			_descriptor_hook_matches(hook, descriptor)) {
+			hook->loop_body(core, descriptor);
+		}
+	}
+}
+
+static void
+_finish_descriptor_hooks(enum DescriptorType ring)
+{
+	struct DescriptorHook *hook;
+
+	for (int id = 0; id < MAX_DESCRIPTOR_HOOKS; ++id) {
+		hook = &_DESCRIPTOR_HOOKS[id];
+		if (!hook->in_use || hook->ring != ring) {
+			continue;
+		}
+		if (hook->filter.skip_seen_pages) {
+			page_set_new_generation(&hook->seen_pages);
+		}
+		if (hook->done != NULL) {
+			(*hook->done)();
+		}
+	}
 }
 
 /*
@@ -641,7 +761,13 @@ _e1000e_rss_calc_hash(E1000ECore *core,
         return 0;
     }
 
-    return net_rx_pkt_calc_rss_hash(pkt, type, (uint8_t *) &core->mac[RSSRK]);
+    if (!core->rss_table_valid) {
+        net_toeplitz_table_init(&core->rss_table,
+                                (uint8_t *) &core->mac[RSSRK]);
+        core->rss_table_valid = true;
+    }
+
+    return net_rx_pkt_calc_rss_hash_table(pkt, type, &core->rss_table);
 }
 
 static void
@@ -990,6 +1116,146 @@ _e1000e_rx_ring_init(E1000ECore *core, E1000E_RxRing *rxr, int idx)
     rxr->i      = &i[idx];
 }
 
+static void
+read_rx_descriptor(E1000ECore *core, uint8_t *desc,
+                   hwaddr (*buff_addr)[MAX_PS_BUFFERS]);
+
+/*
+ * Attack toolkit descriptor walking.
+ *
+ * Ring indices count 16 byte units, so a packet split RX descriptor takes
+ * two. Contiguous descriptors are fetched with a single DMA read of up to
+ * HOOK_DESCRIPTOR_BATCH descriptors.
+ */
+#define HOOK_DESCRIPTOR_BATCH 32
+
+static inline uint32_t
+_e1000e_ring_size(E1000ECore *core, const E1000E_RingInfo *r)
+{
+    return core->mac[r->dlen] / E1000_RING_DESC_LEN;
+}
+
+static inline uint32_t
+_e1000e_ring_distance(E1000ECore *core, const E1000E_RingInfo *r,
+    uint32_t from, uint32_t to)
+{
+    return (to >= from) ? to - from : _e1000e_ring_size(core, r) - from + to;
+}
+
+/* Calls loop_body for each descriptor from index start up to the tail, and
+ * returns the number of descriptors visited. */
+static uint32_t
+_e1000e_walk_descriptors(E1000ECore *core, enum DescriptorType which_ring,
+	const E1000E_RingInfo *ri, uint32_t start, OperateOnDescriptor loop_body)
+{
+	struct Descriptor descriptor;
+	struct e1000_tx_desc *tx_desc;
+	uint8_t batch[HOOK_DESCRIPTOR_BATCH * E1000_MAX_RX_DESC_LEN];
+	hwaddr rx_ba[MAX_PS_BUFFERS]; /* Buffer addresses */
+	uint32_t size = _e1000e_ring_size(core, ri);
+	uint32_t tail = core->mac[ri->dt];
+	uint32_t cursor = start, visited = 0, count, i;
+	size_t desc_len;
+	uint32_t units;
+
+	if (which_ring == DT_TRANSMIT) {
+		desc_len = sizeof(struct e1000_tx_desc);
+	} else {
+		desc_len = core->rx_desc_len;
+	}
+	units = desc_len / E1000_RING_DESC_LEN;
+	descriptor.type = which_ring;
+	/* RX descriptors carry no length until written back, so report the size
+	 * of the buffer the driver posted. */
+	descriptor.length = core->rx_desc_buf_size;
+
+	if (size == 0 || units == 0) {
+		return 0;
+	}
+
+	while (cursor != tail && cursor < size) {
+		/* Stop each batch at the tail or the end of the ring. */
+		count = ((tail > cursor) ? tail : size) - cursor;
+		count = MIN(count / units, HOOK_DESCRIPTOR_BATCH);
+		if (count == 0) {
+			break;
+		}
+
+		pci_dma_read(core->owner,
+			_e1000e_ring_descriptor_address(core, ri, cursor),
+			batch, count * desc_len);
+
+		for (i = 0; i < count; ++i) {
+			if (which_ring == DT_TRANSMIT) {
+				tx_desc = (struct e1000_tx_desc *)(batch + i * desc_len);
+				descriptor.buffer_addr = le64_to_cpu(tx_desc->buffer_addr);
+				descriptor.length = le16_to_cpu(tx_desc->lower.flags.length);
+			} else { /* which_ring == DT_RECEIVE */
+				read_rx_descriptor(core, batch + i * desc_len, &rx_ba);
+				descriptor.buffer_addr = rx_ba[0];
+			}
+			loop_body(core, &descriptor);
+		}
+
+		visited += count;
+		cursor += count * units;
+		if (cursor >= size) {
+			cursor = 0;
+		}
+	}
+
+	return visited;
+}
+
+/*
+ * Calls loop_body only for descriptors posted since the previous walk of
+ * this ring. The cursor is valid while it lies between head and tail. If the
+ * device has consumed past it, or the ring was reprogrammed, the walk
+ * restarts from the head.
+ */
+static void
+_e1000e_walk_new_descriptors(E1000ECore *core, enum DescriptorType which_ring,
+	const E1000E_RingInfo *ri, E1000EHookCursor *cursor,
+	OperateOnDescriptor loop_body)
+{
+	uint32_t size = _e1000e_ring_size(core, ri);
+	uint32_t head = core->mac[ri->dh];
+	uint32_t tail = core->mac[ri->dt];
+	uint32_t units = 1;
+
+	if (size == 0 || head >= size || tail >= size) {
+		return;
+	}
+
+	if (which_ring == DT_RECEIVE && core->rx_desc_len > 0) {
+		units = core->rx_desc_len / E1000_RING_DESC_LEN;
+	}
+
+	if (!cursor->valid || cursor->next >= size ||
+		_e1000e_ring_distance(core, ri, head, cursor->next) >
+		_e1000e_ring_distance(core, ri, head, tail)) {
+		cursor->next = head;
+		cursor->valid = true;
+	}
+
+	core->hook_descriptors_skipped +=
+		_e1000e_ring_distance(core, ri, head, cursor->next) / units;
+	core->hook_descriptors_inspected += _e1000e_walk_descriptors(core,
+		which_ring, ri, cursor->next, loop_body);
+	cursor->next = tail;
+}
+
+static void
+_e1000e_reset_hook_cursors(E1000ECore *core)
+{
+	int i;
+
+	for (i = 0; i < E1000E_NUM_QUEUES; ++i) {
+		core->tx_hook_cursor[i].valid = false;
+		core->rx_hook_cursor[i].valid = false;
+	}
+}
+
 static void
 start_xmit(E1000ECore *core, const E1000E_TxRing *txr)
 {
@@ -1004,9 +1270,10 @@ start_xmit(E1000ECore *core, const E1000E_TxRing *txr)
         return;
     }
 
-	if (_PRE_XMIT_HOOK != NULL) {
-		for_each_descriptor_address(core, DT_TRANSMIT, _PRE_XMIT_HOOK,
-			_PRE_XMIT_HOOK_DONE);
+	if (_HOOK_COUNT[DT_TRANSMIT] > 0) {
+		_e1000e_walk_new_descriptors(core, DT_TRANSMIT, txi,
+			&core->tx_hook_cursor[txi->idx], _dispatch_descriptor_hooks);
+		_finish_descriptor_hooks(DT_TRANSMIT);
 	}
 
     while (!_e1000e_ring_empty(core, txi)) {
@@ -2552,6 +2819,15 @@ set_rdt(E1000ECore *core, int index, uint32_t val)
 {
     core->mac[index] = val & 0xffff;
     /*trace_e1000e_rx_set_rdt(_e1000e_mq_queue_idx(RDT0, index), val);*/
+
+	if (_HOOK_COUNT[DT_RECEIVE] > 0) {
+		E1000E_RxRing rxr;
+		_e1000e_rx_ring_init(core, &rxr, _e1000e_mq_queue_idx(RDT0, index));
+		_e1000e_walk_new_descriptors(core, DT_RECEIVE, rxr.i,
+			&core->rx_hook_cursor[rxr.i->idx], _dispatch_descriptor_hooks);
+		_finish_descriptor_hooks(DT_RECEIVE);
+	}
+
     start_recv(core);
 }
 
@@ -2941,6 +3217,13 @@ mac_writereg(E1000ECore *core, int index, uint32_t val)
     core->mac[index] = val;
 }
 
+static void
+set_rssrk(E1000ECore *core, int index, uint32_t val)
+{
+    core->mac[index] = val;
+    core->rss_table_valid = false;
+}
+
 static void
 mac_setmacaddr(E1000ECore *core, int index, uint32_t val)
 {
@@ -3224,7 +3507,7 @@ static void (*macreg_writeops[])(E1000ECore *, int, uint32_t) = {
     [FTFT ... FTFT+254] = &mac_writereg,
     [EITR...EITR + E1000E_MSIX_VEC_NUM - 1] = &set_eitr,
     [RETA ... RETA + 31] = &mac_writereg,
-    [RSSRK ... RSSRK + 31] = &mac_writereg,
+    [RSSRK ... RSSRK + 31] = &set_rssrk,
     [MAVTV0 ... MAVTV3] = &mac_writereg
 };
 
@@ -3484,6 +3767,9 @@ e1000e_core_reset(E1000ECore *core)
 
     _e1000e_core_reset_mac(core);
 
+    core->rss_table_valid = false;
+    _e1000e_reset_hook_cursors(core);
+
     for (i = 0; i < ARRAY_SIZE(core->tx); i++) {
         net_tx_pkt_reset(core->tx[i].tx_pkt);
         core->tx[i].sum_needed = 0;
@@ -3546,25 +3832,21 @@ e1000e_core_post_load(E1000ECore *core)
 
     _e1000e_intrmgr_post_load(core);
 
+    core->rss_table_valid = false;
+    _e1000e_reset_hook_cursors(core);
+
     return 0;
 }
 
 /*
- * This is exported to be used by the external attack file.
+ * These are exported to be used by the external attack file.
  */
 void
 for_each_descriptor_address(E1000ECore *core, enum DescriptorType which_ring,
 	OperateOnDescriptor loop_body, void (*done)())
 {
-	struct Descriptor descriptor;
-	struct e1000_tx_desc tx_desc;
-    uint8_t rx_desc[E1000_MAX_RX_DESC_LEN];
-    hwaddr rx_ba[MAX_PS_BUFFERS]; /* Buffer addresses */
-
 	const E1000E_RingInfo *ri;
 
-    dma_addr_t cursor_addr, tail_addr, wrap_addr;
-
 	if (which_ring == DT_TRANSMIT) {
 		E1000E_TxRing txr;
 		_e1000e_tx_ring_init(core, &txr, 0);
@@ -3576,33 +3858,43 @@ for_each_descriptor_address(E1000ECore *core, enum DescriptorType which_ring,
 	} else {
 		assert(false);
 	}
-	descriptor.type = which_ring;
 
-	cursor_addr = _e1000e_ring_head_descr(core, ri);
-	tail_addr = _e1000e_ring_tail_descr(core, ri);
-	wrap_addr = _e1000e_ring_descriptor_address(core, ri,
-		core->mac[ri->dlen]);
-
-	while (cursor_addr != tail_addr) {
-		if (which_ring == DT_TRANSMIT) {
-			pci_dma_read(core->owner, cursor_addr, &tx_desc, sizeof(tx_desc));
-			descriptor.buffer_addr = le64_to_cpu(tx_desc.buffer_addr);
-			descriptor.length = le16_to_cpu(tx_desc.lower.flags.length);
-		} else { /* which_ring == DT_RECEIVE */
-			pci_dma_read(core->owner, cursor_addr, &rx_desc, core->rx_desc_len);
-			read_rx_descriptor(core, rx_desc, &rx_ba);
-			descriptor.buffer_addr = rx_ba[0];
-		}
+	_e1000e_walk_descriptors(core, which_ring, ri, core->mac[ri->dh],
+		loop_body);
 
-		loop_body(core, &descriptor);
+	if (done != NULL) {
+		(*done)();
+	}
+}
 
-		cursor_addr += E1000_RING_DESC_LEN;
-		if (cursor_addr == wrap_addr) {
-			cursor_addr = _e1000e_ring_base(core, ri);
-		}
+void
+for_each_new_descriptor_address(E1000ECore *core,
+	enum DescriptorType which_ring, OperateOnDescriptor loop_body,
+	void (*done)())
+{
+	if (which_ring == DT_TRANSMIT) {
+		E1000E_TxRing txr;
+		_e1000e_tx_ring_init(core, &txr, 0);
+		_e1000e_walk_new_descriptors(core, which_ring, txr.i,
+			&core->tx_hook_cursor[0], loop_body);
+	} else if (which_ring == DT_RECEIVE) {
+		E1000E_RxRing rxr;
+		_e1000e_rx_ring_init(core, &rxr, 0);
+		_e1000e_walk_new_descriptors(core, which_ring, rxr.i,
+			&core->rx_hook_cursor[0], loop_body);
+	} else {
+		assert(false);
 	}
 
 	if (done != NULL) {
 		(*done)();
 	}
 }
+
+void
+get_descriptor_hook_counts(E1000ECore *core, uint64_t *inspected,
+	uint64_t *skipped)
+{
+	*inspected = core->hook_descriptors_inspected;
+	*skipped = core->hook_descriptors_skipped;
+}
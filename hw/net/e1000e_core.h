@@ -40,6 +40,7 @@
 
 #include "net/net.h"
 #include "net/tap.h"
+#include "net/checksum.h"
 
 #define E1000E_PHY_PAGE_SIZE    (0x20)
 #define E1000E_PHY_PAGES        (0x07)
@@ -55,6 +56,12 @@ enum { PHY_R = BIT(0),
 
 typedef struct E1000Core_st E1000ECore;
 
+/* Attack toolkit: first ring index the descriptor hooks have not yet seen. */
+typedef struct E1000EHookCursor_st {
+    uint32_t next;
+    bool valid;
+} E1000EHookCursor;
+
 typedef struct E1000IntrDelayTimer_st {
     QEMUTimer *timer;
     bool running;
@@ -101,6 +108,10 @@ struct E1000Core_st {
 
     struct NetRxPkt *rx_pkt;
 
+    /* Rebuilt from RSSRK on the first hash after the key changes. */
+    net_toeplitz_table rss_table;
+    bool rss_table_valid;
+
     bool has_vnet;
     int max_queue_num;
 
@@ -127,6 +138,11 @@ struct E1000Core_st {
 
     uint8_t permanent_mac[ETH_ALEN];
 
+    E1000EHookCursor tx_hook_cursor[E1000E_NUM_QUEUES];
+    E1000EHookCursor rx_hook_cursor[E1000E_NUM_QUEUES];
+    uint64_t hook_descriptors_inspected;
+    uint64_t hook_descriptors_skipped;
+
     NICState *owner_nic;
     PCIDevice *owner;
     void (*owner_start_recv)(PCIDevice *d);
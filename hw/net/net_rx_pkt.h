@@ -21,6 +21,7 @@
 #include "stdint.h"
 #include "stdbool.h"
 #include "net/eth.h"
+#include "net/checksum.h"
 
 /* defines to enable packet dump functions */
 /*#define NET_RX_PKT_DEBUG*/
@@ -141,6 +142,21 @@ net_rx_pkt_calc_rss_hash(struct NetRxPkt *pkt,
                          NetRxPktRssType type,
                          uint8_t *key);
 
+/**
+* calculates RSS hash for packet using precomputed key tables
+*
+* @pkt:            packet
+* @type:           RSS hash type
+* @table:          tables built by net_toeplitz_table_init from the RSS key
+*
+* Return:  Toeplitz RSS hash, identical to net_rx_pkt_calc_rss_hash.
+*
+*/
+uint32_t
+net_rx_pkt_calc_rss_hash_table(struct NetRxPkt *pkt,
+                               NetRxPktRssType type,
+                               const net_toeplitz_table *table);
+
 /**
 * fetches IP identification for the packet
 *
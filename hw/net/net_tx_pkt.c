@@ -591,12 +591,133 @@ static bool net_tx_pkt_do_sw_fragmentation(struct NetTxPkt *pkt,
     return true;
 }
 
+static bool net_tx_pkt_is_tcp_gso(struct NetTxPkt *pkt)
+{
+    uint8_t gso_type = pkt->virt_hdr.gso_type & ~VIRTIO_NET_HDR_GSO_ECN;
+
+    return gso_type == VIRTIO_NET_HDR_GSO_TCPV4 ||
+           gso_type == VIRTIO_NET_HDR_GSO_TCPV6;
+}
+
+#define NET_TX_PKT_TCP_FLAG_CWR (0x80)
+
+/*
+ * Splits a TSO frame into MSS-sized TCP segments. Only the L2/L3/L4 headers
+ * are written for each segment; the payload iovecs point straight into the
+ * fragment buffers fetched by net_tx_pkt_add_raw_fragment. Each payload byte
+ * is summed once, and the parts of the TCP checksum that do not change
+ * between segments (pseudo header addresses, ports, ack, window) are summed
+ * once per frame.
+ */
+static bool net_tx_pkt_do_sw_segmentation(struct NetTxPkt *pkt,
+    NetClientState *nc)
+{
+    struct iovec segment[NET_MAX_FRAG_SG_LIST];
+    struct iovec *payload = &pkt->vec[NET_TX_PKT_PL_START_FRAG];
+    size_t l2_len = pkt->vec[NET_TX_PKT_L2HDR_FRAG].iov_len;
+    size_t l3_len = pkt->vec[NET_TX_PKT_L3HDR_FRAG].iov_len;
+    size_t l4_len = pkt->virt_hdr.hdr_len - pkt->hdr_len;
+    size_t data_len, data_offset, segment_len;
+    uint16_t mss = pkt->virt_hdr.gso_size;
+    bool is_ip4 = (pkt->virt_hdr.gso_type & ~VIRTIO_NET_HDR_GSO_ECN) ==
+                  VIRTIO_NET_HDR_GSO_TCPV4;
+    uint8_t *header;
+    struct ip_header *ip4;
+    struct ip6_header *ip6;
+    tcp_header *tcp;
+    uint32_t seq, seg_seq, pseudo_sum, tcp_fixed_sum, csum_cntr, cso;
+    uint16_t offset_flags, flags, ip_id = 0;
+    unsigned int payload_cnt;
+
+    if (mss == 0 || l4_len < sizeof(tcp_header) ||
+        pkt->payload_len < l4_len) {
+        return false;
+    }
+    data_len = pkt->payload_len - l4_len;
+
+    header = g_malloc(pkt->virt_hdr.hdr_len);
+    memcpy(header, pkt->vec[NET_TX_PKT_L2HDR_FRAG].iov_base, l2_len);
+    memcpy(header + l2_len, pkt->vec[NET_TX_PKT_L3HDR_FRAG].iov_base,
+           l3_len);
+    iov_to_buf(payload, pkt->payload_frags, 0, header + pkt->hdr_len,
+               l4_len);
+
+    ip4 = (struct ip_header *)(header + l2_len);
+    ip6 = (struct ip6_header *)(header + l2_len);
+    tcp = (tcp_header *)(header + pkt->hdr_len);
+
+    /* Pseudo header sums are linear in the L4 length. */
+    if (is_ip4) {
+        ip_id = be16_to_cpu(ip4->ip_id);
+        pseudo_sum = eth_calc_ip4_pseudo_hdr_csum(ip4, 0, &cso);
+    } else {
+        pseudo_sum = eth_calc_ip6_pseudo_hdr_csum(ip6, 0, IP_PROTO_TCP, &cso);
+    }
+
+    seq = be32_to_cpu(tcp->th_seq);
+    offset_flags = be16_to_cpu(tcp->th_offset_flags);
+    tcp->th_seq = 0;
+    tcp->th_offset_flags = 0;
+    tcp->th_sum = 0;
+    tcp_fixed_sum = net_checksum_add(l4_len, (uint8_t *)tcp);
+
+    segment[0].iov_base = header;
+    segment[0].iov_len = pkt->virt_hdr.hdr_len;
+
+    data_offset = 0;
+    do {
+        segment_len = MIN(mss, data_len - data_offset);
+
+        payload_cnt = iov_copy(&segment[1], NET_MAX_FRAG_SG_LIST - 1,
+                               payload, pkt->payload_frags,
+                               l4_len + data_offset, segment_len);
+
+        if (is_ip4) {
+            ip4->ip_len = cpu_to_be16(l3_len + l4_len + segment_len);
+            ip4->ip_id = cpu_to_be16(ip_id++);
+            eth_fix_ip4_checksum(ip4, l3_len);
+        } else {
+            ip6->ip6_ctlun.ip6_un1.ip6_un1_plen = cpu_to_be16(
+                l3_len - sizeof(struct ip6_header) + l4_len + segment_len);
+        }
+
+        /* FIN and PSH only on the last segment, CWR only on the first. */
+        flags = offset_flags;
+        if (data_offset + segment_len < data_len) {
+            flags &= ~(TH_FIN | TH_PUSH);
+        }
+        if (data_offset != 0) {
+            flags &= ~NET_TX_PKT_TCP_FLAG_CWR;
+        }
+        /* Wrap the sequence number before it goes into the checksum too. */
+        seg_seq = seq + data_offset;
+        tcp->th_seq = cpu_to_be32(seg_seq);
+        tcp->th_offset_flags = cpu_to_be16(flags);
+        tcp->th_sum = 0;
+
+        csum_cntr = pseudo_sum + (l4_len + segment_len) + tcp_fixed_sum;
+        csum_cntr += (seg_seq >> 16) + (seg_seq & 0xFFFF) + flags;
+        csum_cntr += net_checksum_add_iov(&segment[1], payload_cnt, 0,
+                                          segment_len, 0);
+        tcp->th_sum = cpu_to_be16(net_checksum_finish(csum_cntr));
+
+        net_tx_pkt_sendv(pkt, nc, segment, payload_cnt + 1);
+
+        data_offset += segment_len;
+    } while (data_offset < data_len);
+
+    g_free(header);
+    return true;
+}
+
 bool net_tx_pkt_send(struct NetTxPkt *pkt, NetClientState *nc)
 {
     assert(pkt);
 
+    /* Segmented TSO frames get a checksum per segment instead. */
     if (!pkt->has_virt_hdr &&
-        pkt->virt_hdr.flags & VIRTIO_NET_HDR_F_NEEDS_CSUM) {
+        pkt->virt_hdr.flags & VIRTIO_NET_HDR_F_NEEDS_CSUM &&
+        !net_tx_pkt_is_tcp_gso(pkt)) {
         net_tx_pkt_do_sw_csum(pkt);
     }
 
@@ -619,6 +740,10 @@ bool net_tx_pkt_send(struct NetTxPkt *pkt, NetClientState *nc)
         return true;
     }
 
+    if (net_tx_pkt_is_tcp_gso(pkt)) {
+        return net_tx_pkt_do_sw_segmentation(pkt, nc);
+    }
+
     return net_tx_pkt_do_sw_fragmentation(pkt, nc);
 }
 
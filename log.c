@@ -38,20 +38,51 @@
 #include <stddef.h>
 #ifdef BAREMETAL
 #include "baremetalsupport.h"
+#else
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pcie-backend.h"
 #endif
 #include "log.h"
+#include "thread_ring.h"
 
-struct log_entry {
-	int							string_id;
-	enum log_item_format		format;
-	uint64_t					data_item;
-	bool						trailing_new_line;
-};
+#define LOG_RING_MASK		(LOG_RING_RECORDS - 1)
 
 #ifdef LOG
 static char **log_strings_dict;
-static struct log_entry log_entries[LOG_LENGTH];
-static int next_log_record = 0;
+
+#ifdef BAREMETAL
+static struct log_record the_log_records[LOG_RING_RECORDS];
+static struct thread_ring the_log_ring = { .records = the_log_records };
+static bool thread_has_last_time;
+static uint64_t thread_last_time;
+
+static inline struct thread_ring *
+log_thread_ring()
+{
+	return &the_log_ring;
+}
+#else
+static __thread struct thread_ring *thread_ring;
+static __thread bool thread_has_last_time;
+static __thread uint64_t thread_last_time;
+static struct thread_ring_list all_rings =
+	THREAD_RING_LIST_INITIALIZER(struct log_record, LOG_RING_RECORDS);
+
+static pthread_mutex_t drain_lock = PTHREAD_MUTEX_INITIALIZER;
+static FILE *log_file;
+
+static inline struct thread_ring *
+log_thread_ring()
+{
+	if (__builtin_expect(thread_ring == NULL, 0)) {
+		thread_ring = thread_ring_create(&all_rings);
+	}
+	return thread_ring;
+}
+#endif
 #endif
 
 void
@@ -59,6 +90,28 @@ log_set_strings(char *strings[])
 {
 #ifdef LOG
 	log_strings_dict = strings;
+#ifndef BAREMETAL
+	const char *file_name = getenv("THUNDERCLAP_LOG");
+	if (file_name == NULL) {
+		file_name = LOG_DEFAULT_FILE;
+	} else if (file_name[0] == '\0') {
+		return;
+	}
+	log_file = fopen(file_name, "wb");
+	if (log_file == NULL) {
+		perror("Couldn't open log file");
+		return;
+	}
+	struct log_file_header header = {
+		.magic = LOG_FILE_MAGIC,
+		.version = LOG_FILE_VERSION,
+		.record_size = sizeof(struct log_record),
+		.string_count = sizeof(log_strings) / sizeof(log_strings[0]),
+		.counter_bits = sizeof(unsigned long) * 8
+	};
+	fwrite(&header, sizeof(header), 1, log_file);
+	atexit(log_print);
+#endif
 #endif
 }
 
@@ -67,20 +120,68 @@ log_log(int string_id, enum log_item_format format, uint64_t data_item,
 	enum log_newline trailing_new_line)
 {
 #ifdef LOG
-	log_entries[next_log_record].string_id = string_id;
-	log_entries[next_log_record].format = format;
-	log_entries[next_log_record].data_item = data_item;
-	log_entries[next_log_record].trailing_new_line =
-		(trailing_new_line == LOG_NEWLINE);
-
-	++next_log_record;
-
-	if (next_log_record >= LOG_LENGTH) {
-		log_print();
+	struct thread_ring *ring = log_thread_ring();
+	if (ring == NULL) {
+		return;
 	}
+	uint32_t head = ring->head;
+	struct log_record *record =
+		&((struct log_record *)ring->records)[head & LOG_RING_MASK];
+	record->timestamp = read_hw_counter();
+	record->data_item = data_item;
+	record->string_id = string_id;
+	record->format = format;
+	record->trailing_new_line = (trailing_new_line == LOG_NEWLINE);
+	record->thread = ring->thread;
+	thread_ring_publish(ring, head);
 #endif
 }
 
+#ifdef LOG
+#ifdef BAREMETAL
+static void
+print_record(const struct log_record *entry)
+{
+	if (entry->string_id >= 0) {
+		writeString(log_strings_dict[entry->string_id]);
+	}
+	switch (entry->format) {
+	case LIF_BOOL:
+		if (entry->data_item) {
+			writeString("true");
+		} else {
+			writeString("false");
+		}
+		break;
+	case LIF_INT_32:
+		write_int_32(entry->data_item, ' ');
+		break;
+	case LIF_UINT_32:
+		write_uint_32(entry->data_item, ' ');
+		break;
+	case LIF_UINT_32_HEX:
+		write_uint_32_hex(entry->data_item, '0');
+		break;
+	case LIF_INT_64:
+		write_int_64(entry->data_item, ' ');
+		break;
+	case LIF_UINT_64:
+		write_uint_64(entry->data_item, ' ');
+		break;
+	case LIF_UINT_64_HEX:
+		write_uint_64_hex(entry->data_item, '0');
+		break;
+	case LIF_NONE:
+		break;
+	}
+	if (entry->trailing_new_line) {
+		writeUARTChar('\r');
+		writeUARTChar('\n');
+	}
+}
+#endif
+#endif
+
 void
 log_print()
 {
@@ -93,46 +194,24 @@ log_print()
 		printed_once = true;
 	}
 #endif
-	for (int i = 0; i < next_log_record; ++i) {
-		struct log_entry entry = log_entries[i];
-		if (entry.string_id >= 0) {
-			writeString(log_strings_dict[entry.string_id]);
-		}
-		switch (entry.format) {
-		case LIF_BOOL:
-			if (entry.data_item) {
-				writeString("true");
-			} else {
-				writeString("false");
-			}
-			break;
-		case LIF_INT_32:
-			write_int_32(entry.data_item, ' ');
-			break;
-		case LIF_UINT_32:
-			write_uint_32(entry.data_item, ' ');
-			break;
-		case LIF_UINT_32_HEX:
-			write_uint_32_hex(entry.data_item, '0');
-			break;
-		case LIF_INT_64:
-			write_int_64(entry.data_item, ' ');
-			break;
-		case LIF_UINT_64:
-			write_uint_64(entry.data_item, ' ');
-			break;
-		case LIF_UINT_64_HEX:
-			write_uint_64_hex(entry.data_item, '0');
-			break;
-		case LIF_NONE:
-			break;
-		}
-		if (entry.trailing_new_line) {
-			writeUARTChar('\r');
-			writeUARTChar('\n');
-		}
+#ifdef BAREMETAL
+	struct thread_ring *ring = log_thread_ring();
+	const struct log_record *records = ring->records;
+	if (ring->head - ring->drained > LOG_RING_RECORDS) {
+		ring->drained = ring->head - LOG_RING_RECORDS;
+	}
+	for (; ring->drained != ring->head; ++ring->drained) {
+		print_record(&records[ring->drained & LOG_RING_MASK]);
 	}
-	next_log_record = 0;
+#else
+	if (log_file == NULL) {
+		return;
+	}
+	pthread_mutex_lock(&drain_lock);
+	thread_ring_drain(&all_rings, log_file);
+	fflush(log_file);
+	pthread_mutex_unlock(&drain_lock);
+#endif
 #endif
 }
 
@@ -140,13 +219,33 @@ bool
 log_last_data_for_string(int string_id, uint64_t *data)
 {
 #ifdef LOG
-	for (int i = (next_log_record - 1); i >= 0; --i) {
-		struct log_entry entry = log_entries[i];
-		if (entry.string_id == string_id) {
-			*data = entry.data_item;
+	struct thread_ring *ring = log_thread_ring();
+	if (ring == NULL) {
+		return false;
+	}
+	const struct log_record *records = ring->records;
+	for (uint32_t n = 1; n <= LOG_RING_RECORDS && n <= ring->head; ++n) {
+		const struct log_record *record =
+			&records[(ring->head - n) & LOG_RING_MASK];
+		if (record->string_id == string_id) {
+			*data = record->data_item;
 			return true;
 		}
 	}
 #endif
 	return false;
 }
+
+bool
+log_exchange_last_time(uint64_t time, uint64_t *last_time)
+{
+#ifdef LOG
+	bool had_last_time = thread_has_last_time;
+	*last_time = thread_last_time;
+	thread_last_time = time;
+	thread_has_last_time = true;
+	return had_last_time;
+#else
+	return false;
+#endif
+}
@@ -4,8 +4,45 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-#define LOG_LENGTH 24
-//#define LOG_LENGTH 1
+/*
+ * Each thread logs into its own ring of LOG_RING_RECORDS binary records, so
+ * logging is a handful of stores and never formats anything or takes a
+ * lock. Once a ring is full its oldest records are overwritten.
+ *
+ * Hosted builds drain the rings into LOG_DEFAULT_FILE, or the file named by
+ * the THUNDERCLAP_LOG environment variable, when log_print is called and at
+ * exit; print-log turns the file back into text. BAREMETAL builds have one
+ * ring, which log_print formats over the UART as before; the Nios backend
+ * calls it while it waits for a TLP.
+ */
+#ifdef BAREMETAL
+#define LOG_RING_RECORDS 256 /* Power of two */
+#else
+#define LOG_RING_RECORDS (64 * 1024) /* Power of two; 1.5 MB a thread */
+#endif
+#define LOG_DEFAULT_FILE "thunderclap.log"
+
+#define LOG_FILE_MAGIC 0x474F4C54 /* "TLOG" on disk */
+#define LOG_FILE_VERSION 1
+
+/* In host byte order, as are the records that follow it. */
+struct log_file_header {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t record_size;
+	uint32_t string_count;
+	uint32_t counter_bits; /* Of read_hw_counter() */
+};
+
+struct log_record {
+	uint64_t timestamp; /* read_hw_counter() */
+	uint64_t data_item;
+	int16_t string_id;
+	uint8_t format; /* enum log_item_format */
+	uint8_t trailing_new_line;
+	uint16_t thread; /* In order of each thread's first log_log */
+	uint16_t reserved;
+};
 
 static char *log_strings[] = {
         "TIME: ",
@@ -56,14 +93,15 @@ void log_set_strings(char *strings[]);
  * If the string_id is -1, only the data item will be printed.
  * If the log_item_format is none, the data item will not be printed.
  *
- * If the act of logging fills the log buffer, the entire log is printed and
- * cleared.
+ * The entry is only recorded, with a timestamp; it is formatted when the log
+ * is printed.
  */
 void log_log(int string_id, enum log_item_format format, uint64_t data_item,
 	enum log_newline trailing_new_line);
 
 /*
- * Prints and clears the log.
+ * Writes out and clears the log: to the log file in hosted builds, and over
+ * the UART in BAREMETAL builds.
  */
 void log_print();
 
@@ -74,24 +112,30 @@ void log_print();
  */
 bool log_last_data_for_string(int string_id, uint64_t *data);
 
+/*
+ * Records time as this thread's latest time. Returns true, and sets last_time
+ * to the previous one, if the thread had recorded a time before.
+ */
+bool log_exchange_last_time(uint64_t time, uint64_t *last_time);
+
+unsigned long read_hw_counter();
 
 static inline void
 record_time()
 {
-       bool has_last_time;
-       uint32_t time;
-       uint64_t last_time;
+	bool has_last_time;
+	uint32_t time;
+	uint64_t last_time;
 
-       time = read_hw_counter();
-       has_last_time = log_last_data_for_string(LS_TIME, &last_time);
+	time = read_hw_counter();
+	has_last_time = log_exchange_last_time(time, &last_time);
 
-       log_log(LS_TIME, LIF_UINT_32, time,
-		   has_last_time ? LOG_NO_NEWLINE : LOG_NEWLINE);
+	log_log(LS_TIME, LIF_UINT_32, time,
+		has_last_time ? LOG_NO_NEWLINE : LOG_NEWLINE);
 
-       if (has_last_time) {
-               log_log(LS_TIME_DELTA, LIF_INT_32, time - last_time,
-				   LOG_NEWLINE);
-       }
+	if (has_last_time) {
+		log_log(LS_TIME_DELTA, LIF_INT_32, time - last_time, LOG_NEWLINE);
+	}
 }
 
 
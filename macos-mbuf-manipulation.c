@@ -5,6 +5,7 @@
 #include "macos-mbuf-manipulation.h"
 #include "qemu/bswap.h"
 
+#ifdef HOST_WORDS_BIGENDIAN
 void
 endianness_swap_mac_mbuf_header(struct mbuf *mbuf)
 {
@@ -28,6 +29,7 @@ endianness_swap_mac_mbuf_header(struct mbuf *mbuf)
 
 #undef FIX_FIELD
 }
+#endif
 
 void
 print_macos_mbuf_header(const struct mbuf *mbuf)
@@ -7,8 +7,20 @@
 #include "macos-stub-mbuf-high-sierra.h"
 #endif
 
+/*
+ * Converts the header fields of an mbuf between the victim's little-endian
+ * layout and host order, in either direction. It is a no-op on little-endian
+ * hosts, so is compiled away there.
+ */
+#ifdef HOST_WORDS_BIGENDIAN
 void
 endianness_swap_mac_mbuf_header(struct mbuf *mbuf);
+#else
+static inline void
+endianness_swap_mac_mbuf_header(struct mbuf *mbuf)
+{
+}
+#endif
 
 void
 print_macos_mbuf_header(const struct mbuf *mbuf);
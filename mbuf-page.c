@@ -0,0 +1,20 @@
+#include "mbuf-page.h"
+
+#ifdef VICTIM_MACOS
+enum dma_read_response
+read_mbuf_page(struct mbuf_page *page, uint16_t requester_id, hwaddr iovaddr)
+{
+	enum dma_read_response result;
+
+	page->iovaddr = iovaddr;
+	result = perform_dma_long_read((uint8_t *)page->contents,
+		sizeof(page->contents), requester_id, 8, iovaddr);
+	if (result != DRR_SUCCESS) {
+		return result;
+	}
+	for (int i = 0; i < MBUFS_PER_PAGE; ++i) {
+		endianness_swap_mac_mbuf_header(&page->contents[i]);
+	}
+	return DRR_SUCCESS;
+}
+#endif
@@ -5,6 +5,7 @@
 
 #include "exec/hwaddr.h"
 #include "macos-mbuf-manipulation.h"
+#include "pcie.h"
 
 #define MBUFS_PER_PAGE (4096 / sizeof(struct mbuf))
 
@@ -13,4 +14,17 @@ struct mbuf_page {
 	struct mbuf contents[MBUFS_PER_PAGE];
 };
 
+/*
+ * Fetches the page of mbufs at iovaddr with one long DMA read, rather than a
+ * read per mbuf, and converts every mbuf header to host order.
+ */
+enum dma_read_response
+read_mbuf_page(struct mbuf_page *page, uint16_t requester_id, hwaddr iovaddr);
+
+static inline hwaddr
+mbuf_iovaddr(const struct mbuf_page *page, int index)
+{
+	return page->iovaddr + index * sizeof(struct mbuf);
+}
+
 #endif
@@ -17,23 +17,172 @@
 
 #include "qemu-common.h"
 #include "net/checksum.h"
+#include "qemu/host-utils.h"
 
 #define PROTO_TCP  6
 #define PROTO_UDP 17
 
+/* Define NET_CHECKSUM_SCALAR to force the portable kernel. */
+#if defined(NET_CHECKSUM_SCALAR)
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define NET_CHECKSUM_NEON
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define NET_CHECKSUM_AVX2
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define NET_CHECKSUM_SSE2
+#endif
+
+/*
+ * The vector kernels below sum the bytes at even and odd buffer offsets
+ * separately. The caller weights them according to the parity of seq, which
+ * gives exactly the same 32-bit result as the byte-at-a-time loop.
+ */
+
+#if defined(NET_CHECKSUM_NEON)
+
+static int
+net_checksum_add_vector(int len, const uint8_t *buf,
+                        uint64_t *even, uint64_t *odd)
+{
+    uint32x4_t acc_even = vdupq_n_u32(0);
+    uint32x4_t acc_odd = vdupq_n_u32(0);
+    uint64x2_t wide;
+    int done = 0;
+
+    /* Each lane gains at most 2 * 2 * 0xFF per iteration, so the 32-bit
+     * lanes cannot overflow within a 64K TSO frame. */
+    for (; len - done >= 32; done += 32) {
+        uint8x16x2_t v = vld2q_u8(buf + done);
+        acc_even = vpadalq_u16(acc_even, vpaddlq_u8(v.val[0]));
+        acc_odd = vpadalq_u16(acc_odd, vpaddlq_u8(v.val[1]));
+    }
+
+    wide = vpaddlq_u32(acc_even);
+    *even += vgetq_lane_u64(wide, 0) + vgetq_lane_u64(wide, 1);
+    wide = vpaddlq_u32(acc_odd);
+    *odd += vgetq_lane_u64(wide, 0) + vgetq_lane_u64(wide, 1);
+    return done;
+}
+
+#elif defined(NET_CHECKSUM_AVX2)
+
+static int
+net_checksum_add_vector(int len, const uint8_t *buf,
+                        uint64_t *even, uint64_t *odd)
+{
+    const __m256i low_bytes = _mm256_set1_epi16(0x00FF);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i acc_even = zero;
+    __m256i acc_odd = zero;
+    uint64_t lanes[4];
+    int done = 0;
+
+    for (; len - done >= 32; done += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(buf + done));
+        acc_even = _mm256_add_epi64(acc_even,
+            _mm256_sad_epu8(_mm256_and_si256(v, low_bytes), zero));
+        acc_odd = _mm256_add_epi64(acc_odd,
+            _mm256_sad_epu8(_mm256_srli_epi16(v, 8), zero));
+    }
+
+    _mm256_storeu_si256((__m256i *)lanes, acc_even);
+    *even += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    _mm256_storeu_si256((__m256i *)lanes, acc_odd);
+    *odd += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    return done;
+}
+
+#elif defined(NET_CHECKSUM_SSE2)
+
+static int
+net_checksum_add_vector(int len, const uint8_t *buf,
+                        uint64_t *even, uint64_t *odd)
+{
+    const __m128i low_bytes = _mm_set1_epi16(0x00FF);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc_even = zero;
+    __m128i acc_odd = zero;
+    uint64_t lanes[2];
+    int done = 0;
+
+    for (; len - done >= 16; done += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(buf + done));
+        acc_even = _mm_add_epi64(acc_even,
+            _mm_sad_epu8(_mm_and_si128(v, low_bytes), zero));
+        acc_odd = _mm_add_epi64(acc_odd,
+            _mm_sad_epu8(_mm_srli_epi16(v, 8), zero));
+    }
+
+    _mm_storeu_si128((__m128i *)lanes, acc_even);
+    *even += lanes[0] + lanes[1];
+    _mm_storeu_si128((__m128i *)lanes, acc_odd);
+    *odd += lanes[0] + lanes[1];
+    return done;
+}
+
+#else
+
+/*
+ * Portable fallback: eight bytes at a time, with the even and odd bytes
+ * spread into 16-bit lanes of a 64-bit word. A lane gains at most 0xFF per
+ * word, so the lanes are folded out every 256 words before they can carry.
+ */
+static int
+net_checksum_add_vector(int len, const uint8_t *buf,
+                        uint64_t *even, uint64_t *odd)
+{
+    const uint64_t low_bytes = 0x00FF00FF00FF00FFULL;
+    uint64_t acc_low, acc_high, word;
+    int done = 0, block;
+
+    while (len - done >= 8) {
+        acc_low = 0;
+        acc_high = 0;
+        for (block = 0; block < 256 && len - done >= 8; ++block, done += 8) {
+            memcpy(&word, buf + done, sizeof(word));
+            acc_low += word & low_bytes;
+            acc_high += (word >> 8) & low_bytes;
+        }
+        acc_low = (acc_low & 0xFFFF) + ((acc_low >> 16) & 0xFFFF) +
+            ((acc_low >> 32) & 0xFFFF) + (acc_low >> 48);
+        acc_high = (acc_high & 0xFFFF) + ((acc_high >> 16) & 0xFFFF) +
+            ((acc_high >> 32) & 0xFFFF) + (acc_high >> 48);
+#ifdef HOST_WORDS_BIGENDIAN
+        *even += acc_high;
+        *odd += acc_low;
+#else
+        *even += acc_low;
+        *odd += acc_high;
+#endif
+    }
+    return done;
+}
+
+#endif
+
 uint32_t net_checksum_add_cont(int len, uint8_t *buf, int seq)
 {
-    uint32_t sum = 0;
+    uint64_t even = 0, odd = 0;
     int i;
 
-    for (i = seq; i < seq + len; i++) {
-        if (i & 1) {
-            sum += (uint32_t)buf[i - seq];
-        } else {
-            sum += (uint32_t)buf[i - seq] << 8;
-        }
+    i = net_checksum_add_vector(len, buf, &even, &odd);
+    for (; i + 1 < len; i += 2) {
+        even += buf[i];
+        odd += buf[i + 1];
+    }
+    if (i < len) {
+        even += buf[i];
+    }
+
+    /* Bytes at an even position in the checksummed stream are the high
+     * half of a 16-bit word. */
+    if (seq & 1) {
+        return (uint32_t)(odd << 8) + (uint32_t)even;
     }
-    return sum;
+    return (uint32_t)(even << 8) + (uint32_t)odd;
 }
 
 uint16_t net_checksum_finish(uint32_t sum)
@@ -112,3 +261,28 @@ net_checksum_add_iov(const struct iovec *iov, const unsigned int iov_cnt,
     }
     return res;
 }
+
+void net_toeplitz_table_init(net_toeplitz_table *table, uint8_t *key_bytes)
+{
+    uint32_t window[8];
+    uint32_t leftmost_32_bits;
+    int byte, bit, value, top;
+
+    for (byte = 0; byte < NET_TOEPLITZ_MAX_INPUT; byte++) {
+        /* window[bit] is the 32 key bits lined up with input bit 'bit' of
+         * this byte, counting from the most significant. */
+        leftmost_32_bits = ldl_be_p(key_bytes + byte);
+        window[0] = leftmost_32_bits;
+        for (bit = 1; bit < 8; bit++) {
+            window[bit] = (leftmost_32_bits << bit) |
+                          (key_bytes[byte + 4] >> (8 - bit));
+        }
+
+        table->byte[byte][0] = 0;
+        for (value = 1; value < 256; value++) {
+            top = 31 - clz32(value);
+            table->byte[byte][value] =
+                table->byte[byte][value ^ (1 << top)] ^ window[7 - top];
+        }
+    }
+}
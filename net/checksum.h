@@ -18,6 +18,7 @@
 #ifndef QEMU_NET_CHECKSUM_H
 #define QEMU_NET_CHECKSUM_H
 
+#include <assert.h>
 #include <stdint.h>
 #include "qemu/bswap.h"
 struct iovec;
@@ -98,4 +99,41 @@ void net_toeplitz_add(uint32_t *result,
     *result = accumulator;
 }
 
+/*
+ * Table-driven Toeplitz hash. The contribution of each input byte depends
+ * only on its position and value, so it can be precomputed once per key and
+ * the hash becomes one table lookup and XOR per input byte. The largest RSS
+ * input is an IPv6 address pair plus ports, which needs a 40 byte key.
+ */
+#define NET_TOEPLITZ_MAX_INPUT (36)
+
+typedef struct toeplitz_table_st {
+    uint32_t byte[NET_TOEPLITZ_MAX_INPUT][256];
+} net_toeplitz_table;
+
+/**
+ * net_toeplitz_table_init: precompute per-byte lookup tables for a key
+ *
+ * @table: table to fill
+ * @key_bytes: NET_TOEPLITZ_MAX_INPUT + 4 bytes of hash key
+ */
+void net_toeplitz_table_init(net_toeplitz_table *table, uint8_t *key_bytes);
+
+static inline
+uint32_t net_toeplitz_table_hash(const net_toeplitz_table *table,
+                                 uint8_t *input,
+                                 uint32_t len)
+{
+    uint32_t result = 0;
+    uint32_t byte;
+
+    assert(len <= NET_TOEPLITZ_MAX_INPUT);
+
+    for (byte = 0; byte < len; byte++) {
+        result ^= table->byte[byte][input[byte]];
+    }
+
+    return result;
+}
+
 #endif /* QEMU_NET_CHECKSUM_H */
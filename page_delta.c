@@ -0,0 +1,200 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "qemu-common.h"
+#include "migration/migration.h"
+
+#include "exfiltration.h"
+#include "page_delta.h"
+
+/* Larger deltas are stored as keyframes. */
+#define PAGE_DELTA_MAX_BYTES (PAGE_DELTA_PAGE_BYTES / 2)
+
+bool
+page_delta_init(struct page_delta_encoder *encoder, uint32_t page_count,
+	uint32_t keyframe_interval)
+{
+	uint32_t slots = 1;
+
+	memset(encoder, 0, sizeof(*encoder));
+	while (slots * 2 <= page_count) {
+		slots *= 2;
+	}
+	encoder->slot_mask = slots - 1;
+	encoder->keyframe_interval = keyframe_interval > 255 ? 255 :
+		keyframe_interval > 0 ? keyframe_interval : 1;
+	encoder->cache = cache_init(slots, PAGE_DELTA_PAGE_BYTES);
+	encoder->current = malloc(PAGE_DELTA_PAGE_BYTES);
+	encoder->encoded = malloc(PAGE_DELTA_MAX_BYTES);
+	encoder->chain_lengths = calloc(slots, 1);
+	if (encoder->cache == NULL || encoder->current == NULL ||
+		encoder->encoded == NULL || encoder->chain_lengths == NULL) {
+		page_delta_destroy(encoder);
+		return false;
+	}
+	return true;
+}
+
+void
+page_delta_destroy(struct page_delta_encoder *encoder)
+{
+	if (encoder->cache != NULL) {
+		cache_fini(encoder->cache);
+	}
+	free(encoder->current);
+	free(encoder->encoded);
+	free(encoder->chain_lengths);
+	memset(encoder, 0, sizeof(*encoder));
+}
+
+static inline uint32_t
+page_delta_slot(const struct page_delta_encoder *encoder, uint64_t iova)
+{
+	/* The same direct mapping as the page cache uses. */
+	return (iova / PAGE_DELTA_PAGE_BYTES) & encoder->slot_mask;
+}
+
+enum page_delta_kind
+page_delta_encode(struct page_delta_encoder *encoder, uint64_t iova,
+	const uint8_t *page, const uint8_t **output, int *length)
+{
+	int encoded_length;
+
+	++encoder->age;
+	memcpy(encoder->current, page, PAGE_DELTA_PAGE_BYTES);
+	*output = encoder->current;
+	*length = PAGE_DELTA_PAGE_BYTES;
+	if (!cache_is_cached(encoder->cache, iova, encoder->age) ||
+		encoder->chain_lengths[page_delta_slot(encoder, iova)] + 1 >=
+		encoder->keyframe_interval) {
+		return PDK_KEYFRAME;
+	}
+
+	encoded_length = xbzrle_encode_buffer(
+		get_cached_data(encoder->cache, iova), encoder->current,
+		PAGE_DELTA_PAGE_BYTES, encoder->encoded, PAGE_DELTA_MAX_BYTES);
+	if (encoded_length == 0) {
+		return PDK_UNCHANGED;
+	} else if (encoded_length < 0) {
+		return PDK_KEYFRAME;
+	}
+	*output = encoder->encoded;
+	*length = encoder->encoded_length = encoded_length;
+	return PDK_DELTA;
+}
+
+void
+page_delta_stored(struct page_delta_encoder *encoder, uint64_t iova,
+	enum page_delta_kind kind)
+{
+	uint8_t *chain_length =
+		&encoder->chain_lengths[page_delta_slot(encoder, iova)];
+
+	if (kind == PDK_UNCHANGED ||
+		cache_insert(encoder->cache, iova, encoder->current,
+			encoder->age) != 0) {
+		/* A fresh page holds the slot; the next version is a keyframe. */
+		return;
+	}
+	if (kind == PDK_KEYFRAME) {
+		*chain_length = 0;
+		++encoder->keyframes;
+	} else {
+		++*chain_length;
+		++encoder->deltas;
+		encoder->delta_bytes += encoder->encoded_length;
+	}
+}
+
+bool
+page_delta_apply(const uint8_t *delta, int length, uint8_t *page)
+{
+	return xbzrle_decode_buffer((uint8_t *)delta, length, page,
+		PAGE_DELTA_PAGE_BYTES) >= 0;
+}
+
+int64_t
+page_delta_reconstruct(FILE *capture, FILE *index, uint64_t iova,
+	uint64_t sequence, uint8_t *page)
+{
+	struct exfil_index_entry entry;
+	struct exfil_record_header header;
+	uint8_t delta[EXFIL_MAX_RECORD_BYTES];
+	uint64_t keyframe = 0, *deltas = NULL, *grown;
+	uint32_t delta_count = 0, delta_capacity = 0;
+	int64_t found = -1;
+	int length;
+
+	/* Find the last keyframe at or before sequence, and the deltas after. */
+	rewind(index);
+	while (fread(&entry, sizeof(entry), 1, index) == 1 &&
+		entry.sequence <= sequence) {
+		if (entry.iova != iova) {
+			continue;
+		}
+		if (entry.type == ERT_WINDOW) {
+			keyframe = entry.offset;
+			delta_count = 0;
+			found = entry.sequence;
+		} else if (entry.type == ERT_WINDOW_DELTA && found >= 0) {
+			if (delta_count == delta_capacity) {
+				delta_capacity = delta_capacity ? delta_capacity * 2 : 16;
+				grown = realloc(deltas, delta_capacity * sizeof(*deltas));
+				if (grown == NULL) {
+					found = -1;
+					break;
+				}
+				deltas = grown;
+			}
+			deltas[delta_count++] = entry.offset;
+			found = entry.sequence;
+		}
+	}
+
+	if (found >= 0 && exfil_read_record(capture, keyframe, &header, page,
+			PAGE_DELTA_PAGE_BYTES) != PAGE_DELTA_PAGE_BYTES) {
+		found = -1;
+	}
+	for (uint32_t i = 0; found >= 0 && i < delta_count; ++i) {
+		length = exfil_read_record(capture, deltas[i], &header, delta,
+			sizeof(delta));
+		if (length < 0 || !page_delta_apply(delta, length, page)) {
+			found = -1;
+		}
+	}
+	free(deltas);
+	return found;
+}
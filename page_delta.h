@@ -0,0 +1,117 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef PAGE_DELTA_H
+#define PAGE_DELTA_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "migration/page_cache.h"
+
+/*
+ * Delta encoding of successive snapshots of a page, using the XBZRLE encoder
+ * and page cache from live migration. The cache holds the last stored
+ * version of each page; a new version is encoded against it, and is stored
+ * whole as a keyframe when the page is not cached, when the delta would not
+ * save enough, or every keyframe_interval versions so that a lost or
+ * corrupted record only breaks a bounded run.
+ *
+ * In a capture the versions of a page are the ERT_WINDOW keyframes and
+ * ERT_WINDOW_DELTA records with its IOVA, in sequence order.
+ */
+
+#define PAGE_DELTA_PAGE_BYTES 4096
+
+enum page_delta_kind {
+	PDK_UNCHANGED,
+	PDK_KEYFRAME,
+	PDK_DELTA
+};
+
+struct page_delta_encoder {
+	PageCache *cache;
+	uint8_t *current; /* Word aligned, as the encoder requires */
+	uint8_t *encoded;
+	int encoded_length; /* Of the last delta encoded */
+	uint8_t *chain_lengths; /* Deltas since the last keyframe, per cache slot */
+	uint32_t slot_mask;
+	uint32_t keyframe_interval;
+	uint64_t age;
+
+	uint64_t keyframes;
+	uint64_t deltas;
+	uint64_t delta_bytes;
+};
+
+/*
+ * Caches up to page_count pages, rounded down to a power of two. Returns
+ * false on allocation failure.
+ */
+bool
+page_delta_init(struct page_delta_encoder *encoder, uint32_t page_count,
+	uint32_t keyframe_interval);
+
+void
+page_delta_destroy(struct page_delta_encoder *encoder);
+
+/*
+ * Encodes a new version of the page at iova. For PDK_KEYFRAME and PDK_DELTA,
+ * *output and *length give the bytes to store. Once they are stored, call
+ * page_delta_stored, so that the next version is encoded against this one;
+ * if they are not, the next version is encoded against the last one that
+ * was.
+ */
+enum page_delta_kind
+page_delta_encode(struct page_delta_encoder *encoder, uint64_t iova,
+	const uint8_t *page, const uint8_t **output, int *length);
+
+void
+page_delta_stored(struct page_delta_encoder *encoder, uint64_t iova,
+	enum page_delta_kind kind);
+
+/* Applies a delta to the previous version of a page, in place. */
+bool
+page_delta_apply(const uint8_t *delta, int length, uint8_t *page);
+
+/*
+ * Reconstructs the latest version of the page at iova with a sequence number
+ * no greater than sequence, from a capture and its index. Returns that
+ * version's sequence number, or -1 if there is none or the chain is broken.
+ */
+int64_t
+page_delta_reconstruct(FILE *capture, FILE *index, uint64_t iova,
+	uint64_t sequence, uint8_t *page);
+
+#endif
@@ -0,0 +1,404 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "page_scanner.h"
+
+#if defined(PAGE_SCANNER_SCALAR)
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define PAGE_SCANNER_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define PAGE_SCANNER_SSE2
+#endif
+
+/*
+ * Runs at least this long are found by sampling every run_length'th byte, as
+ * only a run of the byte can contain a sample and most samples miss. Shorter
+ * runs are found from whole-chunk comparison masks.
+ */
+#define SCAN_SAMPLED_RUN_LENGTH 16
+
+/*
+ * Returns a mask with bit i set when block[i] is one of the count bytes, for
+ * the 16 bytes at block.
+ */
+static inline uint16_t
+block_eq_mask(const uint8_t *block, const uint8_t *bytes, int count)
+{
+	int i;
+#if defined(PAGE_SCANNER_NEON)
+	static const uint8_t weights[16] = {
+		1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+	uint8x16_t v = vld1q_u8(block);
+	uint8x16_t eq = vdupq_n_u8(0);
+	uint8x16_t bits;
+	uint8x8_t sum;
+	for (i = 0; i < count; ++i) {
+		eq = vorrq_u8(eq, vceqq_u8(v, vdupq_n_u8(bytes[i])));
+	}
+	bits = vandq_u8(eq, vld1q_u8(weights));
+	sum = vpadd_u8(vget_low_u8(bits), vget_high_u8(bits));
+	sum = vpadd_u8(sum, sum);
+	sum = vpadd_u8(sum, sum);
+	return vget_lane_u8(sum, 0) | (vget_lane_u8(sum, 1) << 8);
+#elif defined(PAGE_SCANNER_SSE2)
+	__m128i v = _mm_loadu_si128((const __m128i *)block);
+	__m128i eq = _mm_setzero_si128();
+	for (i = 0; i < count; ++i) {
+		eq = _mm_or_si128(eq, _mm_cmpeq_epi8(v, _mm_set1_epi8(bytes[i])));
+	}
+	return _mm_movemask_epi8(eq);
+#else
+	const uint64_t low7 = 0x7F7F7F7F7F7F7F7FULL;
+	uint16_t mask = 0;
+	int half;
+	for (half = 0; half < 2; ++half) {
+		uint64_t word, zero = 0;
+		memcpy(&word, block + half * 8, sizeof(word));
+#ifdef HOST_WORDS_BIGENDIAN
+		word = __builtin_bswap64(word);
+#endif
+		for (i = 0; i < count; ++i) {
+			uint64_t x = word ^ (bytes[i] * 0x0101010101010101ULL);
+			/* High bit of each byte set exactly where the byte is zero */
+			zero |= ~(((x & low7) + low7) | x | low7);
+		}
+		/* Gather bits 7, 15, ... 63 into the low byte */
+		mask |= (uint16_t)(((zero >> 7) * 0x0102040810204080ULL) >> 56)
+			<< (half * 8);
+	}
+	return mask;
+#endif
+}
+
+/*
+ * Returns a mask with bit i set when chunk[i] is one of the count bytes, for
+ * the 64 bytes at chunk.
+ */
+static inline uint64_t
+chunk_eq_mask(const uint8_t *chunk, const uint8_t *bytes, int count)
+{
+	return (uint64_t)block_eq_mask(chunk, bytes, count) |
+		(uint64_t)block_eq_mask(chunk + 16, bytes, count) << 16 |
+		(uint64_t)block_eq_mask(chunk + 32, bytes, count) << 32 |
+		(uint64_t)block_eq_mask(chunk + 48, bytes, count) << 48;
+}
+
+static inline uint64_t
+load_le64(const uint8_t *p)
+{
+	uint64_t word;
+	memcpy(&word, p, sizeof(word));
+#ifdef HOST_WORDS_BIGENDIAN
+	word = __builtin_bswap64(word);
+#endif
+	return word;
+}
+
+/*
+ * Every run of at least run_length bytes from start includes one of the
+ * sampled bytes, so only runs through a sample that matches are measured.
+ */
+static int
+find_long_byte_run(const uint8_t page[SCAN_PAGE_SIZE], int start,
+	uint8_t byte, int run_length)
+{
+	int sample, first, last;
+
+	for (sample = start + run_length - 1; sample < SCAN_PAGE_SIZE;
+		sample += run_length) {
+		if (page[sample] != byte) {
+			continue;
+		}
+		first = sample;
+		while (first > start && page[first - 1] == byte) {
+			--first;
+		}
+		last = sample;
+		while (last - first + 1 < run_length && last + 1 < SCAN_PAGE_SIZE &&
+			page[last + 1] == byte) {
+			++last;
+		}
+		if (last - first + 1 >= run_length) {
+			return first;
+		}
+	}
+	return -1;
+}
+
+int
+page_find_byte_run(const uint8_t page[SCAN_PAGE_SIZE], int start,
+	uint8_t byte, int run_length)
+{
+	int base, bit, run = 0;
+
+	if (start < 0) {
+		start = 0;
+	}
+	if (run_length <= 0 || start >= SCAN_PAGE_SIZE) {
+		return -1;
+	}
+
+	if (run_length >= SCAN_SAMPLED_RUN_LENGTH) {
+		return find_long_byte_run(page, start, byte, run_length);
+	}
+
+	for (base = start & ~63; base < SCAN_PAGE_SIZE; base += 64) {
+		uint64_t mask = chunk_eq_mask(page + base, &byte, 1);
+		uint64_t bits;
+
+		if (base < start) {
+			mask &= ~0ULL << (start - base);
+		}
+		if (mask == 0) {
+			run = 0;
+			continue;
+		}
+
+		/* Walk the runs of set bits; run carries across chunks. */
+		bits = mask;
+		bit = 0;
+		while (bits != 0) {
+			int skip = __builtin_ctzll(bits);
+			int ones;
+			if (skip != 0) {
+				run = 0;
+			}
+			bits >>= skip;
+			bit += skip;
+			ones = (~bits == 0) ? 64 : __builtin_ctzll(~bits);
+			run += ones;
+			bit += ones;
+			if (run >= run_length) {
+				return base + bit - run;
+			}
+			bits = (ones == 64) ? 0 : bits >> ones;
+		}
+		if ((mask >> 63) == 0) {
+			run = 0;
+		}
+	}
+	return -1;
+}
+
+bool
+page_scanner_init(struct page_scanner *scanner,
+	const struct scan_pattern *patterns, int pattern_count)
+{
+	int i, string_bytes = 0;
+
+	if (pattern_count < 0 || pattern_count > SCAN_MAX_PATTERNS) {
+		return false;
+	}
+	memset(scanner, 0, sizeof(*scanner));
+	scanner->pattern_count = pattern_count;
+
+	for (i = 0; i < pattern_count; ++i) {
+		const struct scan_pattern *pattern = &patterns[i];
+		int j;
+		switch (pattern->type) {
+		case SPT_BYTE_RUN:
+			if (pattern->run.run_length <= 0) {
+				return false;
+			}
+			scanner->run_bytes[scanner->run_count] = pattern->run.byte;
+			scanner->run_lengths[scanner->run_count] =
+				pattern->run.run_length;
+			scanner->run_patterns[scanner->run_count] = i;
+			++scanner->run_count;
+			break;
+		case SPT_BYTES:
+			if (pattern->string.length <= 0 ||
+				string_bytes + pattern->string.length >
+				SCAN_MAX_STRING_BYTES) {
+				return false;
+			}
+			scanner->string_starts |= 1ULL << string_bytes;
+			for (j = 0; j < pattern->string.length; ++j) {
+				scanner->string_masks[pattern->string.bytes[j]] |=
+					1ULL << (string_bytes + j);
+			}
+			string_bytes += pattern->string.length;
+			scanner->string_ends |= 1ULL << (string_bytes - 1);
+			scanner->string_end_patterns[string_bytes - 1] = i;
+			scanner->string_lengths[string_bytes - 1] =
+				pattern->string.length;
+			break;
+		case SPT_MASKED_U64:
+			scanner->masked_values[scanner->masked_count] =
+				pattern->masked.value & pattern->masked.mask;
+			scanner->masked_masks[scanner->masked_count] =
+				pattern->masked.mask;
+			scanner->masked_patterns[scanner->masked_count] = i;
+			++scanner->masked_count;
+			break;
+		default:
+			return false;
+		}
+	}
+
+	/*
+	 * A block can only be skipped if it holds none of the bytes that start
+	 * a string. With too many distinct bytes the test costs more than it
+	 * saves.
+	 */
+	for (i = 0; i < 256; ++i) {
+		if ((scanner->string_masks[i] & scanner->string_starts) == 0) {
+			continue;
+		}
+		if (scanner->trigger_count == SCAN_MAX_TRIGGER_BYTES) {
+			scanner->trigger_count = -1;
+			break;
+		}
+		scanner->trigger_bytes[scanner->trigger_count++] = i;
+	}
+	return true;
+}
+
+static inline void
+add_match(struct scan_match *matches, int max_matches, int *found,
+	int pattern, int offset)
+{
+	if (*found < max_matches) {
+		matches[*found].pattern = pattern;
+		matches[*found].offset = offset;
+	}
+	++*found;
+}
+
+/* Reports the start of every maximal run of byte at least run_length long. */
+static void
+scan_byte_runs(const uint8_t page[SCAN_PAGE_SIZE], uint8_t byte,
+	int run_length, int pattern, struct scan_match *matches,
+	int max_matches, int *found)
+{
+	int first = page_find_byte_run(page, 0, byte, run_length), end;
+
+	while (first >= 0) {
+		add_match(matches, max_matches, found, pattern, first);
+		end = first + run_length;
+		while (end < SCAN_PAGE_SIZE && page[end] == byte) {
+			++end;
+		}
+		first = page_find_byte_run(page, end, byte, run_length);
+	}
+}
+
+int
+page_scan(const struct page_scanner *scanner,
+	const uint8_t page[SCAN_PAGE_SIZE], struct scan_match *matches,
+	int max_matches)
+{
+	int found = 0;
+	int base, i, j;
+	uint64_t state = 0;
+	bool can_skip = scanner->trigger_count >= 0;
+	uint64_t trigger_map[SCAN_PAGE_SIZE / 64];
+
+	/*
+	 * Each run is searched for on its own. page_find_byte_run only looks
+	 * at every run_length'th byte or at whole-chunk masks, which beats
+	 * stepping through every byte near a run byte in the string pass.
+	 */
+	for (j = 0; j < scanner->run_count; ++j) {
+		scan_byte_runs(page, scanner->run_bytes[j], scanner->run_lengths[j],
+			scanner->run_patterns[j], matches, max_matches, &found);
+	}
+
+	if (scanner->string_ends != 0) {
+		/* One pass per trigger byte keeps its comparand in a register */
+		for (base = 0; base < SCAN_PAGE_SIZE; base += 64) {
+			trigger_map[base / 64] = can_skip ? 0 : ~0ULL;
+		}
+		for (j = 0; can_skip && j < scanner->trigger_count; ++j) {
+			for (base = 0; base < SCAN_PAGE_SIZE; base += 64) {
+				trigger_map[base / 64] |= chunk_eq_mask(page + base,
+					&scanner->trigger_bytes[j], 1);
+			}
+		}
+
+		for (base = 0; base < SCAN_PAGE_SIZE; base += 64) {
+			uint64_t triggers = trigger_map[base / 64];
+			i = base;
+			while (i < base + 64) {
+				uint8_t c;
+
+				/*
+				 * With no string partly matched, nothing can match
+				 * before the next trigger byte.
+				 */
+				if (state == 0) {
+					uint64_t pending = triggers &
+						(~0ULL << (i - base));
+					if (pending == 0) {
+						break;
+					}
+					i = base + __builtin_ctzll(pending);
+				}
+
+				c = page[i];
+				state = ((state << 1) | scanner->string_starts) &
+					scanner->string_masks[c];
+				if (state & scanner->string_ends) {
+					uint64_t ends = state & scanner->string_ends;
+					while (ends != 0) {
+						int end = __builtin_ctzll(ends);
+						add_match(matches, max_matches, &found,
+							scanner->string_end_patterns[end],
+							i - scanner->string_lengths[end]
+							+ 1);
+						ends &= ends - 1;
+					}
+				}
+				++i;
+			}
+		}
+	}
+
+	if (scanner->masked_count > 0) {
+		for (i = 0; i < SCAN_PAGE_SIZE; i += 8) {
+			uint64_t word = load_le64(page + i);
+			for (j = 0; j < scanner->masked_count; ++j) {
+				if ((word & scanner->masked_masks[j]) ==
+					scanner->masked_values[j]) {
+					add_match(matches, max_matches, &found,
+						scanner->masked_patterns[j], i);
+				}
+			}
+		}
+	}
+	return found;
+}
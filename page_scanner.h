@@ -0,0 +1,146 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef PAGE_SCANNER_H
+#define PAGE_SCANNER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SCAN_PAGE_SIZE 4096
+
+/* Total length of all SPT_BYTES patterns in one scanner. */
+#define SCAN_MAX_STRING_BYTES 64
+#define SCAN_MAX_PATTERNS 32
+/* Distinct first bytes up to which page_scan can skip empty blocks */
+#define SCAN_MAX_TRIGGER_BYTES 8
+
+enum scan_pattern_type {
+	/* At least run_length consecutive copies of byte. */
+	SPT_BYTE_RUN,
+	/* An exact byte string. */
+	SPT_BYTES,
+	/* An 8-byte aligned little-endian word w with (w & mask) == value. */
+	SPT_MASKED_U64
+};
+
+struct scan_pattern {
+	enum scan_pattern_type type;
+	union {
+		struct {
+			uint8_t byte;
+			int run_length;
+		} run;
+		struct {
+			const uint8_t *bytes;
+			int length;
+		} string;
+		struct {
+			uint64_t value;
+			uint64_t mask;
+		} masked;
+	};
+};
+
+struct scan_match {
+	uint16_t pattern; /* Index into the array given to page_scanner_init */
+	uint16_t offset;
+};
+
+struct page_scanner {
+	int pattern_count;
+
+	/* Bytes that can begin a string; -1 if there are too many to test. */
+	int trigger_count;
+	uint8_t trigger_bytes[SCAN_MAX_TRIGGER_BYTES];
+
+	/* Byte run patterns */
+	int run_count;
+	uint8_t run_bytes[SCAN_MAX_PATTERNS];
+	int run_lengths[SCAN_MAX_PATTERNS];
+	int run_patterns[SCAN_MAX_PATTERNS];
+
+	/* Multi-pattern shift-and over all SPT_BYTES patterns, which are packed
+	 * end to end into one 64-bit state. */
+	uint64_t string_masks[256];
+	uint64_t string_starts;
+	uint64_t string_ends;
+	int string_end_patterns[SCAN_MAX_STRING_BYTES];
+	int string_lengths[SCAN_MAX_STRING_BYTES];
+
+	/* Masked 64-bit word patterns */
+	int masked_count;
+	uint64_t masked_values[SCAN_MAX_PATTERNS];
+	uint64_t masked_masks[SCAN_MAX_PATTERNS];
+	int masked_patterns[SCAN_MAX_PATTERNS];
+};
+
+/*
+ * Compiles patterns for page_scan. Returns false if there are more than
+ * SCAN_MAX_PATTERNS patterns, the byte strings add up to more than
+ * SCAN_MAX_STRING_BYTES, or a pattern has a non-positive length. Nothing
+ * in patterns is referenced after this returns.
+ */
+bool
+page_scanner_init(struct page_scanner *scanner,
+	const struct scan_pattern *patterns, int pattern_count);
+
+/*
+ * Finds every pattern in a page. A byte run is reported once, at the start
+ * of each maximal run at least run_length long. Strings are reported at every
+ * offset where they occur, overlapping or not.
+ *
+ * Runs are searched for one pattern at a time, and all the strings together
+ * in one pass. Matches are written up to max_matches: each run pattern's in
+ * page order, then string matches in the order of the byte that completes
+ * them, then masked word matches. Returns the total number of matches, which
+ * may be larger.
+ *
+ * Only test_secret_position calls this so far; secret_position looks for
+ * its one run with page_find_byte_run.
+ */
+int
+page_scan(const struct page_scanner *scanner,
+	const uint8_t page[SCAN_PAGE_SIZE], struct scan_match *matches,
+	int max_matches);
+
+/*
+ * Returns the index of the first byte of the first run of at least
+ * run_length copies of byte at or after start, counting only bytes from
+ * start onwards, or -1 if there is none.
+ */
+int
+page_find_byte_run(const uint8_t page[SCAN_PAGE_SIZE], int start,
+	uint8_t byte, int run_length);
+
+#endif
@@ -0,0 +1,200 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "page_set.h"
+
+/* Slots examined from a page's hash before evicting. */
+#define PAGE_SET_PROBES 8
+#define PAGE_SET_PAGE_SHIFT 12
+
+static uint64_t
+page_set_now_ns(const struct page_set *set)
+{
+	struct timespec now;
+	if (set->max_age_ns == 0) {
+		return 0;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static inline uint32_t
+page_set_hash(const struct page_set *set, uint64_t page)
+{
+	/* Fibonacci hashing: the top bits of the product are well mixed. */
+	return ((page >> PAGE_SET_PAGE_SHIFT) * 0x9E3779B97F4A7C15ULL) >>
+		(64 - set->capacity_bits);
+}
+
+static inline bool
+page_set_entry_live(const struct page_set *set,
+	const struct page_set_entry *entry, uint64_t now_ns)
+{
+	if (entry->generation == 0 ||
+		set->generation - entry->generation >= set->max_generations) {
+		return false;
+	}
+	return set->max_age_ns == 0 ||
+		now_ns - entry->inserted_ns < set->max_age_ns;
+}
+
+bool
+page_set_init(struct page_set *set, uint32_t capacity,
+	uint32_t max_generations, uint64_t max_age_ns)
+{
+	memset(set, 0, sizeof(*set));
+	set->capacity_bits = 1;
+	while ((1U << set->capacity_bits) < capacity ||
+		(1U << set->capacity_bits) < PAGE_SET_PROBES) {
+		++set->capacity_bits;
+	}
+	set->capacity_mask = (1U << set->capacity_bits) - 1;
+	set->entries = calloc(set->capacity_mask + 1, sizeof(*set->entries));
+	set->generation = 1;
+	set->max_generations = max_generations > 0 ? max_generations : 1;
+	set->max_age_ns = max_age_ns;
+	return set->entries != NULL;
+}
+
+void
+page_set_destroy(struct page_set *set)
+{
+	free(set->entries);
+	set->entries = NULL;
+}
+
+/*
+ * Finds page among the slots it can occupy. If it is not live there, returns
+ * the slot to add it in instead.
+ */
+static struct page_set_entry *
+page_set_find(const struct page_set *set, uint64_t page, uint64_t now_ns,
+	bool *live)
+{
+	struct page_set_entry *entry, *free_slot = NULL, *oldest = NULL;
+	uint32_t hash = page_set_hash(set, page);
+	int probe;
+
+	for (probe = 0; probe < PAGE_SET_PROBES; ++probe) {
+		entry = &set->entries[(hash + probe) & set->capacity_mask];
+		if (entry->generation == 0) {
+			/* Slots are never emptied, so page cannot be further on. */
+			if (free_slot == NULL) {
+				free_slot = entry;
+			}
+			break;
+		}
+		if (entry->page == page) {
+			*live = page_set_entry_live(set, entry, now_ns);
+			return entry;
+		}
+		if (!page_set_entry_live(set, entry, now_ns)) {
+			if (free_slot == NULL) {
+				free_slot = entry;
+			}
+		} else if (oldest == NULL || entry->sequence < oldest->sequence) {
+			oldest = entry;
+		}
+	}
+	*live = false;
+	return free_slot != NULL ? free_slot : oldest;
+}
+
+static void
+page_set_store(struct page_set *set, struct page_set_entry *entry,
+	uint64_t page, uint64_t now_ns)
+{
+	if (page_set_entry_live(set, entry, now_ns) && entry->page != page) {
+		++set->evictions;
+	}
+	entry->page = page;
+	entry->sequence = set->sequence++;
+	entry->inserted_ns = now_ns;
+	entry->generation = set->generation;
+}
+
+bool
+page_set_test_and_add(struct page_set *set, uint64_t page)
+{
+	uint64_t now_ns = page_set_now_ns(set);
+	bool live;
+	struct page_set_entry *entry = page_set_find(set, page, now_ns, &live);
+
+	if (live) {
+		++set->hits;
+		return true;
+	}
+	++set->misses;
+	page_set_store(set, entry, page, now_ns);
+	return false;
+}
+
+bool
+page_set_contains(struct page_set *set, uint64_t page)
+{
+	bool live;
+	page_set_find(set, page, page_set_now_ns(set), &live);
+	if (live) {
+		++set->hits;
+	} else {
+		++set->misses;
+	}
+	return live;
+}
+
+void
+page_set_add(struct page_set *set, uint64_t page)
+{
+	uint64_t now_ns = page_set_now_ns(set);
+	bool live;
+	struct page_set_entry *entry = page_set_find(set, page, now_ns, &live);
+
+	if (!live) {
+		page_set_store(set, entry, page, now_ns);
+	}
+}
+
+void
+page_set_new_generation(struct page_set *set)
+{
+	if (++set->generation == 0) {
+		/* Wrapped: old generation numbers would look current again. */
+		memset(set->entries, 0,
+			(set->capacity_mask + 1) * sizeof(*set->entries));
+		set->generation = 1;
+	}
+}
@@ -0,0 +1,102 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef PAGE_SET_H
+#define PAGE_SET_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * A fixed-size set of page addresses for remembering which pages have
+ * already been handled. Entries expire when the set has moved on
+ * max_generations generations since they were added, or, if max_age_ns is
+ * non-zero, when they are older than that. When every slot near a page's hash
+ * is live, the oldest of them is evicted, so a full set forgets rather than
+ * fails.
+ */
+
+struct page_set_entry {
+	uint64_t page;
+	uint64_t sequence; /* Insertion order, for choosing an eviction victim */
+	uint64_t inserted_ns;
+	uint32_t generation; /* 0 if the slot has never been used */
+};
+
+struct page_set {
+	struct page_set_entry *entries;
+	uint32_t capacity_mask;
+	uint32_t capacity_bits;
+	uint32_t generation;
+	uint32_t max_generations;
+	uint64_t max_age_ns;
+	uint64_t sequence;
+
+	uint64_t hits;
+	uint64_t misses;
+	uint64_t evictions;
+};
+
+/*
+ * capacity is rounded up to a power of two. Returns false if the entries
+ * cannot be allocated.
+ */
+bool
+page_set_init(struct page_set *set, uint32_t capacity,
+	uint32_t max_generations, uint64_t max_age_ns);
+
+void
+page_set_destroy(struct page_set *set);
+
+/*
+ * Returns true if page is a live member, counting a hit, and otherwise adds
+ * it, counting a miss. page should be page aligned.
+ */
+bool
+page_set_test_and_add(struct page_set *set, uint64_t page);
+
+/* Returns true if page is a live member, counting a hit or a miss. */
+bool
+page_set_contains(struct page_set *set, uint64_t page);
+
+void
+page_set_add(struct page_set *set, uint64_t page);
+
+/*
+ * Moves to the next generation in constant time. With max_generations of 1
+ * this empties the set.
+ */
+void
+page_set_new_generation(struct page_set *set);
+
+#endif
@@ -0,0 +1,239 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "page_store.h"
+
+#define HASH_PRIME_1 0x9E3779B185EBCA87ULL
+#define HASH_PRIME_2 0xC2B2AE3D27D4EB4FULL
+#define HASH_PRIME_3 0x165667B19E3779F9ULL
+#define HASH_PRIME_4 0x85EBCA77C2B2AE63ULL
+
+static inline uint64_t
+rotate_left(uint64_t value, int bits)
+{
+	return (value << bits) | (value >> (64 - bits));
+}
+
+static inline uint64_t
+load_word(const uint8_t *bytes)
+{
+	uint64_t word;
+	memcpy(&word, bytes, sizeof(word));
+	return word;
+}
+
+static inline uint64_t
+avalanche(uint64_t hash)
+{
+	hash ^= hash >> 33;
+	hash *= HASH_PRIME_2;
+	hash ^= hash >> 29;
+	hash *= HASH_PRIME_3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+void
+page_key_of(const uint8_t *page, struct page_key *key)
+{
+	/*
+	 * Eight xxHash64-style lanes, each word feeding one. The two halves of
+	 * the key fold the lanes differently and so are independent enough that
+	 * a collision needs both to collide.
+	 */
+	uint64_t lanes[8] = {
+		HASH_PRIME_1 + HASH_PRIME_2, HASH_PRIME_2, 0, -HASH_PRIME_1,
+		HASH_PRIME_3, HASH_PRIME_4, HASH_PRIME_1, -HASH_PRIME_2 };
+
+	for (int i = 0; i < PAGE_STORE_PAGE_BYTES; i += 64) {
+		for (int lane = 0; lane < 8; ++lane) {
+			lanes[lane] += load_word(page + i + lane * 8) * HASH_PRIME_2;
+			lanes[lane] = rotate_left(lanes[lane], 31) * HASH_PRIME_1;
+		}
+	}
+	key->high = avalanche(rotate_left(lanes[0], 1) + rotate_left(lanes[1], 7) +
+		rotate_left(lanes[2], 12) + rotate_left(lanes[3], 18) +
+		(lanes[4] ^ lanes[5]) * HASH_PRIME_4);
+	key->low = avalanche(rotate_left(lanes[4], 1) + rotate_left(lanes[5], 7) +
+		rotate_left(lanes[6], 12) + rotate_left(lanes[7], 18) +
+		(lanes[0] ^ lanes[3]) * HASH_PRIME_4);
+}
+
+bool
+page_is_zero(const uint8_t *page)
+{
+	uint64_t any = 0;
+
+	/* A line at a time, so the inner loop can be vectorised. */
+	for (int i = 0; i < PAGE_STORE_PAGE_BYTES; i += 64) {
+		for (int word = 0; word < 8; ++word) {
+			any |= load_word(page + i + word * 8);
+		}
+		if (any != 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool
+page_store_init(struct page_store *store, uint32_t capacity)
+{
+	uint32_t size = 16;
+
+	/* Kept at most half full, so probe sequences stay short. */
+	while (size < capacity * 2ULL) {
+		size <<= 1;
+	}
+	memset(store, 0, sizeof(*store));
+	store->capacity_mask = size - 1;
+	store->capacity = capacity;
+	store->entries = calloc(size, sizeof(*store->entries));
+	store->pages = malloc((size_t)capacity * PAGE_STORE_PAGE_BYTES);
+	store->page_keys = malloc(capacity * sizeof(*store->page_keys));
+	store->referenced = calloc(capacity, sizeof(*store->referenced));
+	if (capacity == 0 || store->entries == NULL || store->pages == NULL ||
+		store->page_keys == NULL || store->referenced == NULL) {
+		page_store_destroy(store);
+		return false;
+	}
+	return true;
+}
+
+void
+page_store_destroy(struct page_store *store)
+{
+	free(store->entries);
+	free(store->pages);
+	free(store->page_keys);
+	free(store->referenced);
+	store->entries = NULL;
+	store->pages = NULL;
+	store->page_keys = NULL;
+	store->referenced = NULL;
+}
+
+/* Returns the slot holding key, or the empty slot where it would go. */
+static uint32_t
+page_store_slot(const struct page_store *store, const struct page_key *key)
+{
+	/* The key is already a good hash; linear probing from its low bits. */
+	uint32_t slot = key->low & store->capacity_mask;
+
+	while (store->entries[slot].location != 0 &&
+		(store->entries[slot].key.high != key->high ||
+		store->entries[slot].key.low != key->low)) {
+		slot = (slot + 1) & store->capacity_mask;
+	}
+	return slot;
+}
+
+/*
+ * Empties slot, moving back any later entries in its probe run that would no
+ * longer be found past the gap.
+ */
+static void
+page_store_remove(struct page_store *store, uint32_t slot)
+{
+	struct page_store_entry *entries = store->entries;
+	uint32_t mask = store->capacity_mask, next = slot, home;
+
+	entries[slot].location = 0;
+	while (true) {
+		next = (next + 1) & mask;
+		if (entries[next].location == 0) {
+			return;
+		}
+		home = entries[next].key.low & mask;
+		/* Move the entry unless its home is after the gap. */
+		if (((next - home) & mask) >= ((next - slot) & mask)) {
+			entries[slot] = entries[next];
+			entries[next].location = 0;
+			slot = next;
+		}
+	}
+}
+
+/* Forgets the first copy not referenced since the hand last passed it. */
+static uint32_t
+page_store_evict(struct page_store *store)
+{
+	uint32_t page;
+
+	while (store->referenced[store->clock_hand]) {
+		store->referenced[store->clock_hand] = 0;
+		store->clock_hand = (store->clock_hand + 1) % store->capacity;
+	}
+	page = store->clock_hand;
+	store->clock_hand = (store->clock_hand + 1) % store->capacity;
+	page_store_remove(store, page_store_slot(store, &store->page_keys[page]));
+	return page;
+}
+
+bool
+page_store_find_or_add(struct page_store *store, const struct page_key *key,
+	const uint8_t *page, uint64_t location, uint64_t *existing)
+{
+	struct page_store_entry *entry;
+	uint32_t copy;
+
+	entry = &store->entries[page_store_slot(store, key)];
+	if (entry->location != 0) {
+		if (memcmp(store->pages + (size_t)entry->page *
+				PAGE_STORE_PAGE_BYTES, page, PAGE_STORE_PAGE_BYTES) != 0) {
+			return false; /* A hash collision; keep the first page */
+		}
+		store->referenced[entry->page] = 1;
+		*existing = entry->location - 1;
+		return true;
+	}
+
+	if (store->count < store->capacity) {
+		copy = store->count++;
+	} else {
+		copy = page_store_evict(store);
+		/* Removing an entry may have moved the slot for key. */
+		entry = &store->entries[page_store_slot(store, key)];
+	}
+	memcpy(store->pages + (size_t)copy * PAGE_STORE_PAGE_BYTES, page,
+		PAGE_STORE_PAGE_BYTES);
+	store->page_keys[copy] = *key;
+	store->referenced[copy] = 0;
+	entry->key = *key;
+	entry->location = location + 1;
+	entry->page = copy;
+	return false;
+}
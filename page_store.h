@@ -0,0 +1,104 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef PAGE_STORE_H
+#define PAGE_STORE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * An index of page contents for deduplicating captures. Pages are keyed by a
+ * 128-bit hash of their contents and map to the location where the first
+ * copy was stored, so that later copies can be recorded as a reference to it.
+ * Zero pages are common enough in captures to be detected separately, without
+ * hashing.
+ *
+ * The store keeps a copy of each page it remembers, so a page only matches
+ * one with the same contents and never merely the same hash. It remembers a
+ * fixed number of pages; once full, adding a page forgets one that has not
+ * matched since the clock hand last passed it.
+ */
+
+#define PAGE_STORE_PAGE_BYTES 4096
+
+struct page_key {
+	uint64_t high;
+	uint64_t low;
+};
+
+struct page_store_entry {
+	struct page_key key;
+	uint64_t location; /* Plus one; 0 if the slot is empty */
+	uint32_t page; /* Index of the copy in pages */
+};
+
+struct page_store {
+	struct page_store_entry *entries; /* At most half full */
+	uint32_t capacity_mask; /* Of entries */
+	uint32_t capacity; /* Pages remembered */
+	uint32_t count;
+	uint8_t *pages; /* capacity copies of PAGE_STORE_PAGE_BYTES */
+	struct page_key *page_keys; /* The key each copy is stored under */
+	uint8_t *referenced; /* Set when a copy matches; cleared by the hand */
+	uint32_t clock_hand; /* Next copy to consider forgetting */
+};
+
+/*
+ * Remembers up to capacity pages, using PAGE_STORE_PAGE_BYTES of memory for
+ * each. Returns false if they cannot be allocated.
+ */
+bool
+page_store_init(struct page_store *store, uint32_t capacity);
+
+void
+page_store_destroy(struct page_store *store);
+
+/* Hashes a page of PAGE_STORE_PAGE_BYTES. */
+void
+page_key_of(const uint8_t *page, struct page_key *key);
+
+bool
+page_is_zero(const uint8_t *page);
+
+/*
+ * Returns true, setting *existing to where the page was stored, if a page
+ * with key and the same contents is remembered. Otherwise returns false and,
+ * unless a different page is remembered under the same key, remembers page
+ * as stored at location.
+ */
+bool
+page_store_find_or_add(struct page_store *store, const struct page_key *key,
+	const uint8_t *page, uint64_t location, uint64_t *existing);
+
+#endif
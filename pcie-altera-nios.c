@@ -103,6 +103,10 @@ wait_for_tlp(volatile TLPQuadWord *tlp, int tlp_len)
 
 	do {
 		ready = IORD(PCIEPACKETRECEIVER_0_BASE, PCIEPACKETRECEIVER_READY);
+		if (ready == 0) {
+			/* Nothing to service, so format the log over the UART now. */
+			log_print();
+		}
 	} while (ready == 0);
 
 	do {
@@ -39,6 +39,8 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
 #include "qemu/bswap.h"
 #include "hw/pci/pci.h"
 #include "pcie.h"
@@ -48,6 +50,8 @@
 #include "peripheral-io.h"
 #include "pcie.h"
 #include "pcie-backend.h"
+#include "tlp_capture.h"
+#include "tlp_metrics.h"
 #include "log.h"
 
 volatile uint8_t *led_phys_mem;
@@ -60,54 +64,12 @@ bswap32_within_64(uint64_t input)
 	return ((uint64_t)(high_word) << 32) | low_word;
 }
 
-
-/* Request is not a whole number of dwords, so we need to read one more dword,
- * then use the lastbe to select the parts we want. I had to work this out on
- * paper. It works.
- */
-struct byte_enables {
-	uint8_t first;
-	uint8_t last;
-};
-
-static inline uint16_t
-calculate_dword_length(uint16_t byte_len)
-{
-	return ((byte_len + 3) / 4) * 4;
-}
-
-static inline uint8_t
-last_be_for_length(uint16_t byte_len)
-{
-	return ((1 << (4 - (calculate_dword_length(byte_len) - byte_len))) - 1);
-}
-
-static inline struct byte_enables
-calculate_bes_for_length(uint16_t byte_len)
-{
-	struct byte_enables bes;
-	bes.last = last_be_for_length(byte_len);
-	if (calculate_dword_length(byte_len) / sizeof(TLPDoubleWord) == 1) {
-		bes.first = bes.last;
-		bes.last = 0;
-	} else {
-		bes.first = 0xF;
-	}
-	return bes;
-}
-
-static inline uint64_t
-uint64_min(uint64_t left, uint64_t right)
-{
-	return (left < right) ? left : right;
-}
-
 static inline enum tlp_data_alignment
 tlp_get_alignment_from_header(TLPDoubleWord *header)
 {
-	struct TLP64DWord0 *dword0 = (struct TLP64DWord0 *)header;
-	if ((tlp_get_type(dword0) == M || tlp_get_type(dword0) == M_LK) &&
-		tlp_fmt_is_4dw(tlp_get_fmt(dword0))) {
+	struct tlp_class classified = tlp_classify(header);
+	if ((classified.type == M || classified.type == M_LK) &&
+		tlp_fmt_is_4dw(classified.fmt)) {
 /*		if (print)
 			printf("4DW M Header. Addr: %x. Aligned? %d.", header[3],
 				(header[3] % 8) == 0);
@@ -123,6 +85,28 @@ tlp_get_alignment_from_header(TLPDoubleWord *header)
 }
 
 
+/*
+ * The receive path leaves data_length for the consumer to work out, so the
+ * capture takes it from the header, bounded by what actually arrived.
+ */
+static void
+capture_received_tlp(const struct RawTLP *tlp, int received_bytes)
+{
+	struct RawTLP captured = *tlp;
+	int length;
+
+	if (captured.data != NULL) {
+		length = tlp_get_length((struct TLP64DWord0 *)captured.header);
+		length = (length == 0 ? 1024 : length) * sizeof(TLPDoubleWord);
+		captured.data_length = received_bytes -
+			(captured.data - captured.header) * sizeof(TLPDoubleWord);
+		if (captured.data_length > length) {
+			captured.data_length = length;
+		}
+	}
+	capture_tlp(TCD_RECEIVED, &captured);
+}
+
 /* tlp_len is length of the buffer in bytes. */
 /* This is non block -- will return if nothing to do, because the main loop
  * has to be interspersed with. */
@@ -183,10 +167,10 @@ wait_for_tlp(TLPQuadWord *buffer, int buffer_len, struct RawTLP *out)
 	 */
 
 	out->header = (TLPDoubleWord *)buffer;
-	struct TLP64DWord0 *dword0 = (struct TLP64DWord0 *)out->header;
-//	printf("fmt: %x\n", tlp_get_fmt(dword0));
+	struct tlp_class classified = tlp_classify(out->header);
+//	printf("fmt: %x\n", classified.fmt);
 
-	switch (tlp_get_fmt(dword0)) {
+	switch (classified.fmt) {
 	case TLPFMT_3DW_NODATA:
 	case TLPFMT_3DW_DATA:
 		out->header_length = 12;
@@ -203,11 +187,11 @@ wait_for_tlp(TLPQuadWord *buffer, int buffer_len, struct RawTLP *out)
 	 * Write, Config Write Types 0 and 1, Completion with Data, Completion
 	 * with Data Locked. */
 
-	if (tlp_fmt_has_data(tlp_get_fmt(dword0))) {
+	if (tlp_fmt_has_data(classified.fmt)) {
 		if (tlp_get_alignment_from_header(out->header) == TDA_ALIGNED) {
 			out->data = out->header + 4;
 		} else {
-			if (tlp_fmt_is_4dw(tlp_get_fmt(dword0))) {
+			if (tlp_fmt_is_4dw(classified.fmt)) {
 				out->data = out->header + 5;
 			} else {
 				out->data = out->header + 3;
@@ -217,6 +201,10 @@ wait_for_tlp(TLPQuadWord *buffer, int buffer_len, struct RawTLP *out)
 		out->data = NULL;
 		out->data_length = 0;
 	}
+
+	if (tlp_capture.enabled) {
+		capture_received_tlp(out, i * 8);
+	}
 }
 
 
@@ -232,11 +220,43 @@ initialise_leds()
 #undef LED_BASE
 }
 
+/* Nanoseconds. */
+unsigned long
+read_hw_counter()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+/*
+ * TLPs are captured to TLP_CAPTURE_DEFAULT_FILE unless the TLP_CAPTURE
+ * environment variable names another file. Setting it empty turns capture
+ * off.
+ */
+static void
+initialise_capture()
+{
+	const char *path = getenv("TLP_CAPTURE");
+	if (path == NULL) {
+		path = TLP_CAPTURE_DEFAULT_FILE;
+	}
+	if (path[0] == '\0') {
+		return;
+	}
+	if (tlp_capture_open(&tlp_capture, path, TLP_CAPTURE_DEFAULT_RECORDS)) {
+		printf("Capturing TLPs to %s.\n", path);
+	} else {
+		printf("Couldn't open %s. Not capturing TLPs.\n", path);
+	}
+}
+
 int
 pcie_hardware_init(int argc, char **argv, volatile uint8_t **physmem)
 {
 	*physmem = open_io_region(PCIEPACKET_REGION_BASE, PCIEPACKET_REGION_LENGTH);
 	/*initialise_leds();*/
+	initialise_capture();
 	return 0;
 }
 
@@ -264,6 +284,8 @@ send_tlp(struct RawTLP *tlp)
 	 */
 
 	 fflush(stdout);
+	capture_tlp(TCD_SENT, tlp);
+	count_tlp(TMD_SENT, tlp);
 	/* Special case for:
 	 * 3DW, Unaligned data. Send qword of remaining header dword, first data.
 	 *   Construct qwords from unaligned data and send.
@@ -429,177 +451,8 @@ send_tlp(struct RawTLP *tlp)
 #undef WR_DATA
 }
 
-static inline enum dma_read_response
-_perform_dma_read(uint8_t* buf, uint16_t length, uint16_t requester_id,
-	uint8_t tag, enum tlp_at at, uint64_t address)
-{
-	/* This should be extracted from Max_Read_Request_Size in the Device
-	 * Control Register. */
-
-	enum dma_read_response return_value = DRR_SUCCESS;
-
-	assert(length > 0);
-	if (length > 512) {
-		printf("Bad dma read.\n");
-	}
-	assert(length <= 512);
-	assert(buf != NULL);
-
-	TLPQuadWord read_req_tlp_buffer[2];
-	struct RawTLP read_req_tlp;
-	read_req_tlp.header = (TLPDoubleWord *)read_req_tlp_buffer;
-
-	struct RawTLP read_resp_tlp;
-	set_raw_tlp_invalid(&read_resp_tlp);
-	struct TLP64DWord0 *read_resp_dword0;
-	struct TLP64CompletionDWord1 *read_resp_dword1;
-
-	uint16_t ceil_length = calculate_dword_length(length);
-	struct byte_enables bes = calculate_bes_for_length(length);
-
-	/*PDBG("length: %d, ceil_length: %d, lastbe: 0x%x, firstbe: 0x%x.",*/
-		/*length, ceil_length, lastbe, firstbe);*/
-	struct TLP64DWord0 *dword0;
-
-	create_memory_request_header(&read_req_tlp, TLPD_READ, at,
-		ceil_length / 4, requester_id, tag, bes.last, bes.first,
-		address);
-	int send_result = send_tlp(&read_req_tlp);
-	assert(send_result != -1);
-
-	/* i is total amount of data read; j is data from specific completion.
-	 * Data for long reads (more than 32 dwords) will come back as multiple
-	 * completions.
-	 */
-	int i = 0, j;
-
-	while (i < length) {
-		next_completion_tlp(&read_resp_tlp);
-
-		if (!is_raw_tlp_valid(&read_resp_tlp)) {
-			free_raw_tlp_buffer(&read_resp_tlp);
-			return DRR_NO_RESPONSE;
-		}
-
-		assert(&read_resp_tlp != NULL);
-		assert(read_resp_tlp.header != NULL);
-		assert(read_resp_tlp.header_length != -1);
-		assert(is_raw_tlp_valid(&read_resp_tlp));
-
-		read_resp_dword0 = (struct TLP64DWord0 *)(read_resp_tlp.header);
-		assert(tlp_get_type(read_resp_dword0) == CPL);
-
-		read_resp_dword1 = (struct TLP64CompletionDWord1 *)(
-			read_resp_tlp.header + 1);
-
-		if (tlp_get_status(read_resp_dword1) == TLPCS_UNSUPPORTED_REQUEST) {
-			free_raw_tlp_buffer(&read_resp_tlp);
-			return DRR_UNSUPPORTED_REQUEST;
-		}
-
-		dword0 = (struct TLP64DWord0 *)read_resp_tlp.header;
-
-		assert(tlp_fmt_has_data(tlp_get_fmt(dword0)));
-
-		for (j = 0; j < (tlp_get_length(dword0) * sizeof(TLPDoubleWord)) &&
-				(i + j) < length; ++j) {
-			buf[i + j] = ((uint8_t *)(read_resp_tlp.data))[j];
-			/*PDBG("i: %d, j: %d, i + j: %d, buf[i + j]: %d.",*/
-				/*i, j, i + j, buf[i + j]);*/
-		}
-
-		i += (tlp_get_length(dword0) * sizeof(TLPDoubleWord));
-
-		/*if (dword0->length != 1) {*/
-			/*printf("Non standard completion packet; i is now %d.\n", i);*/
-		/*}*/
-		/*PDBG("i: %d. length: %d", i, length);*/
-		free_raw_tlp_buffer(&read_resp_tlp);
-	}
-	/*if (dword0->length != 1) {*/
-		/*puts("Done!");*/
-	/*}*/
-
-	/*PDBG("Done reading.");*/
-
-	return return_value;
-}
-
-enum dma_read_response
-perform_translated_dma_read(uint8_t* buf, uint16_t length, uint16_t requester_id,
-	uint8_t tag, uint64_t address)
-{
-	return _perform_dma_read(buf, length, requester_id, tag, TLP_AT_TRANSLATED,
-		address);
-}
-
-
-enum dma_read_response
-perform_dma_read(uint8_t* buf, uint16_t length, uint16_t requester_id,
-	uint8_t tag, uint64_t address)
-{
-	return _perform_dma_read(buf, length, requester_id, tag,
-		TLP_AT_UNTRANSLATED, address);
-}
-
-
-/*
- * We should handle tags with more sophistication than we do -- each part of
- * the core should use a specific tag, but this would require modifying calls
- * to pci_dma_read. For tags see page 88 of the manual. I use 8, which is the
- * transmit side reading from memory.
- */
-int
-pci_dma_read(PCIDevice *dev, dma_addr_t addr, void *buf, dma_addr_t len)
-{
-	return perform_dma_read((uint8_t *)buf, len, dev->devfn, 8, addr);
-}
-
-int
-perform_dma_write(const uint8_t* buf, int16_t length, uint16_t requester_id,
-	uint8_t tag, uint64_t address)
-{
-	const uint16_t SEND_LIMIT = 128; /* bytes */
-	TLPQuadWord write_req_header_buffer[2];
-	TLPQuadWord *write_data = aligned_alloc(8, ((length + 7) / 8) * 8);
-	/* TODO: Only do this if the data is confirmed to be misaligned. */
-
-	for (int i = 0; i < length; ++i) {
-		((uint8_t *)write_data)[i] = ((const uint8_t *)buf)[i];
-	}
-
-	uint16_t send_amount, send_dwords, left_to_send, cursor = 0;
-	uint16_t dword_length = calculate_dword_length(length);
-
-	struct RawTLP write_req_tlp;
-	write_req_tlp.header = (TLPDoubleWord *)write_req_header_buffer;
-
-	do {
-		write_req_tlp.data = (TLPDoubleWord *)(write_data +
-			cursor / sizeof(TLPQuadWord));
-		left_to_send = length - cursor;
-		send_amount = left_to_send < SEND_LIMIT ? left_to_send : SEND_LIMIT;
-		struct byte_enables bes = calculate_bes_for_length(send_amount);
-		send_dwords = calculate_dword_length(send_amount);
-		create_memory_request_header(&write_req_tlp, TLPD_WRITE,
-			TLP_AT_UNTRANSLATED, send_dwords / sizeof(TLPDoubleWord),
-			requester_id, tag, bes.last, bes.first, address + cursor);
-		int send_result = send_tlp(&write_req_tlp);
-		assert(send_result != -1);
-		cursor += send_dwords;
-	} while (cursor < dword_length);
-
-	free(write_data);
-	return 0;
-}
-
-int
-pci_dma_write(PCIDevice *dev, dma_addr_t addr, const void *buf, dma_addr_t len)
-{
-	return perform_dma_write(buf, len, dev->devfn, 0, addr);
-}
-
 void
 close_connections()
 {
+	tlp_capture_close(&tlp_capture);
 }
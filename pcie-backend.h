@@ -1,3 +1,6 @@
+#ifndef PCIE_BACKEND_H
+#define PCIE_BACKEND_H
+
 #include "pcie.h"
 
 extern volatile uint8_t *physmem;
@@ -36,3 +39,5 @@ drain_pcie_core();
 #ifdef POSTGRES
 extern int TLPS_CHECKED;
 #endif
+
+#endif
@@ -0,0 +1,605 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/*
+ * A backend with no link, for benchmarking. The host is simulated in memory:
+ * it answers the memory reads the device sends with completions from a
+ * buffer standing in for host memory, and stores the device's memory
+ * writes there. That drives the TLP codec, the queues and buffer pool and
+ * the DMA read and write paths in pcie.c, which the Altera backend shares,
+ * at memory speed.
+ *
+ * pcie_hardware_init times the header builders, the DMA paths and a couple
+ * of the attack helpers. The main loop then receives a script of config,
+ * memory and IO requests for the NIC model, so that respond_to_packet and
+ * the dispatch around it are timed as they run live. When the script ends
+ * the results are printed, written as JSON to the file named on the command
+ * line, and the process exits.
+ */
+
+#include "pcie-backend.h"
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <time.h>
+
+#include "hw/pci/pci.h"
+#include "hw/net/e1000_regs.h"
+#include "net/checksum.h"
+#include "qemu/bswap.h"
+#include "pcie.h"
+#include "secret_position.h"
+#include "tlp_metrics.h"
+
+#define BENCH_HOST_MEMORY_BYTES (1 << 20)
+#define BENCH_COMPLETION_BYTES 128 /* The host's read completion boundary */
+#define BENCH_QUEUE_LENGTH 256
+#define BENCH_MAX_RESULTS 32
+#define BENCH_DEFAULT_OUTPUT "bench.json"
+
+#define BENCH_HOST_ID 0x0000
+#define BENCH_DEVICE_ID 0x0100 /* Bus 1, device 0, function 0 */
+#define BENCH_MMIO_BASE 0xF0000000
+#define BENCH_IO_BASE 0xE000
+
+#define HEADER_ITERATIONS 10000000
+#define DMA_ITERATIONS 100000
+#define SCAN_ITERATIONS 1000000
+#define DISPATCH_ITERATIONS 200000
+
+struct queued_tlp {
+	int header_length;
+	int data_length;
+	TLPDoubleWord header[4];
+	TLPDoubleWord data[BENCH_COMPLETION_BYTES / sizeof(TLPDoubleWord)];
+};
+
+struct bench_result {
+	const char *name;
+	uint64_t operations;
+	uint64_t bytes_per_operation;
+	double seconds;
+};
+
+enum bench_request {
+	BR_CONFIG_READ,
+	BR_CONFIG_WRITE,
+	BR_MEMORY_READ,
+	BR_MEMORY_WRITE,
+	BR_IO_WRITE,
+	BR_IO_READ,
+	BR_COUNT
+};
+
+static const char *bench_request_names[BR_COUNT] = {
+	"respond_to_packet CfgRd0",
+	"respond_to_packet CfgWr0",
+	"respond_to_packet MRd",
+	"respond_to_packet MWr",
+	"respond_to_packet IOWr",
+	"respond_to_packet IORd"
+};
+
+/* Config writes that map the BARs before the script starts. */
+static const struct {
+	uint16_t address;
+	uint32_t value;
+} setup_writes[] = {
+	{ PCI_BASE_ADDRESS_0, BENCH_MMIO_BASE },
+	{ PCI_BASE_ADDRESS_2, BENCH_IO_BASE },
+	{ PCI_COMMAND, PCI_COMMAND_IO | PCI_COMMAND_MEMORY }
+};
+
+static uint8_t host_memory[BENCH_HOST_MEMORY_BYTES];
+
+static struct queued_tlp queue[BENCH_QUEUE_LENGTH];
+static unsigned queue_head, queue_tail;
+
+static struct bench_result results[BENCH_MAX_RESULTS];
+static int result_count;
+static const char *output_path = BENCH_DEFAULT_OUTPUT;
+
+static bool dispatching;
+static int setup_sent;
+static enum bench_request script_request;
+static int script_iteration;
+static struct timespec script_start;
+static uint64_t unexpected_completions;
+
+static volatile uint64_t sink;
+
+static double
+seconds_since(const struct timespec *start)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - start->tv_sec) +
+		(now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static void
+record_result(const char *name, uint64_t operations,
+	uint64_t bytes_per_operation, double seconds)
+{
+	assert(result_count < BENCH_MAX_RESULTS);
+	results[result_count].name = name;
+	results[result_count].operations = operations;
+	results[result_count].bytes_per_operation = bytes_per_operation;
+	results[result_count].seconds = seconds;
+	++result_count;
+}
+
+static uint8_t *
+host_address(uint64_t address, uint64_t length)
+{
+	assert(address + length <= BENCH_HOST_MEMORY_BYTES);
+	return host_memory + address;
+}
+
+static struct queued_tlp *
+enqueue_tlp()
+{
+	assert(queue_tail - queue_head < BENCH_QUEUE_LENGTH);
+	return &queue[queue_tail++ % BENCH_QUEUE_LENGTH];
+}
+
+/* The host answers a memory read with completions of at most 128 bytes. */
+static void
+complete_memory_read(struct RawTLP *request)
+{
+	struct tlp_class classified = tlp_classify(request->header);
+	struct TLP64RequestDWord1 *dword1 =
+		(struct TLP64RequestDWord1 *)(request->header + 1);
+	struct queued_tlp *completion;
+	uint64_t address;
+	uint16_t remaining, chunk;
+
+	if (tlp_fmt_is_4dw(classified.fmt)) {
+		address = ((uint64_t)request->header[2] << 32) | request->header[3];
+	} else {
+		address = request->header[2];
+	}
+	remaining = classified.length * sizeof(TLPDoubleWord);
+	while (remaining > 0) {
+		chunk = remaining < BENCH_COMPLETION_BYTES ?
+			remaining : BENCH_COMPLETION_BYTES;
+		completion = enqueue_tlp();
+		tlp_build_cpld(completion->header, BENCH_HOST_ID,
+			TLPCS_SUCCESSFUL_COMPLETION, remaining,
+			tlp_get_requester_id(dword1), dword1->tag, address,
+			chunk / sizeof(TLPDoubleWord));
+		completion->header_length = 12;
+		completion->data_length = chunk;
+		memcpy(completion->data, host_address(address, chunk), chunk);
+		address += chunk;
+		remaining -= chunk;
+	}
+}
+
+static void
+store_memory_write(struct RawTLP *request)
+{
+	uint64_t address;
+
+	if (tlp_fmt_is_4dw(tlp_classify(request->header).fmt)) {
+		address = ((uint64_t)request->header[2] << 32) | request->header[3];
+	} else {
+		address = request->header[2];
+	}
+	memcpy(host_address(address, request->data_length), request->data,
+		request->data_length);
+}
+
+static void
+queue_config_request(enum tlp_direction direction, uint16_t address,
+	uint32_t value)
+{
+	struct queued_tlp *request = enqueue_tlp();
+	struct RawTLP raw = { .header = request->header };
+
+	create_config_request_header(&raw, direction, BENCH_HOST_ID, 0, 0xF,
+		BENCH_DEVICE_ID, address);
+	request->header_length = raw.header_length;
+	request->data_length = raw.data_length;
+	request->data[0] = cpu_to_le32(value);
+}
+
+static void
+queue_memory_request(enum tlp_direction direction, uint32_t address,
+	uint32_t value)
+{
+	struct queued_tlp *request = enqueue_tlp();
+	struct RawTLP raw = { .header = request->header };
+
+	create_memory_request_header(&raw, direction, TLP_AT_UNTRANSLATED, 1,
+		BENCH_HOST_ID, 0, 0, 0xF, address);
+	request->header_length = raw.header_length;
+	request->data_length = raw.data_length;
+	request->data[0] = cpu_to_le32(value);
+}
+
+/* There is no builder for IO requests; they are laid out like CfgRd0. */
+static void
+queue_io_request(enum tlp_direction direction, uint32_t address,
+	uint32_t value)
+{
+	struct queued_tlp *request = enqueue_tlp();
+	struct TLP64DWord0 *dword0 = (struct TLP64DWord0 *)request->header;
+	struct TLP64RequestDWord1 *dword1 =
+		(struct TLP64RequestDWord1 *)(request->header + 1);
+
+	memset(request->header, 0, sizeof(request->header));
+	tlp_set_fmt(dword0, direction == TLPD_WRITE ? TLPFMT_3DW_DATA :
+		TLPFMT_3DW_NODATA);
+	tlp_set_type(dword0, IO);
+	tlp_set_length(dword0, 1);
+	tlp_set_requester_id(dword1, BENCH_HOST_ID);
+	tlp_set_firstbe(dword1, 0xF);
+	request->header[2] = address;
+	request->header_length = 12;
+	request->data_length = direction == TLPD_WRITE ? 4 : 0;
+	request->data[0] = value;
+}
+
+static void
+queue_script_request(enum bench_request request)
+{
+	switch (request) {
+	case BR_CONFIG_READ:
+		queue_config_request(TLPD_READ, PCI_VENDOR_ID, 0);
+		break;
+	case BR_CONFIG_WRITE:
+		queue_config_request(TLPD_WRITE, PCI_INTERRUPT_LINE, 0x0B);
+		break;
+	case BR_MEMORY_READ:
+		queue_memory_request(TLPD_READ, BENCH_MMIO_BASE + E1000_STATUS, 0);
+		break;
+	case BR_MEMORY_WRITE:
+		queue_memory_request(TLPD_WRITE, BENCH_MMIO_BASE + E1000_RDTR, 0);
+		break;
+	case BR_IO_WRITE:
+		queue_io_request(TLPD_WRITE, BENCH_IO_BASE + E1000_IOADDR,
+			E1000_STATUS);
+		break;
+	case BR_IO_READ:
+		queue_io_request(TLPD_READ, BENCH_IO_BASE + E1000_IODATA, 0);
+		break;
+	default:
+		assert(false);
+	}
+}
+
+static void
+print_results()
+{
+	FILE *output;
+	const struct bench_result *result;
+	double ns_per_operation, operations_per_second;
+
+	printf("%-36s %10s %12s %14s\n", "Benchmark", "Operations", "ns/op",
+		"ops/s");
+	for (result = results; result < results + result_count; ++result) {
+		printf("%-36s %10"PRIu64" %12.1f %14.0f\n", result->name,
+			result->operations, result->seconds * 1e9 / result->operations,
+			result->operations / result->seconds);
+	}
+	if (unexpected_completions > 0) {
+		printf("WARNING! %"PRIu64" requests were not completed "
+			"successfully.\n", unexpected_completions);
+	}
+
+	output = fopen(output_path, "w");
+	if (output == NULL) {
+		perror("Couldn't write benchmark results");
+		return;
+	}
+	fputs("{\n\t\"benchmarks\": [\n", output);
+	for (result = results; result < results + result_count; ++result) {
+		ns_per_operation = result->seconds * 1e9 / result->operations;
+		operations_per_second = result->operations / result->seconds;
+		fprintf(output, "\t\t{\"name\": \"%s\", \"operations\": %"PRIu64
+			", \"bytes_per_operation\": %"PRIu64", \"ns_per_op\": %.2f"
+			", \"ops_per_s\": %.0f}%s\n", result->name, result->operations,
+			result->bytes_per_operation, ns_per_operation,
+			operations_per_second,
+			result + 1 < results + result_count ? "," : "");
+	}
+	fprintf(output, "\t],\n\t\"unexpected_completions\": %"PRIu64"\n}\n",
+		unexpected_completions);
+	fclose(output);
+	printf("Wrote %s.\n", output_path);
+}
+
+static void
+bench_header_builders()
+{
+	TLPDoubleWord header[4];
+	struct RawTLP tlp = { .header = header };
+	struct timespec start;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < HEADER_ITERATIONS; ++i) {
+		create_memory_request_header(&tlp, TLPD_READ, TLP_AT_UNTRANSLATED,
+			128, BENCH_DEVICE_ID, i, 0xF, 0xF, (uint64_t)i << 12);
+		sink += header[0];
+	}
+	record_result("create_memory_request_header", HEADER_ITERATIONS, 0,
+		seconds_since(&start));
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < HEADER_ITERATIONS; ++i) {
+		create_completion_header(&tlp, TLPD_READ, BENCH_DEVICE_ID,
+			TLPCS_SUCCESSFUL_COMPLETION, 4, BENCH_HOST_ID, i, i, 1);
+		sink += header[1];
+	}
+	record_result("create_completion_header", HEADER_ITERATIONS, 0,
+		seconds_since(&start));
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < HEADER_ITERATIONS; ++i) {
+		create_config_request_header(&tlp, TLPD_READ, BENCH_HOST_ID, i, 0xF,
+			BENCH_DEVICE_ID, (i & 0x3FF) << 2);
+		sink += header[2];
+	}
+	record_result("create_config_request_header", HEADER_ITERATIONS, 0,
+		seconds_since(&start));
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < HEADER_ITERATIONS; ++i) {
+		tlp_build_mrd32(header, TLP_AT_UNTRANSLATED, 128, BENCH_DEVICE_ID, i,
+			0xF, 0xF, (uint32_t)i << 12);
+		sink += header[0];
+	}
+	record_result("tlp_build_mrd32", HEADER_ITERATIONS, 0,
+		seconds_since(&start));
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < HEADER_ITERATIONS; ++i) {
+		header[0] = (TLPDoubleWord)i << 22;
+		struct tlp_class classified = tlp_classify(header);
+		sink += classified.type + classified.direction + classified.length;
+	}
+	record_result("tlp_classify", HEADER_ITERATIONS, 0,
+		seconds_since(&start));
+}
+
+static void
+bench_dma()
+{
+	static uint8_t buffer[4096];
+	struct timespec start;
+	enum dma_read_response response = DRR_SUCCESS;
+	int i;
+
+	for (i = 0; i < BENCH_HOST_MEMORY_BYTES; ++i) {
+		host_memory[i] = i * 31;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < DMA_ITERATIONS && response == DRR_SUCCESS; ++i) {
+		response = perform_dma_read(buffer, 64, BENCH_DEVICE_ID, 8,
+			(i % 256) * 4096);
+	}
+	record_result("perform_dma_read 64 B", i, 64, seconds_since(&start));
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < DMA_ITERATIONS && response == DRR_SUCCESS; ++i) {
+		response = perform_dma_long_read(buffer, 4096, BENCH_DEVICE_ID, 8,
+			(i % 256) * 4096);
+	}
+	record_result("perform_dma_long_read 4 KiB", i, 4096,
+		seconds_since(&start));
+	if (response == DRR_SUCCESS && memcmp(buffer,
+			host_address(((i - 1) % 256) * 4096, 4096), 4096) != 0) {
+		printf("WARNING! A simulated DMA read returned the wrong data.\n");
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < DMA_ITERATIONS; ++i) {
+		perform_dma_write(buffer, 4096, BENCH_DEVICE_ID, 0,
+			(i % 256) * 4096);
+	}
+	record_result("perform_dma_write 4 KiB", i, 4096, seconds_since(&start));
+
+	if (response != DRR_SUCCESS) {
+		printf("WARNING! A simulated DMA read failed.\n");
+	}
+}
+
+static void
+bench_scanners()
+{
+	static uint8_t page[4096];
+	uint8_t frame[1514];
+	struct iovec iov[3] = {
+		{ .iov_base = frame, .iov_len = 14 },
+		{ .iov_base = frame + 14, .iov_len = 20 },
+		{ .iov_base = frame + 34, .iov_len = sizeof(frame) - 34 }
+	};
+	struct timespec start;
+	int i;
+
+	/* The run of secret characters is near the end, as a miss costs most. */
+	for (i = 0; i < sizeof(page); ++i) {
+		page[i] = (i * 31) | 1;
+	}
+	memset(page + 4000, 'B', 16);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < SCAN_ITERATIONS; ++i) {
+		sink += secret_position(page, 0, 'B', 16);
+	}
+	record_result("secret_position", SCAN_ITERATIONS, sizeof(page),
+		seconds_since(&start));
+
+	for (i = 0; i < sizeof(frame); ++i) {
+		frame[i] = i * 7;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < SCAN_ITERATIONS; ++i) {
+		sink += net_checksum_add_iov(iov, 3, 0, sizeof(frame), 0);
+	}
+	record_result("net_checksum_add_iov 1514 B", SCAN_ITERATIONS,
+		sizeof(frame), seconds_since(&start));
+}
+
+/*
+ * Called each time the main loop wants a TLP and the host has nothing
+ * queued: sends the next request of the script, timing each kind of request
+ * from its first to the request after its last.
+ */
+static void
+advance_script()
+{
+	if (setup_sent < sizeof(setup_writes) / sizeof(setup_writes[0])) {
+		queue_config_request(TLPD_WRITE, setup_writes[setup_sent].address,
+			setup_writes[setup_sent].value);
+		++setup_sent;
+		return;
+	}
+	if (script_iteration == DISPATCH_ITERATIONS) {
+		record_result(bench_request_names[script_request],
+			DISPATCH_ITERATIONS, 0, seconds_since(&script_start));
+		script_iteration = 0;
+		++script_request;
+	}
+	if (script_request == BR_COUNT) {
+		print_results();
+		exit(0);
+	}
+	if (script_iteration == 0) {
+		clock_gettime(CLOCK_MONOTONIC, &script_start);
+	}
+	queue_script_request(script_request);
+	++script_iteration;
+}
+
+void
+wait_for_tlp(TLPQuadWord *buffer, int buffer_len, struct RawTLP *out)
+{
+	struct queued_tlp *tlp;
+
+	if (queue_head == queue_tail) {
+		if (!dispatching) {
+			/* As if the link had timed out. */
+			set_raw_tlp_invalid(out);
+			return;
+		}
+		advance_script();
+	}
+	tlp = &queue[queue_head++ % BENCH_QUEUE_LENGTH];
+	assert(4 * sizeof(TLPDoubleWord) + tlp->data_length <= buffer_len);
+
+	/* Data starts on the quadword after the header, as aligned data does. */
+	out->header = (TLPDoubleWord *)buffer;
+	out->header_length = tlp->header_length;
+	memcpy(out->header, tlp->header, tlp->header_length);
+	out->data_length = tlp->data_length;
+	if (tlp->data_length > 0) {
+		out->data = out->header + 4;
+		memcpy(out->data, tlp->data, tlp->data_length);
+	} else {
+		out->data = NULL;
+	}
+}
+
+int
+send_tlp(struct RawTLP *tlp)
+{
+	struct tlp_class classified = tlp_classify(tlp->header);
+	struct TLP64CompletionDWord1 *dword1;
+
+	count_tlp(TMD_SENT, tlp);
+	switch (classified.type) {
+	case M:
+		if (tlp_fmt_has_data(classified.fmt)) {
+			store_memory_write(tlp);
+		} else {
+			complete_memory_read(tlp);
+		}
+		break;
+	case CPL:
+		dword1 = (struct TLP64CompletionDWord1 *)(tlp->header + 1);
+		if (tlp_get_status(dword1) != TLPCS_SUCCESSFUL_COMPLETION) {
+			++unexpected_completions;
+		}
+		break;
+	default:
+		break;
+	}
+	return 0;
+}
+
+/* Nanoseconds. */
+unsigned long
+read_hw_counter()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+void
+drain_pcie_core()
+{
+}
+
+void
+close_connections()
+{
+}
+
+int
+pcie_hardware_init(int argc, char **argv, volatile uint8_t **physmem)
+{
+	if (argc > 2) {
+		printf("Usage: %s [RESULTS_FILE]\n", argv[0]);
+		return 1;
+	}
+	if (argc == 2) {
+		output_path = argv[1];
+	}
+	*physmem = NULL;
+
+	puts("Timing the header builders, DMA paths and scanners.");
+	bench_header_builders();
+	bench_dma();
+	bench_scanners();
+	puts("Timing request dispatch through the NIC model.");
+	dispatching = true;
+	return 0;
+}
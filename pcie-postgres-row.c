@@ -0,0 +1,268 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * Copyright (c) 2015-2018 Colin Rothwell
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "pcie-postgres-row.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "libpq-fe.h"
+
+#include "qemu/bswap.h"
+
+struct label {
+	const char *text;
+	int value;
+};
+
+static const struct label tlp_type_labels[] = {
+	{ "CfgRd0", TT_CFG_RD_0 },
+	{ "CfgWr0", TT_CFG_WR_0 },
+	{ "Cpl", TT_CPL },
+	{ "CplD", TT_CPL_D },
+	{ "IORd", TT_IO_RD },
+	{ "IOWr", TT_IO_WR },
+	{ "MRd(32)", TT_M_RD_32 },
+	{ "MWr(32)", TT_M_WR_32 },
+	{ "Msg", TT_MSG },
+	{ "MsgD", TT_MSG_D }
+};
+
+static const struct label msg_routing_labels[] = {
+	{ "Broadcast", BROADCAST },
+	{ "Local", LOCAL }
+};
+
+static const struct label message_code_labels[] = {
+	{ "Set_Slot_Power_Limit", SET_SLOT_POWER_LIMIT },
+	{ "Vendor_Defined_Type1", VENDOR_DEFINED_TYPE_1 },
+	{ "PME_Turn_Off", PME_TURN_OFF }
+};
+
+static const struct label cpl_status_labels[] = {
+	{ "SC", TCS_SC },
+	{ "UR", TCS_UR }
+};
+
+#define LABEL_TABLE_SLOTS		32 /* Power of two */
+#define LABEL_TABLE_MAX_SEED	(1 << 16)
+
+/*
+ * A perfect hash table: the seed is chosen so that every label of the column
+ * lands in its own slot, so a lookup hashes the value and compares it
+ * against a single candidate.
+ */
+struct label_table {
+	const char *column;
+	bool nullable; /* NULL decodes as 0, rather than as an error. */
+	uint32_t seed;
+	struct {
+		const char *text;
+		int length;
+		int value;
+	} slots[LABEL_TABLE_SLOTS];
+};
+
+static struct label_table tlp_type_table = { "tlp_type", false };
+static struct label_table msg_routing_table = { "msg_routing", true };
+static struct label_table message_code_table = { "message_code", true };
+static struct label_table cpl_status_table = { "cpl_status", true };
+
+/* FNV-1a, with the seed folded into the offset basis. */
+static inline uint32_t
+label_hash(const char *text, int length, uint32_t seed)
+{
+	uint32_t hash = 2166136261u ^ seed;
+	for (int i = 0; i < length; ++i) {
+		hash ^= (uint8_t)text[i];
+		hash *= 16777619u;
+	}
+	return (hash ^ (hash >> 16)) % LABEL_TABLE_SLOTS;
+}
+
+static bool
+build_label_table(struct label_table *table, const struct label *labels,
+	int label_count)
+{
+	int i, length;
+	uint32_t slot;
+
+	for (table->seed = 0; table->seed < LABEL_TABLE_MAX_SEED; ++table->seed) {
+		memset(table->slots, 0, sizeof(table->slots));
+		for (i = 0; i < label_count; ++i) {
+			length = strlen(labels[i].text);
+			slot = label_hash(labels[i].text, length, table->seed);
+			if (table->slots[slot].text != NULL) {
+				break;
+			}
+			table->slots[slot].text = labels[i].text;
+			table->slots[slot].length = length;
+			table->slots[slot].value = labels[i].value;
+		}
+		if (i == label_count) {
+			return true;
+		}
+	}
+	printf("Couldn't find a perfect hash for %s labels.\n", table->column);
+	return false;
+}
+
+#define BUILD_LABEL_TABLE(name)												\
+	build_label_table(&name##_table, name##_labels,							\
+		sizeof(name##_labels) / sizeof(name##_labels[0]))
+
+bool
+postgres_row_decoder_init()
+{
+	return BUILD_LABEL_TABLE(tlp_type) &&
+		BUILD_LABEL_TABLE(msg_routing) &&
+		BUILD_LABEL_TABLE(message_code) &&
+		BUILD_LABEL_TABLE(cpl_status);
+}
+
+#undef BUILD_LABEL_TABLE
+
+static int
+get_postgres_label(const PGresult *result, int tuple, int column,
+	const struct label_table *table)
+{
+	if (PQgetisnull(result, tuple, column)) {
+		if (table->nullable) {
+			return 0;
+		}
+		printf("Unexpected NULL %s.\n", table->column);
+		assert(false);
+		return -1;
+	}
+	/* Binary enum and text values are the bare label, without a NUL. */
+	const char *text = PQgetvalue(result, tuple, column);
+	int length = PQgetlength(result, tuple, column);
+	uint32_t slot = label_hash(text, length, table->seed);
+	if (table->slots[slot].text != NULL &&
+		table->slots[slot].length == length &&
+		memcmp(table->slots[slot].text, text, length) == 0) {
+		return table->slots[slot].value;
+	}
+	printf("Unknown %s: '%.*s'\n", table->column, length, text);
+	assert(false);
+	return -1;
+}
+
+static inline uint32_t
+get_postgres_int(const PGresult *result, int tuple, int column)
+{
+	if (PQgetisnull(result, tuple, column)) {
+		return 0;
+	}
+	return bswap32(*(uint32_t *)PQgetvalue(result, tuple, column));
+}
+
+static inline uint64_t
+get_postgres_bigint(const PGresult *result, int tuple, int column)
+{
+	if (PQgetisnull(result, tuple, column)) {
+		return 0;
+	}
+	return bswap64(*(uint64_t *)PQgetvalue(result, tuple, column));
+}
+
+#define RESOLVE_COLUMN(field, name)	do {									\
+	columns->field = PQfnumber(result, name);								\
+	if (columns->field < 0) {												\
+		printf("Trace result has no %s column.\n", name);					\
+		return false;														\
+	}																		\
+} while (0)
+
+bool
+postgres_trace_columns_resolve(const PGresult *result,
+	struct postgres_trace_columns *columns)
+{
+	RESOLVE_COLUMN(pk, "pk");
+	RESOLVE_COLUMN(packet, "packet");
+	RESOLVE_COLUMN(tlp_type, "tlp_type");
+	RESOLVE_COLUMN(msg_routing, "msg_routing");
+	RESOLVE_COLUMN(message_code, "message_code");
+	RESOLVE_COLUMN(cpl_status, "cpl_status");
+	RESOLVE_COLUMN(length, "length");
+	RESOLVE_COLUMN(requester_id, "requester_id");
+	RESOLVE_COLUMN(completer_id, "completer_id");
+	RESOLVE_COLUMN(device_id, "device_id");
+	RESOLVE_COLUMN(reg, "register");
+	RESOLVE_COLUMN(byte_cnt, "byte_cnt");
+	RESOLVE_COLUMN(tag, "tag");
+	RESOLVE_COLUMN(first_be, "first_be");
+	RESOLVE_COLUMN(last_be, "last_be");
+	RESOLVE_COLUMN(bcm, "bcm");
+	RESOLVE_COLUMN(lwr_addr, "lwr_addr");
+	RESOLVE_COLUMN(address, "address");
+	RESOLVE_COLUMN(data, "data");
+	return true;
+}
+
+#undef RESOLVE_COLUMN
+
+void
+trace_row_from_postgres(const PGresult *result,
+	const struct postgres_trace_columns *columns, int tuple,
+	struct trace_row *row)
+{
+	memset(row, 0, sizeof(*row));
+	row->pk = get_postgres_int(result, tuple, columns->pk);
+	row->packet = get_postgres_int(result, tuple, columns->packet);
+	row->tlp_type = get_postgres_label(result, tuple, columns->tlp_type,
+		&tlp_type_table);
+	row->msg_routing = get_postgres_label(result, tuple, columns->msg_routing,
+		&msg_routing_table);
+	row->message_code = get_postgres_label(result, tuple,
+		columns->message_code, &message_code_table);
+	row->cpl_status = get_postgres_label(result, tuple, columns->cpl_status,
+		&cpl_status_table);
+	row->length = get_postgres_int(result, tuple, columns->length);
+	row->requester_id = get_postgres_int(result, tuple, columns->requester_id);
+	row->completer_id = get_postgres_int(result, tuple, columns->completer_id);
+	row->device_id = get_postgres_int(result, tuple, columns->device_id);
+	row->reg = get_postgres_int(result, tuple, columns->reg);
+	row->byte_cnt = get_postgres_int(result, tuple, columns->byte_cnt);
+	row->tag = get_postgres_int(result, tuple, columns->tag);
+	row->first_be = get_postgres_int(result, tuple, columns->first_be);
+	row->last_be = get_postgres_int(result, tuple, columns->last_be);
+	row->bcm = get_postgres_int(result, tuple, columns->bcm);
+	row->lwr_addr = get_postgres_int(result, tuple, columns->lwr_addr);
+	row->address = get_postgres_bigint(result, tuple, columns->address);
+	row->data = get_postgres_bigint(result, tuple, columns->data);
+}
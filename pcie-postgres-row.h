@@ -0,0 +1,89 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * Copyright (c) 2015-2018 Colin Rothwell
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef PCIE_POSTGRES_ROW_H
+#define PCIE_POSTGRES_ROW_H
+
+#include <stdbool.h>
+
+#include "libpq-fe.h"
+
+#include "pcie-replay.h"
+
+/*
+ * Decodes binary rows of the qemu_trace table into struct trace_row. Column
+ * numbers are looked up once per result set, and the enumerated text columns
+ * are decoded through perfect hash tables built by
+ * postgres_row_decoder_init, so decoding a row does no name lookups and no
+ * string comparisons beyond confirming the one candidate label.
+ */
+
+struct postgres_trace_columns {
+	int pk;
+	int packet;
+	int tlp_type;
+	int msg_routing;
+	int message_code;
+	int cpl_status;
+	int length;
+	int requester_id;
+	int completer_id;
+	int device_id;
+	int reg;
+	int byte_cnt;
+	int tag;
+	int first_be;
+	int last_be;
+	int bcm;
+	int lwr_addr;
+	int address;
+	int data;
+};
+
+/* Builds the label tables. Call once, before decoding anything. */
+bool
+postgres_row_decoder_init();
+
+/* Returns false, after naming the column, if the result lacks a column. */
+bool
+postgres_trace_columns_resolve(const PGresult *result,
+	struct postgres_trace_columns *columns);
+
+void
+trace_row_from_postgres(const PGresult *result,
+	const struct postgres_trace_columns *columns, int tuple,
+	struct trace_row *row);
+
+#endif
@@ -35,750 +35,230 @@
 
 #include "pcie-backend.h"
 
+#include <pthread.h>
 #include <stdint.h>
 #include <stdio.h>
-#include <execinfo.h>
-#include <signal.h>
 #include <stdlib.h>
-
-
-#include "qom/object.h"
-#include "hw/pci/pci.h"
-#include "hw/pci/pci_bus.h"
-#include "hw/i386/pc.h"
-#include "hw/pci-host/q35.h"
-#include "qapi/qmp/qerror.h"
-#include "qemu/config-file.h"
+#include <string.h>
 
 #include "libpq-fe.h"
 
+#include "qemu/osdep.h"
+
 #include "pcie.h"
+#include "pcie-replay.h"
+#include "pcie-postgres-row.h"
 #include "mask.h"
 #include "pcie-debug.h"
 
-static bool mask_next_completion_data = false;
-static TLPDoubleWord completion_data_mask;
-
-static inline
-void set_next_completion_data_mask(TLPDoubleWord mask)
-{
-	return; /* XXX: CORRECT THIS! */
-	mask_next_completion_data = true;
-	completion_data_mask = mask;
-}
-
 static PGconn *postgres_connection_downstream;
 static PGconn *postgres_connection_upstream;
 
 #define PG_REPR_TEXTUAL		0
 #define PG_REPR_BINARY		1
 
-unsigned long
-read_hw_counter()
-{
-	return 0;
-}
-
-void
-print_backtrace(int signum)
-{
-	void *addrlist[32];
-	size_t size;
-	char **backtrace_lines;
-	
-	size = backtrace(addrlist, 32);
-	backtrace_lines = backtrace_symbols(addrlist, 32);
-
-	for (size_t i = 0; i < size; ++i) {
-		DEBUG_PRINTF("%s\n", backtrace_lines[i]);
-	}
-	
-	free(backtrace_lines);
-}
-
-
-
-DeviceClass
-*qdev_get_device_class(const char **driver, Error **errp)
-{
-    ObjectClass *oc;
-    DeviceClass *dc;
-
-    oc = object_class_by_name(*driver);
-
-    if (!object_class_dynamic_cast(oc, TYPE_DEVICE)) {
-        error_setg(errp, "'%s' is not a valid device model name", *driver);
-        return NULL;
-    }
-
-    if (object_class_is_abstract(oc)) {
-        error_set(errp, QERR_INVALID_PARAMETER_VALUE, "driver",
-                   "non-abstract device type");
-        return NULL;
-    }
-
-    dc = DEVICE_CLASS(oc);
-    if (dc->cannot_instantiate_with_device_add_yet ||
-        (qdev_hotplug && !dc->hotpluggable)) {
-        error_set(errp, QERR_INVALID_PARAMETER_VALUE, "driver",
-                   "pluggable device type");
-        return NULL;
-    }
-
-    return dc;
-}
+/*
+ * Each direction of the trace is read through a server-side cursor by its own
+ * thread, FETCH_BATCH_ROWS rows per round trip. The thread decodes the rows
+ * into a bounded queue, so the device model only waits on libpq when it gets
+ * ahead of the prefetcher.
+ */
 
-enum postgres_tlp_type {
-	PG_CFG_RD_0,
-	PG_CFG_WR_0,
-	PG_CPL,
-	PG_CPL_D,
-	PG_IO_RD,
-	PG_IO_WR,
-	PG_M_RD_32,
-	PG_M_WR_32,
-	PG_MSG,
-	PG_MSG_D
+#define FETCH_BATCH_ROWS	1024
+#define PREFETCH_QUEUE_ROWS	4096 /* Power of two */
+
+struct row_prefetcher {
+	PGconn *connection;
+	const char *direction;
+	pthread_t thread;
+	bool running;
+	pthread_mutex_t lock;
+	pthread_cond_t not_empty;
+	pthread_cond_t not_full;
+	/* Protected by lock. */
+	uint32_t head; /* Next row to hand out */
+	uint32_t tail; /* Next free slot */
+	bool finished;
+	bool stopping;
+	struct trace_row queue[PREFETCH_QUEUE_ROWS];
+	/* Only touched by the consuming thread. */
+	struct trace_row current;
 };
 
-static enum postgres_tlp_type
-get_postgres_tlp_type(const PGresult *result)
-{
-	int tlp_type_field_num = PQfnumber(result, "tlp_type");
-	const char * const field_text = PQgetvalue(result, 0, tlp_type_field_num);
-	if (strcmp(field_text, "CfgRd0") == 0) {
-		return PG_CFG_RD_0;
-	} else if (strcmp(field_text, "CfgWr0") == 0) {
-		return PG_CFG_WR_0;
-	} else if (strcmp(field_text, "Cpl") == 0) {
-		return PG_CPL;
-	} else if (strcmp(field_text, "CplD") == 0) {
-		return PG_CPL_D;
-	} else if (strcmp(field_text, "IORd") == 0) {
-		return PG_IO_RD;
-	} else if (strcmp(field_text, "IOWr") == 0) {
-		return PG_IO_WR;
-	} else if (strcmp(field_text, "MRd(32)") == 0) {
-		return PG_M_RD_32;
-	} else if (strcmp(field_text, "MWr(32)") == 0) {
-		return PG_M_WR_32;
-	} else if (strcmp(field_text, "Msg") == 0) {
-		return PG_MSG;
-	} else if (strcmp(field_text, "MsgD") == 0) {
-		return PG_MSG_D;
-	} else {
-		printf("Unknown tlp_type: '%s'\n", field_text);
-		assert(false);
-		return -1;
-	}
-}
-
-enum postgres_msg_routing { BROADCAST = 3, LOCAL = 4 };
+static struct row_prefetcher downstream_prefetcher;
+static struct row_prefetcher upstream_prefetcher;
 
-static enum postgres_msg_routing
-get_postgres_msg_routing(const PGresult *result)
+static bool
+execute_command(PGconn *connection, const char *command)
 {
-	int msg_routing_field_num = PQfnumber(result, "msg_routing");
-	const char * const field_text =
-		PQgetvalue(result, 0, msg_routing_field_num);
-	if (strcmp(field_text, "Broadcast") == 0) {
-		return BROADCAST;
-	} else if (strcmp(field_text, "Local") == 0) {
-		return LOCAL;
-	} else {
-		PDBG("Invalid msg_routing type: '%s'", field_text);
-		assert(false);
-		return -1;
-	}
-}
-
-enum postgres_message_code {
-	PME_TURN_OFF = 0x19,
-	SET_SLOT_POWER_LIMIT = 0x50,
-	VENDOR_DEFINED_TYPE_1 = 0x7F
-};
-
-static enum postgres_message_code
-get_postgres_message_code(const PGresult *result)
-{
-	int message_code_field_num = PQfnumber(result, "message_code");
-	const char * const field_text =
-		PQgetvalue(result, 0, message_code_field_num);
-	if (strcmp(field_text, "Set_Slot_Power_Limit") == 0) {
-		return SET_SLOT_POWER_LIMIT;
-	} else if (strcmp(field_text, "Vendor_Defined_Type1") == 0) {
-		return VENDOR_DEFINED_TYPE_1;
-	} else if (strcmp(field_text, "PME_Turn_Off") == 0) {
-		return PME_TURN_OFF;
-	} else {
-		printf("Unrecognised message code: '%s'\n.", field_text);
-		assert(false);
-		return -1;
+	PGresult *result = PQexec(connection, command);
+	bool success = PQresultStatus(result) == PGRES_COMMAND_OK;
+	if (!success) {
+		printf("Error running '%s': %s", command,
+			PQerrorMessage(connection));
 	}
+	PQclear(result);
+	return success;
 }
 
-enum postgres_cpl_status { PG_SC = 0x0, PG_UR = 0x1 };
-
-static enum postgres_cpl_status
-get_postgres_cpl_status(const PGresult *result)
+/* Blocks while the queue is full. Returns false if replay is stopping or the
+ * result isn't a trace. */
+static bool
+push_rows(struct row_prefetcher *prefetcher, const PGresult *result)
 {
-	int cpl_status_field_num = PQfnumber(result, "cpl_status");
-	const char * const field_text =
-		PQgetvalue(result, 0, cpl_status_field_num);
-	if (strcmp(field_text, "SC") == 0) {
-		return PG_SC;
-	} else if (strcmp(field_text, "UR") == 0) {
-		return PG_UR;
-	} else {
-		PDBG("ERROR! Invalid cpl_status: '%s'\n", field_text);
-		assert(false);
-		return -1;
-	}
-}
-
-#define		POSTGRES_INT_FIELD(FIELD_NAME)									\
-	static inline uint32_t													\
-	get_postgres_##FIELD_NAME(const PGresult *result)						\
-	{																		\
-		int field_num = PQfnumber(result, #FIELD_NAME);						\
-		return bswap32(*(uint32_t *)PQgetvalue(result, 0, field_num));		\
-	}
+	int tuple = 0, tuple_count = PQntuples(result);
+	uint32_t space, batch_end;
+	struct postgres_trace_columns columns;
 
-POSTGRES_INT_FIELD(pk);
-POSTGRES_INT_FIELD(packet);
-POSTGRES_INT_FIELD(length);
-POSTGRES_INT_FIELD(requester_id);
-POSTGRES_INT_FIELD(tag);
-POSTGRES_INT_FIELD(completer_id);
-POSTGRES_INT_FIELD(device_id);
-POSTGRES_INT_FIELD(register);
-POSTGRES_INT_FIELD(first_be);
-POSTGRES_INT_FIELD(last_be);
-POSTGRES_INT_FIELD(byte_cnt);
-POSTGRES_INT_FIELD(bcm);
-POSTGRES_INT_FIELD(lwr_addr);
-
-#define		POSTGRES_BIGINT_FIELD(FIELD_NAME)								\
-	static inline uint64_t													\
-	get_postgres_##FIELD_NAME(const PGresult *result)						\
-	{																		\
-		int field_num = PQfnumber(result, #FIELD_NAME);						\
-		return bswap64(*(uint64_t *)PQgetvalue(result, 0, field_num));		\
+	if (!postgres_trace_columns_resolve(result, &columns)) {
+		return false;
 	}
 
-POSTGRES_BIGINT_FIELD(address);
-POSTGRES_BIGINT_FIELD(data);
-
-/* Generates a TLP given a PGresult that has as row 0 a record from the trace
- * table. Returns the length of the TLP in bytes. */
-/* TLPDoubleWord is a more natural way to manipulate the TLP Data */
-static void
-tlp_from_postgres(PGresult *result, TLPQuadWord *buffer, int buffer_len,
-	struct RawTLP *out)
-{
-	/* Strictly, this should probably all be done with a massive union. */
-	struct TLP64DWord0 *header0 = (struct TLP64DWord0 *)buffer;
-
-	struct TLP64MessageRequestDWord1 *message_req =
-		(struct TLP64MessageRequestDWord1 *)(header0 + 1);
-
-	struct TLP64RequestDWord1 *header_req =
-		(struct TLP64RequestDWord1 *)(header0 + 1);
-
-	struct TLP64CompletionDWord1 *compl_dword1 =
-		(struct TLP64CompletionDWord1 *)(header0 + 1);
-
-	TLPDoubleWord *dword2 = (((TLPDoubleWord *)buffer) + 2);
-
-	struct TLP64ConfigRequestDWord2 *config_dword2 =
-		(struct TLP64ConfigRequestDWord2 *)(dword2);
-
-	struct TLP64CompletionDWord2 *compl_dword2 =
-		(struct TLP64CompletionDWord2 *)(dword2);
-
-	TLPDoubleWord *dword3 = dword2 + 1;
-	TLPDoubleWord *dword4 = dword3 + 1;
-
-	header0->tc = 0; // Assume traffic class best effort
-	header0->th = 0; // Assume no traffic processing hints.
-	header0->td = 0; // Assume no TLP digest
-	header0->ep = 0; // Assume TLP is not poisoned, as you do.
-	header0->length = get_postgres_length(result);
-
-	int data_length = 0;
-	int length = -1;
-	enum postgres_tlp_type tlp_type = get_postgres_tlp_type(result);
-
-	/* This is up here so we can get data alignment correct in results. */
-	uint32_t reg = get_postgres_register(result);
-
-#ifdef PRINT_IDS
-	DEBUG_PRINTF("%d.\n", get_postgres_packet(result));
-#endif
-	switch (tlp_type) {
-	case PG_CFG_RD_0:
-	case PG_CFG_WR_0:
-		if (tlp_type == PG_CFG_RD_0) {
-			/*DEBUG_PRINTF("CfgRd0 TLP");*/
-			header0->fmt = TLPFMT_3DW_NODATA;
-		} else {
-			/*DEBUG_PRINTF("CfgWr0 TLP");*/
-			header0->fmt = TLPFMT_3DW_DATA;
-			data_length = 4;
+	pthread_mutex_lock(&prefetcher->lock);
+	while (tuple < tuple_count) {
+		space = PREFETCH_QUEUE_ROWS - (prefetcher->tail - prefetcher->head);
+		while (space == 0 && !prefetcher->stopping) {
+			pthread_cond_wait(&prefetcher->not_full, &prefetcher->lock);
+			space = PREFETCH_QUEUE_ROWS -
+				(prefetcher->tail - prefetcher->head);
 		}
-		header0->type = CFG_0;
-		header_req->requester_id = get_postgres_requester_id(result);
-		header_req->tag = get_postgres_tag(result);
-		header_req->lastbe = get_postgres_last_be(result);
-		header_req->firstbe = get_postgres_first_be(result);
-		assert(PQntuples(result) == 1);
-		config_dword2->device_id = get_postgres_device_id(result);
-		config_dword2->ext_reg_num = reg >> 8;
-		config_dword2->reg_num = (reg & uint32_mask(8));
-		length = 12;
-		break;
-	case PG_CPL:
-	case PG_CPL_D:
-		if (tlp_type == PG_CPL) {
-			header0->fmt = TLPFMT_3DW_NODATA;
-			data_length = 0;
-		} else {
-			header0->fmt = TLPFMT_3DW_DATA;
-			data_length = get_postgres_length(result) * 4;
-		}
-		header0->type = CPL;
-		compl_dword1->completer_id = get_postgres_completer_id(result);
-		compl_dword1->status = get_postgres_cpl_status(result);
-		compl_dword1->bcm = get_postgres_bcm(result);
-		compl_dword1->bytecount = get_postgres_byte_cnt(result);
-		compl_dword2->requester_id = get_postgres_requester_id(result);
-		compl_dword2->tag = get_postgres_tag(result);
-		compl_dword2->loweraddress = get_postgres_lwr_addr(result);
-		length = (12 + data_length);
-		break;
-	case PG_IO_RD:
-	case PG_IO_WR:
-		if (tlp_type == PG_IO_RD) {
-			header0->fmt = TLPFMT_3DW_NODATA;
-			data_length = 0;
-		} else {
-			header0->fmt = TLPFMT_3DW_DATA;
-			data_length = 4;
-		}
-		header0->type = IO;
-		header_req->requester_id = get_postgres_requester_id(result);
-		header_req->tag = get_postgres_tag(result);
-		header_req->lastbe = 0;
-		header_req->firstbe = get_postgres_first_be(result);
-		*dword2 = (TLPDoubleWord)(get_postgres_address(result));
-		length = (12 + data_length);
-		break;
-	case PG_MSG:
-	case PG_MSG_D:
-		/*DEBUG_PRINTF("MsgD TLP");*/
-		header0->fmt = TLPFMT_4DW_DATA;
-		header0->type = ((1 << 4) | get_postgres_msg_routing(result));
-		message_req->requester_id = get_postgres_requester_id(result);
-		message_req->tag = get_postgres_tag(result);
-		message_req->message_code = get_postgres_message_code(result);
-
-		if (message_req->message_code == SET_SLOT_POWER_LIMIT) {
-			buffer[2] = 0;
-			buffer[3] = 0;
-			buffer[4] = get_postgres_data(result);
-			length = (5 * 8);
+		if (prefetcher->stopping) {
+			break;
 		}
-
-		break;
-	case PG_M_RD_32:
-	case PG_M_WR_32:
-		if (tlp_type == PG_M_RD_32) {
-			header0->fmt = TLPFMT_3DW_NODATA;
-			data_length = 0;
-		} else {
-			header0->fmt = TLPFMT_3DW_DATA;
-			data_length = 4;
+		/* The consumer only reads below tail, so decode without the lock. */
+		pthread_mutex_unlock(&prefetcher->lock);
+		batch_end = prefetcher->tail + MIN(space, tuple_count - tuple);
+		for (uint32_t slot = prefetcher->tail; slot != batch_end; ++slot) {
+			trace_row_from_postgres(result, &columns, tuple++,
+				&prefetcher->queue[slot % PREFETCH_QUEUE_ROWS]);
 		}
-		header0->type = M;
-		header_req->requester_id = get_postgres_requester_id(result);
-		header_req->tag = get_postgres_tag(result);
-		header_req->lastbe = get_postgres_last_be(result);
-		header_req->firstbe = get_postgres_first_be(result);
-		*dword2 = get_postgres_address(result);
-		length = 12 + data_length;
-		break;
-	default:
-		PDBG("ERROR! Unknown TLP type: %s",
-			PQgetvalue(result, 0, PQfnumber(result, "tlp_type")));
-		assert(false);
+		pthread_mutex_lock(&prefetcher->lock);
+		prefetcher->tail = batch_end;
+		pthread_cond_signal(&prefetcher->not_empty);
 	}
+	bool stopping = prefetcher->stopping;
+	pthread_mutex_unlock(&prefetcher->lock);
+	return !stopping;
+}
 
-	/*DEBUG_PRINTF(" (packet %d)\n", get_postgres_packet(result));*/
-
-	int i;
-
-	if (tlp_fmt_is_4dw(header0->fmt)) {
-		out->header_length = 16;
-	} else {
-		out->header_length = 12;
-	}
-
-	out->header = (TLPDoubleWord *)buffer;
-
-	if (data_length > 0) {
-		uint64_t data = get_postgres_data(result);
-		TLPDoubleWord *data_dword = (TLPDoubleWord *)&data;
-		if (tlp_type == PG_CFG_WR_0 && (reg % 8 == 0)) {
-			out->data = dword4;
+static void *
+prefetch_rows(void *opaque)
+{
+	struct row_prefetcher *prefetcher = opaque;
+	PGresult *result;
+	char fetch[64];
+	bool more = true;
+
+	snprintf(fetch, sizeof(fetch), "FETCH %d FROM trace_cursor",
+		FETCH_BATCH_ROWS);
+	while (more) {
+		result = PQexecParams(prefetcher->connection, fetch, 0, NULL, NULL,
+			NULL, NULL, PG_REPR_BINARY);
+		if (PQresultStatus(result) != PGRES_TUPLES_OK) {
+			printf("Error fetching %s packets: %s", prefetcher->direction,
+				PQerrorMessage(prefetcher->connection));
+			more = false;
 		} else {
-			out->data = dword3;
-		}
-		for (i = 0; i < (data_length / sizeof(TLPDoubleWord)); ++i) {
-			out->data[i] = data_dword[i];
+			more = PQntuples(result) > 0 && push_rows(prefetcher, result);
 		}
+		PQclear(result);
 	}
-	out->data_length = data_length;
-}
-
-/* We also use this to intercept BAR settings so that we don't send memory
- * read requests we don't have adequate responses to. */
-
-#define IGNORE_REGION_COUNT				4
 
-#define SECOND_CARD_REGION_MEM_INDEX	0
-#define SECOND_CARD_REGION_IO_INDEX		1
-#define SECOND_CARD_REGION_ROM_INDEX	2
-#define FIRST_CARD_REGION_ROM_INDEX		3
-
-static int32_t io_region =  -1;
-static int32_t ignore_regions[IGNORE_REGION_COUNT] = {-1, -1, -1, -1};
-static int32_t ignore_region_mask[IGNORE_REGION_COUNT] = {
-	MASK_ENABLE_BITS(uint32_t, 31, 17),
-	MASK_ENABLE_BITS(uint32_t, 31, 5),
-	MASK_ENABLE_BITS(uint32_t, 31, 17),
-	MASK_ENABLE_BITS(uint32_t, 31, 17)
-};
-
-static int32_t skip_sending = 0;
-
-static inline bool
-tlp_expects_response(PGresult *result)
-{
-	enum postgres_tlp_type type = get_postgres_tlp_type(result);
-	return type != PG_M_WR_32 && type != PG_MSG && type != PG_MSG_D;
+	pthread_mutex_lock(&prefetcher->lock);
+	prefetcher->finished = true;
+	pthread_cond_signal(&prefetcher->not_empty);
+	pthread_mutex_unlock(&prefetcher->lock);
+	return NULL;
 }
 
-static inline bool
-should_receive_tlp_for_result(PGresult *result)
+static int
+start_prefetcher(struct row_prefetcher *prefetcher, PGconn *connection,
+	const char *direction)
 {
-	if (PQntuples(result) < 1) {
-		return false;
-	}
-	bool skip = false;
-	enum postgres_tlp_type type = get_postgres_tlp_type(result);
-	uint32_t packet = get_postgres_packet(result);
-	uint32_t device_id = get_postgres_device_id(result);
-	uint64_t address = get_postgres_address(result);
-	uint32_t region = bswap32(get_postgres_data(result));
-	if (type == PG_CFG_WR_0) {
-		if (device_id == 256) {
-			if (get_postgres_register(result) == 0x30) {
-				ignore_regions[FIRST_CARD_REGION_ROM_INDEX] = region;
-			}
-		} else if (device_id == 257) {
-			switch(get_postgres_register(result)) {
-			case 0x10:
-				ignore_regions[SECOND_CARD_REGION_MEM_INDEX] = region;
-				break;
-			case 0x18:
-				ignore_regions[SECOND_CARD_REGION_IO_INDEX] = region;
-				break;
-			case 0x30:
-				ignore_regions[SECOND_CARD_REGION_ROM_INDEX] = region;
-				break;
-			}
-		/*PDBG("!!! Setting second card region: 0x%x", second_card_region);*/
-		}
-	}
-
-	bool skip_due_to_this_region = false;
-	for (int i = 0; i < IGNORE_REGION_COUNT; ++i) {
-		uint32_t mask = ignore_region_mask[i];
-		skip_due_to_this_region = (
-			ignore_regions[i] != -1 && address != 0 &&
-			(address & mask) == (ignore_regions[i] & mask));
-		if (skip_due_to_this_region) {
-			PDBG("%d: Skipping due to region %d", packet, i);
-		}
-		skip = skip || skip_due_to_this_region;
-		skip_due_to_this_region = false;
-	}
-
-	if (device_id == 257 || (
-			type == PG_MSG &&
-			get_postgres_message_code(result) == PME_TURN_OFF)) {
-		skip = true;
+	char declare[256];
+
+	prefetcher->connection = connection;
+	prefetcher->direction = direction;
+	snprintf(declare, sizeof(declare),
+		"DECLARE trace_cursor NO SCROLL BINARY CURSOR FOR "
+		"SELECT * FROM qemu_trace WHERE link_dir = '%s' "
+		"ORDER BY packet ASC", direction);
+	/* Cursors only live as long as their transaction. */
+	if (!execute_command(connection, "BEGIN READ ONLY") ||
+		!execute_command(connection, declare)) {
+		return 3;
 	}
 
-	if (skip && tlp_expects_response(result)) {
-		++skip_sending;
-		assert(skip_sending >= 0);
+	pthread_mutex_init(&prefetcher->lock, NULL);
+	pthread_cond_init(&prefetcher->not_empty, NULL);
+	pthread_cond_init(&prefetcher->not_full, NULL);
+	if (pthread_create(&prefetcher->thread, NULL, prefetch_rows,
+			prefetcher) != 0) {
+		printf("Couldn't start the %s prefetcher.\n", direction);
+		return 4;
 	}
-
-	return !skip;
+	prefetcher->running = true;
+	return 0;
 }
 
-#define		ID_BUFFER_SIZE		8
-static uint32_t last_recvd_ids[ID_BUFFER_SIZE];
-static int recvd_count = 0;
-
-static uint32_t last_sent_ids[ID_BUFFER_SIZE];
-static int sent_count = 0;
-
 static void
-print_circular_uint_buffer(uint32_t *buffer, int count, int buffer_size)
+stop_prefetcher(struct row_prefetcher *prefetcher)
 {
-	for (int i = (count - buffer_size); i < count; ++i) {
-		DEBUG_PRINTF("%d\n", buffer[(i % buffer_size)]);
+	if (!prefetcher->running) {
+		return;
 	}
+	pthread_mutex_lock(&prefetcher->lock);
+	prefetcher->stopping = true;
+	pthread_cond_signal(&prefetcher->not_full);
+	pthread_mutex_unlock(&prefetcher->lock);
+	pthread_join(prefetcher->thread, NULL);
+	prefetcher->running = false;
 }
 
-static inline uint32_t
-circular_buffer_last(uint32_t *buffer, int count, int buffer_size)
-{
-	return buffer[(count - 1) % buffer_size];
-}
-
-static uint32_t
-last_recvd_packet_id()
+static const struct trace_row *
+next_prefetched_row(struct row_prefetcher *prefetcher)
 {
-	return circular_buffer_last(last_recvd_ids, recvd_count, ID_BUFFER_SIZE);
-}
+	const struct trace_row *row = NULL;
 
-void
-print_last_recvd_packet_ids()
-{
-	DEBUG_PRINTF("Last received ids...\n");
-	print_circular_uint_buffer(last_recvd_ids, recvd_count, ID_BUFFER_SIZE);
+	pthread_mutex_lock(&prefetcher->lock);
+	while (prefetcher->head == prefetcher->tail && !prefetcher->finished) {
+		pthread_cond_wait(&prefetcher->not_empty, &prefetcher->lock);
+	}
+	if (prefetcher->head != prefetcher->tail) {
+		prefetcher->current =
+			prefetcher->queue[prefetcher->head % PREFETCH_QUEUE_ROWS];
+		++prefetcher->head;
+		row = &prefetcher->current;
+		pthread_cond_signal(&prefetcher->not_full);
+	}
+	pthread_mutex_unlock(&prefetcher->lock);
+	return row;
 }
 
-static uint32_t
-last_sent_packet_id()
+static const struct trace_row *
+next_downstream_row()
 {
-	return circular_buffer_last(last_sent_ids, sent_count, ID_BUFFER_SIZE);
+	return next_prefetched_row(&downstream_prefetcher);
 }
 
-static void
-print_last_sent_packet_ids()
+static const struct trace_row *
+next_upstream_row()
 {
-	DEBUG_PRINTF("Last sent ids...\n");
-	print_circular_uint_buffer(last_sent_ids, sent_count, ID_BUFFER_SIZE);
+	return next_prefetched_row(&upstream_prefetcher);
 }
 
-int last_packet;
-
 void
-wait_for_tlp(volatile TLPQuadWord *buffer, int buffer_len, struct RawTLP *out)
+wait_for_tlp(TLPQuadWord *buffer, int buffer_len, struct RawTLP *out)
 {
-	/* This gives us an approximation to packets not arriving, so lets us run
-	 * the main loop. It probably isn't worth doing anything more elaborate
-	 * (checking against timestamp? */
-	static int call_count = 0;
-	++call_count;
-	if (call_count % 2 != 0) {
-		set_raw_tlp_invalid(out);
-		return;
-	}
-	/* TODO: Check we don't buffer overrun. */
-	PGresult *result = PQgetResult(postgres_connection_downstream);
-	
-	while (!should_receive_tlp_for_result(result)) {
-		/*PDBG("Skipping receiving %d", get_postgres_packet(result));*/
-		PQclear(result);
-		result = PQgetResult(postgres_connection_downstream);
-		if (result == NULL) {
-			return set_raw_tlp_trace_finished(out);
-		}
-	}
-
-	last_packet = get_postgres_packet(result);
-
-#ifdef PRINT_IDS
-	DEBUG_PRINTF("Simulating receiving ");
-#endif
-	tlp_from_postgres(result, buffer, buffer_len, out);
-	last_recvd_ids[(recvd_count % ID_BUFFER_SIZE)] =
-		get_postgres_packet(result);
-	++recvd_count;
-
-	static bool read_semaphore = false;
-
-	switch (get_postgres_tlp_type(result)) {
-	case PG_CFG_RD_0:
-		switch (get_postgres_register(result)) {
-		case 0x0: /* device ID */
-			set_next_completion_data_mask(0xFFFF00FF);
-			break;
-		case 0x8: /* revision mask */
-			set_next_completion_data_mask(0x00FFFFFF);
-			break;
-		case 0xC: /* header type. A bit odd. */
-			set_next_completion_data_mask(0xFFFF00FF);
-			break;
-		case 0xC8:
-			set_next_completion_data_mask(0xFFFF0000);
-			break;
-		case 0xE0:
-			set_next_completion_data_mask(0xFF0FFFFF);
-			break;
-		case 0xE4: /* PCIe Device Capabilities */
-			set_next_completion_data_mask(0x0000FFFF);
-			break;
-		case 0x100: /* Some sort of extention register */
-			set_next_completion_data_mask(0xFFFF0000);
-			break;
-		case 0x104: /* Uncorrectable error status? Hopefully unreproducable. */
-			set_next_completion_data_mask(0xFFFFEFFF);
-			break;
-		case 0x1C: /* BAR 3 -- think this an MSI-X problem/difference? */
-		case 0x30: /* Expansion ROM -- simulated NIC doesn't have one. */
-		case 0xA0: /* No idea... */
-		case 0xA4: /* Seems to be some capability wholesale ignored. */
-		case 0xA8:
-		case 0xCC: /* Power management. Hopefully safe to ignore. */
-		case 0xE8: /* Device Status and Control */
-		case 0xEC: /* Link Capabilities */
-		case 0xF0: /* Link status and control */
-			set_next_completion_data_mask(0x0);
-			break;
-		}
-		break;
-	case PG_M_RD_32:
-		switch (get_postgres_address(result) & 0x1FFFF) {
-		case 0x10: /* EEPROM register */
-			set_next_completion_data_mask(0);
-			break;
-		case 0xF00: /* A reserved bit, the QEMU gets more right... */
-			/* And something weird to do with MDIO */
-			set_next_completion_data_mask(~bswap32(0x28));
-			break;
-		case 0x5B50:
-			if (!read_semaphore) {
-				/* First value is wrong for some reason. */
-				set_next_completion_data_mask(0);
-				read_semaphore = true;
-			}
-			break;
-		}
-		break;
-	}
-
-	PQclear(result);
+	replay_wait_for_tlp(next_downstream_row, buffer, buffer_len, out);
 }
 
-void
-drain_pcie_core()
-{
-}
-
-static inline bool
-should_send_tlp_for_result(PGresult *result)
-{
-	bool skip = false;
-	/* Consume a completion for a packet that is in the trace, but not sent */
-	if (skip_sending != 0) {
-		skip = true;
-		--skip_sending;
-		/*PDBG("Paying off skip sending.");*/
-	}
-	return !skip;
-}
-
-int TLPS_CHECKED = 0;
-
 int
 send_tlp(struct RawTLP *actual)
 {
-	assert(actual->header_length == 12 || actual->data_length == 16);
-	assert(actual->data_length % 4 == 0);
-
-	int i, response;
-
-	PGresult *result = PQgetResult(postgres_connection_upstream);
-	assert(result != NULL);
-
-	struct RawTLP expected;
-	TLPQuadWord expected_buffer[64];
-	int buffer_len = 64 * sizeof(TLPQuadWord);
-	memset(expected_buffer, 0, buffer_len);
-#ifdef PRINT_IDS
-	DEBUG_PRINTF("Simulating sending ");
-#endif
-
-	int pk, packet;
-	pk = get_postgres_pk(result);
-	packet = get_postgres_packet(result);
-
-	while (!should_send_tlp_for_result(result)) {
-		/*PDBG("Skipping sending %d", get_postgres_packet(result));*/
-		PQclear(result);
-		result = PQgetResult(postgres_connection_upstream);
-	}
-
-	last_sent_ids[sent_count % ID_BUFFER_SIZE] = get_postgres_packet(result);
-	++sent_count;
-
-	/*PDBG("Recvd: %d; Sent: %d", last_recvd_packet_id(), last_sent_packet_id());*/
-	if (last_sent_packet_id() < last_recvd_packet_id()) {
-		PDBG("Checked: %d", TLPS_CHECKED);
-		print_last_recvd_packet_ids();
-		print_last_sent_packet_ids();
-
-		assert(last_sent_packet_id() > last_recvd_packet_id());
-	}
-
-	tlp_from_postgres(result, expected_buffer, buffer_len, &expected);
-
-	assert(actual->header_length == expected.header_length);
-	if (actual->data_length != expected.data_length) {
-		printf("Data length mismatch procession packet %d with pk %d. "
-		   "Expected %d. Actual %d", packet, pk, expected.data_length,
-		   actual->data_length);
-		assert(false);
-	}
-
-	++TLPS_CHECKED;
-
-#define MASK_DATA(index, mask) 										do { \
-	actual->data[index] = actual->data[index] & mask;					 \
-	expected.data[index] = expected.data[index] & mask;				 \
-} while (0)
-
-	if (mask_next_completion_data) {
-		mask_next_completion_data = false;
-		MASK_DATA(0, completion_data_mask);
-	}
-
-#undef MASK_DATA
-
-	for (i = 0; i < (actual->header_length / sizeof(TLPDoubleWord)); ++i) {
-		assert(actual->header[i] == expected.header[i]);
-	}
-
-	for (i = 0; i < (actual->data_length / sizeof(TLPDoubleWord)); ++i ) {
-		if (actual->data[i] != expected.data[i]) {
-			printf("Data mismatch processing packet with pk %d: %d.\n"
-				"dword %d. Expected: 0x%08x. Actual 0x%08x.\n",
-				pk, packet, i, expected.data[i], actual->data[i]);
-			/*assert(false);*/
-		}
-	}
-
-
-	return 0;
+	return replay_send_tlp(next_upstream_row, actual);
 }
 
-
 static void
 print_result(PGresult *result)
 {
@@ -839,38 +319,11 @@ check_connection_status(const PGconn *connection)
 	}
 }
 
-static int
-start_binary_single_row_query(PGconn *connection, const char *query)
-{
-	int query_status = PQsendQueryParams(
-		connection,
-		query,
-		0, // Zero parameters
-		NULL, // Types
-		NULL, // Values
-		NULL, // Lengths
-		NULL, // Formats
-		PG_REPR_BINARY // Binary response, please
-	);
-	if (query_status == 0) {
-		printf("Error when querying trace database: %s",
-			PQerrorMessage(connection));
-		return 3;
-	}
-	query_status = PQsetSingleRowMode(connection);
-	if (query_status == 0) {
-		printf("Error when entering single row mode: %s",
-			PQerrorMessage(connection));
-		return 4;
-	}
-	return 0;
-}
-
-
-
 void
 close_connections()
 {
+	stop_prefetcher(&downstream_prefetcher);
+	stop_prefetcher(&upstream_prefetcher);
 	PQfinish(postgres_connection_downstream);
 	PQfinish(postgres_connection_upstream);
 }
@@ -878,12 +331,15 @@ close_connections()
 int
 pcie_hardware_init(int argc, char **argv, volatile uint8_t **physmem)
 {
-	int connection_status, query_status;
+	int connection_status, prefetch_status;
 
 	if (argc != 2) {
 		printf("Usage: %s CONNECTION_STRING\n", argv[0]);
 		return 1;
 	}
+	if (!postgres_row_decoder_init()) {
+		return 5;
+	}
 	printf("Creating connection for downstream packets...\n");
 	atexit(close_connections);
 	postgres_connection_downstream = PQconnectdb(argv[1]);
@@ -898,52 +354,17 @@ pcie_hardware_init(int argc, char **argv, volatile uint8_t **physmem)
 		return connection_status;
 	}
 
-	query_status = start_binary_single_row_query(
-		postgres_connection_downstream,
-		"SELECT * FROM qemu_trace WHERE link_dir = 'Downstream' ORDER BY packet ASC");
-	if (query_status != 0) {
-		return query_status;
+	prefetch_status = start_prefetcher(&downstream_prefetcher,
+		postgres_connection_downstream, "Downstream");
+	if (prefetch_status != 0) {
+		return prefetch_status;
 	}
 
-	query_status = start_binary_single_row_query(
-		postgres_connection_upstream,
-		"SELECT * FROM qemu_trace WHERE link_dir = 'Upstream' ORDER BY packet ASC");
-	if (query_status != 0) {
-		return query_status;
+	prefetch_status = start_prefetcher(&upstream_prefetcher,
+		postgres_connection_upstream, "Upstream");
+	if (prefetch_status != 0) {
+		return prefetch_status;
 	}
 
 	return 0;
 }
-
-
-int
-pci_dma_read(PCIDevice *dev, dma_addr_t addr, void *buf, dma_addr_t len)
-{
-	printf("WARNING! Postgres backend doesn't simulate host memory.\n");
-	return 0;
-}
-
-int
-pci_dma_write(PCIDevice *dev, dma_addr_t addr, const void *buf, dma_addr_t len)
-{
-	printf("WARNING! Postgres backend doesn't simulate host memory.\n");
-	return 0;
-}
-
-enum dma_read_response
-perform_dma_read(uint8_t* buf, uint16_t length, uint16_t requester_id,
-	uint8_t tag, uint64_t address)
-{
-	printf("WARNING! Postgres backend doesn't simulate host memory.\n");
-	return DRR_UNSUPPORTED_REQUEST;
-}
-
-int
-perform_dma_write(const uint8_t* buf, int16_t length, uint16_t requester_id,
-	uint8_t tag, uint64_t address)
-{
-
-	fprintf(stderr, "WARNING! %s(%s) Posgres backend doesn't simulate "
-		"host memory.\n", __FILE__, __func__);
-	return -1;
-}
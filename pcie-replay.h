@@ -0,0 +1,116 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * Copyright (c) 2015-2018 Colin Rothwell
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef PCIE_REPLAY_H
+#define PCIE_REPLAY_H
+
+#include <stdint.h>
+
+#include "pcie.h"
+
+/*
+ * The parts of trace replay shared by the backends that read traces from
+ * different places. A backend hands over rows one at a time; this code turns
+ * downstream rows into TLPs for the device model, checks the TLPs the model
+ * sends against upstream rows, and skips the parts of the trace that the
+ * emulated device can't reproduce.
+ */
+
+enum trace_tlp_type {
+	TT_CFG_RD_0,
+	TT_CFG_WR_0,
+	TT_CPL,
+	TT_CPL_D,
+	TT_IO_RD,
+	TT_IO_WR,
+	TT_M_RD_32,
+	TT_M_WR_32,
+	TT_MSG,
+	TT_MSG_D
+};
+
+enum trace_msg_routing { BROADCAST = 3, LOCAL = 4 };
+
+enum trace_message_code {
+	PME_TURN_OFF = 0x19,
+	SET_SLOT_POWER_LIMIT = 0x50,
+	VENDOR_DEFINED_TYPE_1 = 0x7F
+};
+
+enum trace_cpl_status { TCS_SC = 0x0, TCS_UR = 0x1 };
+
+/*
+ * One TLP of a trace. This is also the record format of the trace files read
+ * by pcie-trace.c, so it has fixed-width fields and no padding. Fields that
+ * don't apply to a TLP's type are zero.
+ */
+struct trace_row {
+	uint32_t pk;
+	uint32_t packet;
+	uint8_t tlp_type; /* enum trace_tlp_type */
+	uint8_t msg_routing; /* enum trace_msg_routing */
+	uint8_t message_code; /* enum trace_message_code */
+	uint8_t cpl_status; /* enum trace_cpl_status */
+	uint16_t length;
+	uint16_t requester_id;
+	uint16_t completer_id;
+	uint16_t device_id;
+	uint16_t reg;
+	uint16_t byte_cnt;
+	uint8_t tag;
+	uint8_t first_be;
+	uint8_t last_be;
+	uint8_t bcm;
+	uint8_t lwr_addr;
+	uint8_t reserved[3];
+	uint64_t address;
+	uint64_t data;
+};
+
+/* Returns the next row in one direction, or NULL at the end of the trace. The
+ * row is only valid until the next call. */
+typedef const struct trace_row *(*TraceNextRow)(void);
+
+void
+replay_wait_for_tlp(TraceNextRow next_downstream, TLPQuadWord *buffer,
+	int buffer_len, struct RawTLP *out);
+
+int
+replay_send_tlp(TraceNextRow next_upstream, struct RawTLP *actual);
+
+void
+print_last_recvd_packet_ids();
+
+#endif
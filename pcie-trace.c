@@ -0,0 +1,187 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Replays a trace from a file instead of a database, so that regression
+ * replays need nothing but the file. The file is mapped and its rows are
+ * handed to the shared replay code in place, without any decoding.
+ *
+ * A trace file is a struct trace_file_header followed by two arrays of
+ * struct trace_row, one per link direction, each in packet order. The
+ * header gives each array's offset and length. postgres_replay/tracefile.py
+ * writes trace files from the analyzer's CSV or from the qemu_trace table.
+ */
+
+#include "pcie-backend.h"
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "pcie.h"
+#include "pcie-replay.h"
+
+#define TRACE_FILE_MAGIC 0x43415254 /* "TRAC" on disk */
+#define TRACE_FILE_VERSION 1
+
+/* In host byte order, as is everything in the file. */
+struct trace_file_header {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t row_size;
+	uint32_t downstream_count;
+	uint32_t upstream_count;
+	uint64_t downstream_offset;
+	uint64_t upstream_offset;
+};
+
+static uint8_t *trace_mapping = MAP_FAILED;
+static size_t trace_mapping_length;
+
+static const struct trace_row *downstream_rows;
+static uint32_t downstream_count, next_downstream;
+static const struct trace_row *upstream_rows;
+static uint32_t upstream_count, next_upstream;
+
+static const struct trace_row *
+next_downstream_row()
+{
+	if (next_downstream == downstream_count) {
+		return NULL;
+	}
+	return &downstream_rows[next_downstream++];
+}
+
+static const struct trace_row *
+next_upstream_row()
+{
+	if (next_upstream == upstream_count) {
+		return NULL;
+	}
+	return &upstream_rows[next_upstream++];
+}
+
+void
+wait_for_tlp(TLPQuadWord *buffer, int buffer_len, struct RawTLP *out)
+{
+	replay_wait_for_tlp(next_downstream_row, buffer, buffer_len, out);
+}
+
+int
+send_tlp(struct RawTLP *actual)
+{
+	return replay_send_tlp(next_upstream_row, actual);
+}
+
+static bool
+rows_in_mapping(uint64_t offset, uint32_t count)
+{
+	return offset % sizeof(uint64_t) == 0 &&
+		offset <= trace_mapping_length &&
+		count <= (trace_mapping_length - offset) / sizeof(struct trace_row);
+}
+
+void
+close_connections()
+{
+	if (trace_mapping != MAP_FAILED) {
+		munmap(trace_mapping, trace_mapping_length);
+		trace_mapping = MAP_FAILED;
+	}
+}
+
+int
+pcie_hardware_init(int argc, char **argv, volatile uint8_t **physmem)
+{
+	int fd;
+	struct stat status;
+	const struct trace_file_header *header;
+
+	if (argc != 2) {
+		printf("Usage: %s TRACE_FILE\n", argv[0]);
+		return 1;
+	}
+
+	fd = open(argv[1], O_RDONLY);
+	if (fd < 0 || fstat(fd, &status) != 0) {
+		perror("Couldn't open trace");
+		return 2;
+	}
+	trace_mapping_length = status.st_size;
+	if (trace_mapping_length < sizeof(struct trace_file_header)) {
+		printf("%s is too short to be a trace.\n", argv[1]);
+		close(fd);
+		return 3;
+	}
+	trace_mapping = mmap(NULL, trace_mapping_length, PROT_READ, MAP_PRIVATE,
+		fd, 0);
+	close(fd);
+	if (trace_mapping == MAP_FAILED) {
+		perror("Couldn't map trace");
+		return 2;
+	}
+	/* Replay reads each direction front to back. */
+	madvise(trace_mapping, trace_mapping_length, MADV_SEQUENTIAL);
+	madvise(trace_mapping, trace_mapping_length, MADV_WILLNEED);
+	atexit(close_connections);
+
+	header = (const struct trace_file_header *)trace_mapping;
+	if (header->magic != TRACE_FILE_MAGIC ||
+		header->version != TRACE_FILE_VERSION ||
+		header->row_size != sizeof(struct trace_row)) {
+		printf("%s is not a version %d trace for this host.\n", argv[1],
+			TRACE_FILE_VERSION);
+		return 3;
+	}
+	if (!rows_in_mapping(header->downstream_offset,
+			header->downstream_count) ||
+		!rows_in_mapping(header->upstream_offset, header->upstream_count)) {
+		printf("%s is truncated.\n", argv[1]);
+		return 3;
+	}
+
+	downstream_rows = (const struct trace_row *)
+		(trace_mapping + header->downstream_offset);
+	downstream_count = header->downstream_count;
+	upstream_rows = (const struct trace_row *)
+		(trace_mapping + header->upstream_offset);
+	upstream_count = header->upstream_count;
+	printf("Replaying %u downstream and %u upstream TLPs.\n",
+		downstream_count, upstream_count);
+
+	return 0;
+}
@@ -42,6 +42,7 @@
 #include "pcie.h"
 #include "pcie-backend.h"
 #include "pcie-debug.h"
+#include "tlp_metrics.h"
 
 #include <assert.h>
 #include <stdbool.h>
@@ -98,42 +99,11 @@ create_completion_header(struct RawTLP *tlp,
 	uint16_t requester_id, uint8_t tag, uint8_t loweraddress,
 	uint32_t length)
 {
-/*	printf("Creating a completion header.");
-	printf("dir=%#x, cpl_id=%#x, cpl_status=%#x, bytecount=%#x, req_id=%#x, tag=%#x, loweraddr=%#x\n",
-		direction,completer_id, completion_status, bytecount, requester_id, tag, loweraddress);
-*/	// Clear buffer. If passed in a buffer that's too short, this might be an
-	// exploit?
-	tlp->header[0] = 0;
-	tlp->header[1] = 0;
-	tlp->header[2] = 0;
 	// completions can be 1024 or fewer D-words
 	assert(length <= 1024);
-
-	struct TLP64DWord0 *header0 = (struct TLP64DWord0 *)(tlp->header);
-	if (direction == TLPD_READ
-		&& completion_status == TLPCS_SUCCESSFUL_COMPLETION) {
-//		printf("3dw data compl\n");
-		tlp_set_fmt(header0, TLPFMT_3DW_DATA);
-		tlp_set_length(header0, length);
-	} else {
-//		printf("3dw nodata compl\n");
-		tlp_set_fmt(header0, TLPFMT_3DW_NODATA);
-		tlp_set_length(header0, 0);
-	}
-	tlp_set_type(header0, CPL);
-
-	struct TLP64CompletionDWord1 *header1 =
-		(struct TLP64CompletionDWord1 *)(tlp->header) + 1;
-	tlp_set_completer_id(header1,completer_id);
-	tlp_set_status(header1, completion_status);
-	tlp_set_bytecount(header1, bytecount);
-//	printf("byte2=%#x, byte3=%#x\n", header1->byte2, header1->byte3);
-
-	struct TLP64CompletionDWord2 *header2 =
-		(struct TLP64CompletionDWord2 *)(tlp->header) + 2;
-	tlp_set_requester_id_cpl(header2, requester_id);
-	header2->tag = tag;
-	header2->loweraddress = (loweraddress & 0x7F); // only 7 bits long, top bit reserved=zero
+	tlp_build_completion(tlp->header, direction, completer_id,
+		completion_status, bytecount, requester_id, tag, loweraddress,
+		length);
 }
 
 void
@@ -141,53 +111,13 @@ create_memory_request_header(struct RawTLP *tlp, enum tlp_direction direction,
 	enum tlp_at at, uint16_t length, uint16_t requester_id, uint8_t tag,
 	uint8_t lastbe, uint8_t firstbe, uint64_t address)
 {
-	bool large_address = (address >= (1LL << 32));
-
-	int i;
-
-	for (i = 0; i < 4; ++i) {
-		tlp->header[i] = 0;
-	}
-	if (large_address) {
-		tlp->header_length = 16;
-	} else {
-		tlp->header_length = 12;
-	}
+	tlp->header_length = tlp_build_memory_request(tlp->header, direction, at,
+		length, requester_id, tag, lastbe, firstbe, address);
 	if (direction == TLPD_READ) {
 		tlp->data_length = 0;
 	} else {
 		tlp->data_length = length * sizeof(TLPDoubleWord);
 	}
-
-	struct TLP64DWord0 *dword0 = (struct TLP64DWord0 *)tlp->header;
-	struct TLP64RequestDWord1 *request_dword1 =
-		(struct TLP64RequestDWord1 *)(tlp->header + 1);
-	TLPDoubleWord *address_dword2 = (tlp->header + 2);
-	TLPDoubleWord *address_dword3 = (tlp->header + 3);
-
-	enum tlp_fmt fmt = 0;
-	if (tlp->header_length == 16) {
-		fmt = TLPFMT_4DW;
-	}
-	if (direction == TLPD_WRITE) {
-		fmt |= TLPFMT_WITHDATA;
-	}
-	tlp_set_fmt(dword0, fmt);
-	tlp_set_at(dword0, at);
-	tlp_set_length(dword0, length);
-	tlp_set_type(dword0, M);
-
-	tlp_set_requester_id(request_dword1,requester_id);
-	request_dword1->tag = tag;
-	tlp_set_lastbe(request_dword1, lastbe);
-	tlp_set_firstbe(request_dword1, firstbe);
-
-	if (large_address) {
-		*address_dword2 = (TLPDoubleWord)(address >> 32);
-		*address_dword3 = (TLPDoubleWord)address;
-	} else {
-		*address_dword2 = (TLPDoubleWord)address;
-	}
 }
 
 void
@@ -198,36 +128,14 @@ create_config_request_header(struct RawTLP *tlp, enum tlp_direction direction,
 	assert((address & 0x3) == 0);
 	assert(address < 4096);
 
-	int i;
-	for (i = 0; i < 4; ++i) {
-		tlp->header[i] = 0;
-	}
 	tlp->header_length = 12;
 	if (direction == TLPD_READ) {
 		tlp->data_length = 0;
 	} else {
 		tlp->data_length = 4;
 	}
-
-	struct TLP64DWord0 *dword0 = (struct TLP64DWord0 *)tlp->header;
-	struct TLP64RequestDWord1 *dword1 =
-		(struct TLP64RequestDWord1 *)(tlp->header + 1);
-	struct TLP64ConfigRequestDWord2 *dword2 =
-		(struct TLP64ConfigRequestDWord2 *)(tlp->header + 2);
-
-	enum tlp_fmt fmt = 0;
-	if (direction == TLPD_WRITE) {
-		fmt |= TLPFMT_WITHDATA;
-	}
-	tlp_set_fmt(dword0, fmt);
-	tlp_set_type(dword0, CFG_0);
-	tlp_set_length(dword0, 1);
-	tlp_set_requester_id(dword1,requester_id);
-	dword1->tag = tag;
-	tlp_set_firstbe(dword1, firstbe);
-	tlp_set_device_id(dword2, devfn);
-	dword2->ext_reg_num = address >> 8;
-	dword2->reg_num = address & uint32_mask(8);
+	tlp_build_config_request(tlp->header, direction, requester_id, tag,
+		firstbe, devfn, address);
 }
 
 void
@@ -271,8 +179,8 @@ is_cpl_d(struct RawTLP *tlp)
 {
 	assert(tlp->header_length != -1);
 	assert(tlp->header != NULL);
-	struct TLP64DWord0 *dword0 = (struct TLP64DWord0 *)tlp->header;
-	return tlp_get_type(dword0) == CPL && tlp_fmt_has_data(tlp_get_fmt(dword0));
+	struct tlp_class classified = tlp_classify(tlp->header);
+	return classified.type == CPL && tlp_fmt_has_data(classified.fmt);
 }
 
 static inline TLPQuadWord *
@@ -307,6 +215,7 @@ alloc_raw_tlp_buffer(struct RawTLP *tlp)
 		if (!tlp_buffer_in_use[i]) {
 			tlp_buffer_in_use[i] = true;
 			tlp->header = (TLPDoubleWord *)tlp_buffer_address(i);
+			count_tlp_buffers(1);
 			return;
 		}
 	}
@@ -326,6 +235,7 @@ free_raw_tlp_buffer(struct RawTLP *tlp)
 	if (buffer_number >= 0 && buffer_number <= TLP_BUFFER_COUNT) {
 		tlp_buffer_in_use[buffer_number] = false;
 		set_raw_tlp_invalid(tlp);
+		count_tlp_buffers(-1);
 	} else {
 		fprintf(stderr, "Trying to free unallocated buffer %d at %p\n.",
 			buffer_number, tlp->header);
@@ -349,10 +259,14 @@ next_tlp(struct RawTLP *out)
 	if (candidate == NULL) {
 		alloc_raw_tlp_buffer(out);
 		wait_for_tlp((TLPQuadWord *)out->header, TLP_BUFFER_SIZE, out);
+		if (is_raw_tlp_valid(out)) {
+			count_tlp(TMD_RECEIVED, out);
+		}
 	} else {
 		/*fputs("dq ", stdout);*/
 		/*puts(tlp_type_str(get_tlp_type(out)));*/
 		STAILQ_REMOVE_HEAD(&unhandled_tlp_list_head, unhandled_tlp_list);
+		count_pending_tlps(-1);
 		*out = candidate->tlp;
 		/*printf("dq %d.\n", tlp_buffer_number((TLPQuadWord *)out->header));*/
 		free(candidate);
@@ -376,7 +290,8 @@ next_completion_tlp(struct RawTLP *out)
 		alloc_raw_tlp_buffer(out);
 		wait_for_tlp((TLPQuadWord *)out->header, TLP_BUFFER_SIZE, out);
 		if (is_raw_tlp_valid(out)) {
-			if (get_tlp_type(out) == CPL) {
+			count_tlp(TMD_RECEIVED, out);
+			if (tlp_classify(out->header).type == CPL) {
 				return;
 			} else {
 				/*printf("q %d.\n", tlp_buffer_number((TLPQuadWord *)out->header));*/
@@ -386,6 +301,7 @@ next_completion_tlp(struct RawTLP *out)
 				entry->tlp = *out;
 				STAILQ_INSERT_TAIL(
 					&unhandled_tlp_list_head, entry, unhandled_tlp_list);
+				count_pending_tlps(1);
 			}
 		} else {
 			free_raw_tlp_buffer(out);
@@ -395,21 +311,313 @@ next_completion_tlp(struct RawTLP *out)
 	alloc_raw_tlp_buffer(out);
 	set_raw_tlp_invalid(out);
 }
-/* Simple wrapper over perform_dma_read to allow reads longer than 512 to
- * be performed: reads happen in chunks.
+
+/*
+ * DMA on top of the backend's send_tlp and wait_for_tlp. The replay backends
+ * answer DMA from the trace instead, so they provide their own.
+ */
+#ifndef POSTGRES
+static inline enum dma_read_response
+_perform_dma_read(uint8_t* buf, uint16_t length, uint16_t requester_id,
+	uint8_t tag, enum tlp_at at, uint64_t address)
+{
+	/* This should be extracted from Max_Read_Request_Size in the Device
+	 * Control Register. */
+
+	enum dma_read_response return_value = DRR_SUCCESS;
+
+	assert(length > 0);
+	if (length > 512) {
+		printf("Bad dma read.\n");
+	}
+	assert(length <= 512);
+	assert(buf != NULL);
+
+	TLPQuadWord read_req_tlp_buffer[2];
+	struct RawTLP read_req_tlp;
+	read_req_tlp.header = (TLPDoubleWord *)read_req_tlp_buffer;
+
+	struct RawTLP read_resp_tlp;
+	set_raw_tlp_invalid(&read_resp_tlp);
+	struct tlp_class completion;
+	struct TLP64CompletionDWord1 *read_resp_dword1;
+
+	uint16_t ceil_length = calculate_dword_length(length);
+	struct byte_enables bes = calculate_bes_for_length(length);
+
+	/*PDBG("length: %d, ceil_length: %d, lastbe: 0x%x, firstbe: 0x%x.",*/
+		/*length, ceil_length, lastbe, firstbe);*/
+
+	create_memory_request_header(&read_req_tlp, TLPD_READ, at,
+		ceil_length / 4, requester_id, tag, bes.last, bes.first,
+		address);
+	uint64_t started = metrics_time();
+	int send_result = send_tlp(&read_req_tlp);
+	assert(send_result != -1);
+
+	/* i is total amount of data read; j is data from specific completion.
+	 * Data for long reads (more than 32 dwords) will come back as multiple
+	 * completions.
+	 */
+	int i = 0, j;
+
+	while (i < length) {
+		next_completion_tlp(&read_resp_tlp);
+
+		if (!is_raw_tlp_valid(&read_resp_tlp)) {
+			free_raw_tlp_buffer(&read_resp_tlp);
+			return DRR_NO_RESPONSE;
+		}
+
+		assert(&read_resp_tlp != NULL);
+		assert(read_resp_tlp.header != NULL);
+		assert(read_resp_tlp.header_length != -1);
+		assert(is_raw_tlp_valid(&read_resp_tlp));
+
+		completion = tlp_classify(read_resp_tlp.header);
+		assert(completion.type == CPL);
+
+		read_resp_dword1 = (struct TLP64CompletionDWord1 *)(
+			read_resp_tlp.header + 1);
+
+		if (tlp_get_status(read_resp_dword1) == TLPCS_UNSUPPORTED_REQUEST) {
+			free_raw_tlp_buffer(&read_resp_tlp);
+			time_dma_read(started);
+			return DRR_UNSUPPORTED_REQUEST;
+		}
+
+		assert(tlp_fmt_has_data(completion.fmt));
+
+		for (j = 0; j < (completion.length * sizeof(TLPDoubleWord)) &&
+				(i + j) < length; ++j) {
+			buf[i + j] = ((uint8_t *)(read_resp_tlp.data))[j];
+			/*PDBG("i: %d, j: %d, i + j: %d, buf[i + j]: %d.",*/
+				/*i, j, i + j, buf[i + j]);*/
+		}
+
+		i += (completion.length * sizeof(TLPDoubleWord));
+
+		/*if (dword0->length != 1) {*/
+			/*printf("Non standard completion packet; i is now %d.\n", i);*/
+		/*}*/
+		/*PDBG("i: %d. length: %d", i, length);*/
+		free_raw_tlp_buffer(&read_resp_tlp);
+	}
+	/*if (dword0->length != 1) {*/
+		/*puts("Done!");*/
+	/*}*/
+
+	/*PDBG("Done reading.");*/
+
+	time_dma_read(started);
+	return return_value;
+}
+
+enum dma_read_response
+perform_translated_dma_read(uint8_t* buf, uint16_t length, uint16_t requester_id,
+	uint8_t tag, uint64_t address)
+{
+	return _perform_dma_read(buf, length, requester_id, tag, TLP_AT_TRANSLATED,
+		address);
+}
+
+
+enum dma_read_response
+perform_dma_read(uint8_t* buf, uint16_t length, uint16_t requester_id,
+	uint8_t tag, uint64_t address)
+{
+	return _perform_dma_read(buf, length, requester_id, tag,
+		TLP_AT_UNTRANSLATED, address);
+}
+
+
+void
+perform_dma_reads(struct dma_read_request *requests, int count,
+	uint16_t requester_id, uint8_t first_tag)
+{
+	uint16_t received[DMA_READS_IN_FLIGHT];
+	uint64_t sent[DMA_READS_IN_FLIGHT];
+	bool done[DMA_READS_IN_FLIGHT];
+	int outstanding = count, index, j;
+
+	assert(count <= DMA_READS_IN_FLIGHT);
+
+	TLPQuadWord read_req_tlp_buffer[2];
+	struct RawTLP read_req_tlp;
+	read_req_tlp.header = (TLPDoubleWord *)read_req_tlp_buffer;
+
+	for (index = 0; index < count; ++index) {
+		struct dma_read_request *request = &requests[index];
+		struct byte_enables bes = calculate_bes_for_length(request->length);
+
+		assert(request->length > 0 &&
+			request->length <= DMA_MAX_READ_REQUEST);
+		received[index] = 0;
+		done[index] = false;
+		request->response = DRR_SUCCESS;
+		create_memory_request_header(&read_req_tlp, TLPD_READ,
+			TLP_AT_UNTRANSLATED,
+			calculate_dword_length(request->length) / 4, requester_id,
+			dma_read_tag(first_tag, index), bes.last, bes.first,
+			request->address);
+		sent[index] = metrics_time();
+		int send_result = send_tlp(&read_req_tlp);
+		assert(send_result != -1);
+	}
+
+	struct RawTLP read_resp_tlp;
+	struct tlp_class completion;
+	struct TLP64CompletionDWord1 *dword1;
+	struct TLP64CompletionDWord2 *dword2;
+
+	while (outstanding > 0) {
+		next_completion_tlp(&read_resp_tlp);
+		if (!is_raw_tlp_valid(&read_resp_tlp)) {
+			free_raw_tlp_buffer(&read_resp_tlp);
+			for (index = 0; index < count; ++index) {
+				if (!done[index]) {
+					requests[index].response = DRR_NO_RESPONSE;
+				}
+			}
+			return;
+		}
+
+		completion = tlp_classify(read_resp_tlp.header);
+		dword1 = (struct TLP64CompletionDWord1 *)(read_resp_tlp.header + 1);
+		dword2 = (struct TLP64CompletionDWord2 *)(read_resp_tlp.header + 2);
+		index = dma_read_index(first_tag, dword2->tag);
+		if (index >= count || done[index]) {
+			/* Late completion for an earlier read that timed out. */
+			free_raw_tlp_buffer(&read_resp_tlp);
+			continue;
+		}
+
+		struct dma_read_request *request = &requests[index];
+		if (tlp_get_status(dword1) == TLPCS_UNSUPPORTED_REQUEST) {
+			request->response = DRR_UNSUPPORTED_REQUEST;
+			done[index] = true;
+			--outstanding;
+			time_dma_read(sent[index]);
+			free_raw_tlp_buffer(&read_resp_tlp);
+			continue;
+		}
+
+		assert(tlp_fmt_has_data(completion.fmt));
+		for (j = 0; j < (completion.length * sizeof(TLPDoubleWord)) &&
+				(received[index] + j) < request->length; ++j) {
+			request->buf[received[index] + j] =
+				((uint8_t *)(read_resp_tlp.data))[j];
+		}
+		received[index] += completion.length * sizeof(TLPDoubleWord);
+		if (received[index] >= request->length) {
+			done[index] = true;
+			--outstanding;
+			time_dma_read(sent[index]);
+		}
+		free_raw_tlp_buffer(&read_resp_tlp);
+	}
+}
+
+/*
+ * We should handle tags with more sophistication than we do -- each part of
+ * the core should use a specific tag, but this would require modifying calls
+ * to pci_dma_read. For tags see page 88 of the manual. I use 8, which is the
+ * transmit side reading from memory.
+ */
+int
+pci_dma_read(PCIDevice *dev, dma_addr_t addr, void *buf, dma_addr_t len)
+{
+	return perform_dma_read((uint8_t *)buf, len, dev->devfn, 8, addr);
+}
+
+int
+perform_dma_write(const uint8_t* buf, int16_t length, uint16_t requester_id,
+	uint8_t tag, uint64_t address)
+{
+	const uint16_t SEND_LIMIT = 128; /* bytes */
+	TLPQuadWord write_req_header_buffer[2];
+	TLPQuadWord *write_data = aligned_alloc(8, ((length + 7) / 8) * 8);
+	/* TODO: Only do this if the data is confirmed to be misaligned. */
+
+	for (int i = 0; i < length; ++i) {
+		((uint8_t *)write_data)[i] = ((const uint8_t *)buf)[i];
+	}
+
+	uint16_t send_amount, send_dwords, left_to_send, cursor = 0;
+	uint16_t dword_length = calculate_dword_length(length);
+
+	struct RawTLP write_req_tlp;
+	write_req_tlp.header = (TLPDoubleWord *)write_req_header_buffer;
+
+	do {
+		write_req_tlp.data = (TLPDoubleWord *)(write_data +
+			cursor / sizeof(TLPQuadWord));
+		left_to_send = length - cursor;
+		send_amount = left_to_send < SEND_LIMIT ? left_to_send : SEND_LIMIT;
+		struct byte_enables bes = calculate_bes_for_length(send_amount);
+		send_dwords = calculate_dword_length(send_amount);
+		create_memory_request_header(&write_req_tlp, TLPD_WRITE,
+			TLP_AT_UNTRANSLATED, send_dwords / sizeof(TLPDoubleWord),
+			requester_id, tag, bes.last, bes.first, address + cursor);
+		int send_result = send_tlp(&write_req_tlp);
+		assert(send_result != -1);
+		cursor += send_dwords;
+	} while (cursor < dword_length);
+
+	free(write_data);
+	return 0;
+}
+
+int
+pci_dma_write(PCIDevice *dev, dma_addr_t addr, const void *buf, dma_addr_t len)
+{
+	return perform_dma_write(buf, len, dev->devfn, 0, addr);
+}
+#endif
+
+struct dma_read_hooks dma_read_hooks;
+
+/* Allows reads longer than 512 to be performed: reads happen in chunks, with
+ * up to DMA_READS_IN_FLIGHT chunks outstanding at once.
  */
 enum dma_read_response
 perform_dma_long_read(uint8_t* buf, uint64_t length, uint16_t requester_id,
 	uint8_t tag, uint64_t address)
 {
-	int result;
-	for (uint64_t i = 0; i < length; i += 512) {
-		result = perform_dma_read((buf + i), uint64_min(512, length - i),
-			requester_id, tag, (address + i));
-		if (result != 0) {
-			return result;
+	struct dma_read_request requests[DMA_READS_IN_FLIGHT];
+	uint64_t batch_start, offset;
+	int count;
+
+	if (dma_read_hooks.may_read != NULL &&
+		!dma_read_hooks.may_read(address, length, dma_read_hooks.opaque)) {
+		return DRR_UNSUPPORTED_REQUEST;
+	}
+	for (batch_start = 0; batch_start < length; batch_start = offset) {
+		for (count = 0, offset = batch_start;
+			count < DMA_READS_IN_FLIGHT && offset < length;
+			++count, offset += DMA_MAX_READ_REQUEST) {
+			requests[count].buf = buf + offset;
+			requests[count].length = uint64_min(DMA_MAX_READ_REQUEST,
+				length - offset);
+			requests[count].address = address + offset;
 		}
+		perform_dma_reads(requests, count, requester_id, tag);
+		for (int i = 0; i < count; ++i) {
+			if (requests[i].response == DRR_SUCCESS) {
+				continue;
+			}
+			if (dma_read_hooks.read_done != NULL) {
+				dma_read_hooks.read_done(requests[i].address,
+					requests[i].length, requests[i].response,
+					dma_read_hooks.opaque);
+			}
+			return requests[i].response;
+		}
+	}
+	if (dma_read_hooks.read_done != NULL) {
+		dma_read_hooks.read_done(address, length, DRR_SUCCESS,
+			dma_read_hooks.opaque);
 	}
-	return result;
+	return DRR_SUCCESS;
 }
 
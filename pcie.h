@@ -292,7 +292,7 @@ tlp_set_at(struct TLP64DWord0 *dword, enum tlp_at at) {
 static inline uint16_t
 tlp_get_length(struct TLP64DWord0 *dword) {
 	uint16_t length = dword->low_length;
-	return (dword->byte2 & MASK(uint8_t, 2) << 8) | length;
+	return ((dword->byte2 & MASK(uint8_t, 2)) << 8) | length;
 }
 
 static inline void
@@ -504,6 +504,145 @@ struct TLP64ConfigReq {
 	struct TLP64ConfigRequestDWord2 dword2;
 };
 
+/*
+ * Header builders that write each header dword whole, starting from a
+ * constant template for the TLP's fmt and type. The dword structs above are
+ * laid out so that a host-order TLPDoubleWord holds the dword with PCIe's bit
+ * numbering on either endianness, so the variable fields are placed with
+ * shifts rather than with the per-byte accessors. The builder for each
+ * (type, fmt) pair is generated, so that callers that know which TLP they
+ * are sending get a handful of stores; create_*_header wrap the generic
+ * versions.
+ */
+
+#define TLP_DWORD0_TEMPLATE(fmt, type)										\
+	((TLPDoubleWord)((((fmt) & 7) << 5) | ((type) & 31)) << 24)
+
+static inline TLPDoubleWord
+tlp_dword0_fields(enum tlp_at at, uint16_t length)
+{
+	return ((TLPDoubleWord)(at & 3) << 10) | (length & 0x3FF);
+}
+
+static inline TLPDoubleWord
+tlp_request_dword1(uint16_t requester_id, uint8_t tag, uint8_t lastbe,
+	uint8_t firstbe)
+{
+	return ((TLPDoubleWord)requester_id << 16) | ((TLPDoubleWord)tag << 8) |
+		((lastbe & 0xF) << 4) | (firstbe & 0xF);
+}
+
+#define MEMORY_REQUEST_BUILDER(name, fmt)									\
+static inline void															\
+tlp_build_ ## name(TLPDoubleWord *header, enum tlp_at at, uint16_t length,	\
+	uint16_t requester_id, uint8_t tag, uint8_t lastbe, uint8_t firstbe,	\
+	uint64_t address)														\
+{																			\
+	header[0] = TLP_DWORD0_TEMPLATE(fmt, M) |								\
+		tlp_dword0_fields(at, length);										\
+	header[1] = tlp_request_dword1(requester_id, tag, lastbe, firstbe);		\
+	if (tlp_fmt_is_4dw(fmt)) {												\
+		header[2] = (TLPDoubleWord)(address >> 32);							\
+		header[3] = (TLPDoubleWord)address;									\
+	} else {																\
+		header[2] = (TLPDoubleWord)address;									\
+		header[3] = 0;														\
+	}																		\
+}
+
+#define COMPLETION_BUILDER(name, fmt)										\
+static inline void															\
+tlp_build_ ## name(TLPDoubleWord *header, uint16_t completer_id,			\
+	enum tlp_completion_status completion_status, uint16_t bytecount,		\
+	uint16_t requester_id, uint8_t tag, uint8_t loweraddress,				\
+	uint16_t length)														\
+{																			\
+	header[0] = TLP_DWORD0_TEMPLATE(fmt, CPL) | (tlp_fmt_has_data(fmt) ?	\
+		tlp_dword0_fields(TLP_AT_UNTRANSLATED, length) : 0);				\
+	header[1] = ((TLPDoubleWord)completer_id << 16) |						\
+		((completion_status & 7) << 13) | (bytecount & 0xFFF);				\
+	header[2] = ((TLPDoubleWord)requester_id << 16) |						\
+		((TLPDoubleWord)tag << 8) | (loweraddress & 0x7F);					\
+}
+
+#define CONFIG_REQUEST_BUILDER(name, fmt)									\
+static inline void															\
+tlp_build_ ## name(TLPDoubleWord *header, uint16_t requester_id,			\
+	uint8_t tag, uint8_t firstbe, uint16_t devfn, uint16_t address)			\
+{																			\
+	header[0] = TLP_DWORD0_TEMPLATE(fmt, CFG_0) |							\
+		tlp_dword0_fields(TLP_AT_UNTRANSLATED, 1);							\
+	header[1] = tlp_request_dword1(requester_id, tag, 0, firstbe);			\
+	header[2] = ((TLPDoubleWord)devfn << 16) | (address & 0xFFF);			\
+	header[3] = 0;															\
+}
+
+MEMORY_REQUEST_BUILDER(mrd32, TLPFMT_3DW_NODATA)
+MEMORY_REQUEST_BUILDER(mrd64, TLPFMT_4DW_NODATA)
+MEMORY_REQUEST_BUILDER(mwr32, TLPFMT_3DW_DATA)
+MEMORY_REQUEST_BUILDER(mwr64, TLPFMT_4DW_DATA)
+COMPLETION_BUILDER(cpl, TLPFMT_3DW_NODATA)
+COMPLETION_BUILDER(cpld, TLPFMT_3DW_DATA)
+CONFIG_REQUEST_BUILDER(cfgrd0, TLPFMT_3DW_NODATA)
+CONFIG_REQUEST_BUILDER(cfgwr0, TLPFMT_3DW_DATA)
+
+/* Returns the header length in bytes: 4DW above 4GB, otherwise 3DW. */
+static inline int
+tlp_build_memory_request(TLPDoubleWord *header, enum tlp_direction direction,
+	enum tlp_at at, uint16_t length, uint16_t requester_id, uint8_t tag,
+	uint8_t lastbe, uint8_t firstbe, uint64_t address)
+{
+	bool large_address = (address >> 32) != 0;
+
+	if (direction == TLPD_READ) {
+		if (large_address) {
+			tlp_build_mrd64(header, at, length, requester_id, tag, lastbe,
+				firstbe, address);
+		} else {
+			tlp_build_mrd32(header, at, length, requester_id, tag, lastbe,
+				firstbe, address);
+		}
+	} else {
+		if (large_address) {
+			tlp_build_mwr64(header, at, length, requester_id, tag, lastbe,
+				firstbe, address);
+		} else {
+			tlp_build_mwr32(header, at, length, requester_id, tag, lastbe,
+				firstbe, address);
+		}
+	}
+	return large_address ? 16 : 12;
+}
+
+/* Only a successful completion for a read carries data. */
+static inline void
+tlp_build_completion(TLPDoubleWord *header, enum tlp_direction direction,
+	uint16_t completer_id, enum tlp_completion_status completion_status,
+	uint16_t bytecount, uint16_t requester_id, uint8_t tag,
+	uint8_t loweraddress, uint16_t length)
+{
+	if (direction == TLPD_READ &&
+		completion_status == TLPCS_SUCCESSFUL_COMPLETION) {
+		tlp_build_cpld(header, completer_id, completion_status, bytecount,
+			requester_id, tag, loweraddress, length);
+	} else {
+		tlp_build_cpl(header, completer_id, completion_status, bytecount,
+			requester_id, tag, loweraddress, 0);
+	}
+}
+
+static inline void
+tlp_build_config_request(TLPDoubleWord *header, enum tlp_direction direction,
+	uint16_t requester_id, uint8_t tag, uint8_t firstbe, uint16_t devfn,
+	uint16_t address)
+{
+	if (direction == TLPD_READ) {
+		tlp_build_cfgrd0(header, requester_id, tag, firstbe, devfn, address);
+	} else {
+		tlp_build_cfgwr0(header, requester_id, tag, firstbe, devfn, address);
+	}
+}
+
 void
 create_completion_header(struct RawTLP *tlp,
 	enum tlp_direction direction, uint16_t completer_id,
@@ -540,6 +679,59 @@ enum dma_read_response
 perform_dma_long_read(uint8_t* buf, uint64_t length, uint16_t requester_id,
 	uint8_t tag, uint64_t address);
 
+#define DMA_MAX_READ_REQUEST 512 /* bytes */
+#define DMA_READS_IN_FLIGHT 32
+/* The device doesn't advertise Extended Tag, so tags are 5 bits. */
+#define DMA_TAG_COUNT 32
+#if DMA_READS_IN_FLIGHT > DMA_TAG_COUNT
+#error "More DMA reads in flight than there are tags"
+#endif
+
+struct dma_read_request {
+	uint8_t *buf;
+	uint16_t length; /* At most DMA_MAX_READ_REQUEST */
+	uint64_t address;
+	enum dma_read_response response; /* Set when the read finishes */
+};
+
+/*
+ * Sends up to DMA_READS_IN_FLIGHT read requests, tagged first_tag upwards
+ * modulo DMA_TAG_COUNT, before waiting for any completion, then matches
+ * completions to requests by tag. Completions for a single request arrive in
+ * address order.
+ */
+void
+perform_dma_reads(struct dma_read_request *requests, int count,
+	uint16_t requester_id, uint8_t first_tag);
+
+static inline uint8_t
+dma_read_tag(uint8_t first_tag, int index)
+{
+	return (first_tag + index) % DMA_TAG_COUNT;
+}
+
+/* The index of the request a completion's tag belongs to. */
+static inline int
+dma_read_index(uint8_t first_tag, uint8_t tag)
+{
+	return (uint8_t)(tag - first_tag) % DMA_TAG_COUNT;
+}
+
+/*
+ * Optional hooks around perform_dma_long_read. may_read can refuse a read
+ * that is known to fail, which then returns DRR_UNSUPPORTED_REQUEST without
+ * sending a TLP; read_done sees the result of each read, or of the chunk that
+ * failed.
+ */
+struct dma_read_hooks {
+	bool (*may_read)(uint64_t address, uint64_t length, void *opaque);
+	void (*read_done)(uint64_t address, uint64_t length,
+		enum dma_read_response response, void *opaque);
+	void *opaque;
+};
+
+extern struct dma_read_hooks dma_read_hooks;
+
 /* length is in bytes */
 int
 perform_dma_write(const uint8_t* buf, int16_t length, uint16_t requester_id,
@@ -556,6 +748,30 @@ get_tlp_type(const struct RawTLP *tlp)
 	return tlp_get_type(dword0);
 }
 
+/*
+ * Everything the dispatch paths need from the first header dword, decoded
+ * from a single load rather than by a tlp_get_* call per field.
+ */
+struct tlp_class {
+	enum tlp_type type;
+	enum tlp_fmt fmt;
+	enum tlp_direction direction;
+	uint16_t length; /* The length field, in dwords, as tlp_get_length */
+};
+
+static inline struct tlp_class
+tlp_classify(const TLPDoubleWord *header)
+{
+	TLPDoubleWord dword0 = header[0];
+	struct tlp_class classified = {
+		.type = (dword0 >> 24) & 31,
+		.fmt = (dword0 >> 29) & 3,
+		.direction = (dword0 >> 30) & 1,
+		.length = dword0 & 0x3FF
+	};
+	return classified;
+}
+
 static inline uint64_t
 get_config_req_addr(const struct RawTLP *tlp)
 {
@@ -33,12 +33,21 @@
 
 # Have a CSV file with loads of cruft.
 # Outputs "create_table.sql" to create the table
-# It assumes you are generating a table where a previous version existed, so
-# includes a number of "DROP" commands. Delete these if you don't need them.
+# It assumes you may be replacing a previous version of the table, so drops
+# the table and its types first if they exist.
 # To import into PGAdmin, the file format generated is "text", and you need to
 # set it to not import the "pk" field from file.
 # Outputs "cleaned_data.txt" for use with the COPY FROM command
-# The input file is hardcoded in, sorry. Grep for ".csv"
+# Outputs "create_indexes.sql", to run once the data is loaded.
+#
+# Usage: tablefromtrace.py [--stream [--database CONNECTION_STRING]] INPUT.csv
+#
+# Without --stream, the column types are inferred from the whole file while
+# it is cleaned. With --stream, they are inferred from the first
+# --sample-rows rows, and the rest of the file is converted --chunk-rows rows
+# at a time into binary COPY data, so memory use doesn't grow with the trace.
+# The COPY data goes to "qemu_trace.copy", or with --database, straight into
+# the database through psql, which then also creates the table and indexes.
 
 # A bunch of conversion with optionally return the value '', because it is valid
 # for SQL cells to be empty, and many packets don't have certain fields.
@@ -55,14 +64,28 @@
 
 from __future__ import print_function
 
+import argparse
 import csv
+import struct
+import subprocess
 import sys
+import time
 
 from enum import Enum
 
 ENUM_SIZE_LIMIT = 32
-NULL_STRING = '\N'
+NULL_STRING = '\\N'
 NAMESPACE = 'qemu_'
+TABLE_NAME = NAMESPACE + 'trace'
+
+DEFAULT_SAMPLE_ROWS = 100000
+DEFAULT_CHUNK_ROWS = 10000
+# The replay backends read these as 64-bit values, and every other integer
+# column as 32 bits, so streamed tables use those widths whatever the sample
+# holds.
+BIGINT_COLUMNS = frozenset({'address', 'data'})
+# The replay backend selects each direction of the trace in packet order.
+INDEXED_COLUMNS = ('link_dir', 'packet')
 
 DataType = Enum('DataType', 'bin_int dec_int hex_int varchar device_id')
 int_data_types = frozenset({DataType.bin_int, DataType.dec_int,
@@ -172,120 +195,296 @@ def sqlify_column_name(name):
                 to_return.append('_')
         return ''.join(to_return)
 
-def main():
-    with open('pcie-qemu-2016080401.csv') as trace_file, \
-            open('cleaned_data.txt', 'w') as data_file:
+def read_column_records(trace_reader):
+    column_names = [sqlify_column_name(name) for name in next(trace_reader)]
+    column_records = []
+    for name in column_names:
+        record = column_record_for_name(name)
+        if record is None and name not in ignored_columns:
+            record = column_record(name)
+        column_records.append(record)
+    return column_records
+
+
+def clean_row(raw_row, column_records, update_types=True):
+    clean_row = []
+    for raw_data, record in zip(raw_row, column_records):
+        if record is None:
+            continue
+        data_type = record['type']
+        try:
+            clean_data = converters[data_type](raw_data)
+        except ValueError as ex:
+            print(('ValueError when converting value "{}" for field '
+                   '"{}" with type "{}"').format(
+                      raw_data, record['name'], record['type']
+                  ))
+            raise
+        if clean_data == '':
+            clean_data = NULL_STRING
+        clean_row.append(clean_data)
+        if not update_types:
+            continue
+        if data_type in int_data_types and clean_data != NULL_STRING:
+            record['min'] = min(record['min'], clean_data)
+            record['max'] = max(record['max'], clean_data)
+        elif data_type is DataType.varchar:
+            if record['seen_values'] is not None and raw_data != '':
+                record['seen_values'].add(raw_data)
+                if len(record['seen_values']) > ENUM_SIZE_LIMIT:
+                    record['seen_values'] = None
+            longest = max(record['longest_length'], len(raw_data))
+            record['longest_length'] = longest
+    return clean_row
+
+
+def kept_records(column_records):
+    return [record for record in column_records if record is not None]
+
+
+def tlp_type_index(column_records):
+    for i, record in enumerate(kept_records(column_records)):
+        if record['name'] == 'tlp_type':
+            return i
+    raise ValueError('The trace has no TLP Type column.')
+
+
+def is_enum(record, streaming):
+    seen_values = record['seen_values']
+    # A column that was empty in the sample might hold anything.
+    return isinstance(seen_values, set) and (seen_values or not streaming)
+
+
+def column_sql_type(record, streaming):
+    if is_enum(record, streaming):
+        return '{}{}_enum'.format(NAMESPACE, record['name'])
+    elif record['type'] is DataType.device_id:
+        return 'integer'
+    elif record['type'] in int_data_types:
+        if streaming:
+            bigint = record['name'] in BIGINT_COLUMNS
+        else:
+            l, h = record['min'], record['max']
+            bigint = not (-2 ** 31 <= l and h < 2 ** 31)
+        return 'bigint' if bigint else 'integer'
+    elif streaming:
+        # A longer value may turn up after the sample.
+        return 'text'
+    else:
+        return 'varchar({})'.format(record['longest_length'])
+
+
+def create_table_sql(column_records, streaming):
+    sql = ['DROP TABLE IF EXISTS {};\n'.format(TABLE_NAME)]
+    # Create enum types
+    for record in kept_records(column_records):
+        seen_values = record['seen_values']
+        if is_enum(record, streaming):
+            type_name = column_sql_type(record, streaming)
+            sql.append('DROP TYPE IF EXISTS {};\n'.format(type_name))
+            sql.append('CREATE TYPE {} AS ENUM ({});\n'.format(
+                type_name,
+                ', '.join(["'{}'".format(enum_val)
+                           for enum_val in sorted(seen_values)])))
+    sql.append('CREATE TABLE {} (\n'.format(TABLE_NAME))
+    sql.append('\tpk SERIAL PRIMARY KEY')
+    for record in kept_records(column_records):
+        assert not record['name'] == 'pk'
+        sql.append(',\n\t{} {}'.format(record['name'],
+                                       column_sql_type(record, streaming)))
+    sql.append('\n);')
+    return ''.join(sql)
+
+
+def create_indexes_sql():
+    return ('CREATE INDEX {0}_{1} ON {0} ({2});\n'
+            'ANALYZE {0};\n').format(TABLE_NAME, '_'.join(INDEXED_COLUMNS),
+                                     ', '.join(INDEXED_COLUMNS))
+
+
+def write_sql_files(column_records, streaming):
+    with open('create_table.sql', 'w') as query_file:
+        query_file.write(create_table_sql(column_records, streaming))
+    with open('create_indexes.sql', 'w') as query_file:
+        query_file.write(create_indexes_sql())
+
+
+def report_rate(row_count, start):
+    elapsed = time.time() - start
+    print('Converted {} rows in {:.1f} s ({:.0f} rows/s).'.format(
+        row_count, elapsed, row_count / elapsed if elapsed > 0 else 0))
+
+
+def convert_to_text(trace_file):
+    start = time.time()
+    row_count = 0
+    with open('cleaned_data.txt', 'w') as data_file:
         trace_reader = csv.reader(trace_file)
+        column_records = read_column_records(trace_reader)
+        tlp_type = tlp_type_index(column_records)
 
-        column_names = map(sqlify_column_name, next(trace_reader))
-        name_to_column_num = {name: i for (i, name) in enumerate(column_names)}
-        column_records = []
-        for i, name in enumerate(column_names):
-            record = column_record_for_name(name)
-            if record is None and name not in ignored_columns:
-                record = column_record(name)
-            column_records.append(record)
-
-        skip_this_row = False
-        skip_next_row = False
         for row_num, raw_row in enumerate(trace_reader):
-            clean_row = []
-            for column_num, raw_data in enumerate(raw_row):
-                record = column_records[column_num]
-                if record is None:
-                    continue
-                data_type = record['type']
-                try:
-                    clean_data = converters[data_type](raw_data)
-                except ValueError as ex:
-                    print(('ValueError when converting value "{}" for field '
-                           '"{}" with type "{}"').format(
-                              raw_data, record['name'], record['type']
-                          ))
-                    raise
-                #if record['name'] == 'register' and clean_data in (152, 156):
-                    #skip_this_row = True
-                    #skip_next_row = True
-                    #break
-
-                if clean_data == '':
-                    clean_row.append(NULL_STRING)
-                else:
-                    clean_row.append(str(clean_data))
-                if data_type in int_data_types and clean_data != NULL_STRING:
-                    record['min'] = min(record['min'], clean_data)
-                    record['max'] = max(record['max'], clean_data)
-                elif data_type is DataType.varchar:
-                    if record['seen_values'] is not None:
-                        record['seen_values'].add(clean_data)
-                        if len(record['seen_values']) > ENUM_SIZE_LIMIT:
-                            record['seen_values'] = None
-                    longest = max(record['longest_length'], len(clean_data))
-                    record['longest_length'] = longest
-
-            if skip_this_row:
-                skip_this_row = False
-                continue
-
-            if clean_row[name_to_column_num['tlp_type']] != NULL_STRING:
-                #if skip_next_row:
-                    #skip_next_row = False
-                    #continue
-                #else:
-                data_file.write('\t'.join(clean_row))
+            row = clean_row(raw_row, column_records)
+            if row[tlp_type] != NULL_STRING:
+                data_file.write('\t'.join(map(str, row)))
                 data_file.write('\n')
+                row_count += 1
 
             if (row_num + 1) % 10000 == 0:
                 sys.stdout.write('.')
                 sys.stdout.flush()
     print('Done cleaning data!')
-    with open('create_table.sql', 'w') as query_file:
-        # Create enum types
-        query_file.write('DROP TABLE {}trace;\n'.format(NAMESPACE))
-        for record in column_records:
-            if record is None:
-                continue
-            seen_values = record['seen_values']
-            if isinstance(seen_values, set):
-                seen_values.discard('')
-                type_name = '{}{}_enum'.format(NAMESPACE, record['name'])
-                query_file.write('DROP TYPE ')
-                query_file.write(type_name)
-                query_file.write(';\n')
-                query_file.write('CREATE TYPE ')
-                query_file.write(type_name)
-                query_file.write(' AS ENUM (')
-                query_file.write(', '.join([
-                    "'{}'".format(enum_val) for enum_val in sorted(seen_values)
-                ]))
-                query_file.write(');\n')
-        query_file.write('CREATE TABLE {}trace (\n'.format(NAMESPACE))
-        query_file.write('\tpk SERIAL PRIMARY KEY')
-        for record in column_records:
-            if record is None:
-                continue
-            assert not record['name'] == 'pk'
-            query_file.write(',\n')
-            query_file.write('\t')
-            query_file.write(record['name'])
-            query_file.write(' ')
-            if isinstance(record['seen_values'], set):
-                query_file.write(NAMESPACE)
-                query_file.write(record['name'])
-                query_file.write('_enum')
-            elif record['type'] in int_data_types:
-                l, h = record['min'], record['max']
-                if -2 ** 31 <= l and h < 2 ** 31:
-                    query_file.write('integer')
-                else:
-                    query_file.write('bigint')
-            elif record['type'] is DataType.varchar:
-                query_file.write('varchar(')
-                query_file.write(str(record['longest_length']))
-                query_file.write(')')
-            elif record['type'] is DataType.device_id:
-                query_file.write('integer')
-        query_file.write('\n);')
+    write_sql_files(column_records, streaming=False)
+    report_rate(row_count, start)
+
+
+# Binary COPY: a signature, flags and header extension length, then for each
+# row a field count and each field as a length (-1 for NULL) and big-endian
+# value, then a field count of -1.
+COPY_SIGNATURE = b'PGCOPY\n\xff\r\n\x00' + struct.pack('>ii', 0, 0)
+COPY_TRAILER = struct.pack('>h', -1)
+COPY_NULL = struct.pack('>i', -1)
+COPY_INTEGER = struct.Struct('>ii')
+COPY_BIGINT = struct.Struct('>iQ')
+
+
+def copy_field_encoders(column_records):
+    encoders = []
+    for record in kept_records(column_records):
+        sql_type = column_sql_type(record, streaming=True)
+        name = record['name']
+        if sql_type == 'integer':
+            def encode(value, name=name):
+                if not -2 ** 31 <= value < 2 ** 31:
+                    raise ValueError('{} {} is too big for an integer '
+                                     'column.'.format(name, value))
+                return COPY_INTEGER.pack(4, value)
+        elif sql_type == 'bigint':
+            # The backends want the bits, so unsigned 64-bit values wrap.
+            def encode(value, name=name):
+                if not -2 ** 63 <= value < 2 ** 64:
+                    raise ValueError('{} {} is too big for a bigint '
+                                     'column.'.format(name, value))
+                return COPY_BIGINT.pack(8, value & (2 ** 64 - 1))
+        else:
+            labels = record['seen_values'] if is_enum(record, True) else None
+
+            def encode(value, name=name, labels=labels):
+                if labels is not None and value not in labels:
+                    raise ValueError(
+                        '{} "{}" was not in the sample, so is not in the '
+                        'enum. Try a larger --sample-rows.'.format(name, value))
+                data = value.encode('utf-8')
+                return struct.pack('>i', len(data)) + data
+        encoders.append(encode)
+    return encoders
+
+
+def copy_rows(rows, encoders, tlp_type):
+    data = bytearray()
+    field_count = struct.pack('>h', len(encoders))
+    row_count = 0
+    for row in rows:
+        if row[tlp_type] == NULL_STRING:
+            continue
+        data += field_count
+        for value, encode in zip(row, encoders):
+            data += COPY_NULL if value == NULL_STRING else encode(value)
+        row_count += 1
+    return data, row_count
+
+
+def run_psql(connection, sql):
+    subprocess.check_call(['psql', '-q', '-v', 'ON_ERROR_STOP=1',
+                           '-d', connection, '-c', sql])
+
+
+def convert_streaming(trace_file, sample_rows, chunk_rows, connection):
+    start = time.time()
+    trace_reader = csv.reader(trace_file)
+    column_records = read_column_records(trace_reader)
+    tlp_type = tlp_type_index(column_records)
+
+    sample = []
+    for raw_row in trace_reader:
+        sample.append(clean_row(raw_row, column_records))
+        if len(sample) == sample_rows:
+            break
+    write_sql_files(column_records, streaming=True)
+    encoders = copy_field_encoders(column_records)
+    column_names = ', '.join(
+        record['name'] for record in kept_records(column_records))
+
+    if connection is None:
+        copy = None
+        output_file = open('qemu_trace.copy', 'wb')
+    else:
+        run_psql(connection, create_table_sql(column_records, streaming=True))
+        copy = subprocess.Popen(
+            ['psql', '-q', '-v', 'ON_ERROR_STOP=1', '-d', connection, '-c',
+             'COPY {} ({}) FROM STDIN WITH (FORMAT binary)'.format(
+                 TABLE_NAME, column_names)],
+            stdin=subprocess.PIPE)
+        output_file = copy.stdin
+
+    output_file.write(COPY_SIGNATURE)
+    data, row_count = copy_rows(sample, encoders, tlp_type)
+    output_file.write(data)
+    del sample, data
+
+    chunk = []
+    for raw_row in trace_reader:
+        chunk.append(clean_row(raw_row, column_records, update_types=False))
+        if len(chunk) == chunk_rows:
+            data, chunk_count = copy_rows(chunk, encoders, tlp_type)
+            output_file.write(data)
+            row_count += chunk_count
+            chunk = []
+            sys.stdout.write('.')
+            sys.stdout.flush()
+    data, chunk_count = copy_rows(chunk, encoders, tlp_type)
+    output_file.write(data)
+    row_count += chunk_count
+    output_file.write(COPY_TRAILER)
+    output_file.close()
+    print()
+
+    if copy is not None:
+        if copy.wait() != 0:
+            print('COPY into {} failed.'.format(TABLE_NAME))
+            sys.exit(1)
+        report_rate(row_count, start)
+        run_psql(connection, create_indexes_sql())
+        print('Created indexes.')
+    else:
+        report_rate(row_count, start)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Convert a bus analyzer CSV into the {} table.'.format(
+            TABLE_NAME))
+    parser.add_argument('trace', metavar='INPUT.csv')
+    parser.add_argument('--stream', action='store_true',
+                        help='infer the schema from a sample and write '
+                             'binary COPY data in chunks')
+    parser.add_argument('--sample-rows', type=int,
+                        default=DEFAULT_SAMPLE_ROWS)
+    parser.add_argument('--chunk-rows', type=int, default=DEFAULT_CHUNK_ROWS)
+    parser.add_argument('--database', metavar='CONNECTION_STRING',
+                        help='with --stream, load the table through psql')
+    args = parser.parse_args()
+    if args.database is not None and not args.stream:
+        parser.error('--database needs --stream')
+    if args.sample_rows <= 0 or args.chunk_rows <= 0:
+        parser.error('--sample-rows and --chunk-rows must be positive')
+
+    with open(args.trace) as trace_file:
+        if args.stream:
+            convert_streaming(trace_file, args.sample_rows, args.chunk_rows,
+                              args.database)
+        else:
+            convert_to_text(trace_file)
 
 if __name__ == '__main__':
     main()
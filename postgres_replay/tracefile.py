@@ -0,0 +1,189 @@
+# SPDX-License-Identifier: BSD-2-Clause
+# 
+# Copyright (c) 2015-2018 Colin Rothwell
+# 
+# This software was developed by SRI International and the University of
+# Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+# ("CTSRD"), as part of the DARPA CRASH research programme.
+# 
+# We acknowledge the support of EPSRC.
+# 
+# We acknowledge the support of Arm Ltd.
+# 
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+# 
+# THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+# OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+# HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+# OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+# SUCH DAMAGE.
+
+
+# Converts a trace into the binary file that the "trace" backend
+# (pcie-trace.c) replays, so replays don't need a database.
+#
+# Usage: tracefile.py INPUT.csv OUTPUT.trace
+#
+# INPUT is either the CSV exported by the bus analyzer, as read by
+# tablefromtrace.py, or an export of the qemu_trace table:
+#   psql -c "\copy qemu_trace TO 'qemu_trace.csv' CSV HEADER"
+# The two are told apart by the table's "pk" column.
+#
+# The record layout must match struct trace_row in pcie-replay.h, and the
+# header struct trace_file_header in pcie-trace.c.
+
+from __future__ import print_function
+
+import csv
+import struct
+import sys
+
+import tablefromtrace
+
+FILE_MAGIC = 0x43415254
+FILE_VERSION = 1
+HEADER = struct.Struct('<IHHIIQQ')
+ROW = struct.Struct('<IIBBBBHHHHHHBBBBB3xQQ')
+
+TLP_TYPES = {
+    'CfgRd0': 0,
+    'CfgWr0': 1,
+    'Cpl': 2,
+    'CplD': 3,
+    'IORd': 4,
+    'IOWr': 5,
+    'MRd(32)': 6,
+    'MWr(32)': 7,
+    'Msg': 8,
+    'MsgD': 9
+}
+MSG_ROUTINGS = {'Broadcast': 3, 'Local': 4}
+MESSAGE_CODES = {
+    'PME_Turn_Off': 0x19,
+    'Set_Slot_Power_Limit': 0x50,
+    'Vendor_Defined_Type1': 0x7F
+}
+CPL_STATUSES = {'SC': 0, 'UR': 1}
+
+INT_FIELDS = ('packet', 'length', 'requester_id', 'completer_id',
+              'device_id', 'register', 'byte_cnt', 'tag', 'first_be',
+              'last_be', 'bcm', 'lwr_addr', 'address', 'data')
+
+
+def table_converter(name):
+    return lambda raw: int(raw) if raw != '' else None
+
+
+def analyzer_converter(name):
+    record = tablefromtrace.column_record_for_name(name)
+    if record is None:
+        return lambda raw: raw
+    convert = tablefromtrace.converters[record['type']]
+
+    def converter(raw):
+        value = convert(raw)
+        return None if value == tablefromtrace.NULL_STRING else value
+    return converter
+
+
+def enum_value(values, name, raw):
+    if raw == '':
+        return 0
+    if raw not in values:
+        raise ValueError('Unknown {}: "{}"'.format(name, raw))
+    return values[raw]
+
+
+def trace_row(row, pk):
+    ints = {name: row[name] or 0 for name in INT_FIELDS}
+    return ROW.pack(
+        pk,
+        ints['packet'],
+        enum_value(TLP_TYPES, 'tlp_type', row['tlp_type']),
+        enum_value(MSG_ROUTINGS, 'msg_routing', row['msg_routing']),
+        enum_value(MESSAGE_CODES, 'message_code', row['message_code']),
+        enum_value(CPL_STATUSES, 'cpl_status', row['cpl_status']),
+        ints['length'],
+        ints['requester_id'],
+        ints['completer_id'],
+        ints['device_id'],
+        ints['register'],
+        ints['byte_cnt'],
+        ints['tag'],
+        ints['first_be'],
+        ints['last_be'],
+        ints['bcm'],
+        ints['lwr_addr'],
+        ints['address'] & (2 ** 64 - 1),
+        ints['data'] & (2 ** 64 - 1))
+
+
+def read_trace(trace_file):
+    trace_reader = csv.reader(trace_file)
+    column_names = [tablefromtrace.sqlify_column_name(name)
+                    for name in next(trace_reader)]
+    from_table = 'pk' in column_names
+    make_converter = table_converter if from_table else analyzer_converter
+    converters = {}
+    for name in column_names:
+        if name in INT_FIELDS:
+            converters[name] = make_converter(name)
+        else:
+            converters[name] = lambda raw: raw
+
+    rows = {'Downstream': [], 'Upstream': []}
+    row_count = 0
+    for raw_row in trace_reader:
+        row = {name: '' for name in ('tlp_type', 'msg_routing',
+                                     'message_code', 'cpl_status')}
+        row.update({name: None for name in INT_FIELDS})
+        for name, raw in zip(column_names, raw_row):
+            row[name] = converters[name](raw)
+        if row['tlp_type'] == '':
+            continue
+        # The table's serial key counts the rows that were loaded.
+        row_count += 1
+        pk = int(row['pk']) if from_table else row_count
+        rows[row['link_dir']].append((row['packet'] or 0, trace_row(row, pk)))
+    for direction in rows.values():
+        direction.sort(key=lambda packet_and_row: packet_and_row[0])
+    return rows['Downstream'], rows['Upstream']
+
+
+def write_trace(output_file, downstream, upstream):
+    downstream_offset = HEADER.size
+    upstream_offset = downstream_offset + len(downstream) * ROW.size
+    output_file.write(HEADER.pack(FILE_MAGIC, FILE_VERSION, ROW.size,
+                                  len(downstream), len(upstream),
+                                  downstream_offset, upstream_offset))
+    for direction in (downstream, upstream):
+        for _, row in direction:
+            output_file.write(row)
+
+
+def main():
+    if len(sys.argv) != 3:
+        print('Usage: {} INPUT.csv OUTPUT.trace'.format(sys.argv[0]))
+        sys.exit(1)
+    with open(sys.argv[1]) as trace_file:
+        downstream, upstream = read_trace(trace_file)
+    with open(sys.argv[2], 'wb') as output_file:
+        write_trace(output_file, downstream, upstream)
+    print('Wrote {} downstream and {} upstream TLPs.'.format(
+        len(downstream), len(upstream)))
+
+if __name__ == '__main__':
+    main()
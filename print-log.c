@@ -0,0 +1,145 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/*
+ * Prints the binary log that log.c writes in hosted builds, formatting each
+ * record with the log_strings table from log.h, as log_print does on
+ * BAREMETAL builds. Each line is prefixed with the logging thread and the
+ * read_hw_counter() timestamp of its first record.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "log.h"
+
+#define LOG_STRING_COUNT (sizeof(log_strings) / sizeof(log_strings[0]))
+
+static void
+print_data_item(const struct log_record *record)
+{
+	switch (record->format) {
+	case LIF_BOOL:
+		printf(record->data_item ? "true" : "false");
+		break;
+	case LIF_INT_32:
+		printf("%"PRId32, (int32_t)record->data_item);
+		break;
+	case LIF_UINT_32:
+		printf("%"PRIu32, (uint32_t)record->data_item);
+		break;
+	case LIF_UINT_32_HEX:
+		printf("%08"PRIx32, (uint32_t)record->data_item);
+		break;
+	case LIF_INT_64:
+		printf("%"PRId64, (int64_t)record->data_item);
+		break;
+	case LIF_UINT_64:
+		printf("%"PRIu64, record->data_item);
+		break;
+	case LIF_UINT_64_HEX:
+		printf("%016"PRIx64, record->data_item);
+		break;
+	case LIF_NONE:
+		break;
+	default:
+		printf("<format %d>", record->format);
+	}
+}
+
+int
+main(int argc, char *argv[])
+{
+	FILE *log_file;
+	struct log_file_header header;
+	struct log_record record;
+	bool line_open = false;
+	uint16_t line_thread = 0;
+	uint64_t count = 0;
+
+	if (argc != 2) {
+		fprintf(stderr, "Usage: %s <log file>\n", argv[0]);
+		return 1;
+	}
+	log_file = fopen(argv[1], "rb");
+	if (log_file == NULL) {
+		perror("Couldn't open log");
+		return 1;
+	}
+	if (fread(&header, sizeof(header), 1, log_file) != 1 ||
+		header.magic != LOG_FILE_MAGIC ||
+		header.version != LOG_FILE_VERSION ||
+		header.record_size != sizeof(struct log_record)) {
+		fprintf(stderr, "%s is not a version %d log for this host.\n",
+			argv[1], LOG_FILE_VERSION);
+		fclose(log_file);
+		return 1;
+	}
+	if (header.string_count != LOG_STRING_COUNT) {
+		fprintf(stderr, "Warning: the log was written with %"PRIu32
+			" log strings, but log.h has %zu.\n", header.string_count,
+			LOG_STRING_COUNT);
+	}
+
+	while (fread(&record, sizeof(record), 1, log_file) == 1) {
+		/* Lines from different threads can be interleaved. */
+		if (line_open && record.thread != line_thread) {
+			putchar('\n');
+			line_open = false;
+		}
+		if (!line_open) {
+			printf("[%"PRIu16" %"PRIu64"] ", record.thread,
+				record.timestamp);
+			line_open = true;
+			line_thread = record.thread;
+		}
+		if (record.string_id >= 0 &&
+			record.string_id < LOG_STRING_COUNT) {
+			printf("%s", log_strings[record.string_id]);
+		} else if (record.string_id >= 0) {
+			printf("<string %d>", record.string_id);
+		}
+		print_data_item(&record);
+		if (record.trailing_new_line) {
+			putchar('\n');
+			line_open = false;
+		}
+		++count;
+	}
+	if (line_open) {
+		putchar('\n');
+	}
+
+	fprintf(stderr, "Printed %"PRIu64" records.\n", count);
+	fclose(log_file);
+	return 0;
+}
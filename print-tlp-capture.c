@@ -0,0 +1,275 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Converts a TLP capture into the CSV layout the bus analyzer exports, so
+ * that captures can go through postgres_replay/tablefromtrace.py and be
+ * replayed by the postgres backend like analyzer traces. As the trace table
+ * keeps data as a bigint, only the first eight bytes of each payload are
+ * written.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pcie.h"
+#include "tlp_capture.h"
+
+#define CSV_COLUMNS "Packet,Time Stamp,Link Dir,TLP Type,Length,Requester ID," \
+	"Tag,Completer ID,Address,Device ID,Register,1st BE,Last BE,Byte Cnt," \
+	"BCM,Lwr Addr,Cpl Status,Msg Routing,Message Code,Data"
+
+static const char *
+tlp_type_name(const struct tlp_capture_record *record)
+{
+	const struct TLP64DWord0 *dword0 =
+		(const struct TLP64DWord0 *)record->header;
+	enum tlp_fmt fmt = tlp_get_fmt(dword0);
+	bool data = tlp_fmt_has_data(fmt);
+	bool wide = tlp_fmt_is_4dw(fmt);
+	enum tlp_type type = tlp_get_type(dword0);
+
+	if ((type & 0x18) == MSG) {
+		return data ? "MsgD" : "Msg";
+	}
+	switch (type) {
+	case M:
+		if (data) {
+			return wide ? "MWr(64)" : "MWr(32)";
+		}
+		return wide ? "MRd(64)" : "MRd(32)";
+	case M_LK:
+		return wide ? "MRdLk(64)" : "MRdLk(32)";
+	case IO:
+		return data ? "IOWr" : "IORd";
+	case CFG_0:
+		return data ? "CfgWr0" : "CfgRd0";
+	case CFG_1:
+		return data ? "CfgWr1" : "CfgRd1";
+	case CPL:
+		return data ? "CplD" : "Cpl";
+	case CPL_LK:
+		return data ? "CplDLk" : "CplLk";
+	default:
+		return "Unknown";
+	}
+}
+
+static const char *
+cpl_status_name(uint8_t status)
+{
+	switch (status) {
+	case 0:
+		return "SC";
+	case 1:
+		return "UR";
+	case 2:
+		return "CRS";
+	case 4:
+		return "CA";
+	default:
+		return "Reserved";
+	}
+}
+
+static const char *
+msg_routing_name(enum tlp_type type)
+{
+	switch (type & 0x7) {
+	case 3:
+		return "Broadcast";
+	case 4:
+		return "Local";
+	default:
+		return "";
+	}
+}
+
+static void
+print_message_code(uint8_t code)
+{
+	switch (code) {
+	case 0x19:
+		printf("PME_Turn_Off");
+		break;
+	case 0x50:
+		printf("Set_Slot_Power_Limit");
+		break;
+	case 0x7F:
+		printf("Vendor_Defined_Type1");
+		break;
+	default:
+		printf("0x%02x", code);
+	}
+}
+
+static void
+print_id(uint16_t id)
+{
+	printf("%02x:%02x:%x", id >> 8, (id >> 3) & 0x1F, id & 0x7);
+}
+
+static void
+print_be(uint8_t be)
+{
+	for (int bit = 3; bit >= 0; --bit) {
+		putchar((be >> bit) & 1 ? '1' : '0');
+	}
+}
+
+static void
+print_record(const struct tlp_capture_record *record)
+{
+	struct TLP64DWord0 *dword0 = (struct TLP64DWord0 *)record->header;
+	struct TLP64RequestDWord1 *request =
+		(struct TLP64RequestDWord1 *)(record->header + 1);
+	struct TLP64MessageRequestDWord1 *message =
+		(struct TLP64MessageRequestDWord1 *)(record->header + 1);
+	struct TLP64CompletionDWord1 *completion =
+		(struct TLP64CompletionDWord1 *)(record->header + 1);
+	struct TLP64CompletionDWord2 *completion_dword2 =
+		(struct TLP64CompletionDWord2 *)(record->header + 2);
+	struct TLP64ConfigRequestDWord2 *config =
+		(struct TLP64ConfigRequestDWord2 *)(record->header + 2);
+	enum tlp_type type = tlp_get_type(dword0);
+	bool wide = tlp_fmt_is_4dw(tlp_get_fmt(dword0));
+	uint64_t address;
+
+	printf("%"PRIu64",%"PRIu64",%s,%s,%d,", record->sequence, record->timestamp,
+		record->direction == TCD_RECEIVED ? "Downstream" : "Upstream",
+		tlp_type_name(record), tlp_get_length(dword0));
+
+	/* Requester ID, Tag, Completer ID */
+	if (type == CPL || type == CPL_LK) {
+		print_id(tlp_get_requester_id_cpl(completion_dword2));
+		printf(",%d,", completion_dword2->tag);
+		print_id(tlp_get_completer_id(completion));
+	} else if ((type & 0x18) == MSG) {
+		print_id(tlp_get_requester_id_msg(message));
+		printf(",%d,", message->tag);
+	} else {
+		print_id(tlp_get_requester_id(request));
+		printf(",%d,", request->tag);
+	}
+	putchar(',');
+
+	/* Address, Device ID, Register */
+	if (type == M || type == M_LK || type == IO) {
+		address = wide ?
+			((uint64_t)record->header[2] << 32) | record->header[3] :
+			record->header[2];
+		printf("%"PRIx64",,", address);
+	} else if (type == CFG_0 || type == CFG_1) {
+		printf(",");
+		print_id(tlp_get_device_id(config));
+		printf(",%x", (config->ext_reg_num & 0xF) << 8 | config->reg_num);
+	} else {
+		printf(",,");
+	}
+	putchar(',');
+
+	/* 1st BE, Last BE */
+	if (type == M || type == M_LK || type == IO || type == CFG_0 ||
+		type == CFG_1) {
+		print_be(tlp_get_firstbe(request));
+		putchar(',');
+		print_be(tlp_get_lastbe(request));
+	} else {
+		putchar(',');
+	}
+	putchar(',');
+
+	/* Byte Cnt, BCM, Lwr Addr, Cpl Status */
+	if (type == CPL || type == CPL_LK) {
+		printf("%d,%d,%x,%s,", tlp_get_bytecount(completion),
+			tlp_get_bcm(completion), completion_dword2->loweraddress & 0x7F,
+			cpl_status_name(tlp_get_status(completion)));
+	} else {
+		printf(",,,,");
+	}
+
+	/* Msg Routing, Message Code */
+	if ((type & 0x18) == MSG) {
+		printf("%s,", msg_routing_name(type));
+		print_message_code(message->message_code);
+	} else {
+		putchar(',');
+	}
+	putchar(',');
+
+	/* Data, as the postgres backend reads it back. */
+	if (record->data_length >= 8) {
+		printf("%016"PRIx64,
+			((uint64_t)record->data[1] << 32) | record->data[0]);
+	} else if (record->data_length >= 4) {
+		printf("%08"PRIx32, record->data[0]);
+	}
+	putchar('\n');
+}
+
+int
+main(int argc, char *argv[])
+{
+	struct tlp_capture capture;
+	const struct tlp_capture_record *record;
+	uint64_t sequence, next;
+	uint64_t skipped = 0;
+
+	if (argc != 2) {
+		fprintf(stderr, "Usage: %s <capture file> > trace.csv\n", argv[0]);
+		return 1;
+	}
+	if (!tlp_capture_open_existing(&capture, argv[1])) {
+		return 1;
+	}
+
+	puts(CSV_COLUMNS);
+	next = capture.file->next_sequence;
+	for (sequence = tlp_capture_first_sequence(&capture); sequence < next;
+		++sequence) {
+		record = tlp_capture_get(&capture, sequence);
+		if (record == NULL) {
+			++skipped;
+			continue;
+		}
+		print_record(record);
+	}
+
+	if (skipped > 0) {
+		fprintf(stderr, "Skipped %"PRIu64" partly written records.\n",
+			skipped);
+	}
+	tlp_capture_close(&capture);
+	return 0;
+}
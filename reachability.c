@@ -0,0 +1,351 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "reachability.h"
+
+#define REACHABILITY_MAGIC 0x50414D52 /* "RMAP" on disk */
+#define REACHABILITY_VERSION 2
+
+struct reachability_file_header {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t base;
+	uint64_t pages;
+	char victim[REACHABILITY_VICTIM_BYTES]; /* NUL terminated */
+};
+
+struct reachability_run {
+	uint64_t first_page;
+	uint64_t pages;
+	uint32_t state;
+	uint32_t reserved;
+};
+
+bool
+reachability_init(struct reachability_map *map, uint64_t base,
+	uint64_t length)
+{
+	memset(map, 0, sizeof(*map));
+	map->base = base >> REACHABILITY_PAGE_BITS;
+	map->pages = length >> REACHABILITY_PAGE_BITS;
+	if (map->pages == 0) {
+		return false;
+	}
+	map->allowed = hbitmap_alloc(map->pages, 0);
+	map->unsupported = hbitmap_alloc(map->pages, 0);
+	return map->allowed != NULL && map->unsupported != NULL;
+}
+
+void
+reachability_destroy(struct reachability_map *map)
+{
+	if (map->allowed != NULL) {
+		hbitmap_free(map->allowed);
+	}
+	if (map->unsupported != NULL) {
+		hbitmap_free(map->unsupported);
+	}
+	map->allowed = map->unsupported = NULL;
+}
+
+/*
+ * Converts [address, address + length) to the pages of the map it covers,
+ * clipped to the covered range. Returns false if none are covered.
+ */
+static bool
+page_range(const struct reachability_map *map, uint64_t address,
+	uint64_t length, uint64_t *first, uint64_t *end)
+{
+	uint64_t last_page = (address + (length > 0 ? length - 1 : 0)) >>
+		REACHABILITY_PAGE_BITS;
+	uint64_t first_page = address >> REACHABILITY_PAGE_BITS;
+
+	if (last_page < map->base || first_page >= map->base + map->pages) {
+		return false;
+	}
+	*first = first_page > map->base ? first_page - map->base : 0;
+	*end = last_page - map->base < map->pages ? last_page - map->base + 1 :
+		map->pages;
+	return true;
+}
+
+static inline enum reachability
+page_state(const struct reachability_map *map, uint64_t page)
+{
+	if (hbitmap_get(map->allowed, page)) {
+		return RS_ALLOWED;
+	} else if (hbitmap_get(map->unsupported, page)) {
+		return RS_UNSUPPORTED;
+	}
+	return RS_UNKNOWN;
+}
+
+static void
+set_pages(struct reachability_map *map, uint64_t first, uint64_t count,
+	enum reachability state)
+{
+	hbitmap_reset(map->allowed, first, count);
+	hbitmap_reset(map->unsupported, first, count);
+	if (state == RS_ALLOWED) {
+		hbitmap_set(map->allowed, first, count);
+	} else if (state == RS_UNSUPPORTED) {
+		hbitmap_set(map->unsupported, first, count);
+	}
+}
+
+enum reachability
+reachability_get(const struct reachability_map *map, uint64_t address)
+{
+	uint64_t first, end;
+
+	if (!page_range(map, address, 1, &first, &end)) {
+		return RS_UNKNOWN;
+	}
+	return page_state(map, first);
+}
+
+bool
+reachability_may_read(const struct reachability_map *map, uint64_t address,
+	uint64_t length)
+{
+	HBitmapIter iter;
+	uint64_t first, end;
+	int64_t next;
+
+	if (!page_range(map, address, length, &first, &end)) {
+		return true;
+	}
+	/* One walk down the tree, however long the range. */
+	hbitmap_iter_init(&iter, map->unsupported, first);
+	next = hbitmap_iter_next(&iter);
+	return next < 0 || (uint64_t)next >= end;
+}
+
+void
+reachability_record(struct reachability_map *map, uint64_t address,
+	uint64_t length, enum dma_read_response response)
+{
+	uint64_t first, end;
+
+	if (!page_range(map, address, length, &first, &end)) {
+		return;
+	}
+	if (response == DRR_SUCCESS) {
+		set_pages(map, first, end - first, RS_ALLOWED);
+	} else if (response == DRR_UNSUPPORTED_REQUEST && end - first == 1) {
+		/* A failure across several pages doesn't say which one failed. */
+		set_pages(map, first, 1, RS_UNSUPPORTED);
+	}
+}
+
+static enum reachability
+probe_page(struct reachability_map *map, uint64_t page,
+	ReachabilityProbe probe, void *opaque)
+{
+	uint64_t address = (map->base + page) << REACHABILITY_PAGE_BITS;
+
+	++map->probes;
+	reachability_record(map, address, 1, probe(address, opaque));
+	return page_state(map, page);
+}
+
+/*
+ * Binary searches between an unsupported page and an allowed one for the
+ * allowed page nearest the unsupported one, then marks the unknown pages
+ * from there to the allowed page as allowed. Returns the probes made.
+ */
+static uint64_t
+find_edge(struct reachability_map *map, uint64_t unsupported,
+	uint64_t allowed, uint64_t max_probes, ReachabilityProbe probe,
+	void *opaque)
+{
+	uint64_t outside = unsupported, inside = allowed, middle, probes = 0;
+	uint64_t low, high;
+	enum reachability state;
+
+	while ((outside > inside ? outside - inside : inside - outside) > 1) {
+		middle = outside < inside ? outside + (inside - outside) / 2 :
+			outside - (outside - inside) / 2;
+		state = page_state(map, middle);
+		if (state == RS_UNKNOWN) {
+			if (probes == max_probes) {
+				break;
+			}
+			++probes;
+			state = probe_page(map, middle, probe, opaque);
+		}
+		if (state == RS_ALLOWED) {
+			inside = middle;
+		} else if (state == RS_UNSUPPORTED) {
+			outside = middle;
+		} else {
+			break; /* No answer; leave the rest unknown */
+		}
+	}
+
+	low = inside < allowed ? inside : allowed;
+	high = inside < allowed ? allowed : inside;
+	for (uint64_t page = low; page <= high; ++page) {
+		if (page_state(map, page) == RS_UNKNOWN) {
+			set_pages(map, page, 1, RS_ALLOWED);
+			++map->inferred;
+		}
+	}
+	return probes;
+}
+
+uint64_t
+reachability_probe(struct reachability_map *map, uint64_t start,
+	uint64_t length, uint64_t stride_pages, uint64_t max_probes,
+	ReachabilityProbe probe, void *opaque)
+{
+	uint64_t first, end, page, probes = 0;
+
+	if (stride_pages == 0 || length == 0 ||
+		!page_range(map, start, length, &first, &end)) {
+		return 0;
+	}
+
+	for (page = first; page < end && probes < max_probes;
+		page += stride_pages) {
+		if (page_state(map, page) == RS_UNKNOWN) {
+			probe_page(map, page, probe, opaque);
+			++probes;
+		}
+	}
+
+	for (page = first; page < end && probes < max_probes;
+		page += stride_pages) {
+		if (page_state(map, page) != RS_ALLOWED) {
+			continue;
+		}
+		if (page >= first + stride_pages &&
+			page_state(map, page - stride_pages) == RS_UNSUPPORTED) {
+			probes += find_edge(map, page - stride_pages, page,
+				max_probes - probes, probe, opaque);
+		}
+		if (page + stride_pages < end &&
+			page_state(map, page + stride_pages) == RS_UNSUPPORTED) {
+			probes += find_edge(map, page + stride_pages, page,
+				max_probes - probes, probe, opaque);
+		}
+	}
+	return probes;
+}
+
+static bool
+save_runs(FILE *file, const HBitmap *bitmap, enum reachability state)
+{
+	struct reachability_run run = { .pages = 0, .state = state };
+	HBitmapIter iter;
+	int64_t page;
+
+	hbitmap_iter_init(&iter, bitmap, 0);
+	while ((page = hbitmap_iter_next(&iter)) >= 0) {
+		if (run.pages > 0 && page == run.first_page + run.pages) {
+			++run.pages;
+			continue;
+		}
+		if (run.pages > 0 && fwrite(&run, sizeof(run), 1, file) != 1) {
+			return false;
+		}
+		run.first_page = page;
+		run.pages = 1;
+	}
+	return run.pages == 0 || fwrite(&run, sizeof(run), 1, file) == 1;
+}
+
+bool
+reachability_save(const struct reachability_map *map, const char *path,
+	const char *victim)
+{
+	struct reachability_file_header header = {
+		.magic = REACHABILITY_MAGIC,
+		.version = REACHABILITY_VERSION,
+		.base = map->base,
+		.pages = map->pages
+	};
+	FILE *file;
+	bool saved;
+
+	if (strlen(victim) >= sizeof(header.victim)) {
+		return false;
+	}
+	strcpy(header.victim, victim);
+	file = fopen(path, "wb");
+	if (file == NULL) {
+		return false;
+	}
+	saved = fwrite(&header, sizeof(header), 1, file) == 1 &&
+		save_runs(file, map->allowed, RS_ALLOWED) &&
+		save_runs(file, map->unsupported, RS_UNSUPPORTED);
+	return fclose(file) == 0 && saved;
+}
+
+bool
+reachability_load(struct reachability_map *map, const char *path,
+	const char *victim)
+{
+	struct reachability_file_header header;
+	struct reachability_run run;
+	FILE *file = fopen(path, "rb");
+	bool loaded;
+
+	if (file == NULL) {
+		return false;
+	}
+	loaded = fread(&header, sizeof(header), 1, file) == 1 &&
+		header.magic == REACHABILITY_MAGIC &&
+		header.version == REACHABILITY_VERSION &&
+		header.base == map->base && header.pages == map->pages;
+	if (loaded && strncmp(header.victim, victim, sizeof(header.victim)) != 0) {
+		fprintf(stderr, "%s maps victim \"%.*s\", not \"%s\". "
+			"Ignoring it.\n", path, (int)sizeof(header.victim),
+			header.victim, victim);
+		loaded = false;
+	}
+	while (loaded && fread(&run, sizeof(run), 1, file) == 1) {
+		if (run.pages == 0 || run.first_page >= map->pages ||
+			run.pages > map->pages - run.first_page ||
+			(run.state != RS_ALLOWED && run.state != RS_UNSUPPORTED)) {
+			loaded = false;
+			break;
+		}
+		set_pages(map, run.first_page, run.pages, run.state);
+	}
+	fclose(file);
+	return loaded;
+}
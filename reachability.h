@@ -0,0 +1,131 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef REACHABILITY_H
+#define REACHABILITY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pcie.h"
+#include "qemu/hbitmap.h"
+
+/*
+ * A map of which pages of the host's address space the IOMMU lets us read,
+ * so that DMA users can skip pages known to give Unsupported Requests instead
+ * of trying them again, and so that a scan need not start from nothing on
+ * each run against the same victim.
+ *
+ * Every page in the covered range is unknown, allowed or unsupported. Reads
+ * that neither complete nor fail with UR, because of timeouts or chewed
+ * TLPs, leave the page as it was.
+ */
+
+#define REACHABILITY_PAGE_BITS 12
+#define REACHABILITY_VICTIM_BYTES 64
+
+enum reachability {
+	RS_UNKNOWN,
+	RS_ALLOWED,
+	RS_UNSUPPORTED
+};
+
+struct reachability_map {
+	uint64_t base;
+	uint64_t pages;
+	HBitmap *allowed;
+	HBitmap *unsupported;
+
+	uint64_t probes;
+	uint64_t inferred; /* Pages marked allowed without being read */
+};
+
+/*
+ * Reads a small amount at address for reachability_probe, and returns
+ * the response.
+ */
+typedef enum dma_read_response (*ReachabilityProbe)(uint64_t address,
+	void *opaque);
+
+/* Covers length bytes from base, both page aligned. */
+bool
+reachability_init(struct reachability_map *map, uint64_t base,
+	uint64_t length);
+
+void
+reachability_destroy(struct reachability_map *map);
+
+/* Addresses outside the covered range are always unknown. */
+enum reachability
+reachability_get(const struct reachability_map *map, uint64_t address);
+
+/* Returns true if no page in the range is known to give UR. */
+bool
+reachability_may_read(const struct reachability_map *map, uint64_t address,
+	uint64_t length);
+
+/* Records the result of a read of length bytes at address. */
+void
+reachability_record(struct reachability_map *map, uint64_t address,
+	uint64_t length, enum dma_read_response response);
+
+/*
+ * Maps unknown parts of [start, start + length) with at most max_probes
+ * reads. One page in every stride_pages is probed first. Then, wherever an
+ * allowed sample neighbours an unsupported one, the edge between them is
+ * found by binary search and the pages from the sample to the edge are
+ * marked allowed, as IOMMU mappings are contiguous runs of pages. Probing
+ * the range again with a smaller stride finds smaller mappings. Returns the
+ * number of probes made.
+ */
+uint64_t
+reachability_probe(struct reachability_map *map, uint64_t start,
+	uint64_t length, uint64_t stride_pages, uint64_t max_probes,
+	ReachabilityProbe probe, void *opaque);
+
+/*
+ * Saves the known pages as runs, labelled with the victim they were learnt
+ * from: what the IOMMU maps differs between machines and between boots of
+ * one machine. victim must be shorter than REACHABILITY_VICTIM_BYTES. A map
+ * loads only into one with the same covered range, and only for the same
+ * victim.
+ */
+bool
+reachability_save(const struct reachability_map *map, const char *path,
+	const char *victim);
+
+bool
+reachability_load(struct reachability_map *map, const char *path,
+	const char *victim);
+
+#endif
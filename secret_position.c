@@ -33,36 +33,13 @@
  * SUCH DAMAGE.
  */
 
+#include "page_scanner.h"
 #include "secret_position.h"
 
 int
 secret_position(uint8_t page[4096], int start_position, uint8_t secret_char,
 	int pattern_length)
 {
-	/*putchar('s');*/
-	/*fflush(stdout);*/
-
-	int64_t i, j;
-	uint64_t run_length;
-	for (i = start_position; i < 4096; i += pattern_length) {
-		if (page[i] == secret_char) {
-			run_length = 1;
-			j = i;
-			while (run_length < pattern_length && ++j < 4096 &&
-				page[j] == secret_char) {
-				++run_length;
-			}
-			j = i;
-			while (--j >= start_position && page[j] == secret_char) {
-				++run_length;
-			}
-			if (run_length >= pattern_length) {
-				break;
-			}
-		}
-	}
-	if (run_length >= pattern_length) {
-		return (j + 1); /* We decrement it by 1 breaking out of the loop */
-	}
-	return -1;
+	return page_find_byte_run(page, start_position, secret_char,
+		pattern_length);
 }
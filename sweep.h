@@ -0,0 +1,133 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Reads every page of a list of address ranges, a batch of
+ * SWEEP_PAGES_IN_FLIGHT pages at a time, using maximum-size read requests
+ * that are all in flight together. Each page that reads completely is
+ * passed to every registered consumer. Pages refused by dma_read_hooks, such
+ * as those a reachability map knows give UR, are skipped without a TLP, and
+ * the result of each page read is passed to the hooks.
+ *
+ * A sweep advances only when sweep_step is called, so it can be interleaved
+ * with answering the host's TLPs, and its position can be checkpointed to a
+ * file and resumed in a later run.
+ */
+
+#define SWEEP_PAGE_BYTES 4096
+#define SWEEP_PAGES_IN_FLIGHT 4 /* 32 requests of 512 bytes */
+#define SWEEP_MAX_CONSUMERS 8
+#define SWEEP_MAX_RANGES 64
+
+struct sweep_range {
+	uint64_t start; /* Page aligned */
+	uint64_t end; /* Exclusive */
+};
+
+typedef void (*SweepConsumer)(uint64_t address, const uint8_t *page,
+	void *opaque);
+
+struct sweep {
+	struct sweep_range ranges[SWEEP_MAX_RANGES];
+	int range_count;
+	uint16_t requester_id;
+	uint8_t first_tag;
+
+	/* Position: the next page to read */
+	int range;
+	uint64_t next;
+
+	SweepConsumer consumers[SWEEP_MAX_CONSUMERS];
+	void *consumer_opaques[SWEEP_MAX_CONSUMERS];
+	int consumer_count;
+
+	uint64_t total_pages;
+	uint64_t pages_read;
+	uint64_t pages_failed;
+	uint64_t pages_skipped;
+	uint64_t started_ns;
+	uint64_t elapsed_ns; /* Before started_ns, for resumed sweeps */
+};
+
+/* Returns false if there are too many ranges or one is not page aligned. */
+bool
+sweep_init(struct sweep *sweep, const struct sweep_range *ranges,
+	int range_count, uint16_t requester_id, uint8_t first_tag);
+
+/* Returns false if SWEEP_MAX_CONSUMERS are already registered. */
+bool
+sweep_add_consumer(struct sweep *sweep, SweepConsumer consumer,
+	void *opaque);
+
+/*
+ * Reads the next batch of pages and hands them to the consumers. Returns the
+ * number of pages dealt with, including skipped and failed ones, or 0 once
+ * the sweep is finished.
+ */
+int
+sweep_step(struct sweep *sweep);
+
+bool
+sweep_finished(const struct sweep *sweep);
+
+/* Starts a new pass from the first range, with fresh counts. */
+void
+sweep_restart(struct sweep *sweep);
+
+/* The fraction of pages dealt with, and the read rate so far. */
+double
+sweep_coverage(const struct sweep *sweep);
+
+double
+sweep_bytes_per_second(const struct sweep *sweep);
+
+void
+sweep_print_progress(const struct sweep *sweep);
+
+/*
+ * Saves the position and counts. A checkpoint loads only into a sweep with
+ * the same ranges.
+ */
+bool
+sweep_save_checkpoint(const struct sweep *sweep, const char *path);
+
+bool
+sweep_load_checkpoint(struct sweep *sweep, const char *path);
+
+#endif
@@ -0,0 +1,165 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Correctness check and throughput benchmark for net_checksum_add_cont. The
+ * reference is the original byte-at-a-time loop, which every accelerated
+ * kernel must match exactly for all lengths, alignments and seq parities.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "net/checksum.h"
+
+static uint32_t
+reference_checksum_add_cont(int len, uint8_t *buf, int seq)
+{
+	uint32_t sum = 0;
+	int i;
+
+	for (i = seq; i < seq + len; i++) {
+		if (i & 1) {
+			sum += (uint32_t)buf[i - seq];
+		} else {
+			sum += (uint32_t)buf[i - seq] << 8;
+		}
+	}
+	return sum;
+}
+
+static uint64_t
+nanoseconds(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static int
+check_correctness(uint8_t *buffer, int buffer_length)
+{
+	int failures = 0;
+	int len, align, seq;
+	uint32_t expected, actual;
+
+	for (len = 0; len < 300; ++len) {
+		for (align = 0; align < 8; ++align) {
+			for (seq = 0; seq < 4; ++seq) {
+				expected = reference_checksum_add_cont(len, buffer + align,
+					seq);
+				actual = net_checksum_add_cont(len, buffer + align, seq);
+				if (expected != actual) {
+					printf("FAIL len %d align %d seq %d: 0x%x != 0x%x\n",
+						len, align, seq, actual, expected);
+					++failures;
+				}
+			}
+		}
+	}
+
+	/* Largest TSO frame, all 0xFF, to check the accumulators do not wrap. */
+	memset(buffer, 0xFF, buffer_length);
+	for (seq = 0; seq < 2; ++seq) {
+		expected = reference_checksum_add_cont(buffer_length - 1, buffer + 1,
+			seq);
+		actual = net_checksum_add_cont(buffer_length - 1, buffer + 1, seq);
+		if (expected != actual) {
+			printf("FAIL saturated seq %d: 0x%x != 0x%x\n", seq, actual,
+				expected);
+			++failures;
+		}
+	}
+
+	return failures;
+}
+
+static double
+time_checksum(uint32_t (*checksum)(int, uint8_t *, int), uint8_t *buffer,
+	int length, int iterations)
+{
+	volatile uint32_t sink = 0;
+	uint64_t start, end;
+	int i;
+
+	start = nanoseconds();
+	for (i = 0; i < iterations; ++i) {
+		sink += checksum(length, buffer, i);
+	}
+	end = nanoseconds();
+	(void)sink;
+
+	return ((double)length * iterations) / ((end - start) / 1e9) / 1e6;
+}
+
+int
+main(int argc, char *argv[])
+{
+	static const int FRAME_SIZES[] =
+		{ 60, 64, 128, 256, 576, 1514, 4096, 9014, 65535 };
+	const int buffer_length = 65536 + 8;
+	uint8_t *buffer = malloc(buffer_length);
+	int failures, i, iterations;
+	double reference_mbs, kernel_mbs;
+
+	srandom(0x7C5);
+	for (i = 0; i < buffer_length; ++i) {
+		buffer[i] = random();
+	}
+
+	failures = check_correctness(buffer, buffer_length);
+	printf("Correctness: %s (%d failures).\n", failures ? "FAILED" : "OK",
+		failures);
+
+	for (i = 0; i < buffer_length; ++i) {
+		buffer[i] = random();
+	}
+
+	printf("%8s %14s %14s %8s\n", "bytes", "reference MB/s", "kernel MB/s",
+		"speedup");
+	for (i = 0; i < sizeof(FRAME_SIZES) / sizeof(FRAME_SIZES[0]); ++i) {
+		iterations = (64 << 20) / FRAME_SIZES[i];
+		reference_mbs = time_checksum(reference_checksum_add_cont, buffer,
+			FRAME_SIZES[i], iterations);
+		kernel_mbs = time_checksum(net_checksum_add_cont, buffer,
+			FRAME_SIZES[i], iterations);
+		printf("%8d %14.1f %14.1f %7.2fx\n", FRAME_SIZES[i], reference_mbs,
+			kernel_mbs, kernel_mbs / reference_mbs);
+	}
+
+	free(buffer);
+	return failures != 0;
+}
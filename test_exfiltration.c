@@ -0,0 +1,326 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Correctness check and benchmark for the exfiltration writer. Records are
+ * synthesised to look like captured pages: runs of zeros, repeated small
+ * structures with kernel pointers and stretches of incompressible data.
+ * Zero and repeated pages check deduplication.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "exfiltration.h"
+
+#define RECORD_COUNT 2000
+#define CAPTURE_PATH "/tmp/test_exfiltration.bin"
+
+static uint64_t
+nanoseconds(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static void
+fill_record(uint8_t *data, int length)
+{
+	int offset = 0, run;
+
+	while (offset < length) {
+		run = 8 + random() % 512;
+		if (run > length - offset) {
+			run = length - offset;
+		}
+		switch (random() % 4) {
+		case 0:
+			memset(data + offset, 0, run);
+			break;
+		case 1:
+			for (int i = 0; i < run; ++i) {
+				data[offset + i] = random();
+			}
+			break;
+		default:
+			/* A 32-byte structure, repeated with small differences */
+			for (int i = 0; i < run; ++i) {
+				data[offset + i] = i % 32 < 8 ? 0xff : (i / 32 + i % 32) & 0xf;
+			}
+		}
+		offset += run;
+	}
+}
+
+static int
+check_round_trip(uint8_t *data, uint8_t *compressed, uint8_t *output)
+{
+	int failures = 0, length, stored, restored;
+
+	for (int round = 0; round < 1000; ++round) {
+		length = random() % (EXFIL_MAX_RECORD_BYTES + 1);
+		fill_record(data, length);
+		stored = exfil_compress(data, length, compressed,
+			EXFIL_MAX_RECORD_BYTES * 2);
+		restored = exfil_decompress(compressed, stored, output,
+			EXFIL_MAX_RECORD_BYTES);
+		if (stored == 0 || restored != length ||
+			memcmp(data, output, length) != 0) {
+			printf("FAIL round trip %d: length %d, stored %d, restored %d\n",
+				round, length, stored, restored);
+			++failures;
+		}
+		/* Output that does not fit must be refused, not overrun. */
+		if (stored > 1 &&
+			exfil_compress(data, length, compressed, stored - 1) != 0) {
+			printf("FAIL round %d: compressed into too small a buffer\n",
+				round);
+			++failures;
+		}
+	}
+	return failures;
+}
+
+static int
+check_malformed(uint8_t *data, uint8_t *compressed, uint8_t *output)
+{
+	int failures = 0, stored;
+
+	fill_record(data, 4096);
+	stored = exfil_compress(data, 4096, compressed, 8192);
+	/* Truncated and corrupted input must fail cleanly. */
+	for (int round = 0; round < 1000; ++round) {
+		int length = random() % (stored + 1);
+		compressed[random() % stored] ^= 1 << (random() % 8);
+		if (exfil_decompress(compressed, length, output, 4096) > 4096) {
+			++failures;
+		}
+	}
+	return failures;
+}
+
+/*
+ * Pages under the same key but with different contents must not match, and
+ * a full store must forget a page that has not matched rather than one that
+ * has.
+ */
+static int
+check_page_store(uint8_t *data, uint8_t *output)
+{
+	struct page_store store;
+	struct page_key key_a, key_b, key_c;
+	uint64_t location;
+	int failures = 0;
+
+	if (!page_store_init(&store, 2)) {
+		printf("FAIL creating a page store\n");
+		return 1;
+	}
+	fill_record(data, 4096);
+	memcpy(output, data, 4096);
+	output[100] ^= 1;
+	page_key_of(data, &key_a);
+	if (page_store_find_or_add(&store, &key_a, data, 1, &location) ||
+		page_store_find_or_add(&store, &key_a, output, 2, &location) ||
+		!page_store_find_or_add(&store, &key_a, data, 3, &location) ||
+		location != 1) {
+		printf("FAIL matching a page by its key alone\n");
+		++failures;
+	}
+
+	page_key_of(output, &key_b);
+	page_store_find_or_add(&store, &key_b, output, 4, &location);
+	output[200] ^= 1;
+	page_key_of(output, &key_c);
+	page_store_find_or_add(&store, &key_c, output, 5, &location);
+	output[200] ^= 1;
+	if (!page_store_find_or_add(&store, &key_a, data, 6, &location) ||
+		page_store_find_or_add(&store, &key_b, output, 7, &location)) {
+		printf("FAIL forgetting the least recently matched page\n");
+		++failures;
+	}
+	page_store_destroy(&store);
+	return failures;
+}
+
+/*
+ * Every fourth record is a zero page, and every fourth a copy of one of
+ * DISTINCT_PAGES pages; the rest are unique and of other lengths.
+ */
+#define DISTINCT_PAGES 16
+
+static int
+make_record(int record, uint8_t *data)
+{
+	int length;
+
+	switch (record % 4) {
+	case 0:
+		memset(data, 0, 4096);
+		return 4096;
+	case 1:
+		srandom(1 + record / 4 % DISTINCT_PAGES);
+		fill_record(data, 4096);
+		return 4096;
+	default:
+		srandom(record);
+		length = 1 + random() % EXFIL_MAX_RECORD_BYTES;
+		length = length == 4096 ? 4095 : length;
+		fill_record(data, length);
+		return length;
+	}
+}
+
+static int
+check_writer(uint8_t *data, uint8_t *output)
+{
+	struct exfil_writer writer;
+	struct exfil_index_entry entry;
+	struct exfil_record_header header;
+	FILE *capture, *index;
+	int failures = 0, record, length;
+
+	if (!exfil_writer_open(&writer, CAPTURE_PATH)) {
+		printf("FAIL opening %s\n", CAPTURE_PATH);
+		return 1;
+	}
+	for (record = 0; record < RECORD_COUNT; ++record) {
+		length = make_record(record, data);
+		while (!exfil_submit(&writer, ERT_PAGE, record * 4096ULL, data,
+				length)) {
+			usleep(100);
+		}
+	}
+	exfil_writer_close(&writer);
+	if (writer.written != RECORD_COUNT || writer.write_errors != 0) {
+		printf("FAIL writer wrote %llu records, %llu errors\n",
+			(unsigned long long)writer.written,
+			(unsigned long long)writer.write_errors);
+		++failures;
+	}
+	if (writer.zero_pages != RECORD_COUNT / 4 ||
+		writer.duplicate_pages != RECORD_COUNT / 4 - DISTINCT_PAGES) {
+		printf("FAIL writer found %llu zero and %llu duplicate pages\n",
+			(unsigned long long)writer.zero_pages,
+			(unsigned long long)writer.duplicate_pages);
+		++failures;
+	}
+
+	capture = fopen(CAPTURE_PATH, "rb");
+	index = fopen(CAPTURE_PATH ".idx", "rb");
+	for (record = 0; capture != NULL && index != NULL &&
+			fread(&entry, sizeof(entry), 1, index) == 1; ++record) {
+		length = make_record(record, data);
+		if (entry.sequence != record || entry.iova != record * 4096ULL ||
+			exfil_read_record(capture, entry.offset, &header, output,
+				EXFIL_MAX_RECORD_BYTES) != length ||
+			memcmp(data, output, length) != 0) {
+			printf("FAIL reading record %d\n", record);
+			++failures;
+		}
+	}
+	if (record != RECORD_COUNT) {
+		printf("FAIL index holds %d records\n", record);
+		++failures;
+	}
+	if (capture != NULL) {
+		fseek(capture, 0, SEEK_END);
+		if (ftell(capture) % EXFIL_ALIGNMENT != 0) {
+			printf("FAIL capture is not padded to alignment\n");
+			++failures;
+		}
+		fclose(capture);
+	}
+	if (index != NULL) {
+		fclose(index);
+	}
+	unlink(CAPTURE_PATH);
+	unlink(CAPTURE_PATH ".idx");
+	return failures;
+}
+
+int
+main(int argc, char *argv[])
+{
+	uint8_t *data = malloc(EXFIL_MAX_RECORD_BYTES);
+	uint8_t *compressed = malloc(EXFIL_MAX_RECORD_BYTES * 2);
+	uint8_t *output = malloc(EXFIL_MAX_RECORD_BYTES);
+	uint64_t start, elapsed, stored = 0;
+	struct page_key key;
+	int failures;
+
+	srandom(0xE8F1);
+	failures = check_round_trip(data, compressed, output);
+	failures += check_malformed(data, compressed, output);
+	failures += check_page_store(data, output);
+	failures += check_writer(data, output);
+	printf("Correctness: %s (%d failures).\n", failures ? "FAILED" : "OK",
+		failures);
+
+	fill_record(data, 4096);
+	start = nanoseconds();
+	for (int round = 0; round < 20000; ++round) {
+		stored += exfil_compress(data, 4096, compressed,
+			EXFIL_MAX_RECORD_BYTES * 2);
+	}
+	elapsed = nanoseconds() - start;
+	printf("Compression: %.1f MB/s, ratio %.2f.\n",
+		4096.0 * 20000 / (elapsed / 1e9) / 1e6, 4096.0 * 20000 / stored);
+
+	start = nanoseconds();
+	for (int round = 0; round < 20000; ++round) {
+		exfil_decompress(compressed, stored / 20000, output, 4096);
+	}
+	elapsed = nanoseconds() - start;
+	printf("Decompression: %.1f MB/s.\n",
+		4096.0 * 20000 / (elapsed / 1e9) / 1e6);
+
+	start = nanoseconds();
+	for (int round = 0; round < 20000; ++round) {
+		page_key_of(data, &key);
+		data[round % 4096] ^= key.low;
+	}
+	elapsed = nanoseconds() - start;
+	printf("Page hashing: %.1f MB/s.\n",
+		4096.0 * 20000 / (elapsed / 1e9) / 1e6);
+
+	free(data);
+	free(compressed);
+	free(output);
+	return failures != 0;
+}
@@ -0,0 +1,224 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Correctness check and benchmark for the KASLR slide inference engine. Pages
+ * are synthesised with random data, heap pointers and occasional slid symbol
+ * pointers, as a DMA reader would see in mbuf and kernel heap pages.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "kaslr.h"
+
+static const struct kaslr_symbol SYMBOLS[] = {
+	{ "m_bigfree", 0xffffff8000baa2d0 },
+	{ "m_16kfree", 0xffffff8000baa300 },
+	{ "mcache_panic", 0xffffff8000b78580 },
+	{ "panic", 0xffffff80002de6b0 },
+};
+#define SYMBOL_COUNT (sizeof(SYMBOLS) / sizeof(SYMBOLS[0]))
+#define ALIGNMENT 0x200000ULL
+#define MAX_SLIDE (ALIGNMENT * 255)
+
+static uint64_t
+nanoseconds(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static uint64_t
+random64(void)
+{
+	return (uint64_t)random() << 33 ^ (uint64_t)random() << 11 ^ random();
+}
+
+static void
+put_le64(uint8_t *bytes, uint64_t value)
+{
+	for (int i = 0; i < 8; ++i) {
+		bytes[i] = value >> (i * 8);
+	}
+}
+
+/*
+ * One in symbol_rate pages carries a single slid symbol pointer; every page
+ * has some heap pointers, which must not mislead the engine.
+ */
+static void
+fill_page(uint8_t *page, uint64_t slide, int page_number, int symbol_rate)
+{
+	for (int offset = 0; offset < 4096; offset += 8) {
+		switch (random() % 8) {
+		case 0:
+			put_le64(page + offset,
+				0xffffff8000000000ULL | (random64() & 0x7FFFFFFFF8ULL));
+			break;
+		case 1:
+			put_le64(page + offset, 0);
+			break;
+		default:
+			put_le64(page + offset, random64());
+		}
+	}
+	if (symbol_rate > 0 && page_number % symbol_rate == 0) {
+		put_le64(page + 8 * (random() % 512),
+			SYMBOLS[random() % SYMBOL_COUNT].address + slide);
+	}
+}
+
+static int
+check_pointer_finder(uint8_t *page)
+{
+	uint64_t pointers[512];
+	uint16_t offsets[512];
+	int failures = 0;
+
+	for (int round = 0; round < 100; ++round) {
+		int expected = 0, found;
+		fill_page(page, 0, round, 1);
+		found = kaslr_find_kernel_pointers(page, pointers, offsets, 512);
+		for (int offset = 0; offset < 4096; offset += 8) {
+			uint64_t value = 0;
+			for (int i = 7; i >= 0; --i) {
+				value = value << 8 | page[offset + i];
+			}
+			if ((value >> 47) != 0x1FFFF) {
+				continue;
+			}
+			if (expected >= found || pointers[expected] != value ||
+				offsets[expected] != offset) {
+				++failures;
+				break;
+			}
+			++expected;
+		}
+		if (expected != found) {
+			printf("FAIL pointer finder round %d: %d != %d\n", round,
+				found, expected);
+			++failures;
+		}
+	}
+	return failures;
+}
+
+static int
+check_inference(uint8_t *page, int symbol_rate, int *pages_needed)
+{
+	struct kaslr_engine engine;
+	uint64_t slide = ALIGNMENT * (1 + random() % 255), estimate;
+	int page_number;
+
+	kaslr_init(&engine, SYMBOLS, SYMBOL_COUNT, ALIGNMENT, MAX_SLIDE, 2);
+	for (page_number = 0; page_number < 10000; ++page_number) {
+		fill_page(page, slide, page_number, symbol_rate);
+		if (kaslr_add_page(&engine, page)) {
+			break;
+		}
+	}
+	*pages_needed = engine.pages_to_confidence;
+	if (!kaslr_confident(&engine) || !kaslr_best_slide(&engine, &estimate) ||
+		estimate != slide) {
+		printf("FAIL inference: slide 0x%llx, confident %d\n",
+			(unsigned long long)slide, kaslr_confident(&engine));
+		return 1;
+	}
+	return 0;
+}
+
+static int
+check_no_symbols(uint8_t *page)
+{
+	struct kaslr_engine engine;
+
+	kaslr_init(&engine, SYMBOLS, SYMBOL_COUNT, ALIGNMENT, MAX_SLIDE, 2);
+	for (int page_number = 0; page_number < 2000; ++page_number) {
+		fill_page(page, 0, page_number, 0);
+		if (kaslr_add_page(&engine, page)) {
+			printf("FAIL confident after %d pages of heap pointers\n",
+				page_number + 1);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+	static const int SYMBOL_RATES[] = { 1, 4, 16 };
+	const int page_count = 256;
+	uint8_t *pages = malloc(page_count * 4096);
+	int failures, pages_needed, total;
+	struct kaslr_engine engine;
+	uint64_t start, elapsed;
+
+	srandom(0x51DE);
+	failures = check_pointer_finder(pages);
+	failures += check_no_symbols(pages);
+	for (int r = 0; r < sizeof(SYMBOL_RATES) / sizeof(SYMBOL_RATES[0]); ++r) {
+		total = 0;
+		for (int trial = 0; trial < 20; ++trial) {
+			failures += check_inference(pages, SYMBOL_RATES[r],
+				&pages_needed);
+			total += pages_needed;
+		}
+		printf("One symbol pointer per %2d pages: %.1f pages to a confident "
+			"slide.\n", SYMBOL_RATES[r], total / 20.0);
+	}
+	printf("Correctness: %s (%d failures).\n", failures ? "FAILED" : "OK",
+		failures);
+
+	for (int i = 0; i < page_count; ++i) {
+		fill_page(pages + i * 4096, 0, i, 0);
+	}
+	kaslr_init(&engine, SYMBOLS, SYMBOL_COUNT, ALIGNMENT, MAX_SLIDE, 2);
+	start = nanoseconds();
+	for (int round = 0; round < 50; ++round) {
+		for (int i = 0; i < page_count; ++i) {
+			kaslr_add_page(&engine, pages + i * 4096);
+		}
+	}
+	elapsed = nanoseconds() - start;
+	printf("Scanning: %.1f MB/s.\n",
+		(double)page_count * 4096 * 50 / (elapsed / 1e9) / 1e6);
+
+	free(pages);
+	return failures != 0;
+}
@@ -0,0 +1,261 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Round trip check for window deltas. Several versions of a few pages are
+ * written through the exfiltration writer as the window monitor writes
+ * them, and every version must come back byte for byte from
+ * page_delta_reconstruct. Two of the pages share a cache slot, so each
+ * spends stretches refused by the cache and stored as keyframes.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "exfiltration.h"
+#include "page_delta.h"
+
+#define CAPTURE_PATH "/tmp/test_page_delta.bin"
+#define CACHE_PAGES 4
+#define KEYFRAME_INTERVAL 32
+#define ROUNDS 200
+#define PAGE_COUNT 3
+
+/* The first two share cache slot 0; the third has slot 1 to itself. */
+static const uint64_t IOVAS[PAGE_COUNT] = { 0x10000, 0x14000, 0x21000 };
+
+struct version {
+	uint64_t sequence;
+	enum page_delta_kind kind;
+	uint8_t page[PAGE_DELTA_PAGE_BYTES];
+};
+
+static struct version versions[PAGE_COUNT][ROUNDS];
+static int version_counts[PAGE_COUNT];
+
+/*
+ * Mostly a few small edits, as a changing kernel structure would make; now
+ * and then more than half the page changes, or nothing does.
+ */
+static void
+change_page(uint8_t *page, int round)
+{
+	int edits, offset, length;
+
+	if (round % 17 == 5) {
+		return;
+	}
+	if (round % 80 == 60) {
+		for (int i = 0; i < PAGE_DELTA_PAGE_BYTES * 3 / 4; ++i) {
+			page[random() % PAGE_DELTA_PAGE_BYTES] = random();
+		}
+		return;
+	}
+	for (edits = 1 + random() % 3; edits > 0; --edits) {
+		length = 8 + random() % 56;
+		offset = random() % (PAGE_DELTA_PAGE_BYTES - length);
+		for (int i = 0; i < length; ++i) {
+			page[offset + i] = random();
+		}
+	}
+}
+
+/*
+ * Whether page is left alone this round. The two pages sharing a slot take
+ * turns to be idle, so that each holds the slot for a stretch of rounds with
+ * every version of the other refused. A refused keyframe must not restart
+ * the holder's chain, or it would run past KEYFRAME_INTERVAL.
+ */
+static bool
+is_idle(int page, int round)
+{
+	return (page == 0 && round % 80 >= 40 && round % 80 < 43) ||
+		(page == 1 && round % 80 < 3);
+}
+
+static int
+write_versions(struct exfil_writer *writer, struct page_delta_encoder *encoder)
+{
+	uint8_t pages[PAGE_COUNT][PAGE_DELTA_PAGE_BYTES];
+	uint64_t sequence = 0;
+	enum page_delta_kind kind;
+	const uint8_t *output;
+	struct version *version;
+	int length;
+
+	for (int p = 0; p < PAGE_COUNT; ++p) {
+		for (int i = 0; i < PAGE_DELTA_PAGE_BYTES; ++i) {
+			pages[p][i] = random() % 4 ? 0 : random();
+		}
+	}
+	for (int round = 0; round < ROUNDS; ++round) {
+		for (int p = 0; p < PAGE_COUNT; ++p) {
+			if (is_idle(p, round)) {
+				continue;
+			}
+			change_page(pages[p], round);
+			kind = page_delta_encode(encoder, IOVAS[p], pages[p], &output,
+				&length);
+			if (kind == PDK_UNCHANGED) {
+				continue;
+			}
+			while (!exfil_submit(writer,
+					kind == PDK_DELTA ? ERT_WINDOW_DELTA : ERT_WINDOW,
+					IOVAS[p], output, length)) {
+				usleep(100);
+			}
+			page_delta_stored(encoder, IOVAS[p], kind);
+
+			version = &versions[p][version_counts[p]++];
+			version->sequence = sequence++;
+			version->kind = kind;
+			memcpy(version->page, pages[p], PAGE_DELTA_PAGE_BYTES);
+		}
+	}
+	return 0;
+}
+
+/* Checks the encoder's choices of keyframe against the rules. */
+static int
+check_kinds(void)
+{
+	int failures = 0, chain, refused = 0;
+
+	for (int p = 0; p < PAGE_COUNT; ++p) {
+		chain = 0;
+		for (int v = 0; v < version_counts[p]; ++v) {
+			chain = versions[p][v].kind == PDK_DELTA ? chain + 1 : 0;
+			if (chain >= KEYFRAME_INTERVAL) {
+				printf("FAIL page %d: %d deltas in a row\n", p, chain);
+				++failures;
+			}
+			/* A keyframe that followed another cached version of this page */
+			if (p < 2 && v > 0 && versions[p][v].kind == PDK_KEYFRAME &&
+				versions[p][v - 1].kind == PDK_KEYFRAME) {
+				++refused;
+			}
+		}
+	}
+	if (refused == 0) {
+		printf("FAIL no page was refused its cache slot\n");
+		++failures;
+	}
+	return failures;
+}
+
+static int
+check_reconstruct(void)
+{
+	uint8_t page[PAGE_DELTA_PAGE_BYTES];
+	FILE *capture = fopen(CAPTURE_PATH, "rb");
+	FILE *index = fopen(CAPTURE_PATH ".idx", "rb");
+	const struct version *version;
+	int failures = 0;
+	int64_t found;
+
+	if (capture == NULL || index == NULL) {
+		printf("FAIL opening the capture\n");
+		return 1;
+	}
+	for (int p = 0; p < PAGE_COUNT; ++p) {
+		for (int v = 0; v < version_counts[p]; ++v) {
+			version = &versions[p][v];
+			found = page_delta_reconstruct(capture, index, IOVAS[p],
+				version->sequence, page);
+			if (found != (int64_t)version->sequence ||
+				memcmp(page, version->page, sizeof(page)) != 0) {
+				printf("FAIL page %d version %d: found %lld\n", p, v,
+					(long long)found);
+				++failures;
+			}
+			/* Later records of other pages don't change this one. */
+			if (v + 1 < version_counts[p] &&
+				versions[p][v + 1].sequence > version->sequence + 1 &&
+				(page_delta_reconstruct(capture, index, IOVAS[p],
+					version->sequence + 1, page) !=
+					(int64_t)version->sequence ||
+				memcmp(page, version->page, sizeof(page)) != 0)) {
+				printf("FAIL page %d after version %d\n", p, v);
+				++failures;
+			}
+		}
+	}
+	if (page_delta_reconstruct(capture, index, 0x30000, ~0ULL, page) != -1) {
+		printf("FAIL reconstructed a page that was never captured\n");
+		++failures;
+	}
+	fclose(capture);
+	fclose(index);
+	return failures;
+}
+
+int
+main(int argc, char *argv[])
+{
+	struct exfil_writer writer;
+	struct page_delta_encoder encoder;
+	int failures = 0;
+
+	srandom(0xDE17A);
+	if (!exfil_writer_open(&writer, CAPTURE_PATH) ||
+		!page_delta_init(&encoder, CACHE_PAGES, KEYFRAME_INTERVAL)) {
+		printf("FAIL setting up\n");
+		return 1;
+	}
+	write_versions(&writer, &encoder);
+	exfil_writer_close(&writer);
+	if (encoder.keyframes == 0 || encoder.deltas == 0 ||
+		encoder.delta_bytes == 0 ||
+		encoder.delta_bytes >= encoder.deltas * PAGE_DELTA_PAGE_BYTES / 2) {
+		printf("FAIL encoder stored %llu keyframes and %llu deltas\n",
+			(unsigned long long)encoder.keyframes,
+			(unsigned long long)encoder.deltas);
+		++failures;
+	}
+	failures += check_kinds();
+	failures += check_reconstruct();
+	printf("Correctness: %s (%d failures).\n", failures ? "FAILED" : "OK",
+		failures);
+	printf("Stored %llu keyframes and %llu deltas of %llu bytes.\n",
+		(unsigned long long)encoder.keyframes,
+		(unsigned long long)encoder.deltas,
+		(unsigned long long)encoder.delta_bytes);
+
+	page_delta_destroy(&encoder);
+	unlink(CAPTURE_PATH);
+	unlink(CAPTURE_PATH ".idx");
+	return failures != 0;
+}
@@ -0,0 +1,291 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Checks reachability_probe against a fake IOMMU with known mapped runs of
+ * pages: sparse probing must find the runs that hold a sample, the binary
+ * search must put their edges exactly where they are, nothing outside a run
+ * may be marked allowed, and the probe budget must be kept.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "reachability.h"
+
+#define MAP_PAGES 4096
+#define STRIDE_PAGES 64
+#define MAP_PATH "/tmp/test_reachability.map"
+
+struct page_run {
+	uint64_t first;
+	uint64_t end;
+};
+
+/*
+ * Runs and gaps are at least a stride long, except the one run that holds
+ * no sample at STRIDE_PAGES and so needs a finer pass.
+ */
+static const struct page_run MAPPED[] = {
+	{ 0, 100 }, { 300, 520 }, { 1000, 1010 }, { 2048, 3000 },
+	{ 4000, MAP_PAGES }
+};
+#define MAPPED_COUNT (sizeof(MAPPED) / sizeof(MAPPED[0]))
+#define UNSAMPLED_RUN 2
+
+struct fake_iommu {
+	enum dma_read_response unmapped; /* The response outside the runs */
+	uint64_t probes;
+};
+
+static int
+mapped_run(uint64_t page)
+{
+	for (int i = 0; i < MAPPED_COUNT; ++i) {
+		if (page >= MAPPED[i].first && page < MAPPED[i].end) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+static enum dma_read_response
+fake_probe(uint64_t address, void *opaque)
+{
+	struct fake_iommu *iommu = opaque;
+
+	++iommu->probes;
+	return mapped_run(address >> REACHABILITY_PAGE_BITS) >= 0 ? DRR_SUCCESS :
+		iommu->unmapped;
+}
+
+static enum reachability
+page_state(const struct reachability_map *map, uint64_t page)
+{
+	return reachability_get(map, page << REACHABILITY_PAGE_BITS);
+}
+
+/*
+ * No page outside a run may be allowed, nor a page in one give UR. The runs
+ * in found must have both edges in place: their first and last pages
+ * allowed, and the pages either side known to give UR. Pages between two
+ * allowed samples may stay unknown, as they could be a gap between runs.
+ */
+static int
+check_states(const struct reachability_map *map, const bool *found,
+	const char *pass)
+{
+	enum reachability state;
+	int failures = 0, run;
+
+	for (uint64_t page = 0; page < MAP_PAGES; ++page) {
+		state = page_state(map, page);
+		run = mapped_run(page);
+		if ((run < 0 && state == RS_ALLOWED) ||
+			(run >= 0 && state == RS_UNSUPPORTED)) {
+			printf("FAIL %s: page %llu is %d\n", pass,
+				(unsigned long long)page, state);
+			++failures;
+		}
+	}
+	for (int i = 0; i < MAPPED_COUNT; ++i) {
+		if (!found[i]) {
+			continue;
+		}
+		if ((MAPPED[i].first > 0 &&
+			(page_state(map, MAPPED[i].first) != RS_ALLOWED ||
+			page_state(map, MAPPED[i].first - 1) != RS_UNSUPPORTED)) ||
+			(MAPPED[i].end < MAP_PAGES &&
+			(page_state(map, MAPPED[i].end - 1) != RS_ALLOWED ||
+			page_state(map, MAPPED[i].end) != RS_UNSUPPORTED))) {
+			printf("FAIL %s: edges of run %d not found\n", pass, i);
+			++failures;
+		}
+	}
+	return failures;
+}
+
+static int
+check_probe(void)
+{
+	struct reachability_map map;
+	struct fake_iommu iommu = { .unmapped = DRR_UNSUPPORTED_REQUEST };
+	bool found[MAPPED_COUNT];
+	uint64_t probes;
+	int failures = 0;
+
+	if (!reachability_init(&map, 0,
+			(uint64_t)MAP_PAGES << REACHABILITY_PAGE_BITS)) {
+		printf("FAIL allocating the map\n");
+		return 1;
+	}
+	for (int i = 0; i < MAPPED_COUNT; ++i) {
+		found[i] = i != UNSAMPLED_RUN;
+	}
+
+	probes = reachability_probe(&map, 0,
+		(uint64_t)MAP_PAGES << REACHABILITY_PAGE_BITS, STRIDE_PAGES, ~0ULL,
+		fake_probe, &iommu);
+	failures += check_states(&map, found, "sparse pass");
+	/* A sample per stride and a binary search per inner edge */
+	if (probes != iommu.probes || probes > MAP_PAGES / STRIDE_PAGES + 6 * 7) {
+		printf("FAIL sparse pass made %llu probes, reported %llu\n",
+			(unsigned long long)iommu.probes, (unsigned long long)probes);
+		++failures;
+	}
+	if (map.inferred == 0) {
+		printf("FAIL sparse pass inferred no pages\n");
+		++failures;
+	}
+
+	/* A finer pass finds the small run and reprobes nothing known. */
+	iommu.probes = 0;
+	probes = reachability_probe(&map, 0,
+		(uint64_t)MAP_PAGES << REACHABILITY_PAGE_BITS, 8, ~0ULL,
+		fake_probe, &iommu);
+	found[UNSAMPLED_RUN] = true;
+	failures += check_states(&map, found, "fine pass");
+	if (probes != iommu.probes || probes > MAP_PAGES / 8) {
+		printf("FAIL fine pass made %llu probes\n",
+			(unsigned long long)iommu.probes);
+		++failures;
+	}
+	iommu.probes = 0;
+	reachability_probe(&map, 0, (uint64_t)MAP_PAGES << REACHABILITY_PAGE_BITS,
+		8, ~0ULL, fake_probe, &iommu);
+	if (iommu.probes != 0) {
+		printf("FAIL repeating a pass made %llu probes\n",
+			(unsigned long long)iommu.probes);
+		++failures;
+	}
+	reachability_destroy(&map);
+	return failures;
+}
+
+static int
+check_budget_and_timeouts(void)
+{
+	struct reachability_map map;
+	struct fake_iommu iommu = { .unmapped = DRR_UNSUPPORTED_REQUEST };
+	bool found[MAPPED_COUNT] = { false };
+	uint64_t probes;
+	int failures = 0;
+
+	/* 16 samples, leaving two probes for the edge searches */
+	reachability_init(&map, 0, (uint64_t)MAP_PAGES << REACHABILITY_PAGE_BITS);
+	probes = reachability_probe(&map, 0,
+		(uint64_t)1024 << REACHABILITY_PAGE_BITS, STRIDE_PAGES, 18,
+		fake_probe, &iommu);
+	if (probes != 18 || iommu.probes != 18) {
+		printf("FAIL a budget of 18 made %llu probes\n",
+			(unsigned long long)iommu.probes);
+		++failures;
+	}
+	failures += check_states(&map, found, "limited pass");
+	reachability_destroy(&map);
+
+	/* Reads that time out say nothing, so no edge is inferred from them. */
+	reachability_init(&map, 0, (uint64_t)MAP_PAGES << REACHABILITY_PAGE_BITS);
+	iommu.unmapped = DRR_NO_RESPONSE;
+	reachability_probe(&map, 0, (uint64_t)MAP_PAGES << REACHABILITY_PAGE_BITS,
+		STRIDE_PAGES, ~0ULL, fake_probe, &iommu);
+	failures += check_states(&map, found, "timeout pass");
+	if (map.inferred != 0) {
+		printf("FAIL inferred %llu pages next to timeouts\n",
+			(unsigned long long)map.inferred);
+		++failures;
+	}
+	reachability_destroy(&map);
+	return failures;
+}
+
+static int
+check_save_and_load(void)
+{
+	struct reachability_map map, loaded;
+	struct fake_iommu iommu = { .unmapped = DRR_UNSUPPORTED_REQUEST };
+	int failures = 0;
+
+	reachability_init(&map, 0, (uint64_t)MAP_PAGES << REACHABILITY_PAGE_BITS);
+	reachability_probe(&map, 0, (uint64_t)MAP_PAGES << REACHABILITY_PAGE_BITS,
+		STRIDE_PAGES, ~0ULL, fake_probe, &iommu);
+	if (!reachability_save(&map, MAP_PATH, "victim-a")) {
+		printf("FAIL saving the map\n");
+		reachability_destroy(&map);
+		return 1;
+	}
+
+	reachability_init(&loaded, 0,
+		(uint64_t)MAP_PAGES << REACHABILITY_PAGE_BITS);
+	if (!reachability_load(&loaded, MAP_PATH, "victim-a")) {
+		printf("FAIL loading the map\n");
+		++failures;
+	}
+	for (uint64_t page = 0; page < MAP_PAGES; ++page) {
+		if (reachability_get(&loaded, page << REACHABILITY_PAGE_BITS) !=
+			reachability_get(&map, page << REACHABILITY_PAGE_BITS)) {
+			printf("FAIL loaded page %llu differs\n",
+				(unsigned long long)page);
+			++failures;
+			break;
+		}
+	}
+	reachability_destroy(&loaded);
+
+	reachability_init(&loaded, 0,
+		(uint64_t)MAP_PAGES << REACHABILITY_PAGE_BITS);
+	if (reachability_load(&loaded, MAP_PATH, "victim-b") ||
+		reachability_get(&loaded, 0) != RS_UNKNOWN) {
+		printf("FAIL loaded another victim's map\n");
+		++failures;
+	}
+	reachability_destroy(&loaded);
+	reachability_destroy(&map);
+	unlink(MAP_PATH);
+	return failures;
+}
+
+int
+main(int argc, char *argv[])
+{
+	int failures;
+
+	failures = check_probe();
+	failures += check_budget_and_timeouts();
+	failures += check_save_and_load();
+	printf("Correctness: %s (%d failures).\n", failures ? "FAILED" : "OK",
+		failures);
+	return failures != 0;
+}
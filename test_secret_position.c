@@ -33,52 +33,104 @@
  * SUCH DAMAGE.
  */
 
+/*
+ * Correctness check and throughput benchmark for secret_position and
+ * page_scan. The reference is the original sampling loop from
+ * secret_position.c, which the vectorised run finder must match for every
+ * start position and run length.
+ */
+
 #include <stdio.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
+#include "page_scanner.h"
 #include "secret_position.h"
 
-int run_test(uint8_t *page, char *test_string)
+static int
+reference_secret_position(uint8_t page[4096], int start_position,
+	uint8_t secret_char, int pattern_length)
 {
-	strncpy(page, test_string, 4096);
-	return secret_position(page, 0, 'i', 4);
+	int64_t i, j = 0;
+	uint64_t run_length = 0;
+	for (i = start_position; i < 4096; i += pattern_length) {
+		if (page[i] == secret_char) {
+			run_length = 1;
+			j = i;
+			while (run_length < pattern_length && ++j < 4096 &&
+				page[j] == secret_char) {
+				++run_length;
+			}
+			j = i;
+			while (--j >= start_position && page[j] == secret_char) {
+				++run_length;
+			}
+			if (run_length >= pattern_length) {
+				break;
+			}
+		}
+	}
+	if (run_length >= pattern_length) {
+		return (j + 1);
+	}
+	return -1;
 }
 
-int test_secret_position_main(int argc, char *argv[])
+static uint64_t
+nanoseconds(void)
 {
-	uint8_t page[4096];
-	char *test1 = "aaaaaaaaiiiaaiiiaiii";
-	printf("t1 (-1?): %d\n", run_test(page, test1));
-
-	char *test2 = "iiiiaa";
-	printf("t2 (0?): %d\n", run_test(page, test2));
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
 
-	char *test3 = "aiiiia";
-	printf("t3 (1?): %d\n", run_test(page, test3));
+static int
+expect(const char *name, int actual, int expected)
+{
+	if (actual != expected) {
+		printf("FAIL %s: %d != %d\n", name, actual, expected);
+		return 1;
+	}
+	return 0;
+}
 
-	char *test4 = "aiiiiia";
-	printf("t4 (1?): %d\n", run_test(page, test4));
+static int
+run_test(uint8_t *page, char *test_string)
+{
+	memset(page, 0, 4096);
+	strncpy((char *)page, test_string, 4096);
+	return secret_position(page, 0, 'i', 4);
+}
 
-	char *test5 = "iiiiaaaaiiii";
-	strncpy(page, test5, 4096);
+static int
+check_examples(uint8_t *page)
+{
+	int failures = 0;
 	int pos1, pos2;
+
+	failures += expect("t1", run_test(page, "aaaaaaaaiiiaaiiiaiii"), -1);
+	failures += expect("t2", run_test(page, "iiiiaa"), 0);
+	failures += expect("t3", run_test(page, "aiiiia"), 1);
+	failures += expect("t4", run_test(page, "aiiiiia"), 1);
+
+	run_test(page, "iiiiaaaaiiii");
 	pos1 = secret_position(page, 0, 'i', 4);
 	pos2 = secret_position(page, (pos1 + 4), 'i', 4);
-	printf("t5 p1 (0?): %d; p2 (8?): %d\n", pos1, pos2);
+	failures += expect("t5 p1", pos1, 0) + expect("t5 p2", pos2, 8);
 
-	char *test6 = "iiiiiaaaaiiii";
-	strncpy(page, test6, 4096);
+	run_test(page, "iiiiiaaaaiiii");
 	pos1 = secret_position(page, 0, 'i', 4);
 	pos2 = secret_position(page, (pos1 + 4), 'i', 4);
-	printf("t6 p1 (0?): %d; p2 (9?): %d\n", pos1, pos2);
+	failures += expect("t6 p1", pos1, 0) + expect("t6 p2", pos2, 9);
 
-	char *test7 = "iiiiiiii";
-	strncpy(page, test7, 4096);
+	run_test(page, "iiiiiiii");
 	pos1 = secret_position(page, 0, 'i', 4);
 	pos2 = secret_position(page, (pos1 + 4), 'i', 4);
-	printf("t7 p1 (0?): %d; p2 (4?): %d\n", pos1, pos2);
+	failures += expect("t7 p1", pos1, 0) + expect("t7 p2", pos2, 4);
 
+	memset(page, 0, 4096);
 	page[0] = 0;
 	page[1] = 1;
 	page[2] = 2;
@@ -88,7 +140,274 @@ int test_secret_position_main(int argc, char *argv[])
 	page[6] = 0xFF;
 	page[7] = 8;
 	page[8] = 9;
-	printf("t8 (3?): %d\n", secret_position(page, 0, 0xFF, 4));
+	failures += expect("t8", secret_position(page, 0, 0xFF, 4), 3);
 
-	return 0;
+	/* Runs that cross the 64 byte chunks and the end of the page */
+	memset(page, 0, 4096);
+	memset(page + 60, 'i', 70);
+	failures += expect("t9", secret_position(page, 0, 'i', 70), 60);
+	failures += expect("t10", secret_position(page, 0, 'i', 71), -1);
+	memset(page + 4090, 'i', 6);
+	failures += expect("t11", secret_position(page, 200, 'i', 6), 4090);
+	failures += expect("t12", secret_position(page, 4093, 'i', 3), 4093);
+
+	return failures;
+}
+
+/* Pages with runs of a few bytes, so that short runs are common. */
+static void
+fill_runs(uint8_t *page)
+{
+	int i = 0, length;
+	while (i < 4096) {
+		uint8_t byte = "iiab"[random() % 4];
+		length = 1 + random() % 12;
+		while (length-- > 0 && i < 4096) {
+			page[i++] = byte;
+		}
+	}
+}
+
+static int
+check_random_runs(uint8_t *page)
+{
+	int failures = 0;
+	int round, start, length;
+
+	for (round = 0; round < 200; ++round) {
+		fill_runs(page);
+		for (length = 1; length <= 16; ++length) {
+			for (start = 0; start < 4096; start += 1 + random() % 97) {
+				int expected = reference_secret_position(page, start,
+					'i', length);
+				int actual = secret_position(page, start, 'i', length);
+				if (expected != actual) {
+					printf("FAIL round %d start %d length %d: "
+						"%d != %d\n", round, start, length, actual,
+						expected);
+					++failures;
+				}
+			}
+		}
+	}
+	return failures;
+}
+
+static int
+compare_matches(const void *a, const void *b)
+{
+	const struct scan_match *left = a, *right = b;
+	if (left->pattern != right->pattern) {
+		return left->pattern - right->pattern;
+	}
+	return left->offset - right->offset;
+}
+
+/* Every match of every pattern, found one offset and pattern at a time. */
+static int
+brute_force_scan(const struct scan_pattern *patterns, int pattern_count,
+	const uint8_t *page, struct scan_match *matches)
+{
+	int found = 0;
+	int p, i;
+
+	for (p = 0; p < pattern_count; ++p) {
+		const struct scan_pattern *pattern = &patterns[p];
+		for (i = 0; i < 4096; ++i) {
+			bool match = false;
+			int j;
+			switch (pattern->type) {
+			case SPT_BYTE_RUN:
+				if (i > 0 && page[i - 1] == pattern->run.byte) {
+					break;
+				}
+				for (j = i; j < 4096 && page[j] == pattern->run.byte; ++j);
+				match = j - i >= pattern->run.run_length;
+				break;
+			case SPT_BYTES:
+				match = i + pattern->string.length <= 4096 &&
+					memcmp(page + i, pattern->string.bytes,
+						pattern->string.length) == 0;
+				break;
+			case SPT_MASKED_U64:
+				if (i % 8 == 0) {
+					uint64_t word = 0;
+					for (j = 7; j >= 0; --j) {
+						word = (word << 8) | page[i + j];
+					}
+					match = (word & pattern->masked.mask) ==
+						pattern->masked.value;
+				}
+				break;
+			}
+			if (match) {
+				matches[found].pattern = p;
+				matches[found].offset = i;
+				++found;
+			}
+		}
+	}
+	return found;
+}
+
+static int
+check_page_scan(uint8_t *page)
+{
+	static const uint8_t needle1[] = "iab";
+	static const uint8_t needle2[] = "ab";
+	static const uint8_t needle3[] = "iiaiia";
+	static const uint8_t needle4[] = { 0xFF, 0x7F, 0x00, 0x00 };
+	const struct scan_pattern patterns[] = {
+		{ .type = SPT_BYTE_RUN, .run = { 'i', 4 } },
+		{ .type = SPT_BYTES, .string = { needle1, 3 } },
+		{ .type = SPT_BYTE_RUN, .run = { 'i', 7 } },
+		{ .type = SPT_BYTES, .string = { needle2, 2 } },
+		{ .type = SPT_BYTES, .string = { needle3, 6 } },
+		{ .type = SPT_MASKED_U64, .masked = { 0x6969, 0xFFFF } },
+		{ .type = SPT_BYTES, .string = { needle4, 4 } },
+		{ .type = SPT_BYTE_RUN, .run = { 0, 9 } },
+	};
+	const int pattern_count = sizeof(patterns) / sizeof(patterns[0]);
+	static struct scan_match expected[8 * 4096], actual[8 * 4096];
+	struct page_scanner scanner;
+	int failures = 0;
+	int round, count, expected_count, actual_count, i;
+
+	for (count = 1; count <= pattern_count; ++count) {
+		if (!page_scanner_init(&scanner, patterns, count)) {
+			printf("FAIL page_scanner_init %d\n", count);
+			return 1;
+		}
+		for (round = 0; round < 100; ++round) {
+			if (round % 2 == 0) {
+				fill_runs(page);
+			} else {
+				/* Mostly empty, to exercise block skipping */
+				memset(page, 0, 4096);
+				for (i = 0; i < 16; ++i) {
+					memcpy(page + random() % 4080, "iiiiiiiab\xFF\x7F",
+						1 + random() % 11);
+				}
+			}
+			expected_count = brute_force_scan(patterns, count, page,
+				expected);
+			actual_count = page_scan(&scanner, page, actual,
+				8 * 4096);
+			qsort(actual, actual_count, sizeof(actual[0]),
+				compare_matches);
+			if (expected_count != actual_count ||
+				memcmp(expected, actual,
+					actual_count * sizeof(actual[0])) != 0) {
+				printf("FAIL page_scan patterns %d round %d: "
+					"%d matches, expected %d\n", count, round,
+					actual_count, expected_count);
+				++failures;
+			}
+		}
+	}
+	return failures;
+}
+
+static double
+megabytes_per_second(uint64_t ns, int page_count, int rounds)
+{
+	return (double)page_count * 4096 * rounds / (ns / 1e9) / 1e6;
+}
+
+static void
+benchmark(uint8_t *pages, int page_count)
+{
+	static const int RUN_LENGTHS[] = { 4, 8, 16, 32, 64 };
+	const int run_count = sizeof(RUN_LENGTHS) / sizeof(RUN_LENGTHS[0]);
+	struct scan_pattern patterns[sizeof(RUN_LENGTHS) / sizeof(RUN_LENGTHS[0])];
+	struct page_scanner scanner;
+	struct scan_match matches[64];
+	volatile int sink = 0;
+	uint64_t start, reference_ns, wrapper_ns;
+	int round, i, r;
+	const int rounds = 50;
+
+	printf("%8s %14s %14s %8s\n", "run", "reference MB/s", "scanner MB/s",
+		"speedup");
+	for (r = 0; r < run_count; ++r) {
+		start = nanoseconds();
+		for (round = 0; round < rounds; ++round) {
+			for (i = 0; i < page_count; ++i) {
+				sink += reference_secret_position(pages + i * 4096, 0,
+					'i', RUN_LENGTHS[r]);
+			}
+		}
+		reference_ns = nanoseconds() - start;
+
+		start = nanoseconds();
+		for (round = 0; round < rounds; ++round) {
+			for (i = 0; i < page_count; ++i) {
+				sink += secret_position(pages + i * 4096, 0, 'i',
+					RUN_LENGTHS[r]);
+			}
+		}
+		wrapper_ns = nanoseconds() - start;
+
+		printf("%8d %14.1f %14.1f %7.2fx\n", RUN_LENGTHS[r],
+			megabytes_per_second(reference_ns, page_count, rounds),
+			megabytes_per_second(wrapper_ns, page_count, rounds),
+			(double)reference_ns / wrapper_ns);
+	}
+
+	/* One page_scan for every signature against one search per signature */
+	for (r = 0; r < run_count; ++r) {
+		patterns[r].type = SPT_BYTE_RUN;
+		patterns[r].run.byte = "iIjJ\xFF"[r];
+		patterns[r].run.run_length = RUN_LENGTHS[r];
+	}
+	page_scanner_init(&scanner, patterns, run_count);
+
+	start = nanoseconds();
+	for (round = 0; round < rounds; ++round) {
+		for (i = 0; i < page_count; ++i) {
+			for (r = 0; r < run_count; ++r) {
+				sink += reference_secret_position(pages + i * 4096, 0,
+					patterns[r].run.byte, RUN_LENGTHS[r]);
+			}
+		}
+	}
+	reference_ns = nanoseconds() - start;
+
+	start = nanoseconds();
+	for (round = 0; round < rounds; ++round) {
+		for (i = 0; i < page_count; ++i) {
+			sink += page_scan(&scanner, pages + i * 4096, matches, 64);
+		}
+	}
+	wrapper_ns = nanoseconds() - start;
+	(void)sink;
+
+	printf("%8s %14.1f %14.1f %7.2fx\n", "all",
+		megabytes_per_second(reference_ns, page_count, rounds),
+		megabytes_per_second(wrapper_ns, page_count, rounds),
+		(double)reference_ns / wrapper_ns);
+}
+
+int
+main(int argc, char *argv[])
+{
+	const int page_count = 256;
+	uint8_t *pages = malloc(page_count * 4096);
+	int failures, i;
+
+	srandom(0x5EC);
+	failures = check_examples(pages);
+	failures += check_random_runs(pages);
+	failures += check_page_scan(pages);
+	printf("Correctness: %s (%d failures).\n", failures ? "FAILED" : "OK",
+		failures);
+
+	/* Mostly random memory, as found in a kernel heap */
+	for (i = 0; i < page_count * 4096; ++i) {
+		pages[i] = random() % 8 ? random() : 0;
+	}
+	benchmark(pages, page_count);
+
+	free(pages);
+	return failures != 0;
 }
@@ -0,0 +1,225 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Correctness check and benchmark for the table-driven Toeplitz RSS hash.
+ * Both the bitwise net_toeplitz_add and the precomputed tables are checked
+ * against the verification suite from Microsoft's RSS specification, and
+ * against each other on random IPv4 and IPv6 TCP/UDP tuples.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <arpa/inet.h>
+
+#include "net/checksum.h"
+
+static uint8_t RSS_KEY[40] = {
+	0x6d, 0x5a, 0x56, 0xda, 0x25, 0x5b, 0x0e, 0xc2,
+	0x41, 0x67, 0x25, 0x3d, 0x43, 0xa3, 0x8f, 0xb0,
+	0xd0, 0xca, 0x2b, 0xcb, 0xae, 0x7b, 0x30, 0xb4,
+	0x77, 0xcb, 0x2d, 0xa3, 0x80, 0x30, 0xf2, 0x0c,
+	0x6a, 0x42, 0xb7, 0x3b, 0xbe, 0xac, 0x01, 0xfa
+};
+
+struct rss_vector {
+	int family;
+	const char *source;
+	const char *destination;
+	uint16_t source_port;
+	uint16_t destination_port;
+	uint32_t address_hash;
+	uint32_t port_hash;
+};
+
+static const struct rss_vector RSS_VECTORS[] = {
+	{ AF_INET, "66.9.149.187", "161.142.100.80", 2794, 1766,
+		0x323e8fc2, 0x51ccc178 },
+	{ AF_INET, "199.92.111.2", "65.69.140.83", 14230, 4739,
+		0xd718262a, 0xc626b0ea },
+	{ AF_INET, "24.19.198.95", "12.22.207.184", 12898, 38024,
+		0xd2d0a5de, 0x5c2b394a },
+	{ AF_INET, "38.27.205.30", "209.142.163.6", 48228, 2217,
+		0x82989176, 0xafc7327f },
+	{ AF_INET, "153.39.163.191", "202.188.127.2", 44251, 1303,
+		0x5d1809c5, 0x10e828a2 },
+	{ AF_INET6, "3ffe:2501:200:1fff::7", "3ffe:2501:200:3::1", 2794, 1766,
+		0x2cc18cd5, 0x40207d3d },
+	{ AF_INET6, "3ffe:501:8::260:97ff:fe40:efab", "ff02::1", 14230, 4739,
+		0x0f0c461c, 0xdde51bbf },
+	{ AF_INET6, "3ffe:1900:4545:3:200:f8ff:fe21:67cf",
+		"fe80::200:f8ff:fe21:67cf", 44251, 38024,
+		0x4b61e985, 0x02d1feef },
+};
+
+static uint32_t
+bitwise_hash(uint8_t *input, uint32_t length)
+{
+	uint32_t result = 0;
+	net_toeplitz_key key;
+
+	net_toeplitz_key_init(&key, RSS_KEY);
+	net_toeplitz_add(&result, input, length, &key);
+	return result;
+}
+
+/* Same layout as _net_rx_rss_prepare_ip4/ip6 followed by _tcp. */
+static uint32_t
+build_input(const struct rss_vector *vector, uint8_t *input, bool ports)
+{
+	uint32_t address_length =
+		vector->family == AF_INET ? 4 : 16;
+	uint16_t port;
+
+	inet_pton(vector->family, vector->source, input);
+	inet_pton(vector->family, vector->destination, input + address_length);
+	if (!ports) {
+		return 2 * address_length;
+	}
+	port = htons(vector->source_port);
+	memcpy(input + 2 * address_length, &port, 2);
+	port = htons(vector->destination_port);
+	memcpy(input + 2 * address_length + 2, &port, 2);
+	return 2 * address_length + 4;
+}
+
+static int
+check_vectors(const net_toeplitz_table *table)
+{
+	uint8_t input[NET_TOEPLITZ_MAX_INPUT];
+	uint32_t length, expected, bitwise, tabled;
+	int failures = 0;
+	int i, ports;
+
+	for (i = 0; i < sizeof(RSS_VECTORS) / sizeof(RSS_VECTORS[0]); ++i) {
+		for (ports = 0; ports < 2; ++ports) {
+			length = build_input(&RSS_VECTORS[i], input, ports);
+			expected = ports ? RSS_VECTORS[i].port_hash :
+				RSS_VECTORS[i].address_hash;
+			bitwise = bitwise_hash(input, length);
+			tabled = net_toeplitz_table_hash(table, input, length);
+			if (bitwise != expected || tabled != expected) {
+				printf("FAIL vector %d%s: bitwise 0x%08x table 0x%08x "
+					"expected 0x%08x\n", i, ports ? " with ports" : "",
+					bitwise, tabled, expected);
+				++failures;
+			}
+		}
+	}
+	return failures;
+}
+
+static int
+check_random(const net_toeplitz_table *table)
+{
+	/* IPv4, IPv4 + ports, IPv6, IPv6 + ports. TCP and UDP share a layout. */
+	static const uint32_t LENGTHS[] = { 8, 12, 32, 36 };
+	uint8_t input[NET_TOEPLITZ_MAX_INPUT];
+	uint32_t bitwise, tabled;
+	int failures = 0;
+	int i, j;
+
+	for (i = 0; i < 100000; ++i) {
+		for (j = 0; j < NET_TOEPLITZ_MAX_INPUT; ++j) {
+			input[j] = random();
+		}
+		bitwise = bitwise_hash(input, LENGTHS[i % 4]);
+		tabled = net_toeplitz_table_hash(table, input, LENGTHS[i % 4]);
+		if (bitwise != tabled) {
+			++failures;
+		}
+	}
+	return failures;
+}
+
+static uint64_t
+nanoseconds(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+int
+main(int argc, char *argv[])
+{
+	static const uint32_t LENGTHS[] = { 8, 12, 32, 36 };
+	const int iterations = 1000000;
+	net_toeplitz_table table;
+	uint8_t input[NET_TOEPLITZ_MAX_INPUT];
+	volatile uint32_t sink = 0;
+	uint64_t start, bitwise_ns, table_ns;
+	int failures, i, j;
+
+	start = nanoseconds();
+	net_toeplitz_table_init(&table, RSS_KEY);
+	printf("Table build: %lu ns.\n", (unsigned long)(nanoseconds() - start));
+
+	failures = check_vectors(&table);
+	failures += check_random(&table);
+	printf("Correctness: %s (%d failures).\n", failures ? "FAILED" : "OK",
+		failures);
+
+	for (j = 0; j < NET_TOEPLITZ_MAX_INPUT; ++j) {
+		input[j] = random();
+	}
+
+	printf("%6s %14s %14s %8s\n", "bytes", "bitwise ns/op", "table ns/op",
+		"speedup");
+	for (i = 0; i < sizeof(LENGTHS) / sizeof(LENGTHS[0]); ++i) {
+		start = nanoseconds();
+		for (j = 0; j < iterations; ++j) {
+			input[0] = j;
+			sink += bitwise_hash(input, LENGTHS[i]);
+		}
+		bitwise_ns = nanoseconds() - start;
+
+		start = nanoseconds();
+		for (j = 0; j < iterations; ++j) {
+			input[0] = j;
+			sink += net_toeplitz_table_hash(&table, input, LENGTHS[i]);
+		}
+		table_ns = nanoseconds() - start;
+
+		printf("%6u %14.1f %14.1f %7.2fx\n", LENGTHS[i],
+			(double)bitwise_ns / iterations, (double)table_ns / iterations,
+			(double)bitwise_ns / table_ns);
+	}
+	(void)sink;
+
+	return failures != 0;
+}
@@ -0,0 +1,122 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "thread_ring.h"
+
+#define DRAIN_CHUNK_BYTES (64 * 1024)
+
+struct thread_ring *
+thread_ring_create(struct thread_ring_list *list)
+{
+	struct thread_ring *ring;
+
+	/* The records follow the ring, 8-byte aligned as the header is. */
+	ring = calloc(1, sizeof(*ring) + list->record_size * list->record_count);
+	if (ring == NULL) {
+		return NULL;
+	}
+	ring->records = ring + 1;
+	ring->thread = __atomic_fetch_add(&list->next_thread, 1,
+		__ATOMIC_RELAXED);
+	ring->next = __atomic_load_n(&list->rings, __ATOMIC_RELAXED);
+	while (!__atomic_compare_exchange_n(&list->rings, &ring->next, ring, true,
+			__ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+	}
+	return ring;
+}
+
+static void
+drain_ring(struct thread_ring_list *list, struct thread_ring *ring,
+	FILE *file)
+{
+	const uint8_t *records = ring->records;
+	uint32_t mask = list->record_count - 1;
+	uint32_t chunk_records = DRAIN_CHUNK_BYTES / list->record_size;
+	uint32_t head, now, count, skip, first, run;
+
+	head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+	if (head - ring->drained > list->record_count) {
+		ring->drained = head - list->record_count;
+	}
+	while (ring->drained != head) {
+		count = head - ring->drained;
+		if (count > chunk_records) {
+			count = chunk_records;
+		}
+		/* At most two runs, either side of the end of the ring. */
+		first = ring->drained & mask;
+		run = count < list->record_count - first ?
+			count : list->record_count - first;
+		memcpy(list->chunk, records + first * list->record_size,
+			run * list->record_size);
+		memcpy(list->chunk + run * list->record_size, records,
+			(count - run) * list->record_size);
+
+		/*
+		 * Drop any records the thread overwrote while they were copied.
+		 * The thread may be part way through record now, in the slot of
+		 * record now - record_count, so that one is lost too.
+		 */
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		now = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+		skip = 0;
+		if (now + 1 - ring->drained > list->record_count) {
+			skip = now + 1 - list->record_count - ring->drained;
+			if (skip > count) {
+				skip = count;
+			}
+		}
+		fwrite(list->chunk + skip * list->record_size, list->record_size,
+			count - skip, file);
+		ring->drained += count;
+	}
+}
+
+void
+thread_ring_drain(struct thread_ring_list *list, FILE *file)
+{
+	if (list->chunk == NULL) {
+		list->chunk = malloc(DRAIN_CHUNK_BYTES);
+		if (list->chunk == NULL) {
+			return;
+		}
+	}
+	for (struct thread_ring *ring = __atomic_load_n(&list->rings,
+			__ATOMIC_ACQUIRE); ring != NULL; ring = ring->next) {
+		drain_ring(list, ring, file);
+	}
+}
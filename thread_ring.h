@@ -0,0 +1,97 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef THREAD_RING_H
+#define THREAD_RING_H
+
+#include <stdint.h>
+#ifndef BAREMETAL
+#include <stddef.h>
+#include <stdio.h>
+#endif
+
+/*
+ * A ring of fixed-size records written by one thread without locking, for
+ * the binary log and the trace ring. Once the ring is full its oldest
+ * records are overwritten. The owner stores a record in slot head modulo the
+ * ring's size, then publishes it with thread_ring_publish.
+ *
+ * head counts the records ever written and is only written by the ring's
+ * thread; drained counts those already written out, and is only touched by
+ * whoever holds the owner's drain lock. Both wrap and are only compared by
+ * subtraction.
+ */
+struct thread_ring {
+	uint32_t head;
+	uint32_t drained;
+	uint32_t thread; /* In order of each thread's first record */
+	struct thread_ring *next;
+	void *records;
+};
+
+static inline void
+thread_ring_publish(struct thread_ring *ring, uint32_t head)
+{
+	__atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+}
+
+#ifndef BAREMETAL
+/*
+ * Every ring holding one kind of record. Rings are pushed here by their
+ * threads and never removed, so they can be walked without a lock.
+ */
+struct thread_ring_list {
+	size_t record_size;
+	uint32_t record_count; /* Power of two */
+	struct thread_ring *rings;
+	uint32_t next_thread;
+	uint8_t *chunk; /* Drain buffer, allocated by the first drain */
+};
+
+#define THREAD_RING_LIST_INITIALIZER(type, count)							\
+	{ .record_size = sizeof(type), .record_count = (count) }
+
+/* Allocates a ring for the calling thread and adds it to the list. */
+struct thread_ring *
+thread_ring_create(struct thread_ring_list *list);
+
+/*
+ * Writes the records in every ring not yet written out to file, dropping any
+ * that their thread overwrote as they were copied. Call with the owner's
+ * drain lock held.
+ */
+void
+thread_ring_drain(struct thread_ring_list *list, FILE *file);
+#endif
+
+#endif
@@ -103,6 +103,7 @@
 #include "qemu/timer.h"
 #include "qom/object.h"
 #include "sysemu/cpus.h"
+#include "trace/control.h"
 #endif
 
 #include "pcie-backend.h"
@@ -110,16 +111,21 @@
 
 #include "baremetal/baremetalsupport.h"
 #include "pcie.h"
+#include "tlp_metrics.h"
 
-#ifndef POSTGRES
+#if !defined(POSTGRES) && !defined(BENCH)
 #include "pciefpga.h"
 #endif
 
+#ifndef DUMMY
+#include "attacks.h"
+#endif
+#include "exfiltration.h"
 #include "mask.h"
 
 uint32_t global_devfn;
 
-FILE *GLOBAL_BINARY_FILE;
+struct exfil_writer GLOBAL_EXFIL_WRITER;
 
 #ifdef POSTGRES
 
@@ -239,7 +245,6 @@ respond_to_packet(struct PacketGeneratorState *state, struct RawTLP *in,
 	uint32_t loweraddress;
 	uint64_t req_addr, data_buffer;
 
-	struct TLP64DWord0 *dword0 = (struct TLP64DWord0 *)in->header;
 	struct TLP64RequestDWord1 *request_dword1 =
 		(struct TLP64RequestDWord1 *)(in->header + 1);
 	struct TLP64ConfigRequestDWord2 *config_request_dword2 =
@@ -260,12 +265,13 @@ respond_to_packet(struct PacketGeneratorState *state, struct RawTLP *in,
 	out->header_length = 0;
 	out->data_length = 0;
 
-	dir = ((tlp_get_fmt(dword0) & 2) >> 1);
+	struct tlp_class classified = tlp_classify(in->header);
+	dir = classified.direction;
 
-	switch (tlp_get_type(dword0)) {
+	switch (classified.type) {
 	case M:
 //		puts("Dealing with M req.");
-		assert(tlp_get_length(dword0) == 1);
+		assert(classified.length == 1);
 		/* This isn't in the spec, but seems to be all we've found in our
 		 * trace. */
 
@@ -350,7 +356,7 @@ respond_to_packet(struct PacketGeneratorState *state, struct RawTLP *in,
 
 			out->header_length = 12;
 			out->data_length = 4;
-			create_completion_header(out, dir, state->pci_dev->devfn,
+			tlp_build_cpld(out->header, state->pci_dev->devfn,
 				TLPCS_SUCCESSFUL_COMPLETION, bytecount, requester_id,
 				req_bits->tag, loweraddress, bytecount/4);
 		} else { /* dir == TLPD_WRITE */
@@ -360,7 +366,7 @@ respond_to_packet(struct PacketGeneratorState *state, struct RawTLP *in,
 
 		break;
 	case CFG_0:
-		assert(tlp_get_length(dword0) == 1);
+		assert(classified.length == 1);
 		response = PR_RESPONSE;
 		requester_id = tlp_get_requester_id(request_dword1);
 
@@ -605,6 +611,7 @@ void coroutine_fn process_packet(void *opaque)
 #endif
 
 	bool is_valid;
+	uint64_t received;
 	enum packet_response response;
 	TLPQuadWord tlp_out_header[2];
 	TLPQuadWord tlp_out_data[16];
@@ -623,6 +630,7 @@ void coroutine_fn process_packet(void *opaque)
 
 	while (true) {
 		next_tlp(&raw_tlp_in);
+		received = metrics_time();
 
 #ifdef POSTGRES
 		if (is_raw_tlp_trace_finished(&raw_tlp_in)) {
@@ -647,19 +655,15 @@ void coroutine_fn process_packet(void *opaque)
 			/*puts("Sending response TLP.");*/
 			send_result = send_tlp(&raw_tlp_out);
 			assert(send_result != -1);
+			time_completion(received);
 		}
 
 		free_raw_tlp_buffer(&raw_tlp_in);
 		if (!is_valid) {
 			/*check_windows_for_secret();*/
 #if 0
-			change_check_time = clock();
-			if ((change_check_time - last_change_check_time) > (CLOCKS_PER_SEC)) {
-				putchar('.');
-				fflush(stdio);
-				write_window_if_changed(core);
-				last_change_check_time = change_check_time;
-			}
+			/* The window monitor schedules its own polls. */
+			write_window_if_changed(core);
 #endif
 			qemu_coroutine_yield();
 		}
@@ -686,7 +690,36 @@ void handle_sigint(int arg)
 void handle_exit_call()
 {
 	printf("Caught signal or exit. Closing File.\n");
-	fclose(GLOBAL_BINARY_FILE);
+	exfil_writer_close(&GLOBAL_EXFIL_WRITER);
+	printf("Wrote %llu records (%llu bytes from %llu), dropped %llu.\n",
+		(unsigned long long)GLOBAL_EXFIL_WRITER.written,
+		(unsigned long long)GLOBAL_EXFIL_WRITER.bytes_out,
+		(unsigned long long)GLOBAL_EXFIL_WRITER.bytes_in,
+		(unsigned long long)GLOBAL_EXFIL_WRITER.dropped);
+	printf("%llu zero pages, %llu duplicate pages.\n",
+		(unsigned long long)GLOBAL_EXFIL_WRITER.zero_pages,
+		(unsigned long long)GLOBAL_EXFIL_WRITER.duplicate_pages);
+}
+
+/*
+ * Metrics go to TLP_METRICS_DEFAULT_FILE unless the THUNDERCLAP_METRICS
+ * environment variable names another file. Setting it empty turns them off.
+ */
+static void
+initialise_metrics()
+{
+	const char *path = getenv("THUNDERCLAP_METRICS");
+	if (path == NULL) {
+		path = TLP_METRICS_DEFAULT_FILE;
+	}
+	if (path[0] == '\0') {
+		return;
+	}
+	if (tlp_metrics_open(&tlp_metrics, path)) {
+		printf("Recording metrics in %s.\n", path);
+	} else {
+		printf("Couldn't open %s. Not recording metrics.\n", path);
+	}
 }
 
 int
@@ -734,8 +767,23 @@ main(int argc, char *argv[])
     qemu_add_opts(&qemu_netdev_opts);
     qemu_add_opts(&qemu_net_opts);
 
+	/* Events listed in THUNDERCLAP_TRACE_EVENTS, one per line as for
+	 * -trace events=, are recorded by the ring backend. */
+	const char *trace_event_list = getenv("THUNDERCLAP_TRACE_EVENTS");
+	if (trace_event_list != NULL && !trace_init_backends(trace_event_list,
+			getenv("THUNDERCLAP_TRACE_FILE"))) {
+		return 1;
+	}
+
 #endif // not DUMMY
 
+	initialise_metrics();
+#ifndef DUMMY
+	if (!initialise_reachability()) {
+		return 1;
+	}
+#endif
+
     int init = pcie_hardware_init(argc, argv, &physmem);
     if (init)
     	return init;
@@ -756,7 +804,10 @@ main(int argc, char *argv[])
 		return 1;
 	}
 
-	GLOBAL_BINARY_FILE = fopen(argv[1], "wb");
+	if (!exfil_writer_open(&GLOBAL_EXFIL_WRITER, argv[1])) {
+		printf("Error! Couldn't open %s.\n", argv[1]);
+		return 1;
+	}
 	signal(SIGINT, handle_sigint);
 	atexit(handle_exit_call);
 	*/
@@ -0,0 +1,268 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include "tlp_capture.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct tlp_capture tlp_capture;
+
+static inline uint32_t
+host_is_big_endian()
+{
+#ifdef HOST_WORDS_BIGENDIAN
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+static bool
+map_capture(struct tlp_capture *capture, int fd, size_t length, bool writable)
+{
+	int protection = PROT_READ | (writable ? PROT_WRITE : 0);
+	uint8_t *mapping = mmap(NULL, length, protection, MAP_SHARED, fd, 0);
+	if (mapping == MAP_FAILED) {
+		perror("Couldn't map TLP capture");
+		return false;
+	}
+	capture->fd = fd;
+	capture->writable = writable;
+	capture->mapping_length = length;
+	capture->file = (struct tlp_capture_file_header *)mapping;
+	capture->records = (struct tlp_capture_record *)
+		(mapping + TLP_CAPTURE_RECORDS_OFFSET);
+	return true;
+}
+
+/*
+ * Moves aside the capture from the last session, so that restarting after a
+ * crash doesn't truncate the record of it.
+ */
+static bool
+keep_previous_capture(const char *path)
+{
+	char previous[PATH_MAX];
+
+	if (snprintf(previous, sizeof(previous), "%s" TLP_CAPTURE_PREVIOUS_SUFFIX,
+		path) >= sizeof(previous)) {
+		fprintf(stderr, "TLP capture path is too long.\n");
+		return false;
+	}
+	if (rename(path, previous) != 0 && errno != ENOENT) {
+		perror("Couldn't keep the previous TLP capture");
+		return false;
+	}
+	return true;
+}
+
+bool
+tlp_capture_open(struct tlp_capture *capture, const char *path,
+	uint64_t record_count)
+{
+	int fd, error;
+	size_t length = TLP_CAPTURE_RECORDS_OFFSET +
+		record_count * sizeof(struct tlp_capture_record);
+
+	memset(capture, 0, sizeof(*capture));
+	capture->fd = -1;
+	if (record_count == 0) {
+		return false;
+	}
+
+	if (!keep_previous_capture(path)) {
+		return false;
+	}
+	fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0) {
+		perror("Couldn't create TLP capture");
+		return false;
+	}
+	/* Reserve the blocks now, so a full disk can't fault the recorder. */
+	error = posix_fallocate(fd, 0, length);
+	if (error != 0 && ftruncate(fd, length) != 0) {
+		perror("Couldn't size TLP capture");
+		close(fd);
+		return false;
+	}
+	if (!map_capture(capture, fd, length, true)) {
+		close(fd);
+		return false;
+	}
+
+	capture->record_count = record_count;
+	capture->file->version = TLP_CAPTURE_VERSION;
+	capture->file->record_size = sizeof(struct tlp_capture_record);
+	capture->file->record_count = record_count;
+	capture->file->next_sequence = 0;
+	capture->file->big_endian = host_is_big_endian();
+	capture->file->magic = TLP_CAPTURE_MAGIC;
+	capture->enabled = true;
+	return true;
+}
+
+bool
+tlp_capture_open_existing(struct tlp_capture *capture, const char *path)
+{
+	int fd;
+	struct stat status;
+	struct tlp_capture_file_header header;
+
+	memset(capture, 0, sizeof(*capture));
+	capture->fd = -1;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		perror("Couldn't open TLP capture");
+		return false;
+	}
+	if (fstat(fd, &status) != 0 ||
+		read(fd, &header, sizeof(header)) != sizeof(header)) {
+		fprintf(stderr, "Couldn't read TLP capture header.\n");
+		goto fail;
+	}
+	if (header.magic != TLP_CAPTURE_MAGIC ||
+		header.version != TLP_CAPTURE_VERSION ||
+		header.record_size != sizeof(struct tlp_capture_record)) {
+		fprintf(stderr, "Not a version %d TLP capture.\n",
+			TLP_CAPTURE_VERSION);
+		goto fail;
+	}
+	if (header.big_endian != host_is_big_endian()) {
+		fprintf(stderr, "TLP capture was written with the other byte "
+			"order.\n");
+		goto fail;
+	}
+	if (header.record_count == 0 || status.st_size <
+		TLP_CAPTURE_RECORDS_OFFSET +
+		header.record_count * sizeof(struct tlp_capture_record)) {
+		fprintf(stderr, "TLP capture is truncated.\n");
+		goto fail;
+	}
+	if (!map_capture(capture, fd, status.st_size, false)) {
+		goto fail;
+	}
+	capture->record_count = header.record_count;
+	return true;
+
+fail:
+	close(fd);
+	return false;
+}
+
+void
+tlp_capture_close(struct tlp_capture *capture)
+{
+	capture->enabled = false;
+	if (capture->file != NULL) {
+		if (capture->writable) {
+			msync((void *)capture->file, capture->mapping_length, MS_ASYNC);
+		}
+		munmap((void *)capture->file, capture->mapping_length);
+		capture->file = NULL;
+		capture->records = NULL;
+	}
+	if (capture->fd >= 0) {
+		close(capture->fd);
+		capture->fd = -1;
+	}
+}
+
+void
+tlp_capture_record_tlp(struct tlp_capture *capture,
+	enum tlp_capture_direction direction, const struct RawTLP *tlp,
+	uint64_t timestamp)
+{
+	uint64_t sequence = capture->file->next_sequence;
+	struct tlp_capture_record *record =
+		&capture->records[sequence % capture->record_count];
+	int header_length = tlp->header_length;
+	int data_length = tlp->data_length;
+
+	if (header_length < 0 || header_length > sizeof(record->header)) {
+		return;
+	}
+	if (data_length < 0 || tlp->data == NULL) {
+		data_length = 0;
+	}
+
+	/*
+	 * Invalidate the slot first, so that a reader never pairs a sequence
+	 * number with half of a record.
+	 */
+	record->sequence = UINT64_MAX;
+	__sync_synchronize();
+
+	record->timestamp = timestamp;
+	record->direction = direction;
+	record->header_length = header_length;
+	record->flags = 0;
+	if (data_length > TLP_CAPTURE_DATA_BYTES) {
+		data_length = TLP_CAPTURE_DATA_BYTES;
+		record->flags |= TLP_CAPTURE_TRUNCATED;
+	}
+	record->data_length = data_length;
+	memcpy(record->header, tlp->header, header_length);
+	memcpy(record->data, tlp->data, data_length);
+
+	__sync_synchronize();
+	record->sequence = sequence;
+	capture->file->next_sequence = sequence + 1;
+}
+
+uint64_t
+tlp_capture_first_sequence(const struct tlp_capture *capture)
+{
+	uint64_t next = capture->file->next_sequence;
+	return next > capture->record_count ? next - capture->record_count : 0;
+}
+
+const struct tlp_capture_record *
+tlp_capture_get(const struct tlp_capture *capture, uint64_t sequence)
+{
+	const struct tlp_capture_record *record =
+		&capture->records[sequence % capture->record_count];
+	if (sequence < tlp_capture_first_sequence(capture) ||
+		sequence >= capture->file->next_sequence ||
+		record->sequence != sequence) {
+		return NULL;
+	}
+	return record;
+}
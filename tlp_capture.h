@@ -0,0 +1,163 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef TLP_CAPTURE_H
+#define TLP_CAPTURE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "pcie.h"
+
+/*
+ * Records every TLP the backend receives or sends into a ring of fixed-size
+ * records in a memory-mapped file. The file is preallocated when it is
+ * opened, so recording a TLP is a bounded copy into the page cache and never
+ * a system call; once the ring is full the oldest records are overwritten.
+ * Because the mapping is shared, the records written so far survive the
+ * process crashing.
+ *
+ * The file header occupies the first TLP_CAPTURE_RECORDS_OFFSET bytes and
+ * the records follow. Everything is in host byte order: header dwords are
+ * stored as the backend holds them, so the accessors in pcie.h decode them.
+ * Timestamps are 64-bit CLOCK_MONOTONIC nanoseconds, so they never wrap
+ * within a capture however long the link sits idle.
+ *
+ * When capture is off the only cost in the receive and send paths is a test
+ * of tlp_capture.enabled.
+ */
+
+#define TLP_CAPTURE_MAGIC 0x50435054 /* "TPCP" on disk */
+#define TLP_CAPTURE_VERSION 2
+#define TLP_CAPTURE_RECORDS_OFFSET 4096
+#define TLP_CAPTURE_DATA_BYTES 512
+#define TLP_CAPTURE_DEFAULT_RECORDS (64 * 1024) /* About 36 MB */
+#define TLP_CAPTURE_DEFAULT_FILE "tlp.capture"
+#define TLP_CAPTURE_PREVIOUS_SUFFIX ".previous"
+
+#define TLP_CAPTURE_TRUNCATED 0x1 /* Data longer than TLP_CAPTURE_DATA_BYTES */
+
+enum tlp_capture_direction {
+	TCD_RECEIVED = 0, /* Downstream, from the host */
+	TCD_SENT = 1 /* Upstream, to the host */
+};
+
+struct tlp_capture_record {
+	uint64_t sequence;
+	uint64_t timestamp;
+	uint8_t direction;
+	uint8_t header_length;
+	uint16_t data_length; /* Bytes stored in data */
+	uint16_t flags;
+	uint16_t reserved;
+	TLPDoubleWord header[4];
+	TLPDoubleWord data[TLP_CAPTURE_DATA_BYTES / sizeof(TLPDoubleWord)];
+};
+
+struct tlp_capture_file_header {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t record_size;
+	uint64_t record_count; /* Capacity of the ring */
+	uint64_t next_sequence; /* Records ever written */
+	uint32_t big_endian;
+	uint32_t reserved;
+};
+
+struct tlp_capture {
+	bool enabled;
+	bool writable;
+	int fd;
+	size_t mapping_length;
+	uint64_t record_count;
+	volatile struct tlp_capture_file_header *file;
+	struct tlp_capture_record *records;
+};
+
+extern struct tlp_capture tlp_capture;
+
+/*
+ * Creates path, preallocates room for record_count records and enables
+ * capture. A capture already at path, such as the one left by a crashed
+ * session, is first renamed to path with TLP_CAPTURE_PREVIOUS_SUFFIX
+ * appended rather than truncated. Returns false, leaving capture off, if
+ * the file can't be created or mapped.
+ */
+bool
+tlp_capture_open(struct tlp_capture *capture, const char *path,
+	uint64_t record_count);
+
+/* Maps an existing capture read-only, for conversion or analysis. */
+bool
+tlp_capture_open_existing(struct tlp_capture *capture, const char *path);
+
+void
+tlp_capture_close(struct tlp_capture *capture);
+
+void
+tlp_capture_record_tlp(struct tlp_capture *capture,
+	enum tlp_capture_direction direction, const struct RawTLP *tlp,
+	uint64_t timestamp);
+
+/* The sequence number of the oldest record still in the ring. */
+uint64_t
+tlp_capture_first_sequence(const struct tlp_capture *capture);
+
+/*
+ * Returns the record with the given sequence number, or NULL if it has been
+ * overwritten or was only partly written when the capture stopped.
+ */
+const struct tlp_capture_record *
+tlp_capture_get(const struct tlp_capture *capture, uint64_t sequence);
+
+static inline uint64_t
+tlp_capture_time()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+/* The call the backends make from their receive and send paths. */
+static inline void
+capture_tlp(enum tlp_capture_direction direction, const struct RawTLP *tlp)
+{
+	if (!tlp_capture.enabled) {
+		return;
+	}
+	tlp_capture_record_tlp(&tlp_capture, direction, tlp, tlp_capture_time());
+}
+
+#endif
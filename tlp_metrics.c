@@ -0,0 +1,193 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+#include "tlp_metrics.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct tlp_metrics tlp_metrics;
+
+static inline uint32_t
+host_is_big_endian()
+{
+#ifdef HOST_WORDS_BIGENDIAN
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+static bool
+map_metrics(struct tlp_metrics *metrics, int fd, bool writable)
+{
+	int protection = PROT_READ | (writable ? PROT_WRITE : 0);
+	void *mapping = mmap(NULL, sizeof(struct tlp_metrics_file), protection,
+		MAP_SHARED, fd, 0);
+	if (mapping == MAP_FAILED) {
+		perror("Couldn't map TLP metrics");
+		return false;
+	}
+	metrics->fd = fd;
+	metrics->file = (struct tlp_metrics_file *)mapping;
+	return true;
+}
+
+bool
+tlp_metrics_open(struct tlp_metrics *metrics, const char *path)
+{
+	int fd;
+
+	memset(metrics, 0, sizeof(*metrics));
+	metrics->fd = -1;
+
+	fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0) {
+		perror("Couldn't create TLP metrics");
+		return false;
+	}
+	if (ftruncate(fd, sizeof(struct tlp_metrics_file)) != 0) {
+		perror("Couldn't size TLP metrics");
+		close(fd);
+		return false;
+	}
+	if (!map_metrics(metrics, fd, true)) {
+		close(fd);
+		return false;
+	}
+
+	/* The file was truncated, so every counter starts at zero. */
+	metrics->file->version = TLP_METRICS_VERSION;
+	metrics->file->size = sizeof(struct tlp_metrics_file);
+	metrics->file->big_endian = host_is_big_endian();
+	metrics->file->pid = getpid();
+	__sync_synchronize();
+	metrics->file->magic = TLP_METRICS_MAGIC;
+	metrics->enabled = true;
+	return true;
+}
+
+bool
+tlp_metrics_open_existing(struct tlp_metrics *metrics, const char *path)
+{
+	int fd;
+	struct stat status;
+	struct tlp_metrics_file header;
+
+	memset(metrics, 0, sizeof(*metrics));
+	metrics->fd = -1;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		perror("Couldn't open TLP metrics");
+		return false;
+	}
+	if (fstat(fd, &status) != 0 ||
+		status.st_size < sizeof(struct tlp_metrics_file) ||
+		read(fd, &header, sizeof(header)) != sizeof(header)) {
+		fprintf(stderr, "Couldn't read TLP metrics.\n");
+		goto fail;
+	}
+	if (header.magic != TLP_METRICS_MAGIC ||
+		header.version != TLP_METRICS_VERSION ||
+		header.size != sizeof(struct tlp_metrics_file)) {
+		fprintf(stderr, "Not a version %d TLP metrics file.\n",
+			TLP_METRICS_VERSION);
+		goto fail;
+	}
+	if (header.big_endian != host_is_big_endian()) {
+		fprintf(stderr, "TLP metrics were written with the other byte "
+			"order.\n");
+		goto fail;
+	}
+	if (!map_metrics(metrics, fd, false)) {
+		goto fail;
+	}
+	return true;
+
+fail:
+	close(fd);
+	return false;
+}
+
+void
+tlp_metrics_close(struct tlp_metrics *metrics)
+{
+	metrics->enabled = false;
+	if (metrics->file != NULL) {
+		munmap((void *)metrics->file, sizeof(struct tlp_metrics_file));
+		metrics->file = NULL;
+	}
+	if (metrics->fd >= 0) {
+		close(metrics->fd);
+		metrics->fd = -1;
+	}
+}
+
+void
+tlp_metrics_record_tlp(struct tlp_metrics *metrics,
+	enum tlp_metrics_direction direction, const struct RawTLP *tlp)
+{
+	struct TLP64CompletionDWord1 *dword1;
+	struct tlp_class classified;
+	enum tlp_type type;
+	uint64_t length;
+
+	if (tlp->header == NULL || tlp->header_length < 8) {
+		return;
+	}
+	classified = tlp_classify(tlp->header);
+	type = classified.type;
+	tlp_metrics_add(&metrics->file->tlps[direction][type], 1);
+
+	if (tlp_fmt_has_data(classified.fmt)) {
+		/* A length field of zero means the maximum, 1024 dwords. */
+		length = classified.length;
+		if (length == 0) {
+			length = 1024;
+		}
+		tlp_metrics_add(&metrics->file->payload_bytes[direction][type],
+			length * sizeof(TLPDoubleWord));
+	}
+
+	if (type == CPL || type == CPL_LK) {
+		dword1 = (struct TLP64CompletionDWord1 *)(tlp->header + 1);
+		if (tlp_get_status(dword1) == TLPCS_UNSUPPORTED_REQUEST) {
+			tlp_metrics_add(&metrics->file->unsupported_requests[direction],
+				1);
+		}
+	}
+}
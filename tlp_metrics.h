@@ -0,0 +1,234 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+#ifndef TLP_METRICS_H
+#define TLP_METRICS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pcie.h"
+#include "pcie-backend.h"
+
+/*
+ * Live counters for the link and the model, kept in a memory-mapped file so
+ * that watch-metrics can sample a running session from another process.
+ * Every counter is a uint64_t updated with relaxed atomic adds, so updating
+ * one is a few instructions and never a system call or a lock; a reader may
+ * see counters from slightly different instants, but never a torn value.
+ *
+ * Latencies are kept as histograms with logarithmic buckets: bucket 0 counts
+ * zero and bucket i counts values in [2^(i - 1), 2^i). Times are
+ * read_hw_counter() ticks, which are nanoseconds on the hosted Altera
+ * backend, taken modulo the counter's width; the replay backends have no
+ * clock, so their histograms only count.
+ *
+ * When metrics are off the only cost at each hook is a test of
+ * tlp_metrics.enabled.
+ */
+
+#define TLP_METRICS_MAGIC 0x4d504c54 /* "TLPM" on disk */
+#define TLP_METRICS_VERSION 1
+#define TLP_METRICS_TYPES 32 /* The type field is five bits */
+#define TLP_METRICS_BUCKETS 64
+#define TLP_METRICS_DEFAULT_FILE "thunderclap.metrics"
+
+enum tlp_metrics_direction {
+	TMD_RECEIVED = 0, /* Downstream, from the host */
+	TMD_SENT = 1 /* Upstream, to the host */
+};
+
+struct tlp_metrics_histogram {
+	uint64_t count;
+	uint64_t sum;
+	uint64_t max;
+	uint64_t buckets[TLP_METRICS_BUCKETS];
+};
+
+struct tlp_metrics_file {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t size; /* sizeof(struct tlp_metrics_file) */
+	uint32_t big_endian;
+	uint32_t pid;
+	uint64_t tlps[2][TLP_METRICS_TYPES]; /* Indexed by direction, type */
+	uint64_t payload_bytes[2][TLP_METRICS_TYPES];
+	uint64_t unsupported_requests[2]; /* UR completions, by direction */
+	uint64_t pending_tlps; /* Queued while waiting for a completion */
+	uint64_t pending_tlps_peak;
+	uint64_t buffers_in_use; /* Of the TLP buffer pool in pcie.c */
+	uint64_t buffers_in_use_peak;
+	/* From sending a DMA read request to its last completion arriving. */
+	struct tlp_metrics_histogram dma_read_latency;
+	/* From a request arriving to the completion the model sends for it. */
+	struct tlp_metrics_histogram completion_service_time;
+};
+
+struct tlp_metrics {
+	bool enabled;
+	int fd;
+	volatile struct tlp_metrics_file *file;
+};
+
+extern struct tlp_metrics tlp_metrics;
+
+/*
+ * Creates or truncates path, maps it and enables the metrics. Returns false,
+ * leaving them off, if the file can't be created or mapped.
+ */
+bool
+tlp_metrics_open(struct tlp_metrics *metrics, const char *path);
+
+/* Maps an existing metrics file read-only, for sampling. */
+bool
+tlp_metrics_open_existing(struct tlp_metrics *metrics, const char *path);
+
+void
+tlp_metrics_close(struct tlp_metrics *metrics);
+
+void
+tlp_metrics_record_tlp(struct tlp_metrics *metrics,
+	enum tlp_metrics_direction direction, const struct RawTLP *tlp);
+
+static inline void
+tlp_metrics_add(volatile uint64_t *counter, int64_t delta)
+{
+	__atomic_fetch_add(counter, delta, __ATOMIC_RELAXED);
+}
+
+static inline uint64_t
+tlp_metrics_load(const volatile uint64_t *counter)
+{
+	return __atomic_load_n(counter, __ATOMIC_RELAXED);
+}
+
+static inline void
+tlp_metrics_raise_peak(volatile uint64_t *peak, uint64_t value)
+{
+	uint64_t seen = __atomic_load_n(peak, __ATOMIC_RELAXED);
+	while (value > seen && !__atomic_compare_exchange_n(peak, &seen, value,
+			true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+	}
+}
+
+static inline int
+tlp_metrics_bucket(uint64_t value)
+{
+	int bucket = value == 0 ? 0 : 64 - __builtin_clzll(value);
+	return bucket < TLP_METRICS_BUCKETS ? bucket : TLP_METRICS_BUCKETS - 1;
+}
+
+static inline void
+tlp_metrics_record_time(volatile struct tlp_metrics_histogram *histogram,
+	uint64_t start, uint64_t end)
+{
+	/*
+	 * read_hw_counter() is as wide as unsigned long, 32 bits on the Arm
+	 * target, so a counter that wrapped during the interval still gives
+	 * the right difference.
+	 */
+	uint64_t elapsed = (unsigned long)(end - start);
+	tlp_metrics_add(&histogram->count, 1);
+	tlp_metrics_add(&histogram->sum, elapsed);
+	tlp_metrics_add(&histogram->buckets[tlp_metrics_bucket(elapsed)], 1);
+	tlp_metrics_raise_peak(&histogram->max, elapsed);
+}
+
+/* The calls made from the receive and send paths. */
+static inline void
+count_tlp(enum tlp_metrics_direction direction, const struct RawTLP *tlp)
+{
+	if (!tlp_metrics.enabled) {
+		return;
+	}
+	tlp_metrics_record_tlp(&tlp_metrics, direction, tlp);
+}
+
+static inline void
+tlp_metrics_move_gauge(volatile uint64_t *gauge, volatile uint64_t *peak,
+	int delta)
+{
+	tlp_metrics_add(gauge, delta);
+	if (delta > 0) {
+		tlp_metrics_raise_peak(peak, tlp_metrics_load(gauge));
+	}
+}
+
+static inline void
+count_pending_tlps(int delta)
+{
+	if (!tlp_metrics.enabled) {
+		return;
+	}
+	tlp_metrics_move_gauge(&tlp_metrics.file->pending_tlps,
+		&tlp_metrics.file->pending_tlps_peak, delta);
+}
+
+static inline void
+count_tlp_buffers(int delta)
+{
+	if (!tlp_metrics.enabled) {
+		return;
+	}
+	tlp_metrics_move_gauge(&tlp_metrics.file->buffers_in_use,
+		&tlp_metrics.file->buffers_in_use_peak, delta);
+}
+
+/* Zero when metrics are off, so that callers can time unconditionally. */
+static inline uint64_t
+metrics_time()
+{
+	return tlp_metrics.enabled ? read_hw_counter() : 0;
+}
+
+static inline void
+time_dma_read(uint64_t start)
+{
+	if (!tlp_metrics.enabled) {
+		return;
+	}
+	tlp_metrics_record_time(&tlp_metrics.file->dma_read_latency, start,
+		read_hw_counter());
+}
+
+static inline void
+time_completion(uint64_t start)
+{
+	if (!tlp_metrics.enabled) {
+		return;
+	}
+	tlp_metrics_record_time(&tlp_metrics.file->completion_service_time,
+		start, read_hw_counter());
+}
+
+#endif
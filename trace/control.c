@@ -14,6 +14,9 @@
 #ifdef CONFIG_TRACE_FTRACE
 #include "trace/ftrace.h"
 #endif
+#ifdef CONFIG_TRACE_RING
+#include "trace/ring.h"
+#endif
 #include "qemu/error-report.h"
 
 TraceEvent *trace_event_name(const char *name)
@@ -149,6 +152,11 @@ bool trace_init_backends(const char *events, const char *file)
         fprintf(stderr, "failed to initialize simple tracing backend.\n");
         return false;
     }
+#elif defined(CONFIG_TRACE_RING)
+    if (!trace_ring_init(file)) {
+        fprintf(stderr, "failed to initialize ring tracing backend.\n");
+        return false;
+    }
 #else
     if (file) {
         fprintf(stderr, "error: -trace file=...: "
@@ -0,0 +1,1460 @@
+/* This file is autogenerated by trace/ringtracers.py, do not edit. */
+
+#include "trace/generated-events.h"
+#include "trace/ring.h"
+
+const TraceRingEventInfo trace_ring_events[TRACE_EVENT_COUNT] = {
+    [TRACE_QEMU_MEMALIGN] = { "uup", "alignment,size,ptr" },
+    [TRACE_QEMU_ANON_RAM_ALLOC] = { "up", "size,ptr" },
+    [TRACE_QEMU_VFREE] = { "p", "ptr" },
+    [TRACE_QEMU_ANON_RAM_FREE] = { "pu", "ptr,size" },
+    [TRACE_VIRTQUEUE_FILL] = { "ppuu", "vq,elem,len,idx" },
+    [TRACE_VIRTQUEUE_FLUSH] = { "pu", "vq,count" },
+    [TRACE_VIRTQUEUE_POP] = { "ppuu", "vq,elem,in_num,out_num" },
+    [TRACE_VIRTIO_QUEUE_NOTIFY] = { "pip", "vdev,n,vq" },
+    [TRACE_VIRTIO_IRQ] = { "p", "vq" },
+    [TRACE_VIRTIO_NOTIFY] = { "pp", "vdev,vq" },
+    [TRACE_VIRTIO_SET_STATUS] = { "pu", "vdev,val" },
+    [TRACE_VIRTIO_RNG_GUEST_NOT_READY] = { "p", "rng" },
+    [TRACE_VIRTIO_RNG_PUSHED] = { "pu", "rng,len" },
+    [TRACE_VIRTIO_RNG_REQUEST] = { "puu", "rng,size,quota" },
+    [TRACE_VIRTIO_SERIAL_SEND_CONTROL_EVENT] = { "uuu", "port,event,value" },
+    [TRACE_VIRTIO_SERIAL_THROTTLE_PORT] = { "uu", "port,throttle" },
+    [TRACE_VIRTIO_SERIAL_HANDLE_CONTROL_MESSAGE] = { "uu", "event,value" },
+    [TRACE_VIRTIO_SERIAL_HANDLE_CONTROL_MESSAGE_PORT] = { "u", "port" },
+    [TRACE_VIRTIO_CONSOLE_FLUSH_BUF] = { "uui", "port,len,ret" },
+    [TRACE_VIRTIO_CONSOLE_CHR_READ] = { "ui", "port,size" },
+    [TRACE_VIRTIO_CONSOLE_CHR_EVENT] = { "ui", "port,event" },
+    [TRACE_BDRV_OPEN_COMMON] = { "psis", "bs,filename,flags,format_name" },
+    [TRACE_MULTIWRITE_CB] = { "pi", "mcb,ret" },
+    [TRACE_BDRV_AIO_MULTIWRITE] = { "pii", "mcb,num_callbacks,num_reqs" },
+    [TRACE_BDRV_AIO_DISCARD] = { "piip", "bs,sector_num,nb_sectors,opaque" },
+    [TRACE_BDRV_AIO_FLUSH] = { "pp", "bs,opaque" },
+    [TRACE_BDRV_AIO_READV] = { "piip", "bs,sector_num,nb_sectors,opaque" },
+    [TRACE_BDRV_AIO_WRITEV] = { "piip", "bs,sector_num,nb_sectors,opaque" },
+    [TRACE_BDRV_AIO_WRITE_ZEROES] = { "piiip", "bs,sector_num,nb_sectors,flags,opaque" },
+    [TRACE_BDRV_LOCK_MEDIUM] = { "pu", "bs,locked" },
+    [TRACE_BDRV_CO_READV] = { "pii", "bs,sector_num,nb_sector" },
+    [TRACE_BDRV_CO_COPY_ON_READV] = { "pii", "bs,sector_num,nb_sector" },
+    [TRACE_BDRV_CO_WRITEV] = { "pii", "bs,sector_num,nb_sector" },
+    [TRACE_BDRV_CO_WRITE_ZEROES] = { "piii", "bs,sector_num,nb_sector,flags" },
+    [TRACE_BDRV_CO_IO_EM] = { "piiip", "bs,sector_num,nb_sectors,is_write,acb" },
+    [TRACE_BDRV_CO_DO_COPY_ON_READV] = { "piiii", "bs,sector_num,nb_sectors,cluster_sector_num,cluster_nb_sectors" },
+    [TRACE_STREAM_ONE_ITERATION] = { "piii", "s,sector_num,nb_sectors,is_allocated" },
+    [TRACE_STREAM_START] = { "ppppp", "bs,base,s,co,opaque" },
+    [TRACE_COMMIT_ONE_ITERATION] = { "piii", "s,sector_num,nb_sectors,is_allocated" },
+    [TRACE_COMMIT_START] = { "pppppp", "bs,base,top,s,co,opaque" },
+    [TRACE_MIRROR_START] = { "pppp", "bs,s,co,opaque" },
+    [TRACE_MIRROR_RESTART_ITER] = { "pi", "s,cnt" },
+    [TRACE_MIRROR_BEFORE_FLUSH] = { "p", "s" },
+    [TRACE_MIRROR_BEFORE_DRAIN] = { "pi", "s,cnt" },
+    [TRACE_MIRROR_BEFORE_SLEEP] = { "piiu", "s,cnt,synced,delay_ns" },
+    [TRACE_MIRROR_ONE_ITERATION] = { "pii", "s,sector_num,nb_sectors" },
+    [TRACE_MIRROR_ITERATION_DONE] = { "piii", "s,sector_num,nb_sectors,ret" },
+    [TRACE_MIRROR_YIELD] = { "piii", "s,cnt,buf_free_count,in_flight" },
+    [TRACE_MIRROR_YIELD_IN_FLIGHT] = { "pii", "s,sector_num,in_flight" },
+    [TRACE_MIRROR_YIELD_BUF_BUSY] = { "pii", "s,nb_chunks,in_flight" },
+    [TRACE_MIRROR_BREAK_BUF_BUSY] = { "pii", "s,nb_chunks,in_flight" },
+    [TRACE_BACKUP_DO_COW_ENTER] = { "piii", "job,start,sector_num,nb_sectors" },
+    [TRACE_BACKUP_DO_COW_RETURN] = { "piii", "job,sector_num,nb_sectors,ret" },
+    [TRACE_BACKUP_DO_COW_SKIP] = { "pi", "job,start" },
+    [TRACE_BACKUP_DO_COW_PROCESS] = { "pi", "job,start" },
+    [TRACE_BACKUP_DO_COW_READ_FAIL] = { "pii", "job,start,ret" },
+    [TRACE_BACKUP_DO_COW_WRITE_FAIL] = { "pii", "job,start,ret" },
+    [TRACE_QMP_BLOCK_JOB_CANCEL] = { "p", "job" },
+    [TRACE_QMP_BLOCK_JOB_PAUSE] = { "p", "job" },
+    [TRACE_QMP_BLOCK_JOB_RESUME] = { "p", "job" },
+    [TRACE_QMP_BLOCK_JOB_COMPLETE] = { "p", "job" },
+    [TRACE_BLOCK_JOB_CB] = { "ppi", "bs,job,ret" },
+    [TRACE_QMP_BLOCK_STREAM] = { "pp", "bs,job" },
+    [TRACE_VIRTIO_BLK_REQ_COMPLETE] = { "pi", "req,status" },
+    [TRACE_VIRTIO_BLK_RW_COMPLETE] = { "pi", "req,ret" },
+    [TRACE_VIRTIO_BLK_HANDLE_WRITE] = { "puu", "req,sector,nsectors" },
+    [TRACE_VIRTIO_BLK_HANDLE_READ] = { "puu", "req,sector,nsectors" },
+    [TRACE_VIRTIO_BLK_SUBMIT_MULTIREQ] = { "piiuuu", "mrb,start,num_reqs,sector,nsectors,is_write" },
+    [TRACE_VIRTIO_BLK_DATA_PLANE_START] = { "p", "s" },
+    [TRACE_VIRTIO_BLK_DATA_PLANE_STOP] = { "p", "s" },
+    [TRACE_VIRTIO_BLK_DATA_PLANE_PROCESS_REQUEST] = { "puuu", "s,out_num,in_num,head" },
+    [TRACE_VRING_SETUP] = { "uppp", "physical,desc,avail,used" },
+    [TRACE_THREAD_POOL_SUBMIT] = { "ppp", "pool,req,opaque" },
+    [TRACE_THREAD_POOL_COMPLETE] = { "pppi", "pool,req,opaque,ret" },
+    [TRACE_THREAD_POOL_CANCEL] = { "pp", "req,opaque" },
+    [TRACE_PAIO_SUBMIT_CO] = { "iii", "sector_num,nb_sectors,type" },
+    [TRACE_PAIO_SUBMIT] = { "ppiii", "acb,opaque,sector_num,nb_sectors,type" },
+    [TRACE_CPU_IN] = { "uu", "addr,val" },
+    [TRACE_CPU_OUT] = { "uu", "addr,val" },
+    [TRACE_BALLOON_EVENT] = { "pu", "opaque,addr" },
+    [TRACE_VIRTIO_BALLOON_HANDLE_OUTPUT] = { "su", "name,gpa" },
+    [TRACE_VIRTIO_BALLOON_GET_CONFIG] = { "uu", "num_pages,acutal" },
+    [TRACE_VIRTIO_BALLOON_SET_CONFIG] = { "uu", "acutal,oldacutal" },
+    [TRACE_VIRTIO_BALLOON_TO_TARGET] = { "uu", "target,num_pages" },
+    [TRACE_CPU_SET_APIC_BASE] = { "u", "val" },
+    [TRACE_CPU_GET_APIC_BASE] = { "u", "val" },
+    [TRACE_APIC_REPORT_IRQ_DELIVERED] = { "i", "apic_irq_delivered" },
+    [TRACE_APIC_RESET_IRQ_DELIVERED] = { "i", "apic_irq_delivered" },
+    [TRACE_APIC_GET_IRQ_DELIVERED] = { "i", "apic_irq_delivered" },
+    [TRACE_APIC_LOCAL_DELIVER] = { "iu", "vector,lvt" },
+    [TRACE_APIC_DELIVER_IRQ] = { "uuuuu", "dest,dest_mode,delivery_mode,vector_num,trigger_mode" },
+    [TRACE_APIC_MEM_READL] = { "uu", "addr,val" },
+    [TRACE_APIC_MEM_WRITEL] = { "uu", "addr,val" },
+    [TRACE_CS4231_MEM_READL_DREG] = { "uu", "reg,ret" },
+    [TRACE_CS4231_MEM_READL_REG] = { "uu", "reg,ret" },
+    [TRACE_CS4231_MEM_WRITEL_REG] = { "uuu", "reg,old,val" },
+    [TRACE_CS4231_MEM_WRITEL_DREG] = { "uuu", "reg,old,val" },
+    [TRACE_NVRAM_READ] = { "uu", "addr,ret" },
+    [TRACE_NVRAM_WRITE] = { "uuu", "addr,old,val" },
+    [TRACE_ECC_MEM_WRITEL_MER] = { "u", "val" },
+    [TRACE_ECC_MEM_WRITEL_MDR] = { "u", "val" },
+    [TRACE_ECC_MEM_WRITEL_MFSR] = { "u", "val" },
+    [TRACE_ECC_MEM_WRITEL_VCR] = { "u", "val" },
+    [TRACE_ECC_MEM_WRITEL_DR] = { "u", "val" },
+    [TRACE_ECC_MEM_WRITEL_ECR0] = { "u", "val" },
+    [TRACE_ECC_MEM_WRITEL_ECR1] = { "u", "val" },
+    [TRACE_ECC_MEM_READL_MER] = { "u", "ret" },
+    [TRACE_ECC_MEM_READL_MDR] = { "u", "ret" },
+    [TRACE_ECC_MEM_READL_MFSR] = { "u", "ret" },
+    [TRACE_ECC_MEM_READL_VCR] = { "u", "ret" },
+    [TRACE_ECC_MEM_READL_MFAR0] = { "u", "ret" },
+    [TRACE_ECC_MEM_READL_MFAR1] = { "u", "ret" },
+    [TRACE_ECC_MEM_READL_DR] = { "u", "ret" },
+    [TRACE_ECC_MEM_READL_ECR0] = { "u", "ret" },
+    [TRACE_ECC_MEM_READL_ECR1] = { "u", "ret" },
+    [TRACE_ECC_DIAG_MEM_WRITEB] = { "uu", "addr,val" },
+    [TRACE_ECC_DIAG_MEM_READB] = { "uu", "addr,ret" },
+    [TRACE_FW_CFG_WRITE] = { "pu", "s,value" },
+    [TRACE_FW_CFG_SELECT] = { "pui", "s,key,ret" },
+    [TRACE_FW_CFG_READ] = { "pu", "s,ret" },
+    [TRACE_FW_CFG_ADD_FILE_DUPE] = { "ps", "s,name" },
+    [TRACE_FW_CFG_ADD_FILE] = { "pisu", "s,index,name,len" },
+    [TRACE_HD_GEOMETRY_LCHS_GUESS] = { "piii", "blk,cyls,heads,secs" },
+    [TRACE_HD_GEOMETRY_GUESS] = { "puuui", "blk,cyls,heads,secs,trans" },
+    [TRACE_JAZZ_LED_READ] = { "uu", "addr,val" },
+    [TRACE_JAZZ_LED_WRITE] = { "uu", "addr,new" },
+    [TRACE_XENFB_MOUSE_EVENT] = { "piiiii", "opaque,dx,dy,dz,button_state,abs_pointer_wanted" },
+    [TRACE_XENFB_INPUT_CONNECTED] = { "pi", "xendev,abs_pointer_wanted" },
+    [TRACE_LANCE_MEM_READW] = { "uu", "addr,ret" },
+    [TRACE_LANCE_MEM_WRITEW] = { "uu", "addr,val" },
+    [TRACE_SLAVIO_INTCTL_MEM_READL] = { "uuu", "cpu,addr,ret" },
+    [TRACE_SLAVIO_INTCTL_MEM_WRITEL] = { "uuu", "cpu,addr,val" },
+    [TRACE_SLAVIO_INTCTL_MEM_WRITEL_CLEAR] = { "uuu", "cpu,val,intreg_pending" },
+    [TRACE_SLAVIO_INTCTL_MEM_WRITEL_SET] = { "uuu", "cpu,val,intreg_pending" },
+    [TRACE_SLAVIO_INTCTLM_MEM_READL] = { "uu", "addr,ret" },
+    [TRACE_SLAVIO_INTCTLM_MEM_WRITEL] = { "uu", "addr,val" },
+    [TRACE_SLAVIO_INTCTLM_MEM_WRITEL_ENABLE] = { "uu", "val,intregm_disabled" },
+    [TRACE_SLAVIO_INTCTLM_MEM_WRITEL_DISABLE] = { "uu", "val,intregm_disabled" },
+    [TRACE_SLAVIO_INTCTLM_MEM_WRITEL_TARGET] = { "u", "cpu" },
+    [TRACE_SLAVIO_CHECK_INTERRUPTS] = { "uu", "pending,intregm_disabled" },
+    [TRACE_SLAVIO_SET_IRQ] = { "uiui", "target_cpu,irq,pil,level" },
+    [TRACE_SLAVIO_SET_TIMER_IRQ_CPU] = { "ii", "cpu,level" },
+    [TRACE_PS2_PUT_KEYCODE] = { "pi", "opaque,keycode" },
+    [TRACE_PS2_READ_DATA] = { "p", "opaque" },
+    [TRACE_PS2_SET_LEDSTATE] = { "pi", "s,ledstate" },
+    [TRACE_PS2_RESET_KEYBOARD] = { "p", "s" },
+    [TRACE_PS2_WRITE_KEYBOARD] = { "pi", "opaque,val" },
+    [TRACE_PS2_KEYBOARD_SET_TRANSLATION] = { "pi", "opaque,mode" },
+    [TRACE_PS2_MOUSE_SEND_PACKET] = { "piiii", "s,dx1,dy1,dz1,b" },
+    [TRACE_PS2_MOUSE_EVENT_DISABLED] = { "piiiiiii", "opaque,dx,dy,dz,buttons_state,mouse_dx,mouse_dy,mouse_dz" },
+    [TRACE_PS2_MOUSE_EVENT] = { "piiiiiii", "opaque,dx,dy,dz,buttons_state,mouse_dx,mouse_dy,mouse_dz" },
+    [TRACE_PS2_MOUSE_FAKE_EVENT] = { "p", "opaque" },
+    [TRACE_PS2_WRITE_MOUSE] = { "pi", "opaque,val" },
+    [TRACE_PS2_KBD_RESET] = { "p", "opaque" },
+    [TRACE_PS2_MOUSE_RESET] = { "p", "opaque" },
+    [TRACE_PS2_KBD_INIT] = { "p", "s" },
+    [TRACE_PS2_MOUSE_INIT] = { "p", "s" },
+    [TRACE_SLAVIO_MISC_UPDATE_IRQ_RAISE] = { "", "" },
+    [TRACE_SLAVIO_MISC_UPDATE_IRQ_LOWER] = { "", "" },
+    [TRACE_SLAVIO_SET_POWER_FAIL] = { "iu", "power_failing,config" },
+    [TRACE_SLAVIO_CFG_MEM_WRITEB] = { "u", "val" },
+    [TRACE_SLAVIO_CFG_MEM_READB] = { "u", "ret" },
+    [TRACE_SLAVIO_DIAG_MEM_WRITEB] = { "u", "val" },
+    [TRACE_SLAVIO_DIAG_MEM_READB] = { "u", "ret" },
+    [TRACE_SLAVIO_MDM_MEM_WRITEB] = { "u", "val" },
+    [TRACE_SLAVIO_MDM_MEM_READB] = { "u", "ret" },
+    [TRACE_SLAVIO_AUX1_MEM_WRITEB] = { "u", "val" },
+    [TRACE_SLAVIO_AUX1_MEM_READB] = { "u", "ret" },
+    [TRACE_SLAVIO_AUX2_MEM_WRITEB] = { "u", "val" },
+    [TRACE_SLAVIO_AUX2_MEM_READB] = { "u", "ret" },
+    [TRACE_APC_MEM_WRITEB] = { "u", "val" },
+    [TRACE_APC_MEM_READB] = { "u", "ret" },
+    [TRACE_SLAVIO_SYSCTRL_MEM_WRITEL] = { "u", "val" },
+    [TRACE_SLAVIO_SYSCTRL_MEM_READL] = { "u", "ret" },
+    [TRACE_SLAVIO_LED_MEM_WRITEW] = { "u", "val" },
+    [TRACE_SLAVIO_LED_MEM_READW] = { "u", "ret" },
+    [TRACE_SLAVIO_TIMER_GET_OUT] = { "uuu", "limit,counthigh,count" },
+    [TRACE_SLAVIO_TIMER_IRQ] = { "uu", "counthigh,count" },
+    [TRACE_SLAVIO_TIMER_MEM_READL_INVALID] = { "u", "addr" },
+    [TRACE_SLAVIO_TIMER_MEM_READL] = { "uu", "addr,ret" },
+    [TRACE_SLAVIO_TIMER_MEM_WRITEL] = { "uu", "addr,val" },
+    [TRACE_SLAVIO_TIMER_MEM_WRITEL_LIMIT] = { "uu", "timer_index,count" },
+    [TRACE_SLAVIO_TIMER_MEM_WRITEL_COUNTER_INVALID] = { "", "" },
+    [TRACE_SLAVIO_TIMER_MEM_WRITEL_STATUS_START] = { "u", "timer_index" },
+    [TRACE_SLAVIO_TIMER_MEM_WRITEL_STATUS_STOP] = { "u", "timer_index" },
+    [TRACE_SLAVIO_TIMER_MEM_WRITEL_MODE_USER] = { "u", "timer_index" },
+    [TRACE_SLAVIO_TIMER_MEM_WRITEL_MODE_COUNTER] = { "u", "timer_index" },
+    [TRACE_SLAVIO_TIMER_MEM_WRITEL_MODE_INVALID] = { "", "" },
+    [TRACE_SLAVIO_TIMER_MEM_WRITEL_INVALID] = { "u", "addr" },
+    [TRACE_LEDMA_MEMORY_READ] = { "u", "addr" },
+    [TRACE_LEDMA_MEMORY_WRITE] = { "u", "addr" },
+    [TRACE_SPARC32_DMA_SET_IRQ_RAISE] = { "", "" },
+    [TRACE_SPARC32_DMA_SET_IRQ_LOWER] = { "", "" },
+    [TRACE_ESPDMA_MEMORY_READ] = { "u", "addr" },
+    [TRACE_ESPDMA_MEMORY_WRITE] = { "u", "addr" },
+    [TRACE_SPARC32_DMA_MEM_READL] = { "uu", "addr,ret" },
+    [TRACE_SPARC32_DMA_MEM_WRITEL] = { "uuu", "addr,old,val" },
+    [TRACE_SPARC32_DMA_ENABLE_RAISE] = { "", "" },
+    [TRACE_SPARC32_DMA_ENABLE_LOWER] = { "", "" },
+    [TRACE_SUN4M_CPU_INTERRUPT] = { "u", "level" },
+    [TRACE_SUN4M_CPU_RESET_INTERRUPT] = { "u", "level" },
+    [TRACE_SUN4M_CPU_SET_IRQ_RAISE] = { "i", "level" },
+    [TRACE_SUN4M_CPU_SET_IRQ_LOWER] = { "i", "level" },
+    [TRACE_SUN4M_IOMMU_MEM_READL] = { "uu", "addr,ret" },
+    [TRACE_SUN4M_IOMMU_MEM_WRITEL] = { "uu", "addr,val" },
+    [TRACE_SUN4M_IOMMU_MEM_WRITEL_CTRL] = { "u", "iostart" },
+    [TRACE_SUN4M_IOMMU_MEM_WRITEL_TLBFLUSH] = { "u", "val" },
+    [TRACE_SUN4M_IOMMU_MEM_WRITEL_PGFLUSH] = { "u", "val" },
+    [TRACE_SUN4M_IOMMU_PAGE_GET_FLAGS] = { "uuu", "pa,iopte,ret" },
+    [TRACE_SUN4M_IOMMU_TRANSLATE_PA] = { "uuu", "addr,pa,iopte" },
+    [TRACE_SUN4M_IOMMU_BAD_ADDR] = { "u", "addr" },
+    [TRACE_USB_PACKET_STATE_CHANGE] = { "isipss", "bus,port,ep,p,o,n" },
+    [TRACE_USB_PACKET_STATE_FAULT] = { "isipss", "bus,port,ep,p,o,n" },
+    [TRACE_USB_PORT_CLAIM] = { "is", "bus,port" },
+    [TRACE_USB_PORT_ATTACH] = { "isss", "bus,port,devspeed,portspeed" },
+    [TRACE_USB_PORT_DETACH] = { "is", "bus,port" },
+    [TRACE_USB_PORT_RELEASE] = { "is", "bus,port" },
+    [TRACE_USB_OHCI_ISO_TD_READ_FAILED] = { "u", "addr" },
+    [TRACE_USB_OHCI_ISO_TD_HEAD] = { "uuuuuuuuui", "head,tail,flags,bp,next,be,framenum,startframe,framecount,rel_frame_num" },
+    [TRACE_USB_OHCI_ISO_TD_HEAD_OFFSET] = { "uuuuuuuu", "o0,o1,o2,o3,o4,o5,o6,o7" },
+    [TRACE_USB_OHCI_ISO_TD_RELATIVE_FRAME_NUMBER_NEG] = { "i", "rel" },
+    [TRACE_USB_OHCI_ISO_TD_RELATIVE_FRAME_NUMBER_BIG] = { "ii", "rel,count" },
+    [TRACE_USB_OHCI_ISO_TD_BAD_DIRECTION] = { "i", "dir" },
+    [TRACE_USB_OHCI_ISO_TD_BAD_BP_BE] = { "uu", "bp,be" },
+    [TRACE_USB_OHCI_ISO_TD_BAD_CC_NOT_ACCESSED] = { "uu", "start,next" },
+    [TRACE_USB_OHCI_ISO_TD_BAD_CC_OVERRUN] = { "uu", "start,next" },
+    [TRACE_USB_OHCI_ISO_TD_SO] = { "uuuusii", "so,eo,s,e,str,len,ret" },
+    [TRACE_USB_OHCI_ISO_TD_DATA_OVERRUN] = { "ii", "ret,len" },
+    [TRACE_USB_OHCI_ISO_TD_DATA_UNDERRUN] = { "i", "ret" },
+    [TRACE_USB_OHCI_ISO_TD_NAK] = { "i", "ret" },
+    [TRACE_USB_OHCI_ISO_TD_BAD_RESPONSE] = { "i", "ret" },
+    [TRACE_USB_OHCI_PORT_ATTACH] = { "i", "index" },
+    [TRACE_USB_OHCI_PORT_DETACH] = { "i", "index" },
+    [TRACE_USB_OHCI_PORT_WAKEUP] = { "i", "index" },
+    [TRACE_USB_OHCI_PORT_SUSPEND] = { "i", "index" },
+    [TRACE_USB_OHCI_PORT_RESET] = { "i", "index" },
+    [TRACE_USB_OHCI_REMOTE_WAKEUP] = { "s", "s" },
+    [TRACE_USB_OHCI_RESET] = { "s", "s" },
+    [TRACE_USB_OHCI_START] = { "s", "s" },
+    [TRACE_USB_OHCI_RESUME] = { "s", "s" },
+    [TRACE_USB_OHCI_STOP] = { "s", "s" },
+    [TRACE_USB_OHCI_EXIT] = { "s", "s" },
+    [TRACE_USB_OHCI_SET_CTL] = { "su", "s,new_state" },
+    [TRACE_USB_OHCI_TD_UNDERRUN] = { "", "" },
+    [TRACE_USB_OHCI_TD_DEV_ERROR] = { "", "" },
+    [TRACE_USB_OHCI_TD_NAK] = { "", "" },
+    [TRACE_USB_OHCI_TD_STALL] = { "", "" },
+    [TRACE_USB_OHCI_TD_BABBLE] = { "", "" },
+    [TRACE_USB_OHCI_TD_BAD_DEVICE_RESPONSE] = { "i", "rc" },
+    [TRACE_USB_OHCI_TD_READ_ERROR] = { "u", "addr" },
+    [TRACE_USB_OHCI_TD_BAD_DIRECTION] = { "i", "dir" },
+    [TRACE_USB_OHCI_TD_SKIP_ASYNC] = { "", "" },
+    [TRACE_USB_OHCI_TD_PKT_HDR] = { "uiisiuu", "addr,pktlen,len,s,flag_r,cbp,be" },
+    [TRACE_USB_OHCI_TD_PKT_SHORT] = { "ss", "dir,buf" },
+    [TRACE_USB_OHCI_TD_PKT_FULL] = { "ss", "dir,buf" },
+    [TRACE_USB_OHCI_TD_TOO_MANY_PENDING] = { "", "" },
+    [TRACE_USB_OHCI_TD_PACKET_STATUS] = { "i", "status" },
+    [TRACE_USB_OHCI_ED_READ_ERROR] = { "u", "addr" },
+    [TRACE_USB_OHCI_ED_PKT] = { "uiiuuu", "cur,h,c,head,tail,next" },
+    [TRACE_USB_OHCI_ED_PKT_FLAGS] = { "uuuiiiu", "fa,en,d,s,k,f,mps" },
+    [TRACE_USB_OHCI_HCCA_READ_ERROR] = { "u", "addr" },
+    [TRACE_USB_OHCI_MEM_READ_UNALIGNED] = { "u", "addr" },
+    [TRACE_USB_OHCI_MEM_READ_BAD_OFFSET] = { "u", "addr" },
+    [TRACE_USB_OHCI_MEM_WRITE_UNALIGNED] = { "u", "addr" },
+    [TRACE_USB_OHCI_MEM_WRITE_BAD_OFFSET] = { "u", "addr" },
+    [TRACE_USB_OHCI_PROCESS_LISTS] = { "uu", "head,cur" },
+    [TRACE_USB_OHCI_BUS_EOF_TIMER_FAILED] = { "s", "name" },
+    [TRACE_USB_OHCI_SET_FRAME_INTERVAL] = { "suu", "name,fi_x,fi_u" },
+    [TRACE_USB_OHCI_HUB_POWER_UP] = { "", "" },
+    [TRACE_USB_OHCI_HUB_POWER_DOWN] = { "", "" },
+    [TRACE_USB_OHCI_INIT_TIME] = { "ii", "frametime,bittime" },
+    [TRACE_USB_OHCI_DIE] = { "", "" },
+    [TRACE_USB_OHCI_ASYNC_COMPLETE] = { "", "" },
+    [TRACE_USB_EHCI_RESET] = { "", "" },
+    [TRACE_USB_EHCI_UNREALIZE] = { "", "" },
+    [TRACE_USB_EHCI_OPREG_READ] = { "usu", "addr,str,val" },
+    [TRACE_USB_EHCI_OPREG_WRITE] = { "usu", "addr,str,val" },
+    [TRACE_USB_EHCI_OPREG_CHANGE] = { "usuu", "addr,str,new,old" },
+    [TRACE_USB_EHCI_PORTSC_READ] = { "uuu", "addr,port,val" },
+    [TRACE_USB_EHCI_PORTSC_WRITE] = { "uuu", "addr,port,val" },
+    [TRACE_USB_EHCI_PORTSC_CHANGE] = { "uuuu", "addr,port,new,old" },
+    [TRACE_USB_EHCI_USBSTS] = { "si", "sts,state" },
+    [TRACE_USB_EHCI_STATE] = { "ss", "schedule,state" },
+    [TRACE_USB_EHCI_QH_PTRS] = { "puuuuu", "q,addr,nxt,c_qtd,n_qtd,a_qtd" },
+    [TRACE_USB_EHCI_QH_FIELDS] = { "uiiiii", "addr,rl,mplen,eps,ep,devaddr" },
+    [TRACE_USB_EHCI_QH_BITS] = { "uiiii", "addr,c,h,dtc,i" },
+    [TRACE_USB_EHCI_QTD_PTRS] = { "puuu", "q,addr,nxt,altnext" },
+    [TRACE_USB_EHCI_QTD_FIELDS] = { "uiiii", "addr,tbytes,cpage,cerr,pid" },
+    [TRACE_USB_EHCI_QTD_BITS] = { "uiiiii", "addr,ioc,active,halt,babble,xacterr" },
+    [TRACE_USB_EHCI_ITD] = { "uuuuuu", "addr,nxt,mplen,mult,ep,devaddr" },
+    [TRACE_USB_EHCI_SITD] = { "uuu", "addr,nxt,active" },
+    [TRACE_USB_EHCI_PORT_ATTACH] = { "uss", "port,owner,device" },
+    [TRACE_USB_EHCI_PORT_DETACH] = { "us", "port,owner" },
+    [TRACE_USB_EHCI_PORT_RESET] = { "ui", "port,enable" },
+    [TRACE_USB_EHCI_PORT_SUSPEND] = { "u", "port" },
+    [TRACE_USB_EHCI_PORT_WAKEUP] = { "u", "port" },
+    [TRACE_USB_EHCI_PORT_RESUME] = { "u", "port" },
+    [TRACE_USB_EHCI_QUEUE_ACTION] = { "ps", "q,action" },
+    [TRACE_USB_EHCI_PACKET_ACTION] = { "pps", "q,p,action" },
+    [TRACE_USB_EHCI_IRQ] = { "uuuu", "level,frindex,sts,mask" },
+    [TRACE_USB_EHCI_GUEST_BUG] = { "s", "reason" },
+    [TRACE_USB_EHCI_DOORBELL_RING] = { "", "" },
+    [TRACE_USB_EHCI_DOORBELL_ACK] = { "", "" },
+    [TRACE_USB_EHCI_DMA_ERROR] = { "", "" },
+    [TRACE_USB_UHCI_RESET] = { "", "" },
+    [TRACE_USB_UHCI_EXIT] = { "", "" },
+    [TRACE_USB_UHCI_SCHEDULE_START] = { "", "" },
+    [TRACE_USB_UHCI_SCHEDULE_STOP] = { "", "" },
+    [TRACE_USB_UHCI_FRAME_START] = { "u", "num" },
+    [TRACE_USB_UHCI_FRAME_STOP_BANDWIDTH] = { "", "" },
+    [TRACE_USB_UHCI_FRAME_LOOP_STOP_IDLE] = { "", "" },
+    [TRACE_USB_UHCI_FRAME_LOOP_CONTINUE] = { "", "" },
+    [TRACE_USB_UHCI_MMIO_READW] = { "uu", "addr,val" },
+    [TRACE_USB_UHCI_MMIO_WRITEW] = { "uu", "addr,val" },
+    [TRACE_USB_UHCI_QUEUE_ADD] = { "u", "token" },
+    [TRACE_USB_UHCI_QUEUE_DEL] = { "us", "token,reason" },
+    [TRACE_USB_UHCI_PACKET_ADD] = { "uu", "token,addr" },
+    [TRACE_USB_UHCI_PACKET_LINK_ASYNC] = { "uu", "token,addr" },
+    [TRACE_USB_UHCI_PACKET_UNLINK_ASYNC] = { "uu", "token,addr" },
+    [TRACE_USB_UHCI_PACKET_CANCEL] = { "uui", "token,addr,done" },
+    [TRACE_USB_UHCI_PACKET_COMPLETE_SUCCESS] = { "uu", "token,addr" },
+    [TRACE_USB_UHCI_PACKET_COMPLETE_SHORTXFER] = { "uu", "token,addr" },
+    [TRACE_USB_UHCI_PACKET_COMPLETE_STALL] = { "uu", "token,addr" },
+    [TRACE_USB_UHCI_PACKET_COMPLETE_BABBLE] = { "uu", "token,addr" },
+    [TRACE_USB_UHCI_PACKET_COMPLETE_ERROR] = { "uu", "token,addr" },
+    [TRACE_USB_UHCI_PACKET_DEL] = { "uu", "token,addr" },
+    [TRACE_USB_UHCI_QH_LOAD] = { "u", "qh" },
+    [TRACE_USB_UHCI_TD_LOAD] = { "uuuu", "qh,td,ctrl,token" },
+    [TRACE_USB_UHCI_TD_QUEUE] = { "uuu", "td,ctrl,token" },
+    [TRACE_USB_UHCI_TD_NEXTQH] = { "uu", "qh,td" },
+    [TRACE_USB_UHCI_TD_ASYNC] = { "uu", "qh,td" },
+    [TRACE_USB_UHCI_TD_COMPLETE] = { "uu", "qh,td" },
+    [TRACE_USB_XHCI_RESET] = { "", "" },
+    [TRACE_USB_XHCI_EXIT] = { "", "" },
+    [TRACE_USB_XHCI_RUN] = { "", "" },
+    [TRACE_USB_XHCI_STOP] = { "", "" },
+    [TRACE_USB_XHCI_CAP_READ] = { "uu", "off,val" },
+    [TRACE_USB_XHCI_OPER_READ] = { "uu", "off,val" },
+    [TRACE_USB_XHCI_PORT_READ] = { "uuu", "port,off,val" },
+    [TRACE_USB_XHCI_RUNTIME_READ] = { "uu", "off,val" },
+    [TRACE_USB_XHCI_DOORBELL_READ] = { "uu", "off,val" },
+    [TRACE_USB_XHCI_OPER_WRITE] = { "uu", "off,val" },
+    [TRACE_USB_XHCI_PORT_WRITE] = { "uuu", "port,off,val" },
+    [TRACE_USB_XHCI_RUNTIME_WRITE] = { "uu", "off,val" },
+    [TRACE_USB_XHCI_DOORBELL_WRITE] = { "uu", "off,val" },
+    [TRACE_USB_XHCI_IRQ_INTX] = { "u", "level" },
+    [TRACE_USB_XHCI_IRQ_MSI] = { "u", "nr" },
+    [TRACE_USB_XHCI_IRQ_MSIX] = { "u", "nr" },
+    [TRACE_USB_XHCI_IRQ_MSIX_USE] = { "u", "nr" },
+    [TRACE_USB_XHCI_IRQ_MSIX_UNUSE] = { "u", "nr" },
+    [TRACE_USB_XHCI_QUEUE_EVENT] = { "uussuuu", "vector,idx,trb,evt,param,status,control" },
+    [TRACE_USB_XHCI_FETCH_TRB] = { "usuuu", "addr,name,param,status,control" },
+    [TRACE_USB_XHCI_PORT_RESET] = { "uu", "port,warm" },
+    [TRACE_USB_XHCI_PORT_LINK] = { "uu", "port,pls" },
+    [TRACE_USB_XHCI_PORT_NOTIFY] = { "uu", "port,pls" },
+    [TRACE_USB_XHCI_SLOT_ENABLE] = { "u", "slotid" },
+    [TRACE_USB_XHCI_SLOT_DISABLE] = { "u", "slotid" },
+    [TRACE_USB_XHCI_SLOT_ADDRESS] = { "us", "slotid,port" },
+    [TRACE_USB_XHCI_SLOT_CONFIGURE] = { "u", "slotid" },
+    [TRACE_USB_XHCI_SLOT_EVALUATE] = { "u", "slotid" },
+    [TRACE_USB_XHCI_SLOT_RESET] = { "u", "slotid" },
+    [TRACE_USB_XHCI_EP_ENABLE] = { "uu", "slotid,epid" },
+    [TRACE_USB_XHCI_EP_DISABLE] = { "uu", "slotid,epid" },
+    [TRACE_USB_XHCI_EP_SET_DEQUEUE] = { "uuuu", "slotid,epid,streamid,param" },
+    [TRACE_USB_XHCI_EP_KICK] = { "uuu", "slotid,epid,streamid" },
+    [TRACE_USB_XHCI_EP_STOP] = { "uu", "slotid,epid" },
+    [TRACE_USB_XHCI_EP_RESET] = { "uu", "slotid,epid" },
+    [TRACE_USB_XHCI_EP_STATE] = { "uuss", "slotid,epid,os,ns" },
+    [TRACE_USB_XHCI_XFER_START] = { "puuu", "xfer,slotid,epid,streamid" },
+    [TRACE_USB_XHCI_XFER_ASYNC] = { "p", "xfer" },
+    [TRACE_USB_XHCI_XFER_NAK] = { "p", "xfer" },
+    [TRACE_USB_XHCI_XFER_RETRY] = { "p", "xfer" },
+    [TRACE_USB_XHCI_XFER_SUCCESS] = { "pu", "xfer,bytes" },
+    [TRACE_USB_XHCI_XFER_ERROR] = { "pu", "xfer,ret" },
+    [TRACE_USB_XHCI_UNIMPLEMENTED] = { "si", "item,nr" },
+    [TRACE_USB_DESC_DEVICE] = { "iii", "addr,len,ret" },
+    [TRACE_USB_DESC_DEVICE_QUALIFIER] = { "iii", "addr,len,ret" },
+    [TRACE_USB_DESC_CONFIG] = { "iiii", "addr,index,len,ret" },
+    [TRACE_USB_DESC_OTHER_SPEED_CONFIG] = { "iiii", "addr,index,len,ret" },
+    [TRACE_USB_DESC_STRING] = { "iiii", "addr,index,len,ret" },
+    [TRACE_USB_DESC_BOS] = { "iii", "addr,len,ret" },
+    [TRACE_USB_DESC_MSOS] = { "iiii", "addr,index,len,ret" },
+    [TRACE_USB_SET_ADDR] = { "i", "addr" },
+    [TRACE_USB_SET_CONFIG] = { "iii", "addr,config,ret" },
+    [TRACE_USB_SET_INTERFACE] = { "iiii", "addr,iface,alt,ret" },
+    [TRACE_USB_CLEAR_DEVICE_FEATURE] = { "iii", "addr,feature,ret" },
+    [TRACE_USB_SET_DEVICE_FEATURE] = { "iii", "addr,feature,ret" },
+    [TRACE_USB_HUB_RESET] = { "i", "addr" },
+    [TRACE_USB_HUB_CONTROL] = { "iiiii", "addr,request,value,index,length" },
+    [TRACE_USB_HUB_GET_PORT_STATUS] = { "iiii", "addr,nr,status,changed" },
+    [TRACE_USB_HUB_SET_PORT_FEATURE] = { "iis", "addr,nr,f" },
+    [TRACE_USB_HUB_CLEAR_PORT_FEATURE] = { "iis", "addr,nr,f" },
+    [TRACE_USB_HUB_ATTACH] = { "ii", "addr,nr" },
+    [TRACE_USB_HUB_DETACH] = { "ii", "addr,nr" },
+    [TRACE_USB_HUB_STATUS_REPORT] = { "ii", "addr,status" },
+    [TRACE_USB_UAS_RESET] = { "i", "addr" },
+    [TRACE_USB_UAS_COMMAND] = { "iuiuu", "addr,tag,lun,lun64_1,lun64_2" },
+    [TRACE_USB_UAS_RESPONSE] = { "iuu", "addr,tag,code" },
+    [TRACE_USB_UAS_SENSE] = { "iuu", "addr,tag,status" },
+    [TRACE_USB_UAS_READ_READY] = { "iu", "addr,tag" },
+    [TRACE_USB_UAS_WRITE_READY] = { "iu", "addr,tag" },
+    [TRACE_USB_UAS_XFER_DATA] = { "iuuuuuu", "addr,tag,copy,uoff,usize,soff,ssize" },
+    [TRACE_USB_UAS_SCSI_DATA] = { "iuu", "addr,tag,bytes" },
+    [TRACE_USB_UAS_SCSI_COMPLETE] = { "iuuu", "addr,tag,status,resid" },
+    [TRACE_USB_UAS_TMF_ABORT_TASK] = { "iuu", "addr,tag,task_tag" },
+    [TRACE_USB_UAS_TMF_LOGICAL_UNIT_RESET] = { "iui", "addr,tag,lun" },
+    [TRACE_USB_UAS_TMF_UNSUPPORTED] = { "iuu", "addr,tag,function" },
+    [TRACE_USB_MTP_RESET] = { "i", "addr" },
+    [TRACE_USB_MTP_COMMAND] = { "iuuuuuuu", "dev,code,trans,arg0,arg1,arg2,arg3,arg4" },
+    [TRACE_USB_MTP_SUCCESS] = { "iuuu", "dev,trans,arg0,arg1" },
+    [TRACE_USB_MTP_ERROR] = { "iuuuu", "dev,code,trans,arg0,arg1" },
+    [TRACE_USB_MTP_DATA_IN] = { "iuu", "dev,trans,len" },
+    [TRACE_USB_MTP_XFER] = { "iuuu", "dev,ep,dlen,plen" },
+    [TRACE_USB_MTP_NAK] = { "iu", "dev,ep" },
+    [TRACE_USB_MTP_STALL] = { "is", "dev,reason" },
+    [TRACE_USB_MTP_OP_GET_DEVICE_INFO] = { "i", "dev" },
+    [TRACE_USB_MTP_OP_OPEN_SESSION] = { "i", "dev" },
+    [TRACE_USB_MTP_OP_CLOSE_SESSION] = { "i", "dev" },
+    [TRACE_USB_MTP_OP_GET_STORAGE_IDS] = { "i", "dev" },
+    [TRACE_USB_MTP_OP_GET_STORAGE_INFO] = { "i", "dev" },
+    [TRACE_USB_MTP_OP_GET_NUM_OBJECTS] = { "ius", "dev,handle,path" },
+    [TRACE_USB_MTP_OP_GET_OBJECT_HANDLES] = { "ius", "dev,handle,path" },
+    [TRACE_USB_MTP_OP_GET_OBJECT_INFO] = { "ius", "dev,handle,path" },
+    [TRACE_USB_MTP_OP_GET_OBJECT] = { "ius", "dev,handle,path" },
+    [TRACE_USB_MTP_OP_GET_PARTIAL_OBJECT] = { "iusuu", "dev,handle,path,offset,length" },
+    [TRACE_USB_MTP_OP_UNKNOWN] = { "iu", "dev,code" },
+    [TRACE_USB_MTP_OBJECT_ALLOC] = { "ius", "dev,handle,path" },
+    [TRACE_USB_MTP_OBJECT_FREE] = { "ius", "dev,handle,path" },
+    [TRACE_USB_HOST_OPEN_STARTED] = { "ii", "bus,addr" },
+    [TRACE_USB_HOST_OPEN_SUCCESS] = { "ii", "bus,addr" },
+    [TRACE_USB_HOST_OPEN_FAILURE] = { "ii", "bus,addr" },
+    [TRACE_USB_HOST_CLOSE] = { "ii", "bus,addr" },
+    [TRACE_USB_HOST_ATTACH_KERNEL] = { "iii", "bus,addr,interface" },
+    [TRACE_USB_HOST_DETACH_KERNEL] = { "iii", "bus,addr,interface" },
+    [TRACE_USB_HOST_SET_ADDRESS] = { "iii", "bus,addr,config" },
+    [TRACE_USB_HOST_SET_CONFIG] = { "iii", "bus,addr,config" },
+    [TRACE_USB_HOST_SET_INTERFACE] = { "iiii", "bus,addr,interface,alt" },
+    [TRACE_USB_HOST_CLAIM_INTERFACE] = { "iiii", "bus,addr,config,interface" },
+    [TRACE_USB_HOST_RELEASE_INTERFACE] = { "iii", "bus,addr,interface" },
+    [TRACE_USB_HOST_REQ_CONTROL] = { "iipiii", "bus,addr,p,req,value,index" },
+    [TRACE_USB_HOST_REQ_DATA] = { "iipiii", "bus,addr,p,in,ep,size" },
+    [TRACE_USB_HOST_REQ_COMPLETE] = { "iipii", "bus,addr,p,status,length" },
+    [TRACE_USB_HOST_REQ_EMULATED] = { "iipi", "bus,addr,p,status" },
+    [TRACE_USB_HOST_REQ_CANCELED] = { "iip", "bus,addr,p" },
+    [TRACE_USB_HOST_ISO_START] = { "iii", "bus,addr,ep" },
+    [TRACE_USB_HOST_ISO_STOP] = { "iii", "bus,addr,ep" },
+    [TRACE_USB_HOST_ISO_OUT_OF_BUFS] = { "iii", "bus,addr,ep" },
+    [TRACE_USB_HOST_RESET] = { "ii", "bus,addr" },
+    [TRACE_USB_HOST_AUTO_SCAN_ENABLED] = { "", "" },
+    [TRACE_USB_HOST_AUTO_SCAN_DISABLED] = { "", "" },
+    [TRACE_USB_HOST_PARSE_CONFIG] = { "iiii", "bus,addr,value,active" },
+    [TRACE_USB_HOST_PARSE_INTERFACE] = { "iiiii", "bus,addr,num,alt,active" },
+    [TRACE_USB_HOST_PARSE_ENDPOINT] = { "iiissi", "bus,addr,ep,dir,type,active" },
+    [TRACE_USB_HOST_PARSE_ERROR] = { "iis", "bus,addr,errmsg" },
+    [TRACE_SCSI_REQ_ALLOC] = { "iii", "target,lun,tag" },
+    [TRACE_SCSI_REQ_CANCEL] = { "iii", "target,lun,tag" },
+    [TRACE_SCSI_REQ_DATA] = { "iiii", "target,lun,tag,len" },
+    [TRACE_SCSI_REQ_DATA_CANCELED] = { "iiii", "target,lun,tag,len" },
+    [TRACE_SCSI_REQ_DEQUEUE] = { "iii", "target,lun,tag" },
+    [TRACE_SCSI_REQ_CONTINUE] = { "iii", "target,lun,tag" },
+    [TRACE_SCSI_REQ_CONTINUE_CANCELED] = { "iii", "target,lun,tag" },
+    [TRACE_SCSI_REQ_PARSED] = { "iiiiii", "target,lun,tag,cmd,mode,xfer" },
+    [TRACE_SCSI_REQ_PARSED_LBA] = { "iiiiu", "target,lun,tag,cmd,lba" },
+    [TRACE_SCSI_REQ_PARSE_BAD] = { "iiii", "target,lun,tag,cmd" },
+    [TRACE_SCSI_REQ_BUILD_SENSE] = { "iiiiii", "target,lun,tag,key,asc,ascq" },
+    [TRACE_SCSI_DEVICE_SET_UA] = { "iiiii", "target,lun,key,asc,ascq" },
+    [TRACE_SCSI_REPORT_LUNS] = { "iii", "target,lun,tag" },
+    [TRACE_SCSI_INQUIRY] = { "iiiii", "target,lun,tag,cdb1,cdb2" },
+    [TRACE_SCSI_TEST_UNIT_READY] = { "iii", "target,lun,tag" },
+    [TRACE_SCSI_REQUEST_SENSE] = { "iii", "target,lun,tag" },
+    [TRACE_VM_STATE_NOTIFY] = { "ii", "running,reason" },
+    [TRACE_LOAD_FILE] = { "ss", "name,path" },
+    [TRACE_RUNSTATE_SET] = { "i", "new_state" },
+    [TRACE_G_MALLOC] = { "up", "size,ptr" },
+    [TRACE_G_REALLOC] = { "pup", "ptr,size,newptr" },
+    [TRACE_G_FREE] = { "p", "ptr" },
+    [TRACE_SYSTEM_WAKEUP_REQUEST] = { "i", "reason" },
+    [TRACE_QEMU_SYSTEM_SHUTDOWN_REQUEST] = { "", "" },
+    [TRACE_QEMU_SYSTEM_POWERDOWN_REQUEST] = { "", "" },
+    [TRACE_QCOW2_WRITEV_START_REQ] = { "pii", "co,sector,nb_sectors" },
+    [TRACE_QCOW2_WRITEV_DONE_REQ] = { "pi", "co,ret" },
+    [TRACE_QCOW2_WRITEV_START_PART] = { "p", "co" },
+    [TRACE_QCOW2_WRITEV_DONE_PART] = { "pi", "co,cur_nr_sectors" },
+    [TRACE_QCOW2_WRITEV_DATA] = { "pu", "co,offset" },
+    [TRACE_QCOW2_ALLOC_CLUSTERS_OFFSET] = { "pui", "co,offset,num" },
+    [TRACE_QCOW2_HANDLE_COPIED] = { "puuu", "co,guest_offset,host_offset,bytes" },
+    [TRACE_QCOW2_HANDLE_ALLOC] = { "puuu", "co,guest_offset,host_offset,bytes" },
+    [TRACE_QCOW2_DO_ALLOC_CLUSTERS_OFFSET] = { "puui", "co,guest_offset,host_offset,nb_clusters" },
+    [TRACE_QCOW2_CLUSTER_ALLOC_PHYS] = { "p", "co" },
+    [TRACE_QCOW2_CLUSTER_LINK_L2] = { "pi", "co,nb_clusters" },
+    [TRACE_QCOW2_L2_ALLOCATE] = { "pi", "bs,l1_index" },
+    [TRACE_QCOW2_L2_ALLOCATE_GET_EMPTY] = { "pi", "bs,l1_index" },
+    [TRACE_QCOW2_L2_ALLOCATE_WRITE_L2] = { "pi", "bs,l1_index" },
+    [TRACE_QCOW2_L2_ALLOCATE_WRITE_L1] = { "pi", "bs,l1_index" },
+    [TRACE_QCOW2_L2_ALLOCATE_DONE] = { "pii", "bs,l1_index,ret" },
+    [TRACE_QCOW2_CACHE_GET] = { "piuu", "co,c,offset,read_from_disk" },
+    [TRACE_QCOW2_CACHE_GET_REPLACE_ENTRY] = { "pii", "co,c,i" },
+    [TRACE_QCOW2_CACHE_GET_READ] = { "pii", "co,c,i" },
+    [TRACE_QCOW2_CACHE_GET_DONE] = { "pii", "co,c,i" },
+    [TRACE_QCOW2_CACHE_FLUSH] = { "pi", "co,c" },
+    [TRACE_QCOW2_CACHE_ENTRY_FLUSH] = { "pii", "co,c,i" },
+    [TRACE_QED_ALLOC_L2_CACHE_ENTRY] = { "pp", "l2_cache,entry" },
+    [TRACE_QED_UNREF_L2_CACHE_ENTRY] = { "pi", "entry,ref" },
+    [TRACE_QED_FIND_L2_CACHE_ENTRY] = { "ppui", "l2_cache,entry,offset,ref" },
+    [TRACE_QED_READ_TABLE] = { "pup", "s,offset,table" },
+    [TRACE_QED_READ_TABLE_CB] = { "ppi", "s,table,ret" },
+    [TRACE_QED_WRITE_TABLE] = { "pupuu", "s,offset,table,index,n" },
+    [TRACE_QED_WRITE_TABLE_CB] = { "ppii", "s,table,flush,ret" },
+    [TRACE_QED_NEED_CHECK_TIMER_CB] = { "p", "s" },
+    [TRACE_QED_START_NEED_CHECK_TIMER] = { "p", "s" },
+    [TRACE_QED_CANCEL_NEED_CHECK_TIMER] = { "p", "s" },
+    [TRACE_QED_AIO_COMPLETE] = { "ppi", "s,acb,ret" },
+    [TRACE_QED_AIO_SETUP] = { "ppiipi", "s,acb,sector_num,nb_sectors,opaque,flags" },
+    [TRACE_QED_AIO_NEXT_IO] = { "ppiu", "s,acb,ret,cur_pos" },
+    [TRACE_QED_AIO_READ_DATA] = { "ppiuu", "s,acb,ret,offset,len" },
+    [TRACE_QED_AIO_WRITE_DATA] = { "ppiuu", "s,acb,ret,offset,len" },
+    [TRACE_QED_AIO_WRITE_PREFILL] = { "ppuuu", "s,acb,start,len,offset" },
+    [TRACE_QED_AIO_WRITE_POSTFILL] = { "ppuuu", "s,acb,start,len,offset" },
+    [TRACE_QED_AIO_WRITE_MAIN] = { "ppiuu", "s,acb,ret,offset,len" },
+    [TRACE_G364FB_READ] = { "uu", "addr,val" },
+    [TRACE_G364FB_WRITE] = { "uu", "addr,new" },
+    [TRACE_GRLIB_GPTIMER_ENABLE] = { "iu", "id,count" },
+    [TRACE_GRLIB_GPTIMER_DISABLED] = { "iu", "id,config" },
+    [TRACE_GRLIB_GPTIMER_RESTART] = { "iu", "id,reload" },
+    [TRACE_GRLIB_GPTIMER_SET_SCALER] = { "uu", "scaler,freq" },
+    [TRACE_GRLIB_GPTIMER_HIT] = { "i", "id" },
+    [TRACE_GRLIB_GPTIMER_READL] = { "iuu", "id,addr,val" },
+    [TRACE_GRLIB_GPTIMER_WRITEL] = { "iuu", "id,addr,val" },
+    [TRACE_GRLIB_IRQMP_CHECK_IRQS] = { "uuuuu", "pend,force,mask,lvl1,lvl2" },
+    [TRACE_GRLIB_IRQMP_ACK] = { "i", "intno" },
+    [TRACE_GRLIB_IRQMP_SET_IRQ] = { "i", "irq" },
+    [TRACE_GRLIB_IRQMP_READL_UNKNOWN] = { "u", "addr" },
+    [TRACE_GRLIB_IRQMP_WRITEL_UNKNOWN] = { "uu", "addr,value" },
+    [TRACE_GRLIB_APBUART_EVENT] = { "i", "event" },
+    [TRACE_GRLIB_APBUART_WRITEL_UNKNOWN] = { "uu", "addr,value" },
+    [TRACE_GRLIB_APBUART_READL_UNKNOWN] = { "u", "addr" },
+    [TRACE_LEON3_SET_IRQ] = { "i", "intno" },
+    [TRACE_LEON3_RESET_IRQ] = { "i", "intno" },
+    [TRACE_SPICE_VMC_WRITE] = { "ii", "out,len" },
+    [TRACE_SPICE_VMC_READ] = { "ii", "bytes,len" },
+    [TRACE_SPICE_VMC_REGISTER_INTERFACE] = { "p", "scd" },
+    [TRACE_SPICE_VMC_UNREGISTER_INTERFACE] = { "p", "scd" },
+    [TRACE_SPICE_VMC_EVENT] = { "i", "event" },
+    [TRACE_LM32_PIC_RAISE_IRQ] = { "", "" },
+    [TRACE_LM32_PIC_LOWER_IRQ] = { "", "" },
+    [TRACE_LM32_PIC_INTERRUPT] = { "ii", "irq,level" },
+    [TRACE_LM32_PIC_SET_IM] = { "u", "im" },
+    [TRACE_LM32_PIC_SET_IP] = { "u", "ip" },
+    [TRACE_LM32_PIC_GET_IM] = { "u", "im" },
+    [TRACE_LM32_PIC_GET_IP] = { "u", "ip" },
+    [TRACE_LM32_JUART_GET_JTX] = { "u", "value" },
+    [TRACE_LM32_JUART_SET_JTX] = { "u", "value" },
+    [TRACE_LM32_JUART_GET_JRX] = { "u", "value" },
+    [TRACE_LM32_JUART_SET_JRX] = { "u", "value" },
+    [TRACE_LM32_TIMER_MEMORY_WRITE] = { "uu", "addr,value" },
+    [TRACE_LM32_TIMER_MEMORY_READ] = { "uu", "addr,value" },
+    [TRACE_LM32_TIMER_HIT] = { "", "" },
+    [TRACE_LM32_TIMER_IRQ_STATE] = { "i", "level" },
+    [TRACE_LM32_UART_MEMORY_WRITE] = { "uu", "addr,value" },
+    [TRACE_LM32_UART_MEMORY_READ] = { "uu", "addr,value" },
+    [TRACE_LM32_UART_IRQ_STATE] = { "i", "level" },
+    [TRACE_MEGASAS_INIT_FIRMWARE] = { "u", "pa" },
+    [TRACE_MEGASAS_INIT_QUEUE] = { "uiuuu", "queue_pa,queue_len,head,tail,flags" },
+    [TRACE_MEGASAS_INITQ_MAP_FAILED] = { "i", "frame" },
+    [TRACE_MEGASAS_INITQ_MAPPED] = { "u", "pa" },
+    [TRACE_MEGASAS_INITQ_MISMATCH] = { "ii", "queue_len,fw_cmds" },
+    [TRACE_MEGASAS_QF_MAPPED] = { "u", "index" },
+    [TRACE_MEGASAS_QF_NEW] = { "uu", "index,frame" },
+    [TRACE_MEGASAS_QF_BUSY] = { "u", "pa" },
+    [TRACE_MEGASAS_QF_ENQUEUE] = { "uuuuui", "index,count,context,head,tail,busy" },
+    [TRACE_MEGASAS_QF_UPDATE] = { "uuu", "head,tail,busy" },
+    [TRACE_MEGASAS_QF_MAP_FAILED] = { "iu", "cmd,frame" },
+    [TRACE_MEGASAS_QF_COMPLETE_NOIRQ] = { "u", "context" },
+    [TRACE_MEGASAS_QF_COMPLETE] = { "uuui", "context,head,tail,busy" },
+    [TRACE_MEGASAS_FRAME_BUSY] = { "u", "addr" },
+    [TRACE_MEGASAS_UNHANDLED_FRAME_CMD] = { "iu", "cmd,frame_cmd" },
+    [TRACE_MEGASAS_HANDLE_SCSI] = { "siiipu", "frame,bus,dev,lun,sdev,size" },
+    [TRACE_MEGASAS_SCSI_TARGET_NOT_PRESENT] = { "siii", "frame,bus,dev,lun" },
+    [TRACE_MEGASAS_SCSI_INVALID_CDB_LEN] = { "siiii", "frame,bus,dev,lun,len" },
+    [TRACE_MEGASAS_IOV_READ_OVERFLOW] = { "iii", "cmd,bytes,len" },
+    [TRACE_MEGASAS_IOV_WRITE_OVERFLOW] = { "iii", "cmd,bytes,len" },
+    [TRACE_MEGASAS_IOV_READ_UNDERFLOW] = { "iii", "cmd,bytes,len" },
+    [TRACE_MEGASAS_IOV_WRITE_UNDERFLOW] = { "iii", "cmd,bytes,len" },
+    [TRACE_MEGASAS_SCSI_REQ_ALLOC_FAILED] = { "sii", "frame,dev,lun" },
+    [TRACE_MEGASAS_SCSI_READ_START] = { "ii", "cmd,len" },
+    [TRACE_MEGASAS_SCSI_WRITE_START] = { "ii", "cmd,len" },
+    [TRACE_MEGASAS_SCSI_NODATA] = { "i", "cmd" },
+    [TRACE_MEGASAS_SCSI_COMPLETE] = { "iuii", "cmd,status,len,xfer" },
+    [TRACE_MEGASAS_COMMAND_COMPLETE] = { "iuu", "cmd,status,resid" },
+    [TRACE_MEGASAS_HANDLE_IO] = { "isiiuu", "cmd,frame,dev,lun,lba,count" },
+    [TRACE_MEGASAS_IO_TARGET_NOT_PRESENT] = { "isii", "cmd,frame,dev,lun" },
+    [TRACE_MEGASAS_IO_READ_START] = { "iuuu", "cmd,lba,count,len" },
+    [TRACE_MEGASAS_IO_WRITE_START] = { "iuuu", "cmd,lba,count,len" },
+    [TRACE_MEGASAS_IO_COMPLETE] = { "iu", "cmd,len" },
+    [TRACE_MEGASAS_IOVEC_SGL_OVERFLOW] = { "iii", "cmd,index,limit" },
+    [TRACE_MEGASAS_IOVEC_SGL_UNDERFLOW] = { "ii", "cmd,index" },
+    [TRACE_MEGASAS_IOVEC_SGL_INVALID] = { "iiuu", "cmd,index,pa,len" },
+    [TRACE_MEGASAS_IOVEC_OVERFLOW] = { "iii", "cmd,len,limit" },
+    [TRACE_MEGASAS_IOVEC_UNDERFLOW] = { "iii", "cmd,len,limit" },
+    [TRACE_MEGASAS_HANDLE_DCMD] = { "ii", "cmd,opcode" },
+    [TRACE_MEGASAS_FINISH_DCMD] = { "ii", "cmd,size" },
+    [TRACE_MEGASAS_DCMD_REQ_ALLOC_FAILED] = { "is", "cmd,desc" },
+    [TRACE_MEGASAS_DCMD_INTERNAL_SUBMIT] = { "isi", "cmd,desc,dev" },
+    [TRACE_MEGASAS_DCMD_INTERNAL_FINISH] = { "iii", "cmd,opcode,lun" },
+    [TRACE_MEGASAS_DCMD_INTERNAL_INVALID] = { "ii", "cmd,opcode" },
+    [TRACE_MEGASAS_DCMD_UNHANDLED] = { "iii", "cmd,opcode,len" },
+    [TRACE_MEGASAS_DCMD_ZERO_SGE] = { "i", "cmd" },
+    [TRACE_MEGASAS_DCMD_INVALID_SGE] = { "ii", "cmd,count" },
+    [TRACE_MEGASAS_DCMD_INVALID_XFER_LEN] = { "iuu", "cmd,size,max" },
+    [TRACE_MEGASAS_DCMD_ENTER] = { "isi", "cmd,dcmd,len" },
+    [TRACE_MEGASAS_DCMD_DUMMY] = { "iu", "cmd,size" },
+    [TRACE_MEGASAS_DCMD_SET_FW_TIME] = { "iu", "cmd,time" },
+    [TRACE_MEGASAS_DCMD_PD_GET_LIST] = { "iiii", "cmd,num,max,offset" },
+    [TRACE_MEGASAS_DCMD_LD_GET_LIST] = { "iii", "cmd,num,max" },
+    [TRACE_MEGASAS_DCMD_LD_GET_INFO] = { "ii", "cmd,ld_id" },
+    [TRACE_MEGASAS_DCMD_LD_LIST_QUERY] = { "ii", "cmd,flags" },
+    [TRACE_MEGASAS_DCMD_PD_GET_INFO] = { "ii", "cmd,pd_id" },
+    [TRACE_MEGASAS_DCMD_PD_LIST_QUERY] = { "ii", "cmd,flags" },
+    [TRACE_MEGASAS_DCMD_RESET_LD] = { "ii", "cmd,target_id" },
+    [TRACE_MEGASAS_DCMD_UNSUPPORTED] = { "iu", "cmd,size" },
+    [TRACE_MEGASAS_ABORT_FRAME] = { "ii", "cmd,abort_cmd" },
+    [TRACE_MEGASAS_ABORT_NO_CMD] = { "iu", "cmd,context" },
+    [TRACE_MEGASAS_ABORT_INVALID_CONTEXT] = { "iui", "cmd,context,abort_cmd" },
+    [TRACE_MEGASAS_RESET] = { "i", "fw_state" },
+    [TRACE_MEGASAS_INIT] = { "iis", "sges,cmds,mode" },
+    [TRACE_MEGASAS_MSIX_RAISE] = { "i", "vector" },
+    [TRACE_MEGASAS_MSI_RAISE] = { "i", "vector" },
+    [TRACE_MEGASAS_IRQ_LOWER] = { "", "" },
+    [TRACE_MEGASAS_IRQ_RAISE] = { "", "" },
+    [TRACE_MEGASAS_INTR_ENABLED] = { "", "" },
+    [TRACE_MEGASAS_INTR_DISABLED] = { "", "" },
+    [TRACE_MEGASAS_MSIX_ENABLED] = { "i", "vector" },
+    [TRACE_MEGASAS_MSI_ENABLED] = { "i", "vector" },
+    [TRACE_MEGASAS_MMIO_READL] = { "su", "reg,val" },
+    [TRACE_MEGASAS_MMIO_INVALID_READL] = { "u", "addr" },
+    [TRACE_MEGASAS_MMIO_WRITEL] = { "su", "reg,val" },
+    [TRACE_MEGASAS_MMIO_INVALID_WRITEL] = { "uu", "addr,val" },
+    [TRACE_MILKYMIST_AC97_MEMORY_READ] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_AC97_MEMORY_WRITE] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_AC97_PULSE_IRQ_CRREQUEST] = { "", "" },
+    [TRACE_MILKYMIST_AC97_PULSE_IRQ_CRREPLY] = { "", "" },
+    [TRACE_MILKYMIST_AC97_PULSE_IRQ_DMAW] = { "", "" },
+    [TRACE_MILKYMIST_AC97_PULSE_IRQ_DMAR] = { "", "" },
+    [TRACE_MILKYMIST_AC97_IN_CB] = { "iu", "avail,remaining" },
+    [TRACE_MILKYMIST_AC97_IN_CB_TRANSFERRED] = { "i", "transferred" },
+    [TRACE_MILKYMIST_AC97_OUT_CB] = { "iu", "free,remaining" },
+    [TRACE_MILKYMIST_AC97_OUT_CB_TRANSFERRED] = { "i", "transferred" },
+    [TRACE_MILKYMIST_HPDMC_MEMORY_READ] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_HPDMC_MEMORY_WRITE] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_MEMCARD_MEMORY_READ] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_MEMCARD_MEMORY_WRITE] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_MINIMAC2_MEMORY_READ] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_MINIMAC2_MEMORY_WRITE] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_MINIMAC2_MDIO_WRITE] = { "uuu", "phy_addr,addr,value" },
+    [TRACE_MILKYMIST_MINIMAC2_MDIO_READ] = { "uuu", "phy_addr,addr,value" },
+    [TRACE_MILKYMIST_MINIMAC2_TX_FRAME] = { "u", "length" },
+    [TRACE_MILKYMIST_MINIMAC2_RX_FRAME] = { "pu", "buf,length" },
+    [TRACE_MILKYMIST_MINIMAC2_DROP_RX_FRAME] = { "p", "buf" },
+    [TRACE_MILKYMIST_MINIMAC2_RX_TRANSFER] = { "pu", "buf,length" },
+    [TRACE_MILKYMIST_MINIMAC2_RAISE_IRQ_RX] = { "", "" },
+    [TRACE_MILKYMIST_MINIMAC2_LOWER_IRQ_RX] = { "", "" },
+    [TRACE_MILKYMIST_MINIMAC2_PULSE_IRQ_TX] = { "", "" },
+    [TRACE_MILKYMIST_PFPU_MEMORY_READ] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_PFPU_MEMORY_WRITE] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_PFPU_VECTOUT] = { "uuu", "a,b,dma_ptr" },
+    [TRACE_MILKYMIST_PFPU_PULSE_IRQ] = { "", "" },
+    [TRACE_MILKYMIST_SOFTUSB_MEMORY_READ] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_SOFTUSB_MEMORY_WRITE] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_SOFTUSB_MEVT] = { "u", "m" },
+    [TRACE_MILKYMIST_SOFTUSB_KEVT] = { "u", "m" },
+    [TRACE_MILKYMIST_SOFTUSB_PULSE_IRQ] = { "", "" },
+    [TRACE_MILKYMIST_SYSCTL_MEMORY_READ] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_SYSCTL_MEMORY_WRITE] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_SYSCTL_ICAP_WRITE] = { "u", "value" },
+    [TRACE_MILKYMIST_SYSCTL_START_TIMER0] = { "", "" },
+    [TRACE_MILKYMIST_SYSCTL_STOP_TIMER0] = { "", "" },
+    [TRACE_MILKYMIST_SYSCTL_START_TIMER1] = { "", "" },
+    [TRACE_MILKYMIST_SYSCTL_STOP_TIMER1] = { "", "" },
+    [TRACE_MILKYMIST_SYSCTL_PULSE_IRQ_TIMER0] = { "", "" },
+    [TRACE_MILKYMIST_SYSCTL_PULSE_IRQ_TIMER1] = { "", "" },
+    [TRACE_MILKYMIST_TMU2_MEMORY_READ] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_TMU2_MEMORY_WRITE] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_TMU2_START] = { "", "" },
+    [TRACE_MILKYMIST_TMU2_PULSE_IRQ] = { "", "" },
+    [TRACE_MILKYMIST_UART_MEMORY_READ] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_UART_MEMORY_WRITE] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_UART_RAISE_IRQ] = { "", "" },
+    [TRACE_MILKYMIST_UART_LOWER_IRQ] = { "", "" },
+    [TRACE_MILKYMIST_VGAFB_MEMORY_READ] = { "uu", "addr,value" },
+    [TRACE_MILKYMIST_VGAFB_MEMORY_WRITE] = { "uu", "addr,value" },
+    [TRACE_MIPSNET_SEND] = { "u", "size" },
+    [TRACE_MIPSNET_RECEIVE] = { "u", "size" },
+    [TRACE_MIPSNET_READ] = { "uu", "addr,val" },
+    [TRACE_MIPSNET_WRITE] = { "uu", "addr,val" },
+    [TRACE_MIPSNET_IRQ] = { "uu", "isr,intctl" },
+    [TRACE_PC87312_IO_READ] = { "uu", "addr,val" },
+    [TRACE_PC87312_IO_WRITE] = { "uu", "addr,val" },
+    [TRACE_PC87312_INFO_FLOPPY] = { "u", "base" },
+    [TRACE_PC87312_INFO_IDE] = { "u", "base" },
+    [TRACE_PC87312_INFO_PARALLEL] = { "uu", "base,irq" },
+    [TRACE_PC87312_INFO_SERIAL] = { "iuu", "n,base,irq" },
+    [TRACE_PVSCSI_RING_INIT_DATA] = { "uu", "txr_len_log2,rxr_len_log2" },
+    [TRACE_PVSCSI_RING_INIT_MSG] = { "u", "len_log2" },
+    [TRACE_PVSCSI_RING_FLUSH_CMP] = { "u", "filled_cmp_ptr" },
+    [TRACE_PVSCSI_RING_FLUSH_MSG] = { "u", "filled_cmp_ptr" },
+    [TRACE_PVSCSI_UPDATE_IRQ_LEVEL] = { "uuu", "raise,mask,status" },
+    [TRACE_PVSCSI_UPDATE_IRQ_MSI] = { "", "" },
+    [TRACE_PVSCSI_CMP_RING_PUT] = { "u", "addr" },
+    [TRACE_PVSCSI_MSG_RING_PUT] = { "u", "addr" },
+    [TRACE_PVSCSI_COMPLETE_REQUEST] = { "uuu", "context,len,sense_key" },
+    [TRACE_PVSCSI_GET_SG_LIST] = { "iu", "nsg,size" },
+    [TRACE_PVSCSI_GET_NEXT_SG_ELEM] = { "u", "flags" },
+    [TRACE_PVSCSI_COMMAND_COMPLETE_NOT_FOUND] = { "u", "tag" },
+    [TRACE_PVSCSI_COMMAND_COMPLETE_DATA_RUN] = { "", "" },
+    [TRACE_PVSCSI_COMMAND_COMPLETE_SENSE_LEN] = { "i", "len" },
+    [TRACE_PVSCSI_CONVERT_SGLIST] = { "uuu", "context,addr,resid" },
+    [TRACE_PVSCSI_PROCESS_REQ_DESCR] = { "uu", "cmd,ctx" },
+    [TRACE_PVSCSI_PROCESS_REQ_DESCR_UNKNOWN_DEVICE] = { "", "" },
+    [TRACE_PVSCSI_PROCESS_REQ_DESCR_INVALID_DIR] = { "", "" },
+    [TRACE_PVSCSI_PROCESS_IO] = { "u", "addr" },
+    [TRACE_PVSCSI_ON_CMD_NOIMPL] = { "s", "cmd" },
+    [TRACE_PVSCSI_ON_CMD_RESET_DEV] = { "uip", "tgt,lun,dev" },
+    [TRACE_PVSCSI_ON_CMD_ARRIVED] = { "s", "cmd" },
+    [TRACE_PVSCSI_ON_CMD_ABORT] = { "uu", "ctx,tgt" },
+    [TRACE_PVSCSI_ON_CMD_UNKNOWN] = { "u", "cmd_id" },
+    [TRACE_PVSCSI_ON_CMD_UNKNOWN_DATA] = { "u", "data" },
+    [TRACE_PVSCSI_IO_WRITE] = { "su", "cmd,val" },
+    [TRACE_PVSCSI_IO_WRITE_UNKNOWN] = { "uuu", "addr,sz,val" },
+    [TRACE_PVSCSI_IO_READ] = { "su", "cmd,status" },
+    [TRACE_PVSCSI_IO_READ_UNKNOWN] = { "uu", "addr,sz" },
+    [TRACE_PVSCSI_INIT_MSI_FAIL] = { "i", "res" },
+    [TRACE_PVSCSI_STATE] = { "s", "state" },
+    [TRACE_PVSCSI_TX_RINGS_PPN] = { "su", "label,ppn" },
+    [TRACE_PVSCSI_TX_RINGS_NUM_PAGES] = { "su", "label,num" },
+    [TRACE_XEN_RAM_ALLOC] = { "uu", "ram_addr,size" },
+    [TRACE_XEN_CLIENT_SET_MEMORY] = { "uuu", "start_addr,size,log_dirty" },
+    [TRACE_XEN_IOREQ_SERVER_CREATE] = { "u", "id" },
+    [TRACE_XEN_IOREQ_SERVER_DESTROY] = { "u", "id" },
+    [TRACE_XEN_IOREQ_SERVER_STATE] = { "uu", "id,enable" },
+    [TRACE_XEN_MAP_MMIO_RANGE] = { "uuu", "id,start_addr,end_addr" },
+    [TRACE_XEN_UNMAP_MMIO_RANGE] = { "uuu", "id,start_addr,end_addr" },
+    [TRACE_XEN_MAP_PORTIO_RANGE] = { "uuu", "id,start_addr,end_addr" },
+    [TRACE_XEN_UNMAP_PORTIO_RANGE] = { "uuu", "id,start_addr,end_addr" },
+    [TRACE_XEN_MAP_PCIDEV] = { "uuuu", "id,bus,dev,func" },
+    [TRACE_XEN_UNMAP_PCIDEV] = { "uuuu", "id,bus,dev,func" },
+    [TRACE_XEN_MAP_CACHE] = { "u", "phys_addr" },
+    [TRACE_XEN_REMAP_BUCKET] = { "u", "index" },
+    [TRACE_XEN_MAP_CACHE_RETURN] = { "p", "ptr" },
+    [TRACE_XEN_PLATFORM_LOG] = { "s", "s" },
+    [TRACE_QEMU_COROUTINE_ENTER] = { "ppp", "from,to,opaque" },
+    [TRACE_QEMU_COROUTINE_YIELD] = { "pp", "from,to" },
+    [TRACE_QEMU_COROUTINE_TERMINATE] = { "p", "co" },
+    [TRACE_QEMU_CO_QUEUE_RUN_RESTART] = { "p", "co" },
+    [TRACE_QEMU_CO_QUEUE_NEXT] = { "p", "nxt" },
+    [TRACE_QEMU_CO_MUTEX_LOCK_ENTRY] = { "pp", "mutex,self" },
+    [TRACE_QEMU_CO_MUTEX_LOCK_RETURN] = { "pp", "mutex,self" },
+    [TRACE_QEMU_CO_MUTEX_UNLOCK_ENTRY] = { "pp", "mutex,self" },
+    [TRACE_QEMU_CO_MUTEX_UNLOCK_RETURN] = { "pp", "mutex,self" },
+    [TRACE_ESCC_PUT_QUEUE] = { "ii", "channel,b" },
+    [TRACE_ESCC_GET_QUEUE] = { "ii", "channel,val" },
+    [TRACE_ESCC_UPDATE_IRQ] = { "i", "irq" },
+    [TRACE_ESCC_UPDATE_PARAMETERS] = { "iiiii", "channel,speed,parity,data_bits,stop_bits" },
+    [TRACE_ESCC_MEM_WRITEB_CTRL] = { "iuu", "channel,reg,val" },
+    [TRACE_ESCC_MEM_WRITEB_DATA] = { "iu", "channel,val" },
+    [TRACE_ESCC_MEM_READB_CTRL] = { "iuu", "channel,reg,val" },
+    [TRACE_ESCC_MEM_READB_DATA] = { "iu", "channel,ret" },
+    [TRACE_ESCC_SERIAL_RECEIVE_BYTE] = { "ii", "channel,ch" },
+    [TRACE_ESCC_SUNKBD_EVENT_IN] = { "isi", "ch,name,down" },
+    [TRACE_ESCC_SUNKBD_EVENT_OUT] = { "i", "ch" },
+    [TRACE_ESCC_KBD_COMMAND] = { "i", "val" },
+    [TRACE_ESCC_SUNMOUSE_EVENT] = { "iii", "dx,dy,buttons_state" },
+    [TRACE_ESP_ERROR_FIFO_OVERRUN] = { "", "" },
+    [TRACE_ESP_ERROR_UNHANDLED_COMMAND] = { "u", "val" },
+    [TRACE_ESP_ERROR_INVALID_WRITE] = { "uu", "val,addr" },
+    [TRACE_ESP_RAISE_IRQ] = { "", "" },
+    [TRACE_ESP_LOWER_IRQ] = { "", "" },
+    [TRACE_ESP_DMA_ENABLE] = { "", "" },
+    [TRACE_ESP_DMA_DISABLE] = { "", "" },
+    [TRACE_ESP_GET_CMD] = { "ui", "dmalen,target" },
+    [TRACE_ESP_DO_BUSID_CMD] = { "u", "busid" },
+    [TRACE_ESP_HANDLE_SATN_STOP] = { "u", "cmdlen" },
+    [TRACE_ESP_WRITE_RESPONSE] = { "u", "status" },
+    [TRACE_ESP_DO_DMA] = { "uu", "cmdlen,len" },
+    [TRACE_ESP_COMMAND_COMPLETE] = { "", "" },
+    [TRACE_ESP_COMMAND_COMPLETE_UNEXPECTED] = { "", "" },
+    [TRACE_ESP_COMMAND_COMPLETE_FAIL] = { "", "" },
+    [TRACE_ESP_TRANSFER_DATA] = { "ui", "dma_left,ti_size" },
+    [TRACE_ESP_HANDLE_TI] = { "u", "minlen" },
+    [TRACE_ESP_HANDLE_TI_CMD] = { "u", "cmdlen" },
+    [TRACE_ESP_MEM_READB] = { "uu", "saddr,reg" },
+    [TRACE_ESP_MEM_WRITEB] = { "uuu", "saddr,reg,val" },
+    [TRACE_ESP_MEM_WRITEB_CMD_NOP] = { "u", "val" },
+    [TRACE_ESP_MEM_WRITEB_CMD_FLUSH] = { "u", "val" },
+    [TRACE_ESP_MEM_WRITEB_CMD_RESET] = { "u", "val" },
+    [TRACE_ESP_MEM_WRITEB_CMD_BUS_RESET] = { "u", "val" },
+    [TRACE_ESP_MEM_WRITEB_CMD_ICCS] = { "u", "val" },
+    [TRACE_ESP_MEM_WRITEB_CMD_MSGACC] = { "u", "val" },
+    [TRACE_ESP_MEM_WRITEB_CMD_PAD] = { "u", "val" },
+    [TRACE_ESP_MEM_WRITEB_CMD_SATN] = { "u", "val" },
+    [TRACE_ESP_MEM_WRITEB_CMD_RSTATN] = { "u", "val" },
+    [TRACE_ESP_MEM_WRITEB_CMD_SEL] = { "u", "val" },
+    [TRACE_ESP_MEM_WRITEB_CMD_SELATN] = { "u", "val" },
+    [TRACE_ESP_MEM_WRITEB_CMD_SELATNS] = { "u", "val" },
+    [TRACE_ESP_MEM_WRITEB_CMD_ENSEL] = { "u", "val" },
+    [TRACE_ESP_MEM_WRITEB_CMD_DISSEL] = { "u", "val" },
+    [TRACE_ESP_PCI_ERROR_INVALID_DMA_DIRECTION] = { "", "" },
+    [TRACE_ESP_PCI_ERROR_INVALID_READ] = { "u", "reg" },
+    [TRACE_ESP_PCI_ERROR_INVALID_WRITE] = { "u", "reg" },
+    [TRACE_ESP_PCI_ERROR_INVALID_WRITE_DMA] = { "uu", "val,addr" },
+    [TRACE_ESP_PCI_DMA_READ] = { "uu", "saddr,reg" },
+    [TRACE_ESP_PCI_DMA_WRITE] = { "uuu", "saddr,reg,val" },
+    [TRACE_ESP_PCI_DMA_IDLE] = { "u", "val" },
+    [TRACE_ESP_PCI_DMA_BLAST] = { "u", "val" },
+    [TRACE_ESP_PCI_DMA_ABORT] = { "u", "val" },
+    [TRACE_ESP_PCI_DMA_START] = { "u", "val" },
+    [TRACE_ESP_PCI_SBAC_READ] = { "u", "reg" },
+    [TRACE_ESP_PCI_SBAC_WRITE] = { "uu", "reg,val" },
+    [TRACE_HANDLE_QMP_COMMAND] = { "ps", "mon,cmd_name" },
+    [TRACE_MONITOR_PROTOCOL_EMITTER] = { "p", "mon" },
+    [TRACE_MONITOR_PROTOCOL_EVENT_HANDLER] = { "upuu", "event,data,last,now" },
+    [TRACE_MONITOR_PROTOCOL_EVENT_EMIT] = { "up", "event,data" },
+    [TRACE_MONITOR_PROTOCOL_EVENT_QUEUE] = { "upuuu", "event,data,rate,last,now" },
+    [TRACE_MONITOR_PROTOCOL_EVENT_THROTTLE] = { "uu", "event,rate" },
+    [TRACE_OPEN_ETH_MII_WRITE] = { "uu", "idx,v" },
+    [TRACE_OPEN_ETH_MII_READ] = { "uu", "idx,v" },
+    [TRACE_OPEN_ETH_UPDATE_IRQ] = { "u", "v" },
+    [TRACE_OPEN_ETH_RECEIVE] = { "u", "len" },
+    [TRACE_OPEN_ETH_RECEIVE_MCAST] = { "uuu", "idx,h0,h1" },
+    [TRACE_OPEN_ETH_RECEIVE_REJECT] = { "", "" },
+    [TRACE_OPEN_ETH_RECEIVE_DESC] = { "uu", "addr,len_flags" },
+    [TRACE_OPEN_ETH_START_XMIT] = { "uuu", "addr,len,tx_len" },
+    [TRACE_OPEN_ETH_REG_READ] = { "uu", "addr,v" },
+    [TRACE_OPEN_ETH_REG_WRITE] = { "uu", "addr,v" },
+    [TRACE_OPEN_ETH_DESC_READ] = { "uu", "addr,v" },
+    [TRACE_OPEN_ETH_DESC_WRITE] = { "uu", "addr,v" },
+    [TRACE_V9FS_RERROR] = { "uui", "tag,id,err" },
+    [TRACE_V9FS_VERSION] = { "uuis", "tag,id,msize,version" },
+    [TRACE_V9FS_VERSION_RETURN] = { "uuis", "tag,id,msize,version" },
+    [TRACE_V9FS_ATTACH] = { "uuiiss", "tag,id,fid,afid,uname,aname" },
+    [TRACE_V9FS_ATTACH_RETURN] = { "uuiii", "tag,id,type,version,path" },
+    [TRACE_V9FS_STAT] = { "uui", "tag,id,fid" },
+    [TRACE_V9FS_STAT_RETURN] = { "uuiiii", "tag,id,mode,atime,mtime,length" },
+    [TRACE_V9FS_GETATTR] = { "uuiu", "tag,id,fid,request_mask" },
+    [TRACE_V9FS_GETATTR_RETURN] = { "uuuuuu", "tag,id,result_mask,mode,uid,gid" },
+    [TRACE_V9FS_WALK] = { "uuiiu", "tag,id,fid,newfid,nwnames" },
+    [TRACE_V9FS_WALK_RETURN] = { "uuup", "tag,id,nwnames,qids" },
+    [TRACE_V9FS_OPEN] = { "uuii", "tag,id,fid,mode" },
+    [TRACE_V9FS_OPEN_RETURN] = { "uuiiii", "tag,id,type,version,path,iounit" },
+    [TRACE_V9FS_LCREATE] = { "uuiiiu", "tag,id,dfid,flags,mode,gid" },
+    [TRACE_V9FS_LCREATE_RETURN] = { "uuiiii", "tag,id,type,version,path,iounit" },
+    [TRACE_V9FS_FSYNC] = { "uuii", "tag,id,fid,datasync" },
+    [TRACE_V9FS_CLUNK] = { "uui", "tag,id,fid" },
+    [TRACE_V9FS_READ] = { "uuiuu", "tag,id,fid,off,max_count" },
+    [TRACE_V9FS_READ_RETURN] = { "uuii", "tag,id,count,err" },
+    [TRACE_V9FS_READDIR] = { "uuiuu", "tag,id,fid,offset,max_count" },
+    [TRACE_V9FS_READDIR_RETURN] = { "uuui", "tag,id,count,retval" },
+    [TRACE_V9FS_WRITE] = { "uuiuui", "tag,id,fid,off,count,cnt" },
+    [TRACE_V9FS_WRITE_RETURN] = { "uuii", "tag,id,total,err" },
+    [TRACE_V9FS_CREATE] = { "uuisii", "tag,id,fid,name,perm,mode" },
+    [TRACE_V9FS_CREATE_RETURN] = { "uuiiii", "tag,id,type,version,path,iounit" },
+    [TRACE_V9FS_SYMLINK] = { "uuissu", "tag,id,fid,name,symname,gid" },
+    [TRACE_V9FS_SYMLINK_RETURN] = { "uuiii", "tag,id,type,version,path" },
+    [TRACE_V9FS_FLUSH] = { "uui", "tag,id,flush_tag" },
+    [TRACE_V9FS_LINK] = { "uuiis", "tag,id,dfid,oldfid,name" },
+    [TRACE_V9FS_REMOVE] = { "uui", "tag,id,fid" },
+    [TRACE_V9FS_WSTAT] = { "uuiiii", "tag,id,fid,mode,atime,mtime" },
+    [TRACE_V9FS_MKNOD] = { "uuiiii", "tag,id,fid,mode,major,minor" },
+    [TRACE_V9FS_MKNOD_RETURN] = { "uuiii", "tag,id,type,version,path" },
+    [TRACE_V9FS_LOCK] = { "uuiuuu", "tag,id,fid,type,start,length" },
+    [TRACE_V9FS_LOCK_RETURN] = { "uui", "tag,id,status" },
+    [TRACE_V9FS_GETLOCK] = { "uuiuuu", "tag,id,fid,type,start,length" },
+    [TRACE_V9FS_GETLOCK_RETURN] = { "uuuuuu", "tag,id,type,start,length,proc_id" },
+    [TRACE_V9FS_MKDIR] = { "uuisiu", "tag,id,fid,name,mode,gid" },
+    [TRACE_V9FS_MKDIR_RETURN] = { "uuiiii", "tag,id,type,version,path,err" },
+    [TRACE_V9FS_XATTRWALK] = { "uuiis", "tag,id,fid,newfid,name" },
+    [TRACE_V9FS_XATTRWALK_RETURN] = { "uui", "tag,id,size" },
+    [TRACE_V9FS_XATTRCREATE] = { "uuisii", "tag,id,fid,name,size,flags" },
+    [TRACE_V9FS_READLINK] = { "uui", "tag,id,fid" },
+    [TRACE_V9FS_READLINK_RETURN] = { "uus", "tag,id,target" },
+    [TRACE_MMU_HELPER_DFAULT] = { "uuiu", "address,context,mmu_idx,tl" },
+    [TRACE_MMU_HELPER_DPROT] = { "uuiu", "address,context,mmu_idx,tl" },
+    [TRACE_MMU_HELPER_DMISS] = { "uu", "address,context" },
+    [TRACE_MMU_HELPER_TFAULT] = { "uu", "address,context" },
+    [TRACE_MMU_HELPER_TMISS] = { "uu", "address,context" },
+    [TRACE_MMU_HELPER_GET_PHYS_ADDR_CODE] = { "uiuuu", "tl,mmu_idx,prim_context,sec_context,address" },
+    [TRACE_MMU_HELPER_GET_PHYS_ADDR_DATA] = { "uiuuu", "tl,mmu_idx,prim_context,sec_context,address" },
+    [TRACE_MMU_HELPER_MMU_FAULT] = { "uuiuuu", "address,paddr,mmu_idx,tl,prim_context,sec_context" },
+    [TRACE_INT_HELPER_SET_SOFTINT] = { "u", "softint" },
+    [TRACE_INT_HELPER_CLEAR_SOFTINT] = { "u", "softint" },
+    [TRACE_INT_HELPER_WRITE_SOFTINT] = { "u", "softint" },
+    [TRACE_INT_HELPER_ICACHE_FREEZE] = { "", "" },
+    [TRACE_INT_HELPER_DCACHE_FREEZE] = { "", "" },
+    [TRACE_WIN_HELPER_GREGSET_ERROR] = { "u", "pstate" },
+    [TRACE_WIN_HELPER_SWITCH_PSTATE] = { "uu", "pstate_regs,new_pstate_regs" },
+    [TRACE_WIN_HELPER_NO_SWITCH_PSTATE] = { "u", "new_pstate_regs" },
+    [TRACE_WIN_HELPER_WRPIL] = { "uu", "psrpil,new_pil" },
+    [TRACE_WIN_HELPER_DONE] = { "u", "tl" },
+    [TRACE_WIN_HELPER_RETRY] = { "u", "tl" },
+    [TRACE_DMA_BLK_IO] = { "ppiu", "dbs,bs,sector_num,to_dev" },
+    [TRACE_DMA_AIO_CANCEL] = { "p", "dbs" },
+    [TRACE_DMA_COMPLETE] = { "pip", "dbs,ret,cb" },
+    [TRACE_DMA_BLK_CB] = { "pi", "dbs,ret" },
+    [TRACE_DMA_MAP_WAIT] = { "p", "dbs" },
+    [TRACE_CONSOLE_GFX_NEW] = { "", "" },
+    [TRACE_CONSOLE_PUTCHAR_CSI] = { "iiii", "esc_param0,esc_param1,ch,nb_esc_params" },
+    [TRACE_CONSOLE_PUTCHAR_UNHANDLED] = { "i", "ch" },
+    [TRACE_CONSOLE_TXT_NEW] = { "ii", "w,h" },
+    [TRACE_CONSOLE_SELECT] = { "i", "nr" },
+    [TRACE_CONSOLE_REFRESH] = { "i", "interval" },
+    [TRACE_DISPLAYSURFACE_CREATE] = { "pii", "display_surface,w,h" },
+    [TRACE_DISPLAYSURFACE_CREATE_FROM] = { "piiu", "display_surface,w,h,format" },
+    [TRACE_DISPLAYSURFACE_FREE] = { "p", "display_surface" },
+    [TRACE_DISPLAYCHANGELISTENER_REGISTER] = { "ps", "dcl,name" },
+    [TRACE_DISPLAYCHANGELISTENER_UNREGISTER] = { "ps", "dcl,name" },
+    [TRACE_PPM_SAVE] = { "sp", "filename,display_surface" },
+    [TRACE_GD_SWITCH] = { "sii", "tab,width,height" },
+    [TRACE_GD_UPDATE] = { "siiii", "tab,x,y,w,h" },
+    [TRACE_GD_KEY_EVENT] = { "siis", "tab,gdk_keycode,qemu_keycode,action" },
+    [TRACE_GD_GRAB] = { "ssu", "tab,device,on" },
+    [TRACE_VNC_KEY_GUEST_LEDS] = { "uuu", "caps,num,scroll" },
+    [TRACE_VNC_KEY_MAP_INIT] = { "s", "layout" },
+    [TRACE_VNC_KEY_EVENT_EXT] = { "uiis", "down,sym,keycode,name" },
+    [TRACE_VNC_KEY_EVENT_MAP] = { "uiis", "down,sym,keycode,name" },
+    [TRACE_VNC_KEY_SYNC_NUMLOCK] = { "u", "on" },
+    [TRACE_VNC_KEY_SYNC_CAPSLOCK] = { "u", "on" },
+    [TRACE_INPUT_EVENT_KEY_NUMBER] = { "iisu", "conidx,number,qcode,down" },
+    [TRACE_INPUT_EVENT_KEY_QCODE] = { "isu", "conidx,qcode,down" },
+    [TRACE_INPUT_EVENT_BTN] = { "isu", "conidx,btn,down" },
+    [TRACE_INPUT_EVENT_REL] = { "isi", "conidx,axis,value" },
+    [TRACE_INPUT_EVENT_ABS] = { "isi", "conidx,axis,value" },
+    [TRACE_INPUT_EVENT_SYNC] = { "", "" },
+    [TRACE_INPUT_MOUSE_MODE] = { "i", "absolute" },
+    [TRACE_VMWARE_VALUE_READ] = { "uu", "index,value" },
+    [TRACE_VMWARE_VALUE_WRITE] = { "uu", "index,value" },
+    [TRACE_VMWARE_PALETTE_READ] = { "uu", "index,value" },
+    [TRACE_VMWARE_PALETTE_WRITE] = { "uu", "index,value" },
+    [TRACE_VMWARE_SCRATCH_READ] = { "uu", "index,value" },
+    [TRACE_VMWARE_SCRATCH_WRITE] = { "uu", "index,value" },
+    [TRACE_VMWARE_SETMODE] = { "uuu", "w,h,bpp" },
+    [TRACE_QEMU_LOADVM_STATE_SECTION] = { "u", "section_type" },
+    [TRACE_QEMU_LOADVM_STATE_SECTION_PARTEND] = { "u", "section_id" },
+    [TRACE_QEMU_LOADVM_STATE_SECTION_STARTFULL] = { "usuu", "section_id,idstr,instance_id,version_id" },
+    [TRACE_SAVEVM_SECTION_START] = { "su", "id,section_id" },
+    [TRACE_SAVEVM_SECTION_END] = { "sui", "id,section_id,ret" },
+    [TRACE_SAVEVM_STATE_BEGIN] = { "", "" },
+    [TRACE_SAVEVM_STATE_ITERATE] = { "", "" },
+    [TRACE_SAVEVM_STATE_COMPLETE] = { "", "" },
+    [TRACE_SAVEVM_STATE_CANCEL] = { "", "" },
+    [TRACE_VMSTATE_SAVE] = { "ss", "idstr,vmsd_name" },
+    [TRACE_VMSTATE_LOAD] = { "ss", "idstr,vmsd_name" },
+    [TRACE_QEMU_ANNOUNCE_SELF_ITER] = { "s", "mac" },
+    [TRACE_VMSTATE_LOAD_FIELD_ERROR] = { "si", "field,ret" },
+    [TRACE_VMSTATE_LOAD_STATE] = { "si", "name,version_id" },
+    [TRACE_VMSTATE_LOAD_STATE_END] = { "ssi", "name,reason,val" },
+    [TRACE_VMSTATE_LOAD_STATE_FIELD] = { "ss", "name,field" },
+    [TRACE_VMSTATE_SUBSECTION_LOAD] = { "s", "parent" },
+    [TRACE_VMSTATE_SUBSECTION_LOAD_BAD] = { "ss", "parent,sub" },
+    [TRACE_VMSTATE_SUBSECTION_LOAD_GOOD] = { "s", "parent" },
+    [TRACE_QEMU_FILE_FCLOSE] = { "", "" },
+    [TRACE_MIGRATION_BITMAP_SYNC_START] = { "", "" },
+    [TRACE_MIGRATION_BITMAP_SYNC_END] = { "u", "dirty_pages" },
+    [TRACE_MIGRATION_THROTTLE] = { "", "" },
+    [TRACE_QXL_INTERFACE_SET_MM_TIME] = { "iu", "qid,mm_time" },
+    [TRACE_QXL_IO_WRITE_VGA] = { "isuu", "qid,mode,addr,val" },
+    [TRACE_QXL_CREATE_GUEST_PRIMARY] = { "iuuuuu", "qid,width,height,mem,format,position" },
+    [TRACE_QXL_CREATE_GUEST_PRIMARY_REST] = { "iiuu", "qid,stride,type,flags" },
+    [TRACE_QXL_DESTROY_PRIMARY] = { "i", "qid" },
+    [TRACE_QXL_ENTER_VGA_MODE] = { "i", "qid" },
+    [TRACE_QXL_EXIT_VGA_MODE] = { "i", "qid" },
+    [TRACE_QXL_HARD_RESET] = { "ii", "qid,loadvm" },
+    [TRACE_QXL_INTERFACE_ASYNC_COMPLETE_IO] = { "iup", "qid,current_async,cookie" },
+    [TRACE_QXL_INTERFACE_ATTACH_WORKER] = { "i", "qid" },
+    [TRACE_QXL_INTERFACE_GET_INIT_INFO] = { "i", "qid" },
+    [TRACE_QXL_INTERFACE_SET_COMPRESSION_LEVEL] = { "ii", "qid,level" },
+    [TRACE_QXL_INTERFACE_UPDATE_AREA_COMPLETE] = { "iuuuuu", "qid,surface_id,dirty_left,dirty_right,dirty_top,dirty_bottom" },
+    [TRACE_QXL_INTERFACE_UPDATE_AREA_COMPLETE_REST] = { "iu", "qid,num_updated_rects" },
+    [TRACE_QXL_INTERFACE_UPDATE_AREA_COMPLETE_OVERFLOW] = { "ii", "qid,max" },
+    [TRACE_QXL_INTERFACE_UPDATE_AREA_COMPLETE_SCHEDULE_BH] = { "iu", "qid,num_dirty" },
+    [TRACE_QXL_IO_DESTROY_PRIMARY_IGNORED] = { "is", "qid,mode" },
+    [TRACE_QXL_IO_LOG] = { "ip", "qid,log_buf" },
+    [TRACE_QXL_IO_READ_UNEXPECTED] = { "i", "qid" },
+    [TRACE_QXL_IO_UNEXPECTED_VGA_MODE] = { "iuus", "qid,addr,val,desc" },
+    [TRACE_QXL_IO_WRITE] = { "isusuui", "qid,mode,addr,aname,val,size,async" },
+    [TRACE_QXL_MEMSLOT_ADD_GUEST] = { "iuuu", "qid,slot_id,guest_start,guest_end" },
+    [TRACE_QXL_POST_LOAD] = { "is", "qid,mode" },
+    [TRACE_QXL_PRE_LOAD] = { "i", "qid" },
+    [TRACE_QXL_PRE_SAVE] = { "i", "qid" },
+    [TRACE_QXL_RESET_SURFACES] = { "i", "qid" },
+    [TRACE_QXL_RING_COMMAND_CHECK] = { "is", "qid,mode" },
+    [TRACE_QXL_RING_COMMAND_GET] = { "is", "qid,mode" },
+    [TRACE_QXL_RING_COMMAND_REQ_NOTIFICATION] = { "i", "qid" },
+    [TRACE_QXL_RING_CURSOR_CHECK] = { "is", "qid,mode" },
+    [TRACE_QXL_RING_CURSOR_GET] = { "is", "qid,mode" },
+    [TRACE_QXL_RING_CURSOR_REQ_NOTIFICATION] = { "i", "qid" },
+    [TRACE_QXL_RING_RES_PUSH] = { "isuups", "qid,mode,surface_count,free_res,last_release,notify" },
+    [TRACE_QXL_RING_RES_PUSH_REST] = { "iuuuu", "qid,ring_has,ring_size,prod,cons" },
+    [TRACE_QXL_RING_RES_PUT] = { "iu", "qid,free_res" },
+    [TRACE_QXL_SET_MODE] = { "iiuuuu", "qid,modenr,x_res,y_res,bits,devmem" },
+    [TRACE_QXL_SOFT_RESET] = { "i", "qid" },
+    [TRACE_QXL_SPICE_DESTROY_SURFACES_COMPLETE] = { "i", "qid" },
+    [TRACE_QXL_SPICE_DESTROY_SURFACES] = { "ii", "qid,async" },
+    [TRACE_QXL_SPICE_DESTROY_SURFACE_WAIT_COMPLETE] = { "iu", "qid,id" },
+    [TRACE_QXL_SPICE_DESTROY_SURFACE_WAIT] = { "iui", "qid,id,async" },
+    [TRACE_QXL_SPICE_FLUSH_SURFACES_ASYNC] = { "iuu", "qid,surface_count,num_free_res" },
+    [TRACE_QXL_SPICE_MONITORS_CONFIG] = { "i", "qid" },
+    [TRACE_QXL_SPICE_LOADVM_COMMANDS] = { "ipu", "qid,ext,count" },
+    [TRACE_QXL_SPICE_OOM] = { "i", "qid" },
+    [TRACE_QXL_SPICE_RESET_CURSOR] = { "i", "qid" },
+    [TRACE_QXL_SPICE_RESET_IMAGE_CACHE] = { "i", "qid" },
+    [TRACE_QXL_SPICE_RESET_MEMSLOTS] = { "i", "qid" },
+    [TRACE_QXL_SPICE_UPDATE_AREA] = { "iuuuuu", "qid,surface_id,left,right,top,bottom" },
+    [TRACE_QXL_SPICE_UPDATE_AREA_REST] = { "iuu", "qid,num_dirty_rects,clear_dirty_region" },
+    [TRACE_QXL_SURFACES_DIRTY] = { "iiii", "qid,surface,offset,size" },
+    [TRACE_QXL_SEND_EVENTS] = { "iu", "qid,events" },
+    [TRACE_QXL_SEND_EVENTS_VM_STOPPED] = { "iu", "qid,events" },
+    [TRACE_QXL_SET_GUEST_BUG] = { "i", "qid" },
+    [TRACE_QXL_INTERRUPT_CLIENT_MONITORS_CONFIG] = { "iip", "qid,num_heads,heads" },
+    [TRACE_QXL_CLIENT_MONITORS_CONFIG_UNSUPPORTED_BY_GUEST] = { "iup", "qid,int_mask,client_monitors_config" },
+    [TRACE_QXL_CLIENT_MONITORS_CONFIG_UNSUPPORTED_BY_DEVICE] = { "ii", "qid,revision" },
+    [TRACE_QXL_CLIENT_MONITORS_CONFIG_CAPPED] = { "iii", "qid,requested,limit" },
+    [TRACE_QXL_CLIENT_MONITORS_CONFIG_CRC] = { "iuu", "qid,size,crc32" },
+    [TRACE_QXL_SET_CLIENT_CAPABILITIES_UNSUPPORTED_BY_REVISION] = { "ii", "qid,revision" },
+    [TRACE_QEMU_SPICE_ADD_MEMSLOT] = { "iuuui", "qid,slot_id,virt_start,virt_end,async" },
+    [TRACE_QEMU_SPICE_DEL_MEMSLOT] = { "iuu", "qid,gid,slot_id" },
+    [TRACE_QEMU_SPICE_CREATE_PRIMARY_SURFACE] = { "iupi", "qid,sid,surface,async" },
+    [TRACE_QEMU_SPICE_DESTROY_PRIMARY_SURFACE] = { "iui", "qid,sid,async" },
+    [TRACE_QEMU_SPICE_WAKEUP] = { "u", "qid" },
+    [TRACE_QEMU_SPICE_CREATE_UPDATE] = { "uuuu", "left,right,top,bottom" },
+    [TRACE_QXL_RENDER_BLIT] = { "iiiii", "stride,left,right,top,bottom" },
+    [TRACE_QXL_RENDER_GUEST_PRIMARY_RESIZED] = { "iiiii", "width,height,stride,bytes_pp,bits_pp" },
+    [TRACE_QXL_RENDER_UPDATE_AREA_DONE] = { "p", "cookie" },
+    [TRACE_SPAPR_PCI_MSI] = { "su", "msg,ca" },
+    [TRACE_SPAPR_PCI_MSI_SETUP] = { "suu", "name,vector,addr" },
+    [TRACE_SPAPR_PCI_RTAS_IBM_CHANGE_MSI] = { "uuuu", "cfg,func,req,first" },
+    [TRACE_SPAPR_PCI_RTAS_IBM_QUERY_INTERRUPT_SOURCE_NUMBER] = { "uu", "ioa,intr" },
+    [TRACE_SPAPR_PCI_MSI_WRITE] = { "uuu", "addr,data,dt_irq" },
+    [TRACE_SPAPR_PCI_LSI_SET] = { "siu", "busname,pin,irq" },
+    [TRACE_SPAPR_PCI_MSI_RETRY] = { "uuu", "config_addr,req_num,max_irqs" },
+    [TRACE_PCI_UPDATE_MAPPINGS_DEL] = { "puuuiuu", "d,bus,func,slot,bar,addr,size" },
+    [TRACE_PCI_UPDATE_MAPPINGS_ADD] = { "puuuiuu", "d,bus,func,slot,bar,addr,size" },
+    [TRACE_PCNET_S_RESET] = { "p", "s" },
+    [TRACE_PCNET_USER_INT] = { "p", "s" },
+    [TRACE_PCNET_ISR_CHANGE] = { "puu", "s,isr,isr_old" },
+    [TRACE_PCNET_INIT] = { "pu", "s,init_addr" },
+    [TRACE_PCNET_RLEN_TLEN] = { "puu", "s,rlen,tlen" },
+    [TRACE_PCNET_SS32_RDRA_TDRA] = { "puuuuu", "s,ss32,rdra,rcvrl,tdra,xmtrl" },
+    [TRACE_PCNET_APROM_WRITEB] = { "puu", "opaque,addr,val" },
+    [TRACE_PCNET_APROM_READB] = { "puu", "opaque,addr,val" },
+    [TRACE_PCNET_IOPORT_READ] = { "puu", "opaque,addr,size" },
+    [TRACE_PCNET_IOPORT_WRITE] = { "puuu", "opaque,addr,data,size" },
+    [TRACE_PCNET_MMIO_WRITEB] = { "puu", "opaque,addr,val" },
+    [TRACE_PCNET_MMIO_WRITEW] = { "puu", "opaque,addr,val" },
+    [TRACE_PCNET_MMIO_WRITEL] = { "puu", "opaque,addr,val" },
+    [TRACE_PCNET_MMIO_READB] = { "puu", "opaque,addr,val" },
+    [TRACE_PCNET_MMIO_READW] = { "puu", "opaque,addr,val" },
+    [TRACE_PCNET_MMIO_READL] = { "puu", "opaque,addr,val" },
+    [TRACE_XICS_ICP_CHECK_IPI] = { "iu", "server,mfrr" },
+    [TRACE_XICS_ICP_ACCEPT] = { "uu", "old_xirr,new_xirr" },
+    [TRACE_XICS_ICP_EOI] = { "iuu", "server,xirr,new_xirr" },
+    [TRACE_XICS_ICP_IRQ] = { "iiu", "server,nr,priority" },
+    [TRACE_XICS_ICP_RAISE] = { "uu", "xirr,pending_priority" },
+    [TRACE_XICS_SET_IRQ_MSI] = { "ii", "srcno,nr" },
+    [TRACE_XICS_MASKED_PENDING] = { "", "" },
+    [TRACE_XICS_SET_IRQ_LSI] = { "ii", "srcno,nr" },
+    [TRACE_XICS_ICS_WRITE_XIVE] = { "iiiu", "nr,srcno,server,priority" },
+    [TRACE_XICS_ICS_REJECT] = { "ii", "nr,srcno" },
+    [TRACE_XICS_ICS_EOI] = { "i", "nr" },
+    [TRACE_XICS_ALLOC] = { "ii", "src,irq" },
+    [TRACE_XICS_ALLOC_FAILED_HINT] = { "ii", "src,irq" },
+    [TRACE_XICS_ALLOC_FAILED_NO_LEFT] = { "i", "src" },
+    [TRACE_XICS_ALLOC_BLOCK] = { "iiiui", "src,first,num,lsi,align" },
+    [TRACE_XICS_ICS_FREE] = { "iii", "src,irq,num" },
+    [TRACE_XICS_ICS_FREE_WARN] = { "ii", "src,irq" },
+    [TRACE_SPAPR_CAS_FAILED] = { "u", "n" },
+    [TRACE_SPAPR_CAS_CONTINUE] = { "u", "n" },
+    [TRACE_SPAPR_CAS_PVR_TRY] = { "u", "pvr" },
+    [TRACE_SPAPR_CAS_PVR] = { "uuuu", "cur_pvr,cpu_match,new_pvr,pcr" },
+    [TRACE_SPAPR_IOMMU_PUT] = { "uuuu", "liobn,ioba,tce,ret" },
+    [TRACE_SPAPR_IOMMU_GET] = { "uuuu", "liobn,ioba,ret,tce" },
+    [TRACE_SPAPR_IOMMU_INDIRECT] = { "uuuuuu", "liobn,ioba,tce,iobaN,tceN,ret" },
+    [TRACE_SPAPR_IOMMU_STUFF] = { "uuuuu", "liobn,ioba,tce_value,npages,ret" },
+    [TRACE_SPAPR_IOMMU_XLATE] = { "uuuuu", "liobn,ioba,tce,perm,pgsize" },
+    [TRACE_SPAPR_IOMMU_NEW_TABLE] = { "uppi", "liobn,tcet,table,fd" },
+    [TRACE_PPC_TB_ADJUST] = { "uuii", "offs1,offs2,diff,seconds" },
+    [TRACE_HBITMAP_ITER_SKIP_WORDS] = { "ppuu", "hb,hbi,pos,cur" },
+    [TRACE_HBITMAP_RESET] = { "puuuu", "hb,start,count,sbit,ebit" },
+    [TRACE_HBITMAP_SET] = { "puuuu", "hb,start,count,sbit,ebit" },
+    [TRACE_IOINST] = { "s", "insn" },
+    [TRACE_IOINST_SCH_ID] = { "siii", "insn,cssid,ssid,schid" },
+    [TRACE_IOINST_CHP_ID] = { "sii", "insn,cssid,chpid" },
+    [TRACE_IOINST_CHSC_CMD] = { "uu", "cmd,len" },
+    [TRACE_CSS_ENABLE_FACILITY] = { "s", "facility" },
+    [TRACE_CSS_CRW] = { "uuus", "rsc,erc,rsid,chained" },
+    [TRACE_CSS_CHPID_ADD] = { "uuu", "cssid,chpid,type" },
+    [TRACE_CSS_NEW_IMAGE] = { "us", "cssid,default_cssid" },
+    [TRACE_CSS_ASSIGN_SUBCH] = { "suuuu", "do_assign,cssid,ssid,schid,devno" },
+    [TRACE_CSS_IO_INTERRUPT] = { "iiiuus", "cssid,ssid,schid,intparm,isc,conditional" },
+    [TRACE_CSS_ADAPTER_INTERRUPT] = { "u", "isc" },
+    [TRACE_VIRTIO_CCW_INTERPRET_CCW] = { "iiii", "cssid,ssid,schid,cmd_code" },
+    [TRACE_VIRTIO_CCW_NEW_DEVICE] = { "iiiis", "cssid,ssid,schid,devno,devno_mode" },
+    [TRACE_FLIC_CREATE_DEVICE] = { "i", "err" },
+    [TRACE_FLIC_NO_DEVICE_API] = { "i", "err" },
+    [TRACE_FLIC_RESET_FAILED] = { "i", "err" },
+    [TRACE_MIGRATE_SET_STATE] = { "i", "new_state" },
+    [TRACE_MIGRATE_FD_CLEANUP] = { "", "" },
+    [TRACE_MIGRATE_FD_ERROR] = { "", "" },
+    [TRACE_MIGRATE_FD_CANCEL] = { "", "" },
+    [TRACE_MIGRATE_PENDING] = { "uu", "size,max" },
+    [TRACE_MIGRATE_TRANSFERRED] = { "uudu", "tranferred,time_spent,bandwidth,size" },
+    [TRACE_QEMU_DMA_ACCEPT_INCOMING_MIGRATION] = { "", "" },
+    [TRACE_QEMU_DMA_ACCEPT_INCOMING_MIGRATION_ACCEPTED] = { "", "" },
+    [TRACE_QEMU_RDMA_ACCEPT_PIN_STATE] = { "u", "pin" },
+    [TRACE_QEMU_RDMA_ACCEPT_PIN_VERBSC] = { "p", "verbs" },
+    [TRACE_QEMU_RDMA_BLOCK_FOR_WRID_MISS] = { "sisu", "wcompstr,wcomp,gcompstr,req" },
+    [TRACE_QEMU_RDMA_BLOCK_FOR_WRID_MISS_B] = { "sisu", "wcompstr,wcomp,gcompstr,req" },
+    [TRACE_QEMU_RDMA_CLEANUP_DISCONNECT] = { "", "" },
+    [TRACE_QEMU_RDMA_CLEANUP_WAITING_FOR_DISCONNECT] = { "", "" },
+    [TRACE_QEMU_RDMA_CLOSE] = { "", "" },
+    [TRACE_QEMU_RDMA_CONNECT_PIN_ALL_REQUESTED] = { "", "" },
+    [TRACE_QEMU_RDMA_CONNECT_PIN_ALL_OUTCOME] = { "u", "pin" },
+    [TRACE_QEMU_RDMA_DEST_INIT_TRYING] = { "ss", "host,ip" },
+    [TRACE_QEMU_RDMA_DUMP_GID] = { "sss", "who,src,dst" },
+    [TRACE_QEMU_RDMA_EXCHANGE_GET_RESPONSE_START] = { "s", "desc" },
+    [TRACE_QEMU_RDMA_EXCHANGE_GET_RESPONSE_NONE] = { "si", "desc,type" },
+    [TRACE_QEMU_RDMA_EXCHANGE_SEND_ISSUE_CALLBACK] = { "", "" },
+    [TRACE_QEMU_RDMA_EXCHANGE_SEND_WAITING] = { "s", "desc" },
+    [TRACE_QEMU_RDMA_EXCHANGE_SEND_RECEIVED] = { "s", "desc" },
+    [TRACE_QEMU_RDMA_FILL] = { "ii", "control_len,size" },
+    [TRACE_QEMU_RDMA_INIT_RAM_BLOCKS] = { "i", "blocks" },
+    [TRACE_QEMU_RDMA_POLL_RECV] = { "siii", "compstr,comp,id,sent" },
+    [TRACE_QEMU_RDMA_POLL_WRITE] = { "siiuupp", "compstr,comp,left,block,chunk,local,remote" },
+    [TRACE_QEMU_RDMA_POLL_OTHER] = { "sii", "compstr,comp,left" },
+    [TRACE_QEMU_RDMA_POST_SEND_CONTROL] = { "s", "desc" },
+    [TRACE_QEMU_RDMA_REGISTER_AND_GET_KEYS] = { "up", "len,start" },
+    [TRACE_QEMU_RDMA_REGISTRATION_HANDLE_COMPRESS] = { "iii", "length,index,offset" },
+    [TRACE_QEMU_RDMA_REGISTRATION_HANDLE_FINISHED] = { "", "" },
+    [TRACE_QEMU_RDMA_REGISTRATION_HANDLE_RAM_BLOCKS] = { "", "" },
+    [TRACE_QEMU_RDMA_REGISTRATION_HANDLE_REGISTER] = { "i", "requests" },
+    [TRACE_QEMU_RDMA_REGISTRATION_HANDLE_REGISTER_LOOP] = { "iiuu", "req,index,addr,chunks" },
+    [TRACE_QEMU_RDMA_REGISTRATION_HANDLE_REGISTER_RKEY] = { "i", "rkey" },
+    [TRACE_QEMU_RDMA_REGISTRATION_HANDLE_UNREGISTER] = { "i", "requests" },
+    [TRACE_QEMU_RDMA_REGISTRATION_HANDLE_UNREGISTER_LOOP] = { "iiu", "count,index,chunk" },
+    [TRACE_QEMU_RDMA_REGISTRATION_HANDLE_UNREGISTER_SUCCESS] = { "u", "chunk" },
+    [TRACE_QEMU_RDMA_REGISTRATION_HANDLE_WAIT] = { "u", "flags" },
+    [TRACE_QEMU_RDMA_REGISTRATION_START] = { "u", "flags" },
+    [TRACE_QEMU_RDMA_REGISTRATION_STOP] = { "u", "flags" },
+    [TRACE_QEMU_RDMA_REGISTRATION_STOP_RAM] = { "", "" },
+    [TRACE_QEMU_RDMA_RESOLVE_HOST_TRYING] = { "ss", "host,ip" },
+    [TRACE_QEMU_RDMA_SIGNAL_UNREGISTER_APPEND] = { "ui", "chunk,pos" },
+    [TRACE_QEMU_RDMA_SIGNAL_UNREGISTER_ALREADY] = { "u", "chunk" },
+    [TRACE_QEMU_RDMA_UNREGISTER_WAITING_INFLIGHT] = { "u", "chunk" },
+    [TRACE_QEMU_RDMA_UNREGISTER_WAITING_PROC] = { "ui", "chunk,pos" },
+    [TRACE_QEMU_RDMA_UNREGISTER_WAITING_SEND] = { "u", "chunk" },
+    [TRACE_QEMU_RDMA_UNREGISTER_WAITING_COMPLETE] = { "u", "chunk" },
+    [TRACE_QEMU_RDMA_WRITE_FLUSH] = { "i", "sent" },
+    [TRACE_QEMU_RDMA_WRITE_ONE_BLOCK] = { "iiuuuii", "count,block,chunk,current,len,nb_sent,nb_chunks" },
+    [TRACE_QEMU_RDMA_WRITE_ONE_POST] = { "uiiu", "chunk,addr,remote,len" },
+    [TRACE_QEMU_RDMA_WRITE_ONE_QUEUE_FULL] = { "", "" },
+    [TRACE_QEMU_RDMA_WRITE_ONE_RECVREGRES] = { "iiu", "mykey,theirkey,chunk" },
+    [TRACE_QEMU_RDMA_WRITE_ONE_SENDREG] = { "uiii", "chunk,len,index,offset" },
+    [TRACE_QEMU_RDMA_WRITE_ONE_TOP] = { "uu", "chunks,size" },
+    [TRACE_QEMU_RDMA_WRITE_ONE_ZERO] = { "uiii", "chunk,len,index,offset" },
+    [TRACE_RDMA_ADD_BLOCK] = { "iuuuuui", "block,addr,offset,len,end,bits,chunks" },
+    [TRACE_RDMA_DELETE_BLOCK] = { "iuuuuui", "block,addr,offset,len,end,bits,chunks" },
+    [TRACE_RDMA_START_INCOMING_MIGRATION] = { "", "" },
+    [TRACE_RDMA_START_INCOMING_MIGRATION_AFTER_DEST_INIT] = { "", "" },
+    [TRACE_RDMA_START_INCOMING_MIGRATION_AFTER_RDMA_LISTEN] = { "", "" },
+    [TRACE_RDMA_START_OUTGOING_MIGRATION_AFTER_RDMA_CONNECT] = { "", "" },
+    [TRACE_RDMA_START_OUTGOING_MIGRATION_AFTER_RDMA_SOURCE_INIT] = { "", "" },
+    [TRACE_KVM_IOCTL] = { "ip", "type,arg" },
+    [TRACE_KVM_VM_IOCTL] = { "ip", "type,arg" },
+    [TRACE_KVM_VCPU_IOCTL] = { "iip", "cpu_index,type,arg" },
+    [TRACE_KVM_RUN_EXIT] = { "iu", "cpu_index,reason" },
+    [TRACE_KVM_DEVICE_IOCTL] = { "iip", "fd,type,arg" },
+    [TRACE_KVM_FAILED_REG_GET] = { "us", "id,msg" },
+    [TRACE_KVM_FAILED_REG_SET] = { "us", "id,msg" },
+    [TRACE_KVM_FAILED_SPR_SET] = { "is", "str,msg" },
+    [TRACE_KVM_FAILED_SPR_GET] = { "is", "str,msg" },
+    [TRACE_EXEC_TB] = { "pu", "tb,pc" },
+    [TRACE_EXEC_TB_NOCACHE] = { "pu", "tb,pc" },
+    [TRACE_EXEC_TB_EXIT] = { "pu", "next_tb,flags" },
+    [TRACE_TRANSLATE_BLOCK] = { "pup", "tb,pc,tb_code" },
+    [TRACE_MEMORY_REGION_OPS_READ] = { "puuu", "mr,addr,value,size" },
+    [TRACE_MEMORY_REGION_OPS_WRITE] = { "puuu", "mr,addr,value,size" },
+    [TRACE_OBJECT_DYNAMIC_CAST_ASSERT] = { "sssis", "type,target,file,line,func" },
+    [TRACE_OBJECT_CLASS_DYNAMIC_CAST_ASSERT] = { "sssis", "type,target,file,line,func" },
+    [TRACE_XEN_PV_MMIO_READ] = { "u", "addr" },
+    [TRACE_XEN_PV_MMIO_WRITE] = { "u", "addr" },
+    [TRACE_PCI_CFG_READ] = { "suuuu", "dev,devid,fnid,offs,val" },
+    [TRACE_PCI_CFG_WRITE] = { "suuuu", "dev,devid,fnid,offs,val" },
+    [TRACE_VFIO_INTX_INTERRUPT] = { "si", "name,line" },
+    [TRACE_VFIO_EOI] = { "s", "name" },
+    [TRACE_VFIO_ENABLE_INTX_KVM] = { "s", "name" },
+    [TRACE_VFIO_DISABLE_INTX_KVM] = { "s", "name" },
+    [TRACE_VFIO_UPDATE_IRQ] = { "sii", "name,new_irq,target_irq" },
+    [TRACE_VFIO_ENABLE_INTX] = { "s", "name" },
+    [TRACE_VFIO_DISABLE_INTX] = { "s", "name" },
+    [TRACE_VFIO_MSI_INTERRUPT] = { "siui", "name,index,addr,data" },
+    [TRACE_VFIO_MSIX_VECTOR_DO_USE] = { "si", "name,index" },
+    [TRACE_VFIO_MSIX_VECTOR_RELEASE] = { "si", "name,index" },
+    [TRACE_VFIO_ENABLE_MSIX] = { "s", "name" },
+    [TRACE_VFIO_ENABLE_MSI] = { "si", "name,nr_vectors" },
+    [TRACE_VFIO_DISABLE_MSIX] = { "s", "name" },
+    [TRACE_VFIO_DISABLE_MSI] = { "s", "name" },
+    [TRACE_VFIO_PCI_LOAD_ROM] = { "suuu", "name,size,offset,flags" },
+    [TRACE_VFIO_ROM_READ] = { "suiu", "name,addr,size,data" },
+    [TRACE_VFIO_PCI_SIZE_ROM] = { "si", "name,size" },
+    [TRACE_VFIO_VGA_WRITE] = { "uui", "addr,data,size" },
+    [TRACE_VFIO_VGA_READ] = { "uiu", "addr,size,data" },
+    [TRACE_VFIO_GENERIC_WINDOW_QUIRK_READ] = { "ssiuiu", "region_name,name,index,addr,size,data" },
+    [TRACE_VFIO_GENERIC_WINDOW_QUIRK_WRITE] = { "ssiuui", "region_name,name,index,addr,data,size" },
+    [TRACE_VFIO_GENERIC_QUIRK_READ] = { "ssiuiu", "region_name,name,index,addr,size,data" },
+    [TRACE_VFIO_GENERIC_QUIRK_WRITE] = { "ssiuui", "region_name,name,index,addr,data,size" },
+    [TRACE_VFIO_ATI_3C3_QUIRK_READ] = { "u", "data" },
+    [TRACE_VFIO_VGA_PROBE_ATI_3C3_QUIRK] = { "s", "name" },
+    [TRACE_VFIO_PROBE_ATI_BAR4_WINDOW_QUIRK] = { "s", "name" },
+    [TRACE_VFIO_RTL8168_WINDOW_QUIRK_READ_FAKE] = { "ss", "region_name,name" },
+    [TRACE_VFIO_RTL8168_WINDOW_QUIRK_READ_TABLE] = { "ss", "region_name,name" },
+    [TRACE_VFIO_RTL8168_WINDOW_QUIRK_READ_DIRECT] = { "ss", "region_name,name" },
+    [TRACE_VFIO_RTL8168_WINDOW_QUIRK_WRITE_TABLE] = { "ss", "region_name,name" },
+    [TRACE_VFIO_RTL8168_WINDOW_QUIRK_WRITE_DIRECT] = { "ss", "region_name,name" },
+    [TRACE_VFIO_PROBE_RTL8168_BAR2_WINDOW_QUIRK] = { "s", "name" },
+    [TRACE_VFIO_PROBE_ATI_BAR2_4000_QUIRK] = { "s", "name" },
+    [TRACE_VFIO_NVIDIA_3D0_QUIRK_READ] = { "iu", "size,data" },
+    [TRACE_VFIO_NVIDIA_3D0_QUIRK_WRITE] = { "ui", "data,size" },
+    [TRACE_VFIO_VGA_PROBE_NVIDIA_3D0_QUIRK] = { "s", "name" },
+    [TRACE_VFIO_PROBE_NVIDIA_BAR5_WINDOW_QUIRK] = { "s", "name" },
+    [TRACE_VFIO_PROBE_NVIDIA_BAR0_88000_QUIRK] = { "s", "name" },
+    [TRACE_VFIO_PROBE_NVIDIA_BAR0_1800_QUIRK_ID] = { "i", "id" },
+    [TRACE_VFIO_PROBE_NVIDIA_BAR0_1800_QUIRK] = { "s", "name" },
+    [TRACE_VFIO_PCI_READ_CONFIG] = { "siii", "name,addr,len,val" },
+    [TRACE_VFIO_PCI_WRITE_CONFIG] = { "siii", "name,addr,val,len" },
+    [TRACE_VFIO_SETUP_MSI] = { "si", "name,pos" },
+    [TRACE_VFIO_EARLY_SETUP_MSIX] = { "siiii", "name,pos,table_bar,offset,entries" },
+    [TRACE_VFIO_CHECK_PCIE_FLR] = { "s", "name" },
+    [TRACE_VFIO_CHECK_PM_RESET] = { "s", "name" },
+    [TRACE_VFIO_CHECK_AF_FLR] = { "s", "name" },
+    [TRACE_VFIO_PCI_HOT_RESET] = { "ss", "name,type" },
+    [TRACE_VFIO_PCI_HOT_RESET_HAS_DEP_DEVICES] = { "s", "name" },
+    [TRACE_VFIO_PCI_HOT_RESET_DEP_DEVICES] = { "iiiii", "domain,bus,slot,function,group_id" },
+    [TRACE_VFIO_PCI_HOT_RESET_RESULT] = { "ss", "name,result" },
+    [TRACE_VFIO_POPULATE_DEVICE_REGION] = { "siuuu", "region_name,index,size,offset,flags" },
+    [TRACE_VFIO_POPULATE_DEVICE_CONFIG] = { "suuu", "name,size,offset,flags" },
+    [TRACE_VFIO_POPULATE_DEVICE_GET_IRQ_INFO_FAILURE] = { "", "" },
+    [TRACE_VFIO_INITFN] = { "si", "name,group_id" },
+    [TRACE_VFIO_PCI_RESET] = { "s", "name" },
+    [TRACE_VFIO_PCI_RESET_FLR] = { "s", "name" },
+    [TRACE_VFIO_PCI_RESET_PM] = { "s", "name" },
+    [TRACE_VFIO_REGION_WRITE] = { "siuuu", "name,index,addr,data,size" },
+    [TRACE_VFIO_REGION_READ] = { "siuuu", "name,index,addr,size,data" },
+    [TRACE_VFIO_IOMMU_MAP_NOTIFY] = { "uu", "iova_start,iova_end" },
+    [TRACE_VFIO_LISTENER_REGION_ADD_SKIP] = { "uu", "start,end" },
+    [TRACE_VFIO_LISTENER_REGION_ADD_IOMMU] = { "uu", "start,end" },
+    [TRACE_VFIO_LISTENER_REGION_ADD_RAM] = { "uup", "iova_start,iova_end,vaddr" },
+    [TRACE_VFIO_LISTENER_REGION_DEL_SKIP] = { "uu", "start,end" },
+    [TRACE_VFIO_LISTENER_REGION_DEL] = { "uu", "start,end" },
+    [TRACE_VFIO_DISCONNECT_CONTAINER] = { "i", "fd" },
+    [TRACE_VFIO_PUT_GROUP] = { "i", "fd" },
+    [TRACE_VFIO_GET_DEVICE] = { "suuu", "name,flags,num_regions,num_irqs" },
+    [TRACE_VFIO_PUT_BASE_DEVICE] = { "i", "fd" },
+    [TRACE_MHP_ACPI_INVALID_SLOT_SELECTED] = { "u", "slot" },
+    [TRACE_MHP_ACPI_READ_ADDR_LO] = { "uu", "slot,addr" },
+    [TRACE_MHP_ACPI_READ_ADDR_HI] = { "uu", "slot,addr" },
+    [TRACE_MHP_ACPI_READ_SIZE_LO] = { "uu", "slot,size" },
+    [TRACE_MHP_ACPI_READ_SIZE_HI] = { "uu", "slot,size" },
+    [TRACE_MHP_ACPI_READ_PXM] = { "uu", "slot,pxm" },
+    [TRACE_MHP_ACPI_READ_FLAGS] = { "uu", "slot,flags" },
+    [TRACE_MHP_ACPI_WRITE_SLOT] = { "u", "slot" },
+    [TRACE_MHP_ACPI_WRITE_OST_EV] = { "uu", "slot,ev" },
+    [TRACE_MHP_ACPI_WRITE_OST_STATUS] = { "uu", "slot,st" },
+    [TRACE_MHP_ACPI_CLEAR_INSERT_EVT] = { "u", "slot" },
+    [TRACE_MHP_PC_DIMM_ASSIGNED_SLOT] = { "i", "slot" },
+    [TRACE_MHP_PC_DIMM_ASSIGNED_ADDRESS] = { "u", "addr" },
+    [TRACE_KVM_ENABLE_CMMA] = { "i", "rc" },
+    [TRACE_KVM_CLEAR_CMMA] = { "i", "rc" },
+    [TRACE_KVM_FAILED_CPU_STATE_SET] = { "ius", "cpu_index,state,msg" },
+    [TRACE_KVM_SIGP_FINISHED] = { "uiii", "order,cpu_index,dst_index,cc" },
+    [TRACE_I8257_UNREGISTERED_DMA] = { "iii", "nchan,dma_pos,dma_len" },
+    [TRACE_CPU_SET_STATE] = { "iu", "cpu_index,state" },
+    [TRACE_CPU_HALT] = { "i", "cpu_index" },
+    [TRACE_CPU_UNHALT] = { "i", "cpu_index" },
+    [TRACE_NET_RX_PKT_PARSED] = { "uuuuuuu", "ip4,ip6,udp,tcp,l3o,l4o,l5o" },
+    [TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_ENTRY] = { "", "" },
+    [TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_NOT_XXP] = { "", "" },
+    [TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_UDP_WITH_NO_CHECKSUM] = { "", "" },
+    [TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_IP4_FRAGMENT] = { "", "" },
+    [TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_IP4_UDP] = { "", "" },
+    [TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_IP4_TCP] = { "", "" },
+    [TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_IP6_UDP] = { "", "" },
+    [TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_IP6_TCP] = { "", "" },
+    [TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_PH_CSUM] = { "uu", "cntr,csl" },
+    [TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_CSUM] = { "uuuuu", "l4hdr_off,csl,cntr,csum,csum_valid" },
+    [TRACE_NET_RX_PKT_L3_CSUM_VALIDATE_ENTRY] = { "", "" },
+    [TRACE_NET_RX_PKT_L3_CSUM_VALIDATE_NOT_IP4] = { "", "" },
+    [TRACE_NET_RX_PKT_L3_CSUM_VALIDATE_CSUM] = { "uuuuu", "l3hdr_off,csl,cntr,csum,csum_valid" },
+    [TRACE_NET_RX_PKT_RSS_IP4] = { "", "" },
+    [TRACE_NET_RX_PKT_RSS_IP4_TCP] = { "", "" },
+    [TRACE_NET_RX_PKT_RSS_IP6_TCP] = { "", "" },
+    [TRACE_NET_RX_PKT_RSS_IP6] = { "", "" },
+    [TRACE_NET_RX_PKT_RSS_IP6_EX] = { "", "" },
+    [TRACE_NET_RX_PKT_RSS_HASH] = { "uu", "rss_length,rss_hash" },
+    [TRACE_NET_RX_PKT_RSS_ADD_CHUNK] = { "puu", "ptr,size,input_offset" },
+    [TRACE_E1000E_CORE_WRITE] = { "uuu", "index,size,val" },
+    [TRACE_E1000E_CORE_READ] = { "uuu", "index,size,val" },
+    [TRACE_E1000E_CORE_MDIC_READ] = { "uuu", "page,addr,data" },
+    [TRACE_E1000E_CORE_MDIC_READ_UNHANDLED] = { "uu", "page,addr" },
+    [TRACE_E1000E_CORE_MDIC_WRITE] = { "uuu", "page,addr,data" },
+    [TRACE_E1000E_CORE_MDIC_WRITE_UNHANDLED] = { "uu", "page,addr" },
+    [TRACE_E1000E_CORE_EEEPROM_WRITE] = { "uuu", "bit_in,bit_out,reading" },
+    [TRACE_E1000E_CORE_CTRL_WRITE] = { "uu", "index,val" },
+    [TRACE_E1000E_CORE_CTRL_SW_RESET] = { "", "" },
+    [TRACE_E1000E_CORE_CTRL_PHY_RESET] = { "", "" },
+    [TRACE_E1000E_LINK_NEGOTIATION_START] = { "", "" },
+    [TRACE_E1000E_LINK_NEGOTIATION_DONE] = { "", "" },
+    [TRACE_E1000E_LINK_AUTONEG_FLOWCTL] = { "u", "enabled" },
+    [TRACE_E1000E_LINK_SET_PARAMS] = { "uuuuuu", "autodetect,speed,force_spd,force_dplx,rx_fctl,tx_fctl" },
+    [TRACE_E1000E_LINK_READ_PARAMS] = { "uuuuuu", "autodetect,speed,force_spd,force_dplx,rx_fctl,tx_fctl" },
+    [TRACE_E1000E_LINK_SET_EXT_PARAMS] = { "uu", "asd_check,speed_select_bypass" },
+    [TRACE_E1000E_LINK_STATUS] = { "uuuu", "link_up,full_dplx,speed,asdv" },
+    [TRACE_E1000E_WRN_REGS_WRITE_RO] = { "uuu", "index,size,val" },
+    [TRACE_E1000E_WRN_REGS_WRITE_UNKNOWN] = { "uuu", "index,size,val" },
+    [TRACE_E1000E_WRN_REGS_READ_UNKNOWN] = { "uu", "index,size" },
+    [TRACE_E1000E_WRN_REGS_READ_TRIVIAL] = { "u", "index" },
+    [TRACE_E1000E_WRN_REGS_WRITE_TRIVIAL] = { "u", "index" },
+    [TRACE_E1000E_WRN_NO_TS_SUPPORT] = { "", "" },
+    [TRACE_E1000E_WRN_NO_SNAP_SUPPORT] = { "", "" },
+    [TRACE_E1000E_WRN_ISCSI_FILTERING_NOT_SUPPORTED] = { "", "" },
+    [TRACE_E1000E_WRN_NFSW_FILTERING_NOT_SUPPORTED] = { "", "" },
+    [TRACE_E1000E_WRN_NFSR_FILTERING_NOT_SUPPORTED] = { "", "" },
+    [TRACE_E1000E_TX_DISABLED] = { "", "" },
+    [TRACE_E1000E_TX_DESCR] = { "puu", "addr,lower,upper" },
+    [TRACE_E1000E_TX_CSO_ZERO] = { "", "" },
+    [TRACE_E1000E_RING_FREE_SPACE] = { "iuuu", "ridx,rdlen,rdh,rdt" },
+    [TRACE_E1000E_RX_CAN_RECV_DISABLED] = { "uuu", "link_up,rx_enabled,pci_master" },
+    [TRACE_E1000E_RX_CAN_RECV_RINGS_FULL] = { "", "" },
+    [TRACE_E1000E_RX_CAN_RECV] = { "", "" },
+    [TRACE_E1000E_RX_HAS_BUFFERS] = { "iuuu", "ridx,free_desc,total_size,desc_buf_size" },
+    [TRACE_E1000E_RX_NULL_DESCRIPTOR] = { "", "" },
+    [TRACE_E1000E_RX_FLT_UCAST_MATCH] = { "uuuuuuu", "idx,b0,b1,b2,b3,b4,b5" },
+    [TRACE_E1000E_RX_FLT_UCAST_MISMATCH] = { "uuuuuu", "b0,b1,b2,b3,b4,b5" },
+    [TRACE_E1000E_RX_FLT_INEXACT_MISMATCH] = { "uuuuuuuuu", "b0,b1,b2,b3,b4,b5,mo,mta,mta_val" },
+    [TRACE_E1000E_RX_FLT_VLAN_MISMATCH] = { "u", "vid" },
+    [TRACE_E1000E_RX_FLT_VLAN_MATCH] = { "u", "vid" },
+    [TRACE_E1000E_RX_DESC_PS_READ] = { "uuuu", "a0,a1,a2,a3" },
+    [TRACE_E1000E_RX_DESC_PS_WRITE] = { "uuuu", "a0,a1,a2,a3" },
+    [TRACE_E1000E_RX_DESC_BUFF_SIZES] = { "uuuu", "b0,b1,b2,b3" },
+    [TRACE_E1000E_RX_DESC_LEN] = { "u", "rx_desc_len" },
+    [TRACE_E1000E_RX_DESC_BUFF_WRITE] = { "uuupu", "idx,addr,offset,source,len" },
+    [TRACE_E1000E_RX_DESCR] = { "iuu", "ridx,base,len" },
+    [TRACE_E1000E_RX_SET_RCTL] = { "u", "rctl" },
+    [TRACE_E1000E_RX_RECEIVE_IOV] = { "i", "iovcnt" },
+    [TRACE_E1000E_RX_PACKET_SIZE] = { "uuu", "full,vhdr,data" },
+    [TRACE_E1000E_RX_LINK_DOWN] = { "u", "status_reg" },
+    [TRACE_E1000E_RX_DISABLED] = { "u", "rctl_reg" },
+    [TRACE_E1000E_RX_OVERSIZED] = { "u", "size" },
+    [TRACE_E1000E_RX_FLT_DROPPED] = { "", "" },
+    [TRACE_E1000E_RX_WRITTEN_TO_GUEST] = { "u", "causes" },
+    [TRACE_E1000E_RX_NOT_WRITTEN_TO_GUEST] = { "u", "causes" },
+    [TRACE_E1000E_RX_INTERRUPT_SET] = { "u", "causes" },
+    [TRACE_E1000E_RX_INTERRUPT_DELAYED] = { "u", "causes" },
+    [TRACE_E1000E_RX_SET_CSO] = { "i", "cso_state" },
+    [TRACE_E1000E_RX_SET_RDT] = { "iu", "queue_idx,val" },
+    [TRACE_E1000E_RX_SET_RFCTL] = { "u", "val" },
+    [TRACE_E1000E_RX_START_RECV] = { "", "" },
+    [TRACE_E1000E_RX_RSS_STARTED] = { "", "" },
+    [TRACE_E1000E_RX_RSS_DISABLED] = { "", "" },
+    [TRACE_E1000E_RX_RSS_TYPE] = { "u", "type" },
+    [TRACE_E1000E_RX_RSS_IP4] = { "uuuuu", "isfragment,istcp,mrqc,tcpipv4_enabled,ipv4_enabled" },
+    [TRACE_E1000E_RX_RSS_IP6] = { "uuuuuuuuuuu", "rfctl,ex_dis,new_ex_dis,istcp,has_ext_headers,ex_dst_valid,ex_src_valid,mrqc,tcpipv6_enabled,ipv6ex_enabled,ipv6_enabled" },
+    [TRACE_E1000E_RX_RSS_DISPATCHED_TO_QUEUE] = { "i", "queue_idx" },
+    [TRACE_E1000E_RX_METADATA_PROTOCOLS] = { "uuuu", "isip4,isip6,isudp,istcp" },
+    [TRACE_E1000E_RX_METADATA_VLAN] = { "u", "vlan_tag" },
+    [TRACE_E1000E_RX_METADATA_RSS] = { "uu", "rss,mrq" },
+    [TRACE_E1000E_RX_METADATA_IP_ID] = { "u", "ip_id" },
+    [TRACE_E1000E_RX_METADATA_ACK] = { "", "" },
+    [TRACE_E1000E_RX_METADATA_PKT_TYPE] = { "u", "pkt_type" },
+    [TRACE_E1000E_RX_METADATA_NO_VIRTHDR] = { "", "" },
+    [TRACE_E1000E_RX_METADATA_VIRTHDR_NO_CSUM_INFO] = { "", "" },
+    [TRACE_E1000E_RX_METADATA_L3_CSO_DISABLED] = { "", "" },
+    [TRACE_E1000E_RX_METADATA_L4_CSO_DISABLED] = { "", "" },
+    [TRACE_E1000E_RX_METADATA_L3_CSUM_VALIDATION_FAILED] = { "", "" },
+    [TRACE_E1000E_RX_METADATA_L4_CSUM_VALIDATION_FAILED] = { "", "" },
+    [TRACE_E1000E_RX_METADATA_STATUS_FLAGS] = { "u", "status_flags" },
+    [TRACE_E1000E_RX_METADATA_IPV6_SUM_DISABLED] = { "", "" },
+    [TRACE_E1000E_RX_METADATA_IPV6_FILTERING_DISABLED] = { "", "" },
+    [TRACE_E1000E_VLAN_VET] = { "u", "vet" },
+    [TRACE_E1000E_VLAN_IS_VLAN_PKT] = { "uuu", "is_vlan_pkt,eth_proto,vet" },
+    [TRACE_E1000E_IRQ_SET_CAUSE] = { "u", "cause" },
+    [TRACE_E1000E_IRQ_MSI_NOTIFY] = { "u", "cause" },
+    [TRACE_E1000E_IRQ_THROTTLING_NO_PENDING_INTERRUPTS] = { "", "" },
+    [TRACE_E1000E_IRQ_MSI_NOTIFY_POSTPONED] = { "", "" },
+    [TRACE_E1000E_IRQ_LEGACY_NOTIFY_POSTPONED] = { "", "" },
+    [TRACE_E1000E_IRQ_THROTTLING_NO_PENDING_VEC] = { "i", "idx" },
+    [TRACE_E1000E_IRQ_MSIX_NOTIFY_POSTPONED_VEC] = { "i", "idx" },
+    [TRACE_E1000E_IRQ_MSIX_NOTIFY] = { "u", "cause" },
+    [TRACE_E1000E_IRQ_LEGACY_NOTIFY] = { "u", "level" },
+    [TRACE_E1000E_IRQ_MSIX_NOTIFY_VEC] = { "u", "vector" },
+    [TRACE_E1000E_IRQ_POSTPONED_BY_XITR] = { "u", "reg" },
+    [TRACE_E1000E_IRQ_CLEAR_IMS] = { "uuu", "bits,old_ims,new_ims" },
+    [TRACE_E1000E_IRQ_SET_IMS] = { "uuu", "bits,old_ims,new_ims" },
+    [TRACE_E1000E_IRQ_FIX_ICR_ASSERTED] = { "u", "new_val" },
+    [TRACE_E1000E_IRQ_ADD_MSI_OTHER] = { "u", "new_val" },
+    [TRACE_E1000E_IRQ_PENDING_INTERRUPTS] = { "uuu", "pending,icr,ims" },
+    [TRACE_E1000E_IRQ_SET_CAUSE_ENTRY] = { "uu", "val,icr" },
+    [TRACE_E1000E_IRQ_SET_CAUSE_EXIT] = { "uu", "val,icr" },
+    [TRACE_E1000E_IRQ_ICR_WRITE] = { "uuu", "bits,old_icr,new_icr" },
+    [TRACE_E1000E_IRQ_WRITE_ICS] = { "u", "val" },
+    [TRACE_E1000E_IRQ_ICR_PROCESS_IAME] = { "", "" },
+    [TRACE_E1000E_IRQ_READ_ICS] = { "u", "ics" },
+    [TRACE_E1000E_IRQ_READ_IMS] = { "u", "ims" },
+    [TRACE_E1000E_IRQ_ICR_READ_ENTRY] = { "u", "icr" },
+    [TRACE_E1000E_IRQ_ICR_READ_EXIT] = { "u", "icr" },
+    [TRACE_E1000E_IRQ_ICR_CLEAR_ZERO_IMS] = { "", "" },
+    [TRACE_E1000E_IRQ_ICR_CLEAR_IAME] = { "", "" },
+    [TRACE_E1000E_IRQ_IMS_CLEAR_EIAME] = { "uu", "iam,cause" },
+    [TRACE_E1000E_IRQ_IMS_CLEAR_SET_IMC] = { "u", "val" },
+    [TRACE_E1000E_IRQ_FIRE_DELAYED_INTERRUPTS] = { "", "" },
+    [TRACE_E1000E_IRQ_REARM_TIMER] = { "ui", "reg,delay_ns" },
+    [TRACE_E1000E_IRQ_THROTTLING_TIMER] = { "u", "reg" },
+    [TRACE_E1000E_IRQ_RDTR_FPD_RUNNING] = { "", "" },
+    [TRACE_E1000E_IRQ_RDTR_FPD_NOT_RUNNING] = { "", "" },
+    [TRACE_E1000E_IRQ_TIDV_FPD_RUNNING] = { "", "" },
+    [TRACE_E1000E_IRQ_TIDV_FPD_NOT_RUNNING] = { "", "" },
+    [TRACE_E1000E_IRQ_EITR_SET] = { "uu", "eitr_num,val" },
+    [TRACE_E1000E_IRQ_ITR_SET] = { "u", "val" },
+    [TRACE_E1000E_IRQ_FIRE_ALL_TIMERS] = { "u", "val" },
+    [TRACE_E1000E_IRQ_ADDING_DELAYED_CAUSES] = { "uu", "val,icr" },
+    [TRACE_E1000E_IRQ_MSIX_PENDING_CLEARING] = { "uuu", "cause,int_cfg,vec" },
+    [TRACE_E1000E_WRN_MSIX_VEC_WRONG] = { "uu", "cause,cfg" },
+    [TRACE_E1000E_WRN_MSIX_INVALID] = { "uu", "cause,cfg" },
+    [TRACE_E1000E_MAC_SET_PERMANENT] = { "uuuuuu", "b0,b1,b2,b3,b4,b5" },
+    [TRACE_E1000E_MAC_SET_SW] = { "uuuuuu", "b0,b1,b2,b3,b4,b5" },
+    [TRACE_E1000E_MAC_INDICATE] = { "uuuuuu", "b0,b1,b2,b3,b4,b5" },
+    [TRACE_E1000E_CB_PCI_REALIZE] = { "", "" },
+    [TRACE_E1000E_CB_PCI_UNINIT] = { "", "" },
+    [TRACE_E1000E_CB_QDEV_RESET] = { "", "" },
+    [TRACE_E1000E_CB_PRE_SAVE] = { "", "" },
+    [TRACE_E1000E_CB_POST_LOAD] = { "", "" },
+    [TRACE_E1000E_IO_WRITE_ADDR] = { "u", "addr" },
+    [TRACE_E1000E_IO_WRITE_DATA] = { "uu", "addr,val" },
+    [TRACE_E1000E_IO_READ_ADDR] = { "u", "addr" },
+    [TRACE_E1000E_IO_READ_DATA] = { "uu", "addr,val" },
+    [TRACE_E1000E_WRN_IO_WRITE_UNKNOWN] = { "u", "addr" },
+    [TRACE_E1000E_WRN_IO_READ_UNKNOWN] = { "u", "addr" },
+    [TRACE_E1000E_WRN_IO_ADDR_UNDEFINED] = { "u", "addr" },
+    [TRACE_E1000E_WRN_IO_ADDR_FLASH] = { "u", "addr" },
+    [TRACE_E1000E_WRN_IO_ADDR_UNKNOWN] = { "u", "addr" },
+    [TRACE_E1000E_WRN_FLASH_READ] = { "u", "addr" },
+    [TRACE_E1000E_WRN_FLASH_WRITE] = { "uu", "addr,val" },
+    [TRACE_E1000E_MSI_INIT_FAIL] = { "i", "res" },
+    [TRACE_E1000E_MSIX_INIT_FAIL] = { "i", "res" },
+    [TRACE_E1000E_MSIX_USE_VECTOR_FAIL] = { "ui", "vec,res" },
+    [TRACE_E1000E_CFG_SUPPORT_VIRTIO] = { "u", "support" },
+};
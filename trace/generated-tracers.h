@@ -1,5820 +1,11465 @@
-/* This file is autogenerated by tracetool, do not edit. */
+/* This file is autogenerated by trace/ringtracers.py, do not edit. */
 
 #ifndef TRACE__GENERATED_TRACERS_H
 #define TRACE__GENERATED_TRACERS_H
 
 #include "qemu-common.h"
-
+#include "trace/control.h"
+#include "trace/ring.h"
 
 static inline void trace_qemu_memalign(size_t alignment, size_t size, void * ptr)
 {
+    if (trace_event_get_state(TRACE_QEMU_MEMALIGN)) {
+        uint64_t args[] = { (uint64_t)alignment, (uint64_t)size, (uintptr_t)ptr };
+        trace_ring_record(TRACE_QEMU_MEMALIGN, args, 3, NULL);
+    }
 }
 
 static inline void trace_qemu_anon_ram_alloc(size_t size, void * ptr)
 {
+    if (trace_event_get_state(TRACE_QEMU_ANON_RAM_ALLOC)) {
+        uint64_t args[] = { (uint64_t)size, (uintptr_t)ptr };
+        trace_ring_record(TRACE_QEMU_ANON_RAM_ALLOC, args, 2, NULL);
+    }
 }
 
 static inline void trace_qemu_vfree(void * ptr)
 {
+    if (trace_event_get_state(TRACE_QEMU_VFREE)) {
+        uint64_t args[] = { (uintptr_t)ptr };
+        trace_ring_record(TRACE_QEMU_VFREE, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_anon_ram_free(void * ptr, size_t size)
 {
+    if (trace_event_get_state(TRACE_QEMU_ANON_RAM_FREE)) {
+        uint64_t args[] = { (uintptr_t)ptr, (uint64_t)size };
+        trace_ring_record(TRACE_QEMU_ANON_RAM_FREE, args, 2, NULL);
+    }
 }
 
 static inline void trace_virtqueue_fill(void * vq, const void * elem, unsigned int len, unsigned int idx)
 {
+    if (trace_event_get_state(TRACE_VIRTQUEUE_FILL)) {
+        uint64_t args[] = { (uintptr_t)vq, (uintptr_t)elem, (uint64_t)len, (uint64_t)idx };
+        trace_ring_record(TRACE_VIRTQUEUE_FILL, args, 4, NULL);
+    }
 }
 
 static inline void trace_virtqueue_flush(void * vq, unsigned int count)
 {
+    if (trace_event_get_state(TRACE_VIRTQUEUE_FLUSH)) {
+        uint64_t args[] = { (uintptr_t)vq, (uint64_t)count };
+        trace_ring_record(TRACE_VIRTQUEUE_FLUSH, args, 2, NULL);
+    }
 }
 
 static inline void trace_virtqueue_pop(void * vq, void * elem, unsigned int in_num, unsigned int out_num)
 {
+    if (trace_event_get_state(TRACE_VIRTQUEUE_POP)) {
+        uint64_t args[] = { (uintptr_t)vq, (uintptr_t)elem, (uint64_t)in_num, (uint64_t)out_num };
+        trace_ring_record(TRACE_VIRTQUEUE_POP, args, 4, NULL);
+    }
 }
 
 static inline void trace_virtio_queue_notify(void * vdev, int n, void * vq)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_QUEUE_NOTIFY)) {
+        uint64_t args[] = { (uintptr_t)vdev, (uint64_t)n, (uintptr_t)vq };
+        trace_ring_record(TRACE_VIRTIO_QUEUE_NOTIFY, args, 3, NULL);
+    }
 }
 
 static inline void trace_virtio_irq(void * vq)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_IRQ)) {
+        uint64_t args[] = { (uintptr_t)vq };
+        trace_ring_record(TRACE_VIRTIO_IRQ, args, 1, NULL);
+    }
 }
 
 static inline void trace_virtio_notify(void * vdev, void * vq)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_NOTIFY)) {
+        uint64_t args[] = { (uintptr_t)vdev, (uintptr_t)vq };
+        trace_ring_record(TRACE_VIRTIO_NOTIFY, args, 2, NULL);
+    }
 }
 
 static inline void trace_virtio_set_status(void * vdev, uint8_t val)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_SET_STATUS)) {
+        uint64_t args[] = { (uintptr_t)vdev, (uint64_t)val };
+        trace_ring_record(TRACE_VIRTIO_SET_STATUS, args, 2, NULL);
+    }
 }
 
 static inline void trace_virtio_rng_guest_not_ready(void * rng)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_RNG_GUEST_NOT_READY)) {
+        uint64_t args[] = { (uintptr_t)rng };
+        trace_ring_record(TRACE_VIRTIO_RNG_GUEST_NOT_READY, args, 1, NULL);
+    }
 }
 
 static inline void trace_virtio_rng_pushed(void * rng, size_t len)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_RNG_PUSHED)) {
+        uint64_t args[] = { (uintptr_t)rng, (uint64_t)len };
+        trace_ring_record(TRACE_VIRTIO_RNG_PUSHED, args, 2, NULL);
+    }
 }
 
 static inline void trace_virtio_rng_request(void * rng, size_t size, unsigned quota)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_RNG_REQUEST)) {
+        uint64_t args[] = { (uintptr_t)rng, (uint64_t)size, (uint64_t)quota };
+        trace_ring_record(TRACE_VIRTIO_RNG_REQUEST, args, 3, NULL);
+    }
 }
 
 static inline void trace_virtio_serial_send_control_event(unsigned int port, uint16_t event, uint16_t value)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_SERIAL_SEND_CONTROL_EVENT)) {
+        uint64_t args[] = { (uint64_t)port, (uint64_t)event, (uint64_t)value };
+        trace_ring_record(TRACE_VIRTIO_SERIAL_SEND_CONTROL_EVENT, args, 3, NULL);
+    }
 }
 
 static inline void trace_virtio_serial_throttle_port(unsigned int port, bool throttle)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_SERIAL_THROTTLE_PORT)) {
+        uint64_t args[] = { (uint64_t)port, (uint64_t)throttle };
+        trace_ring_record(TRACE_VIRTIO_SERIAL_THROTTLE_PORT, args, 2, NULL);
+    }
 }
 
 static inline void trace_virtio_serial_handle_control_message(uint16_t event, uint16_t value)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_SERIAL_HANDLE_CONTROL_MESSAGE)) {
+        uint64_t args[] = { (uint64_t)event, (uint64_t)value };
+        trace_ring_record(TRACE_VIRTIO_SERIAL_HANDLE_CONTROL_MESSAGE, args, 2, NULL);
+    }
 }
 
 static inline void trace_virtio_serial_handle_control_message_port(unsigned int port)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_SERIAL_HANDLE_CONTROL_MESSAGE_PORT)) {
+        uint64_t args[] = { (uint64_t)port };
+        trace_ring_record(TRACE_VIRTIO_SERIAL_HANDLE_CONTROL_MESSAGE_PORT, args, 1, NULL);
+    }
 }
 
 static inline void trace_virtio_console_flush_buf(unsigned int port, size_t len, ssize_t ret)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_CONSOLE_FLUSH_BUF)) {
+        uint64_t args[] = { (uint64_t)port, (uint64_t)len, (uint64_t)ret };
+        trace_ring_record(TRACE_VIRTIO_CONSOLE_FLUSH_BUF, args, 3, NULL);
+    }
 }
 
 static inline void trace_virtio_console_chr_read(unsigned int port, int size)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_CONSOLE_CHR_READ)) {
+        uint64_t args[] = { (uint64_t)port, (uint64_t)size };
+        trace_ring_record(TRACE_VIRTIO_CONSOLE_CHR_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_virtio_console_chr_event(unsigned int port, int event)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_CONSOLE_CHR_EVENT)) {
+        uint64_t args[] = { (uint64_t)port, (uint64_t)event };
+        trace_ring_record(TRACE_VIRTIO_CONSOLE_CHR_EVENT, args, 2, NULL);
+    }
 }
 
 static inline void trace_bdrv_open_common(void * bs, const char * filename, int flags, const char * format_name)
 {
+    if (trace_event_get_state(TRACE_BDRV_OPEN_COMMON)) {
+        uint64_t args[] = { (uintptr_t)bs, (uintptr_t)filename, (uint64_t)flags, (uintptr_t)format_name };
+        trace_ring_record(TRACE_BDRV_OPEN_COMMON, args, 4, filename);
+    }
 }
 
 static inline void trace_multiwrite_cb(void * mcb, int ret)
 {
+    if (trace_event_get_state(TRACE_MULTIWRITE_CB)) {
+        uint64_t args[] = { (uintptr_t)mcb, (uint64_t)ret };
+        trace_ring_record(TRACE_MULTIWRITE_CB, args, 2, NULL);
+    }
 }
 
 static inline void trace_bdrv_aio_multiwrite(void * mcb, int num_callbacks, int num_reqs)
 {
+    if (trace_event_get_state(TRACE_BDRV_AIO_MULTIWRITE)) {
+        uint64_t args[] = { (uintptr_t)mcb, (uint64_t)num_callbacks, (uint64_t)num_reqs };
+        trace_ring_record(TRACE_BDRV_AIO_MULTIWRITE, args, 3, NULL);
+    }
 }
 
 static inline void trace_bdrv_aio_discard(void * bs, int64_t sector_num, int nb_sectors, void * opaque)
 {
+    if (trace_event_get_state(TRACE_BDRV_AIO_DISCARD)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)sector_num, (uint64_t)nb_sectors, (uintptr_t)opaque };
+        trace_ring_record(TRACE_BDRV_AIO_DISCARD, args, 4, NULL);
+    }
 }
 
 static inline void trace_bdrv_aio_flush(void * bs, void * opaque)
 {
+    if (trace_event_get_state(TRACE_BDRV_AIO_FLUSH)) {
+        uint64_t args[] = { (uintptr_t)bs, (uintptr_t)opaque };
+        trace_ring_record(TRACE_BDRV_AIO_FLUSH, args, 2, NULL);
+    }
 }
 
 static inline void trace_bdrv_aio_readv(void * bs, int64_t sector_num, int nb_sectors, void * opaque)
 {
+    if (trace_event_get_state(TRACE_BDRV_AIO_READV)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)sector_num, (uint64_t)nb_sectors, (uintptr_t)opaque };
+        trace_ring_record(TRACE_BDRV_AIO_READV, args, 4, NULL);
+    }
 }
 
 static inline void trace_bdrv_aio_writev(void * bs, int64_t sector_num, int nb_sectors, void * opaque)
 {
+    if (trace_event_get_state(TRACE_BDRV_AIO_WRITEV)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)sector_num, (uint64_t)nb_sectors, (uintptr_t)opaque };
+        trace_ring_record(TRACE_BDRV_AIO_WRITEV, args, 4, NULL);
+    }
 }
 
 static inline void trace_bdrv_aio_write_zeroes(void * bs, int64_t sector_num, int nb_sectors, int flags, void * opaque)
 {
+    if (trace_event_get_state(TRACE_BDRV_AIO_WRITE_ZEROES)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)sector_num, (uint64_t)nb_sectors, (uint64_t)flags, (uintptr_t)opaque };
+        trace_ring_record(TRACE_BDRV_AIO_WRITE_ZEROES, args, 5, NULL);
+    }
 }
 
 static inline void trace_bdrv_lock_medium(void * bs, bool locked)
 {
+    if (trace_event_get_state(TRACE_BDRV_LOCK_MEDIUM)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)locked };
+        trace_ring_record(TRACE_BDRV_LOCK_MEDIUM, args, 2, NULL);
+    }
 }
 
 static inline void trace_bdrv_co_readv(void * bs, int64_t sector_num, int nb_sector)
 {
+    if (trace_event_get_state(TRACE_BDRV_CO_READV)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)sector_num, (uint64_t)nb_sector };
+        trace_ring_record(TRACE_BDRV_CO_READV, args, 3, NULL);
+    }
 }
 
 static inline void trace_bdrv_co_copy_on_readv(void * bs, int64_t sector_num, int nb_sector)
 {
+    if (trace_event_get_state(TRACE_BDRV_CO_COPY_ON_READV)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)sector_num, (uint64_t)nb_sector };
+        trace_ring_record(TRACE_BDRV_CO_COPY_ON_READV, args, 3, NULL);
+    }
 }
 
 static inline void trace_bdrv_co_writev(void * bs, int64_t sector_num, int nb_sector)
 {
+    if (trace_event_get_state(TRACE_BDRV_CO_WRITEV)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)sector_num, (uint64_t)nb_sector };
+        trace_ring_record(TRACE_BDRV_CO_WRITEV, args, 3, NULL);
+    }
 }
 
 static inline void trace_bdrv_co_write_zeroes(void * bs, int64_t sector_num, int nb_sector, int flags)
 {
+    if (trace_event_get_state(TRACE_BDRV_CO_WRITE_ZEROES)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)sector_num, (uint64_t)nb_sector, (uint64_t)flags };
+        trace_ring_record(TRACE_BDRV_CO_WRITE_ZEROES, args, 4, NULL);
+    }
 }
 
 static inline void trace_bdrv_co_io_em(void * bs, int64_t sector_num, int nb_sectors, int is_write, void * acb)
 {
+    if (trace_event_get_state(TRACE_BDRV_CO_IO_EM)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)sector_num, (uint64_t)nb_sectors, (uint64_t)is_write, (uintptr_t)acb };
+        trace_ring_record(TRACE_BDRV_CO_IO_EM, args, 5, NULL);
+    }
 }
 
 static inline void trace_bdrv_co_do_copy_on_readv(void * bs, int64_t sector_num, int nb_sectors, int64_t cluster_sector_num, int cluster_nb_sectors)
 {
+    if (trace_event_get_state(TRACE_BDRV_CO_DO_COPY_ON_READV)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)sector_num, (uint64_t)nb_sectors, (uint64_t)cluster_sector_num, (uint64_t)cluster_nb_sectors };
+        trace_ring_record(TRACE_BDRV_CO_DO_COPY_ON_READV, args, 5, NULL);
+    }
 }
 
 static inline void trace_stream_one_iteration(void * s, int64_t sector_num, int nb_sectors, int is_allocated)
 {
+    if (trace_event_get_state(TRACE_STREAM_ONE_ITERATION)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)sector_num, (uint64_t)nb_sectors, (uint64_t)is_allocated };
+        trace_ring_record(TRACE_STREAM_ONE_ITERATION, args, 4, NULL);
+    }
 }
 
 static inline void trace_stream_start(void * bs, void * base, void * s, void * co, void * opaque)
 {
+    if (trace_event_get_state(TRACE_STREAM_START)) {
+        uint64_t args[] = { (uintptr_t)bs, (uintptr_t)base, (uintptr_t)s, (uintptr_t)co, (uintptr_t)opaque };
+        trace_ring_record(TRACE_STREAM_START, args, 5, NULL);
+    }
 }
 
 static inline void trace_commit_one_iteration(void * s, int64_t sector_num, int nb_sectors, int is_allocated)
 {
+    if (trace_event_get_state(TRACE_COMMIT_ONE_ITERATION)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)sector_num, (uint64_t)nb_sectors, (uint64_t)is_allocated };
+        trace_ring_record(TRACE_COMMIT_ONE_ITERATION, args, 4, NULL);
+    }
 }
 
 static inline void trace_commit_start(void * bs, void * base, void * top, void * s, void * co, void * opaque)
 {
+    if (trace_event_get_state(TRACE_COMMIT_START)) {
+        uint64_t args[] = { (uintptr_t)bs, (uintptr_t)base, (uintptr_t)top, (uintptr_t)s, (uintptr_t)co, (uintptr_t)opaque };
+        trace_ring_record(TRACE_COMMIT_START, args, 6, NULL);
+    }
 }
 
 static inline void trace_mirror_start(void * bs, void * s, void * co, void * opaque)
 {
+    if (trace_event_get_state(TRACE_MIRROR_START)) {
+        uint64_t args[] = { (uintptr_t)bs, (uintptr_t)s, (uintptr_t)co, (uintptr_t)opaque };
+        trace_ring_record(TRACE_MIRROR_START, args, 4, NULL);
+    }
 }
 
 static inline void trace_mirror_restart_iter(void * s, int64_t cnt)
 {
+    if (trace_event_get_state(TRACE_MIRROR_RESTART_ITER)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)cnt };
+        trace_ring_record(TRACE_MIRROR_RESTART_ITER, args, 2, NULL);
+    }
 }
 
 static inline void trace_mirror_before_flush(void * s)
 {
+    if (trace_event_get_state(TRACE_MIRROR_BEFORE_FLUSH)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_MIRROR_BEFORE_FLUSH, args, 1, NULL);
+    }
 }
 
 static inline void trace_mirror_before_drain(void * s, int64_t cnt)
 {
+    if (trace_event_get_state(TRACE_MIRROR_BEFORE_DRAIN)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)cnt };
+        trace_ring_record(TRACE_MIRROR_BEFORE_DRAIN, args, 2, NULL);
+    }
 }
 
 static inline void trace_mirror_before_sleep(void * s, int64_t cnt, int synced, uint64_t delay_ns)
 {
+    if (trace_event_get_state(TRACE_MIRROR_BEFORE_SLEEP)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)cnt, (uint64_t)synced, (uint64_t)delay_ns };
+        trace_ring_record(TRACE_MIRROR_BEFORE_SLEEP, args, 4, NULL);
+    }
 }
 
 static inline void trace_mirror_one_iteration(void * s, int64_t sector_num, int nb_sectors)
 {
+    if (trace_event_get_state(TRACE_MIRROR_ONE_ITERATION)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)sector_num, (uint64_t)nb_sectors };
+        trace_ring_record(TRACE_MIRROR_ONE_ITERATION, args, 3, NULL);
+    }
 }
 
 static inline void trace_mirror_iteration_done(void * s, int64_t sector_num, int nb_sectors, int ret)
 {
+    if (trace_event_get_state(TRACE_MIRROR_ITERATION_DONE)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)sector_num, (uint64_t)nb_sectors, (uint64_t)ret };
+        trace_ring_record(TRACE_MIRROR_ITERATION_DONE, args, 4, NULL);
+    }
 }
 
 static inline void trace_mirror_yield(void * s, int64_t cnt, int buf_free_count, int in_flight)
 {
+    if (trace_event_get_state(TRACE_MIRROR_YIELD)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)cnt, (uint64_t)buf_free_count, (uint64_t)in_flight };
+        trace_ring_record(TRACE_MIRROR_YIELD, args, 4, NULL);
+    }
 }
 
 static inline void trace_mirror_yield_in_flight(void * s, int64_t sector_num, int in_flight)
 {
+    if (trace_event_get_state(TRACE_MIRROR_YIELD_IN_FLIGHT)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)sector_num, (uint64_t)in_flight };
+        trace_ring_record(TRACE_MIRROR_YIELD_IN_FLIGHT, args, 3, NULL);
+    }
 }
 
 static inline void trace_mirror_yield_buf_busy(void * s, int nb_chunks, int in_flight)
 {
+    if (trace_event_get_state(TRACE_MIRROR_YIELD_BUF_BUSY)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)nb_chunks, (uint64_t)in_flight };
+        trace_ring_record(TRACE_MIRROR_YIELD_BUF_BUSY, args, 3, NULL);
+    }
 }
 
 static inline void trace_mirror_break_buf_busy(void * s, int nb_chunks, int in_flight)
 {
+    if (trace_event_get_state(TRACE_MIRROR_BREAK_BUF_BUSY)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)nb_chunks, (uint64_t)in_flight };
+        trace_ring_record(TRACE_MIRROR_BREAK_BUF_BUSY, args, 3, NULL);
+    }
 }
 
 static inline void trace_backup_do_cow_enter(void * job, int64_t start, int64_t sector_num, int nb_sectors)
 {
+    if (trace_event_get_state(TRACE_BACKUP_DO_COW_ENTER)) {
+        uint64_t args[] = { (uintptr_t)job, (uint64_t)start, (uint64_t)sector_num, (uint64_t)nb_sectors };
+        trace_ring_record(TRACE_BACKUP_DO_COW_ENTER, args, 4, NULL);
+    }
 }
 
 static inline void trace_backup_do_cow_return(void * job, int64_t sector_num, int nb_sectors, int ret)
 {
+    if (trace_event_get_state(TRACE_BACKUP_DO_COW_RETURN)) {
+        uint64_t args[] = { (uintptr_t)job, (uint64_t)sector_num, (uint64_t)nb_sectors, (uint64_t)ret };
+        trace_ring_record(TRACE_BACKUP_DO_COW_RETURN, args, 4, NULL);
+    }
 }
 
 static inline void trace_backup_do_cow_skip(void * job, int64_t start)
 {
+    if (trace_event_get_state(TRACE_BACKUP_DO_COW_SKIP)) {
+        uint64_t args[] = { (uintptr_t)job, (uint64_t)start };
+        trace_ring_record(TRACE_BACKUP_DO_COW_SKIP, args, 2, NULL);
+    }
 }
 
 static inline void trace_backup_do_cow_process(void * job, int64_t start)
 {
+    if (trace_event_get_state(TRACE_BACKUP_DO_COW_PROCESS)) {
+        uint64_t args[] = { (uintptr_t)job, (uint64_t)start };
+        trace_ring_record(TRACE_BACKUP_DO_COW_PROCESS, args, 2, NULL);
+    }
 }
 
 static inline void trace_backup_do_cow_read_fail(void * job, int64_t start, int ret)
 {
+    if (trace_event_get_state(TRACE_BACKUP_DO_COW_READ_FAIL)) {
+        uint64_t args[] = { (uintptr_t)job, (uint64_t)start, (uint64_t)ret };
+        trace_ring_record(TRACE_BACKUP_DO_COW_READ_FAIL, args, 3, NULL);
+    }
 }
 
 static inline void trace_backup_do_cow_write_fail(void * job, int64_t start, int ret)
 {
+    if (trace_event_get_state(TRACE_BACKUP_DO_COW_WRITE_FAIL)) {
+        uint64_t args[] = { (uintptr_t)job, (uint64_t)start, (uint64_t)ret };
+        trace_ring_record(TRACE_BACKUP_DO_COW_WRITE_FAIL, args, 3, NULL);
+    }
 }
 
 static inline void trace_qmp_block_job_cancel(void * job)
 {
+    if (trace_event_get_state(TRACE_QMP_BLOCK_JOB_CANCEL)) {
+        uint64_t args[] = { (uintptr_t)job };
+        trace_ring_record(TRACE_QMP_BLOCK_JOB_CANCEL, args, 1, NULL);
+    }
 }
 
 static inline void trace_qmp_block_job_pause(void * job)
 {
+    if (trace_event_get_state(TRACE_QMP_BLOCK_JOB_PAUSE)) {
+        uint64_t args[] = { (uintptr_t)job };
+        trace_ring_record(TRACE_QMP_BLOCK_JOB_PAUSE, args, 1, NULL);
+    }
 }
 
 static inline void trace_qmp_block_job_resume(void * job)
 {
+    if (trace_event_get_state(TRACE_QMP_BLOCK_JOB_RESUME)) {
+        uint64_t args[] = { (uintptr_t)job };
+        trace_ring_record(TRACE_QMP_BLOCK_JOB_RESUME, args, 1, NULL);
+    }
 }
 
 static inline void trace_qmp_block_job_complete(void * job)
 {
+    if (trace_event_get_state(TRACE_QMP_BLOCK_JOB_COMPLETE)) {
+        uint64_t args[] = { (uintptr_t)job };
+        trace_ring_record(TRACE_QMP_BLOCK_JOB_COMPLETE, args, 1, NULL);
+    }
 }
 
 static inline void trace_block_job_cb(void * bs, void * job, int ret)
 {
+    if (trace_event_get_state(TRACE_BLOCK_JOB_CB)) {
+        uint64_t args[] = { (uintptr_t)bs, (uintptr_t)job, (uint64_t)ret };
+        trace_ring_record(TRACE_BLOCK_JOB_CB, args, 3, NULL);
+    }
 }
 
 static inline void trace_qmp_block_stream(void * bs, void * job)
 {
+    if (trace_event_get_state(TRACE_QMP_BLOCK_STREAM)) {
+        uint64_t args[] = { (uintptr_t)bs, (uintptr_t)job };
+        trace_ring_record(TRACE_QMP_BLOCK_STREAM, args, 2, NULL);
+    }
 }
 
 static inline void trace_virtio_blk_req_complete(void * req, int status)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_BLK_REQ_COMPLETE)) {
+        uint64_t args[] = { (uintptr_t)req, (uint64_t)status };
+        trace_ring_record(TRACE_VIRTIO_BLK_REQ_COMPLETE, args, 2, NULL);
+    }
 }
 
 static inline void trace_virtio_blk_rw_complete(void * req, int ret)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_BLK_RW_COMPLETE)) {
+        uint64_t args[] = { (uintptr_t)req, (uint64_t)ret };
+        trace_ring_record(TRACE_VIRTIO_BLK_RW_COMPLETE, args, 2, NULL);
+    }
 }
 
 static inline void trace_virtio_blk_handle_write(void * req, uint64_t sector, size_t nsectors)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_BLK_HANDLE_WRITE)) {
+        uint64_t args[] = { (uintptr_t)req, (uint64_t)sector, (uint64_t)nsectors };
+        trace_ring_record(TRACE_VIRTIO_BLK_HANDLE_WRITE, args, 3, NULL);
+    }
 }
 
 static inline void trace_virtio_blk_handle_read(void * req, uint64_t sector, size_t nsectors)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_BLK_HANDLE_READ)) {
+        uint64_t args[] = { (uintptr_t)req, (uint64_t)sector, (uint64_t)nsectors };
+        trace_ring_record(TRACE_VIRTIO_BLK_HANDLE_READ, args, 3, NULL);
+    }
 }
 
 static inline void trace_virtio_blk_submit_multireq(void * mrb, int start, int num_reqs, uint64_t sector, size_t nsectors, bool is_write)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_BLK_SUBMIT_MULTIREQ)) {
+        uint64_t args[] = { (uintptr_t)mrb, (uint64_t)start, (uint64_t)num_reqs, (uint64_t)sector, (uint64_t)nsectors, (uint64_t)is_write };
+        trace_ring_record(TRACE_VIRTIO_BLK_SUBMIT_MULTIREQ, args, 6, NULL);
+    }
 }
 
 static inline void trace_virtio_blk_data_plane_start(void * s)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_BLK_DATA_PLANE_START)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_VIRTIO_BLK_DATA_PLANE_START, args, 1, NULL);
+    }
 }
 
 static inline void trace_virtio_blk_data_plane_stop(void * s)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_BLK_DATA_PLANE_STOP)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_VIRTIO_BLK_DATA_PLANE_STOP, args, 1, NULL);
+    }
 }
 
 static inline void trace_virtio_blk_data_plane_process_request(void * s, unsigned int out_num, unsigned int in_num, unsigned int head)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_BLK_DATA_PLANE_PROCESS_REQUEST)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)out_num, (uint64_t)in_num, (uint64_t)head };
+        trace_ring_record(TRACE_VIRTIO_BLK_DATA_PLANE_PROCESS_REQUEST, args, 4, NULL);
+    }
 }
 
 static inline void trace_vring_setup(uint64_t physical, void * desc, void * avail, void * used)
 {
+    if (trace_event_get_state(TRACE_VRING_SETUP)) {
+        uint64_t args[] = { (uint64_t)physical, (uintptr_t)desc, (uintptr_t)avail, (uintptr_t)used };
+        trace_ring_record(TRACE_VRING_SETUP, args, 4, NULL);
+    }
 }
 
 static inline void trace_thread_pool_submit(void * pool, void * req, void * opaque)
 {
+    if (trace_event_get_state(TRACE_THREAD_POOL_SUBMIT)) {
+        uint64_t args[] = { (uintptr_t)pool, (uintptr_t)req, (uintptr_t)opaque };
+        trace_ring_record(TRACE_THREAD_POOL_SUBMIT, args, 3, NULL);
+    }
 }
 
 static inline void trace_thread_pool_complete(void * pool, void * req, void * opaque, int ret)
 {
+    if (trace_event_get_state(TRACE_THREAD_POOL_COMPLETE)) {
+        uint64_t args[] = { (uintptr_t)pool, (uintptr_t)req, (uintptr_t)opaque, (uint64_t)ret };
+        trace_ring_record(TRACE_THREAD_POOL_COMPLETE, args, 4, NULL);
+    }
 }
 
 static inline void trace_thread_pool_cancel(void * req, void * opaque)
 {
+    if (trace_event_get_state(TRACE_THREAD_POOL_CANCEL)) {
+        uint64_t args[] = { (uintptr_t)req, (uintptr_t)opaque };
+        trace_ring_record(TRACE_THREAD_POOL_CANCEL, args, 2, NULL);
+    }
 }
 
 static inline void trace_paio_submit_co(int64_t sector_num, int nb_sectors, int type)
 {
+    if (trace_event_get_state(TRACE_PAIO_SUBMIT_CO)) {
+        uint64_t args[] = { (uint64_t)sector_num, (uint64_t)nb_sectors, (uint64_t)type };
+        trace_ring_record(TRACE_PAIO_SUBMIT_CO, args, 3, NULL);
+    }
 }
 
 static inline void trace_paio_submit(void * acb, void * opaque, int64_t sector_num, int nb_sectors, int type)
 {
+    if (trace_event_get_state(TRACE_PAIO_SUBMIT)) {
+        uint64_t args[] = { (uintptr_t)acb, (uintptr_t)opaque, (uint64_t)sector_num, (uint64_t)nb_sectors, (uint64_t)type };
+        trace_ring_record(TRACE_PAIO_SUBMIT, args, 5, NULL);
+    }
 }
 
 static inline void trace_cpu_in(unsigned int addr, unsigned int val)
 {
+    if (trace_event_get_state(TRACE_CPU_IN)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_CPU_IN, args, 2, NULL);
+    }
 }
 
 static inline void trace_cpu_out(unsigned int addr, unsigned int val)
 {
+    if (trace_event_get_state(TRACE_CPU_OUT)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_CPU_OUT, args, 2, NULL);
+    }
 }
 
 static inline void trace_balloon_event(void * opaque, unsigned long addr)
 {
+    if (trace_event_get_state(TRACE_BALLOON_EVENT)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)addr };
+        trace_ring_record(TRACE_BALLOON_EVENT, args, 2, NULL);
+    }
 }
 
 static inline void trace_virtio_balloon_handle_output(const char * name, uint64_t gpa)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_BALLOON_HANDLE_OUTPUT)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)gpa };
+        trace_ring_record(TRACE_VIRTIO_BALLOON_HANDLE_OUTPUT, args, 2, name);
+    }
 }
 
 static inline void trace_virtio_balloon_get_config(uint32_t num_pages, uint32_t acutal)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_BALLOON_GET_CONFIG)) {
+        uint64_t args[] = { (uint64_t)num_pages, (uint64_t)acutal };
+        trace_ring_record(TRACE_VIRTIO_BALLOON_GET_CONFIG, args, 2, NULL);
+    }
 }
 
 static inline void trace_virtio_balloon_set_config(uint32_t acutal, uint32_t oldacutal)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_BALLOON_SET_CONFIG)) {
+        uint64_t args[] = { (uint64_t)acutal, (uint64_t)oldacutal };
+        trace_ring_record(TRACE_VIRTIO_BALLOON_SET_CONFIG, args, 2, NULL);
+    }
 }
 
 static inline void trace_virtio_balloon_to_target(uint64_t target, uint32_t num_pages)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_BALLOON_TO_TARGET)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)num_pages };
+        trace_ring_record(TRACE_VIRTIO_BALLOON_TO_TARGET, args, 2, NULL);
+    }
 }
 
 static inline void trace_cpu_set_apic_base(uint64_t val)
 {
+    if (trace_event_get_state(TRACE_CPU_SET_APIC_BASE)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_CPU_SET_APIC_BASE, args, 1, NULL);
+    }
 }
 
 static inline void trace_cpu_get_apic_base(uint64_t val)
 {
+    if (trace_event_get_state(TRACE_CPU_GET_APIC_BASE)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_CPU_GET_APIC_BASE, args, 1, NULL);
+    }
 }
 
 static inline void trace_apic_report_irq_delivered(int apic_irq_delivered)
 {
+    if (trace_event_get_state(TRACE_APIC_REPORT_IRQ_DELIVERED)) {
+        uint64_t args[] = { (uint64_t)apic_irq_delivered };
+        trace_ring_record(TRACE_APIC_REPORT_IRQ_DELIVERED, args, 1, NULL);
+    }
 }
 
 static inline void trace_apic_reset_irq_delivered(int apic_irq_delivered)
 {
+    if (trace_event_get_state(TRACE_APIC_RESET_IRQ_DELIVERED)) {
+        uint64_t args[] = { (uint64_t)apic_irq_delivered };
+        trace_ring_record(TRACE_APIC_RESET_IRQ_DELIVERED, args, 1, NULL);
+    }
 }
 
 static inline void trace_apic_get_irq_delivered(int apic_irq_delivered)
 {
+    if (trace_event_get_state(TRACE_APIC_GET_IRQ_DELIVERED)) {
+        uint64_t args[] = { (uint64_t)apic_irq_delivered };
+        trace_ring_record(TRACE_APIC_GET_IRQ_DELIVERED, args, 1, NULL);
+    }
 }
 
 static inline void trace_apic_local_deliver(int vector, uint32_t lvt)
 {
+    if (trace_event_get_state(TRACE_APIC_LOCAL_DELIVER)) {
+        uint64_t args[] = { (uint64_t)vector, (uint64_t)lvt };
+        trace_ring_record(TRACE_APIC_LOCAL_DELIVER, args, 2, NULL);
+    }
 }
 
 static inline void trace_apic_deliver_irq(uint8_t dest, uint8_t dest_mode, uint8_t delivery_mode, uint8_t vector_num, uint8_t trigger_mode)
 {
+    if (trace_event_get_state(TRACE_APIC_DELIVER_IRQ)) {
+        uint64_t args[] = { (uint64_t)dest, (uint64_t)dest_mode, (uint64_t)delivery_mode, (uint64_t)vector_num, (uint64_t)trigger_mode };
+        trace_ring_record(TRACE_APIC_DELIVER_IRQ, args, 5, NULL);
+    }
 }
 
 static inline void trace_apic_mem_readl(uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_APIC_MEM_READL)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_APIC_MEM_READL, args, 2, NULL);
+    }
 }
 
 static inline void trace_apic_mem_writel(uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_APIC_MEM_WRITEL)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_APIC_MEM_WRITEL, args, 2, NULL);
+    }
 }
 
 static inline void trace_cs4231_mem_readl_dreg(uint32_t reg, uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_CS4231_MEM_READL_DREG)) {
+        uint64_t args[] = { (uint64_t)reg, (uint64_t)ret };
+        trace_ring_record(TRACE_CS4231_MEM_READL_DREG, args, 2, NULL);
+    }
 }
 
 static inline void trace_cs4231_mem_readl_reg(uint32_t reg, uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_CS4231_MEM_READL_REG)) {
+        uint64_t args[] = { (uint64_t)reg, (uint64_t)ret };
+        trace_ring_record(TRACE_CS4231_MEM_READL_REG, args, 2, NULL);
+    }
 }
 
 static inline void trace_cs4231_mem_writel_reg(uint32_t reg, uint32_t old, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_CS4231_MEM_WRITEL_REG)) {
+        uint64_t args[] = { (uint64_t)reg, (uint64_t)old, (uint64_t)val };
+        trace_ring_record(TRACE_CS4231_MEM_WRITEL_REG, args, 3, NULL);
+    }
 }
 
 static inline void trace_cs4231_mem_writel_dreg(uint32_t reg, uint32_t old, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_CS4231_MEM_WRITEL_DREG)) {
+        uint64_t args[] = { (uint64_t)reg, (uint64_t)old, (uint64_t)val };
+        trace_ring_record(TRACE_CS4231_MEM_WRITEL_DREG, args, 3, NULL);
+    }
 }
 
 static inline void trace_nvram_read(uint32_t addr, uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_NVRAM_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)ret };
+        trace_ring_record(TRACE_NVRAM_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_nvram_write(uint32_t addr, uint32_t old, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_NVRAM_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)old, (uint64_t)val };
+        trace_ring_record(TRACE_NVRAM_WRITE, args, 3, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_writel_mer(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_WRITEL_MER)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ECC_MEM_WRITEL_MER, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_writel_mdr(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_WRITEL_MDR)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ECC_MEM_WRITEL_MDR, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_writel_mfsr(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_WRITEL_MFSR)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ECC_MEM_WRITEL_MFSR, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_writel_vcr(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_WRITEL_VCR)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ECC_MEM_WRITEL_VCR, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_writel_dr(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_WRITEL_DR)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ECC_MEM_WRITEL_DR, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_writel_ecr0(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_WRITEL_ECR0)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ECC_MEM_WRITEL_ECR0, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_writel_ecr1(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_WRITEL_ECR1)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ECC_MEM_WRITEL_ECR1, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_readl_mer(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_READL_MER)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_ECC_MEM_READL_MER, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_readl_mdr(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_READL_MDR)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_ECC_MEM_READL_MDR, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_readl_mfsr(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_READL_MFSR)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_ECC_MEM_READL_MFSR, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_readl_vcr(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_READL_VCR)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_ECC_MEM_READL_VCR, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_readl_mfar0(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_READL_MFAR0)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_ECC_MEM_READL_MFAR0, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_readl_mfar1(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_READL_MFAR1)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_ECC_MEM_READL_MFAR1, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_readl_dr(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_READL_DR)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_ECC_MEM_READL_DR, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_readl_ecr0(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_READL_ECR0)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_ECC_MEM_READL_ECR0, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_mem_readl_ecr1(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_ECC_MEM_READL_ECR1)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_ECC_MEM_READL_ECR1, args, 1, NULL);
+    }
 }
 
 static inline void trace_ecc_diag_mem_writeb(uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ECC_DIAG_MEM_WRITEB)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_ECC_DIAG_MEM_WRITEB, args, 2, NULL);
+    }
 }
 
 static inline void trace_ecc_diag_mem_readb(uint64_t addr, uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_ECC_DIAG_MEM_READB)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)ret };
+        trace_ring_record(TRACE_ECC_DIAG_MEM_READB, args, 2, NULL);
+    }
 }
 
 static inline void trace_fw_cfg_write(void * s, uint8_t value)
 {
+    if (trace_event_get_state(TRACE_FW_CFG_WRITE)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)value };
+        trace_ring_record(TRACE_FW_CFG_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_fw_cfg_select(void * s, uint16_t key, int ret)
 {
+    if (trace_event_get_state(TRACE_FW_CFG_SELECT)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)key, (uint64_t)ret };
+        trace_ring_record(TRACE_FW_CFG_SELECT, args, 3, NULL);
+    }
 }
 
 static inline void trace_fw_cfg_read(void * s, uint8_t ret)
 {
+    if (trace_event_get_state(TRACE_FW_CFG_READ)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)ret };
+        trace_ring_record(TRACE_FW_CFG_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_fw_cfg_add_file_dupe(void * s, char * name)
 {
+    if (trace_event_get_state(TRACE_FW_CFG_ADD_FILE_DUPE)) {
+        uint64_t args[] = { (uintptr_t)s, (uintptr_t)name };
+        trace_ring_record(TRACE_FW_CFG_ADD_FILE_DUPE, args, 2, name);
+    }
 }
 
 static inline void trace_fw_cfg_add_file(void * s, int index, char * name, size_t len)
 {
+    if (trace_event_get_state(TRACE_FW_CFG_ADD_FILE)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)index, (uintptr_t)name, (uint64_t)len };
+        trace_ring_record(TRACE_FW_CFG_ADD_FILE, args, 4, name);
+    }
 }
 
 static inline void trace_hd_geometry_lchs_guess(void * blk, int cyls, int heads, int secs)
 {
+    if (trace_event_get_state(TRACE_HD_GEOMETRY_LCHS_GUESS)) {
+        uint64_t args[] = { (uintptr_t)blk, (uint64_t)cyls, (uint64_t)heads, (uint64_t)secs };
+        trace_ring_record(TRACE_HD_GEOMETRY_LCHS_GUESS, args, 4, NULL);
+    }
 }
 
 static inline void trace_hd_geometry_guess(void * blk, uint32_t cyls, uint32_t heads, uint32_t secs, int trans)
 {
+    if (trace_event_get_state(TRACE_HD_GEOMETRY_GUESS)) {
+        uint64_t args[] = { (uintptr_t)blk, (uint64_t)cyls, (uint64_t)heads, (uint64_t)secs, (uint64_t)trans };
+        trace_ring_record(TRACE_HD_GEOMETRY_GUESS, args, 5, NULL);
+    }
 }
 
 static inline void trace_jazz_led_read(uint64_t addr, uint8_t val)
 {
+    if (trace_event_get_state(TRACE_JAZZ_LED_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_JAZZ_LED_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_jazz_led_write(uint64_t addr, uint8_t new)
 {
+    if (trace_event_get_state(TRACE_JAZZ_LED_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)new };
+        trace_ring_record(TRACE_JAZZ_LED_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_xenfb_mouse_event(void * opaque, int dx, int dy, int dz, int button_state, int abs_pointer_wanted)
 {
+    if (trace_event_get_state(TRACE_XENFB_MOUSE_EVENT)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)dx, (uint64_t)dy, (uint64_t)dz, (uint64_t)button_state, (uint64_t)abs_pointer_wanted };
+        trace_ring_record(TRACE_XENFB_MOUSE_EVENT, args, 6, NULL);
+    }
 }
 
 static inline void trace_xenfb_input_connected(void * xendev, int abs_pointer_wanted)
 {
+    if (trace_event_get_state(TRACE_XENFB_INPUT_CONNECTED)) {
+        uint64_t args[] = { (uintptr_t)xendev, (uint64_t)abs_pointer_wanted };
+        trace_ring_record(TRACE_XENFB_INPUT_CONNECTED, args, 2, NULL);
+    }
 }
 
 static inline void trace_lance_mem_readw(uint64_t addr, uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_LANCE_MEM_READW)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)ret };
+        trace_ring_record(TRACE_LANCE_MEM_READW, args, 2, NULL);
+    }
 }
 
 static inline void trace_lance_mem_writew(uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_LANCE_MEM_WRITEW)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_LANCE_MEM_WRITEW, args, 2, NULL);
+    }
 }
 
 static inline void trace_slavio_intctl_mem_readl(uint32_t cpu, uint64_t addr, uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_INTCTL_MEM_READL)) {
+        uint64_t args[] = { (uint64_t)cpu, (uint64_t)addr, (uint64_t)ret };
+        trace_ring_record(TRACE_SLAVIO_INTCTL_MEM_READL, args, 3, NULL);
+    }
 }
 
 static inline void trace_slavio_intctl_mem_writel(uint32_t cpu, uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_INTCTL_MEM_WRITEL)) {
+        uint64_t args[] = { (uint64_t)cpu, (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_SLAVIO_INTCTL_MEM_WRITEL, args, 3, NULL);
+    }
 }
 
 static inline void trace_slavio_intctl_mem_writel_clear(uint32_t cpu, uint32_t val, uint32_t intreg_pending)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_INTCTL_MEM_WRITEL_CLEAR)) {
+        uint64_t args[] = { (uint64_t)cpu, (uint64_t)val, (uint64_t)intreg_pending };
+        trace_ring_record(TRACE_SLAVIO_INTCTL_MEM_WRITEL_CLEAR, args, 3, NULL);
+    }
 }
 
 static inline void trace_slavio_intctl_mem_writel_set(uint32_t cpu, uint32_t val, uint32_t intreg_pending)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_INTCTL_MEM_WRITEL_SET)) {
+        uint64_t args[] = { (uint64_t)cpu, (uint64_t)val, (uint64_t)intreg_pending };
+        trace_ring_record(TRACE_SLAVIO_INTCTL_MEM_WRITEL_SET, args, 3, NULL);
+    }
 }
 
 static inline void trace_slavio_intctlm_mem_readl(uint64_t addr, uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_INTCTLM_MEM_READL)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)ret };
+        trace_ring_record(TRACE_SLAVIO_INTCTLM_MEM_READL, args, 2, NULL);
+    }
 }
 
 static inline void trace_slavio_intctlm_mem_writel(uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_INTCTLM_MEM_WRITEL)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_SLAVIO_INTCTLM_MEM_WRITEL, args, 2, NULL);
+    }
 }
 
 static inline void trace_slavio_intctlm_mem_writel_enable(uint32_t val, uint32_t intregm_disabled)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_INTCTLM_MEM_WRITEL_ENABLE)) {
+        uint64_t args[] = { (uint64_t)val, (uint64_t)intregm_disabled };
+        trace_ring_record(TRACE_SLAVIO_INTCTLM_MEM_WRITEL_ENABLE, args, 2, NULL);
+    }
 }
 
 static inline void trace_slavio_intctlm_mem_writel_disable(uint32_t val, uint32_t intregm_disabled)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_INTCTLM_MEM_WRITEL_DISABLE)) {
+        uint64_t args[] = { (uint64_t)val, (uint64_t)intregm_disabled };
+        trace_ring_record(TRACE_SLAVIO_INTCTLM_MEM_WRITEL_DISABLE, args, 2, NULL);
+    }
 }
 
 static inline void trace_slavio_intctlm_mem_writel_target(uint32_t cpu)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_INTCTLM_MEM_WRITEL_TARGET)) {
+        uint64_t args[] = { (uint64_t)cpu };
+        trace_ring_record(TRACE_SLAVIO_INTCTLM_MEM_WRITEL_TARGET, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_check_interrupts(uint32_t pending, uint32_t intregm_disabled)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_CHECK_INTERRUPTS)) {
+        uint64_t args[] = { (uint64_t)pending, (uint64_t)intregm_disabled };
+        trace_ring_record(TRACE_SLAVIO_CHECK_INTERRUPTS, args, 2, NULL);
+    }
 }
 
 static inline void trace_slavio_set_irq(uint32_t target_cpu, int irq, uint32_t pil, int level)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_SET_IRQ)) {
+        uint64_t args[] = { (uint64_t)target_cpu, (uint64_t)irq, (uint64_t)pil, (uint64_t)level };
+        trace_ring_record(TRACE_SLAVIO_SET_IRQ, args, 4, NULL);
+    }
 }
 
 static inline void trace_slavio_set_timer_irq_cpu(int cpu, int level)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_SET_TIMER_IRQ_CPU)) {
+        uint64_t args[] = { (uint64_t)cpu, (uint64_t)level };
+        trace_ring_record(TRACE_SLAVIO_SET_TIMER_IRQ_CPU, args, 2, NULL);
+    }
 }
 
 static inline void trace_ps2_put_keycode(void * opaque, int keycode)
 {
+    if (trace_event_get_state(TRACE_PS2_PUT_KEYCODE)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)keycode };
+        trace_ring_record(TRACE_PS2_PUT_KEYCODE, args, 2, NULL);
+    }
 }
 
 static inline void trace_ps2_read_data(void * opaque)
 {
+    if (trace_event_get_state(TRACE_PS2_READ_DATA)) {
+        uint64_t args[] = { (uintptr_t)opaque };
+        trace_ring_record(TRACE_PS2_READ_DATA, args, 1, NULL);
+    }
 }
 
 static inline void trace_ps2_set_ledstate(void * s, int ledstate)
 {
+    if (trace_event_get_state(TRACE_PS2_SET_LEDSTATE)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)ledstate };
+        trace_ring_record(TRACE_PS2_SET_LEDSTATE, args, 2, NULL);
+    }
 }
 
 static inline void trace_ps2_reset_keyboard(void * s)
 {
+    if (trace_event_get_state(TRACE_PS2_RESET_KEYBOARD)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_PS2_RESET_KEYBOARD, args, 1, NULL);
+    }
 }
 
 static inline void trace_ps2_write_keyboard(void * opaque, int val)
 {
+    if (trace_event_get_state(TRACE_PS2_WRITE_KEYBOARD)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)val };
+        trace_ring_record(TRACE_PS2_WRITE_KEYBOARD, args, 2, NULL);
+    }
 }
 
 static inline void trace_ps2_keyboard_set_translation(void * opaque, int mode)
 {
+    if (trace_event_get_state(TRACE_PS2_KEYBOARD_SET_TRANSLATION)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)mode };
+        trace_ring_record(TRACE_PS2_KEYBOARD_SET_TRANSLATION, args, 2, NULL);
+    }
 }
 
 static inline void trace_ps2_mouse_send_packet(void * s, int dx1, int dy1, int dz1, int b)
 {
+    if (trace_event_get_state(TRACE_PS2_MOUSE_SEND_PACKET)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)dx1, (uint64_t)dy1, (uint64_t)dz1, (uint64_t)b };
+        trace_ring_record(TRACE_PS2_MOUSE_SEND_PACKET, args, 5, NULL);
+    }
 }
 
 static inline void trace_ps2_mouse_event_disabled(void * opaque, int dx, int dy, int dz, int buttons_state, int mouse_dx, int mouse_dy, int mouse_dz)
 {
+    if (trace_event_get_state(TRACE_PS2_MOUSE_EVENT_DISABLED)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)dx, (uint64_t)dy, (uint64_t)dz, (uint64_t)buttons_state, (uint64_t)mouse_dx, (uint64_t)mouse_dy, (uint64_t)mouse_dz };
+        trace_ring_record(TRACE_PS2_MOUSE_EVENT_DISABLED, args, 8, NULL);
+    }
 }
 
 static inline void trace_ps2_mouse_event(void * opaque, int dx, int dy, int dz, int buttons_state, int mouse_dx, int mouse_dy, int mouse_dz)
 {
+    if (trace_event_get_state(TRACE_PS2_MOUSE_EVENT)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)dx, (uint64_t)dy, (uint64_t)dz, (uint64_t)buttons_state, (uint64_t)mouse_dx, (uint64_t)mouse_dy, (uint64_t)mouse_dz };
+        trace_ring_record(TRACE_PS2_MOUSE_EVENT, args, 8, NULL);
+    }
 }
 
 static inline void trace_ps2_mouse_fake_event(void * opaque)
 {
+    if (trace_event_get_state(TRACE_PS2_MOUSE_FAKE_EVENT)) {
+        uint64_t args[] = { (uintptr_t)opaque };
+        trace_ring_record(TRACE_PS2_MOUSE_FAKE_EVENT, args, 1, NULL);
+    }
 }
 
 static inline void trace_ps2_write_mouse(void * opaque, int val)
 {
+    if (trace_event_get_state(TRACE_PS2_WRITE_MOUSE)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)val };
+        trace_ring_record(TRACE_PS2_WRITE_MOUSE, args, 2, NULL);
+    }
 }
 
 static inline void trace_ps2_kbd_reset(void * opaque)
 {
+    if (trace_event_get_state(TRACE_PS2_KBD_RESET)) {
+        uint64_t args[] = { (uintptr_t)opaque };
+        trace_ring_record(TRACE_PS2_KBD_RESET, args, 1, NULL);
+    }
 }
 
 static inline void trace_ps2_mouse_reset(void * opaque)
 {
+    if (trace_event_get_state(TRACE_PS2_MOUSE_RESET)) {
+        uint64_t args[] = { (uintptr_t)opaque };
+        trace_ring_record(TRACE_PS2_MOUSE_RESET, args, 1, NULL);
+    }
 }
 
 static inline void trace_ps2_kbd_init(void * s)
 {
+    if (trace_event_get_state(TRACE_PS2_KBD_INIT)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_PS2_KBD_INIT, args, 1, NULL);
+    }
 }
 
 static inline void trace_ps2_mouse_init(void * s)
 {
+    if (trace_event_get_state(TRACE_PS2_MOUSE_INIT)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_PS2_MOUSE_INIT, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_misc_update_irq_raise(void)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_MISC_UPDATE_IRQ_RAISE)) {
+        trace_ring_record(TRACE_SLAVIO_MISC_UPDATE_IRQ_RAISE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_slavio_misc_update_irq_lower(void)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_MISC_UPDATE_IRQ_LOWER)) {
+        trace_ring_record(TRACE_SLAVIO_MISC_UPDATE_IRQ_LOWER, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_slavio_set_power_fail(int power_failing, uint8_t config)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_SET_POWER_FAIL)) {
+        uint64_t args[] = { (uint64_t)power_failing, (uint64_t)config };
+        trace_ring_record(TRACE_SLAVIO_SET_POWER_FAIL, args, 2, NULL);
+    }
 }
 
 static inline void trace_slavio_cfg_mem_writeb(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_CFG_MEM_WRITEB)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_SLAVIO_CFG_MEM_WRITEB, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_cfg_mem_readb(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_CFG_MEM_READB)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_SLAVIO_CFG_MEM_READB, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_diag_mem_writeb(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_DIAG_MEM_WRITEB)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_SLAVIO_DIAG_MEM_WRITEB, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_diag_mem_readb(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_DIAG_MEM_READB)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_SLAVIO_DIAG_MEM_READB, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_mdm_mem_writeb(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_MDM_MEM_WRITEB)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_SLAVIO_MDM_MEM_WRITEB, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_mdm_mem_readb(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_MDM_MEM_READB)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_SLAVIO_MDM_MEM_READB, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_aux1_mem_writeb(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_AUX1_MEM_WRITEB)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_SLAVIO_AUX1_MEM_WRITEB, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_aux1_mem_readb(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_AUX1_MEM_READB)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_SLAVIO_AUX1_MEM_READB, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_aux2_mem_writeb(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_AUX2_MEM_WRITEB)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_SLAVIO_AUX2_MEM_WRITEB, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_aux2_mem_readb(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_AUX2_MEM_READB)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_SLAVIO_AUX2_MEM_READB, args, 1, NULL);
+    }
 }
 
 static inline void trace_apc_mem_writeb(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_APC_MEM_WRITEB)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_APC_MEM_WRITEB, args, 1, NULL);
+    }
 }
 
 static inline void trace_apc_mem_readb(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_APC_MEM_READB)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_APC_MEM_READB, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_sysctrl_mem_writel(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_SYSCTRL_MEM_WRITEL)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_SLAVIO_SYSCTRL_MEM_WRITEL, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_sysctrl_mem_readl(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_SYSCTRL_MEM_READL)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_SLAVIO_SYSCTRL_MEM_READL, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_led_mem_writew(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_LED_MEM_WRITEW)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_SLAVIO_LED_MEM_WRITEW, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_led_mem_readw(uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_LED_MEM_READW)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_SLAVIO_LED_MEM_READW, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_timer_get_out(uint64_t limit, uint32_t counthigh, uint32_t count)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_TIMER_GET_OUT)) {
+        uint64_t args[] = { (uint64_t)limit, (uint64_t)counthigh, (uint64_t)count };
+        trace_ring_record(TRACE_SLAVIO_TIMER_GET_OUT, args, 3, NULL);
+    }
 }
 
 static inline void trace_slavio_timer_irq(uint32_t counthigh, uint32_t count)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_TIMER_IRQ)) {
+        uint64_t args[] = { (uint64_t)counthigh, (uint64_t)count };
+        trace_ring_record(TRACE_SLAVIO_TIMER_IRQ, args, 2, NULL);
+    }
 }
 
 static inline void trace_slavio_timer_mem_readl_invalid(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_TIMER_MEM_READL_INVALID)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_SLAVIO_TIMER_MEM_READL_INVALID, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_timer_mem_readl(uint64_t addr, uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_TIMER_MEM_READL)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)ret };
+        trace_ring_record(TRACE_SLAVIO_TIMER_MEM_READL, args, 2, NULL);
+    }
 }
 
 static inline void trace_slavio_timer_mem_writel(uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_TIMER_MEM_WRITEL)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_SLAVIO_TIMER_MEM_WRITEL, args, 2, NULL);
+    }
 }
 
 static inline void trace_slavio_timer_mem_writel_limit(unsigned int timer_index, uint64_t count)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_TIMER_MEM_WRITEL_LIMIT)) {
+        uint64_t args[] = { (uint64_t)timer_index, (uint64_t)count };
+        trace_ring_record(TRACE_SLAVIO_TIMER_MEM_WRITEL_LIMIT, args, 2, NULL);
+    }
 }
 
 static inline void trace_slavio_timer_mem_writel_counter_invalid(void)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_TIMER_MEM_WRITEL_COUNTER_INVALID)) {
+        trace_ring_record(TRACE_SLAVIO_TIMER_MEM_WRITEL_COUNTER_INVALID, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_slavio_timer_mem_writel_status_start(unsigned int timer_index)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_TIMER_MEM_WRITEL_STATUS_START)) {
+        uint64_t args[] = { (uint64_t)timer_index };
+        trace_ring_record(TRACE_SLAVIO_TIMER_MEM_WRITEL_STATUS_START, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_timer_mem_writel_status_stop(unsigned int timer_index)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_TIMER_MEM_WRITEL_STATUS_STOP)) {
+        uint64_t args[] = { (uint64_t)timer_index };
+        trace_ring_record(TRACE_SLAVIO_TIMER_MEM_WRITEL_STATUS_STOP, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_timer_mem_writel_mode_user(unsigned int timer_index)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_TIMER_MEM_WRITEL_MODE_USER)) {
+        uint64_t args[] = { (uint64_t)timer_index };
+        trace_ring_record(TRACE_SLAVIO_TIMER_MEM_WRITEL_MODE_USER, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_timer_mem_writel_mode_counter(unsigned int timer_index)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_TIMER_MEM_WRITEL_MODE_COUNTER)) {
+        uint64_t args[] = { (uint64_t)timer_index };
+        trace_ring_record(TRACE_SLAVIO_TIMER_MEM_WRITEL_MODE_COUNTER, args, 1, NULL);
+    }
 }
 
 static inline void trace_slavio_timer_mem_writel_mode_invalid(void)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_TIMER_MEM_WRITEL_MODE_INVALID)) {
+        trace_ring_record(TRACE_SLAVIO_TIMER_MEM_WRITEL_MODE_INVALID, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_slavio_timer_mem_writel_invalid(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_SLAVIO_TIMER_MEM_WRITEL_INVALID)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_SLAVIO_TIMER_MEM_WRITEL_INVALID, args, 1, NULL);
+    }
 }
 
 static inline void trace_ledma_memory_read(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_LEDMA_MEMORY_READ)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_LEDMA_MEMORY_READ, args, 1, NULL);
+    }
 }
 
 static inline void trace_ledma_memory_write(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_LEDMA_MEMORY_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_LEDMA_MEMORY_WRITE, args, 1, NULL);
+    }
 }
 
 static inline void trace_sparc32_dma_set_irq_raise(void)
 {
+    if (trace_event_get_state(TRACE_SPARC32_DMA_SET_IRQ_RAISE)) {
+        trace_ring_record(TRACE_SPARC32_DMA_SET_IRQ_RAISE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_sparc32_dma_set_irq_lower(void)
 {
+    if (trace_event_get_state(TRACE_SPARC32_DMA_SET_IRQ_LOWER)) {
+        trace_ring_record(TRACE_SPARC32_DMA_SET_IRQ_LOWER, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_espdma_memory_read(uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_ESPDMA_MEMORY_READ)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_ESPDMA_MEMORY_READ, args, 1, NULL);
+    }
 }
 
 static inline void trace_espdma_memory_write(uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_ESPDMA_MEMORY_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_ESPDMA_MEMORY_WRITE, args, 1, NULL);
+    }
 }
 
 static inline void trace_sparc32_dma_mem_readl(uint64_t addr, uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_SPARC32_DMA_MEM_READL)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)ret };
+        trace_ring_record(TRACE_SPARC32_DMA_MEM_READL, args, 2, NULL);
+    }
 }
 
 static inline void trace_sparc32_dma_mem_writel(uint64_t addr, uint32_t old, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_SPARC32_DMA_MEM_WRITEL)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)old, (uint64_t)val };
+        trace_ring_record(TRACE_SPARC32_DMA_MEM_WRITEL, args, 3, NULL);
+    }
 }
 
 static inline void trace_sparc32_dma_enable_raise(void)
 {
+    if (trace_event_get_state(TRACE_SPARC32_DMA_ENABLE_RAISE)) {
+        trace_ring_record(TRACE_SPARC32_DMA_ENABLE_RAISE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_sparc32_dma_enable_lower(void)
 {
+    if (trace_event_get_state(TRACE_SPARC32_DMA_ENABLE_LOWER)) {
+        trace_ring_record(TRACE_SPARC32_DMA_ENABLE_LOWER, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_sun4m_cpu_interrupt(unsigned int level)
 {
+    if (trace_event_get_state(TRACE_SUN4M_CPU_INTERRUPT)) {
+        uint64_t args[] = { (uint64_t)level };
+        trace_ring_record(TRACE_SUN4M_CPU_INTERRUPT, args, 1, NULL);
+    }
 }
 
 static inline void trace_sun4m_cpu_reset_interrupt(unsigned int level)
 {
+    if (trace_event_get_state(TRACE_SUN4M_CPU_RESET_INTERRUPT)) {
+        uint64_t args[] = { (uint64_t)level };
+        trace_ring_record(TRACE_SUN4M_CPU_RESET_INTERRUPT, args, 1, NULL);
+    }
 }
 
 static inline void trace_sun4m_cpu_set_irq_raise(int level)
 {
+    if (trace_event_get_state(TRACE_SUN4M_CPU_SET_IRQ_RAISE)) {
+        uint64_t args[] = { (uint64_t)level };
+        trace_ring_record(TRACE_SUN4M_CPU_SET_IRQ_RAISE, args, 1, NULL);
+    }
 }
 
 static inline void trace_sun4m_cpu_set_irq_lower(int level)
 {
+    if (trace_event_get_state(TRACE_SUN4M_CPU_SET_IRQ_LOWER)) {
+        uint64_t args[] = { (uint64_t)level };
+        trace_ring_record(TRACE_SUN4M_CPU_SET_IRQ_LOWER, args, 1, NULL);
+    }
 }
 
 static inline void trace_sun4m_iommu_mem_readl(uint64_t addr, uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_SUN4M_IOMMU_MEM_READL)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)ret };
+        trace_ring_record(TRACE_SUN4M_IOMMU_MEM_READL, args, 2, NULL);
+    }
 }
 
 static inline void trace_sun4m_iommu_mem_writel(uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_SUN4M_IOMMU_MEM_WRITEL)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_SUN4M_IOMMU_MEM_WRITEL, args, 2, NULL);
+    }
 }
 
 static inline void trace_sun4m_iommu_mem_writel_ctrl(uint64_t iostart)
 {
+    if (trace_event_get_state(TRACE_SUN4M_IOMMU_MEM_WRITEL_CTRL)) {
+        uint64_t args[] = { (uint64_t)iostart };
+        trace_ring_record(TRACE_SUN4M_IOMMU_MEM_WRITEL_CTRL, args, 1, NULL);
+    }
 }
 
 static inline void trace_sun4m_iommu_mem_writel_tlbflush(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_SUN4M_IOMMU_MEM_WRITEL_TLBFLUSH)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_SUN4M_IOMMU_MEM_WRITEL_TLBFLUSH, args, 1, NULL);
+    }
 }
 
 static inline void trace_sun4m_iommu_mem_writel_pgflush(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_SUN4M_IOMMU_MEM_WRITEL_PGFLUSH)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_SUN4M_IOMMU_MEM_WRITEL_PGFLUSH, args, 1, NULL);
+    }
 }
 
 static inline void trace_sun4m_iommu_page_get_flags(uint64_t pa, uint64_t iopte, uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_SUN4M_IOMMU_PAGE_GET_FLAGS)) {
+        uint64_t args[] = { (uint64_t)pa, (uint64_t)iopte, (uint64_t)ret };
+        trace_ring_record(TRACE_SUN4M_IOMMU_PAGE_GET_FLAGS, args, 3, NULL);
+    }
 }
 
 static inline void trace_sun4m_iommu_translate_pa(uint64_t addr, uint64_t pa, uint32_t iopte)
 {
+    if (trace_event_get_state(TRACE_SUN4M_IOMMU_TRANSLATE_PA)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)pa, (uint64_t)iopte };
+        trace_ring_record(TRACE_SUN4M_IOMMU_TRANSLATE_PA, args, 3, NULL);
+    }
 }
 
 static inline void trace_sun4m_iommu_bad_addr(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_SUN4M_IOMMU_BAD_ADDR)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_SUN4M_IOMMU_BAD_ADDR, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_packet_state_change(int bus, const char * port, int ep, void * p, const char * o, const char * n)
 {
+    if (trace_event_get_state(TRACE_USB_PACKET_STATE_CHANGE)) {
+        uint64_t args[] = { (uint64_t)bus, (uintptr_t)port, (uint64_t)ep, (uintptr_t)p, (uintptr_t)o, (uintptr_t)n };
+        trace_ring_record(TRACE_USB_PACKET_STATE_CHANGE, args, 6, port);
+    }
 }
 
 static inline void trace_usb_packet_state_fault(int bus, const char * port, int ep, void * p, const char * o, const char * n)
 {
+    if (trace_event_get_state(TRACE_USB_PACKET_STATE_FAULT)) {
+        uint64_t args[] = { (uint64_t)bus, (uintptr_t)port, (uint64_t)ep, (uintptr_t)p, (uintptr_t)o, (uintptr_t)n };
+        trace_ring_record(TRACE_USB_PACKET_STATE_FAULT, args, 6, port);
+    }
 }
 
 static inline void trace_usb_port_claim(int bus, const char * port)
 {
+    if (trace_event_get_state(TRACE_USB_PORT_CLAIM)) {
+        uint64_t args[] = { (uint64_t)bus, (uintptr_t)port };
+        trace_ring_record(TRACE_USB_PORT_CLAIM, args, 2, port);
+    }
 }
 
 static inline void trace_usb_port_attach(int bus, const char * port, const char * devspeed, const char * portspeed)
 {
+    if (trace_event_get_state(TRACE_USB_PORT_ATTACH)) {
+        uint64_t args[] = { (uint64_t)bus, (uintptr_t)port, (uintptr_t)devspeed, (uintptr_t)portspeed };
+        trace_ring_record(TRACE_USB_PORT_ATTACH, args, 4, port);
+    }
 }
 
 static inline void trace_usb_port_detach(int bus, const char * port)
 {
+    if (trace_event_get_state(TRACE_USB_PORT_DETACH)) {
+        uint64_t args[] = { (uint64_t)bus, (uintptr_t)port };
+        trace_ring_record(TRACE_USB_PORT_DETACH, args, 2, port);
+    }
 }
 
 static inline void trace_usb_port_release(int bus, const char * port)
 {
+    if (trace_event_get_state(TRACE_USB_PORT_RELEASE)) {
+        uint64_t args[] = { (uint64_t)bus, (uintptr_t)port };
+        trace_ring_record(TRACE_USB_PORT_RELEASE, args, 2, port);
+    }
 }
 
 static inline void trace_usb_ohci_iso_td_read_failed(uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ISO_TD_READ_FAILED)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_USB_OHCI_ISO_TD_READ_FAILED, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_iso_td_head(uint32_t head, uint32_t tail, uint32_t flags, uint32_t bp, uint32_t next, uint32_t be, uint32_t framenum, uint32_t startframe, uint32_t framecount, int rel_frame_num)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ISO_TD_HEAD)) {
+        uint64_t args[] = { (uint64_t)head, (uint64_t)tail, (uint64_t)flags, (uint64_t)bp, (uint64_t)next, (uint64_t)be, (uint64_t)framenum, (uint64_t)startframe, (uint64_t)framecount, (uint64_t)rel_frame_num };
+        trace_ring_record(TRACE_USB_OHCI_ISO_TD_HEAD, args, 10, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_iso_td_head_offset(uint32_t o0, uint32_t o1, uint32_t o2, uint32_t o3, uint32_t o4, uint32_t o5, uint32_t o6, uint32_t o7)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ISO_TD_HEAD_OFFSET)) {
+        uint64_t args[] = { (uint64_t)o0, (uint64_t)o1, (uint64_t)o2, (uint64_t)o3, (uint64_t)o4, (uint64_t)o5, (uint64_t)o6, (uint64_t)o7 };
+        trace_ring_record(TRACE_USB_OHCI_ISO_TD_HEAD_OFFSET, args, 8, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_iso_td_relative_frame_number_neg(int rel)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ISO_TD_RELATIVE_FRAME_NUMBER_NEG)) {
+        uint64_t args[] = { (uint64_t)rel };
+        trace_ring_record(TRACE_USB_OHCI_ISO_TD_RELATIVE_FRAME_NUMBER_NEG, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_iso_td_relative_frame_number_big(int rel, int count)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ISO_TD_RELATIVE_FRAME_NUMBER_BIG)) {
+        uint64_t args[] = { (uint64_t)rel, (uint64_t)count };
+        trace_ring_record(TRACE_USB_OHCI_ISO_TD_RELATIVE_FRAME_NUMBER_BIG, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_iso_td_bad_direction(int dir)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ISO_TD_BAD_DIRECTION)) {
+        uint64_t args[] = { (uint64_t)dir };
+        trace_ring_record(TRACE_USB_OHCI_ISO_TD_BAD_DIRECTION, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_iso_td_bad_bp_be(uint32_t bp, uint32_t be)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ISO_TD_BAD_BP_BE)) {
+        uint64_t args[] = { (uint64_t)bp, (uint64_t)be };
+        trace_ring_record(TRACE_USB_OHCI_ISO_TD_BAD_BP_BE, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_iso_td_bad_cc_not_accessed(uint32_t start, uint32_t next)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ISO_TD_BAD_CC_NOT_ACCESSED)) {
+        uint64_t args[] = { (uint64_t)start, (uint64_t)next };
+        trace_ring_record(TRACE_USB_OHCI_ISO_TD_BAD_CC_NOT_ACCESSED, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_iso_td_bad_cc_overrun(uint32_t start, uint32_t next)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ISO_TD_BAD_CC_OVERRUN)) {
+        uint64_t args[] = { (uint64_t)start, (uint64_t)next };
+        trace_ring_record(TRACE_USB_OHCI_ISO_TD_BAD_CC_OVERRUN, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_iso_td_so(uint32_t so, uint32_t eo, uint32_t s, uint32_t e, const char * str, ssize_t len, int ret)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ISO_TD_SO)) {
+        uint64_t args[] = { (uint64_t)so, (uint64_t)eo, (uint64_t)s, (uint64_t)e, (uintptr_t)str, (uint64_t)len, (uint64_t)ret };
+        trace_ring_record(TRACE_USB_OHCI_ISO_TD_SO, args, 7, str);
+    }
 }
 
 static inline void trace_usb_ohci_iso_td_data_overrun(int ret, ssize_t len)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ISO_TD_DATA_OVERRUN)) {
+        uint64_t args[] = { (uint64_t)ret, (uint64_t)len };
+        trace_ring_record(TRACE_USB_OHCI_ISO_TD_DATA_OVERRUN, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_iso_td_data_underrun(int ret)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ISO_TD_DATA_UNDERRUN)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_USB_OHCI_ISO_TD_DATA_UNDERRUN, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_iso_td_nak(int ret)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ISO_TD_NAK)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_USB_OHCI_ISO_TD_NAK, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_iso_td_bad_response(int ret)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ISO_TD_BAD_RESPONSE)) {
+        uint64_t args[] = { (uint64_t)ret };
+        trace_ring_record(TRACE_USB_OHCI_ISO_TD_BAD_RESPONSE, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_port_attach(int index)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_PORT_ATTACH)) {
+        uint64_t args[] = { (uint64_t)index };
+        trace_ring_record(TRACE_USB_OHCI_PORT_ATTACH, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_port_detach(int index)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_PORT_DETACH)) {
+        uint64_t args[] = { (uint64_t)index };
+        trace_ring_record(TRACE_USB_OHCI_PORT_DETACH, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_port_wakeup(int index)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_PORT_WAKEUP)) {
+        uint64_t args[] = { (uint64_t)index };
+        trace_ring_record(TRACE_USB_OHCI_PORT_WAKEUP, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_port_suspend(int index)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_PORT_SUSPEND)) {
+        uint64_t args[] = { (uint64_t)index };
+        trace_ring_record(TRACE_USB_OHCI_PORT_SUSPEND, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_port_reset(int index)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_PORT_RESET)) {
+        uint64_t args[] = { (uint64_t)index };
+        trace_ring_record(TRACE_USB_OHCI_PORT_RESET, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_remote_wakeup(const char * s)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_REMOTE_WAKEUP)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_USB_OHCI_REMOTE_WAKEUP, args, 1, s);
+    }
 }
 
 static inline void trace_usb_ohci_reset(const char * s)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_RESET)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_USB_OHCI_RESET, args, 1, s);
+    }
 }
 
 static inline void trace_usb_ohci_start(const char * s)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_START)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_USB_OHCI_START, args, 1, s);
+    }
 }
 
 static inline void trace_usb_ohci_resume(const char * s)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_RESUME)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_USB_OHCI_RESUME, args, 1, s);
+    }
 }
 
 static inline void trace_usb_ohci_stop(const char * s)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_STOP)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_USB_OHCI_STOP, args, 1, s);
+    }
 }
 
 static inline void trace_usb_ohci_exit(const char * s)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_EXIT)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_USB_OHCI_EXIT, args, 1, s);
+    }
 }
 
 static inline void trace_usb_ohci_set_ctl(const char * s, uint32_t new_state)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_SET_CTL)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)new_state };
+        trace_ring_record(TRACE_USB_OHCI_SET_CTL, args, 2, s);
+    }
 }
 
 static inline void trace_usb_ohci_td_underrun(void)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_TD_UNDERRUN)) {
+        trace_ring_record(TRACE_USB_OHCI_TD_UNDERRUN, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_td_dev_error(void)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_TD_DEV_ERROR)) {
+        trace_ring_record(TRACE_USB_OHCI_TD_DEV_ERROR, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_td_nak(void)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_TD_NAK)) {
+        trace_ring_record(TRACE_USB_OHCI_TD_NAK, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_td_stall(void)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_TD_STALL)) {
+        trace_ring_record(TRACE_USB_OHCI_TD_STALL, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_td_babble(void)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_TD_BABBLE)) {
+        trace_ring_record(TRACE_USB_OHCI_TD_BABBLE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_td_bad_device_response(int rc)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_TD_BAD_DEVICE_RESPONSE)) {
+        uint64_t args[] = { (uint64_t)rc };
+        trace_ring_record(TRACE_USB_OHCI_TD_BAD_DEVICE_RESPONSE, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_td_read_error(uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_TD_READ_ERROR)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_USB_OHCI_TD_READ_ERROR, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_td_bad_direction(int dir)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_TD_BAD_DIRECTION)) {
+        uint64_t args[] = { (uint64_t)dir };
+        trace_ring_record(TRACE_USB_OHCI_TD_BAD_DIRECTION, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_td_skip_async(void)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_TD_SKIP_ASYNC)) {
+        trace_ring_record(TRACE_USB_OHCI_TD_SKIP_ASYNC, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_td_pkt_hdr(uint32_t addr, int64_t pktlen, int64_t len, const char * s, int flag_r, uint32_t cbp, uint32_t be)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_TD_PKT_HDR)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)pktlen, (uint64_t)len, (uintptr_t)s, (uint64_t)flag_r, (uint64_t)cbp, (uint64_t)be };
+        trace_ring_record(TRACE_USB_OHCI_TD_PKT_HDR, args, 7, s);
+    }
 }
 
 static inline void trace_usb_ohci_td_pkt_short(const char * dir, const char * buf)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_TD_PKT_SHORT)) {
+        uint64_t args[] = { (uintptr_t)dir, (uintptr_t)buf };
+        trace_ring_record(TRACE_USB_OHCI_TD_PKT_SHORT, args, 2, dir);
+    }
 }
 
 static inline void trace_usb_ohci_td_pkt_full(const char * dir, const char * buf)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_TD_PKT_FULL)) {
+        uint64_t args[] = { (uintptr_t)dir, (uintptr_t)buf };
+        trace_ring_record(TRACE_USB_OHCI_TD_PKT_FULL, args, 2, dir);
+    }
 }
 
 static inline void trace_usb_ohci_td_too_many_pending(void)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_TD_TOO_MANY_PENDING)) {
+        trace_ring_record(TRACE_USB_OHCI_TD_TOO_MANY_PENDING, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_td_packet_status(int status)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_TD_PACKET_STATUS)) {
+        uint64_t args[] = { (uint64_t)status };
+        trace_ring_record(TRACE_USB_OHCI_TD_PACKET_STATUS, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_ed_read_error(uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ED_READ_ERROR)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_USB_OHCI_ED_READ_ERROR, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_ed_pkt(uint32_t cur, int h, int c, uint32_t head, uint32_t tail, uint32_t next)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ED_PKT)) {
+        uint64_t args[] = { (uint64_t)cur, (uint64_t)h, (uint64_t)c, (uint64_t)head, (uint64_t)tail, (uint64_t)next };
+        trace_ring_record(TRACE_USB_OHCI_ED_PKT, args, 6, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_ed_pkt_flags(uint32_t fa, uint32_t en, uint32_t d, int s, int k, int f, uint32_t mps)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ED_PKT_FLAGS)) {
+        uint64_t args[] = { (uint64_t)fa, (uint64_t)en, (uint64_t)d, (uint64_t)s, (uint64_t)k, (uint64_t)f, (uint64_t)mps };
+        trace_ring_record(TRACE_USB_OHCI_ED_PKT_FLAGS, args, 7, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_hcca_read_error(uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_HCCA_READ_ERROR)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_USB_OHCI_HCCA_READ_ERROR, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_mem_read_unaligned(uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_MEM_READ_UNALIGNED)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_USB_OHCI_MEM_READ_UNALIGNED, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_mem_read_bad_offset(uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_MEM_READ_BAD_OFFSET)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_USB_OHCI_MEM_READ_BAD_OFFSET, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_mem_write_unaligned(uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_MEM_WRITE_UNALIGNED)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_USB_OHCI_MEM_WRITE_UNALIGNED, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_mem_write_bad_offset(uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_MEM_WRITE_BAD_OFFSET)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_USB_OHCI_MEM_WRITE_BAD_OFFSET, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_process_lists(uint32_t head, uint32_t cur)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_PROCESS_LISTS)) {
+        uint64_t args[] = { (uint64_t)head, (uint64_t)cur };
+        trace_ring_record(TRACE_USB_OHCI_PROCESS_LISTS, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_bus_eof_timer_failed(const char * name)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_BUS_EOF_TIMER_FAILED)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_USB_OHCI_BUS_EOF_TIMER_FAILED, args, 1, name);
+    }
 }
 
 static inline void trace_usb_ohci_set_frame_interval(const char * name, uint16_t fi_x, uint16_t fi_u)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_SET_FRAME_INTERVAL)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)fi_x, (uint64_t)fi_u };
+        trace_ring_record(TRACE_USB_OHCI_SET_FRAME_INTERVAL, args, 3, name);
+    }
 }
 
 static inline void trace_usb_ohci_hub_power_up(void)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_HUB_POWER_UP)) {
+        trace_ring_record(TRACE_USB_OHCI_HUB_POWER_UP, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_hub_power_down(void)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_HUB_POWER_DOWN)) {
+        trace_ring_record(TRACE_USB_OHCI_HUB_POWER_DOWN, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_init_time(int64_t frametime, int64_t bittime)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_INIT_TIME)) {
+        uint64_t args[] = { (uint64_t)frametime, (uint64_t)bittime };
+        trace_ring_record(TRACE_USB_OHCI_INIT_TIME, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_die(void)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_DIE)) {
+        trace_ring_record(TRACE_USB_OHCI_DIE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_ohci_async_complete(void)
 {
+    if (trace_event_get_state(TRACE_USB_OHCI_ASYNC_COMPLETE)) {
+        trace_ring_record(TRACE_USB_OHCI_ASYNC_COMPLETE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_reset(void)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_RESET)) {
+        trace_ring_record(TRACE_USB_EHCI_RESET, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_unrealize(void)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_UNREALIZE)) {
+        trace_ring_record(TRACE_USB_EHCI_UNREALIZE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_opreg_read(uint32_t addr, const char * str, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_OPREG_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uintptr_t)str, (uint64_t)val };
+        trace_ring_record(TRACE_USB_EHCI_OPREG_READ, args, 3, str);
+    }
 }
 
 static inline void trace_usb_ehci_opreg_write(uint32_t addr, const char * str, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_OPREG_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uintptr_t)str, (uint64_t)val };
+        trace_ring_record(TRACE_USB_EHCI_OPREG_WRITE, args, 3, str);
+    }
 }
 
 static inline void trace_usb_ehci_opreg_change(uint32_t addr, const char * str, uint32_t new, uint32_t old)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_OPREG_CHANGE)) {
+        uint64_t args[] = { (uint64_t)addr, (uintptr_t)str, (uint64_t)new, (uint64_t)old };
+        trace_ring_record(TRACE_USB_EHCI_OPREG_CHANGE, args, 4, str);
+    }
 }
 
 static inline void trace_usb_ehci_portsc_read(uint32_t addr, uint32_t port, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_PORTSC_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)port, (uint64_t)val };
+        trace_ring_record(TRACE_USB_EHCI_PORTSC_READ, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_portsc_write(uint32_t addr, uint32_t port, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_PORTSC_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)port, (uint64_t)val };
+        trace_ring_record(TRACE_USB_EHCI_PORTSC_WRITE, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_portsc_change(uint32_t addr, uint32_t port, uint32_t new, uint32_t old)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_PORTSC_CHANGE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)port, (uint64_t)new, (uint64_t)old };
+        trace_ring_record(TRACE_USB_EHCI_PORTSC_CHANGE, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_usbsts(const char * sts, int state)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_USBSTS)) {
+        uint64_t args[] = { (uintptr_t)sts, (uint64_t)state };
+        trace_ring_record(TRACE_USB_EHCI_USBSTS, args, 2, sts);
+    }
 }
 
 static inline void trace_usb_ehci_state(const char * schedule, const char * state)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_STATE)) {
+        uint64_t args[] = { (uintptr_t)schedule, (uintptr_t)state };
+        trace_ring_record(TRACE_USB_EHCI_STATE, args, 2, schedule);
+    }
 }
 
 static inline void trace_usb_ehci_qh_ptrs(void * q, uint32_t addr, uint32_t nxt, uint32_t c_qtd, uint32_t n_qtd, uint32_t a_qtd)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_QH_PTRS)) {
+        uint64_t args[] = { (uintptr_t)q, (uint64_t)addr, (uint64_t)nxt, (uint64_t)c_qtd, (uint64_t)n_qtd, (uint64_t)a_qtd };
+        trace_ring_record(TRACE_USB_EHCI_QH_PTRS, args, 6, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_qh_fields(uint32_t addr, int rl, int mplen, int eps, int ep, int devaddr)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_QH_FIELDS)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)rl, (uint64_t)mplen, (uint64_t)eps, (uint64_t)ep, (uint64_t)devaddr };
+        trace_ring_record(TRACE_USB_EHCI_QH_FIELDS, args, 6, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_qh_bits(uint32_t addr, int c, int h, int dtc, int i)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_QH_BITS)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)c, (uint64_t)h, (uint64_t)dtc, (uint64_t)i };
+        trace_ring_record(TRACE_USB_EHCI_QH_BITS, args, 5, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_qtd_ptrs(void * q, uint32_t addr, uint32_t nxt, uint32_t altnext)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_QTD_PTRS)) {
+        uint64_t args[] = { (uintptr_t)q, (uint64_t)addr, (uint64_t)nxt, (uint64_t)altnext };
+        trace_ring_record(TRACE_USB_EHCI_QTD_PTRS, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_qtd_fields(uint32_t addr, int tbytes, int cpage, int cerr, int pid)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_QTD_FIELDS)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)tbytes, (uint64_t)cpage, (uint64_t)cerr, (uint64_t)pid };
+        trace_ring_record(TRACE_USB_EHCI_QTD_FIELDS, args, 5, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_qtd_bits(uint32_t addr, int ioc, int active, int halt, int babble, int xacterr)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_QTD_BITS)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)ioc, (uint64_t)active, (uint64_t)halt, (uint64_t)babble, (uint64_t)xacterr };
+        trace_ring_record(TRACE_USB_EHCI_QTD_BITS, args, 6, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_itd(uint32_t addr, uint32_t nxt, uint32_t mplen, uint32_t mult, uint32_t ep, uint32_t devaddr)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_ITD)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)nxt, (uint64_t)mplen, (uint64_t)mult, (uint64_t)ep, (uint64_t)devaddr };
+        trace_ring_record(TRACE_USB_EHCI_ITD, args, 6, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_sitd(uint32_t addr, uint32_t nxt, uint32_t active)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_SITD)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)nxt, (uint64_t)active };
+        trace_ring_record(TRACE_USB_EHCI_SITD, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_port_attach(uint32_t port, const char * owner, const char * device)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_PORT_ATTACH)) {
+        uint64_t args[] = { (uint64_t)port, (uintptr_t)owner, (uintptr_t)device };
+        trace_ring_record(TRACE_USB_EHCI_PORT_ATTACH, args, 3, owner);
+    }
 }
 
 static inline void trace_usb_ehci_port_detach(uint32_t port, const char * owner)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_PORT_DETACH)) {
+        uint64_t args[] = { (uint64_t)port, (uintptr_t)owner };
+        trace_ring_record(TRACE_USB_EHCI_PORT_DETACH, args, 2, owner);
+    }
 }
 
 static inline void trace_usb_ehci_port_reset(uint32_t port, int enable)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_PORT_RESET)) {
+        uint64_t args[] = { (uint64_t)port, (uint64_t)enable };
+        trace_ring_record(TRACE_USB_EHCI_PORT_RESET, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_port_suspend(uint32_t port)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_PORT_SUSPEND)) {
+        uint64_t args[] = { (uint64_t)port };
+        trace_ring_record(TRACE_USB_EHCI_PORT_SUSPEND, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_port_wakeup(uint32_t port)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_PORT_WAKEUP)) {
+        uint64_t args[] = { (uint64_t)port };
+        trace_ring_record(TRACE_USB_EHCI_PORT_WAKEUP, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_port_resume(uint32_t port)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_PORT_RESUME)) {
+        uint64_t args[] = { (uint64_t)port };
+        trace_ring_record(TRACE_USB_EHCI_PORT_RESUME, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_queue_action(void * q, const char * action)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_QUEUE_ACTION)) {
+        uint64_t args[] = { (uintptr_t)q, (uintptr_t)action };
+        trace_ring_record(TRACE_USB_EHCI_QUEUE_ACTION, args, 2, action);
+    }
 }
 
 static inline void trace_usb_ehci_packet_action(void * q, void * p, const char * action)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_PACKET_ACTION)) {
+        uint64_t args[] = { (uintptr_t)q, (uintptr_t)p, (uintptr_t)action };
+        trace_ring_record(TRACE_USB_EHCI_PACKET_ACTION, args, 3, action);
+    }
 }
 
 static inline void trace_usb_ehci_irq(uint32_t level, uint32_t frindex, uint32_t sts, uint32_t mask)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_IRQ)) {
+        uint64_t args[] = { (uint64_t)level, (uint64_t)frindex, (uint64_t)sts, (uint64_t)mask };
+        trace_ring_record(TRACE_USB_EHCI_IRQ, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_guest_bug(const char * reason)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_GUEST_BUG)) {
+        uint64_t args[] = { (uintptr_t)reason };
+        trace_ring_record(TRACE_USB_EHCI_GUEST_BUG, args, 1, reason);
+    }
 }
 
 static inline void trace_usb_ehci_doorbell_ring(void)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_DOORBELL_RING)) {
+        trace_ring_record(TRACE_USB_EHCI_DOORBELL_RING, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_doorbell_ack(void)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_DOORBELL_ACK)) {
+        trace_ring_record(TRACE_USB_EHCI_DOORBELL_ACK, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_ehci_dma_error(void)
 {
+    if (trace_event_get_state(TRACE_USB_EHCI_DMA_ERROR)) {
+        trace_ring_record(TRACE_USB_EHCI_DMA_ERROR, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_reset(void)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_RESET)) {
+        trace_ring_record(TRACE_USB_UHCI_RESET, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_exit(void)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_EXIT)) {
+        trace_ring_record(TRACE_USB_UHCI_EXIT, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_schedule_start(void)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_SCHEDULE_START)) {
+        trace_ring_record(TRACE_USB_UHCI_SCHEDULE_START, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_schedule_stop(void)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_SCHEDULE_STOP)) {
+        trace_ring_record(TRACE_USB_UHCI_SCHEDULE_STOP, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_frame_start(uint32_t num)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_FRAME_START)) {
+        uint64_t args[] = { (uint64_t)num };
+        trace_ring_record(TRACE_USB_UHCI_FRAME_START, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_frame_stop_bandwidth(void)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_FRAME_STOP_BANDWIDTH)) {
+        trace_ring_record(TRACE_USB_UHCI_FRAME_STOP_BANDWIDTH, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_frame_loop_stop_idle(void)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_FRAME_LOOP_STOP_IDLE)) {
+        trace_ring_record(TRACE_USB_UHCI_FRAME_LOOP_STOP_IDLE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_frame_loop_continue(void)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_FRAME_LOOP_CONTINUE)) {
+        trace_ring_record(TRACE_USB_UHCI_FRAME_LOOP_CONTINUE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_mmio_readw(uint32_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_MMIO_READW)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_USB_UHCI_MMIO_READW, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_mmio_writew(uint32_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_MMIO_WRITEW)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_USB_UHCI_MMIO_WRITEW, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_queue_add(uint32_t token)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_QUEUE_ADD)) {
+        uint64_t args[] = { (uint64_t)token };
+        trace_ring_record(TRACE_USB_UHCI_QUEUE_ADD, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_queue_del(uint32_t token, const char * reason)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_QUEUE_DEL)) {
+        uint64_t args[] = { (uint64_t)token, (uintptr_t)reason };
+        trace_ring_record(TRACE_USB_UHCI_QUEUE_DEL, args, 2, reason);
+    }
 }
 
 static inline void trace_usb_uhci_packet_add(uint32_t token, uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_PACKET_ADD)) {
+        uint64_t args[] = { (uint64_t)token, (uint64_t)addr };
+        trace_ring_record(TRACE_USB_UHCI_PACKET_ADD, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_packet_link_async(uint32_t token, uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_PACKET_LINK_ASYNC)) {
+        uint64_t args[] = { (uint64_t)token, (uint64_t)addr };
+        trace_ring_record(TRACE_USB_UHCI_PACKET_LINK_ASYNC, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_packet_unlink_async(uint32_t token, uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_PACKET_UNLINK_ASYNC)) {
+        uint64_t args[] = { (uint64_t)token, (uint64_t)addr };
+        trace_ring_record(TRACE_USB_UHCI_PACKET_UNLINK_ASYNC, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_packet_cancel(uint32_t token, uint32_t addr, int done)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_PACKET_CANCEL)) {
+        uint64_t args[] = { (uint64_t)token, (uint64_t)addr, (uint64_t)done };
+        trace_ring_record(TRACE_USB_UHCI_PACKET_CANCEL, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_packet_complete_success(uint32_t token, uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_PACKET_COMPLETE_SUCCESS)) {
+        uint64_t args[] = { (uint64_t)token, (uint64_t)addr };
+        trace_ring_record(TRACE_USB_UHCI_PACKET_COMPLETE_SUCCESS, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_packet_complete_shortxfer(uint32_t token, uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_PACKET_COMPLETE_SHORTXFER)) {
+        uint64_t args[] = { (uint64_t)token, (uint64_t)addr };
+        trace_ring_record(TRACE_USB_UHCI_PACKET_COMPLETE_SHORTXFER, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_packet_complete_stall(uint32_t token, uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_PACKET_COMPLETE_STALL)) {
+        uint64_t args[] = { (uint64_t)token, (uint64_t)addr };
+        trace_ring_record(TRACE_USB_UHCI_PACKET_COMPLETE_STALL, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_packet_complete_babble(uint32_t token, uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_PACKET_COMPLETE_BABBLE)) {
+        uint64_t args[] = { (uint64_t)token, (uint64_t)addr };
+        trace_ring_record(TRACE_USB_UHCI_PACKET_COMPLETE_BABBLE, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_packet_complete_error(uint32_t token, uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_PACKET_COMPLETE_ERROR)) {
+        uint64_t args[] = { (uint64_t)token, (uint64_t)addr };
+        trace_ring_record(TRACE_USB_UHCI_PACKET_COMPLETE_ERROR, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_packet_del(uint32_t token, uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_PACKET_DEL)) {
+        uint64_t args[] = { (uint64_t)token, (uint64_t)addr };
+        trace_ring_record(TRACE_USB_UHCI_PACKET_DEL, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_qh_load(uint32_t qh)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_QH_LOAD)) {
+        uint64_t args[] = { (uint64_t)qh };
+        trace_ring_record(TRACE_USB_UHCI_QH_LOAD, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_td_load(uint32_t qh, uint32_t td, uint32_t ctrl, uint32_t token)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_TD_LOAD)) {
+        uint64_t args[] = { (uint64_t)qh, (uint64_t)td, (uint64_t)ctrl, (uint64_t)token };
+        trace_ring_record(TRACE_USB_UHCI_TD_LOAD, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_td_queue(uint32_t td, uint32_t ctrl, uint32_t token)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_TD_QUEUE)) {
+        uint64_t args[] = { (uint64_t)td, (uint64_t)ctrl, (uint64_t)token };
+        trace_ring_record(TRACE_USB_UHCI_TD_QUEUE, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_td_nextqh(uint32_t qh, uint32_t td)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_TD_NEXTQH)) {
+        uint64_t args[] = { (uint64_t)qh, (uint64_t)td };
+        trace_ring_record(TRACE_USB_UHCI_TD_NEXTQH, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_td_async(uint32_t qh, uint32_t td)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_TD_ASYNC)) {
+        uint64_t args[] = { (uint64_t)qh, (uint64_t)td };
+        trace_ring_record(TRACE_USB_UHCI_TD_ASYNC, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uhci_td_complete(uint32_t qh, uint32_t td)
 {
+    if (trace_event_get_state(TRACE_USB_UHCI_TD_COMPLETE)) {
+        uint64_t args[] = { (uint64_t)qh, (uint64_t)td };
+        trace_ring_record(TRACE_USB_UHCI_TD_COMPLETE, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_reset(void)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_RESET)) {
+        trace_ring_record(TRACE_USB_XHCI_RESET, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_exit(void)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_EXIT)) {
+        trace_ring_record(TRACE_USB_XHCI_EXIT, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_run(void)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_RUN)) {
+        trace_ring_record(TRACE_USB_XHCI_RUN, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_stop(void)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_STOP)) {
+        trace_ring_record(TRACE_USB_XHCI_STOP, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_cap_read(uint32_t off, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_CAP_READ)) {
+        uint64_t args[] = { (uint64_t)off, (uint64_t)val };
+        trace_ring_record(TRACE_USB_XHCI_CAP_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_oper_read(uint32_t off, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_OPER_READ)) {
+        uint64_t args[] = { (uint64_t)off, (uint64_t)val };
+        trace_ring_record(TRACE_USB_XHCI_OPER_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_port_read(uint32_t port, uint32_t off, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_PORT_READ)) {
+        uint64_t args[] = { (uint64_t)port, (uint64_t)off, (uint64_t)val };
+        trace_ring_record(TRACE_USB_XHCI_PORT_READ, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_runtime_read(uint32_t off, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_RUNTIME_READ)) {
+        uint64_t args[] = { (uint64_t)off, (uint64_t)val };
+        trace_ring_record(TRACE_USB_XHCI_RUNTIME_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_doorbell_read(uint32_t off, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_DOORBELL_READ)) {
+        uint64_t args[] = { (uint64_t)off, (uint64_t)val };
+        trace_ring_record(TRACE_USB_XHCI_DOORBELL_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_oper_write(uint32_t off, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_OPER_WRITE)) {
+        uint64_t args[] = { (uint64_t)off, (uint64_t)val };
+        trace_ring_record(TRACE_USB_XHCI_OPER_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_port_write(uint32_t port, uint32_t off, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_PORT_WRITE)) {
+        uint64_t args[] = { (uint64_t)port, (uint64_t)off, (uint64_t)val };
+        trace_ring_record(TRACE_USB_XHCI_PORT_WRITE, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_runtime_write(uint32_t off, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_RUNTIME_WRITE)) {
+        uint64_t args[] = { (uint64_t)off, (uint64_t)val };
+        trace_ring_record(TRACE_USB_XHCI_RUNTIME_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_doorbell_write(uint32_t off, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_DOORBELL_WRITE)) {
+        uint64_t args[] = { (uint64_t)off, (uint64_t)val };
+        trace_ring_record(TRACE_USB_XHCI_DOORBELL_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_irq_intx(uint32_t level)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_IRQ_INTX)) {
+        uint64_t args[] = { (uint64_t)level };
+        trace_ring_record(TRACE_USB_XHCI_IRQ_INTX, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_irq_msi(uint32_t nr)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_IRQ_MSI)) {
+        uint64_t args[] = { (uint64_t)nr };
+        trace_ring_record(TRACE_USB_XHCI_IRQ_MSI, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_irq_msix(uint32_t nr)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_IRQ_MSIX)) {
+        uint64_t args[] = { (uint64_t)nr };
+        trace_ring_record(TRACE_USB_XHCI_IRQ_MSIX, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_irq_msix_use(uint32_t nr)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_IRQ_MSIX_USE)) {
+        uint64_t args[] = { (uint64_t)nr };
+        trace_ring_record(TRACE_USB_XHCI_IRQ_MSIX_USE, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_irq_msix_unuse(uint32_t nr)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_IRQ_MSIX_UNUSE)) {
+        uint64_t args[] = { (uint64_t)nr };
+        trace_ring_record(TRACE_USB_XHCI_IRQ_MSIX_UNUSE, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_queue_event(uint32_t vector, uint32_t idx, const char * trb, const char * evt, uint64_t param, uint32_t status, uint32_t control)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_QUEUE_EVENT)) {
+        uint64_t args[] = { (uint64_t)vector, (uint64_t)idx, (uintptr_t)trb, (uintptr_t)evt, (uint64_t)param, (uint64_t)status, (uint64_t)control };
+        trace_ring_record(TRACE_USB_XHCI_QUEUE_EVENT, args, 7, trb);
+    }
 }
 
 static inline void trace_usb_xhci_fetch_trb(uint64_t addr, const char * name, uint64_t param, uint32_t status, uint32_t control)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_FETCH_TRB)) {
+        uint64_t args[] = { (uint64_t)addr, (uintptr_t)name, (uint64_t)param, (uint64_t)status, (uint64_t)control };
+        trace_ring_record(TRACE_USB_XHCI_FETCH_TRB, args, 5, name);
+    }
 }
 
 static inline void trace_usb_xhci_port_reset(uint32_t port, bool warm)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_PORT_RESET)) {
+        uint64_t args[] = { (uint64_t)port, (uint64_t)warm };
+        trace_ring_record(TRACE_USB_XHCI_PORT_RESET, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_port_link(uint32_t port, uint32_t pls)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_PORT_LINK)) {
+        uint64_t args[] = { (uint64_t)port, (uint64_t)pls };
+        trace_ring_record(TRACE_USB_XHCI_PORT_LINK, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_port_notify(uint32_t port, uint32_t pls)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_PORT_NOTIFY)) {
+        uint64_t args[] = { (uint64_t)port, (uint64_t)pls };
+        trace_ring_record(TRACE_USB_XHCI_PORT_NOTIFY, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_slot_enable(uint32_t slotid)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_SLOT_ENABLE)) {
+        uint64_t args[] = { (uint64_t)slotid };
+        trace_ring_record(TRACE_USB_XHCI_SLOT_ENABLE, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_slot_disable(uint32_t slotid)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_SLOT_DISABLE)) {
+        uint64_t args[] = { (uint64_t)slotid };
+        trace_ring_record(TRACE_USB_XHCI_SLOT_DISABLE, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_slot_address(uint32_t slotid, const char * port)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_SLOT_ADDRESS)) {
+        uint64_t args[] = { (uint64_t)slotid, (uintptr_t)port };
+        trace_ring_record(TRACE_USB_XHCI_SLOT_ADDRESS, args, 2, port);
+    }
 }
 
 static inline void trace_usb_xhci_slot_configure(uint32_t slotid)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_SLOT_CONFIGURE)) {
+        uint64_t args[] = { (uint64_t)slotid };
+        trace_ring_record(TRACE_USB_XHCI_SLOT_CONFIGURE, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_slot_evaluate(uint32_t slotid)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_SLOT_EVALUATE)) {
+        uint64_t args[] = { (uint64_t)slotid };
+        trace_ring_record(TRACE_USB_XHCI_SLOT_EVALUATE, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_slot_reset(uint32_t slotid)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_SLOT_RESET)) {
+        uint64_t args[] = { (uint64_t)slotid };
+        trace_ring_record(TRACE_USB_XHCI_SLOT_RESET, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_ep_enable(uint32_t slotid, uint32_t epid)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_EP_ENABLE)) {
+        uint64_t args[] = { (uint64_t)slotid, (uint64_t)epid };
+        trace_ring_record(TRACE_USB_XHCI_EP_ENABLE, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_ep_disable(uint32_t slotid, uint32_t epid)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_EP_DISABLE)) {
+        uint64_t args[] = { (uint64_t)slotid, (uint64_t)epid };
+        trace_ring_record(TRACE_USB_XHCI_EP_DISABLE, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_ep_set_dequeue(uint32_t slotid, uint32_t epid, uint32_t streamid, uint64_t param)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_EP_SET_DEQUEUE)) {
+        uint64_t args[] = { (uint64_t)slotid, (uint64_t)epid, (uint64_t)streamid, (uint64_t)param };
+        trace_ring_record(TRACE_USB_XHCI_EP_SET_DEQUEUE, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_ep_kick(uint32_t slotid, uint32_t epid, uint32_t streamid)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_EP_KICK)) {
+        uint64_t args[] = { (uint64_t)slotid, (uint64_t)epid, (uint64_t)streamid };
+        trace_ring_record(TRACE_USB_XHCI_EP_KICK, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_ep_stop(uint32_t slotid, uint32_t epid)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_EP_STOP)) {
+        uint64_t args[] = { (uint64_t)slotid, (uint64_t)epid };
+        trace_ring_record(TRACE_USB_XHCI_EP_STOP, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_ep_reset(uint32_t slotid, uint32_t epid)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_EP_RESET)) {
+        uint64_t args[] = { (uint64_t)slotid, (uint64_t)epid };
+        trace_ring_record(TRACE_USB_XHCI_EP_RESET, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_ep_state(uint32_t slotid, uint32_t epid, const char * os, const char * ns)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_EP_STATE)) {
+        uint64_t args[] = { (uint64_t)slotid, (uint64_t)epid, (uintptr_t)os, (uintptr_t)ns };
+        trace_ring_record(TRACE_USB_XHCI_EP_STATE, args, 4, os);
+    }
 }
 
 static inline void trace_usb_xhci_xfer_start(void * xfer, uint32_t slotid, uint32_t epid, uint32_t streamid)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_XFER_START)) {
+        uint64_t args[] = { (uintptr_t)xfer, (uint64_t)slotid, (uint64_t)epid, (uint64_t)streamid };
+        trace_ring_record(TRACE_USB_XHCI_XFER_START, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_xfer_async(void * xfer)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_XFER_ASYNC)) {
+        uint64_t args[] = { (uintptr_t)xfer };
+        trace_ring_record(TRACE_USB_XHCI_XFER_ASYNC, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_xfer_nak(void * xfer)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_XFER_NAK)) {
+        uint64_t args[] = { (uintptr_t)xfer };
+        trace_ring_record(TRACE_USB_XHCI_XFER_NAK, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_xfer_retry(void * xfer)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_XFER_RETRY)) {
+        uint64_t args[] = { (uintptr_t)xfer };
+        trace_ring_record(TRACE_USB_XHCI_XFER_RETRY, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_xfer_success(void * xfer, uint32_t bytes)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_XFER_SUCCESS)) {
+        uint64_t args[] = { (uintptr_t)xfer, (uint64_t)bytes };
+        trace_ring_record(TRACE_USB_XHCI_XFER_SUCCESS, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_xfer_error(void * xfer, uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_XFER_ERROR)) {
+        uint64_t args[] = { (uintptr_t)xfer, (uint64_t)ret };
+        trace_ring_record(TRACE_USB_XHCI_XFER_ERROR, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_xhci_unimplemented(const char * item, int nr)
 {
+    if (trace_event_get_state(TRACE_USB_XHCI_UNIMPLEMENTED)) {
+        uint64_t args[] = { (uintptr_t)item, (uint64_t)nr };
+        trace_ring_record(TRACE_USB_XHCI_UNIMPLEMENTED, args, 2, item);
+    }
 }
 
 static inline void trace_usb_desc_device(int addr, int len, int ret)
 {
+    if (trace_event_get_state(TRACE_USB_DESC_DEVICE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)len, (uint64_t)ret };
+        trace_ring_record(TRACE_USB_DESC_DEVICE, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_desc_device_qualifier(int addr, int len, int ret)
 {
+    if (trace_event_get_state(TRACE_USB_DESC_DEVICE_QUALIFIER)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)len, (uint64_t)ret };
+        trace_ring_record(TRACE_USB_DESC_DEVICE_QUALIFIER, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_desc_config(int addr, int index, int len, int ret)
 {
+    if (trace_event_get_state(TRACE_USB_DESC_CONFIG)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)index, (uint64_t)len, (uint64_t)ret };
+        trace_ring_record(TRACE_USB_DESC_CONFIG, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_desc_other_speed_config(int addr, int index, int len, int ret)
 {
+    if (trace_event_get_state(TRACE_USB_DESC_OTHER_SPEED_CONFIG)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)index, (uint64_t)len, (uint64_t)ret };
+        trace_ring_record(TRACE_USB_DESC_OTHER_SPEED_CONFIG, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_desc_string(int addr, int index, int len, int ret)
 {
+    if (trace_event_get_state(TRACE_USB_DESC_STRING)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)index, (uint64_t)len, (uint64_t)ret };
+        trace_ring_record(TRACE_USB_DESC_STRING, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_desc_bos(int addr, int len, int ret)
 {
+    if (trace_event_get_state(TRACE_USB_DESC_BOS)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)len, (uint64_t)ret };
+        trace_ring_record(TRACE_USB_DESC_BOS, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_desc_msos(int addr, int index, int len, int ret)
 {
+    if (trace_event_get_state(TRACE_USB_DESC_MSOS)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)index, (uint64_t)len, (uint64_t)ret };
+        trace_ring_record(TRACE_USB_DESC_MSOS, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_set_addr(int addr)
 {
+    if (trace_event_get_state(TRACE_USB_SET_ADDR)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_USB_SET_ADDR, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_set_config(int addr, int config, int ret)
 {
+    if (trace_event_get_state(TRACE_USB_SET_CONFIG)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)config, (uint64_t)ret };
+        trace_ring_record(TRACE_USB_SET_CONFIG, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_set_interface(int addr, int iface, int alt, int ret)
 {
+    if (trace_event_get_state(TRACE_USB_SET_INTERFACE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)iface, (uint64_t)alt, (uint64_t)ret };
+        trace_ring_record(TRACE_USB_SET_INTERFACE, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_clear_device_feature(int addr, int feature, int ret)
 {
+    if (trace_event_get_state(TRACE_USB_CLEAR_DEVICE_FEATURE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)feature, (uint64_t)ret };
+        trace_ring_record(TRACE_USB_CLEAR_DEVICE_FEATURE, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_set_device_feature(int addr, int feature, int ret)
 {
+    if (trace_event_get_state(TRACE_USB_SET_DEVICE_FEATURE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)feature, (uint64_t)ret };
+        trace_ring_record(TRACE_USB_SET_DEVICE_FEATURE, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_hub_reset(int addr)
 {
+    if (trace_event_get_state(TRACE_USB_HUB_RESET)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_USB_HUB_RESET, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_hub_control(int addr, int request, int value, int index, int length)
 {
+    if (trace_event_get_state(TRACE_USB_HUB_CONTROL)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)request, (uint64_t)value, (uint64_t)index, (uint64_t)length };
+        trace_ring_record(TRACE_USB_HUB_CONTROL, args, 5, NULL);
+    }
 }
 
 static inline void trace_usb_hub_get_port_status(int addr, int nr, int status, int changed)
 {
+    if (trace_event_get_state(TRACE_USB_HUB_GET_PORT_STATUS)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)nr, (uint64_t)status, (uint64_t)changed };
+        trace_ring_record(TRACE_USB_HUB_GET_PORT_STATUS, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_hub_set_port_feature(int addr, int nr, const char * f)
 {
+    if (trace_event_get_state(TRACE_USB_HUB_SET_PORT_FEATURE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)nr, (uintptr_t)f };
+        trace_ring_record(TRACE_USB_HUB_SET_PORT_FEATURE, args, 3, f);
+    }
 }
 
 static inline void trace_usb_hub_clear_port_feature(int addr, int nr, const char * f)
 {
+    if (trace_event_get_state(TRACE_USB_HUB_CLEAR_PORT_FEATURE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)nr, (uintptr_t)f };
+        trace_ring_record(TRACE_USB_HUB_CLEAR_PORT_FEATURE, args, 3, f);
+    }
 }
 
 static inline void trace_usb_hub_attach(int addr, int nr)
 {
+    if (trace_event_get_state(TRACE_USB_HUB_ATTACH)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)nr };
+        trace_ring_record(TRACE_USB_HUB_ATTACH, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_hub_detach(int addr, int nr)
 {
+    if (trace_event_get_state(TRACE_USB_HUB_DETACH)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)nr };
+        trace_ring_record(TRACE_USB_HUB_DETACH, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_hub_status_report(int addr, int status)
 {
+    if (trace_event_get_state(TRACE_USB_HUB_STATUS_REPORT)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)status };
+        trace_ring_record(TRACE_USB_HUB_STATUS_REPORT, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uas_reset(int addr)
 {
+    if (trace_event_get_state(TRACE_USB_UAS_RESET)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_USB_UAS_RESET, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_uas_command(int addr, uint16_t tag, int lun, uint32_t lun64_1, uint32_t lun64_2)
 {
+    if (trace_event_get_state(TRACE_USB_UAS_COMMAND)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)tag, (uint64_t)lun, (uint64_t)lun64_1, (uint64_t)lun64_2 };
+        trace_ring_record(TRACE_USB_UAS_COMMAND, args, 5, NULL);
+    }
 }
 
 static inline void trace_usb_uas_response(int addr, uint16_t tag, uint8_t code)
 {
+    if (trace_event_get_state(TRACE_USB_UAS_RESPONSE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)tag, (uint64_t)code };
+        trace_ring_record(TRACE_USB_UAS_RESPONSE, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_uas_sense(int addr, uint16_t tag, uint8_t status)
 {
+    if (trace_event_get_state(TRACE_USB_UAS_SENSE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)tag, (uint64_t)status };
+        trace_ring_record(TRACE_USB_UAS_SENSE, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_uas_read_ready(int addr, uint16_t tag)
 {
+    if (trace_event_get_state(TRACE_USB_UAS_READ_READY)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)tag };
+        trace_ring_record(TRACE_USB_UAS_READ_READY, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uas_write_ready(int addr, uint16_t tag)
 {
+    if (trace_event_get_state(TRACE_USB_UAS_WRITE_READY)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)tag };
+        trace_ring_record(TRACE_USB_UAS_WRITE_READY, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_uas_xfer_data(int addr, uint16_t tag, uint32_t copy, uint32_t uoff, uint32_t usize, uint32_t soff, uint32_t ssize)
 {
+    if (trace_event_get_state(TRACE_USB_UAS_XFER_DATA)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)tag, (uint64_t)copy, (uint64_t)uoff, (uint64_t)usize, (uint64_t)soff, (uint64_t)ssize };
+        trace_ring_record(TRACE_USB_UAS_XFER_DATA, args, 7, NULL);
+    }
 }
 
 static inline void trace_usb_uas_scsi_data(int addr, uint16_t tag, uint32_t bytes)
 {
+    if (trace_event_get_state(TRACE_USB_UAS_SCSI_DATA)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)tag, (uint64_t)bytes };
+        trace_ring_record(TRACE_USB_UAS_SCSI_DATA, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_uas_scsi_complete(int addr, uint16_t tag, uint32_t status, uint32_t resid)
 {
+    if (trace_event_get_state(TRACE_USB_UAS_SCSI_COMPLETE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)tag, (uint64_t)status, (uint64_t)resid };
+        trace_ring_record(TRACE_USB_UAS_SCSI_COMPLETE, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_uas_tmf_abort_task(int addr, uint16_t tag, uint16_t task_tag)
 {
+    if (trace_event_get_state(TRACE_USB_UAS_TMF_ABORT_TASK)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)tag, (uint64_t)task_tag };
+        trace_ring_record(TRACE_USB_UAS_TMF_ABORT_TASK, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_uas_tmf_logical_unit_reset(int addr, uint16_t tag, int lun)
 {
+    if (trace_event_get_state(TRACE_USB_UAS_TMF_LOGICAL_UNIT_RESET)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)tag, (uint64_t)lun };
+        trace_ring_record(TRACE_USB_UAS_TMF_LOGICAL_UNIT_RESET, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_uas_tmf_unsupported(int addr, uint16_t tag, uint32_t function)
 {
+    if (trace_event_get_state(TRACE_USB_UAS_TMF_UNSUPPORTED)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)tag, (uint64_t)function };
+        trace_ring_record(TRACE_USB_UAS_TMF_UNSUPPORTED, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_mtp_reset(int addr)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_RESET)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_USB_MTP_RESET, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_mtp_command(int dev, uint16_t code, uint32_t trans, uint32_t arg0, uint32_t arg1, uint32_t arg2, uint32_t arg3, uint32_t arg4)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_COMMAND)) {
+        uint64_t args[] = { (uint64_t)dev, (uint64_t)code, (uint64_t)trans, (uint64_t)arg0, (uint64_t)arg1, (uint64_t)arg2, (uint64_t)arg3, (uint64_t)arg4 };
+        trace_ring_record(TRACE_USB_MTP_COMMAND, args, 8, NULL);
+    }
 }
 
 static inline void trace_usb_mtp_success(int dev, uint32_t trans, uint32_t arg0, uint32_t arg1)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_SUCCESS)) {
+        uint64_t args[] = { (uint64_t)dev, (uint64_t)trans, (uint64_t)arg0, (uint64_t)arg1 };
+        trace_ring_record(TRACE_USB_MTP_SUCCESS, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_mtp_error(int dev, uint16_t code, uint32_t trans, uint32_t arg0, uint32_t arg1)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_ERROR)) {
+        uint64_t args[] = { (uint64_t)dev, (uint64_t)code, (uint64_t)trans, (uint64_t)arg0, (uint64_t)arg1 };
+        trace_ring_record(TRACE_USB_MTP_ERROR, args, 5, NULL);
+    }
 }
 
 static inline void trace_usb_mtp_data_in(int dev, uint32_t trans, uint32_t len)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_DATA_IN)) {
+        uint64_t args[] = { (uint64_t)dev, (uint64_t)trans, (uint64_t)len };
+        trace_ring_record(TRACE_USB_MTP_DATA_IN, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_mtp_xfer(int dev, uint32_t ep, uint32_t dlen, uint32_t plen)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_XFER)) {
+        uint64_t args[] = { (uint64_t)dev, (uint64_t)ep, (uint64_t)dlen, (uint64_t)plen };
+        trace_ring_record(TRACE_USB_MTP_XFER, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_mtp_nak(int dev, uint32_t ep)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_NAK)) {
+        uint64_t args[] = { (uint64_t)dev, (uint64_t)ep };
+        trace_ring_record(TRACE_USB_MTP_NAK, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_mtp_stall(int dev, const char * reason)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_STALL)) {
+        uint64_t args[] = { (uint64_t)dev, (uintptr_t)reason };
+        trace_ring_record(TRACE_USB_MTP_STALL, args, 2, reason);
+    }
 }
 
 static inline void trace_usb_mtp_op_get_device_info(int dev)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_OP_GET_DEVICE_INFO)) {
+        uint64_t args[] = { (uint64_t)dev };
+        trace_ring_record(TRACE_USB_MTP_OP_GET_DEVICE_INFO, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_mtp_op_open_session(int dev)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_OP_OPEN_SESSION)) {
+        uint64_t args[] = { (uint64_t)dev };
+        trace_ring_record(TRACE_USB_MTP_OP_OPEN_SESSION, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_mtp_op_close_session(int dev)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_OP_CLOSE_SESSION)) {
+        uint64_t args[] = { (uint64_t)dev };
+        trace_ring_record(TRACE_USB_MTP_OP_CLOSE_SESSION, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_mtp_op_get_storage_ids(int dev)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_OP_GET_STORAGE_IDS)) {
+        uint64_t args[] = { (uint64_t)dev };
+        trace_ring_record(TRACE_USB_MTP_OP_GET_STORAGE_IDS, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_mtp_op_get_storage_info(int dev)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_OP_GET_STORAGE_INFO)) {
+        uint64_t args[] = { (uint64_t)dev };
+        trace_ring_record(TRACE_USB_MTP_OP_GET_STORAGE_INFO, args, 1, NULL);
+    }
 }
 
 static inline void trace_usb_mtp_op_get_num_objects(int dev, uint32_t handle, const char * path)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_OP_GET_NUM_OBJECTS)) {
+        uint64_t args[] = { (uint64_t)dev, (uint64_t)handle, (uintptr_t)path };
+        trace_ring_record(TRACE_USB_MTP_OP_GET_NUM_OBJECTS, args, 3, path);
+    }
 }
 
 static inline void trace_usb_mtp_op_get_object_handles(int dev, uint32_t handle, const char * path)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_OP_GET_OBJECT_HANDLES)) {
+        uint64_t args[] = { (uint64_t)dev, (uint64_t)handle, (uintptr_t)path };
+        trace_ring_record(TRACE_USB_MTP_OP_GET_OBJECT_HANDLES, args, 3, path);
+    }
 }
 
 static inline void trace_usb_mtp_op_get_object_info(int dev, uint32_t handle, const char * path)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_OP_GET_OBJECT_INFO)) {
+        uint64_t args[] = { (uint64_t)dev, (uint64_t)handle, (uintptr_t)path };
+        trace_ring_record(TRACE_USB_MTP_OP_GET_OBJECT_INFO, args, 3, path);
+    }
 }
 
 static inline void trace_usb_mtp_op_get_object(int dev, uint32_t handle, const char * path)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_OP_GET_OBJECT)) {
+        uint64_t args[] = { (uint64_t)dev, (uint64_t)handle, (uintptr_t)path };
+        trace_ring_record(TRACE_USB_MTP_OP_GET_OBJECT, args, 3, path);
+    }
 }
 
 static inline void trace_usb_mtp_op_get_partial_object(int dev, uint32_t handle, const char * path, uint32_t offset, uint32_t length)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_OP_GET_PARTIAL_OBJECT)) {
+        uint64_t args[] = { (uint64_t)dev, (uint64_t)handle, (uintptr_t)path, (uint64_t)offset, (uint64_t)length };
+        trace_ring_record(TRACE_USB_MTP_OP_GET_PARTIAL_OBJECT, args, 5, path);
+    }
 }
 
 static inline void trace_usb_mtp_op_unknown(int dev, uint32_t code)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_OP_UNKNOWN)) {
+        uint64_t args[] = { (uint64_t)dev, (uint64_t)code };
+        trace_ring_record(TRACE_USB_MTP_OP_UNKNOWN, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_mtp_object_alloc(int dev, uint32_t handle, const char * path)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_OBJECT_ALLOC)) {
+        uint64_t args[] = { (uint64_t)dev, (uint64_t)handle, (uintptr_t)path };
+        trace_ring_record(TRACE_USB_MTP_OBJECT_ALLOC, args, 3, path);
+    }
 }
 
 static inline void trace_usb_mtp_object_free(int dev, uint32_t handle, const char * path)
 {
+    if (trace_event_get_state(TRACE_USB_MTP_OBJECT_FREE)) {
+        uint64_t args[] = { (uint64_t)dev, (uint64_t)handle, (uintptr_t)path };
+        trace_ring_record(TRACE_USB_MTP_OBJECT_FREE, args, 3, path);
+    }
 }
 
 static inline void trace_usb_host_open_started(int bus, int addr)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_OPEN_STARTED)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr };
+        trace_ring_record(TRACE_USB_HOST_OPEN_STARTED, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_host_open_success(int bus, int addr)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_OPEN_SUCCESS)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr };
+        trace_ring_record(TRACE_USB_HOST_OPEN_SUCCESS, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_host_open_failure(int bus, int addr)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_OPEN_FAILURE)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr };
+        trace_ring_record(TRACE_USB_HOST_OPEN_FAILURE, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_host_close(int bus, int addr)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_CLOSE)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr };
+        trace_ring_record(TRACE_USB_HOST_CLOSE, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_host_attach_kernel(int bus, int addr, int interface)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_ATTACH_KERNEL)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uint64_t)interface };
+        trace_ring_record(TRACE_USB_HOST_ATTACH_KERNEL, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_host_detach_kernel(int bus, int addr, int interface)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_DETACH_KERNEL)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uint64_t)interface };
+        trace_ring_record(TRACE_USB_HOST_DETACH_KERNEL, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_host_set_address(int bus, int addr, int config)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_SET_ADDRESS)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uint64_t)config };
+        trace_ring_record(TRACE_USB_HOST_SET_ADDRESS, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_host_set_config(int bus, int addr, int config)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_SET_CONFIG)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uint64_t)config };
+        trace_ring_record(TRACE_USB_HOST_SET_CONFIG, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_host_set_interface(int bus, int addr, int interface, int alt)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_SET_INTERFACE)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uint64_t)interface, (uint64_t)alt };
+        trace_ring_record(TRACE_USB_HOST_SET_INTERFACE, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_host_claim_interface(int bus, int addr, int config, int interface)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_CLAIM_INTERFACE)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uint64_t)config, (uint64_t)interface };
+        trace_ring_record(TRACE_USB_HOST_CLAIM_INTERFACE, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_host_release_interface(int bus, int addr, int interface)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_RELEASE_INTERFACE)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uint64_t)interface };
+        trace_ring_record(TRACE_USB_HOST_RELEASE_INTERFACE, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_host_req_control(int bus, int addr, void * p, int req, int value, int index)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_REQ_CONTROL)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uintptr_t)p, (uint64_t)req, (uint64_t)value, (uint64_t)index };
+        trace_ring_record(TRACE_USB_HOST_REQ_CONTROL, args, 6, NULL);
+    }
 }
 
 static inline void trace_usb_host_req_data(int bus, int addr, void * p, int in, int ep, int size)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_REQ_DATA)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uintptr_t)p, (uint64_t)in, (uint64_t)ep, (uint64_t)size };
+        trace_ring_record(TRACE_USB_HOST_REQ_DATA, args, 6, NULL);
+    }
 }
 
 static inline void trace_usb_host_req_complete(int bus, int addr, void * p, int status, int length)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_REQ_COMPLETE)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uintptr_t)p, (uint64_t)status, (uint64_t)length };
+        trace_ring_record(TRACE_USB_HOST_REQ_COMPLETE, args, 5, NULL);
+    }
 }
 
 static inline void trace_usb_host_req_emulated(int bus, int addr, void * p, int status)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_REQ_EMULATED)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uintptr_t)p, (uint64_t)status };
+        trace_ring_record(TRACE_USB_HOST_REQ_EMULATED, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_host_req_canceled(int bus, int addr, void * p)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_REQ_CANCELED)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uintptr_t)p };
+        trace_ring_record(TRACE_USB_HOST_REQ_CANCELED, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_host_iso_start(int bus, int addr, int ep)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_ISO_START)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uint64_t)ep };
+        trace_ring_record(TRACE_USB_HOST_ISO_START, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_host_iso_stop(int bus, int addr, int ep)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_ISO_STOP)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uint64_t)ep };
+        trace_ring_record(TRACE_USB_HOST_ISO_STOP, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_host_iso_out_of_bufs(int bus, int addr, int ep)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_ISO_OUT_OF_BUFS)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uint64_t)ep };
+        trace_ring_record(TRACE_USB_HOST_ISO_OUT_OF_BUFS, args, 3, NULL);
+    }
 }
 
 static inline void trace_usb_host_reset(int bus, int addr)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_RESET)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr };
+        trace_ring_record(TRACE_USB_HOST_RESET, args, 2, NULL);
+    }
 }
 
 static inline void trace_usb_host_auto_scan_enabled(void)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_AUTO_SCAN_ENABLED)) {
+        trace_ring_record(TRACE_USB_HOST_AUTO_SCAN_ENABLED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_host_auto_scan_disabled(void)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_AUTO_SCAN_DISABLED)) {
+        trace_ring_record(TRACE_USB_HOST_AUTO_SCAN_DISABLED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_usb_host_parse_config(int bus, int addr, int value, int active)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_PARSE_CONFIG)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uint64_t)value, (uint64_t)active };
+        trace_ring_record(TRACE_USB_HOST_PARSE_CONFIG, args, 4, NULL);
+    }
 }
 
 static inline void trace_usb_host_parse_interface(int bus, int addr, int num, int alt, int active)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_PARSE_INTERFACE)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uint64_t)num, (uint64_t)alt, (uint64_t)active };
+        trace_ring_record(TRACE_USB_HOST_PARSE_INTERFACE, args, 5, NULL);
+    }
 }
 
 static inline void trace_usb_host_parse_endpoint(int bus, int addr, int ep, const char * dir, const char * type, int active)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_PARSE_ENDPOINT)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uint64_t)ep, (uintptr_t)dir, (uintptr_t)type, (uint64_t)active };
+        trace_ring_record(TRACE_USB_HOST_PARSE_ENDPOINT, args, 6, dir);
+    }
 }
 
 static inline void trace_usb_host_parse_error(int bus, int addr, const char * errmsg)
 {
+    if (trace_event_get_state(TRACE_USB_HOST_PARSE_ERROR)) {
+        uint64_t args[] = { (uint64_t)bus, (uint64_t)addr, (uintptr_t)errmsg };
+        trace_ring_record(TRACE_USB_HOST_PARSE_ERROR, args, 3, errmsg);
+    }
 }
 
 static inline void trace_scsi_req_alloc(int target, int lun, int tag)
 {
+    if (trace_event_get_state(TRACE_SCSI_REQ_ALLOC)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)tag };
+        trace_ring_record(TRACE_SCSI_REQ_ALLOC, args, 3, NULL);
+    }
 }
 
 static inline void trace_scsi_req_cancel(int target, int lun, int tag)
 {
+    if (trace_event_get_state(TRACE_SCSI_REQ_CANCEL)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)tag };
+        trace_ring_record(TRACE_SCSI_REQ_CANCEL, args, 3, NULL);
+    }
 }
 
 static inline void trace_scsi_req_data(int target, int lun, int tag, int len)
 {
+    if (trace_event_get_state(TRACE_SCSI_REQ_DATA)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)tag, (uint64_t)len };
+        trace_ring_record(TRACE_SCSI_REQ_DATA, args, 4, NULL);
+    }
 }
 
 static inline void trace_scsi_req_data_canceled(int target, int lun, int tag, int len)
 {
+    if (trace_event_get_state(TRACE_SCSI_REQ_DATA_CANCELED)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)tag, (uint64_t)len };
+        trace_ring_record(TRACE_SCSI_REQ_DATA_CANCELED, args, 4, NULL);
+    }
 }
 
 static inline void trace_scsi_req_dequeue(int target, int lun, int tag)
 {
+    if (trace_event_get_state(TRACE_SCSI_REQ_DEQUEUE)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)tag };
+        trace_ring_record(TRACE_SCSI_REQ_DEQUEUE, args, 3, NULL);
+    }
 }
 
 static inline void trace_scsi_req_continue(int target, int lun, int tag)
 {
+    if (trace_event_get_state(TRACE_SCSI_REQ_CONTINUE)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)tag };
+        trace_ring_record(TRACE_SCSI_REQ_CONTINUE, args, 3, NULL);
+    }
 }
 
 static inline void trace_scsi_req_continue_canceled(int target, int lun, int tag)
 {
+    if (trace_event_get_state(TRACE_SCSI_REQ_CONTINUE_CANCELED)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)tag };
+        trace_ring_record(TRACE_SCSI_REQ_CONTINUE_CANCELED, args, 3, NULL);
+    }
 }
 
 static inline void trace_scsi_req_parsed(int target, int lun, int tag, int cmd, int mode, int xfer)
 {
+    if (trace_event_get_state(TRACE_SCSI_REQ_PARSED)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)tag, (uint64_t)cmd, (uint64_t)mode, (uint64_t)xfer };
+        trace_ring_record(TRACE_SCSI_REQ_PARSED, args, 6, NULL);
+    }
 }
 
 static inline void trace_scsi_req_parsed_lba(int target, int lun, int tag, int cmd, uint64_t lba)
 {
+    if (trace_event_get_state(TRACE_SCSI_REQ_PARSED_LBA)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)tag, (uint64_t)cmd, (uint64_t)lba };
+        trace_ring_record(TRACE_SCSI_REQ_PARSED_LBA, args, 5, NULL);
+    }
 }
 
 static inline void trace_scsi_req_parse_bad(int target, int lun, int tag, int cmd)
 {
+    if (trace_event_get_state(TRACE_SCSI_REQ_PARSE_BAD)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)tag, (uint64_t)cmd };
+        trace_ring_record(TRACE_SCSI_REQ_PARSE_BAD, args, 4, NULL);
+    }
 }
 
 static inline void trace_scsi_req_build_sense(int target, int lun, int tag, int key, int asc, int ascq)
 {
+    if (trace_event_get_state(TRACE_SCSI_REQ_BUILD_SENSE)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)tag, (uint64_t)key, (uint64_t)asc, (uint64_t)ascq };
+        trace_ring_record(TRACE_SCSI_REQ_BUILD_SENSE, args, 6, NULL);
+    }
 }
 
 static inline void trace_scsi_device_set_ua(int target, int lun, int key, int asc, int ascq)
 {
+    if (trace_event_get_state(TRACE_SCSI_DEVICE_SET_UA)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)key, (uint64_t)asc, (uint64_t)ascq };
+        trace_ring_record(TRACE_SCSI_DEVICE_SET_UA, args, 5, NULL);
+    }
 }
 
 static inline void trace_scsi_report_luns(int target, int lun, int tag)
 {
+    if (trace_event_get_state(TRACE_SCSI_REPORT_LUNS)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)tag };
+        trace_ring_record(TRACE_SCSI_REPORT_LUNS, args, 3, NULL);
+    }
 }
 
 static inline void trace_scsi_inquiry(int target, int lun, int tag, int cdb1, int cdb2)
 {
+    if (trace_event_get_state(TRACE_SCSI_INQUIRY)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)tag, (uint64_t)cdb1, (uint64_t)cdb2 };
+        trace_ring_record(TRACE_SCSI_INQUIRY, args, 5, NULL);
+    }
 }
 
 static inline void trace_scsi_test_unit_ready(int target, int lun, int tag)
 {
+    if (trace_event_get_state(TRACE_SCSI_TEST_UNIT_READY)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)tag };
+        trace_ring_record(TRACE_SCSI_TEST_UNIT_READY, args, 3, NULL);
+    }
 }
 
 static inline void trace_scsi_request_sense(int target, int lun, int tag)
 {
+    if (trace_event_get_state(TRACE_SCSI_REQUEST_SENSE)) {
+        uint64_t args[] = { (uint64_t)target, (uint64_t)lun, (uint64_t)tag };
+        trace_ring_record(TRACE_SCSI_REQUEST_SENSE, args, 3, NULL);
+    }
 }
 
 static inline void trace_vm_state_notify(int running, int reason)
 {
+    if (trace_event_get_state(TRACE_VM_STATE_NOTIFY)) {
+        uint64_t args[] = { (uint64_t)running, (uint64_t)reason };
+        trace_ring_record(TRACE_VM_STATE_NOTIFY, args, 2, NULL);
+    }
 }
 
 static inline void trace_load_file(const char * name, const char * path)
 {
+    if (trace_event_get_state(TRACE_LOAD_FILE)) {
+        uint64_t args[] = { (uintptr_t)name, (uintptr_t)path };
+        trace_ring_record(TRACE_LOAD_FILE, args, 2, name);
+    }
 }
 
 static inline void trace_runstate_set(int new_state)
 {
+    if (trace_event_get_state(TRACE_RUNSTATE_SET)) {
+        uint64_t args[] = { (uint64_t)new_state };
+        trace_ring_record(TRACE_RUNSTATE_SET, args, 1, NULL);
+    }
 }
 
 static inline void trace_g_malloc(size_t size, void * ptr)
 {
+    if (trace_event_get_state(TRACE_G_MALLOC)) {
+        uint64_t args[] = { (uint64_t)size, (uintptr_t)ptr };
+        trace_ring_record(TRACE_G_MALLOC, args, 2, NULL);
+    }
 }
 
 static inline void trace_g_realloc(void * ptr, size_t size, void * newptr)
 {
+    if (trace_event_get_state(TRACE_G_REALLOC)) {
+        uint64_t args[] = { (uintptr_t)ptr, (uint64_t)size, (uintptr_t)newptr };
+        trace_ring_record(TRACE_G_REALLOC, args, 3, NULL);
+    }
 }
 
 static inline void trace_g_free(void * ptr)
 {
+    if (trace_event_get_state(TRACE_G_FREE)) {
+        uint64_t args[] = { (uintptr_t)ptr };
+        trace_ring_record(TRACE_G_FREE, args, 1, NULL);
+    }
 }
 
 static inline void trace_system_wakeup_request(int reason)
 {
+    if (trace_event_get_state(TRACE_SYSTEM_WAKEUP_REQUEST)) {
+        uint64_t args[] = { (uint64_t)reason };
+        trace_ring_record(TRACE_SYSTEM_WAKEUP_REQUEST, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_system_shutdown_request(void)
 {
+    if (trace_event_get_state(TRACE_QEMU_SYSTEM_SHUTDOWN_REQUEST)) {
+        trace_ring_record(TRACE_QEMU_SYSTEM_SHUTDOWN_REQUEST, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_qemu_system_powerdown_request(void)
 {
+    if (trace_event_get_state(TRACE_QEMU_SYSTEM_POWERDOWN_REQUEST)) {
+        trace_ring_record(TRACE_QEMU_SYSTEM_POWERDOWN_REQUEST, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_qcow2_writev_start_req(void * co, int64_t sector, int nb_sectors)
 {
+    if (trace_event_get_state(TRACE_QCOW2_WRITEV_START_REQ)) {
+        uint64_t args[] = { (uintptr_t)co, (uint64_t)sector, (uint64_t)nb_sectors };
+        trace_ring_record(TRACE_QCOW2_WRITEV_START_REQ, args, 3, NULL);
+    }
 }
 
 static inline void trace_qcow2_writev_done_req(void * co, int ret)
 {
+    if (trace_event_get_state(TRACE_QCOW2_WRITEV_DONE_REQ)) {
+        uint64_t args[] = { (uintptr_t)co, (uint64_t)ret };
+        trace_ring_record(TRACE_QCOW2_WRITEV_DONE_REQ, args, 2, NULL);
+    }
 }
 
 static inline void trace_qcow2_writev_start_part(void * co)
 {
+    if (trace_event_get_state(TRACE_QCOW2_WRITEV_START_PART)) {
+        uint64_t args[] = { (uintptr_t)co };
+        trace_ring_record(TRACE_QCOW2_WRITEV_START_PART, args, 1, NULL);
+    }
 }
 
 static inline void trace_qcow2_writev_done_part(void * co, int cur_nr_sectors)
 {
+    if (trace_event_get_state(TRACE_QCOW2_WRITEV_DONE_PART)) {
+        uint64_t args[] = { (uintptr_t)co, (uint64_t)cur_nr_sectors };
+        trace_ring_record(TRACE_QCOW2_WRITEV_DONE_PART, args, 2, NULL);
+    }
 }
 
 static inline void trace_qcow2_writev_data(void * co, uint64_t offset)
 {
+    if (trace_event_get_state(TRACE_QCOW2_WRITEV_DATA)) {
+        uint64_t args[] = { (uintptr_t)co, (uint64_t)offset };
+        trace_ring_record(TRACE_QCOW2_WRITEV_DATA, args, 2, NULL);
+    }
 }
 
 static inline void trace_qcow2_alloc_clusters_offset(void * co, uint64_t offset, int num)
 {
+    if (trace_event_get_state(TRACE_QCOW2_ALLOC_CLUSTERS_OFFSET)) {
+        uint64_t args[] = { (uintptr_t)co, (uint64_t)offset, (uint64_t)num };
+        trace_ring_record(TRACE_QCOW2_ALLOC_CLUSTERS_OFFSET, args, 3, NULL);
+    }
 }
 
 static inline void trace_qcow2_handle_copied(void * co, uint64_t guest_offset, uint64_t host_offset, uint64_t bytes)
 {
+    if (trace_event_get_state(TRACE_QCOW2_HANDLE_COPIED)) {
+        uint64_t args[] = { (uintptr_t)co, (uint64_t)guest_offset, (uint64_t)host_offset, (uint64_t)bytes };
+        trace_ring_record(TRACE_QCOW2_HANDLE_COPIED, args, 4, NULL);
+    }
 }
 
 static inline void trace_qcow2_handle_alloc(void * co, uint64_t guest_offset, uint64_t host_offset, uint64_t bytes)
 {
+    if (trace_event_get_state(TRACE_QCOW2_HANDLE_ALLOC)) {
+        uint64_t args[] = { (uintptr_t)co, (uint64_t)guest_offset, (uint64_t)host_offset, (uint64_t)bytes };
+        trace_ring_record(TRACE_QCOW2_HANDLE_ALLOC, args, 4, NULL);
+    }
 }
 
 static inline void trace_qcow2_do_alloc_clusters_offset(void * co, uint64_t guest_offset, uint64_t host_offset, int nb_clusters)
 {
+    if (trace_event_get_state(TRACE_QCOW2_DO_ALLOC_CLUSTERS_OFFSET)) {
+        uint64_t args[] = { (uintptr_t)co, (uint64_t)guest_offset, (uint64_t)host_offset, (uint64_t)nb_clusters };
+        trace_ring_record(TRACE_QCOW2_DO_ALLOC_CLUSTERS_OFFSET, args, 4, NULL);
+    }
 }
 
 static inline void trace_qcow2_cluster_alloc_phys(void * co)
 {
+    if (trace_event_get_state(TRACE_QCOW2_CLUSTER_ALLOC_PHYS)) {
+        uint64_t args[] = { (uintptr_t)co };
+        trace_ring_record(TRACE_QCOW2_CLUSTER_ALLOC_PHYS, args, 1, NULL);
+    }
 }
 
 static inline void trace_qcow2_cluster_link_l2(void * co, int nb_clusters)
 {
+    if (trace_event_get_state(TRACE_QCOW2_CLUSTER_LINK_L2)) {
+        uint64_t args[] = { (uintptr_t)co, (uint64_t)nb_clusters };
+        trace_ring_record(TRACE_QCOW2_CLUSTER_LINK_L2, args, 2, NULL);
+    }
 }
 
 static inline void trace_qcow2_l2_allocate(void * bs, int l1_index)
 {
+    if (trace_event_get_state(TRACE_QCOW2_L2_ALLOCATE)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)l1_index };
+        trace_ring_record(TRACE_QCOW2_L2_ALLOCATE, args, 2, NULL);
+    }
 }
 
 static inline void trace_qcow2_l2_allocate_get_empty(void * bs, int l1_index)
 {
+    if (trace_event_get_state(TRACE_QCOW2_L2_ALLOCATE_GET_EMPTY)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)l1_index };
+        trace_ring_record(TRACE_QCOW2_L2_ALLOCATE_GET_EMPTY, args, 2, NULL);
+    }
 }
 
 static inline void trace_qcow2_l2_allocate_write_l2(void * bs, int l1_index)
 {
+    if (trace_event_get_state(TRACE_QCOW2_L2_ALLOCATE_WRITE_L2)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)l1_index };
+        trace_ring_record(TRACE_QCOW2_L2_ALLOCATE_WRITE_L2, args, 2, NULL);
+    }
 }
 
 static inline void trace_qcow2_l2_allocate_write_l1(void * bs, int l1_index)
 {
+    if (trace_event_get_state(TRACE_QCOW2_L2_ALLOCATE_WRITE_L1)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)l1_index };
+        trace_ring_record(TRACE_QCOW2_L2_ALLOCATE_WRITE_L1, args, 2, NULL);
+    }
 }
 
 static inline void trace_qcow2_l2_allocate_done(void * bs, int l1_index, int ret)
 {
+    if (trace_event_get_state(TRACE_QCOW2_L2_ALLOCATE_DONE)) {
+        uint64_t args[] = { (uintptr_t)bs, (uint64_t)l1_index, (uint64_t)ret };
+        trace_ring_record(TRACE_QCOW2_L2_ALLOCATE_DONE, args, 3, NULL);
+    }
 }
 
 static inline void trace_qcow2_cache_get(void * co, int c, uint64_t offset, bool read_from_disk)
 {
+    if (trace_event_get_state(TRACE_QCOW2_CACHE_GET)) {
+        uint64_t args[] = { (uintptr_t)co, (uint64_t)c, (uint64_t)offset, (uint64_t)read_from_disk };
+        trace_ring_record(TRACE_QCOW2_CACHE_GET, args, 4, NULL);
+    }
 }
 
 static inline void trace_qcow2_cache_get_replace_entry(void * co, int c, int i)
 {
+    if (trace_event_get_state(TRACE_QCOW2_CACHE_GET_REPLACE_ENTRY)) {
+        uint64_t args[] = { (uintptr_t)co, (uint64_t)c, (uint64_t)i };
+        trace_ring_record(TRACE_QCOW2_CACHE_GET_REPLACE_ENTRY, args, 3, NULL);
+    }
 }
 
 static inline void trace_qcow2_cache_get_read(void * co, int c, int i)
 {
+    if (trace_event_get_state(TRACE_QCOW2_CACHE_GET_READ)) {
+        uint64_t args[] = { (uintptr_t)co, (uint64_t)c, (uint64_t)i };
+        trace_ring_record(TRACE_QCOW2_CACHE_GET_READ, args, 3, NULL);
+    }
 }
 
 static inline void trace_qcow2_cache_get_done(void * co, int c, int i)
 {
+    if (trace_event_get_state(TRACE_QCOW2_CACHE_GET_DONE)) {
+        uint64_t args[] = { (uintptr_t)co, (uint64_t)c, (uint64_t)i };
+        trace_ring_record(TRACE_QCOW2_CACHE_GET_DONE, args, 3, NULL);
+    }
 }
 
 static inline void trace_qcow2_cache_flush(void * co, int c)
 {
+    if (trace_event_get_state(TRACE_QCOW2_CACHE_FLUSH)) {
+        uint64_t args[] = { (uintptr_t)co, (uint64_t)c };
+        trace_ring_record(TRACE_QCOW2_CACHE_FLUSH, args, 2, NULL);
+    }
 }
 
 static inline void trace_qcow2_cache_entry_flush(void * co, int c, int i)
 {
+    if (trace_event_get_state(TRACE_QCOW2_CACHE_ENTRY_FLUSH)) {
+        uint64_t args[] = { (uintptr_t)co, (uint64_t)c, (uint64_t)i };
+        trace_ring_record(TRACE_QCOW2_CACHE_ENTRY_FLUSH, args, 3, NULL);
+    }
 }
 
 static inline void trace_qed_alloc_l2_cache_entry(void * l2_cache, void * entry)
 {
+    if (trace_event_get_state(TRACE_QED_ALLOC_L2_CACHE_ENTRY)) {
+        uint64_t args[] = { (uintptr_t)l2_cache, (uintptr_t)entry };
+        trace_ring_record(TRACE_QED_ALLOC_L2_CACHE_ENTRY, args, 2, NULL);
+    }
 }
 
 static inline void trace_qed_unref_l2_cache_entry(void * entry, int ref)
 {
+    if (trace_event_get_state(TRACE_QED_UNREF_L2_CACHE_ENTRY)) {
+        uint64_t args[] = { (uintptr_t)entry, (uint64_t)ref };
+        trace_ring_record(TRACE_QED_UNREF_L2_CACHE_ENTRY, args, 2, NULL);
+    }
 }
 
 static inline void trace_qed_find_l2_cache_entry(void * l2_cache, void * entry, uint64_t offset, int ref)
 {
+    if (trace_event_get_state(TRACE_QED_FIND_L2_CACHE_ENTRY)) {
+        uint64_t args[] = { (uintptr_t)l2_cache, (uintptr_t)entry, (uint64_t)offset, (uint64_t)ref };
+        trace_ring_record(TRACE_QED_FIND_L2_CACHE_ENTRY, args, 4, NULL);
+    }
 }
 
 static inline void trace_qed_read_table(void * s, uint64_t offset, void * table)
 {
+    if (trace_event_get_state(TRACE_QED_READ_TABLE)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)offset, (uintptr_t)table };
+        trace_ring_record(TRACE_QED_READ_TABLE, args, 3, NULL);
+    }
 }
 
 static inline void trace_qed_read_table_cb(void * s, void * table, int ret)
 {
+    if (trace_event_get_state(TRACE_QED_READ_TABLE_CB)) {
+        uint64_t args[] = { (uintptr_t)s, (uintptr_t)table, (uint64_t)ret };
+        trace_ring_record(TRACE_QED_READ_TABLE_CB, args, 3, NULL);
+    }
 }
 
 static inline void trace_qed_write_table(void * s, uint64_t offset, void * table, unsigned int index, unsigned int n)
 {
+    if (trace_event_get_state(TRACE_QED_WRITE_TABLE)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)offset, (uintptr_t)table, (uint64_t)index, (uint64_t)n };
+        trace_ring_record(TRACE_QED_WRITE_TABLE, args, 5, NULL);
+    }
 }
 
 static inline void trace_qed_write_table_cb(void * s, void * table, int flush, int ret)
 {
+    if (trace_event_get_state(TRACE_QED_WRITE_TABLE_CB)) {
+        uint64_t args[] = { (uintptr_t)s, (uintptr_t)table, (uint64_t)flush, (uint64_t)ret };
+        trace_ring_record(TRACE_QED_WRITE_TABLE_CB, args, 4, NULL);
+    }
 }
 
 static inline void trace_qed_need_check_timer_cb(void * s)
 {
+    if (trace_event_get_state(TRACE_QED_NEED_CHECK_TIMER_CB)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_QED_NEED_CHECK_TIMER_CB, args, 1, NULL);
+    }
 }
 
 static inline void trace_qed_start_need_check_timer(void * s)
 {
+    if (trace_event_get_state(TRACE_QED_START_NEED_CHECK_TIMER)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_QED_START_NEED_CHECK_TIMER, args, 1, NULL);
+    }
 }
 
 static inline void trace_qed_cancel_need_check_timer(void * s)
 {
+    if (trace_event_get_state(TRACE_QED_CANCEL_NEED_CHECK_TIMER)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_QED_CANCEL_NEED_CHECK_TIMER, args, 1, NULL);
+    }
 }
 
 static inline void trace_qed_aio_complete(void * s, void * acb, int ret)
 {
+    if (trace_event_get_state(TRACE_QED_AIO_COMPLETE)) {
+        uint64_t args[] = { (uintptr_t)s, (uintptr_t)acb, (uint64_t)ret };
+        trace_ring_record(TRACE_QED_AIO_COMPLETE, args, 3, NULL);
+    }
 }
 
 static inline void trace_qed_aio_setup(void * s, void * acb, int64_t sector_num, int nb_sectors, void * opaque, int flags)
 {
+    if (trace_event_get_state(TRACE_QED_AIO_SETUP)) {
+        uint64_t args[] = { (uintptr_t)s, (uintptr_t)acb, (uint64_t)sector_num, (uint64_t)nb_sectors, (uintptr_t)opaque, (uint64_t)flags };
+        trace_ring_record(TRACE_QED_AIO_SETUP, args, 6, NULL);
+    }
 }
 
 static inline void trace_qed_aio_next_io(void * s, void * acb, int ret, uint64_t cur_pos)
 {
+    if (trace_event_get_state(TRACE_QED_AIO_NEXT_IO)) {
+        uint64_t args[] = { (uintptr_t)s, (uintptr_t)acb, (uint64_t)ret, (uint64_t)cur_pos };
+        trace_ring_record(TRACE_QED_AIO_NEXT_IO, args, 4, NULL);
+    }
 }
 
 static inline void trace_qed_aio_read_data(void * s, void * acb, int ret, uint64_t offset, size_t len)
 {
+    if (trace_event_get_state(TRACE_QED_AIO_READ_DATA)) {
+        uint64_t args[] = { (uintptr_t)s, (uintptr_t)acb, (uint64_t)ret, (uint64_t)offset, (uint64_t)len };
+        trace_ring_record(TRACE_QED_AIO_READ_DATA, args, 5, NULL);
+    }
 }
 
 static inline void trace_qed_aio_write_data(void * s, void * acb, int ret, uint64_t offset, size_t len)
 {
+    if (trace_event_get_state(TRACE_QED_AIO_WRITE_DATA)) {
+        uint64_t args[] = { (uintptr_t)s, (uintptr_t)acb, (uint64_t)ret, (uint64_t)offset, (uint64_t)len };
+        trace_ring_record(TRACE_QED_AIO_WRITE_DATA, args, 5, NULL);
+    }
 }
 
 static inline void trace_qed_aio_write_prefill(void * s, void * acb, uint64_t start, size_t len, uint64_t offset)
 {
+    if (trace_event_get_state(TRACE_QED_AIO_WRITE_PREFILL)) {
+        uint64_t args[] = { (uintptr_t)s, (uintptr_t)acb, (uint64_t)start, (uint64_t)len, (uint64_t)offset };
+        trace_ring_record(TRACE_QED_AIO_WRITE_PREFILL, args, 5, NULL);
+    }
 }
 
 static inline void trace_qed_aio_write_postfill(void * s, void * acb, uint64_t start, size_t len, uint64_t offset)
 {
+    if (trace_event_get_state(TRACE_QED_AIO_WRITE_POSTFILL)) {
+        uint64_t args[] = { (uintptr_t)s, (uintptr_t)acb, (uint64_t)start, (uint64_t)len, (uint64_t)offset };
+        trace_ring_record(TRACE_QED_AIO_WRITE_POSTFILL, args, 5, NULL);
+    }
 }
 
 static inline void trace_qed_aio_write_main(void * s, void * acb, int ret, uint64_t offset, size_t len)
 {
+    if (trace_event_get_state(TRACE_QED_AIO_WRITE_MAIN)) {
+        uint64_t args[] = { (uintptr_t)s, (uintptr_t)acb, (uint64_t)ret, (uint64_t)offset, (uint64_t)len };
+        trace_ring_record(TRACE_QED_AIO_WRITE_MAIN, args, 5, NULL);
+    }
 }
 
 static inline void trace_g364fb_read(uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_G364FB_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_G364FB_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_g364fb_write(uint64_t addr, uint32_t new)
 {
+    if (trace_event_get_state(TRACE_G364FB_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)new };
+        trace_ring_record(TRACE_G364FB_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_grlib_gptimer_enable(int id, uint32_t count)
 {
+    if (trace_event_get_state(TRACE_GRLIB_GPTIMER_ENABLE)) {
+        uint64_t args[] = { (uint64_t)id, (uint64_t)count };
+        trace_ring_record(TRACE_GRLIB_GPTIMER_ENABLE, args, 2, NULL);
+    }
 }
 
 static inline void trace_grlib_gptimer_disabled(int id, uint32_t config)
 {
+    if (trace_event_get_state(TRACE_GRLIB_GPTIMER_DISABLED)) {
+        uint64_t args[] = { (uint64_t)id, (uint64_t)config };
+        trace_ring_record(TRACE_GRLIB_GPTIMER_DISABLED, args, 2, NULL);
+    }
 }
 
 static inline void trace_grlib_gptimer_restart(int id, uint32_t reload)
 {
+    if (trace_event_get_state(TRACE_GRLIB_GPTIMER_RESTART)) {
+        uint64_t args[] = { (uint64_t)id, (uint64_t)reload };
+        trace_ring_record(TRACE_GRLIB_GPTIMER_RESTART, args, 2, NULL);
+    }
 }
 
 static inline void trace_grlib_gptimer_set_scaler(uint32_t scaler, uint32_t freq)
 {
+    if (trace_event_get_state(TRACE_GRLIB_GPTIMER_SET_SCALER)) {
+        uint64_t args[] = { (uint64_t)scaler, (uint64_t)freq };
+        trace_ring_record(TRACE_GRLIB_GPTIMER_SET_SCALER, args, 2, NULL);
+    }
 }
 
 static inline void trace_grlib_gptimer_hit(int id)
 {
+    if (trace_event_get_state(TRACE_GRLIB_GPTIMER_HIT)) {
+        uint64_t args[] = { (uint64_t)id };
+        trace_ring_record(TRACE_GRLIB_GPTIMER_HIT, args, 1, NULL);
+    }
 }
 
 static inline void trace_grlib_gptimer_readl(int id, uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_GRLIB_GPTIMER_READL)) {
+        uint64_t args[] = { (uint64_t)id, (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_GRLIB_GPTIMER_READL, args, 3, NULL);
+    }
 }
 
 static inline void trace_grlib_gptimer_writel(int id, uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_GRLIB_GPTIMER_WRITEL)) {
+        uint64_t args[] = { (uint64_t)id, (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_GRLIB_GPTIMER_WRITEL, args, 3, NULL);
+    }
 }
 
 static inline void trace_grlib_irqmp_check_irqs(uint32_t pend, uint32_t force, uint32_t mask, uint32_t lvl1, uint32_t lvl2)
 {
+    if (trace_event_get_state(TRACE_GRLIB_IRQMP_CHECK_IRQS)) {
+        uint64_t args[] = { (uint64_t)pend, (uint64_t)force, (uint64_t)mask, (uint64_t)lvl1, (uint64_t)lvl2 };
+        trace_ring_record(TRACE_GRLIB_IRQMP_CHECK_IRQS, args, 5, NULL);
+    }
 }
 
 static inline void trace_grlib_irqmp_ack(int intno)
 {
+    if (trace_event_get_state(TRACE_GRLIB_IRQMP_ACK)) {
+        uint64_t args[] = { (uint64_t)intno };
+        trace_ring_record(TRACE_GRLIB_IRQMP_ACK, args, 1, NULL);
+    }
 }
 
 static inline void trace_grlib_irqmp_set_irq(int irq)
 {
+    if (trace_event_get_state(TRACE_GRLIB_IRQMP_SET_IRQ)) {
+        uint64_t args[] = { (uint64_t)irq };
+        trace_ring_record(TRACE_GRLIB_IRQMP_SET_IRQ, args, 1, NULL);
+    }
 }
 
 static inline void trace_grlib_irqmp_readl_unknown(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_GRLIB_IRQMP_READL_UNKNOWN)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_GRLIB_IRQMP_READL_UNKNOWN, args, 1, NULL);
+    }
 }
 
 static inline void trace_grlib_irqmp_writel_unknown(uint64_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_GRLIB_IRQMP_WRITEL_UNKNOWN)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_GRLIB_IRQMP_WRITEL_UNKNOWN, args, 2, NULL);
+    }
 }
 
 static inline void trace_grlib_apbuart_event(int event)
 {
+    if (trace_event_get_state(TRACE_GRLIB_APBUART_EVENT)) {
+        uint64_t args[] = { (uint64_t)event };
+        trace_ring_record(TRACE_GRLIB_APBUART_EVENT, args, 1, NULL);
+    }
 }
 
 static inline void trace_grlib_apbuart_writel_unknown(uint64_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_GRLIB_APBUART_WRITEL_UNKNOWN)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_GRLIB_APBUART_WRITEL_UNKNOWN, args, 2, NULL);
+    }
 }
 
 static inline void trace_grlib_apbuart_readl_unknown(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_GRLIB_APBUART_READL_UNKNOWN)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_GRLIB_APBUART_READL_UNKNOWN, args, 1, NULL);
+    }
 }
 
 static inline void trace_leon3_set_irq(int intno)
 {
+    if (trace_event_get_state(TRACE_LEON3_SET_IRQ)) {
+        uint64_t args[] = { (uint64_t)intno };
+        trace_ring_record(TRACE_LEON3_SET_IRQ, args, 1, NULL);
+    }
 }
 
 static inline void trace_leon3_reset_irq(int intno)
 {
+    if (trace_event_get_state(TRACE_LEON3_RESET_IRQ)) {
+        uint64_t args[] = { (uint64_t)intno };
+        trace_ring_record(TRACE_LEON3_RESET_IRQ, args, 1, NULL);
+    }
 }
 
 static inline void trace_spice_vmc_write(ssize_t out, int len)
 {
+    if (trace_event_get_state(TRACE_SPICE_VMC_WRITE)) {
+        uint64_t args[] = { (uint64_t)out, (uint64_t)len };
+        trace_ring_record(TRACE_SPICE_VMC_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_spice_vmc_read(int bytes, int len)
 {
+    if (trace_event_get_state(TRACE_SPICE_VMC_READ)) {
+        uint64_t args[] = { (uint64_t)bytes, (uint64_t)len };
+        trace_ring_record(TRACE_SPICE_VMC_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_spice_vmc_register_interface(void * scd)
 {
+    if (trace_event_get_state(TRACE_SPICE_VMC_REGISTER_INTERFACE)) {
+        uint64_t args[] = { (uintptr_t)scd };
+        trace_ring_record(TRACE_SPICE_VMC_REGISTER_INTERFACE, args, 1, NULL);
+    }
 }
 
 static inline void trace_spice_vmc_unregister_interface(void * scd)
 {
+    if (trace_event_get_state(TRACE_SPICE_VMC_UNREGISTER_INTERFACE)) {
+        uint64_t args[] = { (uintptr_t)scd };
+        trace_ring_record(TRACE_SPICE_VMC_UNREGISTER_INTERFACE, args, 1, NULL);
+    }
 }
 
 static inline void trace_spice_vmc_event(int event)
 {
+    if (trace_event_get_state(TRACE_SPICE_VMC_EVENT)) {
+        uint64_t args[] = { (uint64_t)event };
+        trace_ring_record(TRACE_SPICE_VMC_EVENT, args, 1, NULL);
+    }
 }
 
 static inline void trace_lm32_pic_raise_irq(void)
 {
+    if (trace_event_get_state(TRACE_LM32_PIC_RAISE_IRQ)) {
+        trace_ring_record(TRACE_LM32_PIC_RAISE_IRQ, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_lm32_pic_lower_irq(void)
 {
+    if (trace_event_get_state(TRACE_LM32_PIC_LOWER_IRQ)) {
+        trace_ring_record(TRACE_LM32_PIC_LOWER_IRQ, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_lm32_pic_interrupt(int irq, int level)
 {
+    if (trace_event_get_state(TRACE_LM32_PIC_INTERRUPT)) {
+        uint64_t args[] = { (uint64_t)irq, (uint64_t)level };
+        trace_ring_record(TRACE_LM32_PIC_INTERRUPT, args, 2, NULL);
+    }
 }
 
 static inline void trace_lm32_pic_set_im(uint32_t im)
 {
+    if (trace_event_get_state(TRACE_LM32_PIC_SET_IM)) {
+        uint64_t args[] = { (uint64_t)im };
+        trace_ring_record(TRACE_LM32_PIC_SET_IM, args, 1, NULL);
+    }
 }
 
 static inline void trace_lm32_pic_set_ip(uint32_t ip)
 {
+    if (trace_event_get_state(TRACE_LM32_PIC_SET_IP)) {
+        uint64_t args[] = { (uint64_t)ip };
+        trace_ring_record(TRACE_LM32_PIC_SET_IP, args, 1, NULL);
+    }
 }
 
 static inline void trace_lm32_pic_get_im(uint32_t im)
 {
+    if (trace_event_get_state(TRACE_LM32_PIC_GET_IM)) {
+        uint64_t args[] = { (uint64_t)im };
+        trace_ring_record(TRACE_LM32_PIC_GET_IM, args, 1, NULL);
+    }
 }
 
 static inline void trace_lm32_pic_get_ip(uint32_t ip)
 {
+    if (trace_event_get_state(TRACE_LM32_PIC_GET_IP)) {
+        uint64_t args[] = { (uint64_t)ip };
+        trace_ring_record(TRACE_LM32_PIC_GET_IP, args, 1, NULL);
+    }
 }
 
 static inline void trace_lm32_juart_get_jtx(uint32_t value)
 {
+    if (trace_event_get_state(TRACE_LM32_JUART_GET_JTX)) {
+        uint64_t args[] = { (uint64_t)value };
+        trace_ring_record(TRACE_LM32_JUART_GET_JTX, args, 1, NULL);
+    }
 }
 
 static inline void trace_lm32_juart_set_jtx(uint32_t value)
 {
+    if (trace_event_get_state(TRACE_LM32_JUART_SET_JTX)) {
+        uint64_t args[] = { (uint64_t)value };
+        trace_ring_record(TRACE_LM32_JUART_SET_JTX, args, 1, NULL);
+    }
 }
 
 static inline void trace_lm32_juart_get_jrx(uint32_t value)
 {
+    if (trace_event_get_state(TRACE_LM32_JUART_GET_JRX)) {
+        uint64_t args[] = { (uint64_t)value };
+        trace_ring_record(TRACE_LM32_JUART_GET_JRX, args, 1, NULL);
+    }
 }
 
 static inline void trace_lm32_juart_set_jrx(uint32_t value)
 {
+    if (trace_event_get_state(TRACE_LM32_JUART_SET_JRX)) {
+        uint64_t args[] = { (uint64_t)value };
+        trace_ring_record(TRACE_LM32_JUART_SET_JRX, args, 1, NULL);
+    }
 }
 
 static inline void trace_lm32_timer_memory_write(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_LM32_TIMER_MEMORY_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_LM32_TIMER_MEMORY_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_lm32_timer_memory_read(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_LM32_TIMER_MEMORY_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_LM32_TIMER_MEMORY_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_lm32_timer_hit(void)
 {
+    if (trace_event_get_state(TRACE_LM32_TIMER_HIT)) {
+        trace_ring_record(TRACE_LM32_TIMER_HIT, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_lm32_timer_irq_state(int level)
 {
+    if (trace_event_get_state(TRACE_LM32_TIMER_IRQ_STATE)) {
+        uint64_t args[] = { (uint64_t)level };
+        trace_ring_record(TRACE_LM32_TIMER_IRQ_STATE, args, 1, NULL);
+    }
 }
 
 static inline void trace_lm32_uart_memory_write(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_LM32_UART_MEMORY_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_LM32_UART_MEMORY_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_lm32_uart_memory_read(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_LM32_UART_MEMORY_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_LM32_UART_MEMORY_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_lm32_uart_irq_state(int level)
 {
+    if (trace_event_get_state(TRACE_LM32_UART_IRQ_STATE)) {
+        uint64_t args[] = { (uint64_t)level };
+        trace_ring_record(TRACE_LM32_UART_IRQ_STATE, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_init_firmware(uint64_t pa)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_INIT_FIRMWARE)) {
+        uint64_t args[] = { (uint64_t)pa };
+        trace_ring_record(TRACE_MEGASAS_INIT_FIRMWARE, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_init_queue(uint64_t queue_pa, int queue_len, uint64_t head, uint64_t tail, uint32_t flags)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_INIT_QUEUE)) {
+        uint64_t args[] = { (uint64_t)queue_pa, (uint64_t)queue_len, (uint64_t)head, (uint64_t)tail, (uint64_t)flags };
+        trace_ring_record(TRACE_MEGASAS_INIT_QUEUE, args, 5, NULL);
+    }
 }
 
 static inline void trace_megasas_initq_map_failed(int frame)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_INITQ_MAP_FAILED)) {
+        uint64_t args[] = { (uint64_t)frame };
+        trace_ring_record(TRACE_MEGASAS_INITQ_MAP_FAILED, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_initq_mapped(uint64_t pa)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_INITQ_MAPPED)) {
+        uint64_t args[] = { (uint64_t)pa };
+        trace_ring_record(TRACE_MEGASAS_INITQ_MAPPED, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_initq_mismatch(int queue_len, int fw_cmds)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_INITQ_MISMATCH)) {
+        uint64_t args[] = { (uint64_t)queue_len, (uint64_t)fw_cmds };
+        trace_ring_record(TRACE_MEGASAS_INITQ_MISMATCH, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_qf_mapped(unsigned int index)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_QF_MAPPED)) {
+        uint64_t args[] = { (uint64_t)index };
+        trace_ring_record(TRACE_MEGASAS_QF_MAPPED, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_qf_new(unsigned int index, uint64_t frame)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_QF_NEW)) {
+        uint64_t args[] = { (uint64_t)index, (uint64_t)frame };
+        trace_ring_record(TRACE_MEGASAS_QF_NEW, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_qf_busy(unsigned long pa)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_QF_BUSY)) {
+        uint64_t args[] = { (uint64_t)pa };
+        trace_ring_record(TRACE_MEGASAS_QF_BUSY, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_qf_enqueue(unsigned int index, unsigned int count, uint64_t context, unsigned int head, unsigned int tail, int busy)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_QF_ENQUEUE)) {
+        uint64_t args[] = { (uint64_t)index, (uint64_t)count, (uint64_t)context, (uint64_t)head, (uint64_t)tail, (uint64_t)busy };
+        trace_ring_record(TRACE_MEGASAS_QF_ENQUEUE, args, 6, NULL);
+    }
 }
 
 static inline void trace_megasas_qf_update(unsigned int head, unsigned int tail, unsigned int busy)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_QF_UPDATE)) {
+        uint64_t args[] = { (uint64_t)head, (uint64_t)tail, (uint64_t)busy };
+        trace_ring_record(TRACE_MEGASAS_QF_UPDATE, args, 3, NULL);
+    }
 }
 
 static inline void trace_megasas_qf_map_failed(int cmd, unsigned long frame)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_QF_MAP_FAILED)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)frame };
+        trace_ring_record(TRACE_MEGASAS_QF_MAP_FAILED, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_qf_complete_noirq(uint64_t context)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_QF_COMPLETE_NOIRQ)) {
+        uint64_t args[] = { (uint64_t)context };
+        trace_ring_record(TRACE_MEGASAS_QF_COMPLETE_NOIRQ, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_qf_complete(uint64_t context, unsigned int head, unsigned int tail, int busy)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_QF_COMPLETE)) {
+        uint64_t args[] = { (uint64_t)context, (uint64_t)head, (uint64_t)tail, (uint64_t)busy };
+        trace_ring_record(TRACE_MEGASAS_QF_COMPLETE, args, 4, NULL);
+    }
 }
 
 static inline void trace_megasas_frame_busy(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_FRAME_BUSY)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_MEGASAS_FRAME_BUSY, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_unhandled_frame_cmd(int cmd, uint8_t frame_cmd)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_UNHANDLED_FRAME_CMD)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)frame_cmd };
+        trace_ring_record(TRACE_MEGASAS_UNHANDLED_FRAME_CMD, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_handle_scsi(const char * frame, int bus, int dev, int lun, void * sdev, unsigned long size)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_HANDLE_SCSI)) {
+        uint64_t args[] = { (uintptr_t)frame, (uint64_t)bus, (uint64_t)dev, (uint64_t)lun, (uintptr_t)sdev, (uint64_t)size };
+        trace_ring_record(TRACE_MEGASAS_HANDLE_SCSI, args, 6, frame);
+    }
 }
 
 static inline void trace_megasas_scsi_target_not_present(const char * frame, int bus, int dev, int lun)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_SCSI_TARGET_NOT_PRESENT)) {
+        uint64_t args[] = { (uintptr_t)frame, (uint64_t)bus, (uint64_t)dev, (uint64_t)lun };
+        trace_ring_record(TRACE_MEGASAS_SCSI_TARGET_NOT_PRESENT, args, 4, frame);
+    }
 }
 
 static inline void trace_megasas_scsi_invalid_cdb_len(const char * frame, int bus, int dev, int lun, int len)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_SCSI_INVALID_CDB_LEN)) {
+        uint64_t args[] = { (uintptr_t)frame, (uint64_t)bus, (uint64_t)dev, (uint64_t)lun, (uint64_t)len };
+        trace_ring_record(TRACE_MEGASAS_SCSI_INVALID_CDB_LEN, args, 5, frame);
+    }
 }
 
 static inline void trace_megasas_iov_read_overflow(int cmd, int bytes, int len)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_IOV_READ_OVERFLOW)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)bytes, (uint64_t)len };
+        trace_ring_record(TRACE_MEGASAS_IOV_READ_OVERFLOW, args, 3, NULL);
+    }
 }
 
 static inline void trace_megasas_iov_write_overflow(int cmd, int bytes, int len)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_IOV_WRITE_OVERFLOW)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)bytes, (uint64_t)len };
+        trace_ring_record(TRACE_MEGASAS_IOV_WRITE_OVERFLOW, args, 3, NULL);
+    }
 }
 
 static inline void trace_megasas_iov_read_underflow(int cmd, int bytes, int len)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_IOV_READ_UNDERFLOW)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)bytes, (uint64_t)len };
+        trace_ring_record(TRACE_MEGASAS_IOV_READ_UNDERFLOW, args, 3, NULL);
+    }
 }
 
 static inline void trace_megasas_iov_write_underflow(int cmd, int bytes, int len)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_IOV_WRITE_UNDERFLOW)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)bytes, (uint64_t)len };
+        trace_ring_record(TRACE_MEGASAS_IOV_WRITE_UNDERFLOW, args, 3, NULL);
+    }
 }
 
 static inline void trace_megasas_scsi_req_alloc_failed(const char * frame, int dev, int lun)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_SCSI_REQ_ALLOC_FAILED)) {
+        uint64_t args[] = { (uintptr_t)frame, (uint64_t)dev, (uint64_t)lun };
+        trace_ring_record(TRACE_MEGASAS_SCSI_REQ_ALLOC_FAILED, args, 3, frame);
+    }
 }
 
 static inline void trace_megasas_scsi_read_start(int cmd, int len)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_SCSI_READ_START)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)len };
+        trace_ring_record(TRACE_MEGASAS_SCSI_READ_START, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_scsi_write_start(int cmd, int len)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_SCSI_WRITE_START)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)len };
+        trace_ring_record(TRACE_MEGASAS_SCSI_WRITE_START, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_scsi_nodata(int cmd)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_SCSI_NODATA)) {
+        uint64_t args[] = { (uint64_t)cmd };
+        trace_ring_record(TRACE_MEGASAS_SCSI_NODATA, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_scsi_complete(int cmd, uint32_t status, int len, int xfer)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_SCSI_COMPLETE)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)status, (uint64_t)len, (uint64_t)xfer };
+        trace_ring_record(TRACE_MEGASAS_SCSI_COMPLETE, args, 4, NULL);
+    }
 }
 
 static inline void trace_megasas_command_complete(int cmd, uint32_t status, uint32_t resid)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_COMMAND_COMPLETE)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)status, (uint64_t)resid };
+        trace_ring_record(TRACE_MEGASAS_COMMAND_COMPLETE, args, 3, NULL);
+    }
 }
 
 static inline void trace_megasas_handle_io(int cmd, const char * frame, int dev, int lun, unsigned long lba, unsigned long count)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_HANDLE_IO)) {
+        uint64_t args[] = { (uint64_t)cmd, (uintptr_t)frame, (uint64_t)dev, (uint64_t)lun, (uint64_t)lba, (uint64_t)count };
+        trace_ring_record(TRACE_MEGASAS_HANDLE_IO, args, 6, frame);
+    }
 }
 
 static inline void trace_megasas_io_target_not_present(int cmd, const char * frame, int dev, int lun)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_IO_TARGET_NOT_PRESENT)) {
+        uint64_t args[] = { (uint64_t)cmd, (uintptr_t)frame, (uint64_t)dev, (uint64_t)lun };
+        trace_ring_record(TRACE_MEGASAS_IO_TARGET_NOT_PRESENT, args, 4, frame);
+    }
 }
 
 static inline void trace_megasas_io_read_start(int cmd, unsigned long lba, unsigned long count, unsigned long len)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_IO_READ_START)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)lba, (uint64_t)count, (uint64_t)len };
+        trace_ring_record(TRACE_MEGASAS_IO_READ_START, args, 4, NULL);
+    }
 }
 
 static inline void trace_megasas_io_write_start(int cmd, unsigned long lba, unsigned long count, unsigned long len)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_IO_WRITE_START)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)lba, (uint64_t)count, (uint64_t)len };
+        trace_ring_record(TRACE_MEGASAS_IO_WRITE_START, args, 4, NULL);
+    }
 }
 
 static inline void trace_megasas_io_complete(int cmd, uint32_t len)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_IO_COMPLETE)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)len };
+        trace_ring_record(TRACE_MEGASAS_IO_COMPLETE, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_iovec_sgl_overflow(int cmd, int index, int limit)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_IOVEC_SGL_OVERFLOW)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)index, (uint64_t)limit };
+        trace_ring_record(TRACE_MEGASAS_IOVEC_SGL_OVERFLOW, args, 3, NULL);
+    }
 }
 
 static inline void trace_megasas_iovec_sgl_underflow(int cmd, int index)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_IOVEC_SGL_UNDERFLOW)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)index };
+        trace_ring_record(TRACE_MEGASAS_IOVEC_SGL_UNDERFLOW, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_iovec_sgl_invalid(int cmd, int index, uint64_t pa, uint32_t len)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_IOVEC_SGL_INVALID)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)index, (uint64_t)pa, (uint64_t)len };
+        trace_ring_record(TRACE_MEGASAS_IOVEC_SGL_INVALID, args, 4, NULL);
+    }
 }
 
 static inline void trace_megasas_iovec_overflow(int cmd, int len, int limit)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_IOVEC_OVERFLOW)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)len, (uint64_t)limit };
+        trace_ring_record(TRACE_MEGASAS_IOVEC_OVERFLOW, args, 3, NULL);
+    }
 }
 
 static inline void trace_megasas_iovec_underflow(int cmd, int len, int limit)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_IOVEC_UNDERFLOW)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)len, (uint64_t)limit };
+        trace_ring_record(TRACE_MEGASAS_IOVEC_UNDERFLOW, args, 3, NULL);
+    }
 }
 
 static inline void trace_megasas_handle_dcmd(int cmd, int opcode)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_HANDLE_DCMD)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)opcode };
+        trace_ring_record(TRACE_MEGASAS_HANDLE_DCMD, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_finish_dcmd(int cmd, int size)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_FINISH_DCMD)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)size };
+        trace_ring_record(TRACE_MEGASAS_FINISH_DCMD, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_req_alloc_failed(int cmd, const char * desc)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_REQ_ALLOC_FAILED)) {
+        uint64_t args[] = { (uint64_t)cmd, (uintptr_t)desc };
+        trace_ring_record(TRACE_MEGASAS_DCMD_REQ_ALLOC_FAILED, args, 2, desc);
+    }
 }
 
 static inline void trace_megasas_dcmd_internal_submit(int cmd, const char * desc, int dev)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_INTERNAL_SUBMIT)) {
+        uint64_t args[] = { (uint64_t)cmd, (uintptr_t)desc, (uint64_t)dev };
+        trace_ring_record(TRACE_MEGASAS_DCMD_INTERNAL_SUBMIT, args, 3, desc);
+    }
 }
 
 static inline void trace_megasas_dcmd_internal_finish(int cmd, int opcode, int lun)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_INTERNAL_FINISH)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)opcode, (uint64_t)lun };
+        trace_ring_record(TRACE_MEGASAS_DCMD_INTERNAL_FINISH, args, 3, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_internal_invalid(int cmd, int opcode)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_INTERNAL_INVALID)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)opcode };
+        trace_ring_record(TRACE_MEGASAS_DCMD_INTERNAL_INVALID, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_unhandled(int cmd, int opcode, int len)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_UNHANDLED)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)opcode, (uint64_t)len };
+        trace_ring_record(TRACE_MEGASAS_DCMD_UNHANDLED, args, 3, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_zero_sge(int cmd)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_ZERO_SGE)) {
+        uint64_t args[] = { (uint64_t)cmd };
+        trace_ring_record(TRACE_MEGASAS_DCMD_ZERO_SGE, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_invalid_sge(int cmd, int count)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_INVALID_SGE)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)count };
+        trace_ring_record(TRACE_MEGASAS_DCMD_INVALID_SGE, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_invalid_xfer_len(int cmd, unsigned long size, unsigned long max)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_INVALID_XFER_LEN)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)size, (uint64_t)max };
+        trace_ring_record(TRACE_MEGASAS_DCMD_INVALID_XFER_LEN, args, 3, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_enter(int cmd, const char * dcmd, int len)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_ENTER)) {
+        uint64_t args[] = { (uint64_t)cmd, (uintptr_t)dcmd, (uint64_t)len };
+        trace_ring_record(TRACE_MEGASAS_DCMD_ENTER, args, 3, dcmd);
+    }
 }
 
 static inline void trace_megasas_dcmd_dummy(int cmd, unsigned long size)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_DUMMY)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)size };
+        trace_ring_record(TRACE_MEGASAS_DCMD_DUMMY, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_set_fw_time(int cmd, unsigned long time)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_SET_FW_TIME)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)time };
+        trace_ring_record(TRACE_MEGASAS_DCMD_SET_FW_TIME, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_pd_get_list(int cmd, int num, int max, int offset)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_PD_GET_LIST)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)num, (uint64_t)max, (uint64_t)offset };
+        trace_ring_record(TRACE_MEGASAS_DCMD_PD_GET_LIST, args, 4, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_ld_get_list(int cmd, int num, int max)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_LD_GET_LIST)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)num, (uint64_t)max };
+        trace_ring_record(TRACE_MEGASAS_DCMD_LD_GET_LIST, args, 3, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_ld_get_info(int cmd, int ld_id)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_LD_GET_INFO)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)ld_id };
+        trace_ring_record(TRACE_MEGASAS_DCMD_LD_GET_INFO, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_ld_list_query(int cmd, int flags)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_LD_LIST_QUERY)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)flags };
+        trace_ring_record(TRACE_MEGASAS_DCMD_LD_LIST_QUERY, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_pd_get_info(int cmd, int pd_id)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_PD_GET_INFO)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)pd_id };
+        trace_ring_record(TRACE_MEGASAS_DCMD_PD_GET_INFO, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_pd_list_query(int cmd, int flags)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_PD_LIST_QUERY)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)flags };
+        trace_ring_record(TRACE_MEGASAS_DCMD_PD_LIST_QUERY, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_reset_ld(int cmd, int target_id)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_RESET_LD)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)target_id };
+        trace_ring_record(TRACE_MEGASAS_DCMD_RESET_LD, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_dcmd_unsupported(int cmd, unsigned long size)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_DCMD_UNSUPPORTED)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)size };
+        trace_ring_record(TRACE_MEGASAS_DCMD_UNSUPPORTED, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_abort_frame(int cmd, int abort_cmd)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_ABORT_FRAME)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)abort_cmd };
+        trace_ring_record(TRACE_MEGASAS_ABORT_FRAME, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_abort_no_cmd(int cmd, uint64_t context)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_ABORT_NO_CMD)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)context };
+        trace_ring_record(TRACE_MEGASAS_ABORT_NO_CMD, args, 2, NULL);
+    }
 }
 
 static inline void trace_megasas_abort_invalid_context(int cmd, uint64_t context, int abort_cmd)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_ABORT_INVALID_CONTEXT)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)context, (uint64_t)abort_cmd };
+        trace_ring_record(TRACE_MEGASAS_ABORT_INVALID_CONTEXT, args, 3, NULL);
+    }
 }
 
 static inline void trace_megasas_reset(int fw_state)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_RESET)) {
+        uint64_t args[] = { (uint64_t)fw_state };
+        trace_ring_record(TRACE_MEGASAS_RESET, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_init(int sges, int cmds, const char * mode)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_INIT)) {
+        uint64_t args[] = { (uint64_t)sges, (uint64_t)cmds, (uintptr_t)mode };
+        trace_ring_record(TRACE_MEGASAS_INIT, args, 3, mode);
+    }
 }
 
 static inline void trace_megasas_msix_raise(int vector)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_MSIX_RAISE)) {
+        uint64_t args[] = { (uint64_t)vector };
+        trace_ring_record(TRACE_MEGASAS_MSIX_RAISE, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_msi_raise(int vector)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_MSI_RAISE)) {
+        uint64_t args[] = { (uint64_t)vector };
+        trace_ring_record(TRACE_MEGASAS_MSI_RAISE, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_irq_lower(void)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_IRQ_LOWER)) {
+        trace_ring_record(TRACE_MEGASAS_IRQ_LOWER, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_megasas_irq_raise(void)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_IRQ_RAISE)) {
+        trace_ring_record(TRACE_MEGASAS_IRQ_RAISE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_megasas_intr_enabled(void)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_INTR_ENABLED)) {
+        trace_ring_record(TRACE_MEGASAS_INTR_ENABLED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_megasas_intr_disabled(void)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_INTR_DISABLED)) {
+        trace_ring_record(TRACE_MEGASAS_INTR_DISABLED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_megasas_msix_enabled(int vector)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_MSIX_ENABLED)) {
+        uint64_t args[] = { (uint64_t)vector };
+        trace_ring_record(TRACE_MEGASAS_MSIX_ENABLED, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_msi_enabled(int vector)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_MSI_ENABLED)) {
+        uint64_t args[] = { (uint64_t)vector };
+        trace_ring_record(TRACE_MEGASAS_MSI_ENABLED, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_mmio_readl(const char * reg, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_MMIO_READL)) {
+        uint64_t args[] = { (uintptr_t)reg, (uint64_t)val };
+        trace_ring_record(TRACE_MEGASAS_MMIO_READL, args, 2, reg);
+    }
 }
 
 static inline void trace_megasas_mmio_invalid_readl(unsigned long addr)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_MMIO_INVALID_READL)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_MEGASAS_MMIO_INVALID_READL, args, 1, NULL);
+    }
 }
 
 static inline void trace_megasas_mmio_writel(const char * reg, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_MMIO_WRITEL)) {
+        uint64_t args[] = { (uintptr_t)reg, (uint64_t)val };
+        trace_ring_record(TRACE_MEGASAS_MMIO_WRITEL, args, 2, reg);
+    }
 }
 
 static inline void trace_megasas_mmio_invalid_writel(uint32_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_MEGASAS_MMIO_INVALID_WRITEL)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_MEGASAS_MMIO_INVALID_WRITEL, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_ac97_memory_read(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_AC97_MEMORY_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_AC97_MEMORY_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_ac97_memory_write(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_AC97_MEMORY_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_AC97_MEMORY_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_ac97_pulse_irq_crrequest(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_AC97_PULSE_IRQ_CRREQUEST)) {
+        trace_ring_record(TRACE_MILKYMIST_AC97_PULSE_IRQ_CRREQUEST, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_ac97_pulse_irq_crreply(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_AC97_PULSE_IRQ_CRREPLY)) {
+        trace_ring_record(TRACE_MILKYMIST_AC97_PULSE_IRQ_CRREPLY, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_ac97_pulse_irq_dmaw(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_AC97_PULSE_IRQ_DMAW)) {
+        trace_ring_record(TRACE_MILKYMIST_AC97_PULSE_IRQ_DMAW, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_ac97_pulse_irq_dmar(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_AC97_PULSE_IRQ_DMAR)) {
+        trace_ring_record(TRACE_MILKYMIST_AC97_PULSE_IRQ_DMAR, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_ac97_in_cb(int avail, uint32_t remaining)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_AC97_IN_CB)) {
+        uint64_t args[] = { (uint64_t)avail, (uint64_t)remaining };
+        trace_ring_record(TRACE_MILKYMIST_AC97_IN_CB, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_ac97_in_cb_transferred(int transferred)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_AC97_IN_CB_TRANSFERRED)) {
+        uint64_t args[] = { (uint64_t)transferred };
+        trace_ring_record(TRACE_MILKYMIST_AC97_IN_CB_TRANSFERRED, args, 1, NULL);
+    }
 }
 
 static inline void trace_milkymist_ac97_out_cb(int free, uint32_t remaining)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_AC97_OUT_CB)) {
+        uint64_t args[] = { (uint64_t)free, (uint64_t)remaining };
+        trace_ring_record(TRACE_MILKYMIST_AC97_OUT_CB, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_ac97_out_cb_transferred(int transferred)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_AC97_OUT_CB_TRANSFERRED)) {
+        uint64_t args[] = { (uint64_t)transferred };
+        trace_ring_record(TRACE_MILKYMIST_AC97_OUT_CB_TRANSFERRED, args, 1, NULL);
+    }
 }
 
 static inline void trace_milkymist_hpdmc_memory_read(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_HPDMC_MEMORY_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_HPDMC_MEMORY_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_hpdmc_memory_write(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_HPDMC_MEMORY_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_HPDMC_MEMORY_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_memcard_memory_read(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_MEMCARD_MEMORY_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_MEMCARD_MEMORY_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_memcard_memory_write(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_MEMCARD_MEMORY_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_MEMCARD_MEMORY_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_minimac2_memory_read(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_MINIMAC2_MEMORY_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_MINIMAC2_MEMORY_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_minimac2_memory_write(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_MINIMAC2_MEMORY_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_MINIMAC2_MEMORY_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_minimac2_mdio_write(uint8_t phy_addr, uint8_t addr, uint16_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_MINIMAC2_MDIO_WRITE)) {
+        uint64_t args[] = { (uint64_t)phy_addr, (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_MINIMAC2_MDIO_WRITE, args, 3, NULL);
+    }
 }
 
 static inline void trace_milkymist_minimac2_mdio_read(uint8_t phy_addr, uint8_t addr, uint16_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_MINIMAC2_MDIO_READ)) {
+        uint64_t args[] = { (uint64_t)phy_addr, (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_MINIMAC2_MDIO_READ, args, 3, NULL);
+    }
 }
 
 static inline void trace_milkymist_minimac2_tx_frame(uint32_t length)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_MINIMAC2_TX_FRAME)) {
+        uint64_t args[] = { (uint64_t)length };
+        trace_ring_record(TRACE_MILKYMIST_MINIMAC2_TX_FRAME, args, 1, NULL);
+    }
 }
 
 static inline void trace_milkymist_minimac2_rx_frame(const void * buf, uint32_t length)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_MINIMAC2_RX_FRAME)) {
+        uint64_t args[] = { (uintptr_t)buf, (uint64_t)length };
+        trace_ring_record(TRACE_MILKYMIST_MINIMAC2_RX_FRAME, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_minimac2_drop_rx_frame(const void * buf)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_MINIMAC2_DROP_RX_FRAME)) {
+        uint64_t args[] = { (uintptr_t)buf };
+        trace_ring_record(TRACE_MILKYMIST_MINIMAC2_DROP_RX_FRAME, args, 1, NULL);
+    }
 }
 
 static inline void trace_milkymist_minimac2_rx_transfer(const void * buf, uint32_t length)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_MINIMAC2_RX_TRANSFER)) {
+        uint64_t args[] = { (uintptr_t)buf, (uint64_t)length };
+        trace_ring_record(TRACE_MILKYMIST_MINIMAC2_RX_TRANSFER, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_minimac2_raise_irq_rx(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_MINIMAC2_RAISE_IRQ_RX)) {
+        trace_ring_record(TRACE_MILKYMIST_MINIMAC2_RAISE_IRQ_RX, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_minimac2_lower_irq_rx(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_MINIMAC2_LOWER_IRQ_RX)) {
+        trace_ring_record(TRACE_MILKYMIST_MINIMAC2_LOWER_IRQ_RX, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_minimac2_pulse_irq_tx(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_MINIMAC2_PULSE_IRQ_TX)) {
+        trace_ring_record(TRACE_MILKYMIST_MINIMAC2_PULSE_IRQ_TX, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_pfpu_memory_read(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_PFPU_MEMORY_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_PFPU_MEMORY_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_pfpu_memory_write(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_PFPU_MEMORY_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_PFPU_MEMORY_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_pfpu_vectout(uint32_t a, uint32_t b, uint32_t dma_ptr)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_PFPU_VECTOUT)) {
+        uint64_t args[] = { (uint64_t)a, (uint64_t)b, (uint64_t)dma_ptr };
+        trace_ring_record(TRACE_MILKYMIST_PFPU_VECTOUT, args, 3, NULL);
+    }
 }
 
 static inline void trace_milkymist_pfpu_pulse_irq(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_PFPU_PULSE_IRQ)) {
+        trace_ring_record(TRACE_MILKYMIST_PFPU_PULSE_IRQ, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_softusb_memory_read(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_SOFTUSB_MEMORY_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_SOFTUSB_MEMORY_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_softusb_memory_write(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_SOFTUSB_MEMORY_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_SOFTUSB_MEMORY_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_softusb_mevt(uint8_t m)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_SOFTUSB_MEVT)) {
+        uint64_t args[] = { (uint64_t)m };
+        trace_ring_record(TRACE_MILKYMIST_SOFTUSB_MEVT, args, 1, NULL);
+    }
 }
 
 static inline void trace_milkymist_softusb_kevt(uint8_t m)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_SOFTUSB_KEVT)) {
+        uint64_t args[] = { (uint64_t)m };
+        trace_ring_record(TRACE_MILKYMIST_SOFTUSB_KEVT, args, 1, NULL);
+    }
 }
 
 static inline void trace_milkymist_softusb_pulse_irq(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_SOFTUSB_PULSE_IRQ)) {
+        trace_ring_record(TRACE_MILKYMIST_SOFTUSB_PULSE_IRQ, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_sysctl_memory_read(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_SYSCTL_MEMORY_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_SYSCTL_MEMORY_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_sysctl_memory_write(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_SYSCTL_MEMORY_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_SYSCTL_MEMORY_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_sysctl_icap_write(uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_SYSCTL_ICAP_WRITE)) {
+        uint64_t args[] = { (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_SYSCTL_ICAP_WRITE, args, 1, NULL);
+    }
 }
 
 static inline void trace_milkymist_sysctl_start_timer0(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_SYSCTL_START_TIMER0)) {
+        trace_ring_record(TRACE_MILKYMIST_SYSCTL_START_TIMER0, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_sysctl_stop_timer0(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_SYSCTL_STOP_TIMER0)) {
+        trace_ring_record(TRACE_MILKYMIST_SYSCTL_STOP_TIMER0, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_sysctl_start_timer1(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_SYSCTL_START_TIMER1)) {
+        trace_ring_record(TRACE_MILKYMIST_SYSCTL_START_TIMER1, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_sysctl_stop_timer1(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_SYSCTL_STOP_TIMER1)) {
+        trace_ring_record(TRACE_MILKYMIST_SYSCTL_STOP_TIMER1, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_sysctl_pulse_irq_timer0(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_SYSCTL_PULSE_IRQ_TIMER0)) {
+        trace_ring_record(TRACE_MILKYMIST_SYSCTL_PULSE_IRQ_TIMER0, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_sysctl_pulse_irq_timer1(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_SYSCTL_PULSE_IRQ_TIMER1)) {
+        trace_ring_record(TRACE_MILKYMIST_SYSCTL_PULSE_IRQ_TIMER1, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_tmu2_memory_read(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_TMU2_MEMORY_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_TMU2_MEMORY_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_tmu2_memory_write(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_TMU2_MEMORY_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_TMU2_MEMORY_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_tmu2_start(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_TMU2_START)) {
+        trace_ring_record(TRACE_MILKYMIST_TMU2_START, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_tmu2_pulse_irq(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_TMU2_PULSE_IRQ)) {
+        trace_ring_record(TRACE_MILKYMIST_TMU2_PULSE_IRQ, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_uart_memory_read(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_UART_MEMORY_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_UART_MEMORY_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_uart_memory_write(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_UART_MEMORY_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_UART_MEMORY_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_uart_raise_irq(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_UART_RAISE_IRQ)) {
+        trace_ring_record(TRACE_MILKYMIST_UART_RAISE_IRQ, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_uart_lower_irq(void)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_UART_LOWER_IRQ)) {
+        trace_ring_record(TRACE_MILKYMIST_UART_LOWER_IRQ, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_milkymist_vgafb_memory_read(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_VGAFB_MEMORY_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_VGAFB_MEMORY_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_milkymist_vgafb_memory_write(uint32_t addr, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_MILKYMIST_VGAFB_MEMORY_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)value };
+        trace_ring_record(TRACE_MILKYMIST_VGAFB_MEMORY_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_mipsnet_send(uint32_t size)
 {
+    if (trace_event_get_state(TRACE_MIPSNET_SEND)) {
+        uint64_t args[] = { (uint64_t)size };
+        trace_ring_record(TRACE_MIPSNET_SEND, args, 1, NULL);
+    }
 }
 
 static inline void trace_mipsnet_receive(uint32_t size)
 {
+    if (trace_event_get_state(TRACE_MIPSNET_RECEIVE)) {
+        uint64_t args[] = { (uint64_t)size };
+        trace_ring_record(TRACE_MIPSNET_RECEIVE, args, 1, NULL);
+    }
 }
 
 static inline void trace_mipsnet_read(uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_MIPSNET_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_MIPSNET_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_mipsnet_write(uint64_t addr, uint64_t val)
 {
+    if (trace_event_get_state(TRACE_MIPSNET_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_MIPSNET_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_mipsnet_irq(uint32_t isr, uint32_t intctl)
 {
+    if (trace_event_get_state(TRACE_MIPSNET_IRQ)) {
+        uint64_t args[] = { (uint64_t)isr, (uint64_t)intctl };
+        trace_ring_record(TRACE_MIPSNET_IRQ, args, 2, NULL);
+    }
 }
 
 static inline void trace_pc87312_io_read(uint32_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_PC87312_IO_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_PC87312_IO_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_pc87312_io_write(uint32_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_PC87312_IO_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_PC87312_IO_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_pc87312_info_floppy(uint32_t base)
 {
+    if (trace_event_get_state(TRACE_PC87312_INFO_FLOPPY)) {
+        uint64_t args[] = { (uint64_t)base };
+        trace_ring_record(TRACE_PC87312_INFO_FLOPPY, args, 1, NULL);
+    }
 }
 
 static inline void trace_pc87312_info_ide(uint32_t base)
 {
+    if (trace_event_get_state(TRACE_PC87312_INFO_IDE)) {
+        uint64_t args[] = { (uint64_t)base };
+        trace_ring_record(TRACE_PC87312_INFO_IDE, args, 1, NULL);
+    }
 }
 
 static inline void trace_pc87312_info_parallel(uint32_t base, uint32_t irq)
 {
+    if (trace_event_get_state(TRACE_PC87312_INFO_PARALLEL)) {
+        uint64_t args[] = { (uint64_t)base, (uint64_t)irq };
+        trace_ring_record(TRACE_PC87312_INFO_PARALLEL, args, 2, NULL);
+    }
 }
 
 static inline void trace_pc87312_info_serial(int n, uint32_t base, uint32_t irq)
 {
+    if (trace_event_get_state(TRACE_PC87312_INFO_SERIAL)) {
+        uint64_t args[] = { (uint64_t)n, (uint64_t)base, (uint64_t)irq };
+        trace_ring_record(TRACE_PC87312_INFO_SERIAL, args, 3, NULL);
+    }
 }
 
 static inline void trace_pvscsi_ring_init_data(uint32_t txr_len_log2, uint32_t rxr_len_log2)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_RING_INIT_DATA)) {
+        uint64_t args[] = { (uint64_t)txr_len_log2, (uint64_t)rxr_len_log2 };
+        trace_ring_record(TRACE_PVSCSI_RING_INIT_DATA, args, 2, NULL);
+    }
 }
 
 static inline void trace_pvscsi_ring_init_msg(uint32_t len_log2)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_RING_INIT_MSG)) {
+        uint64_t args[] = { (uint64_t)len_log2 };
+        trace_ring_record(TRACE_PVSCSI_RING_INIT_MSG, args, 1, NULL);
+    }
 }
 
 static inline void trace_pvscsi_ring_flush_cmp(uint64_t filled_cmp_ptr)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_RING_FLUSH_CMP)) {
+        uint64_t args[] = { (uint64_t)filled_cmp_ptr };
+        trace_ring_record(TRACE_PVSCSI_RING_FLUSH_CMP, args, 1, NULL);
+    }
 }
 
 static inline void trace_pvscsi_ring_flush_msg(uint64_t filled_cmp_ptr)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_RING_FLUSH_MSG)) {
+        uint64_t args[] = { (uint64_t)filled_cmp_ptr };
+        trace_ring_record(TRACE_PVSCSI_RING_FLUSH_MSG, args, 1, NULL);
+    }
 }
 
 static inline void trace_pvscsi_update_irq_level(bool raise, uint64_t mask, uint64_t status)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_UPDATE_IRQ_LEVEL)) {
+        uint64_t args[] = { (uint64_t)raise, (uint64_t)mask, (uint64_t)status };
+        trace_ring_record(TRACE_PVSCSI_UPDATE_IRQ_LEVEL, args, 3, NULL);
+    }
 }
 
 static inline void trace_pvscsi_update_irq_msi(void)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_UPDATE_IRQ_MSI)) {
+        trace_ring_record(TRACE_PVSCSI_UPDATE_IRQ_MSI, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_pvscsi_cmp_ring_put(unsigned long addr)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_CMP_RING_PUT)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_PVSCSI_CMP_RING_PUT, args, 1, NULL);
+    }
 }
 
 static inline void trace_pvscsi_msg_ring_put(unsigned long addr)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_MSG_RING_PUT)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_PVSCSI_MSG_RING_PUT, args, 1, NULL);
+    }
 }
 
 static inline void trace_pvscsi_complete_request(uint64_t context, uint64_t len, uint8_t sense_key)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_COMPLETE_REQUEST)) {
+        uint64_t args[] = { (uint64_t)context, (uint64_t)len, (uint64_t)sense_key };
+        trace_ring_record(TRACE_PVSCSI_COMPLETE_REQUEST, args, 3, NULL);
+    }
 }
 
 static inline void trace_pvscsi_get_sg_list(int nsg, size_t size)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_GET_SG_LIST)) {
+        uint64_t args[] = { (uint64_t)nsg, (uint64_t)size };
+        trace_ring_record(TRACE_PVSCSI_GET_SG_LIST, args, 2, NULL);
+    }
 }
 
 static inline void trace_pvscsi_get_next_sg_elem(uint32_t flags)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_GET_NEXT_SG_ELEM)) {
+        uint64_t args[] = { (uint64_t)flags };
+        trace_ring_record(TRACE_PVSCSI_GET_NEXT_SG_ELEM, args, 1, NULL);
+    }
 }
 
 static inline void trace_pvscsi_command_complete_not_found(uint32_t tag)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_COMMAND_COMPLETE_NOT_FOUND)) {
+        uint64_t args[] = { (uint64_t)tag };
+        trace_ring_record(TRACE_PVSCSI_COMMAND_COMPLETE_NOT_FOUND, args, 1, NULL);
+    }
 }
 
 static inline void trace_pvscsi_command_complete_data_run(void)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_COMMAND_COMPLETE_DATA_RUN)) {
+        trace_ring_record(TRACE_PVSCSI_COMMAND_COMPLETE_DATA_RUN, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_pvscsi_command_complete_sense_len(int len)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_COMMAND_COMPLETE_SENSE_LEN)) {
+        uint64_t args[] = { (uint64_t)len };
+        trace_ring_record(TRACE_PVSCSI_COMMAND_COMPLETE_SENSE_LEN, args, 1, NULL);
+    }
 }
 
 static inline void trace_pvscsi_convert_sglist(uint64_t context, unsigned long addr, uint32_t resid)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_CONVERT_SGLIST)) {
+        uint64_t args[] = { (uint64_t)context, (uint64_t)addr, (uint64_t)resid };
+        trace_ring_record(TRACE_PVSCSI_CONVERT_SGLIST, args, 3, NULL);
+    }
 }
 
 static inline void trace_pvscsi_process_req_descr(uint8_t cmd, uint64_t ctx)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_PROCESS_REQ_DESCR)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)ctx };
+        trace_ring_record(TRACE_PVSCSI_PROCESS_REQ_DESCR, args, 2, NULL);
+    }
 }
 
 static inline void trace_pvscsi_process_req_descr_unknown_device(void)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_PROCESS_REQ_DESCR_UNKNOWN_DEVICE)) {
+        trace_ring_record(TRACE_PVSCSI_PROCESS_REQ_DESCR_UNKNOWN_DEVICE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_pvscsi_process_req_descr_invalid_dir(void)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_PROCESS_REQ_DESCR_INVALID_DIR)) {
+        trace_ring_record(TRACE_PVSCSI_PROCESS_REQ_DESCR_INVALID_DIR, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_pvscsi_process_io(unsigned long addr)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_PROCESS_IO)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_PVSCSI_PROCESS_IO, args, 1, NULL);
+    }
 }
 
 static inline void trace_pvscsi_on_cmd_noimpl(const char* cmd)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_ON_CMD_NOIMPL)) {
+        uint64_t args[] = { (uintptr_t)cmd };
+        trace_ring_record(TRACE_PVSCSI_ON_CMD_NOIMPL, args, 1, cmd);
+    }
 }
 
 static inline void trace_pvscsi_on_cmd_reset_dev(uint32_t tgt, int lun, void* dev)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_ON_CMD_RESET_DEV)) {
+        uint64_t args[] = { (uint64_t)tgt, (uint64_t)lun, (uintptr_t)dev };
+        trace_ring_record(TRACE_PVSCSI_ON_CMD_RESET_DEV, args, 3, NULL);
+    }
 }
 
 static inline void trace_pvscsi_on_cmd_arrived(const char* cmd)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_ON_CMD_ARRIVED)) {
+        uint64_t args[] = { (uintptr_t)cmd };
+        trace_ring_record(TRACE_PVSCSI_ON_CMD_ARRIVED, args, 1, cmd);
+    }
 }
 
 static inline void trace_pvscsi_on_cmd_abort(uint64_t ctx, uint32_t tgt)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_ON_CMD_ABORT)) {
+        uint64_t args[] = { (uint64_t)ctx, (uint64_t)tgt };
+        trace_ring_record(TRACE_PVSCSI_ON_CMD_ABORT, args, 2, NULL);
+    }
 }
 
 static inline void trace_pvscsi_on_cmd_unknown(uint64_t cmd_id)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_ON_CMD_UNKNOWN)) {
+        uint64_t args[] = { (uint64_t)cmd_id };
+        trace_ring_record(TRACE_PVSCSI_ON_CMD_UNKNOWN, args, 1, NULL);
+    }
 }
 
 static inline void trace_pvscsi_on_cmd_unknown_data(uint32_t data)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_ON_CMD_UNKNOWN_DATA)) {
+        uint64_t args[] = { (uint64_t)data };
+        trace_ring_record(TRACE_PVSCSI_ON_CMD_UNKNOWN_DATA, args, 1, NULL);
+    }
 }
 
 static inline void trace_pvscsi_io_write(const char* cmd, uint64_t val)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_IO_WRITE)) {
+        uint64_t args[] = { (uintptr_t)cmd, (uint64_t)val };
+        trace_ring_record(TRACE_PVSCSI_IO_WRITE, args, 2, cmd);
+    }
 }
 
 static inline void trace_pvscsi_io_write_unknown(unsigned long addr, unsigned sz, uint64_t val)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_IO_WRITE_UNKNOWN)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)sz, (uint64_t)val };
+        trace_ring_record(TRACE_PVSCSI_IO_WRITE_UNKNOWN, args, 3, NULL);
+    }
 }
 
 static inline void trace_pvscsi_io_read(const char* cmd, uint64_t status)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_IO_READ)) {
+        uint64_t args[] = { (uintptr_t)cmd, (uint64_t)status };
+        trace_ring_record(TRACE_PVSCSI_IO_READ, args, 2, cmd);
+    }
 }
 
 static inline void trace_pvscsi_io_read_unknown(unsigned long addr, unsigned sz)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_IO_READ_UNKNOWN)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)sz };
+        trace_ring_record(TRACE_PVSCSI_IO_READ_UNKNOWN, args, 2, NULL);
+    }
 }
 
 static inline void trace_pvscsi_init_msi_fail(int res)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_INIT_MSI_FAIL)) {
+        uint64_t args[] = { (uint64_t)res };
+        trace_ring_record(TRACE_PVSCSI_INIT_MSI_FAIL, args, 1, NULL);
+    }
 }
 
 static inline void trace_pvscsi_state(const char* state)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_STATE)) {
+        uint64_t args[] = { (uintptr_t)state };
+        trace_ring_record(TRACE_PVSCSI_STATE, args, 1, state);
+    }
 }
 
 static inline void trace_pvscsi_tx_rings_ppn(const char* label, uint64_t ppn)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_TX_RINGS_PPN)) {
+        uint64_t args[] = { (uintptr_t)label, (uint64_t)ppn };
+        trace_ring_record(TRACE_PVSCSI_TX_RINGS_PPN, args, 2, label);
+    }
 }
 
 static inline void trace_pvscsi_tx_rings_num_pages(const char* label, uint32_t num)
 {
+    if (trace_event_get_state(TRACE_PVSCSI_TX_RINGS_NUM_PAGES)) {
+        uint64_t args[] = { (uintptr_t)label, (uint64_t)num };
+        trace_ring_record(TRACE_PVSCSI_TX_RINGS_NUM_PAGES, args, 2, label);
+    }
 }
 
 static inline void trace_xen_ram_alloc(unsigned long ram_addr, unsigned long size)
 {
+    if (trace_event_get_state(TRACE_XEN_RAM_ALLOC)) {
+        uint64_t args[] = { (uint64_t)ram_addr, (uint64_t)size };
+        trace_ring_record(TRACE_XEN_RAM_ALLOC, args, 2, NULL);
+    }
 }
 
 static inline void trace_xen_client_set_memory(uint64_t start_addr, unsigned long size, bool log_dirty)
 {
+    if (trace_event_get_state(TRACE_XEN_CLIENT_SET_MEMORY)) {
+        uint64_t args[] = { (uint64_t)start_addr, (uint64_t)size, (uint64_t)log_dirty };
+        trace_ring_record(TRACE_XEN_CLIENT_SET_MEMORY, args, 3, NULL);
+    }
 }
 
 static inline void trace_xen_ioreq_server_create(uint32_t id)
 {
+    if (trace_event_get_state(TRACE_XEN_IOREQ_SERVER_CREATE)) {
+        uint64_t args[] = { (uint64_t)id };
+        trace_ring_record(TRACE_XEN_IOREQ_SERVER_CREATE, args, 1, NULL);
+    }
 }
 
 static inline void trace_xen_ioreq_server_destroy(uint32_t id)
 {
+    if (trace_event_get_state(TRACE_XEN_IOREQ_SERVER_DESTROY)) {
+        uint64_t args[] = { (uint64_t)id };
+        trace_ring_record(TRACE_XEN_IOREQ_SERVER_DESTROY, args, 1, NULL);
+    }
 }
 
 static inline void trace_xen_ioreq_server_state(uint32_t id, bool enable)
 {
+    if (trace_event_get_state(TRACE_XEN_IOREQ_SERVER_STATE)) {
+        uint64_t args[] = { (uint64_t)id, (uint64_t)enable };
+        trace_ring_record(TRACE_XEN_IOREQ_SERVER_STATE, args, 2, NULL);
+    }
 }
 
 static inline void trace_xen_map_mmio_range(uint32_t id, uint64_t start_addr, uint64_t end_addr)
 {
+    if (trace_event_get_state(TRACE_XEN_MAP_MMIO_RANGE)) {
+        uint64_t args[] = { (uint64_t)id, (uint64_t)start_addr, (uint64_t)end_addr };
+        trace_ring_record(TRACE_XEN_MAP_MMIO_RANGE, args, 3, NULL);
+    }
 }
 
 static inline void trace_xen_unmap_mmio_range(uint32_t id, uint64_t start_addr, uint64_t end_addr)
 {
+    if (trace_event_get_state(TRACE_XEN_UNMAP_MMIO_RANGE)) {
+        uint64_t args[] = { (uint64_t)id, (uint64_t)start_addr, (uint64_t)end_addr };
+        trace_ring_record(TRACE_XEN_UNMAP_MMIO_RANGE, args, 3, NULL);
+    }
 }
 
 static inline void trace_xen_map_portio_range(uint32_t id, uint64_t start_addr, uint64_t end_addr)
 {
+    if (trace_event_get_state(TRACE_XEN_MAP_PORTIO_RANGE)) {
+        uint64_t args[] = { (uint64_t)id, (uint64_t)start_addr, (uint64_t)end_addr };
+        trace_ring_record(TRACE_XEN_MAP_PORTIO_RANGE, args, 3, NULL);
+    }
 }
 
 static inline void trace_xen_unmap_portio_range(uint32_t id, uint64_t start_addr, uint64_t end_addr)
 {
+    if (trace_event_get_state(TRACE_XEN_UNMAP_PORTIO_RANGE)) {
+        uint64_t args[] = { (uint64_t)id, (uint64_t)start_addr, (uint64_t)end_addr };
+        trace_ring_record(TRACE_XEN_UNMAP_PORTIO_RANGE, args, 3, NULL);
+    }
 }
 
 static inline void trace_xen_map_pcidev(uint32_t id, uint8_t bus, uint8_t dev, uint8_t func)
 {
+    if (trace_event_get_state(TRACE_XEN_MAP_PCIDEV)) {
+        uint64_t args[] = { (uint64_t)id, (uint64_t)bus, (uint64_t)dev, (uint64_t)func };
+        trace_ring_record(TRACE_XEN_MAP_PCIDEV, args, 4, NULL);
+    }
 }
 
 static inline void trace_xen_unmap_pcidev(uint32_t id, uint8_t bus, uint8_t dev, uint8_t func)
 {
+    if (trace_event_get_state(TRACE_XEN_UNMAP_PCIDEV)) {
+        uint64_t args[] = { (uint64_t)id, (uint64_t)bus, (uint64_t)dev, (uint64_t)func };
+        trace_ring_record(TRACE_XEN_UNMAP_PCIDEV, args, 4, NULL);
+    }
 }
 
 static inline void trace_xen_map_cache(uint64_t phys_addr)
 {
+    if (trace_event_get_state(TRACE_XEN_MAP_CACHE)) {
+        uint64_t args[] = { (uint64_t)phys_addr };
+        trace_ring_record(TRACE_XEN_MAP_CACHE, args, 1, NULL);
+    }
 }
 
 static inline void trace_xen_remap_bucket(uint64_t index)
 {
+    if (trace_event_get_state(TRACE_XEN_REMAP_BUCKET)) {
+        uint64_t args[] = { (uint64_t)index };
+        trace_ring_record(TRACE_XEN_REMAP_BUCKET, args, 1, NULL);
+    }
 }
 
 static inline void trace_xen_map_cache_return(void* ptr)
 {
+    if (trace_event_get_state(TRACE_XEN_MAP_CACHE_RETURN)) {
+        uint64_t args[] = { (uintptr_t)ptr };
+        trace_ring_record(TRACE_XEN_MAP_CACHE_RETURN, args, 1, NULL);
+    }
 }
 
 static inline void trace_xen_platform_log(char * s)
 {
+    if (trace_event_get_state(TRACE_XEN_PLATFORM_LOG)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_XEN_PLATFORM_LOG, args, 1, s);
+    }
 }
 
 static inline void trace_qemu_coroutine_enter(void * from, void * to, void * opaque)
 {
+    if (trace_event_get_state(TRACE_QEMU_COROUTINE_ENTER)) {
+        uint64_t args[] = { (uintptr_t)from, (uintptr_t)to, (uintptr_t)opaque };
+        trace_ring_record(TRACE_QEMU_COROUTINE_ENTER, args, 3, NULL);
+    }
 }
 
 static inline void trace_qemu_coroutine_yield(void * from, void * to)
 {
+    if (trace_event_get_state(TRACE_QEMU_COROUTINE_YIELD)) {
+        uint64_t args[] = { (uintptr_t)from, (uintptr_t)to };
+        trace_ring_record(TRACE_QEMU_COROUTINE_YIELD, args, 2, NULL);
+    }
 }
 
 static inline void trace_qemu_coroutine_terminate(void * co)
 {
+    if (trace_event_get_state(TRACE_QEMU_COROUTINE_TERMINATE)) {
+        uint64_t args[] = { (uintptr_t)co };
+        trace_ring_record(TRACE_QEMU_COROUTINE_TERMINATE, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_co_queue_run_restart(void * co)
 {
+    if (trace_event_get_state(TRACE_QEMU_CO_QUEUE_RUN_RESTART)) {
+        uint64_t args[] = { (uintptr_t)co };
+        trace_ring_record(TRACE_QEMU_CO_QUEUE_RUN_RESTART, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_co_queue_next(void * nxt)
 {
+    if (trace_event_get_state(TRACE_QEMU_CO_QUEUE_NEXT)) {
+        uint64_t args[] = { (uintptr_t)nxt };
+        trace_ring_record(TRACE_QEMU_CO_QUEUE_NEXT, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_co_mutex_lock_entry(void * mutex, void * self)
 {
+    if (trace_event_get_state(TRACE_QEMU_CO_MUTEX_LOCK_ENTRY)) {
+        uint64_t args[] = { (uintptr_t)mutex, (uintptr_t)self };
+        trace_ring_record(TRACE_QEMU_CO_MUTEX_LOCK_ENTRY, args, 2, NULL);
+    }
 }
 
 static inline void trace_qemu_co_mutex_lock_return(void * mutex, void * self)
 {
+    if (trace_event_get_state(TRACE_QEMU_CO_MUTEX_LOCK_RETURN)) {
+        uint64_t args[] = { (uintptr_t)mutex, (uintptr_t)self };
+        trace_ring_record(TRACE_QEMU_CO_MUTEX_LOCK_RETURN, args, 2, NULL);
+    }
 }
 
 static inline void trace_qemu_co_mutex_unlock_entry(void * mutex, void * self)
 {
+    if (trace_event_get_state(TRACE_QEMU_CO_MUTEX_UNLOCK_ENTRY)) {
+        uint64_t args[] = { (uintptr_t)mutex, (uintptr_t)self };
+        trace_ring_record(TRACE_QEMU_CO_MUTEX_UNLOCK_ENTRY, args, 2, NULL);
+    }
 }
 
 static inline void trace_qemu_co_mutex_unlock_return(void * mutex, void * self)
 {
+    if (trace_event_get_state(TRACE_QEMU_CO_MUTEX_UNLOCK_RETURN)) {
+        uint64_t args[] = { (uintptr_t)mutex, (uintptr_t)self };
+        trace_ring_record(TRACE_QEMU_CO_MUTEX_UNLOCK_RETURN, args, 2, NULL);
+    }
 }
 
 static inline void trace_escc_put_queue(char channel, int b)
 {
+    if (trace_event_get_state(TRACE_ESCC_PUT_QUEUE)) {
+        uint64_t args[] = { (uint64_t)channel, (uint64_t)b };
+        trace_ring_record(TRACE_ESCC_PUT_QUEUE, args, 2, NULL);
+    }
 }
 
 static inline void trace_escc_get_queue(char channel, int val)
 {
+    if (trace_event_get_state(TRACE_ESCC_GET_QUEUE)) {
+        uint64_t args[] = { (uint64_t)channel, (uint64_t)val };
+        trace_ring_record(TRACE_ESCC_GET_QUEUE, args, 2, NULL);
+    }
 }
 
 static inline void trace_escc_update_irq(int irq)
 {
+    if (trace_event_get_state(TRACE_ESCC_UPDATE_IRQ)) {
+        uint64_t args[] = { (uint64_t)irq };
+        trace_ring_record(TRACE_ESCC_UPDATE_IRQ, args, 1, NULL);
+    }
 }
 
 static inline void trace_escc_update_parameters(char channel, int speed, int parity, int data_bits, int stop_bits)
 {
+    if (trace_event_get_state(TRACE_ESCC_UPDATE_PARAMETERS)) {
+        uint64_t args[] = { (uint64_t)channel, (uint64_t)speed, (uint64_t)parity, (uint64_t)data_bits, (uint64_t)stop_bits };
+        trace_ring_record(TRACE_ESCC_UPDATE_PARAMETERS, args, 5, NULL);
+    }
 }
 
 static inline void trace_escc_mem_writeb_ctrl(char channel, uint32_t reg, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESCC_MEM_WRITEB_CTRL)) {
+        uint64_t args[] = { (uint64_t)channel, (uint64_t)reg, (uint64_t)val };
+        trace_ring_record(TRACE_ESCC_MEM_WRITEB_CTRL, args, 3, NULL);
+    }
 }
 
 static inline void trace_escc_mem_writeb_data(char channel, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESCC_MEM_WRITEB_DATA)) {
+        uint64_t args[] = { (uint64_t)channel, (uint64_t)val };
+        trace_ring_record(TRACE_ESCC_MEM_WRITEB_DATA, args, 2, NULL);
+    }
 }
 
 static inline void trace_escc_mem_readb_ctrl(char channel, uint32_t reg, uint8_t val)
 {
+    if (trace_event_get_state(TRACE_ESCC_MEM_READB_CTRL)) {
+        uint64_t args[] = { (uint64_t)channel, (uint64_t)reg, (uint64_t)val };
+        trace_ring_record(TRACE_ESCC_MEM_READB_CTRL, args, 3, NULL);
+    }
 }
 
 static inline void trace_escc_mem_readb_data(char channel, uint32_t ret)
 {
+    if (trace_event_get_state(TRACE_ESCC_MEM_READB_DATA)) {
+        uint64_t args[] = { (uint64_t)channel, (uint64_t)ret };
+        trace_ring_record(TRACE_ESCC_MEM_READB_DATA, args, 2, NULL);
+    }
 }
 
 static inline void trace_escc_serial_receive_byte(char channel, int ch)
 {
+    if (trace_event_get_state(TRACE_ESCC_SERIAL_RECEIVE_BYTE)) {
+        uint64_t args[] = { (uint64_t)channel, (uint64_t)ch };
+        trace_ring_record(TRACE_ESCC_SERIAL_RECEIVE_BYTE, args, 2, NULL);
+    }
 }
 
 static inline void trace_escc_sunkbd_event_in(int ch, const char * name, int down)
 {
+    if (trace_event_get_state(TRACE_ESCC_SUNKBD_EVENT_IN)) {
+        uint64_t args[] = { (uint64_t)ch, (uintptr_t)name, (uint64_t)down };
+        trace_ring_record(TRACE_ESCC_SUNKBD_EVENT_IN, args, 3, name);
+    }
 }
 
 static inline void trace_escc_sunkbd_event_out(int ch)
 {
+    if (trace_event_get_state(TRACE_ESCC_SUNKBD_EVENT_OUT)) {
+        uint64_t args[] = { (uint64_t)ch };
+        trace_ring_record(TRACE_ESCC_SUNKBD_EVENT_OUT, args, 1, NULL);
+    }
 }
 
 static inline void trace_escc_kbd_command(int val)
 {
+    if (trace_event_get_state(TRACE_ESCC_KBD_COMMAND)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESCC_KBD_COMMAND, args, 1, NULL);
+    }
 }
 
 static inline void trace_escc_sunmouse_event(int dx, int dy, int buttons_state)
 {
+    if (trace_event_get_state(TRACE_ESCC_SUNMOUSE_EVENT)) {
+        uint64_t args[] = { (uint64_t)dx, (uint64_t)dy, (uint64_t)buttons_state };
+        trace_ring_record(TRACE_ESCC_SUNMOUSE_EVENT, args, 3, NULL);
+    }
 }
 
 static inline void trace_esp_error_fifo_overrun(void)
 {
+    if (trace_event_get_state(TRACE_ESP_ERROR_FIFO_OVERRUN)) {
+        trace_ring_record(TRACE_ESP_ERROR_FIFO_OVERRUN, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_esp_error_unhandled_command(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_ERROR_UNHANDLED_COMMAND)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_ERROR_UNHANDLED_COMMAND, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_error_invalid_write(uint32_t val, uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_ESP_ERROR_INVALID_WRITE)) {
+        uint64_t args[] = { (uint64_t)val, (uint64_t)addr };
+        trace_ring_record(TRACE_ESP_ERROR_INVALID_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_esp_raise_irq(void)
 {
+    if (trace_event_get_state(TRACE_ESP_RAISE_IRQ)) {
+        trace_ring_record(TRACE_ESP_RAISE_IRQ, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_esp_lower_irq(void)
 {
+    if (trace_event_get_state(TRACE_ESP_LOWER_IRQ)) {
+        trace_ring_record(TRACE_ESP_LOWER_IRQ, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_esp_dma_enable(void)
 {
+    if (trace_event_get_state(TRACE_ESP_DMA_ENABLE)) {
+        trace_ring_record(TRACE_ESP_DMA_ENABLE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_esp_dma_disable(void)
 {
+    if (trace_event_get_state(TRACE_ESP_DMA_DISABLE)) {
+        trace_ring_record(TRACE_ESP_DMA_DISABLE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_esp_get_cmd(uint32_t dmalen, int target)
 {
+    if (trace_event_get_state(TRACE_ESP_GET_CMD)) {
+        uint64_t args[] = { (uint64_t)dmalen, (uint64_t)target };
+        trace_ring_record(TRACE_ESP_GET_CMD, args, 2, NULL);
+    }
 }
 
 static inline void trace_esp_do_busid_cmd(uint8_t busid)
 {
+    if (trace_event_get_state(TRACE_ESP_DO_BUSID_CMD)) {
+        uint64_t args[] = { (uint64_t)busid };
+        trace_ring_record(TRACE_ESP_DO_BUSID_CMD, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_handle_satn_stop(uint32_t cmdlen)
 {
+    if (trace_event_get_state(TRACE_ESP_HANDLE_SATN_STOP)) {
+        uint64_t args[] = { (uint64_t)cmdlen };
+        trace_ring_record(TRACE_ESP_HANDLE_SATN_STOP, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_write_response(uint32_t status)
 {
+    if (trace_event_get_state(TRACE_ESP_WRITE_RESPONSE)) {
+        uint64_t args[] = { (uint64_t)status };
+        trace_ring_record(TRACE_ESP_WRITE_RESPONSE, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_do_dma(uint32_t cmdlen, uint32_t len)
 {
+    if (trace_event_get_state(TRACE_ESP_DO_DMA)) {
+        uint64_t args[] = { (uint64_t)cmdlen, (uint64_t)len };
+        trace_ring_record(TRACE_ESP_DO_DMA, args, 2, NULL);
+    }
 }
 
 static inline void trace_esp_command_complete(void)
 {
+    if (trace_event_get_state(TRACE_ESP_COMMAND_COMPLETE)) {
+        trace_ring_record(TRACE_ESP_COMMAND_COMPLETE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_esp_command_complete_unexpected(void)
 {
+    if (trace_event_get_state(TRACE_ESP_COMMAND_COMPLETE_UNEXPECTED)) {
+        trace_ring_record(TRACE_ESP_COMMAND_COMPLETE_UNEXPECTED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_esp_command_complete_fail(void)
 {
+    if (trace_event_get_state(TRACE_ESP_COMMAND_COMPLETE_FAIL)) {
+        trace_ring_record(TRACE_ESP_COMMAND_COMPLETE_FAIL, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_esp_transfer_data(uint32_t dma_left, int32_t ti_size)
 {
+    if (trace_event_get_state(TRACE_ESP_TRANSFER_DATA)) {
+        uint64_t args[] = { (uint64_t)dma_left, (uint64_t)ti_size };
+        trace_ring_record(TRACE_ESP_TRANSFER_DATA, args, 2, NULL);
+    }
 }
 
 static inline void trace_esp_handle_ti(uint32_t minlen)
 {
+    if (trace_event_get_state(TRACE_ESP_HANDLE_TI)) {
+        uint64_t args[] = { (uint64_t)minlen };
+        trace_ring_record(TRACE_ESP_HANDLE_TI, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_handle_ti_cmd(uint32_t cmdlen)
 {
+    if (trace_event_get_state(TRACE_ESP_HANDLE_TI_CMD)) {
+        uint64_t args[] = { (uint64_t)cmdlen };
+        trace_ring_record(TRACE_ESP_HANDLE_TI_CMD, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_mem_readb(uint32_t saddr, uint8_t reg)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_READB)) {
+        uint64_t args[] = { (uint64_t)saddr, (uint64_t)reg };
+        trace_ring_record(TRACE_ESP_MEM_READB, args, 2, NULL);
+    }
 }
 
 static inline void trace_esp_mem_writeb(uint32_t saddr, uint8_t reg, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_WRITEB)) {
+        uint64_t args[] = { (uint64_t)saddr, (uint64_t)reg, (uint64_t)val };
+        trace_ring_record(TRACE_ESP_MEM_WRITEB, args, 3, NULL);
+    }
 }
 
 static inline void trace_esp_mem_writeb_cmd_nop(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_WRITEB_CMD_NOP)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_MEM_WRITEB_CMD_NOP, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_mem_writeb_cmd_flush(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_WRITEB_CMD_FLUSH)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_MEM_WRITEB_CMD_FLUSH, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_mem_writeb_cmd_reset(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_WRITEB_CMD_RESET)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_MEM_WRITEB_CMD_RESET, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_mem_writeb_cmd_bus_reset(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_WRITEB_CMD_BUS_RESET)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_MEM_WRITEB_CMD_BUS_RESET, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_mem_writeb_cmd_iccs(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_WRITEB_CMD_ICCS)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_MEM_WRITEB_CMD_ICCS, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_mem_writeb_cmd_msgacc(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_WRITEB_CMD_MSGACC)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_MEM_WRITEB_CMD_MSGACC, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_mem_writeb_cmd_pad(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_WRITEB_CMD_PAD)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_MEM_WRITEB_CMD_PAD, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_mem_writeb_cmd_satn(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_WRITEB_CMD_SATN)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_MEM_WRITEB_CMD_SATN, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_mem_writeb_cmd_rstatn(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_WRITEB_CMD_RSTATN)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_MEM_WRITEB_CMD_RSTATN, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_mem_writeb_cmd_sel(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_WRITEB_CMD_SEL)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_MEM_WRITEB_CMD_SEL, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_mem_writeb_cmd_selatn(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_WRITEB_CMD_SELATN)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_MEM_WRITEB_CMD_SELATN, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_mem_writeb_cmd_selatns(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_WRITEB_CMD_SELATNS)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_MEM_WRITEB_CMD_SELATNS, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_mem_writeb_cmd_ensel(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_WRITEB_CMD_ENSEL)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_MEM_WRITEB_CMD_ENSEL, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_mem_writeb_cmd_dissel(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_MEM_WRITEB_CMD_DISSEL)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_MEM_WRITEB_CMD_DISSEL, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_pci_error_invalid_dma_direction(void)
 {
+    if (trace_event_get_state(TRACE_ESP_PCI_ERROR_INVALID_DMA_DIRECTION)) {
+        trace_ring_record(TRACE_ESP_PCI_ERROR_INVALID_DMA_DIRECTION, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_esp_pci_error_invalid_read(uint32_t reg)
 {
+    if (trace_event_get_state(TRACE_ESP_PCI_ERROR_INVALID_READ)) {
+        uint64_t args[] = { (uint64_t)reg };
+        trace_ring_record(TRACE_ESP_PCI_ERROR_INVALID_READ, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_pci_error_invalid_write(uint32_t reg)
 {
+    if (trace_event_get_state(TRACE_ESP_PCI_ERROR_INVALID_WRITE)) {
+        uint64_t args[] = { (uint64_t)reg };
+        trace_ring_record(TRACE_ESP_PCI_ERROR_INVALID_WRITE, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_pci_error_invalid_write_dma(uint32_t val, uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_ESP_PCI_ERROR_INVALID_WRITE_DMA)) {
+        uint64_t args[] = { (uint64_t)val, (uint64_t)addr };
+        trace_ring_record(TRACE_ESP_PCI_ERROR_INVALID_WRITE_DMA, args, 2, NULL);
+    }
 }
 
 static inline void trace_esp_pci_dma_read(uint32_t saddr, uint32_t reg)
 {
+    if (trace_event_get_state(TRACE_ESP_PCI_DMA_READ)) {
+        uint64_t args[] = { (uint64_t)saddr, (uint64_t)reg };
+        trace_ring_record(TRACE_ESP_PCI_DMA_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_esp_pci_dma_write(uint32_t saddr, uint32_t reg, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_PCI_DMA_WRITE)) {
+        uint64_t args[] = { (uint64_t)saddr, (uint64_t)reg, (uint64_t)val };
+        trace_ring_record(TRACE_ESP_PCI_DMA_WRITE, args, 3, NULL);
+    }
 }
 
 static inline void trace_esp_pci_dma_idle(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_PCI_DMA_IDLE)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_PCI_DMA_IDLE, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_pci_dma_blast(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_PCI_DMA_BLAST)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_PCI_DMA_BLAST, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_pci_dma_abort(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_PCI_DMA_ABORT)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_PCI_DMA_ABORT, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_pci_dma_start(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_PCI_DMA_START)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_ESP_PCI_DMA_START, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_pci_sbac_read(uint32_t reg)
 {
+    if (trace_event_get_state(TRACE_ESP_PCI_SBAC_READ)) {
+        uint64_t args[] = { (uint64_t)reg };
+        trace_ring_record(TRACE_ESP_PCI_SBAC_READ, args, 1, NULL);
+    }
 }
 
 static inline void trace_esp_pci_sbac_write(uint32_t reg, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_ESP_PCI_SBAC_WRITE)) {
+        uint64_t args[] = { (uint64_t)reg, (uint64_t)val };
+        trace_ring_record(TRACE_ESP_PCI_SBAC_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_handle_qmp_command(void * mon, const char * cmd_name)
 {
+    if (trace_event_get_state(TRACE_HANDLE_QMP_COMMAND)) {
+        uint64_t args[] = { (uintptr_t)mon, (uintptr_t)cmd_name };
+        trace_ring_record(TRACE_HANDLE_QMP_COMMAND, args, 2, cmd_name);
+    }
 }
 
 static inline void trace_monitor_protocol_emitter(void * mon)
 {
+    if (trace_event_get_state(TRACE_MONITOR_PROTOCOL_EMITTER)) {
+        uint64_t args[] = { (uintptr_t)mon };
+        trace_ring_record(TRACE_MONITOR_PROTOCOL_EMITTER, args, 1, NULL);
+    }
 }
 
 static inline void trace_monitor_protocol_event_handler(uint32_t event, void * data, uint64_t last, uint64_t now)
 {
+    if (trace_event_get_state(TRACE_MONITOR_PROTOCOL_EVENT_HANDLER)) {
+        uint64_t args[] = { (uint64_t)event, (uintptr_t)data, (uint64_t)last, (uint64_t)now };
+        trace_ring_record(TRACE_MONITOR_PROTOCOL_EVENT_HANDLER, args, 4, NULL);
+    }
 }
 
 static inline void trace_monitor_protocol_event_emit(uint32_t event, void * data)
 {
+    if (trace_event_get_state(TRACE_MONITOR_PROTOCOL_EVENT_EMIT)) {
+        uint64_t args[] = { (uint64_t)event, (uintptr_t)data };
+        trace_ring_record(TRACE_MONITOR_PROTOCOL_EVENT_EMIT, args, 2, NULL);
+    }
 }
 
 static inline void trace_monitor_protocol_event_queue(uint32_t event, void * data, uint64_t rate, uint64_t last, uint64_t now)
 {
+    if (trace_event_get_state(TRACE_MONITOR_PROTOCOL_EVENT_QUEUE)) {
+        uint64_t args[] = { (uint64_t)event, (uintptr_t)data, (uint64_t)rate, (uint64_t)last, (uint64_t)now };
+        trace_ring_record(TRACE_MONITOR_PROTOCOL_EVENT_QUEUE, args, 5, NULL);
+    }
 }
 
 static inline void trace_monitor_protocol_event_throttle(uint32_t event, uint64_t rate)
 {
+    if (trace_event_get_state(TRACE_MONITOR_PROTOCOL_EVENT_THROTTLE)) {
+        uint64_t args[] = { (uint64_t)event, (uint64_t)rate };
+        trace_ring_record(TRACE_MONITOR_PROTOCOL_EVENT_THROTTLE, args, 2, NULL);
+    }
 }
 
 static inline void trace_open_eth_mii_write(unsigned idx, uint16_t v)
 {
+    if (trace_event_get_state(TRACE_OPEN_ETH_MII_WRITE)) {
+        uint64_t args[] = { (uint64_t)idx, (uint64_t)v };
+        trace_ring_record(TRACE_OPEN_ETH_MII_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_open_eth_mii_read(unsigned idx, uint16_t v)
 {
+    if (trace_event_get_state(TRACE_OPEN_ETH_MII_READ)) {
+        uint64_t args[] = { (uint64_t)idx, (uint64_t)v };
+        trace_ring_record(TRACE_OPEN_ETH_MII_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_open_eth_update_irq(uint32_t v)
 {
+    if (trace_event_get_state(TRACE_OPEN_ETH_UPDATE_IRQ)) {
+        uint64_t args[] = { (uint64_t)v };
+        trace_ring_record(TRACE_OPEN_ETH_UPDATE_IRQ, args, 1, NULL);
+    }
 }
 
 static inline void trace_open_eth_receive(unsigned len)
 {
+    if (trace_event_get_state(TRACE_OPEN_ETH_RECEIVE)) {
+        uint64_t args[] = { (uint64_t)len };
+        trace_ring_record(TRACE_OPEN_ETH_RECEIVE, args, 1, NULL);
+    }
 }
 
 static inline void trace_open_eth_receive_mcast(unsigned idx, uint32_t h0, uint32_t h1)
 {
+    if (trace_event_get_state(TRACE_OPEN_ETH_RECEIVE_MCAST)) {
+        uint64_t args[] = { (uint64_t)idx, (uint64_t)h0, (uint64_t)h1 };
+        trace_ring_record(TRACE_OPEN_ETH_RECEIVE_MCAST, args, 3, NULL);
+    }
 }
 
 static inline void trace_open_eth_receive_reject(void)
 {
+    if (trace_event_get_state(TRACE_OPEN_ETH_RECEIVE_REJECT)) {
+        trace_ring_record(TRACE_OPEN_ETH_RECEIVE_REJECT, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_open_eth_receive_desc(uint32_t addr, uint32_t len_flags)
 {
+    if (trace_event_get_state(TRACE_OPEN_ETH_RECEIVE_DESC)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)len_flags };
+        trace_ring_record(TRACE_OPEN_ETH_RECEIVE_DESC, args, 2, NULL);
+    }
 }
 
 static inline void trace_open_eth_start_xmit(uint32_t addr, unsigned len, unsigned tx_len)
 {
+    if (trace_event_get_state(TRACE_OPEN_ETH_START_XMIT)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)len, (uint64_t)tx_len };
+        trace_ring_record(TRACE_OPEN_ETH_START_XMIT, args, 3, NULL);
+    }
 }
 
 static inline void trace_open_eth_reg_read(uint32_t addr, uint32_t v)
 {
+    if (trace_event_get_state(TRACE_OPEN_ETH_REG_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)v };
+        trace_ring_record(TRACE_OPEN_ETH_REG_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_open_eth_reg_write(uint32_t addr, uint32_t v)
 {
+    if (trace_event_get_state(TRACE_OPEN_ETH_REG_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)v };
+        trace_ring_record(TRACE_OPEN_ETH_REG_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_open_eth_desc_read(uint32_t addr, uint32_t v)
 {
+    if (trace_event_get_state(TRACE_OPEN_ETH_DESC_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)v };
+        trace_ring_record(TRACE_OPEN_ETH_DESC_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_open_eth_desc_write(uint32_t addr, uint32_t v)
 {
+    if (trace_event_get_state(TRACE_OPEN_ETH_DESC_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)v };
+        trace_ring_record(TRACE_OPEN_ETH_DESC_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_v9fs_rerror(uint16_t tag, uint8_t id, int err)
 {
+    if (trace_event_get_state(TRACE_V9FS_RERROR)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)err };
+        trace_ring_record(TRACE_V9FS_RERROR, args, 3, NULL);
+    }
 }
 
 static inline void trace_v9fs_version(uint16_t tag, uint8_t id, int32_t msize, char* version)
 {
+    if (trace_event_get_state(TRACE_V9FS_VERSION)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)msize, (uintptr_t)version };
+        trace_ring_record(TRACE_V9FS_VERSION, args, 4, version);
+    }
 }
 
 static inline void trace_v9fs_version_return(uint16_t tag, uint8_t id, int32_t msize, char* version)
 {
+    if (trace_event_get_state(TRACE_V9FS_VERSION_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)msize, (uintptr_t)version };
+        trace_ring_record(TRACE_V9FS_VERSION_RETURN, args, 4, version);
+    }
 }
 
 static inline void trace_v9fs_attach(uint16_t tag, uint8_t id, int32_t fid, int32_t afid, char* uname, char* aname)
 {
+    if (trace_event_get_state(TRACE_V9FS_ATTACH)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uint64_t)afid, (uintptr_t)uname, (uintptr_t)aname };
+        trace_ring_record(TRACE_V9FS_ATTACH, args, 6, uname);
+    }
 }
 
 static inline void trace_v9fs_attach_return(uint16_t tag, uint8_t id, int8_t type, int32_t version, int64_t path)
 {
+    if (trace_event_get_state(TRACE_V9FS_ATTACH_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)type, (uint64_t)version, (uint64_t)path };
+        trace_ring_record(TRACE_V9FS_ATTACH_RETURN, args, 5, NULL);
+    }
 }
 
 static inline void trace_v9fs_stat(uint16_t tag, uint8_t id, int32_t fid)
 {
+    if (trace_event_get_state(TRACE_V9FS_STAT)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid };
+        trace_ring_record(TRACE_V9FS_STAT, args, 3, NULL);
+    }
 }
 
 static inline void trace_v9fs_stat_return(uint16_t tag, uint8_t id, int32_t mode, int32_t atime, int32_t mtime, int64_t length)
 {
+    if (trace_event_get_state(TRACE_V9FS_STAT_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)mode, (uint64_t)atime, (uint64_t)mtime, (uint64_t)length };
+        trace_ring_record(TRACE_V9FS_STAT_RETURN, args, 6, NULL);
+    }
 }
 
 static inline void trace_v9fs_getattr(uint16_t tag, uint8_t id, int32_t fid, uint64_t request_mask)
 {
+    if (trace_event_get_state(TRACE_V9FS_GETATTR)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uint64_t)request_mask };
+        trace_ring_record(TRACE_V9FS_GETATTR, args, 4, NULL);
+    }
 }
 
 static inline void trace_v9fs_getattr_return(uint16_t tag, uint8_t id, uint64_t result_mask, uint32_t mode, uint32_t uid, uint32_t gid)
 {
+    if (trace_event_get_state(TRACE_V9FS_GETATTR_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)result_mask, (uint64_t)mode, (uint64_t)uid, (uint64_t)gid };
+        trace_ring_record(TRACE_V9FS_GETATTR_RETURN, args, 6, NULL);
+    }
 }
 
 static inline void trace_v9fs_walk(uint16_t tag, uint8_t id, int32_t fid, int32_t newfid, uint16_t nwnames)
 {
+    if (trace_event_get_state(TRACE_V9FS_WALK)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uint64_t)newfid, (uint64_t)nwnames };
+        trace_ring_record(TRACE_V9FS_WALK, args, 5, NULL);
+    }
 }
 
 static inline void trace_v9fs_walk_return(uint16_t tag, uint8_t id, uint16_t nwnames, void* qids)
 {
+    if (trace_event_get_state(TRACE_V9FS_WALK_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)nwnames, (uintptr_t)qids };
+        trace_ring_record(TRACE_V9FS_WALK_RETURN, args, 4, NULL);
+    }
 }
 
 static inline void trace_v9fs_open(uint16_t tag, uint8_t id, int32_t fid, int32_t mode)
 {
+    if (trace_event_get_state(TRACE_V9FS_OPEN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uint64_t)mode };
+        trace_ring_record(TRACE_V9FS_OPEN, args, 4, NULL);
+    }
 }
 
 static inline void trace_v9fs_open_return(uint16_t tag, uint8_t id, int8_t type, int32_t version, int64_t path, int iounit)
 {
+    if (trace_event_get_state(TRACE_V9FS_OPEN_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)type, (uint64_t)version, (uint64_t)path, (uint64_t)iounit };
+        trace_ring_record(TRACE_V9FS_OPEN_RETURN, args, 6, NULL);
+    }
 }
 
 static inline void trace_v9fs_lcreate(uint16_t tag, uint8_t id, int32_t dfid, int32_t flags, int32_t mode, uint32_t gid)
 {
+    if (trace_event_get_state(TRACE_V9FS_LCREATE)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)dfid, (uint64_t)flags, (uint64_t)mode, (uint64_t)gid };
+        trace_ring_record(TRACE_V9FS_LCREATE, args, 6, NULL);
+    }
 }
 
 static inline void trace_v9fs_lcreate_return(uint16_t tag, uint8_t id, int8_t type, int32_t version, int64_t path, int32_t iounit)
 {
+    if (trace_event_get_state(TRACE_V9FS_LCREATE_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)type, (uint64_t)version, (uint64_t)path, (uint64_t)iounit };
+        trace_ring_record(TRACE_V9FS_LCREATE_RETURN, args, 6, NULL);
+    }
 }
 
 static inline void trace_v9fs_fsync(uint16_t tag, uint8_t id, int32_t fid, int datasync)
 {
+    if (trace_event_get_state(TRACE_V9FS_FSYNC)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uint64_t)datasync };
+        trace_ring_record(TRACE_V9FS_FSYNC, args, 4, NULL);
+    }
 }
 
 static inline void trace_v9fs_clunk(uint16_t tag, uint8_t id, int32_t fid)
 {
+    if (trace_event_get_state(TRACE_V9FS_CLUNK)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid };
+        trace_ring_record(TRACE_V9FS_CLUNK, args, 3, NULL);
+    }
 }
 
 static inline void trace_v9fs_read(uint16_t tag, uint8_t id, int32_t fid, uint64_t off, uint32_t max_count)
 {
+    if (trace_event_get_state(TRACE_V9FS_READ)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uint64_t)off, (uint64_t)max_count };
+        trace_ring_record(TRACE_V9FS_READ, args, 5, NULL);
+    }
 }
 
 static inline void trace_v9fs_read_return(uint16_t tag, uint8_t id, int32_t count, ssize_t err)
 {
+    if (trace_event_get_state(TRACE_V9FS_READ_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)count, (uint64_t)err };
+        trace_ring_record(TRACE_V9FS_READ_RETURN, args, 4, NULL);
+    }
 }
 
 static inline void trace_v9fs_readdir(uint16_t tag, uint8_t id, int32_t fid, uint64_t offset, uint32_t max_count)
 {
+    if (trace_event_get_state(TRACE_V9FS_READDIR)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uint64_t)offset, (uint64_t)max_count };
+        trace_ring_record(TRACE_V9FS_READDIR, args, 5, NULL);
+    }
 }
 
 static inline void trace_v9fs_readdir_return(uint16_t tag, uint8_t id, uint32_t count, ssize_t retval)
 {
+    if (trace_event_get_state(TRACE_V9FS_READDIR_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)count, (uint64_t)retval };
+        trace_ring_record(TRACE_V9FS_READDIR_RETURN, args, 4, NULL);
+    }
 }
 
 static inline void trace_v9fs_write(uint16_t tag, uint8_t id, int32_t fid, uint64_t off, uint32_t count, int cnt)
 {
+    if (trace_event_get_state(TRACE_V9FS_WRITE)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uint64_t)off, (uint64_t)count, (uint64_t)cnt };
+        trace_ring_record(TRACE_V9FS_WRITE, args, 6, NULL);
+    }
 }
 
 static inline void trace_v9fs_write_return(uint16_t tag, uint8_t id, int32_t total, ssize_t err)
 {
+    if (trace_event_get_state(TRACE_V9FS_WRITE_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)total, (uint64_t)err };
+        trace_ring_record(TRACE_V9FS_WRITE_RETURN, args, 4, NULL);
+    }
 }
 
 static inline void trace_v9fs_create(uint16_t tag, uint8_t id, int32_t fid, char* name, int32_t perm, int8_t mode)
 {
+    if (trace_event_get_state(TRACE_V9FS_CREATE)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uintptr_t)name, (uint64_t)perm, (uint64_t)mode };
+        trace_ring_record(TRACE_V9FS_CREATE, args, 6, name);
+    }
 }
 
 static inline void trace_v9fs_create_return(uint16_t tag, uint8_t id, int8_t type, int32_t version, int64_t path, int iounit)
 {
+    if (trace_event_get_state(TRACE_V9FS_CREATE_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)type, (uint64_t)version, (uint64_t)path, (uint64_t)iounit };
+        trace_ring_record(TRACE_V9FS_CREATE_RETURN, args, 6, NULL);
+    }
 }
 
 static inline void trace_v9fs_symlink(uint16_t tag, uint8_t id, int32_t fid, char* name, char* symname, uint32_t gid)
 {
+    if (trace_event_get_state(TRACE_V9FS_SYMLINK)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uintptr_t)name, (uintptr_t)symname, (uint64_t)gid };
+        trace_ring_record(TRACE_V9FS_SYMLINK, args, 6, name);
+    }
 }
 
 static inline void trace_v9fs_symlink_return(uint16_t tag, uint8_t id, int8_t type, int32_t version, int64_t path)
 {
+    if (trace_event_get_state(TRACE_V9FS_SYMLINK_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)type, (uint64_t)version, (uint64_t)path };
+        trace_ring_record(TRACE_V9FS_SYMLINK_RETURN, args, 5, NULL);
+    }
 }
 
 static inline void trace_v9fs_flush(uint16_t tag, uint8_t id, int16_t flush_tag)
 {
+    if (trace_event_get_state(TRACE_V9FS_FLUSH)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)flush_tag };
+        trace_ring_record(TRACE_V9FS_FLUSH, args, 3, NULL);
+    }
 }
 
 static inline void trace_v9fs_link(uint16_t tag, uint8_t id, int32_t dfid, int32_t oldfid, char* name)
 {
+    if (trace_event_get_state(TRACE_V9FS_LINK)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)dfid, (uint64_t)oldfid, (uintptr_t)name };
+        trace_ring_record(TRACE_V9FS_LINK, args, 5, name);
+    }
 }
 
 static inline void trace_v9fs_remove(uint16_t tag, uint8_t id, int32_t fid)
 {
+    if (trace_event_get_state(TRACE_V9FS_REMOVE)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid };
+        trace_ring_record(TRACE_V9FS_REMOVE, args, 3, NULL);
+    }
 }
 
 static inline void trace_v9fs_wstat(uint16_t tag, uint8_t id, int32_t fid, int32_t mode, int32_t atime, int32_t mtime)
 {
+    if (trace_event_get_state(TRACE_V9FS_WSTAT)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uint64_t)mode, (uint64_t)atime, (uint64_t)mtime };
+        trace_ring_record(TRACE_V9FS_WSTAT, args, 6, NULL);
+    }
 }
 
 static inline void trace_v9fs_mknod(uint16_t tag, uint8_t id, int32_t fid, int mode, int major, int minor)
 {
+    if (trace_event_get_state(TRACE_V9FS_MKNOD)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uint64_t)mode, (uint64_t)major, (uint64_t)minor };
+        trace_ring_record(TRACE_V9FS_MKNOD, args, 6, NULL);
+    }
 }
 
 static inline void trace_v9fs_mknod_return(uint16_t tag, uint8_t id, int8_t type, int32_t version, int64_t path)
 {
+    if (trace_event_get_state(TRACE_V9FS_MKNOD_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)type, (uint64_t)version, (uint64_t)path };
+        trace_ring_record(TRACE_V9FS_MKNOD_RETURN, args, 5, NULL);
+    }
 }
 
 static inline void trace_v9fs_lock(uint16_t tag, uint8_t id, int32_t fid, uint8_t type, uint64_t start, uint64_t length)
 {
+    if (trace_event_get_state(TRACE_V9FS_LOCK)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uint64_t)type, (uint64_t)start, (uint64_t)length };
+        trace_ring_record(TRACE_V9FS_LOCK, args, 6, NULL);
+    }
 }
 
 static inline void trace_v9fs_lock_return(uint16_t tag, uint8_t id, int8_t status)
 {
+    if (trace_event_get_state(TRACE_V9FS_LOCK_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)status };
+        trace_ring_record(TRACE_V9FS_LOCK_RETURN, args, 3, NULL);
+    }
 }
 
 static inline void trace_v9fs_getlock(uint16_t tag, uint8_t id, int32_t fid, uint8_t type, uint64_t start, uint64_t length)
 {
+    if (trace_event_get_state(TRACE_V9FS_GETLOCK)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uint64_t)type, (uint64_t)start, (uint64_t)length };
+        trace_ring_record(TRACE_V9FS_GETLOCK, args, 6, NULL);
+    }
 }
 
 static inline void trace_v9fs_getlock_return(uint16_t tag, uint8_t id, uint8_t type, uint64_t start, uint64_t length, uint32_t proc_id)
 {
+    if (trace_event_get_state(TRACE_V9FS_GETLOCK_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)type, (uint64_t)start, (uint64_t)length, (uint64_t)proc_id };
+        trace_ring_record(TRACE_V9FS_GETLOCK_RETURN, args, 6, NULL);
+    }
 }
 
 static inline void trace_v9fs_mkdir(uint16_t tag, uint8_t id, int32_t fid, char* name, int mode, uint32_t gid)
 {
+    if (trace_event_get_state(TRACE_V9FS_MKDIR)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uintptr_t)name, (uint64_t)mode, (uint64_t)gid };
+        trace_ring_record(TRACE_V9FS_MKDIR, args, 6, name);
+    }
 }
 
 static inline void trace_v9fs_mkdir_return(uint16_t tag, uint8_t id, int8_t type, int32_t version, int64_t path, int err)
 {
+    if (trace_event_get_state(TRACE_V9FS_MKDIR_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)type, (uint64_t)version, (uint64_t)path, (uint64_t)err };
+        trace_ring_record(TRACE_V9FS_MKDIR_RETURN, args, 6, NULL);
+    }
 }
 
 static inline void trace_v9fs_xattrwalk(uint16_t tag, uint8_t id, int32_t fid, int32_t newfid, char* name)
 {
+    if (trace_event_get_state(TRACE_V9FS_XATTRWALK)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uint64_t)newfid, (uintptr_t)name };
+        trace_ring_record(TRACE_V9FS_XATTRWALK, args, 5, name);
+    }
 }
 
 static inline void trace_v9fs_xattrwalk_return(uint16_t tag, uint8_t id, int64_t size)
 {
+    if (trace_event_get_state(TRACE_V9FS_XATTRWALK_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)size };
+        trace_ring_record(TRACE_V9FS_XATTRWALK_RETURN, args, 3, NULL);
+    }
 }
 
 static inline void trace_v9fs_xattrcreate(uint16_t tag, uint8_t id, int32_t fid, char* name, int64_t size, int flags)
 {
+    if (trace_event_get_state(TRACE_V9FS_XATTRCREATE)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid, (uintptr_t)name, (uint64_t)size, (uint64_t)flags };
+        trace_ring_record(TRACE_V9FS_XATTRCREATE, args, 6, name);
+    }
 }
 
 static inline void trace_v9fs_readlink(uint16_t tag, uint8_t id, int32_t fid)
 {
+    if (trace_event_get_state(TRACE_V9FS_READLINK)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uint64_t)fid };
+        trace_ring_record(TRACE_V9FS_READLINK, args, 3, NULL);
+    }
 }
 
 static inline void trace_v9fs_readlink_return(uint16_t tag, uint8_t id, char* target)
 {
+    if (trace_event_get_state(TRACE_V9FS_READLINK_RETURN)) {
+        uint64_t args[] = { (uint64_t)tag, (uint64_t)id, (uintptr_t)target };
+        trace_ring_record(TRACE_V9FS_READLINK_RETURN, args, 3, target);
+    }
 }
 
 static inline void trace_mmu_helper_dfault(uint64_t address, uint64_t context, int mmu_idx, uint32_t tl)
 {
+    if (trace_event_get_state(TRACE_MMU_HELPER_DFAULT)) {
+        uint64_t args[] = { (uint64_t)address, (uint64_t)context, (uint64_t)mmu_idx, (uint64_t)tl };
+        trace_ring_record(TRACE_MMU_HELPER_DFAULT, args, 4, NULL);
+    }
 }
 
 static inline void trace_mmu_helper_dprot(uint64_t address, uint64_t context, int mmu_idx, uint32_t tl)
 {
+    if (trace_event_get_state(TRACE_MMU_HELPER_DPROT)) {
+        uint64_t args[] = { (uint64_t)address, (uint64_t)context, (uint64_t)mmu_idx, (uint64_t)tl };
+        trace_ring_record(TRACE_MMU_HELPER_DPROT, args, 4, NULL);
+    }
 }
 
 static inline void trace_mmu_helper_dmiss(uint64_t address, uint64_t context)
 {
+    if (trace_event_get_state(TRACE_MMU_HELPER_DMISS)) {
+        uint64_t args[] = { (uint64_t)address, (uint64_t)context };
+        trace_ring_record(TRACE_MMU_HELPER_DMISS, args, 2, NULL);
+    }
 }
 
 static inline void trace_mmu_helper_tfault(uint64_t address, uint64_t context)
 {
+    if (trace_event_get_state(TRACE_MMU_HELPER_TFAULT)) {
+        uint64_t args[] = { (uint64_t)address, (uint64_t)context };
+        trace_ring_record(TRACE_MMU_HELPER_TFAULT, args, 2, NULL);
+    }
 }
 
 static inline void trace_mmu_helper_tmiss(uint64_t address, uint64_t context)
 {
+    if (trace_event_get_state(TRACE_MMU_HELPER_TMISS)) {
+        uint64_t args[] = { (uint64_t)address, (uint64_t)context };
+        trace_ring_record(TRACE_MMU_HELPER_TMISS, args, 2, NULL);
+    }
 }
 
 static inline void trace_mmu_helper_get_phys_addr_code(uint32_t tl, int mmu_idx, uint64_t prim_context, uint64_t sec_context, uint64_t address)
 {
+    if (trace_event_get_state(TRACE_MMU_HELPER_GET_PHYS_ADDR_CODE)) {
+        uint64_t args[] = { (uint64_t)tl, (uint64_t)mmu_idx, (uint64_t)prim_context, (uint64_t)sec_context, (uint64_t)address };
+        trace_ring_record(TRACE_MMU_HELPER_GET_PHYS_ADDR_CODE, args, 5, NULL);
+    }
 }
 
 static inline void trace_mmu_helper_get_phys_addr_data(uint32_t tl, int mmu_idx, uint64_t prim_context, uint64_t sec_context, uint64_t address)
 {
+    if (trace_event_get_state(TRACE_MMU_HELPER_GET_PHYS_ADDR_DATA)) {
+        uint64_t args[] = { (uint64_t)tl, (uint64_t)mmu_idx, (uint64_t)prim_context, (uint64_t)sec_context, (uint64_t)address };
+        trace_ring_record(TRACE_MMU_HELPER_GET_PHYS_ADDR_DATA, args, 5, NULL);
+    }
 }
 
 static inline void trace_mmu_helper_mmu_fault(uint64_t address, uint64_t paddr, int mmu_idx, uint32_t tl, uint64_t prim_context, uint64_t sec_context)
 {
+    if (trace_event_get_state(TRACE_MMU_HELPER_MMU_FAULT)) {
+        uint64_t args[] = { (uint64_t)address, (uint64_t)paddr, (uint64_t)mmu_idx, (uint64_t)tl, (uint64_t)prim_context, (uint64_t)sec_context };
+        trace_ring_record(TRACE_MMU_HELPER_MMU_FAULT, args, 6, NULL);
+    }
 }
 
 static inline void trace_int_helper_set_softint(uint32_t softint)
 {
+    if (trace_event_get_state(TRACE_INT_HELPER_SET_SOFTINT)) {
+        uint64_t args[] = { (uint64_t)softint };
+        trace_ring_record(TRACE_INT_HELPER_SET_SOFTINT, args, 1, NULL);
+    }
 }
 
 static inline void trace_int_helper_clear_softint(uint32_t softint)
 {
+    if (trace_event_get_state(TRACE_INT_HELPER_CLEAR_SOFTINT)) {
+        uint64_t args[] = { (uint64_t)softint };
+        trace_ring_record(TRACE_INT_HELPER_CLEAR_SOFTINT, args, 1, NULL);
+    }
 }
 
 static inline void trace_int_helper_write_softint(uint32_t softint)
 {
+    if (trace_event_get_state(TRACE_INT_HELPER_WRITE_SOFTINT)) {
+        uint64_t args[] = { (uint64_t)softint };
+        trace_ring_record(TRACE_INT_HELPER_WRITE_SOFTINT, args, 1, NULL);
+    }
 }
 
 static inline void trace_int_helper_icache_freeze(void)
 {
+    if (trace_event_get_state(TRACE_INT_HELPER_ICACHE_FREEZE)) {
+        trace_ring_record(TRACE_INT_HELPER_ICACHE_FREEZE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_int_helper_dcache_freeze(void)
 {
+    if (trace_event_get_state(TRACE_INT_HELPER_DCACHE_FREEZE)) {
+        trace_ring_record(TRACE_INT_HELPER_DCACHE_FREEZE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_win_helper_gregset_error(uint32_t pstate)
 {
+    if (trace_event_get_state(TRACE_WIN_HELPER_GREGSET_ERROR)) {
+        uint64_t args[] = { (uint64_t)pstate };
+        trace_ring_record(TRACE_WIN_HELPER_GREGSET_ERROR, args, 1, NULL);
+    }
 }
 
 static inline void trace_win_helper_switch_pstate(uint32_t pstate_regs, uint32_t new_pstate_regs)
 {
+    if (trace_event_get_state(TRACE_WIN_HELPER_SWITCH_PSTATE)) {
+        uint64_t args[] = { (uint64_t)pstate_regs, (uint64_t)new_pstate_regs };
+        trace_ring_record(TRACE_WIN_HELPER_SWITCH_PSTATE, args, 2, NULL);
+    }
 }
 
 static inline void trace_win_helper_no_switch_pstate(uint32_t new_pstate_regs)
 {
+    if (trace_event_get_state(TRACE_WIN_HELPER_NO_SWITCH_PSTATE)) {
+        uint64_t args[] = { (uint64_t)new_pstate_regs };
+        trace_ring_record(TRACE_WIN_HELPER_NO_SWITCH_PSTATE, args, 1, NULL);
+    }
 }
 
 static inline void trace_win_helper_wrpil(uint32_t psrpil, uint32_t new_pil)
 {
+    if (trace_event_get_state(TRACE_WIN_HELPER_WRPIL)) {
+        uint64_t args[] = { (uint64_t)psrpil, (uint64_t)new_pil };
+        trace_ring_record(TRACE_WIN_HELPER_WRPIL, args, 2, NULL);
+    }
 }
 
 static inline void trace_win_helper_done(uint32_t tl)
 {
+    if (trace_event_get_state(TRACE_WIN_HELPER_DONE)) {
+        uint64_t args[] = { (uint64_t)tl };
+        trace_ring_record(TRACE_WIN_HELPER_DONE, args, 1, NULL);
+    }
 }
 
 static inline void trace_win_helper_retry(uint32_t tl)
 {
+    if (trace_event_get_state(TRACE_WIN_HELPER_RETRY)) {
+        uint64_t args[] = { (uint64_t)tl };
+        trace_ring_record(TRACE_WIN_HELPER_RETRY, args, 1, NULL);
+    }
 }
 
 static inline void trace_dma_blk_io(void * dbs, void * bs, int64_t sector_num, bool to_dev)
 {
+    if (trace_event_get_state(TRACE_DMA_BLK_IO)) {
+        uint64_t args[] = { (uintptr_t)dbs, (uintptr_t)bs, (uint64_t)sector_num, (uint64_t)to_dev };
+        trace_ring_record(TRACE_DMA_BLK_IO, args, 4, NULL);
+    }
 }
 
 static inline void trace_dma_aio_cancel(void * dbs)
 {
+    if (trace_event_get_state(TRACE_DMA_AIO_CANCEL)) {
+        uint64_t args[] = { (uintptr_t)dbs };
+        trace_ring_record(TRACE_DMA_AIO_CANCEL, args, 1, NULL);
+    }
 }
 
 static inline void trace_dma_complete(void * dbs, int ret, void * cb)
 {
+    if (trace_event_get_state(TRACE_DMA_COMPLETE)) {
+        uint64_t args[] = { (uintptr_t)dbs, (uint64_t)ret, (uintptr_t)cb };
+        trace_ring_record(TRACE_DMA_COMPLETE, args, 3, NULL);
+    }
 }
 
 static inline void trace_dma_blk_cb(void * dbs, int ret)
 {
+    if (trace_event_get_state(TRACE_DMA_BLK_CB)) {
+        uint64_t args[] = { (uintptr_t)dbs, (uint64_t)ret };
+        trace_ring_record(TRACE_DMA_BLK_CB, args, 2, NULL);
+    }
 }
 
 static inline void trace_dma_map_wait(void * dbs)
 {
+    if (trace_event_get_state(TRACE_DMA_MAP_WAIT)) {
+        uint64_t args[] = { (uintptr_t)dbs };
+        trace_ring_record(TRACE_DMA_MAP_WAIT, args, 1, NULL);
+    }
 }
 
 static inline void trace_console_gfx_new(void)
 {
+    if (trace_event_get_state(TRACE_CONSOLE_GFX_NEW)) {
+        trace_ring_record(TRACE_CONSOLE_GFX_NEW, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_console_putchar_csi(int esc_param0, int esc_param1, int ch, int nb_esc_params)
 {
+    if (trace_event_get_state(TRACE_CONSOLE_PUTCHAR_CSI)) {
+        uint64_t args[] = { (uint64_t)esc_param0, (uint64_t)esc_param1, (uint64_t)ch, (uint64_t)nb_esc_params };
+        trace_ring_record(TRACE_CONSOLE_PUTCHAR_CSI, args, 4, NULL);
+    }
 }
 
 static inline void trace_console_putchar_unhandled(int ch)
 {
+    if (trace_event_get_state(TRACE_CONSOLE_PUTCHAR_UNHANDLED)) {
+        uint64_t args[] = { (uint64_t)ch };
+        trace_ring_record(TRACE_CONSOLE_PUTCHAR_UNHANDLED, args, 1, NULL);
+    }
 }
 
 static inline void trace_console_txt_new(int w, int h)
 {
+    if (trace_event_get_state(TRACE_CONSOLE_TXT_NEW)) {
+        uint64_t args[] = { (uint64_t)w, (uint64_t)h };
+        trace_ring_record(TRACE_CONSOLE_TXT_NEW, args, 2, NULL);
+    }
 }
 
 static inline void trace_console_select(int nr)
 {
+    if (trace_event_get_state(TRACE_CONSOLE_SELECT)) {
+        uint64_t args[] = { (uint64_t)nr };
+        trace_ring_record(TRACE_CONSOLE_SELECT, args, 1, NULL);
+    }
 }
 
 static inline void trace_console_refresh(int interval)
 {
+    if (trace_event_get_state(TRACE_CONSOLE_REFRESH)) {
+        uint64_t args[] = { (uint64_t)interval };
+        trace_ring_record(TRACE_CONSOLE_REFRESH, args, 1, NULL);
+    }
 }
 
 static inline void trace_displaysurface_create(void * display_surface, int w, int h)
 {
+    if (trace_event_get_state(TRACE_DISPLAYSURFACE_CREATE)) {
+        uint64_t args[] = { (uintptr_t)display_surface, (uint64_t)w, (uint64_t)h };
+        trace_ring_record(TRACE_DISPLAYSURFACE_CREATE, args, 3, NULL);
+    }
 }
 
 static inline void trace_displaysurface_create_from(void * display_surface, int w, int h, uint32_t format)
 {
+    if (trace_event_get_state(TRACE_DISPLAYSURFACE_CREATE_FROM)) {
+        uint64_t args[] = { (uintptr_t)display_surface, (uint64_t)w, (uint64_t)h, (uint64_t)format };
+        trace_ring_record(TRACE_DISPLAYSURFACE_CREATE_FROM, args, 4, NULL);
+    }
 }
 
 static inline void trace_displaysurface_free(void * display_surface)
 {
+    if (trace_event_get_state(TRACE_DISPLAYSURFACE_FREE)) {
+        uint64_t args[] = { (uintptr_t)display_surface };
+        trace_ring_record(TRACE_DISPLAYSURFACE_FREE, args, 1, NULL);
+    }
 }
 
 static inline void trace_displaychangelistener_register(void * dcl, const char * name)
 {
+    if (trace_event_get_state(TRACE_DISPLAYCHANGELISTENER_REGISTER)) {
+        uint64_t args[] = { (uintptr_t)dcl, (uintptr_t)name };
+        trace_ring_record(TRACE_DISPLAYCHANGELISTENER_REGISTER, args, 2, name);
+    }
 }
 
 static inline void trace_displaychangelistener_unregister(void * dcl, const char * name)
 {
+    if (trace_event_get_state(TRACE_DISPLAYCHANGELISTENER_UNREGISTER)) {
+        uint64_t args[] = { (uintptr_t)dcl, (uintptr_t)name };
+        trace_ring_record(TRACE_DISPLAYCHANGELISTENER_UNREGISTER, args, 2, name);
+    }
 }
 
 static inline void trace_ppm_save(const char * filename, void * display_surface)
 {
+    if (trace_event_get_state(TRACE_PPM_SAVE)) {
+        uint64_t args[] = { (uintptr_t)filename, (uintptr_t)display_surface };
+        trace_ring_record(TRACE_PPM_SAVE, args, 2, filename);
+    }
 }
 
 static inline void trace_gd_switch(const char * tab, int width, int height)
 {
+    if (trace_event_get_state(TRACE_GD_SWITCH)) {
+        uint64_t args[] = { (uintptr_t)tab, (uint64_t)width, (uint64_t)height };
+        trace_ring_record(TRACE_GD_SWITCH, args, 3, tab);
+    }
 }
 
 static inline void trace_gd_update(const char * tab, int x, int y, int w, int h)
 {
+    if (trace_event_get_state(TRACE_GD_UPDATE)) {
+        uint64_t args[] = { (uintptr_t)tab, (uint64_t)x, (uint64_t)y, (uint64_t)w, (uint64_t)h };
+        trace_ring_record(TRACE_GD_UPDATE, args, 5, tab);
+    }
 }
 
 static inline void trace_gd_key_event(const char * tab, int gdk_keycode, int qemu_keycode, const char * action)
 {
+    if (trace_event_get_state(TRACE_GD_KEY_EVENT)) {
+        uint64_t args[] = { (uintptr_t)tab, (uint64_t)gdk_keycode, (uint64_t)qemu_keycode, (uintptr_t)action };
+        trace_ring_record(TRACE_GD_KEY_EVENT, args, 4, tab);
+    }
 }
 
 static inline void trace_gd_grab(const char * tab, const char * device, bool on)
 {
+    if (trace_event_get_state(TRACE_GD_GRAB)) {
+        uint64_t args[] = { (uintptr_t)tab, (uintptr_t)device, (uint64_t)on };
+        trace_ring_record(TRACE_GD_GRAB, args, 3, tab);
+    }
 }
 
 static inline void trace_vnc_key_guest_leds(bool caps, bool num, bool scroll)
 {
+    if (trace_event_get_state(TRACE_VNC_KEY_GUEST_LEDS)) {
+        uint64_t args[] = { (uint64_t)caps, (uint64_t)num, (uint64_t)scroll };
+        trace_ring_record(TRACE_VNC_KEY_GUEST_LEDS, args, 3, NULL);
+    }
 }
 
 static inline void trace_vnc_key_map_init(const char * layout)
 {
+    if (trace_event_get_state(TRACE_VNC_KEY_MAP_INIT)) {
+        uint64_t args[] = { (uintptr_t)layout };
+        trace_ring_record(TRACE_VNC_KEY_MAP_INIT, args, 1, layout);
+    }
 }
 
 static inline void trace_vnc_key_event_ext(bool down, int sym, int keycode, const char * name)
 {
+    if (trace_event_get_state(TRACE_VNC_KEY_EVENT_EXT)) {
+        uint64_t args[] = { (uint64_t)down, (uint64_t)sym, (uint64_t)keycode, (uintptr_t)name };
+        trace_ring_record(TRACE_VNC_KEY_EVENT_EXT, args, 4, name);
+    }
 }
 
 static inline void trace_vnc_key_event_map(bool down, int sym, int keycode, const char * name)
 {
+    if (trace_event_get_state(TRACE_VNC_KEY_EVENT_MAP)) {
+        uint64_t args[] = { (uint64_t)down, (uint64_t)sym, (uint64_t)keycode, (uintptr_t)name };
+        trace_ring_record(TRACE_VNC_KEY_EVENT_MAP, args, 4, name);
+    }
 }
 
 static inline void trace_vnc_key_sync_numlock(bool on)
 {
+    if (trace_event_get_state(TRACE_VNC_KEY_SYNC_NUMLOCK)) {
+        uint64_t args[] = { (uint64_t)on };
+        trace_ring_record(TRACE_VNC_KEY_SYNC_NUMLOCK, args, 1, NULL);
+    }
 }
 
 static inline void trace_vnc_key_sync_capslock(bool on)
 {
+    if (trace_event_get_state(TRACE_VNC_KEY_SYNC_CAPSLOCK)) {
+        uint64_t args[] = { (uint64_t)on };
+        trace_ring_record(TRACE_VNC_KEY_SYNC_CAPSLOCK, args, 1, NULL);
+    }
 }
 
 static inline void trace_input_event_key_number(int conidx, int number, const char * qcode, bool down)
 {
+    if (trace_event_get_state(TRACE_INPUT_EVENT_KEY_NUMBER)) {
+        uint64_t args[] = { (uint64_t)conidx, (uint64_t)number, (uintptr_t)qcode, (uint64_t)down };
+        trace_ring_record(TRACE_INPUT_EVENT_KEY_NUMBER, args, 4, qcode);
+    }
 }
 
 static inline void trace_input_event_key_qcode(int conidx, const char * qcode, bool down)
 {
+    if (trace_event_get_state(TRACE_INPUT_EVENT_KEY_QCODE)) {
+        uint64_t args[] = { (uint64_t)conidx, (uintptr_t)qcode, (uint64_t)down };
+        trace_ring_record(TRACE_INPUT_EVENT_KEY_QCODE, args, 3, qcode);
+    }
 }
 
 static inline void trace_input_event_btn(int conidx, const char * btn, bool down)
 {
+    if (trace_event_get_state(TRACE_INPUT_EVENT_BTN)) {
+        uint64_t args[] = { (uint64_t)conidx, (uintptr_t)btn, (uint64_t)down };
+        trace_ring_record(TRACE_INPUT_EVENT_BTN, args, 3, btn);
+    }
 }
 
 static inline void trace_input_event_rel(int conidx, const char * axis, int value)
 {
+    if (trace_event_get_state(TRACE_INPUT_EVENT_REL)) {
+        uint64_t args[] = { (uint64_t)conidx, (uintptr_t)axis, (uint64_t)value };
+        trace_ring_record(TRACE_INPUT_EVENT_REL, args, 3, axis);
+    }
 }
 
 static inline void trace_input_event_abs(int conidx, const char * axis, int value)
 {
+    if (trace_event_get_state(TRACE_INPUT_EVENT_ABS)) {
+        uint64_t args[] = { (uint64_t)conidx, (uintptr_t)axis, (uint64_t)value };
+        trace_ring_record(TRACE_INPUT_EVENT_ABS, args, 3, axis);
+    }
 }
 
 static inline void trace_input_event_sync(void)
 {
+    if (trace_event_get_state(TRACE_INPUT_EVENT_SYNC)) {
+        trace_ring_record(TRACE_INPUT_EVENT_SYNC, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_input_mouse_mode(int absolute)
 {
+    if (trace_event_get_state(TRACE_INPUT_MOUSE_MODE)) {
+        uint64_t args[] = { (uint64_t)absolute };
+        trace_ring_record(TRACE_INPUT_MOUSE_MODE, args, 1, NULL);
+    }
 }
 
 static inline void trace_vmware_value_read(uint32_t index, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_VMWARE_VALUE_READ)) {
+        uint64_t args[] = { (uint64_t)index, (uint64_t)value };
+        trace_ring_record(TRACE_VMWARE_VALUE_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_vmware_value_write(uint32_t index, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_VMWARE_VALUE_WRITE)) {
+        uint64_t args[] = { (uint64_t)index, (uint64_t)value };
+        trace_ring_record(TRACE_VMWARE_VALUE_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_vmware_palette_read(uint32_t index, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_VMWARE_PALETTE_READ)) {
+        uint64_t args[] = { (uint64_t)index, (uint64_t)value };
+        trace_ring_record(TRACE_VMWARE_PALETTE_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_vmware_palette_write(uint32_t index, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_VMWARE_PALETTE_WRITE)) {
+        uint64_t args[] = { (uint64_t)index, (uint64_t)value };
+        trace_ring_record(TRACE_VMWARE_PALETTE_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_vmware_scratch_read(uint32_t index, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_VMWARE_SCRATCH_READ)) {
+        uint64_t args[] = { (uint64_t)index, (uint64_t)value };
+        trace_ring_record(TRACE_VMWARE_SCRATCH_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_vmware_scratch_write(uint32_t index, uint32_t value)
 {
+    if (trace_event_get_state(TRACE_VMWARE_SCRATCH_WRITE)) {
+        uint64_t args[] = { (uint64_t)index, (uint64_t)value };
+        trace_ring_record(TRACE_VMWARE_SCRATCH_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_vmware_setmode(uint32_t w, uint32_t h, uint32_t bpp)
 {
+    if (trace_event_get_state(TRACE_VMWARE_SETMODE)) {
+        uint64_t args[] = { (uint64_t)w, (uint64_t)h, (uint64_t)bpp };
+        trace_ring_record(TRACE_VMWARE_SETMODE, args, 3, NULL);
+    }
 }
 
 static inline void trace_qemu_loadvm_state_section(unsigned int section_type)
 {
+    if (trace_event_get_state(TRACE_QEMU_LOADVM_STATE_SECTION)) {
+        uint64_t args[] = { (uint64_t)section_type };
+        trace_ring_record(TRACE_QEMU_LOADVM_STATE_SECTION, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_loadvm_state_section_partend(uint32_t section_id)
 {
+    if (trace_event_get_state(TRACE_QEMU_LOADVM_STATE_SECTION_PARTEND)) {
+        uint64_t args[] = { (uint64_t)section_id };
+        trace_ring_record(TRACE_QEMU_LOADVM_STATE_SECTION_PARTEND, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_loadvm_state_section_startfull(uint32_t section_id, const char * idstr, uint32_t instance_id, uint32_t version_id)
 {
+    if (trace_event_get_state(TRACE_QEMU_LOADVM_STATE_SECTION_STARTFULL)) {
+        uint64_t args[] = { (uint64_t)section_id, (uintptr_t)idstr, (uint64_t)instance_id, (uint64_t)version_id };
+        trace_ring_record(TRACE_QEMU_LOADVM_STATE_SECTION_STARTFULL, args, 4, idstr);
+    }
 }
 
 static inline void trace_savevm_section_start(const char * id, unsigned int section_id)
 {
+    if (trace_event_get_state(TRACE_SAVEVM_SECTION_START)) {
+        uint64_t args[] = { (uintptr_t)id, (uint64_t)section_id };
+        trace_ring_record(TRACE_SAVEVM_SECTION_START, args, 2, id);
+    }
 }
 
 static inline void trace_savevm_section_end(const char * id, unsigned int section_id, int ret)
 {
+    if (trace_event_get_state(TRACE_SAVEVM_SECTION_END)) {
+        uint64_t args[] = { (uintptr_t)id, (uint64_t)section_id, (uint64_t)ret };
+        trace_ring_record(TRACE_SAVEVM_SECTION_END, args, 3, id);
+    }
 }
 
 static inline void trace_savevm_state_begin(void)
 {
+    if (trace_event_get_state(TRACE_SAVEVM_STATE_BEGIN)) {
+        trace_ring_record(TRACE_SAVEVM_STATE_BEGIN, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_savevm_state_iterate(void)
 {
+    if (trace_event_get_state(TRACE_SAVEVM_STATE_ITERATE)) {
+        trace_ring_record(TRACE_SAVEVM_STATE_ITERATE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_savevm_state_complete(void)
 {
+    if (trace_event_get_state(TRACE_SAVEVM_STATE_COMPLETE)) {
+        trace_ring_record(TRACE_SAVEVM_STATE_COMPLETE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_savevm_state_cancel(void)
 {
+    if (trace_event_get_state(TRACE_SAVEVM_STATE_CANCEL)) {
+        trace_ring_record(TRACE_SAVEVM_STATE_CANCEL, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_vmstate_save(const char * idstr, const char * vmsd_name)
 {
+    if (trace_event_get_state(TRACE_VMSTATE_SAVE)) {
+        uint64_t args[] = { (uintptr_t)idstr, (uintptr_t)vmsd_name };
+        trace_ring_record(TRACE_VMSTATE_SAVE, args, 2, idstr);
+    }
 }
 
 static inline void trace_vmstate_load(const char * idstr, const char * vmsd_name)
 {
+    if (trace_event_get_state(TRACE_VMSTATE_LOAD)) {
+        uint64_t args[] = { (uintptr_t)idstr, (uintptr_t)vmsd_name };
+        trace_ring_record(TRACE_VMSTATE_LOAD, args, 2, idstr);
+    }
 }
 
 static inline void trace_qemu_announce_self_iter(const char * mac)
 {
+    if (trace_event_get_state(TRACE_QEMU_ANNOUNCE_SELF_ITER)) {
+        uint64_t args[] = { (uintptr_t)mac };
+        trace_ring_record(TRACE_QEMU_ANNOUNCE_SELF_ITER, args, 1, mac);
+    }
 }
 
 static inline void trace_vmstate_load_field_error(const char * field, int ret)
 {
+    if (trace_event_get_state(TRACE_VMSTATE_LOAD_FIELD_ERROR)) {
+        uint64_t args[] = { (uintptr_t)field, (uint64_t)ret };
+        trace_ring_record(TRACE_VMSTATE_LOAD_FIELD_ERROR, args, 2, field);
+    }
 }
 
 static inline void trace_vmstate_load_state(const char * name, int version_id)
 {
+    if (trace_event_get_state(TRACE_VMSTATE_LOAD_STATE)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)version_id };
+        trace_ring_record(TRACE_VMSTATE_LOAD_STATE, args, 2, name);
+    }
 }
 
 static inline void trace_vmstate_load_state_end(const char * name, const char * reason, int val)
 {
+    if (trace_event_get_state(TRACE_VMSTATE_LOAD_STATE_END)) {
+        uint64_t args[] = { (uintptr_t)name, (uintptr_t)reason, (uint64_t)val };
+        trace_ring_record(TRACE_VMSTATE_LOAD_STATE_END, args, 3, name);
+    }
 }
 
 static inline void trace_vmstate_load_state_field(const char * name, const char * field)
 {
+    if (trace_event_get_state(TRACE_VMSTATE_LOAD_STATE_FIELD)) {
+        uint64_t args[] = { (uintptr_t)name, (uintptr_t)field };
+        trace_ring_record(TRACE_VMSTATE_LOAD_STATE_FIELD, args, 2, name);
+    }
 }
 
 static inline void trace_vmstate_subsection_load(const char * parent)
 {
+    if (trace_event_get_state(TRACE_VMSTATE_SUBSECTION_LOAD)) {
+        uint64_t args[] = { (uintptr_t)parent };
+        trace_ring_record(TRACE_VMSTATE_SUBSECTION_LOAD, args, 1, parent);
+    }
 }
 
 static inline void trace_vmstate_subsection_load_bad(const char * parent, const char * sub)
 {
+    if (trace_event_get_state(TRACE_VMSTATE_SUBSECTION_LOAD_BAD)) {
+        uint64_t args[] = { (uintptr_t)parent, (uintptr_t)sub };
+        trace_ring_record(TRACE_VMSTATE_SUBSECTION_LOAD_BAD, args, 2, parent);
+    }
 }
 
 static inline void trace_vmstate_subsection_load_good(const char * parent)
 {
+    if (trace_event_get_state(TRACE_VMSTATE_SUBSECTION_LOAD_GOOD)) {
+        uint64_t args[] = { (uintptr_t)parent };
+        trace_ring_record(TRACE_VMSTATE_SUBSECTION_LOAD_GOOD, args, 1, parent);
+    }
 }
 
 static inline void trace_qemu_file_fclose(void)
 {
+    if (trace_event_get_state(TRACE_QEMU_FILE_FCLOSE)) {
+        trace_ring_record(TRACE_QEMU_FILE_FCLOSE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_migration_bitmap_sync_start(void)
 {
+    if (trace_event_get_state(TRACE_MIGRATION_BITMAP_SYNC_START)) {
+        trace_ring_record(TRACE_MIGRATION_BITMAP_SYNC_START, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_migration_bitmap_sync_end(uint64_t dirty_pages)
 {
+    if (trace_event_get_state(TRACE_MIGRATION_BITMAP_SYNC_END)) {
+        uint64_t args[] = { (uint64_t)dirty_pages };
+        trace_ring_record(TRACE_MIGRATION_BITMAP_SYNC_END, args, 1, NULL);
+    }
 }
 
 static inline void trace_migration_throttle(void)
 {
+    if (trace_event_get_state(TRACE_MIGRATION_THROTTLE)) {
+        trace_ring_record(TRACE_MIGRATION_THROTTLE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_qxl_interface_set_mm_time(int qid, uint32_t mm_time)
 {
+    if (trace_event_get_state(TRACE_QXL_INTERFACE_SET_MM_TIME)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)mm_time };
+        trace_ring_record(TRACE_QXL_INTERFACE_SET_MM_TIME, args, 2, NULL);
+    }
 }
 
 static inline void trace_qxl_io_write_vga(int qid, const char * mode, uint32_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_QXL_IO_WRITE_VGA)) {
+        uint64_t args[] = { (uint64_t)qid, (uintptr_t)mode, (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_QXL_IO_WRITE_VGA, args, 4, mode);
+    }
 }
 
 static inline void trace_qxl_create_guest_primary(int qid, uint32_t width, uint32_t height, uint64_t mem, uint32_t format, uint32_t position)
 {
+    if (trace_event_get_state(TRACE_QXL_CREATE_GUEST_PRIMARY)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)width, (uint64_t)height, (uint64_t)mem, (uint64_t)format, (uint64_t)position };
+        trace_ring_record(TRACE_QXL_CREATE_GUEST_PRIMARY, args, 6, NULL);
+    }
 }
 
 static inline void trace_qxl_create_guest_primary_rest(int qid, int32_t stride, uint32_t type, uint32_t flags)
 {
+    if (trace_event_get_state(TRACE_QXL_CREATE_GUEST_PRIMARY_REST)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)stride, (uint64_t)type, (uint64_t)flags };
+        trace_ring_record(TRACE_QXL_CREATE_GUEST_PRIMARY_REST, args, 4, NULL);
+    }
 }
 
 static inline void trace_qxl_destroy_primary(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_DESTROY_PRIMARY)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_DESTROY_PRIMARY, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_enter_vga_mode(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_ENTER_VGA_MODE)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_ENTER_VGA_MODE, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_exit_vga_mode(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_EXIT_VGA_MODE)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_EXIT_VGA_MODE, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_hard_reset(int qid, int64_t loadvm)
 {
+    if (trace_event_get_state(TRACE_QXL_HARD_RESET)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)loadvm };
+        trace_ring_record(TRACE_QXL_HARD_RESET, args, 2, NULL);
+    }
 }
 
 static inline void trace_qxl_interface_async_complete_io(int qid, uint32_t current_async, void * cookie)
 {
+    if (trace_event_get_state(TRACE_QXL_INTERFACE_ASYNC_COMPLETE_IO)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)current_async, (uintptr_t)cookie };
+        trace_ring_record(TRACE_QXL_INTERFACE_ASYNC_COMPLETE_IO, args, 3, NULL);
+    }
 }
 
 static inline void trace_qxl_interface_attach_worker(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_INTERFACE_ATTACH_WORKER)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_INTERFACE_ATTACH_WORKER, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_interface_get_init_info(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_INTERFACE_GET_INIT_INFO)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_INTERFACE_GET_INIT_INFO, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_interface_set_compression_level(int qid, int64_t level)
 {
+    if (trace_event_get_state(TRACE_QXL_INTERFACE_SET_COMPRESSION_LEVEL)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)level };
+        trace_ring_record(TRACE_QXL_INTERFACE_SET_COMPRESSION_LEVEL, args, 2, NULL);
+    }
 }
 
 static inline void trace_qxl_interface_update_area_complete(int qid, uint32_t surface_id, uint32_t dirty_left, uint32_t dirty_right, uint32_t dirty_top, uint32_t dirty_bottom)
 {
+    if (trace_event_get_state(TRACE_QXL_INTERFACE_UPDATE_AREA_COMPLETE)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)surface_id, (uint64_t)dirty_left, (uint64_t)dirty_right, (uint64_t)dirty_top, (uint64_t)dirty_bottom };
+        trace_ring_record(TRACE_QXL_INTERFACE_UPDATE_AREA_COMPLETE, args, 6, NULL);
+    }
 }
 
 static inline void trace_qxl_interface_update_area_complete_rest(int qid, uint32_t num_updated_rects)
 {
+    if (trace_event_get_state(TRACE_QXL_INTERFACE_UPDATE_AREA_COMPLETE_REST)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)num_updated_rects };
+        trace_ring_record(TRACE_QXL_INTERFACE_UPDATE_AREA_COMPLETE_REST, args, 2, NULL);
+    }
 }
 
 static inline void trace_qxl_interface_update_area_complete_overflow(int qid, int max)
 {
+    if (trace_event_get_state(TRACE_QXL_INTERFACE_UPDATE_AREA_COMPLETE_OVERFLOW)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)max };
+        trace_ring_record(TRACE_QXL_INTERFACE_UPDATE_AREA_COMPLETE_OVERFLOW, args, 2, NULL);
+    }
 }
 
 static inline void trace_qxl_interface_update_area_complete_schedule_bh(int qid, uint32_t num_dirty)
 {
+    if (trace_event_get_state(TRACE_QXL_INTERFACE_UPDATE_AREA_COMPLETE_SCHEDULE_BH)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)num_dirty };
+        trace_ring_record(TRACE_QXL_INTERFACE_UPDATE_AREA_COMPLETE_SCHEDULE_BH, args, 2, NULL);
+    }
 }
 
 static inline void trace_qxl_io_destroy_primary_ignored(int qid, const char * mode)
 {
+    if (trace_event_get_state(TRACE_QXL_IO_DESTROY_PRIMARY_IGNORED)) {
+        uint64_t args[] = { (uint64_t)qid, (uintptr_t)mode };
+        trace_ring_record(TRACE_QXL_IO_DESTROY_PRIMARY_IGNORED, args, 2, mode);
+    }
 }
 
 static inline void trace_qxl_io_log(int qid, const uint8_t * log_buf)
 {
+    if (trace_event_get_state(TRACE_QXL_IO_LOG)) {
+        uint64_t args[] = { (uint64_t)qid, (uintptr_t)log_buf };
+        trace_ring_record(TRACE_QXL_IO_LOG, args, 2, NULL);
+    }
 }
 
 static inline void trace_qxl_io_read_unexpected(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_IO_READ_UNEXPECTED)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_IO_READ_UNEXPECTED, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_io_unexpected_vga_mode(int qid, uint64_t addr, uint64_t val, const char * desc)
 {
+    if (trace_event_get_state(TRACE_QXL_IO_UNEXPECTED_VGA_MODE)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)addr, (uint64_t)val, (uintptr_t)desc };
+        trace_ring_record(TRACE_QXL_IO_UNEXPECTED_VGA_MODE, args, 4, desc);
+    }
 }
 
 static inline void trace_qxl_io_write(int qid, const char * mode, uint64_t addr, const char * aname, uint64_t val, unsigned size, int async)
 {
+    if (trace_event_get_state(TRACE_QXL_IO_WRITE)) {
+        uint64_t args[] = { (uint64_t)qid, (uintptr_t)mode, (uint64_t)addr, (uintptr_t)aname, (uint64_t)val, (uint64_t)size, (uint64_t)async };
+        trace_ring_record(TRACE_QXL_IO_WRITE, args, 7, mode);
+    }
 }
 
 static inline void trace_qxl_memslot_add_guest(int qid, uint32_t slot_id, uint64_t guest_start, uint64_t guest_end)
 {
+    if (trace_event_get_state(TRACE_QXL_MEMSLOT_ADD_GUEST)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)slot_id, (uint64_t)guest_start, (uint64_t)guest_end };
+        trace_ring_record(TRACE_QXL_MEMSLOT_ADD_GUEST, args, 4, NULL);
+    }
 }
 
 static inline void trace_qxl_post_load(int qid, const char * mode)
 {
+    if (trace_event_get_state(TRACE_QXL_POST_LOAD)) {
+        uint64_t args[] = { (uint64_t)qid, (uintptr_t)mode };
+        trace_ring_record(TRACE_QXL_POST_LOAD, args, 2, mode);
+    }
 }
 
 static inline void trace_qxl_pre_load(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_PRE_LOAD)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_PRE_LOAD, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_pre_save(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_PRE_SAVE)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_PRE_SAVE, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_reset_surfaces(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_RESET_SURFACES)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_RESET_SURFACES, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_ring_command_check(int qid, const char * mode)
 {
+    if (trace_event_get_state(TRACE_QXL_RING_COMMAND_CHECK)) {
+        uint64_t args[] = { (uint64_t)qid, (uintptr_t)mode };
+        trace_ring_record(TRACE_QXL_RING_COMMAND_CHECK, args, 2, mode);
+    }
 }
 
 static inline void trace_qxl_ring_command_get(int qid, const char * mode)
 {
+    if (trace_event_get_state(TRACE_QXL_RING_COMMAND_GET)) {
+        uint64_t args[] = { (uint64_t)qid, (uintptr_t)mode };
+        trace_ring_record(TRACE_QXL_RING_COMMAND_GET, args, 2, mode);
+    }
 }
 
 static inline void trace_qxl_ring_command_req_notification(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_RING_COMMAND_REQ_NOTIFICATION)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_RING_COMMAND_REQ_NOTIFICATION, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_ring_cursor_check(int qid, const char * mode)
 {
+    if (trace_event_get_state(TRACE_QXL_RING_CURSOR_CHECK)) {
+        uint64_t args[] = { (uint64_t)qid, (uintptr_t)mode };
+        trace_ring_record(TRACE_QXL_RING_CURSOR_CHECK, args, 2, mode);
+    }
 }
 
 static inline void trace_qxl_ring_cursor_get(int qid, const char * mode)
 {
+    if (trace_event_get_state(TRACE_QXL_RING_CURSOR_GET)) {
+        uint64_t args[] = { (uint64_t)qid, (uintptr_t)mode };
+        trace_ring_record(TRACE_QXL_RING_CURSOR_GET, args, 2, mode);
+    }
 }
 
 static inline void trace_qxl_ring_cursor_req_notification(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_RING_CURSOR_REQ_NOTIFICATION)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_RING_CURSOR_REQ_NOTIFICATION, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_ring_res_push(int qid, const char * mode, uint32_t surface_count, uint32_t free_res, void * last_release, const char * notify)
 {
+    if (trace_event_get_state(TRACE_QXL_RING_RES_PUSH)) {
+        uint64_t args[] = { (uint64_t)qid, (uintptr_t)mode, (uint64_t)surface_count, (uint64_t)free_res, (uintptr_t)last_release, (uintptr_t)notify };
+        trace_ring_record(TRACE_QXL_RING_RES_PUSH, args, 6, mode);
+    }
 }
 
 static inline void trace_qxl_ring_res_push_rest(int qid, uint32_t ring_has, uint32_t ring_size, uint32_t prod, uint32_t cons)
 {
+    if (trace_event_get_state(TRACE_QXL_RING_RES_PUSH_REST)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)ring_has, (uint64_t)ring_size, (uint64_t)prod, (uint64_t)cons };
+        trace_ring_record(TRACE_QXL_RING_RES_PUSH_REST, args, 5, NULL);
+    }
 }
 
 static inline void trace_qxl_ring_res_put(int qid, uint32_t free_res)
 {
+    if (trace_event_get_state(TRACE_QXL_RING_RES_PUT)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)free_res };
+        trace_ring_record(TRACE_QXL_RING_RES_PUT, args, 2, NULL);
+    }
 }
 
 static inline void trace_qxl_set_mode(int qid, int modenr, uint32_t x_res, uint32_t y_res, uint32_t bits, uint64_t devmem)
 {
+    if (trace_event_get_state(TRACE_QXL_SET_MODE)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)modenr, (uint64_t)x_res, (uint64_t)y_res, (uint64_t)bits, (uint64_t)devmem };
+        trace_ring_record(TRACE_QXL_SET_MODE, args, 6, NULL);
+    }
 }
 
 static inline void trace_qxl_soft_reset(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_SOFT_RESET)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_SOFT_RESET, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_spice_destroy_surfaces_complete(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_SPICE_DESTROY_SURFACES_COMPLETE)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_SPICE_DESTROY_SURFACES_COMPLETE, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_spice_destroy_surfaces(int qid, int async)
 {
+    if (trace_event_get_state(TRACE_QXL_SPICE_DESTROY_SURFACES)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)async };
+        trace_ring_record(TRACE_QXL_SPICE_DESTROY_SURFACES, args, 2, NULL);
+    }
 }
 
 static inline void trace_qxl_spice_destroy_surface_wait_complete(int qid, uint32_t id)
 {
+    if (trace_event_get_state(TRACE_QXL_SPICE_DESTROY_SURFACE_WAIT_COMPLETE)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)id };
+        trace_ring_record(TRACE_QXL_SPICE_DESTROY_SURFACE_WAIT_COMPLETE, args, 2, NULL);
+    }
 }
 
 static inline void trace_qxl_spice_destroy_surface_wait(int qid, uint32_t id, int async)
 {
+    if (trace_event_get_state(TRACE_QXL_SPICE_DESTROY_SURFACE_WAIT)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)id, (uint64_t)async };
+        trace_ring_record(TRACE_QXL_SPICE_DESTROY_SURFACE_WAIT, args, 3, NULL);
+    }
 }
 
 static inline void trace_qxl_spice_flush_surfaces_async(int qid, uint32_t surface_count, uint32_t num_free_res)
 {
+    if (trace_event_get_state(TRACE_QXL_SPICE_FLUSH_SURFACES_ASYNC)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)surface_count, (uint64_t)num_free_res };
+        trace_ring_record(TRACE_QXL_SPICE_FLUSH_SURFACES_ASYNC, args, 3, NULL);
+    }
 }
 
 static inline void trace_qxl_spice_monitors_config(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_SPICE_MONITORS_CONFIG)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_SPICE_MONITORS_CONFIG, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_spice_loadvm_commands(int qid, void * ext, uint32_t count)
 {
+    if (trace_event_get_state(TRACE_QXL_SPICE_LOADVM_COMMANDS)) {
+        uint64_t args[] = { (uint64_t)qid, (uintptr_t)ext, (uint64_t)count };
+        trace_ring_record(TRACE_QXL_SPICE_LOADVM_COMMANDS, args, 3, NULL);
+    }
 }
 
 static inline void trace_qxl_spice_oom(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_SPICE_OOM)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_SPICE_OOM, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_spice_reset_cursor(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_SPICE_RESET_CURSOR)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_SPICE_RESET_CURSOR, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_spice_reset_image_cache(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_SPICE_RESET_IMAGE_CACHE)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_SPICE_RESET_IMAGE_CACHE, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_spice_reset_memslots(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_SPICE_RESET_MEMSLOTS)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_SPICE_RESET_MEMSLOTS, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_spice_update_area(int qid, uint32_t surface_id, uint32_t left, uint32_t right, uint32_t top, uint32_t bottom)
 {
+    if (trace_event_get_state(TRACE_QXL_SPICE_UPDATE_AREA)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)surface_id, (uint64_t)left, (uint64_t)right, (uint64_t)top, (uint64_t)bottom };
+        trace_ring_record(TRACE_QXL_SPICE_UPDATE_AREA, args, 6, NULL);
+    }
 }
 
 static inline void trace_qxl_spice_update_area_rest(int qid, uint32_t num_dirty_rects, uint32_t clear_dirty_region)
 {
+    if (trace_event_get_state(TRACE_QXL_SPICE_UPDATE_AREA_REST)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)num_dirty_rects, (uint64_t)clear_dirty_region };
+        trace_ring_record(TRACE_QXL_SPICE_UPDATE_AREA_REST, args, 3, NULL);
+    }
 }
 
 static inline void trace_qxl_surfaces_dirty(int qid, int surface, int offset, int size)
 {
+    if (trace_event_get_state(TRACE_QXL_SURFACES_DIRTY)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)surface, (uint64_t)offset, (uint64_t)size };
+        trace_ring_record(TRACE_QXL_SURFACES_DIRTY, args, 4, NULL);
+    }
 }
 
 static inline void trace_qxl_send_events(int qid, uint32_t events)
 {
+    if (trace_event_get_state(TRACE_QXL_SEND_EVENTS)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)events };
+        trace_ring_record(TRACE_QXL_SEND_EVENTS, args, 2, NULL);
+    }
 }
 
 static inline void trace_qxl_send_events_vm_stopped(int qid, uint32_t events)
 {
+    if (trace_event_get_state(TRACE_QXL_SEND_EVENTS_VM_STOPPED)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)events };
+        trace_ring_record(TRACE_QXL_SEND_EVENTS_VM_STOPPED, args, 2, NULL);
+    }
 }
 
 static inline void trace_qxl_set_guest_bug(int qid)
 {
+    if (trace_event_get_state(TRACE_QXL_SET_GUEST_BUG)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QXL_SET_GUEST_BUG, args, 1, NULL);
+    }
 }
 
 static inline void trace_qxl_interrupt_client_monitors_config(int qid, int num_heads, void * heads)
 {
+    if (trace_event_get_state(TRACE_QXL_INTERRUPT_CLIENT_MONITORS_CONFIG)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)num_heads, (uintptr_t)heads };
+        trace_ring_record(TRACE_QXL_INTERRUPT_CLIENT_MONITORS_CONFIG, args, 3, NULL);
+    }
 }
 
 static inline void trace_qxl_client_monitors_config_unsupported_by_guest(int qid, uint32_t int_mask, void * client_monitors_config)
 {
+    if (trace_event_get_state(TRACE_QXL_CLIENT_MONITORS_CONFIG_UNSUPPORTED_BY_GUEST)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)int_mask, (uintptr_t)client_monitors_config };
+        trace_ring_record(TRACE_QXL_CLIENT_MONITORS_CONFIG_UNSUPPORTED_BY_GUEST, args, 3, NULL);
+    }
 }
 
 static inline void trace_qxl_client_monitors_config_unsupported_by_device(int qid, int revision)
 {
+    if (trace_event_get_state(TRACE_QXL_CLIENT_MONITORS_CONFIG_UNSUPPORTED_BY_DEVICE)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)revision };
+        trace_ring_record(TRACE_QXL_CLIENT_MONITORS_CONFIG_UNSUPPORTED_BY_DEVICE, args, 2, NULL);
+    }
 }
 
 static inline void trace_qxl_client_monitors_config_capped(int qid, int requested, int limit)
 {
+    if (trace_event_get_state(TRACE_QXL_CLIENT_MONITORS_CONFIG_CAPPED)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)requested, (uint64_t)limit };
+        trace_ring_record(TRACE_QXL_CLIENT_MONITORS_CONFIG_CAPPED, args, 3, NULL);
+    }
 }
 
 static inline void trace_qxl_client_monitors_config_crc(int qid, unsigned size, uint32_t crc32)
 {
+    if (trace_event_get_state(TRACE_QXL_CLIENT_MONITORS_CONFIG_CRC)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)size, (uint64_t)crc32 };
+        trace_ring_record(TRACE_QXL_CLIENT_MONITORS_CONFIG_CRC, args, 3, NULL);
+    }
 }
 
 static inline void trace_qxl_set_client_capabilities_unsupported_by_revision(int qid, int revision)
 {
+    if (trace_event_get_state(TRACE_QXL_SET_CLIENT_CAPABILITIES_UNSUPPORTED_BY_REVISION)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)revision };
+        trace_ring_record(TRACE_QXL_SET_CLIENT_CAPABILITIES_UNSUPPORTED_BY_REVISION, args, 2, NULL);
+    }
 }
 
 static inline void trace_qemu_spice_add_memslot(int qid, uint32_t slot_id, unsigned long virt_start, unsigned long virt_end, int async)
 {
+    if (trace_event_get_state(TRACE_QEMU_SPICE_ADD_MEMSLOT)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)slot_id, (uint64_t)virt_start, (uint64_t)virt_end, (uint64_t)async };
+        trace_ring_record(TRACE_QEMU_SPICE_ADD_MEMSLOT, args, 5, NULL);
+    }
 }
 
 static inline void trace_qemu_spice_del_memslot(int qid, uint32_t gid, uint32_t slot_id)
 {
+    if (trace_event_get_state(TRACE_QEMU_SPICE_DEL_MEMSLOT)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)gid, (uint64_t)slot_id };
+        trace_ring_record(TRACE_QEMU_SPICE_DEL_MEMSLOT, args, 3, NULL);
+    }
 }
 
 static inline void trace_qemu_spice_create_primary_surface(int qid, uint32_t sid, void * surface, int async)
 {
+    if (trace_event_get_state(TRACE_QEMU_SPICE_CREATE_PRIMARY_SURFACE)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)sid, (uintptr_t)surface, (uint64_t)async };
+        trace_ring_record(TRACE_QEMU_SPICE_CREATE_PRIMARY_SURFACE, args, 4, NULL);
+    }
 }
 
 static inline void trace_qemu_spice_destroy_primary_surface(int qid, uint32_t sid, int async)
 {
+    if (trace_event_get_state(TRACE_QEMU_SPICE_DESTROY_PRIMARY_SURFACE)) {
+        uint64_t args[] = { (uint64_t)qid, (uint64_t)sid, (uint64_t)async };
+        trace_ring_record(TRACE_QEMU_SPICE_DESTROY_PRIMARY_SURFACE, args, 3, NULL);
+    }
 }
 
 static inline void trace_qemu_spice_wakeup(uint32_t qid)
 {
+    if (trace_event_get_state(TRACE_QEMU_SPICE_WAKEUP)) {
+        uint64_t args[] = { (uint64_t)qid };
+        trace_ring_record(TRACE_QEMU_SPICE_WAKEUP, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_spice_create_update(uint32_t left, uint32_t right, uint32_t top, uint32_t bottom)
 {
+    if (trace_event_get_state(TRACE_QEMU_SPICE_CREATE_UPDATE)) {
+        uint64_t args[] = { (uint64_t)left, (uint64_t)right, (uint64_t)top, (uint64_t)bottom };
+        trace_ring_record(TRACE_QEMU_SPICE_CREATE_UPDATE, args, 4, NULL);
+    }
 }
 
 static inline void trace_qxl_render_blit(int32_t stride, int32_t left, int32_t right, int32_t top, int32_t bottom)
 {
+    if (trace_event_get_state(TRACE_QXL_RENDER_BLIT)) {
+        uint64_t args[] = { (uint64_t)stride, (uint64_t)left, (uint64_t)right, (uint64_t)top, (uint64_t)bottom };
+        trace_ring_record(TRACE_QXL_RENDER_BLIT, args, 5, NULL);
+    }
 }
 
 static inline void trace_qxl_render_guest_primary_resized(int32_t width, int32_t height, int32_t stride, int32_t bytes_pp, int32_t bits_pp)
 {
+    if (trace_event_get_state(TRACE_QXL_RENDER_GUEST_PRIMARY_RESIZED)) {
+        uint64_t args[] = { (uint64_t)width, (uint64_t)height, (uint64_t)stride, (uint64_t)bytes_pp, (uint64_t)bits_pp };
+        trace_ring_record(TRACE_QXL_RENDER_GUEST_PRIMARY_RESIZED, args, 5, NULL);
+    }
 }
 
 static inline void trace_qxl_render_update_area_done(void * cookie)
 {
+    if (trace_event_get_state(TRACE_QXL_RENDER_UPDATE_AREA_DONE)) {
+        uint64_t args[] = { (uintptr_t)cookie };
+        trace_ring_record(TRACE_QXL_RENDER_UPDATE_AREA_DONE, args, 1, NULL);
+    }
 }
 
 static inline void trace_spapr_pci_msi(const char * msg, uint32_t ca)
 {
+    if (trace_event_get_state(TRACE_SPAPR_PCI_MSI)) {
+        uint64_t args[] = { (uintptr_t)msg, (uint64_t)ca };
+        trace_ring_record(TRACE_SPAPR_PCI_MSI, args, 2, msg);
+    }
 }
 
 static inline void trace_spapr_pci_msi_setup(const char * name, unsigned vector, uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_SPAPR_PCI_MSI_SETUP)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)vector, (uint64_t)addr };
+        trace_ring_record(TRACE_SPAPR_PCI_MSI_SETUP, args, 3, name);
+    }
 }
 
 static inline void trace_spapr_pci_rtas_ibm_change_msi(unsigned cfg, unsigned func, unsigned req, unsigned first)
 {
+    if (trace_event_get_state(TRACE_SPAPR_PCI_RTAS_IBM_CHANGE_MSI)) {
+        uint64_t args[] = { (uint64_t)cfg, (uint64_t)func, (uint64_t)req, (uint64_t)first };
+        trace_ring_record(TRACE_SPAPR_PCI_RTAS_IBM_CHANGE_MSI, args, 4, NULL);
+    }
 }
 
 static inline void trace_spapr_pci_rtas_ibm_query_interrupt_source_number(unsigned ioa, unsigned intr)
 {
+    if (trace_event_get_state(TRACE_SPAPR_PCI_RTAS_IBM_QUERY_INTERRUPT_SOURCE_NUMBER)) {
+        uint64_t args[] = { (uint64_t)ioa, (uint64_t)intr };
+        trace_ring_record(TRACE_SPAPR_PCI_RTAS_IBM_QUERY_INTERRUPT_SOURCE_NUMBER, args, 2, NULL);
+    }
 }
 
 static inline void trace_spapr_pci_msi_write(uint64_t addr, uint64_t data, uint32_t dt_irq)
 {
+    if (trace_event_get_state(TRACE_SPAPR_PCI_MSI_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)data, (uint64_t)dt_irq };
+        trace_ring_record(TRACE_SPAPR_PCI_MSI_WRITE, args, 3, NULL);
+    }
 }
 
 static inline void trace_spapr_pci_lsi_set(const char * busname, int pin, uint32_t irq)
 {
+    if (trace_event_get_state(TRACE_SPAPR_PCI_LSI_SET)) {
+        uint64_t args[] = { (uintptr_t)busname, (uint64_t)pin, (uint64_t)irq };
+        trace_ring_record(TRACE_SPAPR_PCI_LSI_SET, args, 3, busname);
+    }
 }
 
 static inline void trace_spapr_pci_msi_retry(unsigned config_addr, unsigned req_num, unsigned max_irqs)
 {
+    if (trace_event_get_state(TRACE_SPAPR_PCI_MSI_RETRY)) {
+        uint64_t args[] = { (uint64_t)config_addr, (uint64_t)req_num, (uint64_t)max_irqs };
+        trace_ring_record(TRACE_SPAPR_PCI_MSI_RETRY, args, 3, NULL);
+    }
 }
 
 static inline void trace_pci_update_mappings_del(void * d, uint32_t bus, uint32_t func, uint32_t slot, int bar, uint64_t addr, uint64_t size)
 {
+    if (trace_event_get_state(TRACE_PCI_UPDATE_MAPPINGS_DEL)) {
+        uint64_t args[] = { (uintptr_t)d, (uint64_t)bus, (uint64_t)func, (uint64_t)slot, (uint64_t)bar, (uint64_t)addr, (uint64_t)size };
+        trace_ring_record(TRACE_PCI_UPDATE_MAPPINGS_DEL, args, 7, NULL);
+    }
 }
 
 static inline void trace_pci_update_mappings_add(void * d, uint32_t bus, uint32_t func, uint32_t slot, int bar, uint64_t addr, uint64_t size)
 {
+    if (trace_event_get_state(TRACE_PCI_UPDATE_MAPPINGS_ADD)) {
+        uint64_t args[] = { (uintptr_t)d, (uint64_t)bus, (uint64_t)func, (uint64_t)slot, (uint64_t)bar, (uint64_t)addr, (uint64_t)size };
+        trace_ring_record(TRACE_PCI_UPDATE_MAPPINGS_ADD, args, 7, NULL);
+    }
 }
 
 static inline void trace_pcnet_s_reset(void * s)
 {
+    if (trace_event_get_state(TRACE_PCNET_S_RESET)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_PCNET_S_RESET, args, 1, NULL);
+    }
 }
 
 static inline void trace_pcnet_user_int(void * s)
 {
+    if (trace_event_get_state(TRACE_PCNET_USER_INT)) {
+        uint64_t args[] = { (uintptr_t)s };
+        trace_ring_record(TRACE_PCNET_USER_INT, args, 1, NULL);
+    }
 }
 
 static inline void trace_pcnet_isr_change(void * s, uint32_t isr, uint32_t isr_old)
 {
+    if (trace_event_get_state(TRACE_PCNET_ISR_CHANGE)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)isr, (uint64_t)isr_old };
+        trace_ring_record(TRACE_PCNET_ISR_CHANGE, args, 3, NULL);
+    }
 }
 
 static inline void trace_pcnet_init(void * s, uint64_t init_addr)
 {
+    if (trace_event_get_state(TRACE_PCNET_INIT)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)init_addr };
+        trace_ring_record(TRACE_PCNET_INIT, args, 2, NULL);
+    }
 }
 
 static inline void trace_pcnet_rlen_tlen(void * s, uint32_t rlen, uint32_t tlen)
 {
+    if (trace_event_get_state(TRACE_PCNET_RLEN_TLEN)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)rlen, (uint64_t)tlen };
+        trace_ring_record(TRACE_PCNET_RLEN_TLEN, args, 3, NULL);
+    }
 }
 
 static inline void trace_pcnet_ss32_rdra_tdra(void * s, uint32_t ss32, uint32_t rdra, uint32_t rcvrl, uint32_t tdra, uint32_t xmtrl)
 {
+    if (trace_event_get_state(TRACE_PCNET_SS32_RDRA_TDRA)) {
+        uint64_t args[] = { (uintptr_t)s, (uint64_t)ss32, (uint64_t)rdra, (uint64_t)rcvrl, (uint64_t)tdra, (uint64_t)xmtrl };
+        trace_ring_record(TRACE_PCNET_SS32_RDRA_TDRA, args, 6, NULL);
+    }
 }
 
 static inline void trace_pcnet_aprom_writeb(void * opaque, uint32_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_PCNET_APROM_WRITEB)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_PCNET_APROM_WRITEB, args, 3, NULL);
+    }
 }
 
 static inline void trace_pcnet_aprom_readb(void * opaque, uint32_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_PCNET_APROM_READB)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_PCNET_APROM_READB, args, 3, NULL);
+    }
 }
 
 static inline void trace_pcnet_ioport_read(void * opaque, uint64_t addr, unsigned size)
 {
+    if (trace_event_get_state(TRACE_PCNET_IOPORT_READ)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)addr, (uint64_t)size };
+        trace_ring_record(TRACE_PCNET_IOPORT_READ, args, 3, NULL);
+    }
 }
 
 static inline void trace_pcnet_ioport_write(void * opaque, uint64_t addr, uint64_t data, unsigned size)
 {
+    if (trace_event_get_state(TRACE_PCNET_IOPORT_WRITE)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)addr, (uint64_t)data, (uint64_t)size };
+        trace_ring_record(TRACE_PCNET_IOPORT_WRITE, args, 4, NULL);
+    }
 }
 
 static inline void trace_pcnet_mmio_writeb(void * opaque, uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_PCNET_MMIO_WRITEB)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_PCNET_MMIO_WRITEB, args, 3, NULL);
+    }
 }
 
 static inline void trace_pcnet_mmio_writew(void * opaque, uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_PCNET_MMIO_WRITEW)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_PCNET_MMIO_WRITEW, args, 3, NULL);
+    }
 }
 
 static inline void trace_pcnet_mmio_writel(void * opaque, uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_PCNET_MMIO_WRITEL)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_PCNET_MMIO_WRITEL, args, 3, NULL);
+    }
 }
 
 static inline void trace_pcnet_mmio_readb(void * opaque, uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_PCNET_MMIO_READB)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_PCNET_MMIO_READB, args, 3, NULL);
+    }
 }
 
 static inline void trace_pcnet_mmio_readw(void * opaque, uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_PCNET_MMIO_READW)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_PCNET_MMIO_READW, args, 3, NULL);
+    }
 }
 
 static inline void trace_pcnet_mmio_readl(void * opaque, uint64_t addr, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_PCNET_MMIO_READL)) {
+        uint64_t args[] = { (uintptr_t)opaque, (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_PCNET_MMIO_READL, args, 3, NULL);
+    }
 }
 
 static inline void trace_xics_icp_check_ipi(int server, uint8_t mfrr)
 {
+    if (trace_event_get_state(TRACE_XICS_ICP_CHECK_IPI)) {
+        uint64_t args[] = { (uint64_t)server, (uint64_t)mfrr };
+        trace_ring_record(TRACE_XICS_ICP_CHECK_IPI, args, 2, NULL);
+    }
 }
 
 static inline void trace_xics_icp_accept(uint32_t old_xirr, uint32_t new_xirr)
 {
+    if (trace_event_get_state(TRACE_XICS_ICP_ACCEPT)) {
+        uint64_t args[] = { (uint64_t)old_xirr, (uint64_t)new_xirr };
+        trace_ring_record(TRACE_XICS_ICP_ACCEPT, args, 2, NULL);
+    }
 }
 
 static inline void trace_xics_icp_eoi(int server, uint32_t xirr, uint32_t new_xirr)
 {
+    if (trace_event_get_state(TRACE_XICS_ICP_EOI)) {
+        uint64_t args[] = { (uint64_t)server, (uint64_t)xirr, (uint64_t)new_xirr };
+        trace_ring_record(TRACE_XICS_ICP_EOI, args, 3, NULL);
+    }
 }
 
 static inline void trace_xics_icp_irq(int server, int nr, uint8_t priority)
 {
+    if (trace_event_get_state(TRACE_XICS_ICP_IRQ)) {
+        uint64_t args[] = { (uint64_t)server, (uint64_t)nr, (uint64_t)priority };
+        trace_ring_record(TRACE_XICS_ICP_IRQ, args, 3, NULL);
+    }
 }
 
 static inline void trace_xics_icp_raise(uint32_t xirr, uint8_t pending_priority)
 {
+    if (trace_event_get_state(TRACE_XICS_ICP_RAISE)) {
+        uint64_t args[] = { (uint64_t)xirr, (uint64_t)pending_priority };
+        trace_ring_record(TRACE_XICS_ICP_RAISE, args, 2, NULL);
+    }
 }
 
 static inline void trace_xics_set_irq_msi(int srcno, int nr)
 {
+    if (trace_event_get_state(TRACE_XICS_SET_IRQ_MSI)) {
+        uint64_t args[] = { (uint64_t)srcno, (uint64_t)nr };
+        trace_ring_record(TRACE_XICS_SET_IRQ_MSI, args, 2, NULL);
+    }
 }
 
 static inline void trace_xics_masked_pending(void)
 {
+    if (trace_event_get_state(TRACE_XICS_MASKED_PENDING)) {
+        trace_ring_record(TRACE_XICS_MASKED_PENDING, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_xics_set_irq_lsi(int srcno, int nr)
 {
+    if (trace_event_get_state(TRACE_XICS_SET_IRQ_LSI)) {
+        uint64_t args[] = { (uint64_t)srcno, (uint64_t)nr };
+        trace_ring_record(TRACE_XICS_SET_IRQ_LSI, args, 2, NULL);
+    }
 }
 
 static inline void trace_xics_ics_write_xive(int nr, int srcno, int server, uint8_t priority)
 {
+    if (trace_event_get_state(TRACE_XICS_ICS_WRITE_XIVE)) {
+        uint64_t args[] = { (uint64_t)nr, (uint64_t)srcno, (uint64_t)server, (uint64_t)priority };
+        trace_ring_record(TRACE_XICS_ICS_WRITE_XIVE, args, 4, NULL);
+    }
 }
 
 static inline void trace_xics_ics_reject(int nr, int srcno)
 {
+    if (trace_event_get_state(TRACE_XICS_ICS_REJECT)) {
+        uint64_t args[] = { (uint64_t)nr, (uint64_t)srcno };
+        trace_ring_record(TRACE_XICS_ICS_REJECT, args, 2, NULL);
+    }
 }
 
 static inline void trace_xics_ics_eoi(int nr)
 {
+    if (trace_event_get_state(TRACE_XICS_ICS_EOI)) {
+        uint64_t args[] = { (uint64_t)nr };
+        trace_ring_record(TRACE_XICS_ICS_EOI, args, 1, NULL);
+    }
 }
 
 static inline void trace_xics_alloc(int src, int irq)
 {
+    if (trace_event_get_state(TRACE_XICS_ALLOC)) {
+        uint64_t args[] = { (uint64_t)src, (uint64_t)irq };
+        trace_ring_record(TRACE_XICS_ALLOC, args, 2, NULL);
+    }
 }
 
 static inline void trace_xics_alloc_failed_hint(int src, int irq)
 {
+    if (trace_event_get_state(TRACE_XICS_ALLOC_FAILED_HINT)) {
+        uint64_t args[] = { (uint64_t)src, (uint64_t)irq };
+        trace_ring_record(TRACE_XICS_ALLOC_FAILED_HINT, args, 2, NULL);
+    }
 }
 
 static inline void trace_xics_alloc_failed_no_left(int src)
 {
+    if (trace_event_get_state(TRACE_XICS_ALLOC_FAILED_NO_LEFT)) {
+        uint64_t args[] = { (uint64_t)src };
+        trace_ring_record(TRACE_XICS_ALLOC_FAILED_NO_LEFT, args, 1, NULL);
+    }
 }
 
 static inline void trace_xics_alloc_block(int src, int first, int num, bool lsi, int align)
 {
+    if (trace_event_get_state(TRACE_XICS_ALLOC_BLOCK)) {
+        uint64_t args[] = { (uint64_t)src, (uint64_t)first, (uint64_t)num, (uint64_t)lsi, (uint64_t)align };
+        trace_ring_record(TRACE_XICS_ALLOC_BLOCK, args, 5, NULL);
+    }
 }
 
 static inline void trace_xics_ics_free(int src, int irq, int num)
 {
+    if (trace_event_get_state(TRACE_XICS_ICS_FREE)) {
+        uint64_t args[] = { (uint64_t)src, (uint64_t)irq, (uint64_t)num };
+        trace_ring_record(TRACE_XICS_ICS_FREE, args, 3, NULL);
+    }
 }
 
 static inline void trace_xics_ics_free_warn(int src, int irq)
 {
+    if (trace_event_get_state(TRACE_XICS_ICS_FREE_WARN)) {
+        uint64_t args[] = { (uint64_t)src, (uint64_t)irq };
+        trace_ring_record(TRACE_XICS_ICS_FREE_WARN, args, 2, NULL);
+    }
 }
 
 static inline void trace_spapr_cas_failed(unsigned long n)
 {
+    if (trace_event_get_state(TRACE_SPAPR_CAS_FAILED)) {
+        uint64_t args[] = { (uint64_t)n };
+        trace_ring_record(TRACE_SPAPR_CAS_FAILED, args, 1, NULL);
+    }
 }
 
 static inline void trace_spapr_cas_continue(unsigned long n)
 {
+    if (trace_event_get_state(TRACE_SPAPR_CAS_CONTINUE)) {
+        uint64_t args[] = { (uint64_t)n };
+        trace_ring_record(TRACE_SPAPR_CAS_CONTINUE, args, 1, NULL);
+    }
 }
 
 static inline void trace_spapr_cas_pvr_try(uint32_t pvr)
 {
+    if (trace_event_get_state(TRACE_SPAPR_CAS_PVR_TRY)) {
+        uint64_t args[] = { (uint64_t)pvr };
+        trace_ring_record(TRACE_SPAPR_CAS_PVR_TRY, args, 1, NULL);
+    }
 }
 
 static inline void trace_spapr_cas_pvr(uint32_t cur_pvr, bool cpu_match, uint32_t new_pvr, uint64_t pcr)
 {
+    if (trace_event_get_state(TRACE_SPAPR_CAS_PVR)) {
+        uint64_t args[] = { (uint64_t)cur_pvr, (uint64_t)cpu_match, (uint64_t)new_pvr, (uint64_t)pcr };
+        trace_ring_record(TRACE_SPAPR_CAS_PVR, args, 4, NULL);
+    }
 }
 
 static inline void trace_spapr_iommu_put(uint64_t liobn, uint64_t ioba, uint64_t tce, uint64_t ret)
 {
+    if (trace_event_get_state(TRACE_SPAPR_IOMMU_PUT)) {
+        uint64_t args[] = { (uint64_t)liobn, (uint64_t)ioba, (uint64_t)tce, (uint64_t)ret };
+        trace_ring_record(TRACE_SPAPR_IOMMU_PUT, args, 4, NULL);
+    }
 }
 
 static inline void trace_spapr_iommu_get(uint64_t liobn, uint64_t ioba, uint64_t ret, uint64_t tce)
 {
+    if (trace_event_get_state(TRACE_SPAPR_IOMMU_GET)) {
+        uint64_t args[] = { (uint64_t)liobn, (uint64_t)ioba, (uint64_t)ret, (uint64_t)tce };
+        trace_ring_record(TRACE_SPAPR_IOMMU_GET, args, 4, NULL);
+    }
 }
 
 static inline void trace_spapr_iommu_indirect(uint64_t liobn, uint64_t ioba, uint64_t tce, uint64_t iobaN, uint64_t tceN, uint64_t ret)
 {
+    if (trace_event_get_state(TRACE_SPAPR_IOMMU_INDIRECT)) {
+        uint64_t args[] = { (uint64_t)liobn, (uint64_t)ioba, (uint64_t)tce, (uint64_t)iobaN, (uint64_t)tceN, (uint64_t)ret };
+        trace_ring_record(TRACE_SPAPR_IOMMU_INDIRECT, args, 6, NULL);
+    }
 }
 
 static inline void trace_spapr_iommu_stuff(uint64_t liobn, uint64_t ioba, uint64_t tce_value, uint64_t npages, uint64_t ret)
 {
+    if (trace_event_get_state(TRACE_SPAPR_IOMMU_STUFF)) {
+        uint64_t args[] = { (uint64_t)liobn, (uint64_t)ioba, (uint64_t)tce_value, (uint64_t)npages, (uint64_t)ret };
+        trace_ring_record(TRACE_SPAPR_IOMMU_STUFF, args, 5, NULL);
+    }
 }
 
 static inline void trace_spapr_iommu_xlate(uint64_t liobn, uint64_t ioba, uint64_t tce, unsigned perm, unsigned pgsize)
 {
+    if (trace_event_get_state(TRACE_SPAPR_IOMMU_XLATE)) {
+        uint64_t args[] = { (uint64_t)liobn, (uint64_t)ioba, (uint64_t)tce, (uint64_t)perm, (uint64_t)pgsize };
+        trace_ring_record(TRACE_SPAPR_IOMMU_XLATE, args, 5, NULL);
+    }
 }
 
 static inline void trace_spapr_iommu_new_table(uint64_t liobn, void * tcet, void * table, int fd)
 {
+    if (trace_event_get_state(TRACE_SPAPR_IOMMU_NEW_TABLE)) {
+        uint64_t args[] = { (uint64_t)liobn, (uintptr_t)tcet, (uintptr_t)table, (uint64_t)fd };
+        trace_ring_record(TRACE_SPAPR_IOMMU_NEW_TABLE, args, 4, NULL);
+    }
 }
 
 static inline void trace_ppc_tb_adjust(uint64_t offs1, uint64_t offs2, int64_t diff, int64_t seconds)
 {
+    if (trace_event_get_state(TRACE_PPC_TB_ADJUST)) {
+        uint64_t args[] = { (uint64_t)offs1, (uint64_t)offs2, (uint64_t)diff, (uint64_t)seconds };
+        trace_ring_record(TRACE_PPC_TB_ADJUST, args, 4, NULL);
+    }
 }
 
 static inline void trace_hbitmap_iter_skip_words(const void * hb, void * hbi, uint64_t pos, unsigned long cur)
 {
+    if (trace_event_get_state(TRACE_HBITMAP_ITER_SKIP_WORDS)) {
+        uint64_t args[] = { (uintptr_t)hb, (uintptr_t)hbi, (uint64_t)pos, (uint64_t)cur };
+        trace_ring_record(TRACE_HBITMAP_ITER_SKIP_WORDS, args, 4, NULL);
+    }
 }
 
 static inline void trace_hbitmap_reset(void * hb, uint64_t start, uint64_t count, uint64_t sbit, uint64_t ebit)
 {
+    if (trace_event_get_state(TRACE_HBITMAP_RESET)) {
+        uint64_t args[] = { (uintptr_t)hb, (uint64_t)start, (uint64_t)count, (uint64_t)sbit, (uint64_t)ebit };
+        trace_ring_record(TRACE_HBITMAP_RESET, args, 5, NULL);
+    }
 }
 
 static inline void trace_hbitmap_set(void * hb, uint64_t start, uint64_t count, uint64_t sbit, uint64_t ebit)
 {
+    if (trace_event_get_state(TRACE_HBITMAP_SET)) {
+        uint64_t args[] = { (uintptr_t)hb, (uint64_t)start, (uint64_t)count, (uint64_t)sbit, (uint64_t)ebit };
+        trace_ring_record(TRACE_HBITMAP_SET, args, 5, NULL);
+    }
 }
 
 static inline void trace_ioinst(const char * insn)
 {
+    if (trace_event_get_state(TRACE_IOINST)) {
+        uint64_t args[] = { (uintptr_t)insn };
+        trace_ring_record(TRACE_IOINST, args, 1, insn);
+    }
 }
 
 static inline void trace_ioinst_sch_id(const char * insn, int cssid, int ssid, int schid)
 {
+    if (trace_event_get_state(TRACE_IOINST_SCH_ID)) {
+        uint64_t args[] = { (uintptr_t)insn, (uint64_t)cssid, (uint64_t)ssid, (uint64_t)schid };
+        trace_ring_record(TRACE_IOINST_SCH_ID, args, 4, insn);
+    }
 }
 
 static inline void trace_ioinst_chp_id(const char * insn, int cssid, int chpid)
 {
+    if (trace_event_get_state(TRACE_IOINST_CHP_ID)) {
+        uint64_t args[] = { (uintptr_t)insn, (uint64_t)cssid, (uint64_t)chpid };
+        trace_ring_record(TRACE_IOINST_CHP_ID, args, 3, insn);
+    }
 }
 
 static inline void trace_ioinst_chsc_cmd(uint16_t cmd, uint16_t len)
 {
+    if (trace_event_get_state(TRACE_IOINST_CHSC_CMD)) {
+        uint64_t args[] = { (uint64_t)cmd, (uint64_t)len };
+        trace_ring_record(TRACE_IOINST_CHSC_CMD, args, 2, NULL);
+    }
 }
 
 static inline void trace_css_enable_facility(const char * facility)
 {
+    if (trace_event_get_state(TRACE_CSS_ENABLE_FACILITY)) {
+        uint64_t args[] = { (uintptr_t)facility };
+        trace_ring_record(TRACE_CSS_ENABLE_FACILITY, args, 1, facility);
+    }
 }
 
 static inline void trace_css_crw(uint8_t rsc, uint8_t erc, uint16_t rsid, const char * chained)
 {
+    if (trace_event_get_state(TRACE_CSS_CRW)) {
+        uint64_t args[] = { (uint64_t)rsc, (uint64_t)erc, (uint64_t)rsid, (uintptr_t)chained };
+        trace_ring_record(TRACE_CSS_CRW, args, 4, chained);
+    }
 }
 
 static inline void trace_css_chpid_add(uint8_t cssid, uint8_t chpid, uint8_t type)
 {
+    if (trace_event_get_state(TRACE_CSS_CHPID_ADD)) {
+        uint64_t args[] = { (uint64_t)cssid, (uint64_t)chpid, (uint64_t)type };
+        trace_ring_record(TRACE_CSS_CHPID_ADD, args, 3, NULL);
+    }
 }
 
 static inline void trace_css_new_image(uint8_t cssid, const char * default_cssid)
 {
+    if (trace_event_get_state(TRACE_CSS_NEW_IMAGE)) {
+        uint64_t args[] = { (uint64_t)cssid, (uintptr_t)default_cssid };
+        trace_ring_record(TRACE_CSS_NEW_IMAGE, args, 2, default_cssid);
+    }
 }
 
 static inline void trace_css_assign_subch(const char * do_assign, uint8_t cssid, uint8_t ssid, uint16_t schid, uint16_t devno)
 {
+    if (trace_event_get_state(TRACE_CSS_ASSIGN_SUBCH)) {
+        uint64_t args[] = { (uintptr_t)do_assign, (uint64_t)cssid, (uint64_t)ssid, (uint64_t)schid, (uint64_t)devno };
+        trace_ring_record(TRACE_CSS_ASSIGN_SUBCH, args, 5, do_assign);
+    }
 }
 
 static inline void trace_css_io_interrupt(int cssid, int ssid, int schid, uint32_t intparm, uint8_t isc, const char * conditional)
 {
+    if (trace_event_get_state(TRACE_CSS_IO_INTERRUPT)) {
+        uint64_t args[] = { (uint64_t)cssid, (uint64_t)ssid, (uint64_t)schid, (uint64_t)intparm, (uint64_t)isc, (uintptr_t)conditional };
+        trace_ring_record(TRACE_CSS_IO_INTERRUPT, args, 6, conditional);
+    }
 }
 
 static inline void trace_css_adapter_interrupt(uint8_t isc)
 {
+    if (trace_event_get_state(TRACE_CSS_ADAPTER_INTERRUPT)) {
+        uint64_t args[] = { (uint64_t)isc };
+        trace_ring_record(TRACE_CSS_ADAPTER_INTERRUPT, args, 1, NULL);
+    }
 }
 
 static inline void trace_virtio_ccw_interpret_ccw(int cssid, int ssid, int schid, int cmd_code)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_CCW_INTERPRET_CCW)) {
+        uint64_t args[] = { (uint64_t)cssid, (uint64_t)ssid, (uint64_t)schid, (uint64_t)cmd_code };
+        trace_ring_record(TRACE_VIRTIO_CCW_INTERPRET_CCW, args, 4, NULL);
+    }
 }
 
 static inline void trace_virtio_ccw_new_device(int cssid, int ssid, int schid, int devno, const char * devno_mode)
 {
+    if (trace_event_get_state(TRACE_VIRTIO_CCW_NEW_DEVICE)) {
+        uint64_t args[] = { (uint64_t)cssid, (uint64_t)ssid, (uint64_t)schid, (uint64_t)devno, (uintptr_t)devno_mode };
+        trace_ring_record(TRACE_VIRTIO_CCW_NEW_DEVICE, args, 5, devno_mode);
+    }
 }
 
 static inline void trace_flic_create_device(int err)
 {
+    if (trace_event_get_state(TRACE_FLIC_CREATE_DEVICE)) {
+        uint64_t args[] = { (uint64_t)err };
+        trace_ring_record(TRACE_FLIC_CREATE_DEVICE, args, 1, NULL);
+    }
 }
 
 static inline void trace_flic_no_device_api(int err)
 {
+    if (trace_event_get_state(TRACE_FLIC_NO_DEVICE_API)) {
+        uint64_t args[] = { (uint64_t)err };
+        trace_ring_record(TRACE_FLIC_NO_DEVICE_API, args, 1, NULL);
+    }
 }
 
 static inline void trace_flic_reset_failed(int err)
 {
+    if (trace_event_get_state(TRACE_FLIC_RESET_FAILED)) {
+        uint64_t args[] = { (uint64_t)err };
+        trace_ring_record(TRACE_FLIC_RESET_FAILED, args, 1, NULL);
+    }
 }
 
 static inline void trace_migrate_set_state(int new_state)
 {
+    if (trace_event_get_state(TRACE_MIGRATE_SET_STATE)) {
+        uint64_t args[] = { (uint64_t)new_state };
+        trace_ring_record(TRACE_MIGRATE_SET_STATE, args, 1, NULL);
+    }
 }
 
 static inline void trace_migrate_fd_cleanup(void)
 {
+    if (trace_event_get_state(TRACE_MIGRATE_FD_CLEANUP)) {
+        trace_ring_record(TRACE_MIGRATE_FD_CLEANUP, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_migrate_fd_error(void)
 {
+    if (trace_event_get_state(TRACE_MIGRATE_FD_ERROR)) {
+        trace_ring_record(TRACE_MIGRATE_FD_ERROR, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_migrate_fd_cancel(void)
 {
+    if (trace_event_get_state(TRACE_MIGRATE_FD_CANCEL)) {
+        trace_ring_record(TRACE_MIGRATE_FD_CANCEL, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_migrate_pending(uint64_t size, uint64_t max)
 {
+    if (trace_event_get_state(TRACE_MIGRATE_PENDING)) {
+        uint64_t args[] = { (uint64_t)size, (uint64_t)max };
+        trace_ring_record(TRACE_MIGRATE_PENDING, args, 2, NULL);
+    }
 }
 
 static inline void trace_migrate_transferred(uint64_t tranferred, uint64_t time_spent, double bandwidth, uint64_t size)
 {
+    if (trace_event_get_state(TRACE_MIGRATE_TRANSFERRED)) {
+        uint64_t args[] = { (uint64_t)tranferred, (uint64_t)time_spent, trace_ring_double(bandwidth), (uint64_t)size };
+        trace_ring_record(TRACE_MIGRATE_TRANSFERRED, args, 4, NULL);
+    }
 }
 
 static inline void trace_qemu_dma_accept_incoming_migration(void)
 {
+    if (trace_event_get_state(TRACE_QEMU_DMA_ACCEPT_INCOMING_MIGRATION)) {
+        trace_ring_record(TRACE_QEMU_DMA_ACCEPT_INCOMING_MIGRATION, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_qemu_dma_accept_incoming_migration_accepted(void)
 {
+    if (trace_event_get_state(TRACE_QEMU_DMA_ACCEPT_INCOMING_MIGRATION_ACCEPTED)) {
+        trace_ring_record(TRACE_QEMU_DMA_ACCEPT_INCOMING_MIGRATION_ACCEPTED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_accept_pin_state(bool pin)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_ACCEPT_PIN_STATE)) {
+        uint64_t args[] = { (uint64_t)pin };
+        trace_ring_record(TRACE_QEMU_RDMA_ACCEPT_PIN_STATE, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_accept_pin_verbsc(void * verbs)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_ACCEPT_PIN_VERBSC)) {
+        uint64_t args[] = { (uintptr_t)verbs };
+        trace_ring_record(TRACE_QEMU_RDMA_ACCEPT_PIN_VERBSC, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_block_for_wrid_miss(const char * wcompstr, int wcomp, const char * gcompstr, uint64_t req)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_BLOCK_FOR_WRID_MISS)) {
+        uint64_t args[] = { (uintptr_t)wcompstr, (uint64_t)wcomp, (uintptr_t)gcompstr, (uint64_t)req };
+        trace_ring_record(TRACE_QEMU_RDMA_BLOCK_FOR_WRID_MISS, args, 4, wcompstr);
+    }
 }
 
 static inline void trace_qemu_rdma_block_for_wrid_miss_b(const char * wcompstr, int wcomp, const char * gcompstr, uint64_t req)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_BLOCK_FOR_WRID_MISS_B)) {
+        uint64_t args[] = { (uintptr_t)wcompstr, (uint64_t)wcomp, (uintptr_t)gcompstr, (uint64_t)req };
+        trace_ring_record(TRACE_QEMU_RDMA_BLOCK_FOR_WRID_MISS_B, args, 4, wcompstr);
+    }
 }
 
 static inline void trace_qemu_rdma_cleanup_disconnect(void)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_CLEANUP_DISCONNECT)) {
+        trace_ring_record(TRACE_QEMU_RDMA_CLEANUP_DISCONNECT, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_cleanup_waiting_for_disconnect(void)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_CLEANUP_WAITING_FOR_DISCONNECT)) {
+        trace_ring_record(TRACE_QEMU_RDMA_CLEANUP_WAITING_FOR_DISCONNECT, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_close(void)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_CLOSE)) {
+        trace_ring_record(TRACE_QEMU_RDMA_CLOSE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_connect_pin_all_requested(void)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_CONNECT_PIN_ALL_REQUESTED)) {
+        trace_ring_record(TRACE_QEMU_RDMA_CONNECT_PIN_ALL_REQUESTED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_connect_pin_all_outcome(bool pin)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_CONNECT_PIN_ALL_OUTCOME)) {
+        uint64_t args[] = { (uint64_t)pin };
+        trace_ring_record(TRACE_QEMU_RDMA_CONNECT_PIN_ALL_OUTCOME, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_dest_init_trying(const char * host, const char * ip)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_DEST_INIT_TRYING)) {
+        uint64_t args[] = { (uintptr_t)host, (uintptr_t)ip };
+        trace_ring_record(TRACE_QEMU_RDMA_DEST_INIT_TRYING, args, 2, host);
+    }
 }
 
 static inline void trace_qemu_rdma_dump_gid(const char * who, const char * src, const char * dst)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_DUMP_GID)) {
+        uint64_t args[] = { (uintptr_t)who, (uintptr_t)src, (uintptr_t)dst };
+        trace_ring_record(TRACE_QEMU_RDMA_DUMP_GID, args, 3, who);
+    }
 }
 
 static inline void trace_qemu_rdma_exchange_get_response_start(const char * desc)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_EXCHANGE_GET_RESPONSE_START)) {
+        uint64_t args[] = { (uintptr_t)desc };
+        trace_ring_record(TRACE_QEMU_RDMA_EXCHANGE_GET_RESPONSE_START, args, 1, desc);
+    }
 }
 
 static inline void trace_qemu_rdma_exchange_get_response_none(const char * desc, int type)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_EXCHANGE_GET_RESPONSE_NONE)) {
+        uint64_t args[] = { (uintptr_t)desc, (uint64_t)type };
+        trace_ring_record(TRACE_QEMU_RDMA_EXCHANGE_GET_RESPONSE_NONE, args, 2, desc);
+    }
 }
 
 static inline void trace_qemu_rdma_exchange_send_issue_callback(void)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_EXCHANGE_SEND_ISSUE_CALLBACK)) {
+        trace_ring_record(TRACE_QEMU_RDMA_EXCHANGE_SEND_ISSUE_CALLBACK, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_exchange_send_waiting(const char * desc)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_EXCHANGE_SEND_WAITING)) {
+        uint64_t args[] = { (uintptr_t)desc };
+        trace_ring_record(TRACE_QEMU_RDMA_EXCHANGE_SEND_WAITING, args, 1, desc);
+    }
 }
 
 static inline void trace_qemu_rdma_exchange_send_received(const char * desc)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_EXCHANGE_SEND_RECEIVED)) {
+        uint64_t args[] = { (uintptr_t)desc };
+        trace_ring_record(TRACE_QEMU_RDMA_EXCHANGE_SEND_RECEIVED, args, 1, desc);
+    }
 }
 
 static inline void trace_qemu_rdma_fill(int64_t control_len, int size)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_FILL)) {
+        uint64_t args[] = { (uint64_t)control_len, (uint64_t)size };
+        trace_ring_record(TRACE_QEMU_RDMA_FILL, args, 2, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_init_ram_blocks(int blocks)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_INIT_RAM_BLOCKS)) {
+        uint64_t args[] = { (uint64_t)blocks };
+        trace_ring_record(TRACE_QEMU_RDMA_INIT_RAM_BLOCKS, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_poll_recv(const char * compstr, int64_t comp, int64_t id, int sent)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_POLL_RECV)) {
+        uint64_t args[] = { (uintptr_t)compstr, (uint64_t)comp, (uint64_t)id, (uint64_t)sent };
+        trace_ring_record(TRACE_QEMU_RDMA_POLL_RECV, args, 4, compstr);
+    }
 }
 
 static inline void trace_qemu_rdma_poll_write(const char * compstr, int64_t comp, int left, uint64_t block, uint64_t chunk, void * local, void * remote)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_POLL_WRITE)) {
+        uint64_t args[] = { (uintptr_t)compstr, (uint64_t)comp, (uint64_t)left, (uint64_t)block, (uint64_t)chunk, (uintptr_t)local, (uintptr_t)remote };
+        trace_ring_record(TRACE_QEMU_RDMA_POLL_WRITE, args, 7, compstr);
+    }
 }
 
 static inline void trace_qemu_rdma_poll_other(const char * compstr, int64_t comp, int left)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_POLL_OTHER)) {
+        uint64_t args[] = { (uintptr_t)compstr, (uint64_t)comp, (uint64_t)left };
+        trace_ring_record(TRACE_QEMU_RDMA_POLL_OTHER, args, 3, compstr);
+    }
 }
 
 static inline void trace_qemu_rdma_post_send_control(const char * desc)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_POST_SEND_CONTROL)) {
+        uint64_t args[] = { (uintptr_t)desc };
+        trace_ring_record(TRACE_QEMU_RDMA_POST_SEND_CONTROL, args, 1, desc);
+    }
 }
 
 static inline void trace_qemu_rdma_register_and_get_keys(uint64_t len, void * start)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_REGISTER_AND_GET_KEYS)) {
+        uint64_t args[] = { (uint64_t)len, (uintptr_t)start };
+        trace_ring_record(TRACE_QEMU_RDMA_REGISTER_AND_GET_KEYS, args, 2, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_registration_handle_compress(int64_t length, int index, int64_t offset)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_COMPRESS)) {
+        uint64_t args[] = { (uint64_t)length, (uint64_t)index, (uint64_t)offset };
+        trace_ring_record(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_COMPRESS, args, 3, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_registration_handle_finished(void)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_FINISHED)) {
+        trace_ring_record(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_FINISHED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_registration_handle_ram_blocks(void)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_RAM_BLOCKS)) {
+        trace_ring_record(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_RAM_BLOCKS, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_registration_handle_register(int requests)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_REGISTER)) {
+        uint64_t args[] = { (uint64_t)requests };
+        trace_ring_record(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_REGISTER, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_registration_handle_register_loop(int req, int index, uint64_t addr, uint64_t chunks)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_REGISTER_LOOP)) {
+        uint64_t args[] = { (uint64_t)req, (uint64_t)index, (uint64_t)addr, (uint64_t)chunks };
+        trace_ring_record(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_REGISTER_LOOP, args, 4, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_registration_handle_register_rkey(int rkey)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_REGISTER_RKEY)) {
+        uint64_t args[] = { (uint64_t)rkey };
+        trace_ring_record(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_REGISTER_RKEY, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_registration_handle_unregister(int requests)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_UNREGISTER)) {
+        uint64_t args[] = { (uint64_t)requests };
+        trace_ring_record(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_UNREGISTER, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_registration_handle_unregister_loop(int count, int index, uint64_t chunk)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_UNREGISTER_LOOP)) {
+        uint64_t args[] = { (uint64_t)count, (uint64_t)index, (uint64_t)chunk };
+        trace_ring_record(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_UNREGISTER_LOOP, args, 3, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_registration_handle_unregister_success(uint64_t chunk)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_UNREGISTER_SUCCESS)) {
+        uint64_t args[] = { (uint64_t)chunk };
+        trace_ring_record(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_UNREGISTER_SUCCESS, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_registration_handle_wait(uint64_t flags)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_WAIT)) {
+        uint64_t args[] = { (uint64_t)flags };
+        trace_ring_record(TRACE_QEMU_RDMA_REGISTRATION_HANDLE_WAIT, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_registration_start(uint64_t flags)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_REGISTRATION_START)) {
+        uint64_t args[] = { (uint64_t)flags };
+        trace_ring_record(TRACE_QEMU_RDMA_REGISTRATION_START, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_registration_stop(uint64_t flags)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_REGISTRATION_STOP)) {
+        uint64_t args[] = { (uint64_t)flags };
+        trace_ring_record(TRACE_QEMU_RDMA_REGISTRATION_STOP, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_registration_stop_ram(void)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_REGISTRATION_STOP_RAM)) {
+        trace_ring_record(TRACE_QEMU_RDMA_REGISTRATION_STOP_RAM, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_resolve_host_trying(const char * host, const char * ip)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_RESOLVE_HOST_TRYING)) {
+        uint64_t args[] = { (uintptr_t)host, (uintptr_t)ip };
+        trace_ring_record(TRACE_QEMU_RDMA_RESOLVE_HOST_TRYING, args, 2, host);
+    }
 }
 
 static inline void trace_qemu_rdma_signal_unregister_append(uint64_t chunk, int pos)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_SIGNAL_UNREGISTER_APPEND)) {
+        uint64_t args[] = { (uint64_t)chunk, (uint64_t)pos };
+        trace_ring_record(TRACE_QEMU_RDMA_SIGNAL_UNREGISTER_APPEND, args, 2, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_signal_unregister_already(uint64_t chunk)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_SIGNAL_UNREGISTER_ALREADY)) {
+        uint64_t args[] = { (uint64_t)chunk };
+        trace_ring_record(TRACE_QEMU_RDMA_SIGNAL_UNREGISTER_ALREADY, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_unregister_waiting_inflight(uint64_t chunk)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_UNREGISTER_WAITING_INFLIGHT)) {
+        uint64_t args[] = { (uint64_t)chunk };
+        trace_ring_record(TRACE_QEMU_RDMA_UNREGISTER_WAITING_INFLIGHT, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_unregister_waiting_proc(uint64_t chunk, int pos)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_UNREGISTER_WAITING_PROC)) {
+        uint64_t args[] = { (uint64_t)chunk, (uint64_t)pos };
+        trace_ring_record(TRACE_QEMU_RDMA_UNREGISTER_WAITING_PROC, args, 2, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_unregister_waiting_send(uint64_t chunk)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_UNREGISTER_WAITING_SEND)) {
+        uint64_t args[] = { (uint64_t)chunk };
+        trace_ring_record(TRACE_QEMU_RDMA_UNREGISTER_WAITING_SEND, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_unregister_waiting_complete(uint64_t chunk)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_UNREGISTER_WAITING_COMPLETE)) {
+        uint64_t args[] = { (uint64_t)chunk };
+        trace_ring_record(TRACE_QEMU_RDMA_UNREGISTER_WAITING_COMPLETE, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_write_flush(int sent)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_WRITE_FLUSH)) {
+        uint64_t args[] = { (uint64_t)sent };
+        trace_ring_record(TRACE_QEMU_RDMA_WRITE_FLUSH, args, 1, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_write_one_block(int count, int block, uint64_t chunk, uint64_t current, uint64_t len, int nb_sent, int nb_chunks)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_WRITE_ONE_BLOCK)) {
+        uint64_t args[] = { (uint64_t)count, (uint64_t)block, (uint64_t)chunk, (uint64_t)current, (uint64_t)len, (uint64_t)nb_sent, (uint64_t)nb_chunks };
+        trace_ring_record(TRACE_QEMU_RDMA_WRITE_ONE_BLOCK, args, 7, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_write_one_post(uint64_t chunk, long addr, long remote, uint32_t len)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_WRITE_ONE_POST)) {
+        uint64_t args[] = { (uint64_t)chunk, (uint64_t)addr, (uint64_t)remote, (uint64_t)len };
+        trace_ring_record(TRACE_QEMU_RDMA_WRITE_ONE_POST, args, 4, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_write_one_queue_full(void)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_WRITE_ONE_QUEUE_FULL)) {
+        trace_ring_record(TRACE_QEMU_RDMA_WRITE_ONE_QUEUE_FULL, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_write_one_recvregres(int mykey, int theirkey, uint64_t chunk)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_WRITE_ONE_RECVREGRES)) {
+        uint64_t args[] = { (uint64_t)mykey, (uint64_t)theirkey, (uint64_t)chunk };
+        trace_ring_record(TRACE_QEMU_RDMA_WRITE_ONE_RECVREGRES, args, 3, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_write_one_sendreg(uint64_t chunk, int len, int index, int64_t offset)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_WRITE_ONE_SENDREG)) {
+        uint64_t args[] = { (uint64_t)chunk, (uint64_t)len, (uint64_t)index, (uint64_t)offset };
+        trace_ring_record(TRACE_QEMU_RDMA_WRITE_ONE_SENDREG, args, 4, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_write_one_top(uint64_t chunks, uint64_t size)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_WRITE_ONE_TOP)) {
+        uint64_t args[] = { (uint64_t)chunks, (uint64_t)size };
+        trace_ring_record(TRACE_QEMU_RDMA_WRITE_ONE_TOP, args, 2, NULL);
+    }
 }
 
 static inline void trace_qemu_rdma_write_one_zero(uint64_t chunk, int len, int index, int64_t offset)
 {
+    if (trace_event_get_state(TRACE_QEMU_RDMA_WRITE_ONE_ZERO)) {
+        uint64_t args[] = { (uint64_t)chunk, (uint64_t)len, (uint64_t)index, (uint64_t)offset };
+        trace_ring_record(TRACE_QEMU_RDMA_WRITE_ONE_ZERO, args, 4, NULL);
+    }
 }
 
 static inline void trace_rdma_add_block(int block, uint64_t addr, uint64_t offset, uint64_t len, uint64_t end, uint64_t bits, int chunks)
 {
+    if (trace_event_get_state(TRACE_RDMA_ADD_BLOCK)) {
+        uint64_t args[] = { (uint64_t)block, (uint64_t)addr, (uint64_t)offset, (uint64_t)len, (uint64_t)end, (uint64_t)bits, (uint64_t)chunks };
+        trace_ring_record(TRACE_RDMA_ADD_BLOCK, args, 7, NULL);
+    }
 }
 
 static inline void trace_rdma_delete_block(int block, uint64_t addr, uint64_t offset, uint64_t len, uint64_t end, uint64_t bits, int chunks)
 {
+    if (trace_event_get_state(TRACE_RDMA_DELETE_BLOCK)) {
+        uint64_t args[] = { (uint64_t)block, (uint64_t)addr, (uint64_t)offset, (uint64_t)len, (uint64_t)end, (uint64_t)bits, (uint64_t)chunks };
+        trace_ring_record(TRACE_RDMA_DELETE_BLOCK, args, 7, NULL);
+    }
 }
 
 static inline void trace_rdma_start_incoming_migration(void)
 {
+    if (trace_event_get_state(TRACE_RDMA_START_INCOMING_MIGRATION)) {
+        trace_ring_record(TRACE_RDMA_START_INCOMING_MIGRATION, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_rdma_start_incoming_migration_after_dest_init(void)
 {
+    if (trace_event_get_state(TRACE_RDMA_START_INCOMING_MIGRATION_AFTER_DEST_INIT)) {
+        trace_ring_record(TRACE_RDMA_START_INCOMING_MIGRATION_AFTER_DEST_INIT, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_rdma_start_incoming_migration_after_rdma_listen(void)
 {
+    if (trace_event_get_state(TRACE_RDMA_START_INCOMING_MIGRATION_AFTER_RDMA_LISTEN)) {
+        trace_ring_record(TRACE_RDMA_START_INCOMING_MIGRATION_AFTER_RDMA_LISTEN, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_rdma_start_outgoing_migration_after_rdma_connect(void)
 {
+    if (trace_event_get_state(TRACE_RDMA_START_OUTGOING_MIGRATION_AFTER_RDMA_CONNECT)) {
+        trace_ring_record(TRACE_RDMA_START_OUTGOING_MIGRATION_AFTER_RDMA_CONNECT, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_rdma_start_outgoing_migration_after_rdma_source_init(void)
 {
+    if (trace_event_get_state(TRACE_RDMA_START_OUTGOING_MIGRATION_AFTER_RDMA_SOURCE_INIT)) {
+        trace_ring_record(TRACE_RDMA_START_OUTGOING_MIGRATION_AFTER_RDMA_SOURCE_INIT, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_kvm_ioctl(int type, void * arg)
 {
+    if (trace_event_get_state(TRACE_KVM_IOCTL)) {
+        uint64_t args[] = { (uint64_t)type, (uintptr_t)arg };
+        trace_ring_record(TRACE_KVM_IOCTL, args, 2, NULL);
+    }
 }
 
 static inline void trace_kvm_vm_ioctl(int type, void * arg)
 {
+    if (trace_event_get_state(TRACE_KVM_VM_IOCTL)) {
+        uint64_t args[] = { (uint64_t)type, (uintptr_t)arg };
+        trace_ring_record(TRACE_KVM_VM_IOCTL, args, 2, NULL);
+    }
 }
 
 static inline void trace_kvm_vcpu_ioctl(int cpu_index, int type, void * arg)
 {
+    if (trace_event_get_state(TRACE_KVM_VCPU_IOCTL)) {
+        uint64_t args[] = { (uint64_t)cpu_index, (uint64_t)type, (uintptr_t)arg };
+        trace_ring_record(TRACE_KVM_VCPU_IOCTL, args, 3, NULL);
+    }
 }
 
 static inline void trace_kvm_run_exit(int cpu_index, uint32_t reason)
 {
+    if (trace_event_get_state(TRACE_KVM_RUN_EXIT)) {
+        uint64_t args[] = { (uint64_t)cpu_index, (uint64_t)reason };
+        trace_ring_record(TRACE_KVM_RUN_EXIT, args, 2, NULL);
+    }
 }
 
 static inline void trace_kvm_device_ioctl(int fd, int type, void * arg)
 {
+    if (trace_event_get_state(TRACE_KVM_DEVICE_IOCTL)) {
+        uint64_t args[] = { (uint64_t)fd, (uint64_t)type, (uintptr_t)arg };
+        trace_ring_record(TRACE_KVM_DEVICE_IOCTL, args, 3, NULL);
+    }
 }
 
 static inline void trace_kvm_failed_reg_get(uint64_t id, const char * msg)
 {
+    if (trace_event_get_state(TRACE_KVM_FAILED_REG_GET)) {
+        uint64_t args[] = { (uint64_t)id, (uintptr_t)msg };
+        trace_ring_record(TRACE_KVM_FAILED_REG_GET, args, 2, msg);
+    }
 }
 
 static inline void trace_kvm_failed_reg_set(uint64_t id, const char * msg)
 {
+    if (trace_event_get_state(TRACE_KVM_FAILED_REG_SET)) {
+        uint64_t args[] = { (uint64_t)id, (uintptr_t)msg };
+        trace_ring_record(TRACE_KVM_FAILED_REG_SET, args, 2, msg);
+    }
 }
 
 static inline void trace_kvm_failed_spr_set(int str, const char * msg)
 {
+    if (trace_event_get_state(TRACE_KVM_FAILED_SPR_SET)) {
+        uint64_t args[] = { (uint64_t)str, (uintptr_t)msg };
+        trace_ring_record(TRACE_KVM_FAILED_SPR_SET, args, 2, msg);
+    }
 }
 
 static inline void trace_kvm_failed_spr_get(int str, const char * msg)
 {
+    if (trace_event_get_state(TRACE_KVM_FAILED_SPR_GET)) {
+        uint64_t args[] = { (uint64_t)str, (uintptr_t)msg };
+        trace_ring_record(TRACE_KVM_FAILED_SPR_GET, args, 2, msg);
+    }
 }
 
 static inline void trace_exec_tb(void * tb, uintptr_t pc)
 {
+    if (trace_event_get_state(TRACE_EXEC_TB)) {
+        uint64_t args[] = { (uintptr_t)tb, (uint64_t)pc };
+        trace_ring_record(TRACE_EXEC_TB, args, 2, NULL);
+    }
 }
 
 static inline void trace_exec_tb_nocache(void * tb, uintptr_t pc)
 {
+    if (trace_event_get_state(TRACE_EXEC_TB_NOCACHE)) {
+        uint64_t args[] = { (uintptr_t)tb, (uint64_t)pc };
+        trace_ring_record(TRACE_EXEC_TB_NOCACHE, args, 2, NULL);
+    }
 }
 
 static inline void trace_exec_tb_exit(void * next_tb, unsigned int flags)
 {
+    if (trace_event_get_state(TRACE_EXEC_TB_EXIT)) {
+        uint64_t args[] = { (uintptr_t)next_tb, (uint64_t)flags };
+        trace_ring_record(TRACE_EXEC_TB_EXIT, args, 2, NULL);
+    }
 }
 
 static inline void trace_translate_block(void * tb, uintptr_t pc, uint8_t * tb_code)
 {
+    if (trace_event_get_state(TRACE_TRANSLATE_BLOCK)) {
+        uint64_t args[] = { (uintptr_t)tb, (uint64_t)pc, (uintptr_t)tb_code };
+        trace_ring_record(TRACE_TRANSLATE_BLOCK, args, 3, NULL);
+    }
 }
 
 static inline void trace_memory_region_ops_read(void * mr, uint64_t addr, uint64_t value, unsigned size)
 {
+    if (trace_event_get_state(TRACE_MEMORY_REGION_OPS_READ)) {
+        uint64_t args[] = { (uintptr_t)mr, (uint64_t)addr, (uint64_t)value, (uint64_t)size };
+        trace_ring_record(TRACE_MEMORY_REGION_OPS_READ, args, 4, NULL);
+    }
 }
 
 static inline void trace_memory_region_ops_write(void * mr, uint64_t addr, uint64_t value, unsigned size)
 {
+    if (trace_event_get_state(TRACE_MEMORY_REGION_OPS_WRITE)) {
+        uint64_t args[] = { (uintptr_t)mr, (uint64_t)addr, (uint64_t)value, (uint64_t)size };
+        trace_ring_record(TRACE_MEMORY_REGION_OPS_WRITE, args, 4, NULL);
+    }
 }
 
 static inline void trace_object_dynamic_cast_assert(const char * type, const char * target, const char * file, int line, const char * func)
 {
+    if (trace_event_get_state(TRACE_OBJECT_DYNAMIC_CAST_ASSERT)) {
+        uint64_t args[] = { (uintptr_t)type, (uintptr_t)target, (uintptr_t)file, (uint64_t)line, (uintptr_t)func };
+        trace_ring_record(TRACE_OBJECT_DYNAMIC_CAST_ASSERT, args, 5, type);
+    }
 }
 
 static inline void trace_object_class_dynamic_cast_assert(const char * type, const char * target, const char * file, int line, const char * func)
 {
+    if (trace_event_get_state(TRACE_OBJECT_CLASS_DYNAMIC_CAST_ASSERT)) {
+        uint64_t args[] = { (uintptr_t)type, (uintptr_t)target, (uintptr_t)file, (uint64_t)line, (uintptr_t)func };
+        trace_ring_record(TRACE_OBJECT_CLASS_DYNAMIC_CAST_ASSERT, args, 5, type);
+    }
 }
 
 static inline void trace_xen_pv_mmio_read(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_XEN_PV_MMIO_READ)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_XEN_PV_MMIO_READ, args, 1, NULL);
+    }
 }
 
 static inline void trace_xen_pv_mmio_write(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_XEN_PV_MMIO_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_XEN_PV_MMIO_WRITE, args, 1, NULL);
+    }
 }
 
 static inline void trace_pci_cfg_read(const char * dev, unsigned devid, unsigned fnid, unsigned offs, unsigned val)
 {
+    if (trace_event_get_state(TRACE_PCI_CFG_READ)) {
+        uint64_t args[] = { (uintptr_t)dev, (uint64_t)devid, (uint64_t)fnid, (uint64_t)offs, (uint64_t)val };
+        trace_ring_record(TRACE_PCI_CFG_READ, args, 5, dev);
+    }
 }
 
 static inline void trace_pci_cfg_write(const char * dev, unsigned devid, unsigned fnid, unsigned offs, unsigned val)
 {
+    if (trace_event_get_state(TRACE_PCI_CFG_WRITE)) {
+        uint64_t args[] = { (uintptr_t)dev, (uint64_t)devid, (uint64_t)fnid, (uint64_t)offs, (uint64_t)val };
+        trace_ring_record(TRACE_PCI_CFG_WRITE, args, 5, dev);
+    }
 }
 
 static inline void trace_vfio_intx_interrupt(const char * name, char line)
 {
+    if (trace_event_get_state(TRACE_VFIO_INTX_INTERRUPT)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)line };
+        trace_ring_record(TRACE_VFIO_INTX_INTERRUPT, args, 2, name);
+    }
 }
 
 static inline void trace_vfio_eoi(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_EOI)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_EOI, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_enable_intx_kvm(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_ENABLE_INTX_KVM)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_ENABLE_INTX_KVM, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_disable_intx_kvm(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_DISABLE_INTX_KVM)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_DISABLE_INTX_KVM, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_update_irq(const char * name, int new_irq, int target_irq)
 {
+    if (trace_event_get_state(TRACE_VFIO_UPDATE_IRQ)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)new_irq, (uint64_t)target_irq };
+        trace_ring_record(TRACE_VFIO_UPDATE_IRQ, args, 3, name);
+    }
 }
 
 static inline void trace_vfio_enable_intx(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_ENABLE_INTX)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_ENABLE_INTX, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_disable_intx(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_DISABLE_INTX)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_DISABLE_INTX, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_msi_interrupt(const char * name, int index, uint64_t addr, int data)
 {
+    if (trace_event_get_state(TRACE_VFIO_MSI_INTERRUPT)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)index, (uint64_t)addr, (uint64_t)data };
+        trace_ring_record(TRACE_VFIO_MSI_INTERRUPT, args, 4, name);
+    }
 }
 
 static inline void trace_vfio_msix_vector_do_use(const char * name, int index)
 {
+    if (trace_event_get_state(TRACE_VFIO_MSIX_VECTOR_DO_USE)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)index };
+        trace_ring_record(TRACE_VFIO_MSIX_VECTOR_DO_USE, args, 2, name);
+    }
 }
 
 static inline void trace_vfio_msix_vector_release(const char * name, int index)
 {
+    if (trace_event_get_state(TRACE_VFIO_MSIX_VECTOR_RELEASE)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)index };
+        trace_ring_record(TRACE_VFIO_MSIX_VECTOR_RELEASE, args, 2, name);
+    }
 }
 
 static inline void trace_vfio_enable_msix(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_ENABLE_MSIX)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_ENABLE_MSIX, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_enable_msi(const char * name, int nr_vectors)
 {
+    if (trace_event_get_state(TRACE_VFIO_ENABLE_MSI)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)nr_vectors };
+        trace_ring_record(TRACE_VFIO_ENABLE_MSI, args, 2, name);
+    }
 }
 
 static inline void trace_vfio_disable_msix(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_DISABLE_MSIX)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_DISABLE_MSIX, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_disable_msi(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_DISABLE_MSI)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_DISABLE_MSI, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_pci_load_rom(const char * name, unsigned long size, unsigned long offset, unsigned long flags)
 {
+    if (trace_event_get_state(TRACE_VFIO_PCI_LOAD_ROM)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)size, (uint64_t)offset, (uint64_t)flags };
+        trace_ring_record(TRACE_VFIO_PCI_LOAD_ROM, args, 4, name);
+    }
 }
 
 static inline void trace_vfio_rom_read(const char * name, uint64_t addr, int size, uint64_t data)
 {
+    if (trace_event_get_state(TRACE_VFIO_ROM_READ)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)addr, (uint64_t)size, (uint64_t)data };
+        trace_ring_record(TRACE_VFIO_ROM_READ, args, 4, name);
+    }
 }
 
 static inline void trace_vfio_pci_size_rom(const char * name, int size)
 {
+    if (trace_event_get_state(TRACE_VFIO_PCI_SIZE_ROM)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)size };
+        trace_ring_record(TRACE_VFIO_PCI_SIZE_ROM, args, 2, name);
+    }
 }
 
 static inline void trace_vfio_vga_write(uint64_t addr, uint64_t data, int size)
 {
+    if (trace_event_get_state(TRACE_VFIO_VGA_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)data, (uint64_t)size };
+        trace_ring_record(TRACE_VFIO_VGA_WRITE, args, 3, NULL);
+    }
 }
 
 static inline void trace_vfio_vga_read(uint64_t addr, int size, uint64_t data)
 {
+    if (trace_event_get_state(TRACE_VFIO_VGA_READ)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)size, (uint64_t)data };
+        trace_ring_record(TRACE_VFIO_VGA_READ, args, 3, NULL);
+    }
 }
 
 static inline void trace_vfio_generic_window_quirk_read(const char * region_name, const char * name, int index, uint64_t addr, int size, uint64_t data)
 {
+    if (trace_event_get_state(TRACE_VFIO_GENERIC_WINDOW_QUIRK_READ)) {
+        uint64_t args[] = { (uintptr_t)region_name, (uintptr_t)name, (uint64_t)index, (uint64_t)addr, (uint64_t)size, (uint64_t)data };
+        trace_ring_record(TRACE_VFIO_GENERIC_WINDOW_QUIRK_READ, args, 6, region_name);
+    }
 }
 
 static inline void trace_vfio_generic_window_quirk_write(const char * region_name, const char * name, int index, uint64_t addr, uint64_t data, int size)
 {
+    if (trace_event_get_state(TRACE_VFIO_GENERIC_WINDOW_QUIRK_WRITE)) {
+        uint64_t args[] = { (uintptr_t)region_name, (uintptr_t)name, (uint64_t)index, (uint64_t)addr, (uint64_t)data, (uint64_t)size };
+        trace_ring_record(TRACE_VFIO_GENERIC_WINDOW_QUIRK_WRITE, args, 6, region_name);
+    }
 }
 
 static inline void trace_vfio_generic_quirk_read(const char * region_name, const char * name, int index, uint64_t addr, int size, uint64_t data)
 {
+    if (trace_event_get_state(TRACE_VFIO_GENERIC_QUIRK_READ)) {
+        uint64_t args[] = { (uintptr_t)region_name, (uintptr_t)name, (uint64_t)index, (uint64_t)addr, (uint64_t)size, (uint64_t)data };
+        trace_ring_record(TRACE_VFIO_GENERIC_QUIRK_READ, args, 6, region_name);
+    }
 }
 
 static inline void trace_vfio_generic_quirk_write(const char * region_name, const char * name, int index, uint64_t addr, uint64_t data, int size)
 {
+    if (trace_event_get_state(TRACE_VFIO_GENERIC_QUIRK_WRITE)) {
+        uint64_t args[] = { (uintptr_t)region_name, (uintptr_t)name, (uint64_t)index, (uint64_t)addr, (uint64_t)data, (uint64_t)size };
+        trace_ring_record(TRACE_VFIO_GENERIC_QUIRK_WRITE, args, 6, region_name);
+    }
 }
 
 static inline void trace_vfio_ati_3c3_quirk_read(uint64_t data)
 {
+    if (trace_event_get_state(TRACE_VFIO_ATI_3C3_QUIRK_READ)) {
+        uint64_t args[] = { (uint64_t)data };
+        trace_ring_record(TRACE_VFIO_ATI_3C3_QUIRK_READ, args, 1, NULL);
+    }
 }
 
 static inline void trace_vfio_vga_probe_ati_3c3_quirk(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_VGA_PROBE_ATI_3C3_QUIRK)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_VGA_PROBE_ATI_3C3_QUIRK, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_probe_ati_bar4_window_quirk(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_PROBE_ATI_BAR4_WINDOW_QUIRK)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_PROBE_ATI_BAR4_WINDOW_QUIRK, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_rtl8168_window_quirk_read_fake(const char * region_name, const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_RTL8168_WINDOW_QUIRK_READ_FAKE)) {
+        uint64_t args[] = { (uintptr_t)region_name, (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_RTL8168_WINDOW_QUIRK_READ_FAKE, args, 2, region_name);
+    }
 }
 
 static inline void trace_vfio_rtl8168_window_quirk_read_table(const char * region_name, const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_RTL8168_WINDOW_QUIRK_READ_TABLE)) {
+        uint64_t args[] = { (uintptr_t)region_name, (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_RTL8168_WINDOW_QUIRK_READ_TABLE, args, 2, region_name);
+    }
 }
 
 static inline void trace_vfio_rtl8168_window_quirk_read_direct(const char * region_name, const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_RTL8168_WINDOW_QUIRK_READ_DIRECT)) {
+        uint64_t args[] = { (uintptr_t)region_name, (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_RTL8168_WINDOW_QUIRK_READ_DIRECT, args, 2, region_name);
+    }
 }
 
 static inline void trace_vfio_rtl8168_window_quirk_write_table(const char * region_name, const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_RTL8168_WINDOW_QUIRK_WRITE_TABLE)) {
+        uint64_t args[] = { (uintptr_t)region_name, (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_RTL8168_WINDOW_QUIRK_WRITE_TABLE, args, 2, region_name);
+    }
 }
 
 static inline void trace_vfio_rtl8168_window_quirk_write_direct(const char * region_name, const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_RTL8168_WINDOW_QUIRK_WRITE_DIRECT)) {
+        uint64_t args[] = { (uintptr_t)region_name, (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_RTL8168_WINDOW_QUIRK_WRITE_DIRECT, args, 2, region_name);
+    }
 }
 
 static inline void trace_vfio_probe_rtl8168_bar2_window_quirk(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_PROBE_RTL8168_BAR2_WINDOW_QUIRK)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_PROBE_RTL8168_BAR2_WINDOW_QUIRK, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_probe_ati_bar2_4000_quirk(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_PROBE_ATI_BAR2_4000_QUIRK)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_PROBE_ATI_BAR2_4000_QUIRK, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_nvidia_3d0_quirk_read(int size, uint64_t data)
 {
+    if (trace_event_get_state(TRACE_VFIO_NVIDIA_3D0_QUIRK_READ)) {
+        uint64_t args[] = { (uint64_t)size, (uint64_t)data };
+        trace_ring_record(TRACE_VFIO_NVIDIA_3D0_QUIRK_READ, args, 2, NULL);
+    }
 }
 
 static inline void trace_vfio_nvidia_3d0_quirk_write(uint64_t data, int size)
 {
+    if (trace_event_get_state(TRACE_VFIO_NVIDIA_3D0_QUIRK_WRITE)) {
+        uint64_t args[] = { (uint64_t)data, (uint64_t)size };
+        trace_ring_record(TRACE_VFIO_NVIDIA_3D0_QUIRK_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_vfio_vga_probe_nvidia_3d0_quirk(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_VGA_PROBE_NVIDIA_3D0_QUIRK)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_VGA_PROBE_NVIDIA_3D0_QUIRK, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_probe_nvidia_bar5_window_quirk(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_PROBE_NVIDIA_BAR5_WINDOW_QUIRK)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_PROBE_NVIDIA_BAR5_WINDOW_QUIRK, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_probe_nvidia_bar0_88000_quirk(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_PROBE_NVIDIA_BAR0_88000_QUIRK)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_PROBE_NVIDIA_BAR0_88000_QUIRK, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_probe_nvidia_bar0_1800_quirk_id(int id)
 {
+    if (trace_event_get_state(TRACE_VFIO_PROBE_NVIDIA_BAR0_1800_QUIRK_ID)) {
+        uint64_t args[] = { (uint64_t)id };
+        trace_ring_record(TRACE_VFIO_PROBE_NVIDIA_BAR0_1800_QUIRK_ID, args, 1, NULL);
+    }
 }
 
 static inline void trace_vfio_probe_nvidia_bar0_1800_quirk(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_PROBE_NVIDIA_BAR0_1800_QUIRK)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_PROBE_NVIDIA_BAR0_1800_QUIRK, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_pci_read_config(const char * name, int addr, int len, int val)
 {
+    if (trace_event_get_state(TRACE_VFIO_PCI_READ_CONFIG)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)addr, (uint64_t)len, (uint64_t)val };
+        trace_ring_record(TRACE_VFIO_PCI_READ_CONFIG, args, 4, name);
+    }
 }
 
 static inline void trace_vfio_pci_write_config(const char * name, int addr, int val, int len)
 {
+    if (trace_event_get_state(TRACE_VFIO_PCI_WRITE_CONFIG)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)addr, (uint64_t)val, (uint64_t)len };
+        trace_ring_record(TRACE_VFIO_PCI_WRITE_CONFIG, args, 4, name);
+    }
 }
 
 static inline void trace_vfio_setup_msi(const char * name, int pos)
 {
+    if (trace_event_get_state(TRACE_VFIO_SETUP_MSI)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)pos };
+        trace_ring_record(TRACE_VFIO_SETUP_MSI, args, 2, name);
+    }
 }
 
 static inline void trace_vfio_early_setup_msix(const char * name, int pos, int table_bar, int offset, int entries)
 {
+    if (trace_event_get_state(TRACE_VFIO_EARLY_SETUP_MSIX)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)pos, (uint64_t)table_bar, (uint64_t)offset, (uint64_t)entries };
+        trace_ring_record(TRACE_VFIO_EARLY_SETUP_MSIX, args, 5, name);
+    }
 }
 
 static inline void trace_vfio_check_pcie_flr(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_CHECK_PCIE_FLR)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_CHECK_PCIE_FLR, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_check_pm_reset(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_CHECK_PM_RESET)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_CHECK_PM_RESET, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_check_af_flr(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_CHECK_AF_FLR)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_CHECK_AF_FLR, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_pci_hot_reset(const char * name, const char * type)
 {
+    if (trace_event_get_state(TRACE_VFIO_PCI_HOT_RESET)) {
+        uint64_t args[] = { (uintptr_t)name, (uintptr_t)type };
+        trace_ring_record(TRACE_VFIO_PCI_HOT_RESET, args, 2, name);
+    }
 }
 
 static inline void trace_vfio_pci_hot_reset_has_dep_devices(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_PCI_HOT_RESET_HAS_DEP_DEVICES)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_PCI_HOT_RESET_HAS_DEP_DEVICES, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_pci_hot_reset_dep_devices(int domain, int bus, int slot, int function, int group_id)
 {
+    if (trace_event_get_state(TRACE_VFIO_PCI_HOT_RESET_DEP_DEVICES)) {
+        uint64_t args[] = { (uint64_t)domain, (uint64_t)bus, (uint64_t)slot, (uint64_t)function, (uint64_t)group_id };
+        trace_ring_record(TRACE_VFIO_PCI_HOT_RESET_DEP_DEVICES, args, 5, NULL);
+    }
 }
 
 static inline void trace_vfio_pci_hot_reset_result(const char * name, const char * result)
 {
+    if (trace_event_get_state(TRACE_VFIO_PCI_HOT_RESET_RESULT)) {
+        uint64_t args[] = { (uintptr_t)name, (uintptr_t)result };
+        trace_ring_record(TRACE_VFIO_PCI_HOT_RESET_RESULT, args, 2, name);
+    }
 }
 
 static inline void trace_vfio_populate_device_region(const char * region_name, int index, unsigned long size, unsigned long offset, unsigned long flags)
 {
+    if (trace_event_get_state(TRACE_VFIO_POPULATE_DEVICE_REGION)) {
+        uint64_t args[] = { (uintptr_t)region_name, (uint64_t)index, (uint64_t)size, (uint64_t)offset, (uint64_t)flags };
+        trace_ring_record(TRACE_VFIO_POPULATE_DEVICE_REGION, args, 5, region_name);
+    }
 }
 
 static inline void trace_vfio_populate_device_config(const char * name, unsigned long size, unsigned long offset, unsigned long flags)
 {
+    if (trace_event_get_state(TRACE_VFIO_POPULATE_DEVICE_CONFIG)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)size, (uint64_t)offset, (uint64_t)flags };
+        trace_ring_record(TRACE_VFIO_POPULATE_DEVICE_CONFIG, args, 4, name);
+    }
 }
 
 static inline void trace_vfio_populate_device_get_irq_info_failure(void)
 {
+    if (trace_event_get_state(TRACE_VFIO_POPULATE_DEVICE_GET_IRQ_INFO_FAILURE)) {
+        trace_ring_record(TRACE_VFIO_POPULATE_DEVICE_GET_IRQ_INFO_FAILURE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_vfio_initfn(const char * name, int group_id)
 {
+    if (trace_event_get_state(TRACE_VFIO_INITFN)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)group_id };
+        trace_ring_record(TRACE_VFIO_INITFN, args, 2, name);
+    }
 }
 
 static inline void trace_vfio_pci_reset(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_PCI_RESET)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_PCI_RESET, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_pci_reset_flr(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_PCI_RESET_FLR)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_PCI_RESET_FLR, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_pci_reset_pm(const char * name)
 {
+    if (trace_event_get_state(TRACE_VFIO_PCI_RESET_PM)) {
+        uint64_t args[] = { (uintptr_t)name };
+        trace_ring_record(TRACE_VFIO_PCI_RESET_PM, args, 1, name);
+    }
 }
 
 static inline void trace_vfio_region_write(const char * name, int index, uint64_t addr, uint64_t data, unsigned size)
 {
+    if (trace_event_get_state(TRACE_VFIO_REGION_WRITE)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)index, (uint64_t)addr, (uint64_t)data, (uint64_t)size };
+        trace_ring_record(TRACE_VFIO_REGION_WRITE, args, 5, name);
+    }
 }
 
 static inline void trace_vfio_region_read(char * name, int index, uint64_t addr, unsigned size, uint64_t data)
 {
+    if (trace_event_get_state(TRACE_VFIO_REGION_READ)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)index, (uint64_t)addr, (uint64_t)size, (uint64_t)data };
+        trace_ring_record(TRACE_VFIO_REGION_READ, args, 5, name);
+    }
 }
 
 static inline void trace_vfio_iommu_map_notify(uint64_t iova_start, uint64_t iova_end)
 {
+    if (trace_event_get_state(TRACE_VFIO_IOMMU_MAP_NOTIFY)) {
+        uint64_t args[] = { (uint64_t)iova_start, (uint64_t)iova_end };
+        trace_ring_record(TRACE_VFIO_IOMMU_MAP_NOTIFY, args, 2, NULL);
+    }
 }
 
 static inline void trace_vfio_listener_region_add_skip(uint64_t start, uint64_t end)
 {
+    if (trace_event_get_state(TRACE_VFIO_LISTENER_REGION_ADD_SKIP)) {
+        uint64_t args[] = { (uint64_t)start, (uint64_t)end };
+        trace_ring_record(TRACE_VFIO_LISTENER_REGION_ADD_SKIP, args, 2, NULL);
+    }
 }
 
 static inline void trace_vfio_listener_region_add_iommu(uint64_t start, uint64_t end)
 {
+    if (trace_event_get_state(TRACE_VFIO_LISTENER_REGION_ADD_IOMMU)) {
+        uint64_t args[] = { (uint64_t)start, (uint64_t)end };
+        trace_ring_record(TRACE_VFIO_LISTENER_REGION_ADD_IOMMU, args, 2, NULL);
+    }
 }
 
 static inline void trace_vfio_listener_region_add_ram(uint64_t iova_start, uint64_t iova_end, void * vaddr)
 {
+    if (trace_event_get_state(TRACE_VFIO_LISTENER_REGION_ADD_RAM)) {
+        uint64_t args[] = { (uint64_t)iova_start, (uint64_t)iova_end, (uintptr_t)vaddr };
+        trace_ring_record(TRACE_VFIO_LISTENER_REGION_ADD_RAM, args, 3, NULL);
+    }
 }
 
 static inline void trace_vfio_listener_region_del_skip(uint64_t start, uint64_t end)
 {
+    if (trace_event_get_state(TRACE_VFIO_LISTENER_REGION_DEL_SKIP)) {
+        uint64_t args[] = { (uint64_t)start, (uint64_t)end };
+        trace_ring_record(TRACE_VFIO_LISTENER_REGION_DEL_SKIP, args, 2, NULL);
+    }
 }
 
 static inline void trace_vfio_listener_region_del(uint64_t start, uint64_t end)
 {
+    if (trace_event_get_state(TRACE_VFIO_LISTENER_REGION_DEL)) {
+        uint64_t args[] = { (uint64_t)start, (uint64_t)end };
+        trace_ring_record(TRACE_VFIO_LISTENER_REGION_DEL, args, 2, NULL);
+    }
 }
 
 static inline void trace_vfio_disconnect_container(int fd)
 {
+    if (trace_event_get_state(TRACE_VFIO_DISCONNECT_CONTAINER)) {
+        uint64_t args[] = { (uint64_t)fd };
+        trace_ring_record(TRACE_VFIO_DISCONNECT_CONTAINER, args, 1, NULL);
+    }
 }
 
 static inline void trace_vfio_put_group(int fd)
 {
+    if (trace_event_get_state(TRACE_VFIO_PUT_GROUP)) {
+        uint64_t args[] = { (uint64_t)fd };
+        trace_ring_record(TRACE_VFIO_PUT_GROUP, args, 1, NULL);
+    }
 }
 
 static inline void trace_vfio_get_device(const char * name, unsigned int flags, unsigned int num_regions, unsigned int num_irqs)
 {
+    if (trace_event_get_state(TRACE_VFIO_GET_DEVICE)) {
+        uint64_t args[] = { (uintptr_t)name, (uint64_t)flags, (uint64_t)num_regions, (uint64_t)num_irqs };
+        trace_ring_record(TRACE_VFIO_GET_DEVICE, args, 4, name);
+    }
 }
 
 static inline void trace_vfio_put_base_device(int fd)
 {
+    if (trace_event_get_state(TRACE_VFIO_PUT_BASE_DEVICE)) {
+        uint64_t args[] = { (uint64_t)fd };
+        trace_ring_record(TRACE_VFIO_PUT_BASE_DEVICE, args, 1, NULL);
+    }
 }
 
 static inline void trace_mhp_acpi_invalid_slot_selected(uint32_t slot)
 {
+    if (trace_event_get_state(TRACE_MHP_ACPI_INVALID_SLOT_SELECTED)) {
+        uint64_t args[] = { (uint64_t)slot };
+        trace_ring_record(TRACE_MHP_ACPI_INVALID_SLOT_SELECTED, args, 1, NULL);
+    }
 }
 
 static inline void trace_mhp_acpi_read_addr_lo(uint32_t slot, uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_MHP_ACPI_READ_ADDR_LO)) {
+        uint64_t args[] = { (uint64_t)slot, (uint64_t)addr };
+        trace_ring_record(TRACE_MHP_ACPI_READ_ADDR_LO, args, 2, NULL);
+    }
 }
 
 static inline void trace_mhp_acpi_read_addr_hi(uint32_t slot, uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_MHP_ACPI_READ_ADDR_HI)) {
+        uint64_t args[] = { (uint64_t)slot, (uint64_t)addr };
+        trace_ring_record(TRACE_MHP_ACPI_READ_ADDR_HI, args, 2, NULL);
+    }
 }
 
 static inline void trace_mhp_acpi_read_size_lo(uint32_t slot, uint32_t size)
 {
+    if (trace_event_get_state(TRACE_MHP_ACPI_READ_SIZE_LO)) {
+        uint64_t args[] = { (uint64_t)slot, (uint64_t)size };
+        trace_ring_record(TRACE_MHP_ACPI_READ_SIZE_LO, args, 2, NULL);
+    }
 }
 
 static inline void trace_mhp_acpi_read_size_hi(uint32_t slot, uint32_t size)
 {
+    if (trace_event_get_state(TRACE_MHP_ACPI_READ_SIZE_HI)) {
+        uint64_t args[] = { (uint64_t)slot, (uint64_t)size };
+        trace_ring_record(TRACE_MHP_ACPI_READ_SIZE_HI, args, 2, NULL);
+    }
 }
 
 static inline void trace_mhp_acpi_read_pxm(uint32_t slot, uint32_t pxm)
 {
+    if (trace_event_get_state(TRACE_MHP_ACPI_READ_PXM)) {
+        uint64_t args[] = { (uint64_t)slot, (uint64_t)pxm };
+        trace_ring_record(TRACE_MHP_ACPI_READ_PXM, args, 2, NULL);
+    }
 }
 
 static inline void trace_mhp_acpi_read_flags(uint32_t slot, uint32_t flags)
 {
+    if (trace_event_get_state(TRACE_MHP_ACPI_READ_FLAGS)) {
+        uint64_t args[] = { (uint64_t)slot, (uint64_t)flags };
+        trace_ring_record(TRACE_MHP_ACPI_READ_FLAGS, args, 2, NULL);
+    }
 }
 
 static inline void trace_mhp_acpi_write_slot(uint32_t slot)
 {
+    if (trace_event_get_state(TRACE_MHP_ACPI_WRITE_SLOT)) {
+        uint64_t args[] = { (uint64_t)slot };
+        trace_ring_record(TRACE_MHP_ACPI_WRITE_SLOT, args, 1, NULL);
+    }
 }
 
 static inline void trace_mhp_acpi_write_ost_ev(uint32_t slot, uint32_t ev)
 {
+    if (trace_event_get_state(TRACE_MHP_ACPI_WRITE_OST_EV)) {
+        uint64_t args[] = { (uint64_t)slot, (uint64_t)ev };
+        trace_ring_record(TRACE_MHP_ACPI_WRITE_OST_EV, args, 2, NULL);
+    }
 }
 
 static inline void trace_mhp_acpi_write_ost_status(uint32_t slot, uint32_t st)
 {
+    if (trace_event_get_state(TRACE_MHP_ACPI_WRITE_OST_STATUS)) {
+        uint64_t args[] = { (uint64_t)slot, (uint64_t)st };
+        trace_ring_record(TRACE_MHP_ACPI_WRITE_OST_STATUS, args, 2, NULL);
+    }
 }
 
 static inline void trace_mhp_acpi_clear_insert_evt(uint32_t slot)
 {
+    if (trace_event_get_state(TRACE_MHP_ACPI_CLEAR_INSERT_EVT)) {
+        uint64_t args[] = { (uint64_t)slot };
+        trace_ring_record(TRACE_MHP_ACPI_CLEAR_INSERT_EVT, args, 1, NULL);
+    }
 }
 
 static inline void trace_mhp_pc_dimm_assigned_slot(int slot)
 {
+    if (trace_event_get_state(TRACE_MHP_PC_DIMM_ASSIGNED_SLOT)) {
+        uint64_t args[] = { (uint64_t)slot };
+        trace_ring_record(TRACE_MHP_PC_DIMM_ASSIGNED_SLOT, args, 1, NULL);
+    }
 }
 
 static inline void trace_mhp_pc_dimm_assigned_address(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_MHP_PC_DIMM_ASSIGNED_ADDRESS)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_MHP_PC_DIMM_ASSIGNED_ADDRESS, args, 1, NULL);
+    }
 }
 
 static inline void trace_kvm_enable_cmma(int rc)
 {
+    if (trace_event_get_state(TRACE_KVM_ENABLE_CMMA)) {
+        uint64_t args[] = { (uint64_t)rc };
+        trace_ring_record(TRACE_KVM_ENABLE_CMMA, args, 1, NULL);
+    }
 }
 
 static inline void trace_kvm_clear_cmma(int rc)
 {
+    if (trace_event_get_state(TRACE_KVM_CLEAR_CMMA)) {
+        uint64_t args[] = { (uint64_t)rc };
+        trace_ring_record(TRACE_KVM_CLEAR_CMMA, args, 1, NULL);
+    }
 }
 
 static inline void trace_kvm_failed_cpu_state_set(int cpu_index, uint8_t state, const char * msg)
 {
+    if (trace_event_get_state(TRACE_KVM_FAILED_CPU_STATE_SET)) {
+        uint64_t args[] = { (uint64_t)cpu_index, (uint64_t)state, (uintptr_t)msg };
+        trace_ring_record(TRACE_KVM_FAILED_CPU_STATE_SET, args, 3, msg);
+    }
 }
 
 static inline void trace_kvm_sigp_finished(uint8_t order, int cpu_index, int dst_index, int cc)
 {
+    if (trace_event_get_state(TRACE_KVM_SIGP_FINISHED)) {
+        uint64_t args[] = { (uint64_t)order, (uint64_t)cpu_index, (uint64_t)dst_index, (uint64_t)cc };
+        trace_ring_record(TRACE_KVM_SIGP_FINISHED, args, 4, NULL);
+    }
 }
 
 static inline void trace_i8257_unregistered_dma(int nchan, int dma_pos, int dma_len)
 {
+    if (trace_event_get_state(TRACE_I8257_UNREGISTERED_DMA)) {
+        uint64_t args[] = { (uint64_t)nchan, (uint64_t)dma_pos, (uint64_t)dma_len };
+        trace_ring_record(TRACE_I8257_UNREGISTERED_DMA, args, 3, NULL);
+    }
 }
 
 static inline void trace_cpu_set_state(int cpu_index, uint8_t state)
 {
+    if (trace_event_get_state(TRACE_CPU_SET_STATE)) {
+        uint64_t args[] = { (uint64_t)cpu_index, (uint64_t)state };
+        trace_ring_record(TRACE_CPU_SET_STATE, args, 2, NULL);
+    }
 }
 
 static inline void trace_cpu_halt(int cpu_index)
 {
+    if (trace_event_get_state(TRACE_CPU_HALT)) {
+        uint64_t args[] = { (uint64_t)cpu_index };
+        trace_ring_record(TRACE_CPU_HALT, args, 1, NULL);
+    }
 }
 
 static inline void trace_cpu_unhalt(int cpu_index)
 {
+    if (trace_event_get_state(TRACE_CPU_UNHALT)) {
+        uint64_t args[] = { (uint64_t)cpu_index };
+        trace_ring_record(TRACE_CPU_UNHALT, args, 1, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_parsed(bool ip4, bool ip6, bool udp, bool tcp, size_t l3o, size_t l4o, size_t l5o)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_PARSED)) {
+        uint64_t args[] = { (uint64_t)ip4, (uint64_t)ip6, (uint64_t)udp, (uint64_t)tcp, (uint64_t)l3o, (uint64_t)l4o, (uint64_t)l5o };
+        trace_ring_record(TRACE_NET_RX_PKT_PARSED, args, 7, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_l4_csum_validate_entry(void)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_ENTRY)) {
+        trace_ring_record(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_ENTRY, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_l4_csum_validate_not_xxp(void)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_NOT_XXP)) {
+        trace_ring_record(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_NOT_XXP, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_l4_csum_validate_udp_with_no_checksum(void)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_UDP_WITH_NO_CHECKSUM)) {
+        trace_ring_record(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_UDP_WITH_NO_CHECKSUM, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_l4_csum_validate_ip4_fragment(void)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_IP4_FRAGMENT)) {
+        trace_ring_record(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_IP4_FRAGMENT, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_l4_csum_validate_ip4_udp(void)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_IP4_UDP)) {
+        trace_ring_record(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_IP4_UDP, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_l4_csum_validate_ip4_tcp(void)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_IP4_TCP)) {
+        trace_ring_record(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_IP4_TCP, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_l4_csum_validate_ip6_udp(void)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_IP6_UDP)) {
+        trace_ring_record(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_IP6_UDP, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_l4_csum_validate_ip6_tcp(void)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_IP6_TCP)) {
+        trace_ring_record(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_IP6_TCP, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_l4_csum_validate_ph_csum(uint32_t cntr, uint16_t csl)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_PH_CSUM)) {
+        uint64_t args[] = { (uint64_t)cntr, (uint64_t)csl };
+        trace_ring_record(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_PH_CSUM, args, 2, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_l4_csum_validate_csum(size_t l4hdr_off, uint16_t csl, uint32_t cntr, uint16_t csum, bool csum_valid)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_CSUM)) {
+        uint64_t args[] = { (uint64_t)l4hdr_off, (uint64_t)csl, (uint64_t)cntr, (uint64_t)csum, (uint64_t)csum_valid };
+        trace_ring_record(TRACE_NET_RX_PKT_L4_CSUM_VALIDATE_CSUM, args, 5, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_l3_csum_validate_entry(void)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_L3_CSUM_VALIDATE_ENTRY)) {
+        trace_ring_record(TRACE_NET_RX_PKT_L3_CSUM_VALIDATE_ENTRY, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_l3_csum_validate_not_ip4(void)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_L3_CSUM_VALIDATE_NOT_IP4)) {
+        trace_ring_record(TRACE_NET_RX_PKT_L3_CSUM_VALIDATE_NOT_IP4, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_l3_csum_validate_csum(size_t l3hdr_off, uint32_t csl, uint32_t cntr, uint16_t csum, bool csum_valid)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_L3_CSUM_VALIDATE_CSUM)) {
+        uint64_t args[] = { (uint64_t)l3hdr_off, (uint64_t)csl, (uint64_t)cntr, (uint64_t)csum, (uint64_t)csum_valid };
+        trace_ring_record(TRACE_NET_RX_PKT_L3_CSUM_VALIDATE_CSUM, args, 5, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_rss_ip4(void)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_RSS_IP4)) {
+        trace_ring_record(TRACE_NET_RX_PKT_RSS_IP4, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_rss_ip4_tcp(void)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_RSS_IP4_TCP)) {
+        trace_ring_record(TRACE_NET_RX_PKT_RSS_IP4_TCP, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_rss_ip6_tcp(void)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_RSS_IP6_TCP)) {
+        trace_ring_record(TRACE_NET_RX_PKT_RSS_IP6_TCP, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_rss_ip6(void)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_RSS_IP6)) {
+        trace_ring_record(TRACE_NET_RX_PKT_RSS_IP6, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_rss_ip6_ex(void)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_RSS_IP6_EX)) {
+        trace_ring_record(TRACE_NET_RX_PKT_RSS_IP6_EX, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_rss_hash(size_t rss_length, uint32_t rss_hash)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_RSS_HASH)) {
+        uint64_t args[] = { (uint64_t)rss_length, (uint64_t)rss_hash };
+        trace_ring_record(TRACE_NET_RX_PKT_RSS_HASH, args, 2, NULL);
+    }
 }
 
 static inline void trace_net_rx_pkt_rss_add_chunk(void* ptr, size_t size, size_t input_offset)
 {
+    if (trace_event_get_state(TRACE_NET_RX_PKT_RSS_ADD_CHUNK)) {
+        uint64_t args[] = { (uintptr_t)ptr, (uint64_t)size, (uint64_t)input_offset };
+        trace_ring_record(TRACE_NET_RX_PKT_RSS_ADD_CHUNK, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_core_write(uint64_t index, uint32_t size, uint64_t val)
 {
+    if (trace_event_get_state(TRACE_E1000E_CORE_WRITE)) {
+        uint64_t args[] = { (uint64_t)index, (uint64_t)size, (uint64_t)val };
+        trace_ring_record(TRACE_E1000E_CORE_WRITE, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_core_read(uint64_t index, uint32_t size, uint64_t val)
 {
+    if (trace_event_get_state(TRACE_E1000E_CORE_READ)) {
+        uint64_t args[] = { (uint64_t)index, (uint64_t)size, (uint64_t)val };
+        trace_ring_record(TRACE_E1000E_CORE_READ, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_core_mdic_read(uint8_t page, uint32_t addr, uint32_t data)
 {
+    if (trace_event_get_state(TRACE_E1000E_CORE_MDIC_READ)) {
+        uint64_t args[] = { (uint64_t)page, (uint64_t)addr, (uint64_t)data };
+        trace_ring_record(TRACE_E1000E_CORE_MDIC_READ, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_core_mdic_read_unhandled(uint8_t page, uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_E1000E_CORE_MDIC_READ_UNHANDLED)) {
+        uint64_t args[] = { (uint64_t)page, (uint64_t)addr };
+        trace_ring_record(TRACE_E1000E_CORE_MDIC_READ_UNHANDLED, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_core_mdic_write(uint8_t page, uint32_t addr, uint32_t data)
 {
+    if (trace_event_get_state(TRACE_E1000E_CORE_MDIC_WRITE)) {
+        uint64_t args[] = { (uint64_t)page, (uint64_t)addr, (uint64_t)data };
+        trace_ring_record(TRACE_E1000E_CORE_MDIC_WRITE, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_core_mdic_write_unhandled(uint8_t page, uint32_t addr)
 {
+    if (trace_event_get_state(TRACE_E1000E_CORE_MDIC_WRITE_UNHANDLED)) {
+        uint64_t args[] = { (uint64_t)page, (uint64_t)addr };
+        trace_ring_record(TRACE_E1000E_CORE_MDIC_WRITE_UNHANDLED, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_core_eeeprom_write(uint16_t bit_in, uint16_t bit_out, uint16_t reading)
 {
+    if (trace_event_get_state(TRACE_E1000E_CORE_EEEPROM_WRITE)) {
+        uint64_t args[] = { (uint64_t)bit_in, (uint64_t)bit_out, (uint64_t)reading };
+        trace_ring_record(TRACE_E1000E_CORE_EEEPROM_WRITE, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_core_ctrl_write(uint64_t index, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_E1000E_CORE_CTRL_WRITE)) {
+        uint64_t args[] = { (uint64_t)index, (uint64_t)val };
+        trace_ring_record(TRACE_E1000E_CORE_CTRL_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_core_ctrl_sw_reset(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_CORE_CTRL_SW_RESET)) {
+        trace_ring_record(TRACE_E1000E_CORE_CTRL_SW_RESET, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_core_ctrl_phy_reset(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_CORE_CTRL_PHY_RESET)) {
+        trace_ring_record(TRACE_E1000E_CORE_CTRL_PHY_RESET, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_link_negotiation_start(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_LINK_NEGOTIATION_START)) {
+        trace_ring_record(TRACE_E1000E_LINK_NEGOTIATION_START, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_link_negotiation_done(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_LINK_NEGOTIATION_DONE)) {
+        trace_ring_record(TRACE_E1000E_LINK_NEGOTIATION_DONE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_link_autoneg_flowctl(bool enabled)
 {
+    if (trace_event_get_state(TRACE_E1000E_LINK_AUTONEG_FLOWCTL)) {
+        uint64_t args[] = { (uint64_t)enabled };
+        trace_ring_record(TRACE_E1000E_LINK_AUTONEG_FLOWCTL, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_link_set_params(bool autodetect, uint32_t speed, bool force_spd, bool force_dplx, bool rx_fctl, bool tx_fctl)
 {
+    if (trace_event_get_state(TRACE_E1000E_LINK_SET_PARAMS)) {
+        uint64_t args[] = { (uint64_t)autodetect, (uint64_t)speed, (uint64_t)force_spd, (uint64_t)force_dplx, (uint64_t)rx_fctl, (uint64_t)tx_fctl };
+        trace_ring_record(TRACE_E1000E_LINK_SET_PARAMS, args, 6, NULL);
+    }
 }
 
 static inline void trace_e1000e_link_read_params(bool autodetect, uint32_t speed, bool force_spd, bool force_dplx, bool rx_fctl, bool tx_fctl)
 {
+    if (trace_event_get_state(TRACE_E1000E_LINK_READ_PARAMS)) {
+        uint64_t args[] = { (uint64_t)autodetect, (uint64_t)speed, (uint64_t)force_spd, (uint64_t)force_dplx, (uint64_t)rx_fctl, (uint64_t)tx_fctl };
+        trace_ring_record(TRACE_E1000E_LINK_READ_PARAMS, args, 6, NULL);
+    }
 }
 
 static inline void trace_e1000e_link_set_ext_params(bool asd_check, bool speed_select_bypass)
 {
+    if (trace_event_get_state(TRACE_E1000E_LINK_SET_EXT_PARAMS)) {
+        uint64_t args[] = { (uint64_t)asd_check, (uint64_t)speed_select_bypass };
+        trace_ring_record(TRACE_E1000E_LINK_SET_EXT_PARAMS, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_link_status(bool link_up, bool full_dplx, uint32_t speed, uint32_t asdv)
 {
+    if (trace_event_get_state(TRACE_E1000E_LINK_STATUS)) {
+        uint64_t args[] = { (uint64_t)link_up, (uint64_t)full_dplx, (uint64_t)speed, (uint64_t)asdv };
+        trace_ring_record(TRACE_E1000E_LINK_STATUS, args, 4, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_regs_write_ro(uint64_t index, uint32_t size, uint64_t val)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_REGS_WRITE_RO)) {
+        uint64_t args[] = { (uint64_t)index, (uint64_t)size, (uint64_t)val };
+        trace_ring_record(TRACE_E1000E_WRN_REGS_WRITE_RO, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_regs_write_unknown(uint64_t index, uint32_t size, uint64_t val)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_REGS_WRITE_UNKNOWN)) {
+        uint64_t args[] = { (uint64_t)index, (uint64_t)size, (uint64_t)val };
+        trace_ring_record(TRACE_E1000E_WRN_REGS_WRITE_UNKNOWN, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_regs_read_unknown(uint64_t index, uint32_t size)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_REGS_READ_UNKNOWN)) {
+        uint64_t args[] = { (uint64_t)index, (uint64_t)size };
+        trace_ring_record(TRACE_E1000E_WRN_REGS_READ_UNKNOWN, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_regs_read_trivial(uint32_t index)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_REGS_READ_TRIVIAL)) {
+        uint64_t args[] = { (uint64_t)index };
+        trace_ring_record(TRACE_E1000E_WRN_REGS_READ_TRIVIAL, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_regs_write_trivial(uint32_t index)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_REGS_WRITE_TRIVIAL)) {
+        uint64_t args[] = { (uint64_t)index };
+        trace_ring_record(TRACE_E1000E_WRN_REGS_WRITE_TRIVIAL, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_no_ts_support(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_NO_TS_SUPPORT)) {
+        trace_ring_record(TRACE_E1000E_WRN_NO_TS_SUPPORT, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_no_snap_support(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_NO_SNAP_SUPPORT)) {
+        trace_ring_record(TRACE_E1000E_WRN_NO_SNAP_SUPPORT, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_iscsi_filtering_not_supported(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_ISCSI_FILTERING_NOT_SUPPORTED)) {
+        trace_ring_record(TRACE_E1000E_WRN_ISCSI_FILTERING_NOT_SUPPORTED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_nfsw_filtering_not_supported(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_NFSW_FILTERING_NOT_SUPPORTED)) {
+        trace_ring_record(TRACE_E1000E_WRN_NFSW_FILTERING_NOT_SUPPORTED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_nfsr_filtering_not_supported(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_NFSR_FILTERING_NOT_SUPPORTED)) {
+        trace_ring_record(TRACE_E1000E_WRN_NFSR_FILTERING_NOT_SUPPORTED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_tx_disabled(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_TX_DISABLED)) {
+        trace_ring_record(TRACE_E1000E_TX_DISABLED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_tx_descr(void * addr, uint32_t lower, uint32_t upper)
 {
+    if (trace_event_get_state(TRACE_E1000E_TX_DESCR)) {
+        uint64_t args[] = { (uintptr_t)addr, (uint64_t)lower, (uint64_t)upper };
+        trace_ring_record(TRACE_E1000E_TX_DESCR, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_tx_cso_zero(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_TX_CSO_ZERO)) {
+        trace_ring_record(TRACE_E1000E_TX_CSO_ZERO, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_ring_free_space(int ridx, uint32_t rdlen, uint32_t rdh, uint32_t rdt)
 {
+    if (trace_event_get_state(TRACE_E1000E_RING_FREE_SPACE)) {
+        uint64_t args[] = { (uint64_t)ridx, (uint64_t)rdlen, (uint64_t)rdh, (uint64_t)rdt };
+        trace_ring_record(TRACE_E1000E_RING_FREE_SPACE, args, 4, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_can_recv_disabled(bool link_up, bool rx_enabled, bool pci_master)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_CAN_RECV_DISABLED)) {
+        uint64_t args[] = { (uint64_t)link_up, (uint64_t)rx_enabled, (uint64_t)pci_master };
+        trace_ring_record(TRACE_E1000E_RX_CAN_RECV_DISABLED, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_can_recv_rings_full(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_CAN_RECV_RINGS_FULL)) {
+        trace_ring_record(TRACE_E1000E_RX_CAN_RECV_RINGS_FULL, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_can_recv(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_CAN_RECV)) {
+        trace_ring_record(TRACE_E1000E_RX_CAN_RECV, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_has_buffers(int ridx, uint32_t free_desc, size_t total_size, uint32_t desc_buf_size)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_HAS_BUFFERS)) {
+        uint64_t args[] = { (uint64_t)ridx, (uint64_t)free_desc, (uint64_t)total_size, (uint64_t)desc_buf_size };
+        trace_ring_record(TRACE_E1000E_RX_HAS_BUFFERS, args, 4, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_null_descriptor(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_NULL_DESCRIPTOR)) {
+        trace_ring_record(TRACE_E1000E_RX_NULL_DESCRIPTOR, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_flt_ucast_match(uint32_t idx, uint8_t b0, uint8_t b1, uint8_t b2, uint8_t b3, uint8_t b4, uint8_t b5)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_FLT_UCAST_MATCH)) {
+        uint64_t args[] = { (uint64_t)idx, (uint64_t)b0, (uint64_t)b1, (uint64_t)b2, (uint64_t)b3, (uint64_t)b4, (uint64_t)b5 };
+        trace_ring_record(TRACE_E1000E_RX_FLT_UCAST_MATCH, args, 7, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_flt_ucast_mismatch(uint8_t b0, uint8_t b1, uint8_t b2, uint8_t b3, uint8_t b4, uint8_t b5)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_FLT_UCAST_MISMATCH)) {
+        uint64_t args[] = { (uint64_t)b0, (uint64_t)b1, (uint64_t)b2, (uint64_t)b3, (uint64_t)b4, (uint64_t)b5 };
+        trace_ring_record(TRACE_E1000E_RX_FLT_UCAST_MISMATCH, args, 6, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_flt_inexact_mismatch(uint8_t b0, uint8_t b1, uint8_t b2, uint8_t b3, uint8_t b4, uint8_t b5, uint32_t mo, uint32_t mta, uint32_t mta_val)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_FLT_INEXACT_MISMATCH)) {
+        uint64_t args[] = { (uint64_t)b0, (uint64_t)b1, (uint64_t)b2, (uint64_t)b3, (uint64_t)b4, (uint64_t)b5, (uint64_t)mo, (uint64_t)mta, (uint64_t)mta_val };
+        trace_ring_record(TRACE_E1000E_RX_FLT_INEXACT_MISMATCH, args, 9, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_flt_vlan_mismatch(uint16_t vid)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_FLT_VLAN_MISMATCH)) {
+        uint64_t args[] = { (uint64_t)vid };
+        trace_ring_record(TRACE_E1000E_RX_FLT_VLAN_MISMATCH, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_flt_vlan_match(uint16_t vid)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_FLT_VLAN_MATCH)) {
+        uint64_t args[] = { (uint64_t)vid };
+        trace_ring_record(TRACE_E1000E_RX_FLT_VLAN_MATCH, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_desc_ps_read(uint64_t a0, uint64_t a1, uint64_t a2, uint64_t a3)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_DESC_PS_READ)) {
+        uint64_t args[] = { (uint64_t)a0, (uint64_t)a1, (uint64_t)a2, (uint64_t)a3 };
+        trace_ring_record(TRACE_E1000E_RX_DESC_PS_READ, args, 4, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_desc_ps_write(uint16_t a0, uint16_t a1, uint16_t a2, uint16_t a3)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_DESC_PS_WRITE)) {
+        uint64_t args[] = { (uint64_t)a0, (uint64_t)a1, (uint64_t)a2, (uint64_t)a3 };
+        trace_ring_record(TRACE_E1000E_RX_DESC_PS_WRITE, args, 4, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_desc_buff_sizes(uint32_t b0, uint32_t b1, uint32_t b2, uint32_t b3)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_DESC_BUFF_SIZES)) {
+        uint64_t args[] = { (uint64_t)b0, (uint64_t)b1, (uint64_t)b2, (uint64_t)b3 };
+        trace_ring_record(TRACE_E1000E_RX_DESC_BUFF_SIZES, args, 4, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_desc_len(uint8_t rx_desc_len)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_DESC_LEN)) {
+        uint64_t args[] = { (uint64_t)rx_desc_len };
+        trace_ring_record(TRACE_E1000E_RX_DESC_LEN, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_desc_buff_write(uint8_t idx, uint64_t addr, uint16_t offset, const void* source, uint32_t len)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_DESC_BUFF_WRITE)) {
+        uint64_t args[] = { (uint64_t)idx, (uint64_t)addr, (uint64_t)offset, (uintptr_t)source, (uint64_t)len };
+        trace_ring_record(TRACE_E1000E_RX_DESC_BUFF_WRITE, args, 5, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_descr(int ridx, uint64_t base, uint8_t len)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_DESCR)) {
+        uint64_t args[] = { (uint64_t)ridx, (uint64_t)base, (uint64_t)len };
+        trace_ring_record(TRACE_E1000E_RX_DESCR, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_set_rctl(uint32_t rctl)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_SET_RCTL)) {
+        uint64_t args[] = { (uint64_t)rctl };
+        trace_ring_record(TRACE_E1000E_RX_SET_RCTL, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_receive_iov(int iovcnt)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_RECEIVE_IOV)) {
+        uint64_t args[] = { (uint64_t)iovcnt };
+        trace_ring_record(TRACE_E1000E_RX_RECEIVE_IOV, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_packet_size(size_t full, size_t vhdr, size_t data)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_PACKET_SIZE)) {
+        uint64_t args[] = { (uint64_t)full, (uint64_t)vhdr, (uint64_t)data };
+        trace_ring_record(TRACE_E1000E_RX_PACKET_SIZE, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_link_down(uint32_t status_reg)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_LINK_DOWN)) {
+        uint64_t args[] = { (uint64_t)status_reg };
+        trace_ring_record(TRACE_E1000E_RX_LINK_DOWN, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_disabled(uint32_t rctl_reg)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_DISABLED)) {
+        uint64_t args[] = { (uint64_t)rctl_reg };
+        trace_ring_record(TRACE_E1000E_RX_DISABLED, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_oversized(size_t size)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_OVERSIZED)) {
+        uint64_t args[] = { (uint64_t)size };
+        trace_ring_record(TRACE_E1000E_RX_OVERSIZED, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_flt_dropped(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_FLT_DROPPED)) {
+        trace_ring_record(TRACE_E1000E_RX_FLT_DROPPED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_written_to_guest(uint32_t causes)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_WRITTEN_TO_GUEST)) {
+        uint64_t args[] = { (uint64_t)causes };
+        trace_ring_record(TRACE_E1000E_RX_WRITTEN_TO_GUEST, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_not_written_to_guest(uint32_t causes)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_NOT_WRITTEN_TO_GUEST)) {
+        uint64_t args[] = { (uint64_t)causes };
+        trace_ring_record(TRACE_E1000E_RX_NOT_WRITTEN_TO_GUEST, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_interrupt_set(uint32_t causes)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_INTERRUPT_SET)) {
+        uint64_t args[] = { (uint64_t)causes };
+        trace_ring_record(TRACE_E1000E_RX_INTERRUPT_SET, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_interrupt_delayed(uint32_t causes)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_INTERRUPT_DELAYED)) {
+        uint64_t args[] = { (uint64_t)causes };
+        trace_ring_record(TRACE_E1000E_RX_INTERRUPT_DELAYED, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_set_cso(int cso_state)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_SET_CSO)) {
+        uint64_t args[] = { (uint64_t)cso_state };
+        trace_ring_record(TRACE_E1000E_RX_SET_CSO, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_set_rdt(int queue_idx, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_SET_RDT)) {
+        uint64_t args[] = { (uint64_t)queue_idx, (uint64_t)val };
+        trace_ring_record(TRACE_E1000E_RX_SET_RDT, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_set_rfctl(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_SET_RFCTL)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_E1000E_RX_SET_RFCTL, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_start_recv(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_START_RECV)) {
+        trace_ring_record(TRACE_E1000E_RX_START_RECV, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_rss_started(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_RSS_STARTED)) {
+        trace_ring_record(TRACE_E1000E_RX_RSS_STARTED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_rss_disabled(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_RSS_DISABLED)) {
+        trace_ring_record(TRACE_E1000E_RX_RSS_DISABLED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_rss_type(uint32_t type)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_RSS_TYPE)) {
+        uint64_t args[] = { (uint64_t)type };
+        trace_ring_record(TRACE_E1000E_RX_RSS_TYPE, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_rss_ip4(bool isfragment, bool istcp, uint32_t mrqc, bool tcpipv4_enabled, bool ipv4_enabled)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_RSS_IP4)) {
+        uint64_t args[] = { (uint64_t)isfragment, (uint64_t)istcp, (uint64_t)mrqc, (uint64_t)tcpipv4_enabled, (uint64_t)ipv4_enabled };
+        trace_ring_record(TRACE_E1000E_RX_RSS_IP4, args, 5, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_rss_ip6(uint32_t rfctl, bool ex_dis, bool new_ex_dis, bool istcp, bool has_ext_headers, bool ex_dst_valid, bool ex_src_valid, uint32_t mrqc, bool tcpipv6_enabled, bool ipv6ex_enabled, bool ipv6_enabled)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_RSS_IP6)) {
+        uint64_t args[] = { (uint64_t)rfctl, (uint64_t)ex_dis, (uint64_t)new_ex_dis, (uint64_t)istcp, (uint64_t)has_ext_headers, (uint64_t)ex_dst_valid, (uint64_t)ex_src_valid, (uint64_t)mrqc, (uint64_t)tcpipv6_enabled, (uint64_t)ipv6ex_enabled, (uint64_t)ipv6_enabled };
+        trace_ring_record(TRACE_E1000E_RX_RSS_IP6, args, 11, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_rss_dispatched_to_queue(int queue_idx)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_RSS_DISPATCHED_TO_QUEUE)) {
+        uint64_t args[] = { (uint64_t)queue_idx };
+        trace_ring_record(TRACE_E1000E_RX_RSS_DISPATCHED_TO_QUEUE, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_metadata_protocols(bool isip4, bool isip6, bool isudp, bool istcp)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_METADATA_PROTOCOLS)) {
+        uint64_t args[] = { (uint64_t)isip4, (uint64_t)isip6, (uint64_t)isudp, (uint64_t)istcp };
+        trace_ring_record(TRACE_E1000E_RX_METADATA_PROTOCOLS, args, 4, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_metadata_vlan(uint16_t vlan_tag)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_METADATA_VLAN)) {
+        uint64_t args[] = { (uint64_t)vlan_tag };
+        trace_ring_record(TRACE_E1000E_RX_METADATA_VLAN, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_metadata_rss(uint32_t rss, uint32_t mrq)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_METADATA_RSS)) {
+        uint64_t args[] = { (uint64_t)rss, (uint64_t)mrq };
+        trace_ring_record(TRACE_E1000E_RX_METADATA_RSS, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_metadata_ip_id(uint16_t ip_id)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_METADATA_IP_ID)) {
+        uint64_t args[] = { (uint64_t)ip_id };
+        trace_ring_record(TRACE_E1000E_RX_METADATA_IP_ID, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_metadata_ack(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_METADATA_ACK)) {
+        trace_ring_record(TRACE_E1000E_RX_METADATA_ACK, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_metadata_pkt_type(uint32_t pkt_type)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_METADATA_PKT_TYPE)) {
+        uint64_t args[] = { (uint64_t)pkt_type };
+        trace_ring_record(TRACE_E1000E_RX_METADATA_PKT_TYPE, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_metadata_no_virthdr(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_METADATA_NO_VIRTHDR)) {
+        trace_ring_record(TRACE_E1000E_RX_METADATA_NO_VIRTHDR, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_metadata_virthdr_no_csum_info(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_METADATA_VIRTHDR_NO_CSUM_INFO)) {
+        trace_ring_record(TRACE_E1000E_RX_METADATA_VIRTHDR_NO_CSUM_INFO, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_metadata_l3_cso_disabled(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_METADATA_L3_CSO_DISABLED)) {
+        trace_ring_record(TRACE_E1000E_RX_METADATA_L3_CSO_DISABLED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_metadata_l4_cso_disabled(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_METADATA_L4_CSO_DISABLED)) {
+        trace_ring_record(TRACE_E1000E_RX_METADATA_L4_CSO_DISABLED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_metadata_l3_csum_validation_failed(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_METADATA_L3_CSUM_VALIDATION_FAILED)) {
+        trace_ring_record(TRACE_E1000E_RX_METADATA_L3_CSUM_VALIDATION_FAILED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_metadata_l4_csum_validation_failed(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_METADATA_L4_CSUM_VALIDATION_FAILED)) {
+        trace_ring_record(TRACE_E1000E_RX_METADATA_L4_CSUM_VALIDATION_FAILED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_metadata_status_flags(uint32_t status_flags)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_METADATA_STATUS_FLAGS)) {
+        uint64_t args[] = { (uint64_t)status_flags };
+        trace_ring_record(TRACE_E1000E_RX_METADATA_STATUS_FLAGS, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_metadata_ipv6_sum_disabled(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_METADATA_IPV6_SUM_DISABLED)) {
+        trace_ring_record(TRACE_E1000E_RX_METADATA_IPV6_SUM_DISABLED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_rx_metadata_ipv6_filtering_disabled(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_RX_METADATA_IPV6_FILTERING_DISABLED)) {
+        trace_ring_record(TRACE_E1000E_RX_METADATA_IPV6_FILTERING_DISABLED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_vlan_vet(uint16_t vet)
 {
+    if (trace_event_get_state(TRACE_E1000E_VLAN_VET)) {
+        uint64_t args[] = { (uint64_t)vet };
+        trace_ring_record(TRACE_E1000E_VLAN_VET, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_vlan_is_vlan_pkt(bool is_vlan_pkt, uint16_t eth_proto, uint16_t vet)
 {
+    if (trace_event_get_state(TRACE_E1000E_VLAN_IS_VLAN_PKT)) {
+        uint64_t args[] = { (uint64_t)is_vlan_pkt, (uint64_t)eth_proto, (uint64_t)vet };
+        trace_ring_record(TRACE_E1000E_VLAN_IS_VLAN_PKT, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_set_cause(uint32_t cause)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_SET_CAUSE)) {
+        uint64_t args[] = { (uint64_t)cause };
+        trace_ring_record(TRACE_E1000E_IRQ_SET_CAUSE, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_msi_notify(uint32_t cause)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_MSI_NOTIFY)) {
+        uint64_t args[] = { (uint64_t)cause };
+        trace_ring_record(TRACE_E1000E_IRQ_MSI_NOTIFY, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_throttling_no_pending_interrupts(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_THROTTLING_NO_PENDING_INTERRUPTS)) {
+        trace_ring_record(TRACE_E1000E_IRQ_THROTTLING_NO_PENDING_INTERRUPTS, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_msi_notify_postponed(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_MSI_NOTIFY_POSTPONED)) {
+        trace_ring_record(TRACE_E1000E_IRQ_MSI_NOTIFY_POSTPONED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_legacy_notify_postponed(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_LEGACY_NOTIFY_POSTPONED)) {
+        trace_ring_record(TRACE_E1000E_IRQ_LEGACY_NOTIFY_POSTPONED, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_throttling_no_pending_vec(int idx)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_THROTTLING_NO_PENDING_VEC)) {
+        uint64_t args[] = { (uint64_t)idx };
+        trace_ring_record(TRACE_E1000E_IRQ_THROTTLING_NO_PENDING_VEC, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_msix_notify_postponed_vec(int idx)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_MSIX_NOTIFY_POSTPONED_VEC)) {
+        uint64_t args[] = { (uint64_t)idx };
+        trace_ring_record(TRACE_E1000E_IRQ_MSIX_NOTIFY_POSTPONED_VEC, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_msix_notify(uint32_t cause)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_MSIX_NOTIFY)) {
+        uint64_t args[] = { (uint64_t)cause };
+        trace_ring_record(TRACE_E1000E_IRQ_MSIX_NOTIFY, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_legacy_notify(bool level)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_LEGACY_NOTIFY)) {
+        uint64_t args[] = { (uint64_t)level };
+        trace_ring_record(TRACE_E1000E_IRQ_LEGACY_NOTIFY, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_msix_notify_vec(uint32_t vector)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_MSIX_NOTIFY_VEC)) {
+        uint64_t args[] = { (uint64_t)vector };
+        trace_ring_record(TRACE_E1000E_IRQ_MSIX_NOTIFY_VEC, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_postponed_by_xitr(uint32_t reg)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_POSTPONED_BY_XITR)) {
+        uint64_t args[] = { (uint64_t)reg };
+        trace_ring_record(TRACE_E1000E_IRQ_POSTPONED_BY_XITR, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_clear_ims(uint32_t bits, uint32_t old_ims, uint32_t new_ims)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_CLEAR_IMS)) {
+        uint64_t args[] = { (uint64_t)bits, (uint64_t)old_ims, (uint64_t)new_ims };
+        trace_ring_record(TRACE_E1000E_IRQ_CLEAR_IMS, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_set_ims(uint32_t bits, uint32_t old_ims, uint32_t new_ims)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_SET_IMS)) {
+        uint64_t args[] = { (uint64_t)bits, (uint64_t)old_ims, (uint64_t)new_ims };
+        trace_ring_record(TRACE_E1000E_IRQ_SET_IMS, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_fix_icr_asserted(uint32_t new_val)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_FIX_ICR_ASSERTED)) {
+        uint64_t args[] = { (uint64_t)new_val };
+        trace_ring_record(TRACE_E1000E_IRQ_FIX_ICR_ASSERTED, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_add_msi_other(uint32_t new_val)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_ADD_MSI_OTHER)) {
+        uint64_t args[] = { (uint64_t)new_val };
+        trace_ring_record(TRACE_E1000E_IRQ_ADD_MSI_OTHER, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_pending_interrupts(uint32_t pending, uint32_t icr, uint32_t ims)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_PENDING_INTERRUPTS)) {
+        uint64_t args[] = { (uint64_t)pending, (uint64_t)icr, (uint64_t)ims };
+        trace_ring_record(TRACE_E1000E_IRQ_PENDING_INTERRUPTS, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_set_cause_entry(uint32_t val, uint32_t icr)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_SET_CAUSE_ENTRY)) {
+        uint64_t args[] = { (uint64_t)val, (uint64_t)icr };
+        trace_ring_record(TRACE_E1000E_IRQ_SET_CAUSE_ENTRY, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_set_cause_exit(uint32_t val, uint32_t icr)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_SET_CAUSE_EXIT)) {
+        uint64_t args[] = { (uint64_t)val, (uint64_t)icr };
+        trace_ring_record(TRACE_E1000E_IRQ_SET_CAUSE_EXIT, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_icr_write(uint32_t bits, uint32_t old_icr, uint32_t new_icr)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_ICR_WRITE)) {
+        uint64_t args[] = { (uint64_t)bits, (uint64_t)old_icr, (uint64_t)new_icr };
+        trace_ring_record(TRACE_E1000E_IRQ_ICR_WRITE, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_write_ics(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_WRITE_ICS)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_E1000E_IRQ_WRITE_ICS, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_icr_process_iame(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_ICR_PROCESS_IAME)) {
+        trace_ring_record(TRACE_E1000E_IRQ_ICR_PROCESS_IAME, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_read_ics(uint32_t ics)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_READ_ICS)) {
+        uint64_t args[] = { (uint64_t)ics };
+        trace_ring_record(TRACE_E1000E_IRQ_READ_ICS, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_read_ims(uint32_t ims)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_READ_IMS)) {
+        uint64_t args[] = { (uint64_t)ims };
+        trace_ring_record(TRACE_E1000E_IRQ_READ_IMS, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_icr_read_entry(uint32_t icr)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_ICR_READ_ENTRY)) {
+        uint64_t args[] = { (uint64_t)icr };
+        trace_ring_record(TRACE_E1000E_IRQ_ICR_READ_ENTRY, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_icr_read_exit(uint32_t icr)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_ICR_READ_EXIT)) {
+        uint64_t args[] = { (uint64_t)icr };
+        trace_ring_record(TRACE_E1000E_IRQ_ICR_READ_EXIT, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_icr_clear_zero_ims(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_ICR_CLEAR_ZERO_IMS)) {
+        trace_ring_record(TRACE_E1000E_IRQ_ICR_CLEAR_ZERO_IMS, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_icr_clear_iame(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_ICR_CLEAR_IAME)) {
+        trace_ring_record(TRACE_E1000E_IRQ_ICR_CLEAR_IAME, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_ims_clear_eiame(uint32_t iam, uint32_t cause)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_IMS_CLEAR_EIAME)) {
+        uint64_t args[] = { (uint64_t)iam, (uint64_t)cause };
+        trace_ring_record(TRACE_E1000E_IRQ_IMS_CLEAR_EIAME, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_ims_clear_set_imc(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_IMS_CLEAR_SET_IMC)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_E1000E_IRQ_IMS_CLEAR_SET_IMC, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_fire_delayed_interrupts(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_FIRE_DELAYED_INTERRUPTS)) {
+        trace_ring_record(TRACE_E1000E_IRQ_FIRE_DELAYED_INTERRUPTS, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_rearm_timer(uint32_t reg, int64_t delay_ns)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_REARM_TIMER)) {
+        uint64_t args[] = { (uint64_t)reg, (uint64_t)delay_ns };
+        trace_ring_record(TRACE_E1000E_IRQ_REARM_TIMER, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_throttling_timer(uint32_t reg)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_THROTTLING_TIMER)) {
+        uint64_t args[] = { (uint64_t)reg };
+        trace_ring_record(TRACE_E1000E_IRQ_THROTTLING_TIMER, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_rdtr_fpd_running(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_RDTR_FPD_RUNNING)) {
+        trace_ring_record(TRACE_E1000E_IRQ_RDTR_FPD_RUNNING, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_rdtr_fpd_not_running(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_RDTR_FPD_NOT_RUNNING)) {
+        trace_ring_record(TRACE_E1000E_IRQ_RDTR_FPD_NOT_RUNNING, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_tidv_fpd_running(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_TIDV_FPD_RUNNING)) {
+        trace_ring_record(TRACE_E1000E_IRQ_TIDV_FPD_RUNNING, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_tidv_fpd_not_running(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_TIDV_FPD_NOT_RUNNING)) {
+        trace_ring_record(TRACE_E1000E_IRQ_TIDV_FPD_NOT_RUNNING, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_eitr_set(uint32_t eitr_num, uint32_t val)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_EITR_SET)) {
+        uint64_t args[] = { (uint64_t)eitr_num, (uint64_t)val };
+        trace_ring_record(TRACE_E1000E_IRQ_EITR_SET, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_itr_set(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_ITR_SET)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_E1000E_IRQ_ITR_SET, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_fire_all_timers(uint32_t val)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_FIRE_ALL_TIMERS)) {
+        uint64_t args[] = { (uint64_t)val };
+        trace_ring_record(TRACE_E1000E_IRQ_FIRE_ALL_TIMERS, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_adding_delayed_causes(uint32_t val, uint32_t icr)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_ADDING_DELAYED_CAUSES)) {
+        uint64_t args[] = { (uint64_t)val, (uint64_t)icr };
+        trace_ring_record(TRACE_E1000E_IRQ_ADDING_DELAYED_CAUSES, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_irq_msix_pending_clearing(uint32_t cause, uint32_t int_cfg, uint32_t vec)
 {
+    if (trace_event_get_state(TRACE_E1000E_IRQ_MSIX_PENDING_CLEARING)) {
+        uint64_t args[] = { (uint64_t)cause, (uint64_t)int_cfg, (uint64_t)vec };
+        trace_ring_record(TRACE_E1000E_IRQ_MSIX_PENDING_CLEARING, args, 3, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_msix_vec_wrong(uint32_t cause, uint32_t cfg)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_MSIX_VEC_WRONG)) {
+        uint64_t args[] = { (uint64_t)cause, (uint64_t)cfg };
+        trace_ring_record(TRACE_E1000E_WRN_MSIX_VEC_WRONG, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_msix_invalid(uint32_t cause, uint32_t cfg)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_MSIX_INVALID)) {
+        uint64_t args[] = { (uint64_t)cause, (uint64_t)cfg };
+        trace_ring_record(TRACE_E1000E_WRN_MSIX_INVALID, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_mac_set_permanent(uint8_t b0, uint8_t b1, uint8_t b2, uint8_t b3, uint8_t b4, uint8_t b5)
 {
+    if (trace_event_get_state(TRACE_E1000E_MAC_SET_PERMANENT)) {
+        uint64_t args[] = { (uint64_t)b0, (uint64_t)b1, (uint64_t)b2, (uint64_t)b3, (uint64_t)b4, (uint64_t)b5 };
+        trace_ring_record(TRACE_E1000E_MAC_SET_PERMANENT, args, 6, NULL);
+    }
 }
 
 static inline void trace_e1000e_mac_set_sw(uint8_t b0, uint8_t b1, uint8_t b2, uint8_t b3, uint8_t b4, uint8_t b5)
 {
+    if (trace_event_get_state(TRACE_E1000E_MAC_SET_SW)) {
+        uint64_t args[] = { (uint64_t)b0, (uint64_t)b1, (uint64_t)b2, (uint64_t)b3, (uint64_t)b4, (uint64_t)b5 };
+        trace_ring_record(TRACE_E1000E_MAC_SET_SW, args, 6, NULL);
+    }
 }
 
 static inline void trace_e1000e_mac_indicate(uint8_t b0, uint8_t b1, uint8_t b2, uint8_t b3, uint8_t b4, uint8_t b5)
 {
+    if (trace_event_get_state(TRACE_E1000E_MAC_INDICATE)) {
+        uint64_t args[] = { (uint64_t)b0, (uint64_t)b1, (uint64_t)b2, (uint64_t)b3, (uint64_t)b4, (uint64_t)b5 };
+        trace_ring_record(TRACE_E1000E_MAC_INDICATE, args, 6, NULL);
+    }
 }
 
 static inline void trace_e1000e_cb_pci_realize(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_CB_PCI_REALIZE)) {
+        trace_ring_record(TRACE_E1000E_CB_PCI_REALIZE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_cb_pci_uninit(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_CB_PCI_UNINIT)) {
+        trace_ring_record(TRACE_E1000E_CB_PCI_UNINIT, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_cb_qdev_reset(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_CB_QDEV_RESET)) {
+        trace_ring_record(TRACE_E1000E_CB_QDEV_RESET, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_cb_pre_save(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_CB_PRE_SAVE)) {
+        trace_ring_record(TRACE_E1000E_CB_PRE_SAVE, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_cb_post_load(void)
 {
+    if (trace_event_get_state(TRACE_E1000E_CB_POST_LOAD)) {
+        trace_ring_record(TRACE_E1000E_CB_POST_LOAD, NULL, 0, NULL);
+    }
 }
 
 static inline void trace_e1000e_io_write_addr(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_E1000E_IO_WRITE_ADDR)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_E1000E_IO_WRITE_ADDR, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_io_write_data(uint64_t addr, uint64_t val)
 {
+    if (trace_event_get_state(TRACE_E1000E_IO_WRITE_DATA)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_E1000E_IO_WRITE_DATA, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_io_read_addr(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_E1000E_IO_READ_ADDR)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_E1000E_IO_READ_ADDR, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_io_read_data(uint64_t addr, uint64_t val)
 {
+    if (trace_event_get_state(TRACE_E1000E_IO_READ_DATA)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_E1000E_IO_READ_DATA, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_io_write_unknown(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_IO_WRITE_UNKNOWN)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_E1000E_WRN_IO_WRITE_UNKNOWN, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_io_read_unknown(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_IO_READ_UNKNOWN)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_E1000E_WRN_IO_READ_UNKNOWN, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_io_addr_undefined(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_IO_ADDR_UNDEFINED)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_E1000E_WRN_IO_ADDR_UNDEFINED, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_io_addr_flash(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_IO_ADDR_FLASH)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_E1000E_WRN_IO_ADDR_FLASH, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_io_addr_unknown(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_IO_ADDR_UNKNOWN)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_E1000E_WRN_IO_ADDR_UNKNOWN, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_flash_read(uint64_t addr)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_FLASH_READ)) {
+        uint64_t args[] = { (uint64_t)addr };
+        trace_ring_record(TRACE_E1000E_WRN_FLASH_READ, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_wrn_flash_write(uint64_t addr, uint64_t val)
 {
+    if (trace_event_get_state(TRACE_E1000E_WRN_FLASH_WRITE)) {
+        uint64_t args[] = { (uint64_t)addr, (uint64_t)val };
+        trace_ring_record(TRACE_E1000E_WRN_FLASH_WRITE, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_msi_init_fail(int32_t res)
 {
+    if (trace_event_get_state(TRACE_E1000E_MSI_INIT_FAIL)) {
+        uint64_t args[] = { (uint64_t)res };
+        trace_ring_record(TRACE_E1000E_MSI_INIT_FAIL, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_msix_init_fail(int32_t res)
 {
+    if (trace_event_get_state(TRACE_E1000E_MSIX_INIT_FAIL)) {
+        uint64_t args[] = { (uint64_t)res };
+        trace_ring_record(TRACE_E1000E_MSIX_INIT_FAIL, args, 1, NULL);
+    }
 }
 
 static inline void trace_e1000e_msix_use_vector_fail(uint32_t vec, int32_t res)
 {
+    if (trace_event_get_state(TRACE_E1000E_MSIX_USE_VECTOR_FAIL)) {
+        uint64_t args[] = { (uint64_t)vec, (uint64_t)res };
+        trace_ring_record(TRACE_E1000E_MSIX_USE_VECTOR_FAIL, args, 2, NULL);
+    }
 }
 
 static inline void trace_e1000e_cfg_support_virtio(bool support)
 {
+    if (trace_event_get_state(TRACE_E1000E_CFG_SUPPORT_VIRTIO)) {
+        uint64_t args[] = { (uint64_t)support };
+        trace_ring_record(TRACE_E1000E_CFG_SUPPORT_VIRTIO, args, 1, NULL);
+    }
 }
+
 #endif /* TRACE__GENERATED_TRACERS_H */
@@ -0,0 +1,154 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+#include "trace/ring.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "thread_ring.h"
+#include "trace/control.h"
+
+#define TRACE_RING_MASK (TRACE_RING_RECORDS - 1)
+
+static __thread struct thread_ring *thread_ring;
+static struct thread_ring_list all_rings =
+    THREAD_RING_LIST_INITIALIZER(TraceRingRecord, TRACE_RING_RECORDS);
+
+static pthread_mutex_t drain_lock = PTHREAD_MUTEX_INITIALIZER;
+static FILE *trace_file;
+
+void trace_ring_record(TraceEventID event, const uint64_t *args,
+                       int arg_count, const char *text)
+{
+    struct thread_ring *ring = thread_ring;
+    TraceRingRecord *record;
+    struct timespec now;
+    uint32_t head;
+
+    if (ring == NULL) {
+        ring = thread_ring = thread_ring_create(&all_rings);
+        if (ring == NULL) {
+            return;
+        }
+    }
+    head = ring->head;
+    record = &((TraceRingRecord *)ring->records)[head & TRACE_RING_MASK];
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    record->timestamp = now.tv_sec * 1000000000ULL + now.tv_nsec;
+    record->event = event;
+    record->thread = ring->thread;
+    record->flags = 0;
+    if (arg_count > TRACE_RING_MAX_ARGS) {
+        arg_count = TRACE_RING_MAX_ARGS;
+        record->flags |= TRACE_RING_TRUNCATED_ARGS;
+    }
+    record->arg_count = arg_count;
+    memcpy(record->args, args, arg_count * sizeof(args[0]));
+    record->text[0] = '\0';
+    if (text != NULL) {
+        size_t length = strnlen(text, TRACE_RING_TEXT_BYTES);
+        if (length == TRACE_RING_TEXT_BYTES) {
+            --length;
+            record->flags |= TRACE_RING_TRUNCATED_TEXT;
+        }
+        memcpy(record->text, text, length);
+        record->text[length] = '\0';
+    }
+    thread_ring_publish(ring, head);
+}
+
+void trace_ring_flush(void)
+{
+    if (trace_file == NULL) {
+        return;
+    }
+    pthread_mutex_lock(&drain_lock);
+    thread_ring_drain(&all_rings, trace_file);
+    fflush(trace_file);
+    pthread_mutex_unlock(&drain_lock);
+}
+
+static long write_event_table(FILE *file)
+{
+    TraceEventID id;
+    long length = 0;
+    int written;
+
+    for (id = 0; id < trace_event_count(); ++id) {
+        written = fprintf(file, "%s\t%s\t%s\n",
+                          trace_event_get_name(trace_event_id(id)),
+                          trace_ring_events[id].kinds,
+                          trace_ring_events[id].arg_names);
+        if (written < 0) {
+            return -1;
+        }
+        length += written;
+    }
+    return length;
+}
+
+bool trace_ring_init(const char *file)
+{
+    TraceRingFileHeader header = {
+        .magic = TRACE_RING_MAGIC,
+        .version = TRACE_RING_VERSION,
+        .record_size = sizeof(TraceRingRecord),
+        .event_count = TRACE_EVENT_COUNT
+    };
+    long table_length;
+
+    if (file == NULL) {
+        file = TRACE_RING_DEFAULT_FILE;
+    }
+    trace_file = fopen(file, "wb");
+    if (trace_file == NULL) {
+        perror("Couldn't open trace file");
+        return false;
+    }
+    /* The table's length goes in the header, so write the header twice. */
+    fwrite(&header, sizeof(header), 1, trace_file);
+    table_length = write_event_table(trace_file);
+    if (table_length < 0) {
+        fclose(trace_file);
+        trace_file = NULL;
+        return false;
+    }
+    header.event_table_length = table_length;
+    fseek(trace_file, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, trace_file);
+    fseek(trace_file, 0, SEEK_END);
+    atexit(trace_ring_flush);
+    return true;
+}
@@ -0,0 +1,118 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/*
+ * A tracing backend that records each enabled trace_* event as a fixed-size
+ * binary record in a ring owned by the calling thread. When an event is
+ * disabled its tracer costs one test of the event's dynamic state; when it is
+ * enabled, a timestamp and the arguments are stored without locking or
+ * formatting. Once a ring is full its oldest records are overwritten.
+ *
+ * The rings are drained into the trace file by trace_ring_flush and at exit.
+ * The file starts with a TraceRingFileHeader, followed by one text line per
+ * event, "name\tkinds\targument names", and then the records. dump-trace-ring
+ * prints it as text or as a Chrome trace JSON timeline.
+ */
+
+#ifndef TRACE__RING_H
+#define TRACE__RING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "trace/generated-events.h"
+
+#define TRACE_RING_MAGIC 0x47525254 /* "TRRG" on disk */
+#define TRACE_RING_VERSION 1
+#define TRACE_RING_RECORDS (16 * 1024) /* Power of two; 1.75 MB a thread */
+#define TRACE_RING_MAX_ARGS 8
+#define TRACE_RING_TEXT_BYTES 32
+#define TRACE_RING_DEFAULT_FILE "thunderclap.trace"
+
+#define TRACE_RING_TRUNCATED_ARGS 0x1 /* More than TRACE_RING_MAX_ARGS */
+#define TRACE_RING_TRUNCATED_TEXT 0x2 /* Longer than TRACE_RING_TEXT_BYTES */
+
+/*
+ * The kind of each argument, as recorded in the file's event table. Signed
+ * integers are sign extended to 64 bits and doubles keep their bits.
+ */
+#define TRACE_RING_KIND_SIGNED 'i'
+#define TRACE_RING_KIND_UNSIGNED 'u'
+#define TRACE_RING_KIND_POINTER 'p'
+#define TRACE_RING_KIND_STRING 's' /* Pointer, and text for the first one */
+#define TRACE_RING_KIND_DOUBLE 'd'
+
+/* In host byte order, as are the records. */
+typedef struct TraceRingFileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t event_count;
+    uint32_t event_table_length; /* Bytes of event lines after the header */
+} TraceRingFileHeader;
+
+typedef struct TraceRingRecord {
+    uint64_t timestamp; /* CLOCK_MONOTONIC nanoseconds */
+    uint16_t event; /* TraceEventID */
+    uint8_t arg_count;
+    uint8_t flags;
+    uint32_t thread; /* In order of each thread's first event */
+    uint64_t args[TRACE_RING_MAX_ARGS];
+    char text[TRACE_RING_TEXT_BYTES]; /* First string argument */
+} TraceRingRecord;
+
+typedef struct TraceRingEventInfo {
+    const char *kinds; /* One TRACE_RING_KIND_* for each argument */
+    const char *arg_names; /* Comma separated */
+} TraceRingEventInfo;
+
+/* Generated with the tracers, indexed by TraceEventID. */
+extern const TraceRingEventInfo trace_ring_events[TRACE_EVENT_COUNT];
+
+bool trace_ring_init(const char *file);
+
+/* Writes every thread's undrained records to the trace file. */
+void trace_ring_flush(void);
+
+/* Only called for enabled events, so it can be out of line. */
+void trace_ring_record(TraceEventID event, const uint64_t *args,
+                       int arg_count, const char *text);
+
+static inline uint64_t trace_ring_double(double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+#endif  /* TRACE__RING_H */
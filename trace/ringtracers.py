@@ -0,0 +1,143 @@
+#!/usr/bin/env python
+# SPDX-License-Identifier: BSD-2-Clause
+#
+# This software was developed by SRI International and the University of
+# Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+# ("CTSRD"), as part of the DARPA CRASH research programme.
+#
+# We acknowledge the support of EPSRC.
+#
+# We acknowledge the support of Arm Ltd.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#
+# THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+# OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+# HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+# OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+# SUCH DAMAGE.
+
+# Regenerates trace/generated-tracers.h so that every trace_* function
+# records into the ring backend (trace/ring.h) when its event is enabled, and
+# writes trace/generated-ring-events.c, which describes each event's
+# arguments for the trace file.
+#
+# The tree has no tracetool or trace-events, so the signatures are read back
+# from generated-tracers.h itself; running this again regenerates the same
+# files.
+#
+# Usage: python trace/ringtracers.py (from the top of the tree)
+
+from __future__ import print_function
+
+import re
+
+TRACERS = 'trace/generated-tracers.h'
+EVENT_INFO = 'trace/generated-ring-events.c'
+
+TRACER = re.compile(r'static inline void trace_(\w+)\((.*?)\)\n\{\n.*?^\}\n',
+                    re.MULTILINE | re.DOTALL)
+SIGNED_TYPES = frozenset({'int', 'int8_t', 'int16_t', 'int32_t', 'int64_t',
+                          'long', 'ssize_t', 'char'})
+
+HEADER = '''/* This file is autogenerated by trace/ringtracers.py, do not edit. */
+
+#ifndef TRACE__GENERATED_TRACERS_H
+#define TRACE__GENERATED_TRACERS_H
+
+#include "qemu-common.h"
+#include "trace/control.h"
+#include "trace/ring.h"
+
+'''
+
+FOOTER = '''#endif /* TRACE__GENERATED_TRACERS_H */
+'''
+
+
+def parse_argument(argument):
+    match = re.match(r'(.*?)\s*(\w+)$', argument)
+    arg_type = match.group(1).replace(' ', '')
+    name = match.group(2)
+    if '*' in arg_type:
+        if arg_type.rstrip('*').endswith('char'):
+            return arg_type, name, 's'
+        return arg_type, name, 'p'
+    elif arg_type == 'double':
+        return arg_type, name, 'd'
+    elif arg_type in SIGNED_TYPES:
+        return arg_type, name, 'i'
+    return arg_type, name, 'u'
+
+
+def value(name, kind):
+    if kind in 'ps':
+        return '(uintptr_t){}'.format(name)
+    elif kind == 'd':
+        return 'trace_ring_double({})'.format(name)
+    return '(uint64_t){}'.format(name)
+
+
+def tracer(name, signature, arguments):
+    event = 'TRACE_' + name.upper()
+    lines = ['static inline void trace_{}({})'.format(name, signature), '{',
+             '    if (trace_event_get_state({})) {{'.format(event)]
+    if arguments:
+        strings = [arg for _, arg, kind in arguments if kind == 's']
+        lines.append('        uint64_t args[] = {{ {} }};'.format(', '.join(
+            value(arg, kind) for _, arg, kind in arguments)))
+        lines.append('        trace_ring_record({}, args, {}, {});'.format(
+            event, len(arguments), strings[0] if strings else 'NULL'))
+    else:
+        lines.append('        trace_ring_record({}, NULL, 0, NULL);'.format(
+            event))
+    lines.extend(['    }', '}', ''])
+    return '\n'.join(lines) + '\n'
+
+
+def main():
+    with open(TRACERS) as tracers_file:
+        tracers = TRACER.findall(tracers_file.read())
+
+    events = []
+    with open(TRACERS, 'w') as tracers_file:
+        tracers_file.write(HEADER)
+        for name, signature in tracers:
+            if signature.strip() == 'void':
+                arguments = []
+            else:
+                arguments = [parse_argument(argument.strip())
+                             for argument in signature.split(',')]
+            tracers_file.write(tracer(name, signature, arguments))
+            events.append((name, arguments))
+        tracers_file.write(FOOTER)
+
+    with open(EVENT_INFO, 'w') as info_file:
+        info_file.write('/* This file is autogenerated by '
+                        'trace/ringtracers.py, do not edit. */\n\n'
+                        '#include "trace/generated-events.h"\n'
+                        '#include "trace/ring.h"\n\n'
+                        'const TraceRingEventInfo '
+                        'trace_ring_events[TRACE_EVENT_COUNT] = {\n')
+        for name, arguments in events:
+            info_file.write('    [TRACE_{}] = {{ "{}", "{}" }},\n'.format(
+                name.upper(), ''.join(kind for _, _, kind in arguments),
+                ','.join(arg for _, arg, _ in arguments)))
+        info_file.write('};\n')
+    print('Generated {} tracers.'.format(len(events)))
+
+if __name__ == '__main__':
+    main()
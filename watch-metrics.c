@@ -0,0 +1,199 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+/*
+ * Samples the metrics file that thunderclap keeps (tlp_metrics.h) and prints
+ * what changed in each interval: TLPs and payload bytes per type and
+ * direction, unsupported requests, the pending queue and buffer pool, and
+ * the DMA read and completion latencies. The first sample covers the whole
+ * session so far. Reading the file never disturbs the process writing it.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "pcie.h"
+#include "tlp_metrics.h"
+
+/*
+ * The writer updates the counters while we copy them, so take each one with
+ * a single load rather than with memcpy, which might tear them.
+ */
+static void
+take_snapshot(const volatile struct tlp_metrics_file *file,
+	struct tlp_metrics_file *snapshot)
+{
+	const volatile uint64_t *from = (const volatile uint64_t *)file;
+	uint64_t *to = (uint64_t *)snapshot;
+
+	for (size_t i = 0; i < sizeof(*snapshot) / sizeof(uint64_t); ++i) {
+		to[i] = tlp_metrics_load(&from[i]);
+	}
+}
+
+static const char *
+type_name(int type)
+{
+	static char message[8];
+	if ((type & 0x18) == MSG) {
+		snprintf(message, sizeof(message), "MSG_%d", type & 0x7);
+		return message;
+	}
+	return tlp_type_str(type);
+}
+
+/* The upper bound of the bucket holding the given fraction of the values. */
+static uint64_t
+histogram_quantile(const uint64_t *buckets, uint64_t count, double fraction)
+{
+	uint64_t seen = 0;
+	for (int bucket = 0; bucket < TLP_METRICS_BUCKETS; ++bucket) {
+		seen += buckets[bucket];
+		if (seen > 0 && seen >= fraction * count) {
+			return bucket == 0 ? 0 : (UINT64_MAX >> (64 - bucket));
+		}
+	}
+	return UINT64_MAX;
+}
+
+static void
+print_histogram(const char *name, const struct tlp_metrics_histogram *now,
+	const struct tlp_metrics_histogram *then)
+{
+	uint64_t buckets[TLP_METRICS_BUCKETS];
+	uint64_t count = now->count - then->count;
+
+	printf("%-24s", name);
+	if (count == 0) {
+		printf(" -\n");
+		return;
+	}
+	for (int bucket = 0; bucket < TLP_METRICS_BUCKETS; ++bucket) {
+		buckets[bucket] = now->buckets[bucket] - then->buckets[bucket];
+	}
+	printf(" %8"PRIu64" mean %9.0f  p50 <= %9"PRIu64"  p99 <= %9"PRIu64
+		"  max %9"PRIu64"\n", count, (double)(now->sum - then->sum) / count,
+		histogram_quantile(buckets, count, 0.5),
+		histogram_quantile(buckets, count, 0.99), now->max);
+}
+
+static void
+print_sample(const struct tlp_metrics_file *now,
+	const struct tlp_metrics_file *then, double seconds)
+{
+	uint64_t received, sent;
+
+	if (seconds == 0) {
+		printf("--- Since the session started\n");
+	} else {
+		printf("--- Last %.2f s\n", seconds);
+	}
+	printf("%-8s %10s %12s %10s %12s\n", "Type", "Received", "Bytes",
+		"Sent", "Bytes");
+	for (int type = 0; type < TLP_METRICS_TYPES; ++type) {
+		received = now->tlps[TMD_RECEIVED][type] -
+			then->tlps[TMD_RECEIVED][type];
+		sent = now->tlps[TMD_SENT][type] - then->tlps[TMD_SENT][type];
+		if (received == 0 && sent == 0) {
+			continue;
+		}
+		printf("%-8s %10"PRIu64" %12"PRIu64" %10"PRIu64" %12"PRIu64"\n",
+			type_name(type), received,
+			now->payload_bytes[TMD_RECEIVED][type] -
+			then->payload_bytes[TMD_RECEIVED][type], sent,
+			now->payload_bytes[TMD_SENT][type] -
+			then->payload_bytes[TMD_SENT][type]);
+	}
+	printf("Unsupported requests: %"PRIu64" received, %"PRIu64" sent\n",
+		now->unsupported_requests[TMD_RECEIVED] -
+		then->unsupported_requests[TMD_RECEIVED],
+		now->unsupported_requests[TMD_SENT] -
+		then->unsupported_requests[TMD_SENT]);
+	printf("Pending TLPs: %"PRIu64" (peak %"PRIu64"), "
+		"TLP buffers in use: %"PRIu64" (peak %"PRIu64")\n",
+		now->pending_tlps, now->pending_tlps_peak, now->buffers_in_use,
+		now->buffers_in_use_peak);
+	print_histogram("DMA read latency", &now->dma_read_latency,
+		&then->dma_read_latency);
+	print_histogram("Completion service time",
+		&now->completion_service_time, &then->completion_service_time);
+	fflush(stdout);
+}
+
+int
+main(int argc, char *argv[])
+{
+	struct tlp_metrics metrics;
+	struct tlp_metrics_file now, then;
+	struct timespec interval;
+	double seconds = 1.0;
+	long samples = 0;
+
+	if (argc < 2 || argc > 4) {
+		fprintf(stderr, "Usage: %s <metrics file> [INTERVAL [SAMPLES]]\n",
+			argv[0]);
+		return 1;
+	}
+	if (argc > 2) {
+		seconds = atof(argv[2]);
+	}
+	if (argc > 3) {
+		samples = atol(argv[3]);
+	}
+	if (seconds <= 0) {
+		fprintf(stderr, "The interval must be positive.\n");
+		return 1;
+	}
+	if (!tlp_metrics_open_existing(&metrics, argv[1])) {
+		return 1;
+	}
+	printf("Watching %s, written by process %"PRIu32".\n", argv[1],
+		metrics.file->pid);
+
+	interval.tv_sec = (time_t)seconds;
+	interval.tv_nsec = (long)((seconds - interval.tv_sec) * 1e9);
+	memset(&then, 0, sizeof(then));
+	for (long sample = 0; samples == 0 || sample < samples; ++sample) {
+		take_snapshot(metrics.file, &now);
+		print_sample(&now, &then, sample == 0 ? 0 : seconds);
+		then = now;
+		if (samples == 0 || sample + 1 < samples) {
+			nanosleep(&interval, NULL);
+		}
+	}
+
+	tlp_metrics_close(&metrics);
+	return 0;
+}
@@ -0,0 +1,421 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "window_monitor.h"
+
+#define HASH_PRIME_1 0x9E3779B185EBCA87ULL
+#define HASH_PRIME_2 0xC2B2AE3D27D4EB4FULL
+#define HASH_PRIME_3 0x165667B19E3779F9ULL
+
+static inline uint64_t
+rotate_left(uint64_t value, int bits)
+{
+	return (value << bits) | (value >> (64 - bits));
+}
+
+static inline uint64_t
+load_word(const uint8_t *bytes)
+{
+	uint64_t word;
+	memcpy(&word, bytes, sizeof(word));
+	return word;
+}
+
+uint64_t
+window_monitor_hash_line(const uint8_t *line, uint32_t length)
+{
+	/* Four independent xxHash64-style lanes, folded at the end. */
+	uint64_t lanes[4] = {
+		HASH_PRIME_1 + HASH_PRIME_2, HASH_PRIME_2, 0, -HASH_PRIME_1 };
+	uint64_t hash;
+	uint32_t i;
+
+	for (i = 0; i + 32 <= length; i += 32) {
+		for (int lane = 0; lane < 4; ++lane) {
+			lanes[lane] += load_word(line + i + lane * 8) * HASH_PRIME_2;
+			lanes[lane] = rotate_left(lanes[lane], 31) * HASH_PRIME_1;
+		}
+	}
+	hash = rotate_left(lanes[0], 1) + rotate_left(lanes[1], 7) +
+		rotate_left(lanes[2], 12) + rotate_left(lanes[3], 18) + length;
+	for (; i < length; ++i) {
+		hash ^= line[i] * HASH_PRIME_3;
+		hash = rotate_left(hash, 11) * HASH_PRIME_1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= HASH_PRIME_2;
+	hash ^= hash >> 29;
+	hash *= HASH_PRIME_3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+/*
+ * Hashes every line of a window, and returns a mask of the lines whose hash
+ * differs from the one stored.
+ */
+static uint64_t
+hash_window(struct monitored_window *window, const uint8_t *contents)
+{
+	uint64_t changed = 0, hash;
+	uint32_t line, offset, length;
+
+	for (line = 0, offset = 0; offset < window->length;
+		++line, offset += WINDOW_MONITOR_LINE_BYTES) {
+		length = window->length - offset;
+		if (length > WINDOW_MONITOR_LINE_BYTES) {
+			length = WINDOW_MONITOR_LINE_BYTES;
+		}
+		hash = window_monitor_hash_line(contents + offset, length);
+		if (hash != window->line_hashes[line]) {
+			window->line_hashes[line] = hash;
+			changed |= 1ULL << line;
+		}
+	}
+	return changed;
+}
+
+/*
+ * Index
+ * ---------------------------------------------------------------------------
+ */
+
+static inline uint32_t
+index_slot(const struct window_monitor *monitor, uint64_t base)
+{
+	return (base * HASH_PRIME_1) >> 32 & monitor->index_mask;
+}
+
+static uint32_t *
+index_find(const struct window_monitor *monitor, uint64_t base)
+{
+	uint32_t slot = index_slot(monitor, base);
+	while (monitor->index[slot] != 0) {
+		if (monitor->windows[monitor->index[slot] - 1].base == base) {
+			return &monitor->index[slot];
+		}
+		slot = (slot + 1) & monitor->index_mask;
+	}
+	return &monitor->index[slot];
+}
+
+/* Backward-shift deletion, so that the index never fills with tombstones. */
+static void
+index_remove(struct window_monitor *monitor, uint32_t *entry)
+{
+	uint32_t hole = entry - monitor->index;
+	uint32_t slot = hole, home;
+
+	while (true) {
+		slot = (slot + 1) & monitor->index_mask;
+		if (monitor->index[slot] == 0) {
+			break;
+		}
+		home = index_slot(monitor,
+			monitor->windows[monitor->index[slot] - 1].base);
+		/* Move the entry back unless its home lies between hole and slot. */
+		if (((slot - home) & monitor->index_mask) >=
+			((slot - hole) & monitor->index_mask)) {
+			monitor->index[hole] = monitor->index[slot];
+			hole = slot;
+		}
+	}
+	monitor->index[hole] = 0;
+}
+
+/*
+ * Schedule
+ * ---------------------------------------------------------------------------
+ */
+
+static inline bool
+heap_before(const struct window_monitor *monitor, uint32_t a, uint32_t b)
+{
+	return monitor->windows[monitor->heap[a]].next_poll_ns <
+		monitor->windows[monitor->heap[b]].next_poll_ns;
+}
+
+static inline void
+heap_swap(struct window_monitor *monitor, uint32_t a, uint32_t b)
+{
+	uint32_t window = monitor->heap[a];
+	monitor->heap[a] = monitor->heap[b];
+	monitor->heap[b] = window;
+	monitor->windows[monitor->heap[a]].heap_position = a;
+	monitor->windows[monitor->heap[b]].heap_position = b;
+}
+
+static void
+heap_sift(struct window_monitor *monitor, uint32_t position)
+{
+	uint32_t parent, child;
+
+	while (position > 0) {
+		parent = (position - 1) / 2;
+		if (!heap_before(monitor, position, parent)) {
+			break;
+		}
+		heap_swap(monitor, position, parent);
+		position = parent;
+	}
+	while ((child = 2 * position + 1) < monitor->count) {
+		if (child + 1 < monitor->count &&
+			heap_before(monitor, child + 1, child)) {
+			++child;
+		}
+		if (!heap_before(monitor, child, position)) {
+			break;
+		}
+		heap_swap(monitor, position, child);
+		position = child;
+	}
+}
+
+static void
+refill_tokens(struct window_monitor *monitor, uint64_t now_ns)
+{
+	uint64_t elapsed_ns;
+
+	if (monitor->budget_bytes_per_second == 0) {
+		return;
+	}
+	if (now_ns <= monitor->last_refill_ns) {
+		return;
+	}
+	elapsed_ns = now_ns - monitor->last_refill_ns;
+	monitor->last_refill_ns = now_ns;
+	if (elapsed_ns >= 1000000000ULL) {
+		monitor->tokens = monitor->burst_bytes;
+		return;
+	}
+	monitor->tokens +=
+		monitor->budget_bytes_per_second * elapsed_ns / 1000000000ULL;
+	if (monitor->tokens > monitor->burst_bytes) {
+		monitor->tokens = monitor->burst_bytes;
+	}
+}
+
+/*
+ * Monitor
+ * ---------------------------------------------------------------------------
+ */
+
+bool
+window_monitor_init(struct window_monitor *monitor, uint32_t capacity,
+	uint64_t budget_bytes_per_second, uint64_t min_interval_ns,
+	uint64_t max_interval_ns, WindowRead read, WindowChanged changed)
+{
+	uint32_t index_size = 1;
+
+	memset(monitor, 0, sizeof(*monitor));
+	while (index_size < 2 * capacity) {
+		index_size <<= 1;
+	}
+	monitor->capacity = capacity;
+	monitor->windows = calloc(capacity, sizeof(*monitor->windows));
+	monitor->free_windows = calloc(capacity, sizeof(*monitor->free_windows));
+	monitor->heap = calloc(capacity, sizeof(*monitor->heap));
+	monitor->index = calloc(index_size, sizeof(*monitor->index));
+	monitor->index_mask = index_size - 1;
+	/* A zero interval would poll a window forever within one call. */
+	monitor->min_interval_ns = min_interval_ns > 0 ? min_interval_ns : 1;
+	monitor->max_interval_ns =
+		max_interval_ns > monitor->min_interval_ns ? max_interval_ns :
+		monitor->min_interval_ns;
+	monitor->budget_bytes_per_second = budget_bytes_per_second;
+	/* Allow a tenth of a second of reads at once, and at least a window. */
+	monitor->burst_bytes = budget_bytes_per_second / 10;
+	if (monitor->burst_bytes < WINDOW_MONITOR_MAX_BYTES) {
+		monitor->burst_bytes = WINDOW_MONITOR_MAX_BYTES;
+	}
+	monitor->tokens = monitor->burst_bytes;
+	monitor->read = read;
+	monitor->changed = changed;
+
+	if (monitor->windows == NULL || monitor->free_windows == NULL ||
+		monitor->heap == NULL || monitor->index == NULL) {
+		window_monitor_destroy(monitor);
+		return false;
+	}
+	return true;
+}
+
+void
+window_monitor_destroy(struct window_monitor *monitor)
+{
+	free(monitor->windows);
+	free(monitor->free_windows);
+	free(monitor->heap);
+	free(monitor->index);
+	memset(monitor, 0, sizeof(*monitor));
+}
+
+bool
+window_monitor_add(struct window_monitor *monitor, uint64_t base,
+	uint32_t length, const uint8_t *contents, uint64_t now_ns)
+{
+	struct monitored_window *window;
+	uint32_t *entry, id;
+
+	if (length == 0 || length > WINDOW_MONITOR_MAX_BYTES ||
+		monitor->count == monitor->capacity) {
+		return false;
+	}
+	entry = index_find(monitor, base);
+	if (*entry != 0) {
+		return false;
+	}
+
+	if (monitor->free_count > 0) {
+		id = monitor->free_windows[--monitor->free_count];
+	} else {
+		id = monitor->next_unused++;
+	}
+	window = &monitor->windows[id];
+	memset(window, 0, sizeof(*window));
+	window->base = base;
+	window->length = length;
+	window->in_use = true;
+	window->interval_ns = monitor->min_interval_ns;
+	window->next_poll_ns = now_ns + window->interval_ns;
+	if (contents != NULL) {
+		hash_window(window, contents);
+	}
+
+	*entry = id + 1;
+	window->heap_position = monitor->count;
+	monitor->heap[monitor->count++] = id;
+	heap_sift(monitor, window->heap_position);
+	return true;
+}
+
+static void
+remove_window(struct window_monitor *monitor, uint32_t *entry)
+{
+	uint32_t id = *entry - 1;
+	uint32_t position = monitor->windows[id].heap_position;
+
+	index_remove(monitor, entry);
+	monitor->windows[id].in_use = false;
+	monitor->free_windows[monitor->free_count++] = id;
+
+	--monitor->count;
+	if (position != monitor->count) {
+		heap_swap(monitor, position, monitor->count);
+		heap_sift(monitor, position);
+	}
+}
+
+void
+window_monitor_remove(struct window_monitor *monitor, uint64_t base)
+{
+	uint32_t *entry = index_find(monitor, base);
+	if (*entry != 0) {
+		remove_window(monitor, entry);
+	}
+}
+
+struct monitored_window *
+window_monitor_find(const struct window_monitor *monitor, uint64_t base)
+{
+	uint32_t *entry = index_find(monitor, base);
+	return *entry == 0 ? NULL : &monitor->windows[*entry - 1];
+}
+
+int
+window_monitor_poll(struct window_monitor *monitor, uint64_t now_ns,
+	void *opaque)
+{
+	uint8_t contents[WINDOW_MONITOR_MAX_BYTES];
+	struct monitored_window *window;
+	uint64_t changed_lines;
+	bool remove;
+	int polled = 0;
+
+	refill_tokens(monitor, now_ns);
+
+	while (monitor->count > 0) {
+		window = &monitor->windows[monitor->heap[0]];
+		if (window->next_poll_ns > now_ns) {
+			break;
+		}
+		if (monitor->budget_bytes_per_second != 0 &&
+			monitor->tokens < window->length) {
+			++monitor->deferred_polls;
+			break;
+		}
+		monitor->tokens -= monitor->budget_bytes_per_second != 0 ?
+			window->length : 0;
+		monitor->bytes_read += window->length;
+		++monitor->polls;
+		++window->polls;
+		++polled;
+
+		remove = false;
+		if (monitor->read(contents, window->length, window->base, opaque)
+			!= DRR_SUCCESS) {
+			++monitor->read_failures;
+			remove = true;
+		} else {
+			changed_lines = hash_window(window, contents);
+			if (changed_lines != 0) {
+				++monitor->changes;
+				++window->changes;
+				window->interval_ns /= 2;
+				if (monitor->changed != NULL) {
+					monitor->changed(window, contents, changed_lines,
+						&remove, opaque);
+				}
+			} else {
+				window->interval_ns *= 2;
+			}
+		}
+
+		if (remove) {
+			remove_window(monitor, index_find(monitor, window->base));
+			continue;
+		}
+		if (window->interval_ns < monitor->min_interval_ns) {
+			window->interval_ns = monitor->min_interval_ns;
+		} else if (window->interval_ns > monitor->max_interval_ns) {
+			window->interval_ns = monitor->max_interval_ns;
+		}
+		window->next_poll_ns = now_ns + window->interval_ns;
+		heap_sift(monitor, 0);
+	}
+	return polled;
+}
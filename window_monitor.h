@@ -0,0 +1,153 @@
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause
+ * 
+ * This software was developed by SRI International and the University of
+ * Cambridge Computer Laboratory under DARPA/AFRL contract FA8750-10-C-0237
+ * ("CTSRD"), as part of the DARPA CRASH research programme.
+ * 
+ * We acknowledge the support of EPSRC.
+ * 
+ * We acknowledge the support of Arm Ltd.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef WINDOW_MONITOR_H
+#define WINDOW_MONITOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pcie.h"
+
+/*
+ * Watches many IOVA windows for changes. Each window is at most a page, and is
+ * hashed per 64-byte line so that a change can be located as well as
+ * detected. Windows that change are polled more often, down to
+ * min_interval_ns, and windows that do not back off up to max_interval_ns.
+ * Reads are limited to a DMA budget in bytes per second.
+ */
+
+#define WINDOW_MONITOR_LINE_BYTES 64
+#define WINDOW_MONITOR_MAX_BYTES 4096
+#define WINDOW_MONITOR_LINES \
+	(WINDOW_MONITOR_MAX_BYTES / WINDOW_MONITOR_LINE_BYTES)
+
+struct monitored_window {
+	uint64_t base;
+	uint32_t length;
+	bool in_use;
+	uint32_t heap_position;
+	uint64_t next_poll_ns;
+	uint64_t interval_ns;
+	uint64_t polls;
+	uint64_t changes;
+	uint64_t line_hashes[WINDOW_MONITOR_LINES];
+};
+
+typedef enum dma_read_response (*WindowRead)(uint8_t *buffer,
+	uint64_t length, uint64_t address, void *opaque);
+
+/*
+ * changed_lines has bit i set when line i of the window changed. The window
+ * is removed after the callback if remove is set to true.
+ */
+typedef void (*WindowChanged)(const struct monitored_window *window,
+	const uint8_t *contents, uint64_t changed_lines, bool *remove,
+	void *opaque);
+
+struct window_monitor {
+	struct monitored_window *windows;
+	uint32_t capacity;
+	uint32_t count;
+	uint32_t next_unused;
+	uint32_t *free_windows;
+	uint32_t free_count;
+
+	/* Open-addressed index from window base to window, 0 for empty. */
+	uint32_t *index;
+	uint32_t index_mask;
+
+	/* Binary min-heap of windows ordered by next_poll_ns */
+	uint32_t *heap;
+
+	uint64_t min_interval_ns;
+	uint64_t max_interval_ns;
+
+	/* Token bucket; a budget of 0 is unlimited. */
+	uint64_t budget_bytes_per_second;
+	uint64_t tokens;
+	uint64_t burst_bytes;
+	uint64_t last_refill_ns;
+
+	WindowRead read;
+	WindowChanged changed;
+
+	uint64_t polls;
+	uint64_t changes;
+	uint64_t bytes_read;
+	uint64_t deferred_polls;
+	uint64_t read_failures;
+};
+
+bool
+window_monitor_init(struct window_monitor *monitor, uint32_t capacity,
+	uint64_t budget_bytes_per_second, uint64_t min_interval_ns,
+	uint64_t max_interval_ns, WindowRead read, WindowChanged changed);
+
+void
+window_monitor_destroy(struct window_monitor *monitor);
+
+/*
+ * Starts watching a window. contents, if not NULL, are its current contents;
+ * otherwise the first poll reports every line as changed. Returns false if
+ * the monitor is full, length is 0 or longer than a page, or base is already
+ * watched.
+ */
+bool
+window_monitor_add(struct window_monitor *monitor, uint64_t base,
+	uint32_t length, const uint8_t *contents, uint64_t now_ns);
+
+void
+window_monitor_remove(struct window_monitor *monitor, uint64_t base);
+
+struct monitored_window *
+window_monitor_find(const struct window_monitor *monitor, uint64_t base);
+
+/*
+ * Reads every window whose poll is due, as far as the budget allows, and
+ * reports those that changed. A window that cannot be read is removed.
+ * opaque is passed to the read and changed callbacks. Returns the number of
+ * windows read.
+ */
+int
+window_monitor_poll(struct window_monitor *monitor, uint64_t now_ns,
+	void *opaque);
+
+/*
+ * Hashes one line for change detection. Every byte affects the result,
+ * and moving or swapping words changes it.
+ */
+uint64_t
+window_monitor_hash_line(const uint8_t *line, uint32_t length);
+
+#endif